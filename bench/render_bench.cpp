@@ -0,0 +1,533 @@
+// Render benchmark for the native build: pio run -e native_bench, then
+//
+//   .pio/build/native_bench/program [options]
+//     --frames N       timed frames per case (default 300)
+//     --only NAME      run only the cases whose name starts with NAME
+//     --out DIR        write each case's reference frame to DIR/<case>.ppm
+//     --golden DIR     compare reference frames with DIR/<case>.ppm; exit 1
+//                      on any difference
+//     --hashes FILE    compare reference frames with the hashes in FILE
+//                      (bench/golden_hashes.txt is committed); exit 1 on
+//                      any difference or missing case
+//     --save-hashes FILE  write the reference frames' hashes to FILE
+//     --csv FILE       save the results
+//     --baseline FILE  print frame-time deltas against an earlier --csv
+//
+// Every screen is drawn from scripted Stats / WeatherData through the same
+// functions the render task calls (screens.h, WeatherDisplay::draw), with no
+// feeder, network or scheduler. Per case it reports the frame time (draw +
+// sprite push, host micros()), pixels written into the sprite (overdraw
+// included) and pixels pushed to the panel. The reference frame is the one
+// after the warm-up frames, so it does not depend on --frames. Its hash is
+// 64-bit FNV-1a over the panel's RGB565 words; regenerate the committed
+// hashes with --save-hashes after a deliberate change to what is drawn.
+//
+// The weather-*-rebuild cases invalidate the view-model before every frame,
+// i.e. format and measure every label per frame as draw() did before the
+// model existed. Next to the frame times (where the difference is lost in
+// the noise of a host run) they report the mean rebuild time itself: what
+// the model saves per frame.
+//
+// The decode-* cases draw nothing: each "frame" decodes every bundled icon
+// (more than the image cache holds, so every one misses) or every printable
+// ASCII glyph of the fonts the firmware draws, and the mean time per decode
+// is reported. They have no reference frame.
+
+#include <Arduino.h>
+#include <M5Unified.h>
+#include <math.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "asset_bundle.h"
+#include "native_hal.h"
+#include "pc_stats.h"
+#include "screens.h"
+#include "weather_integration.h"
+
+extern LGFX_Sprite gfx;
+
+namespace {
+
+constexpr int kWarmupFrames = 8;  // fills glyph caches and the view-model
+constexpr uint32_t kBenchEpoch = 1735732800;  // 2025-01-01 12:00:00 UTC
+constexpr size_t kPanelPixels = (size_t)NATIVE_PANEL_WIDTH * NATIVE_PANEL_HEIGHT;
+
+struct Options {
+  int frames = 300;
+  const char *only = nullptr;
+  const char *outDir = nullptr;
+  const char *goldenDir = nullptr;
+  const char *hashesPath = nullptr;
+  const char *saveHashesPath = nullptr;
+  const char *csvPath = nullptr;
+  const char *baselinePath = nullptr;
+};
+
+struct Result {
+  std::string name;
+  uint32_t meanUs = 0;
+  uint32_t p50Us = 0;
+  uint32_t p99Us = 0;
+  uint32_t maxUs = 0;
+  uint64_t touched = 0;  // per frame
+  uint64_t pushed = 0;   // per frame
+  double rebuildUs = -1; // mean view-model rebuild, rebuild cases only
+  double decodeUs = -1;  // mean per icon or glyph, decode cases only
+  uint64_t frameHash = 0;  // reference frame, drawn cases only
+};
+
+// ------------------- Scripted data -------------------
+
+Stats busySample() {
+  Stats s;
+  s.cpu = 63;
+  s.mem = 48;
+  s.gpu = 87;
+  s.diskPct = 34;
+  s.diskMBps = 152.5f;
+  s.cpuTempF = 149;
+  s.gpuTempF = 158;
+  s.freeC = 212;
+  s.freeD = 1480;
+  s.indoorTempF = 71;
+  return s;
+}
+
+// Sensors missing, as sent by a feeder without admin rights or a GPU.
+Stats sparseSample() {
+  Stats s;
+  s.cpu = 7;
+  s.mem = 31;
+  s.gpu = -1;
+  s.diskPct = 2;
+  return s;
+}
+
+// A full history with every field moving, so the sparkline spans its box.
+StatsHistory wavyHistory(const Stats &last) {
+  StatsHistory h;
+  for (int i = 0; i < HIST_N; ++i) {
+    float phase = i * 0.37f;
+    Stats s = last;
+    s.cpu = 50 + 45 * sinf(phase);
+    s.mem = 45 + 5 * sinf(phase * 0.2f);
+    s.gpu = 60 + 35 * sinf(phase * 1.7f + 1);
+    s.diskPct = fabsf(40 * sinf(phase * 0.6f));
+    s.diskMBps = 80 + 75 * sinf(phase * 2.3f);
+    h.push(i == HIST_N - 1 ? last : s);
+  }
+  return h;
+}
+
+WeatherData scriptedWeather() {
+  static const char *const kDays[WEATHER_FORECAST_DAYS] = {"Wed", "Thu", "Fri", "Sat", "Sun"};
+  static const char *const kIcons[WEATHER_FORECAST_DAYS] = {"01d", "02d", "10d", "13d", "04d"};
+  WeatherData w;
+  strlcpy(w.location, "Toronto", sizeof(w.location));
+  strlcpy(w.description, "light snow showers", sizeof(w.description));
+  w.icon = weatherIconIndex("13d");
+  w.temperature = 27.4f;
+  w.feelsLike = 18.9f;
+  w.humidity = 81;
+  w.windSpeed = 12.3f;
+  w.pressure = 1012;
+  w.tempMin = 22.1f;
+  w.tempMax = 30.6f;
+  w.lastUpdateEpoch = kBenchEpoch - 300;
+  for (uint8_t d = 0; d < WEATHER_FORECAST_DAYS; ++d) {
+    WeatherForecast &f = w.forecast[d];
+    f.timestamp = kBenchEpoch + d * 86400;
+    f.tempMin = 18 + 3 * d;
+    f.tempMax = 29 + 4 * d;
+    snprintf(f.description, sizeof(f.description), "day %u", d + 1);
+    strlcpy(f.label, kDays[d], sizeof(f.label));
+    f.icon = weatherIconIndex(kIcons[d]);
+    f.pop = (uint8_t)(d * 20);
+    f.valid = true;
+  }
+  HourlyForecast &h = w.hourly;
+  h.firstEpoch = kBenchEpoch - WEATHER_FORECAST_STEP_S / 2;
+  h.count = WEATHER_FORECAST_POINTS;
+  for (uint8_t i = 0; i < h.count; ++i) {
+    ForecastPoint &p = h.points[i];
+    p.slot = i;
+    p.tempTenths = (int16_t)lroundf(250 + 60 * sinf(i * 0.26f));
+    p.pop = (uint8_t)((i * 7) % 100);
+    p.windHalves = (uint8_t)(10 + i % 20);
+    p.icon = weatherIconIndex(i % 8 < 4 ? "02d" : "02n");
+  }
+  return w;
+}
+
+void showWeather(WeatherView view) {
+  rtc.setTime(kBenchEpoch);
+  display.getWeatherData() = scriptedWeather();
+  WeatherDisplayState &state = display.getDisplayState();
+  state.lastFetchOk = true;
+  state.fromCache = false;
+  display.getAni() = ANIMATION_START_POSITION;
+  display.updateScrollingMessage();
+  display.updateScrollingBuffer();
+  while (display.view() != view) display.nextView();
+}
+
+// One weather frame as weatherStep() draws it.
+void drawWeatherFrame() {
+  display.updateData();
+  display.draw();
+}
+
+uint64_t rebuildUs = 0;
+uint32_t rebuilds = 0;
+
+void drawWeatherFrameRebuilt() {
+  display.invalidate();
+  drawWeatherFrame();
+  rebuildUs += display.getDisplayState().lastViewBuildUs;
+  rebuilds++;
+}
+
+// ------------------- Asset decoding -------------------
+
+const AssetId kDrawnFonts[] = {ASSET_FONT_MIDLE, ASSET_FONT_TINY};
+uint32_t decodes = 0;
+
+void decodeIcons() {
+  for (uint8_t id = 0; id < ASSET_COUNT; ++id) {
+    if (assets.image((AssetId)id)) decodes++;
+  }
+}
+
+void decodeGlyphs() {
+  static uint8_t alpha[255 * 255];
+  for (AssetId font : kDrawnFonts) {
+    for (uint16_t code = 0x21; code < 0x7F; ++code) {
+      const AssetGlyph *glyph = assets.findGlyph(font, code);
+      if (glyph && assets.decodeGlyph(font, *glyph, alpha)) decodes++;
+    }
+  }
+}
+
+// ------------------- Cases -------------------
+
+struct Case {
+  const char *name;
+  void (*prepare)();
+  void (*frame)();
+  bool drawn;  // leaves a frame on the panel
+};
+
+#define STATS_CASE(NAME, ID, SAMPLE)                                                   \
+  {NAME, [] { showStats(ID, SAMPLE(), wavyHistory(SAMPLE())); }, [] { drawStatsScreen(ID); }, true}
+#define WEATHER_CASE(NAME, VIEW) {NAME, [] { showWeather(VIEW); }, drawWeatherFrame, true}
+#define WEATHER_REBUILD_CASE(NAME, VIEW) \
+  {NAME, [] { showWeather(VIEW); }, drawWeatherFrameRebuilt, true}
+#define DECODE_CASE(NAME, FRAME) {NAME, [] {}, FRAME, false}
+
+const Case kCases[] = {
+    STATS_CASE("cpu", SCREEN_CPU, busySample),
+    STATS_CASE("gpu", SCREEN_GPU, busySample),
+    STATS_CASE("disk", SCREEN_DISK, busySample),
+    STATS_CASE("cpu-sparse", SCREEN_CPU, sparseSample),
+    STATS_CASE("disk-sparse", SCREEN_DISK, sparseSample),
+    WEATHER_CASE("weather-now", WEATHER_VIEW_NOW),
+    WEATHER_CASE("weather-hourly", WEATHER_VIEW_HOURLY),
+    WEATHER_CASE("weather-daily", WEATHER_VIEW_DAILY),
+    WEATHER_REBUILD_CASE("weather-now-rebuild", WEATHER_VIEW_NOW),
+    WEATHER_REBUILD_CASE("weather-hourly-rebuild", WEATHER_VIEW_HOURLY),
+    WEATHER_REBUILD_CASE("weather-daily-rebuild", WEATHER_VIEW_DAILY),
+    DECODE_CASE("decode-icons", decodeIcons),
+    DECODE_CASE("decode-glyphs", decodeGlyphs),
+};
+
+
+// ------------------- Frames -------------------
+
+uint64_t hashFrame(const std::vector<uint16_t> &frame) {
+  uint64_t h = 14695981039346656037ULL;
+  for (uint16_t px : frame) {
+    h = (h ^ (px & 0xFF)) * 1099511628211ULL;
+    h = (h ^ (px >> 8)) * 1099511628211ULL;
+  }
+  return h;
+}
+
+struct FrameHash {
+  std::string name;
+  uint64_t hash;
+};
+
+// "<case> <16 hex digits>" per line; '#' starts a comment.
+bool readHashes(const char *path, std::vector<FrameHash> &hashes) {
+  FILE *f = fopen(path, "r");
+  if (!f) return false;
+  char line[128];
+  while (fgets(line, sizeof(line), f)) {
+    char name[64];
+    unsigned long long hash;
+    if (line[0] == '#' || sscanf(line, "%63s %llx", name, &hash) != 2) continue;
+    hashes.push_back({name, hash});
+  }
+  fclose(f);
+  return true;
+}
+
+bool writeHashes(const char *path, const std::vector<Result> &results) {
+  FILE *f = fopen(path, "w");
+  if (!f) return false;
+  fprintf(f, "# Reference frame hashes of bench/render_bench.cpp (--save-hashes).\n");
+  for (const Result &r : results) {
+    if (r.frameHash) fprintf(f, "%s %016llx\n", r.name.c_str(), (unsigned long long)r.frameHash);
+  }
+  fclose(f);
+  return true;
+}
+
+// Report cases whose hash differs from, or is missing in, `golden`; false if any.
+bool compareHashes(const std::vector<FrameHash> &golden, const std::vector<Result> &results) {
+  bool ok = true;
+  for (const Result &r : results) {
+    if (!r.frameHash) continue;
+    const FrameHash *want = nullptr;
+    for (const FrameHash &g : golden) {
+      if (g.name == r.name) want = &g;
+    }
+    if (!want) {
+      printf("hashes: %s: no golden hash\n", r.name.c_str());
+      ok = false;
+    } else if (want->hash != r.frameHash) {
+      printf("hashes: %s: %016llx, expected %016llx\n", r.name.c_str(),
+             (unsigned long long)r.frameHash, (unsigned long long)want->hash);
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+bool readPpm(const std::string &path, std::vector<uint8_t> &rgb) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  int w = 0, h = 0, max = 0;
+  bool ok = fscanf(f, "P6 %d %d %d", &w, &h, &max) == 3 && fgetc(f) != EOF &&
+            w == NATIVE_PANEL_WIDTH && h == NATIVE_PANEL_HEIGHT && max == 255;
+  if (ok) {
+    rgb.resize(kPanelPixels * 3);
+    ok = fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+  }
+  fclose(f);
+  return ok;
+}
+
+// Pixels that differ from the golden frame, or -1 when it can't be read.
+long compareGolden(const std::string &golden, const std::vector<uint16_t> &frame) {
+  std::string tmp = golden + ".actual";
+  std::vector<uint8_t> want, got;
+  if (!readPpm(golden, want)) return -1;
+  // Round-trip through the writer so both sides use the same RGB expansion
+  if (!nativeWritePpm(tmp.c_str(), frame.data()) || !readPpm(tmp, got)) return -1;
+  long diff = 0;
+  for (size_t i = 0; i < kPanelPixels; ++i) {
+    if (memcmp(&want[i * 3], &got[i * 3], 3) != 0) diff++;
+  }
+  if (diff == 0) remove(tmp.c_str());  // keep the actual frame for inspection
+  return diff;
+}
+
+Result runCase(const Case &c, const Options &o, bool &goldenOk) {
+  Result r;
+  r.name = c.name;
+  c.prepare();
+  for (int i = 0; i < kWarmupFrames; ++i) c.frame();
+  std::vector<uint16_t> reference(nativePanel(), nativePanel() + kPanelPixels);
+
+  std::vector<uint32_t> us;
+  us.reserve(o.frames);
+  rebuildUs = rebuilds = decodes = 0;
+  NativePixelCounts before = nativePixelCounts();
+  for (int i = 0; i < o.frames; ++i) {
+    uint32_t t0 = micros();
+    c.frame();
+    us.push_back(micros() - t0);
+  }
+  NativePixelCounts after = nativePixelCounts();
+
+  uint64_t total = 0;
+  for (uint32_t v : us) total += v;
+  std::sort(us.begin(), us.end());
+  r.meanUs = (uint32_t)(total / us.size());
+  r.p50Us = us[us.size() / 2];
+  r.p99Us = us[std::min(us.size() - 1, us.size() * 99 / 100)];
+  r.maxUs = us.back();
+  r.touched = (after.touched - before.touched) / o.frames;
+  r.pushed = (after.pushed - before.pushed) / o.frames;
+  if (rebuilds) r.rebuildUs = (double)rebuildUs / rebuilds;
+  if (decodes) r.decodeUs = (double)total / decodes;
+
+  if (!c.drawn) return r;
+  r.frameHash = hashFrame(reference);
+  if (o.outDir) {
+    std::string path = std::string(o.outDir) + "/" + c.name + ".ppm";
+    if (!nativeWritePpm(path.c_str(), reference.data())) perror(path.c_str());
+  }
+  if (o.goldenDir) {
+    std::string path = std::string(o.goldenDir) + "/" + c.name + ".ppm";
+    long diff = compareGolden(path, reference);
+    if (diff != 0) {
+      goldenOk = false;
+      if (diff < 0) {
+        printf("golden: %s: missing or unreadable\n", path.c_str());
+      } else {
+        printf("golden: %s: %ld pixels differ (frame kept as %s.actual)\n", path.c_str(), diff,
+               path.c_str());
+      }
+    }
+  }
+  return r;
+}
+
+// ------------------- Report -------------------
+
+std::vector<Result> readCsv(const char *path) {
+  std::vector<Result> results;
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    perror(path);
+    return results;
+  }
+  char line[256];
+  while (fgets(line, sizeof(line), f)) {
+    char name[64];
+    Result r;
+    unsigned long long touched, pushed;
+    if (sscanf(line, "%63[^,],%u,%u,%u,%u,%llu,%llu", name, &r.meanUs, &r.p50Us, &r.p99Us,
+               &r.maxUs, &touched, &pushed) != 7) {
+      continue;  // header
+    }
+    r.name = name;
+    r.touched = touched;
+    r.pushed = pushed;
+    results.push_back(r);
+  }
+  fclose(f);
+  return results;
+}
+
+void writeCsv(const char *path, const std::vector<Result> &results) {
+  FILE *f = fopen(path, "w");
+  if (!f) {
+    perror(path);
+    return;
+  }
+  fprintf(f, "case,mean_us,p50_us,p99_us,max_us,touched_px,pushed_px\n");
+  for (const Result &r : results) {
+    fprintf(f, "%s,%u,%u,%u,%u,%llu,%llu\n", r.name.c_str(), r.meanUs, r.p50Us, r.p99Us, r.maxUs,
+            (unsigned long long)r.touched, (unsigned long long)r.pushed);
+  }
+  fclose(f);
+}
+
+void printResults(const std::vector<Result> &results, const std::vector<Result> &baseline) {
+  printf("%-22s %8s %8s %8s %8s %10s %10s%s\n", "case", "mean_us", "p50_us", "p99_us", "max_us",
+         "touched", "pushed", baseline.empty() ? "" : "   vs baseline");
+  for (const Result &r : results) {
+    printf("%-22s %8u %8u %8u %8u %10llu %10llu", r.name.c_str(), r.meanUs, r.p50Us, r.p99Us,
+           r.maxUs, (unsigned long long)r.touched, (unsigned long long)r.pushed);
+    for (const Result &b : baseline) {
+      if (b.name != r.name || !b.meanUs) continue;
+      printf("   %+6.1f%% time, %+lld px", 100.0 * ((double)r.meanUs - b.meanUs) / b.meanUs,
+             (long long)r.touched - (long long)b.touched);
+    }
+    printf("\n");
+  }
+
+  for (const Result &r : results) {
+    if (r.rebuildUs < 0) continue;
+    printf("view-model: %s rebuild %.2f us/frame\n", r.name.c_str(), r.rebuildUs);
+  }
+  for (const Result &r : results) {
+    if (r.decodeUs < 0) continue;
+    printf("assets: %s %.3f us per decode\n", r.name.c_str(), r.decodeUs);
+  }
+}
+
+bool parseArgs(int argc, char **argv, Options &o) {
+  for (int i = 1; i < argc; i += 2) {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!value) {
+      // every option takes a value
+    } else if (strcmp(arg, "--frames") == 0) {
+      o.frames = std::max(1, atoi(value));
+      continue;
+    } else if (strcmp(arg, "--only") == 0) {
+      o.only = value;
+      continue;
+    } else if (strcmp(arg, "--out") == 0) {
+      o.outDir = value;
+      continue;
+    } else if (strcmp(arg, "--golden") == 0) {
+      o.goldenDir = value;
+      continue;
+    } else if (strcmp(arg, "--hashes") == 0) {
+      o.hashesPath = value;
+      continue;
+    } else if (strcmp(arg, "--save-hashes") == 0) {
+      o.saveHashesPath = value;
+      continue;
+    } else if (strcmp(arg, "--csv") == 0) {
+      o.csvPath = value;
+      continue;
+    } else if (strcmp(arg, "--baseline") == 0) {
+      o.baselinePath = value;
+      continue;
+    }
+    fprintf(stderr,
+            "usage: %s [--frames N] [--only NAME] [--out DIR] [--golden DIR] [--csv FILE]\n"
+            "          [--hashes FILE] [--save-hashes FILE] [--baseline FILE]\n",
+            argv[0]);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  if (!parseArgs(argc, argv, o)) return 2;
+  if (o.outDir) mkdir(o.outDir, 0755);
+
+  // The display half of setup()
+  M5.begin(M5.config());
+  M5.Display.setRotation(1);
+  gfx.setColorDepth(16);
+  gfx.createSprite(NATIVE_PANEL_WIDTH, NATIVE_PANEL_HEIGHT);
+  display.begin();
+
+  std::vector<Result> results;
+  bool goldenOk = true;
+  for (const Case &c : kCases) {
+    if (o.only && strncmp(c.name, o.only, strlen(o.only)) != 0) continue;
+    results.push_back(runCase(c, o, goldenOk));
+  }
+
+  std::vector<Result> baseline;
+  if (o.baselinePath) baseline = readCsv(o.baselinePath);
+  printResults(results, baseline);
+  if (o.csvPath) writeCsv(o.csvPath, results);
+  if (o.saveHashesPath && !writeHashes(o.saveHashesPath, results)) perror(o.saveHashesPath);
+  if (o.hashesPath) {
+    std::vector<FrameHash> golden;
+    if (!readHashes(o.hashesPath, golden)) {
+      perror(o.hashesPath);
+      goldenOk = false;
+    } else if (!compareHashes(golden, results)) {
+      goldenOk = false;
+    }
+  }
+  return goldenOk ? 0 : 1;
+}
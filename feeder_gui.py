@@ -63,6 +63,10 @@ def _run_nvidia_smi_hidden(args, timeout=0.6) -> str:
         creationflags=WIN_CREATE_NO_WINDOW,
     ).decode("ascii", errors="ignore").strip()
 
+def _host_us() -> int:
+    """Host clock for the latency trailer (monotonic, high resolution)."""
+    return time.perf_counter_ns() // 1000
+
 def _b2s(x):
     return x.decode() if isinstance(x, (bytes, bytearray)) else str(x)
 
@@ -126,6 +130,11 @@ class FeederThread(threading.Thread):
         self.last_disk = psutil.disk_io_counters()
         self.last_time = time.time()
 
+        # Latency timing: line number, and when the device's last echo was read
+        self.seq = 0
+        self.echo = None   # (seq, host us)
+        self.rx = b""
+
         # GPU backends
         self.nvml_ok = False
         self.nvml_handle = None
@@ -248,7 +257,13 @@ class FeederThread(threading.Thread):
                 freeD = free_gb[1] if len(free_gb) > 1 else -1.0
 
                 # CSV: cpu,mem,gpu,diskPct,diskMBps,cpuTempF,gpuTempF,freeC_GB,freeD_GB
-                line = f"{cpu:.1f},{mem:.1f},{gpu:.1f},{disk_pct:.1f},{mbps:.2f},{cpu_temp_f:.1f},{gpu_temp_f:.1f},{freeC:.0f},{freeD:.0f}\n"
+                # then ;seq;sendUs[;echoSeq;echoUs] for latency measurement
+                self.seq += 1
+                stamp = f";{self.seq};{_host_us()}"
+                if self.echo:
+                    stamp += f";{self.echo[0]};{self.echo[1]}"
+                    self.echo = None
+                line = f"{cpu:.1f},{mem:.1f},{gpu:.1f},{disk_pct:.1f},{mbps:.2f},{cpu_temp_f:.1f},{gpu_temp_f:.1f},{freeC:.0f},{freeD:.0f}{stamp}\n"
                 try:
                     self.serial.write(line.encode("ascii"))
                 except Exception as e:
@@ -264,10 +279,10 @@ class FeederThread(threading.Thread):
                     replace_line=True
                 )
 
-                # pacing
+                # pacing; listen for the echo meanwhile
                 elapsed = time.time() - t0
                 wait = max(0.0, SEND_INTERVAL - elapsed)
-                time.sleep(wait)
+                self._read_echoes(time.perf_counter() + wait)
 
         except Exception as e:
             self.log("Feeder crashed:\n" + "".join(traceback.format_exception_only(type(e), e)))
@@ -287,6 +302,26 @@ class FeederThread(threading.Thread):
             self.on_disconnect()
             self.log("Disconnected.")
 
+    def _read_echoes(self, deadline):
+        """Read device output until `deadline` (perf_counter), noting when
+        "ECHO <seq>" arrives; the next line reports it back."""
+        while True:
+            remaining = deadline - time.perf_counter()
+            if remaining <= 0:
+                return
+            self.serial.timeout = remaining
+            chunk = self.serial.read_until(b"\n")
+            now_us = _host_us()
+            self.rx = (self.rx + chunk)[-512:]
+            if not self.rx.endswith(b"\n"):
+                continue
+            line, self.rx = self.rx.strip(), b""
+            if line.startswith(b"ECHO "):
+                try:
+                    self.echo = (int(line[5:]), now_us)
+                except ValueError:
+                    pass
+
     def stop(self):
         self._stop.set()
 
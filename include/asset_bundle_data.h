@@ -0,0 +1,3484 @@
+// Generated by pack_assets.py - do not edit.
+// 20 assets, 134775 bytes decoded, 55608 bytes packed.
+#pragma once
+
+#include <Arduino.h>
+
+alignas(4) const uint8_t ASSET_BUNDLE[55608] PROGMEM = {
+  0x41, 0x53, 0x42, 0x31, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x80, 0x04, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0xF4, 0x01, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
+  0xB4, 0x02, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x80, 0x04, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
+  0xA8, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x80, 0x04, 0x00, 0x00, 0xD8, 0x03, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
+  0x80, 0x05, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x80, 0x04, 0x00, 0x00, 0xE8, 0x05, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x48, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0xA8, 0x06, 0x00, 0x00,
+  0xEB, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
+  0x94, 0x07, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x80, 0x04, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0xA8, 0x08, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x01, 0x02, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x39, 0x94, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00,
+  0xC0, 0x54, 0x00, 0x00, 0x01, 0x02, 0x2A, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x3E, 0x29, 0x01, 0x00,
+  0x90, 0x5D, 0x00, 0x00, 0xA5, 0x7B, 0x00, 0x00, 0x5F, 0x80, 0xFF, 0xFF, 0x46, 0x00, 0x4C, 0x31,
+  0x4A, 0x00, 0x49, 0x31, 0x4C, 0x00, 0x47, 0x31, 0x4E, 0x00, 0x45, 0x31, 0x50, 0x00, 0x43, 0x31,
+  0x52, 0x00, 0x42, 0x31, 0x52, 0x00, 0x41, 0x31, 0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x40, 0x31,
+  0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x40, 0x31,
+  0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x41, 0x31, 0x52, 0x00, 0x42, 0x31, 0x52, 0x00, 0x43, 0x31,
+  0x50, 0x00, 0x45, 0x31, 0x4E, 0x00, 0x47, 0x31, 0x4C, 0x00, 0x49, 0x31, 0x4A, 0x00, 0x4C, 0x31,
+  0x46, 0x00, 0x5E, 0x00, 0x5F, 0x80, 0xFF, 0xFF, 0x46, 0x00, 0x4C, 0x31, 0x4A, 0x00, 0x49, 0x31,
+  0x4C, 0x00, 0x47, 0x31, 0x4E, 0x00, 0x45, 0x31, 0x50, 0x00, 0x43, 0x31, 0x52, 0x00, 0x42, 0x31,
+  0x52, 0x00, 0x41, 0x31, 0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x40, 0x31,
+  0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x40, 0x31, 0x54, 0x00, 0x40, 0x31,
+  0x54, 0x00, 0x41, 0x31, 0x52, 0x00, 0x42, 0x31, 0x52, 0x00, 0x43, 0x31, 0x50, 0x00, 0x45, 0x31,
+  0x4E, 0x00, 0x47, 0x31, 0x4C, 0x00, 0x49, 0x31, 0x4A, 0x00, 0x4C, 0x31, 0x46, 0x00, 0x5E, 0x00,
+  0x4F, 0x80, 0xFF, 0xFF, 0x41, 0x00, 0x4F, 0x31, 0x00, 0x40, 0x31, 0x44, 0x00, 0x4B, 0x31, 0x49,
+  0x00, 0x4A, 0x31, 0x4A, 0x00, 0x46, 0x31, 0x41, 0x00, 0x40, 0x31, 0x00, 0x40, 0x31, 0x47, 0x00,
+  0x43, 0x31, 0x44, 0x00, 0x40, 0x31, 0x00, 0x40, 0x31, 0x47, 0x00, 0x42, 0x31, 0x49, 0x00, 0x31,
+  0x47, 0x00, 0x41, 0x31, 0x4A, 0x00, 0x31, 0x46, 0x00, 0x40, 0x31, 0x4B, 0x00, 0x41, 0x31, 0x44,
+  0x00, 0x31, 0x4F, 0x00, 0x31, 0x56, 0x00, 0x31, 0x41, 0x00, 0x31, 0x51, 0x00, 0x31, 0x40, 0x00,
+  0x40, 0x31, 0x51, 0x00, 0x43, 0x31, 0x51, 0x00, 0x44, 0x31, 0x4F, 0x00, 0x46, 0x31, 0x4D, 0x00,
+  0x7F, 0x7F, 0x7F, 0x45, 0x4F, 0x80, 0xFF, 0xFF, 0x41, 0x00, 0x4F, 0x31, 0x00, 0x40, 0x31, 0x44,
+  0x00, 0x4B, 0x31, 0x49, 0x00, 0x4A, 0x31, 0x4A, 0x00, 0x46, 0x31, 0x41, 0x00, 0x40, 0x31, 0x00,
+  0x40, 0x31, 0x47, 0x00, 0x43, 0x31, 0x44, 0x00, 0x40, 0x31, 0x00, 0x40, 0x31, 0x47, 0x00, 0x42,
+  0x31, 0x49, 0x00, 0x31, 0x47, 0x00, 0x41, 0x31, 0x4A, 0x00, 0x31, 0x46, 0x00, 0x40, 0x31, 0x4B,
+  0x00, 0x41, 0x31, 0x44, 0x00, 0x31, 0x4F, 0x00, 0x31, 0x56, 0x00, 0x31, 0x41, 0x00, 0x31, 0x51,
+  0x00, 0x31, 0x40, 0x00, 0x40, 0x31, 0x51, 0x00, 0x43, 0x31, 0x51, 0x00, 0x44, 0x31, 0x4F, 0x00,
+  0x46, 0x31, 0x4D, 0x00, 0x7F, 0x7F, 0x7F, 0x45, 0x7F, 0x7E, 0x80, 0xFF, 0xFF, 0x42, 0x00, 0x50,
+  0x31, 0x46, 0x00, 0x4E, 0x31, 0x4B, 0x00, 0x48, 0x31, 0x4D, 0x00, 0x47, 0x31, 0x4E, 0x00, 0x45,
+  0x31, 0x4F, 0x00, 0x44, 0x31, 0x52, 0x00, 0x41, 0x31, 0x54, 0x00, 0x31, 0x7F, 0x5E, 0x00, 0x31,
+  0x54, 0x00, 0x41, 0x31, 0x52, 0x00, 0x7F, 0x78, 0x7F, 0x7E, 0x80, 0xFF, 0xFF, 0x42, 0x00, 0x50,
+  0x31, 0x46, 0x00, 0x4E, 0x31, 0x4B, 0x00, 0x48, 0x31, 0x4D, 0x00, 0x47, 0x31, 0x4E, 0x00, 0x45,
+  0x31, 0x4F, 0x00, 0x44, 0x31, 0x52, 0x00, 0x41, 0x31, 0x54, 0x00, 0x31, 0x7F, 0x5E, 0x00, 0x31,
+  0x54, 0x00, 0x41, 0x31, 0x52, 0x00, 0x7F, 0x78, 0x7F, 0x7E, 0x80, 0xFF, 0xFF, 0x42, 0x00, 0x50,
+  0x31, 0x46, 0x00, 0x4E, 0x31, 0x4B, 0x00, 0x48, 0x31, 0x4D, 0x00, 0x47, 0x31, 0x4E, 0x00, 0x45,
+  0x31, 0x4F, 0x00, 0x44, 0x31, 0x52, 0x00, 0x41, 0x31, 0x54, 0x00, 0x31, 0x7F, 0x5E, 0x00, 0x31,
+  0x54, 0x00, 0x41, 0x31, 0x52, 0x00, 0x7F, 0x78, 0x7F, 0x7E, 0x80, 0xFF, 0xFF, 0x42, 0x00, 0x50,
+  0x31, 0x46, 0x00, 0x4E, 0x31, 0x4B, 0x00, 0x48, 0x31, 0x4D, 0x00, 0x47, 0x31, 0x4E, 0x00, 0x45,
+  0x31, 0x4F, 0x00, 0x44, 0x31, 0x52, 0x00, 0x41, 0x31, 0x54, 0x00, 0x31, 0x7F, 0x5E, 0x00, 0x31,
+  0x54, 0x00, 0x41, 0x31, 0x52, 0x00, 0x7F, 0x78, 0x46, 0x80, 0xFF, 0xFF, 0x43, 0x00, 0x50, 0x31,
+  0x45, 0x00, 0x4E, 0x31, 0x47, 0x00, 0x4D, 0x31, 0x4B, 0x00, 0x48, 0x31, 0x4D, 0x00, 0x47, 0x31,
+  0x4E, 0x00, 0x44, 0x31, 0x50, 0x00, 0x43, 0x31, 0x52, 0x00, 0x41, 0x31, 0x54, 0x00, 0x40, 0x31,
+  0x55, 0x00, 0x31, 0x7F, 0x46, 0x00, 0x31, 0x54, 0x00, 0x41, 0x31, 0x53, 0x00, 0x43, 0x31, 0x4F,
+  0x00, 0x5B, 0x31, 0x00, 0x44, 0x31, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x00, 0x40, 0x31,
+  0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x00, 0x40, 0x31, 0x40,
+  0x00, 0x43, 0x31, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x31, 0x40, 0x00, 0x40,
+  0x31, 0x40, 0x00, 0x31, 0x40, 0x00, 0x40, 0x31, 0x00, 0x40, 0x31, 0x40, 0x00, 0x31, 0x40, 0x00,
+  0x40, 0x31, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x46,
+  0x31, 0x40, 0x00, 0x43, 0x31, 0x00, 0x43, 0x31, 0x40, 0x00, 0x47, 0x31, 0x00, 0x44, 0x31, 0x00,
+  0x43, 0x31, 0x40, 0x00, 0x44, 0x00, 0x00, 0x00, 0x46, 0x80, 0xFF, 0xFF, 0x43, 0x00, 0x50, 0x31,
+  0x45, 0x00, 0x4E, 0x31, 0x47, 0x00, 0x4D, 0x31, 0x4B, 0x00, 0x48, 0x31, 0x4D, 0x00, 0x47, 0x31,
+  0x4E, 0x00, 0x44, 0x31, 0x50, 0x00, 0x43, 0x31, 0x52, 0x00, 0x41, 0x31, 0x54, 0x00, 0x40, 0x31,
+  0x55, 0x00, 0x31, 0x7F, 0x46, 0x00, 0x31, 0x54, 0x00, 0x41, 0x31, 0x53, 0x00, 0x43, 0x31, 0x4F,
+  0x00, 0x5B, 0x31, 0x00, 0x44, 0x31, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x00, 0x40, 0x31,
+  0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x00, 0x40, 0x31, 0x40,
+  0x00, 0x43, 0x31, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x31, 0x40, 0x00, 0x40,
+  0x31, 0x40, 0x00, 0x31, 0x40, 0x00, 0x40, 0x31, 0x00, 0x40, 0x31, 0x40, 0x00, 0x31, 0x40, 0x00,
+  0x40, 0x31, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x43, 0x31, 0x40, 0x00, 0x46,
+  0x31, 0x40, 0x00, 0x43, 0x31, 0x00, 0x43, 0x31, 0x40, 0x00, 0x47, 0x31, 0x00, 0x44, 0x31, 0x00,
+  0x43, 0x31, 0x40, 0x00, 0x44, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x42, 0x80, 0xFF, 0xFF, 0x00, 0x54,
+  0x31, 0x40, 0x00, 0x54, 0x31, 0x40, 0x00, 0x4F, 0x31, 0x40, 0x00, 0x49, 0x31, 0x41, 0x00, 0x45,
+  0x31, 0x41, 0x00, 0x49, 0x31, 0x41, 0x00, 0x44, 0x31, 0x42, 0x00, 0x45, 0x31, 0x40, 0x00, 0x31,
+  0x42, 0x00, 0x44, 0x31, 0x42, 0x00, 0x41, 0x31, 0x00, 0x41, 0x31, 0x40, 0x00, 0x40, 0x31, 0x40,
+  0x00, 0x46, 0x31, 0x40, 0x00, 0x41, 0x31, 0x40, 0x00, 0x7F, 0x49, 0x31, 0x40, 0x00, 0x4D, 0x31,
+  0x00, 0x43, 0x31, 0x41, 0x00, 0x4C, 0x31, 0x40, 0x00, 0x42, 0x31, 0x42, 0x00, 0x4C, 0x31, 0x40,
+  0x00, 0x42, 0x31, 0x42, 0x00, 0x52, 0x31, 0x42, 0x00, 0x53, 0x31, 0x40, 0x00, 0x7F, 0x4F, 0x00,
+  0x7F, 0x7F, 0x42, 0x80, 0xFF, 0xFF, 0x00, 0x54, 0x31, 0x40, 0x00, 0x54, 0x31, 0x40, 0x00, 0x4F,
+  0x31, 0x40, 0x00, 0x49, 0x31, 0x41, 0x00, 0x45, 0x31, 0x41, 0x00, 0x49, 0x31, 0x41, 0x00, 0x44,
+  0x31, 0x42, 0x00, 0x45, 0x31, 0x40, 0x00, 0x31, 0x42, 0x00, 0x44, 0x31, 0x42, 0x00, 0x41, 0x31,
+  0x00, 0x41, 0x31, 0x40, 0x00, 0x40, 0x31, 0x40, 0x00, 0x46, 0x31, 0x40, 0x00, 0x41, 0x31, 0x40,
+  0x00, 0x7F, 0x49, 0x31, 0x40, 0x00, 0x4D, 0x31, 0x00, 0x43, 0x31, 0x41, 0x00, 0x4C, 0x31, 0x40,
+  0x00, 0x42, 0x31, 0x42, 0x00, 0x4C, 0x31, 0x40, 0x00, 0x42, 0x31, 0x42, 0x00, 0x52, 0x31, 0x42,
+  0x00, 0x53, 0x31, 0x40, 0x00, 0x7F, 0x4F, 0x00, 0x7F, 0x50, 0x80, 0xFF, 0xFF, 0x00, 0x53, 0x31,
+  0x43, 0x00, 0x50, 0x31, 0x45, 0x00, 0x4E, 0x31, 0x4B, 0x00, 0x49, 0x31, 0x4B, 0x00, 0x49, 0x31,
+  0x4C, 0x00, 0x47, 0x31, 0x4E, 0x00, 0x45, 0x31, 0x46, 0x00, 0x31, 0x47, 0x00, 0x44, 0x31, 0x45,
+  0x00, 0x31, 0x00, 0x40, 0x31, 0x45, 0x00, 0x43, 0x31, 0x45, 0x00, 0x31, 0x41, 0x00, 0x31, 0x46,
+  0x00, 0x43, 0x31, 0x44, 0x00, 0x31, 0x41, 0x00, 0x40, 0x31, 0x44, 0x00, 0x44, 0x31, 0x4A, 0x00,
+  0x31, 0x43, 0x00, 0x4A, 0x31, 0x44, 0x00, 0x50, 0x31, 0x43, 0x00, 0x53, 0x31, 0x40, 0x00, 0x53,
+  0x31, 0x40, 0x00, 0x54, 0x31, 0x00, 0x7F, 0x6B, 0x7F, 0x50, 0x80, 0xFF, 0xFF, 0x00, 0x53, 0x31,
+  0x43, 0x00, 0x50, 0x31, 0x45, 0x00, 0x4E, 0x31, 0x4B, 0x00, 0x49, 0x31, 0x4B, 0x00, 0x49, 0x31,
+  0x4C, 0x00, 0x47, 0x31, 0x4E, 0x00, 0x45, 0x31, 0x46, 0x00, 0x31, 0x47, 0x00, 0x44, 0x31, 0x45,
+  0x00, 0x31, 0x00, 0x40, 0x31, 0x45, 0x00, 0x43, 0x31, 0x45, 0x00, 0x31, 0x41, 0x00, 0x31, 0x46,
+  0x00, 0x43, 0x31, 0x44, 0x00, 0x31, 0x41, 0x00, 0x40, 0x31, 0x44, 0x00, 0x44, 0x31, 0x4A, 0x00,
+  0x31, 0x43, 0x00, 0x4A, 0x31, 0x44, 0x00, 0x50, 0x31, 0x43, 0x00, 0x53, 0x31, 0x40, 0x00, 0x53,
+  0x31, 0x40, 0x00, 0x54, 0x31, 0x00, 0x7F, 0x6B, 0x4A, 0x80, 0xFF, 0xFF, 0x40, 0x00, 0x54, 0x31,
+  0x40, 0x00, 0x51, 0x31, 0x00, 0x40, 0x31, 0x40, 0x00, 0x40, 0x31, 0x00, 0x4E, 0x31, 0x46, 0x00,
+  0x4B, 0x31, 0x40, 0x00, 0x40, 0x31, 0x44, 0x00, 0x40, 0x31, 0x40, 0x00, 0x48, 0x31, 0x40, 0x00,
+  0x42, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00, 0x45, 0x31, 0x40, 0x00, 0x31, 0x40, 0x00, 0x42,
+  0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00, 0x31, 0x40, 0x00, 0x43, 0x31, 0x42, 0x00, 0x42, 0x31,
+  0x40, 0x00, 0x42, 0x31, 0x42, 0x00, 0x45, 0x31, 0x42, 0x00, 0x41, 0x31, 0x40, 0x00, 0x41, 0x31,
+  0x42, 0x00, 0x45, 0x31, 0x44, 0x00, 0x40, 0x31, 0x40, 0x00, 0x40, 0x31, 0x44, 0x00, 0x43, 0x31,
+  0x40, 0x00, 0x42, 0x31, 0x46, 0x00, 0x42, 0x31, 0x40, 0x00, 0x49, 0x31, 0x44, 0x00, 0x50, 0x31,
+  0x44, 0x00, 0x49, 0x31, 0x40, 0x00, 0x42, 0x31, 0x46, 0x00, 0x42, 0x31, 0x40, 0x00, 0x43, 0x31,
+  0x44, 0x00, 0x40, 0x31, 0x40, 0x00, 0x40, 0x31, 0x44, 0x00, 0x45, 0x31, 0x42, 0x00, 0x41, 0x31,
+  0x40, 0x00, 0x41, 0x31, 0x42, 0x00, 0x45, 0x31, 0x42, 0x00, 0x42, 0x31, 0x40, 0x00, 0x42, 0x31,
+  0x42, 0x00, 0x43, 0x31, 0x40, 0x00, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40,
+  0x00, 0x31, 0x40, 0x00, 0x45, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00,
+  0x48, 0x31, 0x40, 0x00, 0x40, 0x31, 0x44, 0x00, 0x40, 0x31, 0x40, 0x00, 0x4B, 0x31, 0x46, 0x00,
+  0x4E, 0x31, 0x00, 0x40, 0x31, 0x40, 0x00, 0x40, 0x31, 0x00, 0x51, 0x31, 0x40, 0x00, 0x54, 0x31,
+  0x40, 0x00, 0x49, 0x00, 0x4A, 0x80, 0xFF, 0xFF, 0x40, 0x00, 0x54, 0x31, 0x40, 0x00, 0x51, 0x31,
+  0x00, 0x40, 0x31, 0x40, 0x00, 0x40, 0x31, 0x00, 0x4E, 0x31, 0x46, 0x00, 0x4B, 0x31, 0x40, 0x00,
+  0x40, 0x31, 0x44, 0x00, 0x40, 0x31, 0x40, 0x00, 0x48, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00,
+  0x42, 0x31, 0x40, 0x00, 0x45, 0x31, 0x40, 0x00, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00, 0x42,
+  0x31, 0x40, 0x00, 0x31, 0x40, 0x00, 0x43, 0x31, 0x42, 0x00, 0x42, 0x31, 0x40, 0x00, 0x42, 0x31,
+  0x42, 0x00, 0x45, 0x31, 0x42, 0x00, 0x41, 0x31, 0x40, 0x00, 0x41, 0x31, 0x42, 0x00, 0x45, 0x31,
+  0x44, 0x00, 0x40, 0x31, 0x40, 0x00, 0x40, 0x31, 0x44, 0x00, 0x43, 0x31, 0x40, 0x00, 0x42, 0x31,
+  0x46, 0x00, 0x42, 0x31, 0x40, 0x00, 0x49, 0x31, 0x44, 0x00, 0x50, 0x31, 0x44, 0x00, 0x49, 0x31,
+  0x40, 0x00, 0x42, 0x31, 0x46, 0x00, 0x42, 0x31, 0x40, 0x00, 0x43, 0x31, 0x44, 0x00, 0x40, 0x31,
+  0x40, 0x00, 0x40, 0x31, 0x44, 0x00, 0x45, 0x31, 0x42, 0x00, 0x41, 0x31, 0x40, 0x00, 0x41, 0x31,
+  0x42, 0x00, 0x45, 0x31, 0x42, 0x00, 0x42, 0x31, 0x40, 0x00, 0x42, 0x31, 0x42, 0x00, 0x43, 0x31,
+  0x40, 0x00, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00, 0x31, 0x40, 0x00,
+  0x45, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00, 0x42, 0x31, 0x40, 0x00, 0x48, 0x31, 0x40, 0x00,
+  0x40, 0x31, 0x44, 0x00, 0x40, 0x31, 0x40, 0x00, 0x4B, 0x31, 0x46, 0x00, 0x4E, 0x31, 0x00, 0x40,
+  0x31, 0x40, 0x00, 0x40, 0x31, 0x00, 0x51, 0x31, 0x40, 0x00, 0x54, 0x31, 0x40, 0x00, 0x49, 0x00,
+  0x7F, 0x60, 0x80, 0xFF, 0xFF, 0x4C, 0x00, 0x47, 0x31, 0x4E, 0x00, 0x7C, 0x31, 0x50, 0x00, 0x70,
+  0x31, 0x50, 0x00, 0x44, 0x31, 0x50, 0x00, 0x77, 0x31, 0x50, 0x00, 0x71, 0x31, 0x4B, 0x00, 0x49,
+  0x31, 0x4A, 0x00, 0x7F, 0x68, 0x00, 0x00, 0x00, 0x7F, 0x60, 0x80, 0xFF, 0xFF, 0x4C, 0x00, 0x47,
+  0x31, 0x4E, 0x00, 0x7C, 0x31, 0x50, 0x00, 0x70, 0x31, 0x50, 0x00, 0x44, 0x31, 0x50, 0x00, 0x77,
+  0x31, 0x50, 0x00, 0x71, 0x31, 0x4B, 0x00, 0x49, 0x31, 0x4A, 0x00, 0x7F, 0x68, 0x00, 0x00, 0x00,
+  0xE9, 0x00, 0x1E, 0x00, 0x17, 0x00, 0x06, 0x00, 0x21, 0x00, 0x03, 0x17, 0x06, 0x17, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x06, 0x07, 0x09, 0x17, 0x02, 0x01, 0x3A, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x0E, 0x17, 0x10, 0x17, 0x01, 0x00, 0x64, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0A, 0x1B,
+  0x0C, 0x19, 0x01, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x25, 0x00, 0x11, 0x17, 0x14, 0x17, 0x01, 0x00,
+  0xD0, 0x01, 0x00, 0x00, 0x26, 0x00, 0x0B, 0x17, 0x0D, 0x17, 0x01, 0x00, 0xC3, 0x02, 0x00, 0x00,
+  0x27, 0x00, 0x02, 0x07, 0x05, 0x17, 0x01, 0x01, 0x50, 0x03, 0x00, 0x00, 0x28, 0x00, 0x05, 0x1A,
+  0x08, 0x17, 0x02, 0x01, 0x5E, 0x03, 0x00, 0x00, 0x29, 0x00, 0x05, 0x1A, 0x08, 0x17, 0x01, 0x01,
+  0xE0, 0x03, 0x00, 0x00, 0x2A, 0x00, 0x08, 0x0A, 0x0C, 0x17, 0x02, 0x00, 0x62, 0x04, 0x00, 0x00,
+  0x2B, 0x00, 0x0A, 0x0A, 0x0C, 0x0F, 0x01, 0x00, 0xA5, 0x04, 0x00, 0x00, 0x2C, 0x00, 0x03, 0x05,
+  0x05, 0x03, 0x01, 0x01, 0xB8, 0x04, 0x00, 0x00, 0x2D, 0x00, 0x06, 0x02, 0x09, 0x0A, 0x01, 0x00,
+  0xC7, 0x04, 0x00, 0x00, 0x2E, 0x00, 0x02, 0x03, 0x04, 0x03, 0x01, 0x00, 0xC8, 0x04, 0x00, 0x00,
+  0x2F, 0x00, 0x0B, 0x17, 0x0D, 0x17, 0x01, 0x00, 0xC9, 0x04, 0x00, 0x00, 0x30, 0x00, 0x09, 0x17,
+  0x0B, 0x17, 0x01, 0x00, 0x45, 0x05, 0x00, 0x00, 0x31, 0x00, 0x03, 0x17, 0x05, 0x17, 0x01, 0x00,
+  0x8E, 0x05, 0x00, 0x00, 0x32, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0xC3, 0x05, 0x00, 0x00,
+  0x33, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x30, 0x06, 0x00, 0x00, 0x34, 0x00, 0x0A, 0x17,
+  0x0B, 0x17, 0x01, 0x00, 0xAF, 0x06, 0x00, 0x00, 0x35, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00,
+  0x1E, 0x07, 0x00, 0x00, 0x36, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x79, 0x07, 0x00, 0x00,
+  0x37, 0x00, 0x09, 0x17, 0x09, 0x17, 0x00, 0x00, 0xC9, 0x07, 0x00, 0x00, 0x38, 0x00, 0x09, 0x17,
+  0x0B, 0x17, 0x01, 0x00, 0x3A, 0x08, 0x00, 0x00, 0x39, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00,
+  0xCB, 0x08, 0x00, 0x00, 0x3A, 0x00, 0x02, 0x0C, 0x04, 0x0C, 0x01, 0x00, 0x1B, 0x09, 0x00, 0x00,
+  0x3B, 0x00, 0x03, 0x0E, 0x05, 0x0C, 0x00, 0x00, 0x1E, 0x09, 0x00, 0x00, 0x3C, 0x00, 0x07, 0x0D,
+  0x0A, 0x10, 0x01, 0x00, 0x35, 0x09, 0x00, 0x00, 0x3D, 0x00, 0x09, 0x07, 0x0D, 0x0D, 0x02, 0x00,
+  0x7B, 0x09, 0x00, 0x00, 0x3E, 0x00, 0x07, 0x0D, 0x0A, 0x10, 0x02, 0x00, 0x7E, 0x09, 0x00, 0x00,
+  0x3F, 0x00, 0x08, 0x17, 0x0A, 0x17, 0x01, 0x00, 0xC4, 0x09, 0x00, 0x00, 0x40, 0x00, 0x0C, 0x17,
+  0x0F, 0x17, 0x01, 0x00, 0x11, 0x0A, 0x00, 0x00, 0x41, 0x00, 0x0A, 0x17, 0x0A, 0x17, 0x00, 0x00,
+  0x7F, 0x0A, 0x00, 0x00, 0x42, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x33, 0x0B, 0x00, 0x00,
+  0x43, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x9C, 0x0B, 0x00, 0x00, 0x44, 0x00, 0x09, 0x17,
+  0x0B, 0x17, 0x01, 0x00, 0xE5, 0x0B, 0x00, 0x00, 0x45, 0x00, 0x07, 0x17, 0x09, 0x17, 0x01, 0x00,
+  0x37, 0x0C, 0x00, 0x00, 0x46, 0x00, 0x07, 0x17, 0x08, 0x17, 0x01, 0x00, 0x5A, 0x0C, 0x00, 0x00,
+  0x47, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x80, 0x0C, 0x00, 0x00, 0x48, 0x00, 0x09, 0x17,
+  0x0B, 0x17, 0x01, 0x00, 0xC9, 0x0C, 0x00, 0x00, 0x49, 0x00, 0x02, 0x17, 0x04, 0x17, 0x01, 0x00,
+  0xF4, 0x0C, 0x00, 0x00, 0x4A, 0x00, 0x09, 0x17, 0x0A, 0x17, 0x00, 0x00, 0xF5, 0x0C, 0x00, 0x00,
+  0x4B, 0x00, 0x0A, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x30, 0x0D, 0x00, 0x00, 0x4C, 0x00, 0x07, 0x17,
+  0x08, 0x17, 0x01, 0x00, 0xD1, 0x0D, 0x00, 0x00, 0x4D, 0x00, 0x0B, 0x17, 0x0D, 0x17, 0x01, 0x00,
+  0xFC, 0x0D, 0x00, 0x00, 0x4E, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x9B, 0x0E, 0x00, 0x00,
+  0x4F, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x13, 0x0F, 0x00, 0x00, 0x50, 0x00, 0x09, 0x17,
+  0x0B, 0x17, 0x01, 0x00, 0x5C, 0x0F, 0x00, 0x00, 0x51, 0x00, 0x0B, 0x17, 0x0B, 0x17, 0x01, 0x00,
+  0x98, 0x0F, 0x00, 0x00, 0x52, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x19, 0x10, 0x00, 0x00,
+  0x53, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x91, 0x10, 0x00, 0x00, 0x54, 0x00, 0x0A, 0x17,
+  0x0A, 0x17, 0x00, 0x00, 0x03, 0x11, 0x00, 0x00, 0x55, 0x00, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00,
+  0x2F, 0x11, 0x00, 0x00, 0x56, 0x00, 0x0A, 0x17, 0x0A, 0x17, 0x00, 0x00, 0x6B, 0x11, 0x00, 0x00,
+  0x57, 0x00, 0x0E, 0x17, 0x0E, 0x17, 0x00, 0x00, 0x26, 0x12, 0x00, 0x00, 0x58, 0x00, 0x0B, 0x17,
+  0x0B, 0x17, 0x00, 0x00, 0x5B, 0x13, 0x00, 0x00, 0x59, 0x00, 0x0C, 0x17, 0x0C, 0x17, 0x00, 0x00,
+  0x1D, 0x14, 0x00, 0x00, 0x5A, 0x00, 0x08, 0x17, 0x08, 0x17, 0x00, 0x00, 0xA8, 0x14, 0x00, 0x00,
+  0x5B, 0x00, 0x05, 0x1B, 0x09, 0x17, 0x02, 0x00, 0x10, 0x15, 0x00, 0x00, 0x5C, 0x00, 0x0B, 0x17,
+  0x0D, 0x17, 0x01, 0x00, 0x4B, 0x15, 0x00, 0x00, 0x5D, 0x00, 0x06, 0x1B, 0x09, 0x17, 0x01, 0x00,
+  0xC3, 0x15, 0x00, 0x00, 0x5E, 0x00, 0x09, 0x08, 0x0C, 0x17, 0x01, 0x00, 0xFE, 0x15, 0x00, 0x00,
+  0x5F, 0x00, 0x0B, 0x02, 0x0B, 0xFC, 0x00, 0x00, 0x3D, 0x16, 0x00, 0x00, 0x60, 0x00, 0x04, 0x03,
+  0x0C, 0x13, 0x04, 0x01, 0x3E, 0x16, 0x00, 0x00, 0x61, 0x00, 0x08, 0x0E, 0x0B, 0x0E, 0x01, 0x00,
+  0x4A, 0x16, 0x00, 0x00, 0x62, 0x00, 0x08, 0x17, 0x0B, 0x17, 0x01, 0x00, 0x83, 0x16, 0x00, 0x00,
+  0x63, 0x00, 0x08, 0x0E, 0x0B, 0x0E, 0x01, 0x00, 0xCD, 0x16, 0x00, 0x00, 0x64, 0x00, 0x08, 0x17,
+  0x0B, 0x17, 0x01, 0x00, 0x04, 0x17, 0x00, 0x00, 0x65, 0x00, 0x08, 0x0E, 0x0B, 0x0E, 0x01, 0x00,
+  0x4C, 0x17, 0x00, 0x00, 0x66, 0x00, 0x06, 0x17, 0x06, 0x17, 0x00, 0x00, 0x81, 0x17, 0x00, 0x00,
+  0x67, 0x00, 0x08, 0x14, 0x0B, 0x0E, 0x01, 0x00, 0xB6, 0x17, 0x00, 0x00, 0x68, 0x00, 0x08, 0x17,
+  0x0B, 0x17, 0x01, 0x00, 0x0A, 0x18, 0x00, 0x00, 0x69, 0x00, 0x04, 0x14, 0x05, 0x14, 0x00, 0x00,
+  0x4A, 0x18, 0x00, 0x00, 0x6A, 0x00, 0x05, 0x1A, 0x05, 0x14, 0xFF, 0x00, 0x74, 0x18, 0x00, 0x00,
+  0x6B, 0x00, 0x08, 0x17, 0x0A, 0x17, 0x01, 0x00, 0xB4, 0x18, 0x00, 0x00, 0x6C, 0x00, 0x02, 0x17,
+  0x05, 0x17, 0x01, 0x00, 0x23, 0x19, 0x00, 0x00, 0x6D, 0x00, 0x0E, 0x0E, 0x11, 0x0E, 0x01, 0x00,
+  0x24, 0x19, 0x00, 0x00, 0x6E, 0x00, 0x08, 0x0E, 0x0B, 0x0E, 0x01, 0x00, 0x7F, 0x19, 0x00, 0x00,
+  0x6F, 0x00, 0x08, 0x0E, 0x0B, 0x0E, 0x01, 0x00, 0xAE, 0x19, 0x00, 0x00, 0x70, 0x00, 0x08, 0x14,
+  0x0B, 0x0E, 0x01, 0x00, 0xE5, 0x19, 0x00, 0x00, 0x71, 0x00, 0x08, 0x14, 0x0B, 0x0E, 0x01, 0x00,
+  0x2E, 0x1A, 0x00, 0x00, 0x72, 0x00, 0x08, 0x0E, 0x09, 0x0E, 0x01, 0x00, 0x73, 0x1A, 0x00, 0x00,
+  0x73, 0x00, 0x08, 0x0E, 0x0B, 0x0E, 0x01, 0x00, 0x9F, 0x1A, 0x00, 0x00, 0x74, 0x00, 0x06, 0x13,
+  0x07, 0x13, 0x00, 0x00, 0xF2, 0x1A, 0x00, 0x00, 0x75, 0x00, 0x08, 0x0E, 0x0B, 0x0E, 0x01, 0x00,
+  0x1E, 0x1B, 0x00, 0x00, 0x76, 0x00, 0x08, 0x0E, 0x09, 0x0E, 0x00, 0x00, 0x48, 0x1B, 0x00, 0x00,
+  0x77, 0x00, 0x0E, 0x0E, 0x0F, 0x0E, 0x00, 0x00, 0xB1, 0x1B, 0x00, 0x00, 0x78, 0x00, 0x0A, 0x0E,
+  0x0B, 0x0E, 0x00, 0x00, 0x6E, 0x1C, 0x00, 0x00, 0x79, 0x00, 0x08, 0x14, 0x09, 0x0E, 0x00, 0x00,
+  0xE0, 0x1C, 0x00, 0x00, 0x7A, 0x00, 0x08, 0x0E, 0x0A, 0x0E, 0x00, 0x00, 0x67, 0x1D, 0x00, 0x00,
+  0x7B, 0x00, 0x08, 0x1B, 0x0A, 0x17, 0x01, 0x00, 0xA3, 0x1D, 0x00, 0x00, 0x7C, 0x00, 0x02, 0x1C,
+  0x06, 0x17, 0x02, 0x00, 0x0B, 0x1E, 0x00, 0x00, 0x7D, 0x00, 0x08, 0x1B, 0x0A, 0x17, 0x01, 0x00,
+  0x0C, 0x1E, 0x00, 0x00, 0x7E, 0x00, 0x0A, 0x04, 0x0F, 0x0B, 0x02, 0x00, 0x76, 0x1E, 0x00, 0x00,
+  0xA0, 0x00, 0x01, 0x01, 0x03, 0x00, 0x00, 0x01, 0x8F, 0x1E, 0x00, 0x00, 0xA1, 0x00, 0x04, 0x17,
+  0x06, 0x17, 0x01, 0x00, 0x90, 0x1E, 0x00, 0x00, 0xA2, 0x00, 0x08, 0x17, 0x0B, 0x17, 0x01, 0x00,
+  0xDB, 0x1E, 0x00, 0x00, 0xA3, 0x00, 0x0A, 0x17, 0x0B, 0x17, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00,
+  0xA4, 0x00, 0x0E, 0x0E, 0x12, 0x11, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x00, 0xA5, 0x00, 0x0B, 0x17,
+  0x0D, 0x17, 0x01, 0x00, 0xF2, 0x1F, 0x00, 0x00, 0xA6, 0x00, 0x02, 0x1D, 0x06, 0x17, 0x02, 0x00,
+  0x82, 0x20, 0x00, 0x00, 0xA7, 0x00, 0x0B, 0x17, 0x0D, 0x17, 0x01, 0x00, 0x85, 0x20, 0x00, 0x00,
+  0xA8, 0x00, 0x06, 0x03, 0x0C, 0x13, 0x03, 0x00, 0x1E, 0x21, 0x00, 0x00, 0xA9, 0x00, 0x0F, 0x17,
+  0x11, 0x17, 0x01, 0x00, 0x25, 0x21, 0x00, 0x00, 0xAA, 0x00, 0x07, 0x0F, 0x09, 0x17, 0x01, 0x00,
+  0xA4, 0x21, 0x00, 0x00, 0xAB, 0x00, 0x0B, 0x0B, 0x0D, 0x0E, 0x01, 0x00, 0xF3, 0x21, 0x00, 0x00,
+  0xAC, 0x00, 0x0A, 0x06, 0x0E, 0x0B, 0x02, 0x00, 0x66, 0x22, 0x00, 0x00, 0xAD, 0x00, 0x0A, 0x02,
+  0x0E, 0x0C, 0x02, 0x00, 0x6F, 0x22, 0x00, 0x00, 0xAE, 0x00, 0x0F, 0x17, 0x11, 0x17, 0x01, 0x00,
+  0x70, 0x22, 0x00, 0x00, 0xAF, 0x00, 0x06, 0x02, 0x0C, 0x12, 0x03, 0x00, 0x06, 0x23, 0x00, 0x00,
+  0xB0, 0x00, 0x07, 0x0B, 0x0A, 0x17, 0x01, 0x00, 0x07, 0x23, 0x00, 0x00, 0xB1, 0x00, 0x0B, 0x0D,
+  0x0C, 0x10, 0x01, 0x00, 0x3A, 0x23, 0x00, 0x00, 0xB4, 0x00, 0x04, 0x03, 0x0C, 0x13, 0x04, 0x01,
+  0x59, 0x23, 0x00, 0x00, 0xB5, 0x00, 0x08, 0x13, 0x0C, 0x0E, 0x02, 0x00, 0x65, 0x23, 0x00, 0x00,
+  0xB6, 0x00, 0x0C, 0x17, 0x0E, 0x17, 0x01, 0x00, 0x94, 0x23, 0x00, 0x00, 0xB7, 0x00, 0x02, 0x03,
+  0x04, 0x0B, 0x01, 0x00, 0xE2, 0x23, 0x00, 0x00, 0xB8, 0x00, 0x06, 0x05, 0x0C, 0x00, 0x03, 0x00,
+  0xE3, 0x23, 0x00, 0x00, 0xBA, 0x00, 0x07, 0x0F, 0x09, 0x17, 0x01, 0x00, 0xFB, 0x23, 0x00, 0x00,
+  0xBB, 0x00, 0x0B, 0x0B, 0x0D, 0x0E, 0x01, 0x00, 0x2C, 0x24, 0x00, 0x00, 0xBF, 0x00, 0x08, 0x17,
+  0x0A, 0x17, 0x01, 0x00, 0x9F, 0x24, 0x00, 0x00, 0xC0, 0x00, 0x0A, 0x1C, 0x0A, 0x1C, 0x00, 0x00,
+  0xF4, 0x24, 0x00, 0x00, 0xC1, 0x00, 0x0A, 0x1C, 0x0A, 0x1C, 0x00, 0x00, 0xB9, 0x25, 0x00, 0x00,
+  0xC2, 0x00, 0x0A, 0x1B, 0x0A, 0x1B, 0x00, 0x00, 0x7E, 0x26, 0x00, 0x00, 0xC3, 0x00, 0x0A, 0x1C,
+  0x0A, 0x1C, 0x00, 0x00, 0x4B, 0x27, 0x00, 0x00, 0xC4, 0x00, 0x0A, 0x1C, 0x0A, 0x1C, 0x00, 0x00,
+  0x15, 0x28, 0x00, 0x00, 0xC5, 0x00, 0x0A, 0x1B, 0x0A, 0x1B, 0x00, 0x00, 0xD5, 0x28, 0x00, 0x00,
+  0xC6, 0x00, 0x10, 0x17, 0x11, 0x17, 0x00, 0x00, 0xAB, 0x29, 0x00, 0x00, 0xC7, 0x00, 0x09, 0x1C,
+  0x0B, 0x17, 0x01, 0x00, 0x42, 0x2A, 0x00, 0x00, 0xC8, 0x00, 0x07, 0x1C, 0x09, 0x1C, 0x01, 0x00,
+  0xA7, 0x2A, 0x00, 0x00, 0xC9, 0x00, 0x07, 0x1C, 0x09, 0x1C, 0x01, 0x00, 0xDC, 0x2A, 0x00, 0x00,
+  0xCA, 0x00, 0x07, 0x1C, 0x09, 0x1C, 0x01, 0x00, 0x11, 0x2B, 0x00, 0x00, 0xCB, 0x00, 0x07, 0x1C,
+  0x09, 0x1C, 0x01, 0x00, 0x4B, 0x2B, 0x00, 0x00, 0xCC, 0x00, 0x04, 0x1C, 0x04, 0x1C, 0x00, 0x00,
+  0x7B, 0x2B, 0x00, 0x00, 0xCD, 0x00, 0x05, 0x1C, 0x04, 0x1C, 0x01, 0x00, 0xB7, 0x2B, 0x00, 0x00,
+  0xCE, 0x00, 0x07, 0x1C, 0x04, 0x1C, 0xFF, 0x00, 0xF5, 0x2B, 0x00, 0x00, 0xCF, 0x00, 0x06, 0x1C,
+  0x04, 0x1C, 0xFF, 0x00, 0x3A, 0x2C, 0x00, 0x00, 0xD1, 0x00, 0x09, 0x1C, 0x0B, 0x1C, 0x01, 0x00,
+  0x70, 0x2C, 0x00, 0x00, 0xD2, 0x00, 0x09, 0x1C, 0x0B, 0x1C, 0x01, 0x00, 0xFF, 0x2C, 0x00, 0x00,
+  0xD3, 0x00, 0x09, 0x1C, 0x0B, 0x1C, 0x01, 0x00, 0x5A, 0x2D, 0x00, 0x00, 0xD4, 0x00, 0x09, 0x1C,
+  0x0B, 0x1C, 0x01, 0x00, 0xB5, 0x2D, 0x00, 0x00, 0xD5, 0x00, 0x09, 0x1C, 0x0B, 0x1C, 0x01, 0x00,
+  0x18, 0x2E, 0x00, 0x00, 0xD6, 0x00, 0x09, 0x1C, 0x0B, 0x1C, 0x01, 0x00, 0x78, 0x2E, 0x00, 0x00,
+  0xD7, 0x00, 0x09, 0x09, 0x0E, 0x0E, 0x02, 0x00, 0xCE, 0x2E, 0x00, 0x00, 0xD8, 0x00, 0x0E, 0x17,
+  0x0B, 0x17, 0x00, 0x00, 0x1C, 0x2F, 0x00, 0x00, 0xD9, 0x00, 0x09, 0x1C, 0x0B, 0x1C, 0x01, 0x00,
+  0xCC, 0x2F, 0x00, 0x00, 0xDA, 0x00, 0x09, 0x1C, 0x0B, 0x1C, 0x01, 0x00, 0x1A, 0x30, 0x00, 0x00,
+  0xDB, 0x00, 0x09, 0x1C, 0x0B, 0x1C, 0x01, 0x00, 0x68, 0x30, 0x00, 0x00, 0xDC, 0x00, 0x09, 0x1C,
+  0x0B, 0x1C, 0x01, 0x00, 0xBE, 0x30, 0x00, 0x00, 0xDD, 0x00, 0x0C, 0x1B, 0x0C, 0x1B, 0x00, 0x00,
+  0x07, 0x31, 0x00, 0x00, 0xDF, 0x00, 0x08, 0x17, 0x0A, 0x17, 0x01, 0x00, 0xA4, 0x31, 0x00, 0x00,
+  0xE0, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0x05, 0x32, 0x00, 0x00, 0xE1, 0x00, 0x08, 0x13,
+  0x0B, 0x13, 0x01, 0x00, 0x50, 0x32, 0x00, 0x00, 0xE2, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00,
+  0x9B, 0x32, 0x00, 0x00, 0xE3, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0xED, 0x32, 0x00, 0x00,
+  0xE4, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0x3D, 0x33, 0x00, 0x00, 0xE5, 0x00, 0x08, 0x15,
+  0x0B, 0x15, 0x01, 0x00, 0x83, 0x33, 0x00, 0x00, 0xE6, 0x00, 0x0E, 0x0E, 0x11, 0x0E, 0x01, 0x00,
+  0xE5, 0x33, 0x00, 0x00, 0xE7, 0x00, 0x08, 0x13, 0x0B, 0x0E, 0x01, 0x00, 0x49, 0x34, 0x00, 0x00,
+  0xE8, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0x9C, 0x34, 0x00, 0x00, 0xE9, 0x00, 0x08, 0x13,
+  0x0B, 0x13, 0x01, 0x00, 0xE3, 0x34, 0x00, 0x00, 0xEA, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00,
+  0x2A, 0x35, 0x00, 0x00, 0xEB, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0x78, 0x35, 0x00, 0x00,
+  0xEC, 0x00, 0x04, 0x13, 0x05, 0x13, 0xFF, 0x00, 0xBA, 0x35, 0x00, 0x00, 0xED, 0x00, 0x05, 0x13,
+  0x05, 0x13, 0x01, 0x00, 0xE3, 0x35, 0x00, 0x00, 0xEE, 0x00, 0x07, 0x13, 0x05, 0x13, 0xFF, 0x00,
+  0x0F, 0x36, 0x00, 0x00, 0xEF, 0x00, 0x06, 0x13, 0x05, 0x13, 0xFF, 0x00, 0x42, 0x36, 0x00, 0x00,
+  0xF1, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0x66, 0x36, 0x00, 0x00, 0xF2, 0x00, 0x08, 0x13,
+  0x0B, 0x13, 0x01, 0x00, 0xAC, 0x36, 0x00, 0x00, 0xF3, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00,
+  0xF5, 0x36, 0x00, 0x00, 0xF4, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0x3E, 0x37, 0x00, 0x00,
+  0xF5, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0x8E, 0x37, 0x00, 0x00, 0xF6, 0x00, 0x08, 0x13,
+  0x0B, 0x13, 0x01, 0x00, 0xDC, 0x37, 0x00, 0x00, 0xF7, 0x00, 0x0B, 0x0A, 0x0C, 0x0F, 0x01, 0x00,
+  0x20, 0x38, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x0E, 0x0B, 0x0E, 0x00, 0x00, 0x41, 0x38, 0x00, 0x00,
+  0xF9, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0xB0, 0x38, 0x00, 0x00, 0xFA, 0x00, 0x08, 0x13,
+  0x0B, 0x13, 0x01, 0x00, 0xEB, 0x38, 0x00, 0x00, 0xFB, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00,
+  0x27, 0x39, 0x00, 0x00, 0xFC, 0x00, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0x6A, 0x39, 0x00, 0x00,
+  0xFD, 0x00, 0x08, 0x19, 0x09, 0x13, 0x00, 0x00, 0xA1, 0x39, 0x00, 0x00, 0xFF, 0x00, 0x08, 0x19,
+  0x09, 0x13, 0x00, 0x00, 0x3A, 0x3A, 0x00, 0x00, 0x31, 0x01, 0x02, 0x0E, 0x05, 0x0E, 0x01, 0x00,
+  0xCE, 0x3A, 0x00, 0x00, 0x41, 0x01, 0x07, 0x17, 0x08, 0x17, 0x01, 0x00, 0xCF, 0x3A, 0x00, 0x00,
+  0x42, 0x01, 0x04, 0x17, 0x05, 0x17, 0x01, 0x00, 0x11, 0x3B, 0x00, 0x00, 0x52, 0x01, 0x10, 0x17,
+  0x12, 0x17, 0x01, 0x00, 0x47, 0x3B, 0x00, 0x00, 0x53, 0x01, 0x0E, 0x0E, 0x11, 0x0E, 0x01, 0x00,
+  0xA3, 0x3B, 0x00, 0x00, 0x60, 0x01, 0x09, 0x1C, 0x0B, 0x1C, 0x01, 0x00, 0xEC, 0x3B, 0x00, 0x00,
+  0x61, 0x01, 0x08, 0x13, 0x0B, 0x13, 0x01, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x78, 0x01, 0x0C, 0x1C,
+  0x0C, 0x1C, 0x00, 0x00, 0xE4, 0x3C, 0x00, 0x00, 0x7D, 0x01, 0x08, 0x1C, 0x08, 0x1C, 0x00, 0x00,
+  0x7C, 0x3D, 0x00, 0x00, 0x7E, 0x01, 0x08, 0x13, 0x0A, 0x13, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00,
+  0x92, 0x01, 0x0B, 0x1D, 0x09, 0x17, 0xFE, 0x00, 0x50, 0x3E, 0x00, 0x00, 0xC6, 0x02, 0x07, 0x03,
+  0x0C, 0x13, 0x02, 0x01, 0xEE, 0x3E, 0x00, 0x00, 0xC7, 0x02, 0x07, 0x03, 0x0C, 0x13, 0x03, 0x01,
+  0x03, 0x3F, 0x00, 0x00, 0xD8, 0x02, 0x06, 0x03, 0x0C, 0x13, 0x03, 0x00, 0x18, 0x3F, 0x00, 0x00,
+  0xD9, 0x02, 0x03, 0x03, 0x0C, 0x13, 0x05, 0x00, 0x28, 0x3F, 0x00, 0x00, 0xDA, 0x02, 0x06, 0x05,
+  0x0C, 0x15, 0x03, 0x01, 0x29, 0x3F, 0x00, 0x00, 0xDB, 0x02, 0x05, 0x05, 0x0C, 0x00, 0x03, 0x00,
+  0x47, 0x3F, 0x00, 0x00, 0xDC, 0x02, 0x07, 0x03, 0x0C, 0x13, 0x03, 0x00, 0x5B, 0x3F, 0x00, 0x00,
+  0xDD, 0x02, 0x08, 0x03, 0x0C, 0x13, 0x02, 0x01, 0x6E, 0x3F, 0x00, 0x00, 0xA9, 0x03, 0x0E, 0x17,
+  0x10, 0x17, 0x01, 0x00, 0x86, 0x3F, 0x00, 0x00, 0xC0, 0x03, 0x0A, 0x0D, 0x0C, 0x0D, 0x01, 0x00,
+  0xF5, 0x3F, 0x00, 0x00, 0x13, 0x20, 0x0B, 0x02, 0x0D, 0x0A, 0x01, 0x00, 0x23, 0x40, 0x00, 0x00,
+  0x14, 0x20, 0x11, 0x02, 0x13, 0x0A, 0x01, 0x00, 0x24, 0x40, 0x00, 0x00, 0x18, 0x20, 0x03, 0x07,
+  0x05, 0x17, 0x01, 0x01, 0x25, 0x40, 0x00, 0x00, 0x19, 0x20, 0x03, 0x07, 0x05, 0x17, 0x01, 0x01,
+  0x3A, 0x40, 0x00, 0x00, 0x1A, 0x20, 0x03, 0x07, 0x05, 0x03, 0x01, 0x01, 0x4F, 0x40, 0x00, 0x00,
+  0x1C, 0x20, 0x07, 0x07, 0x09, 0x17, 0x01, 0x01, 0x64, 0x40, 0x00, 0x00, 0x1D, 0x20, 0x07, 0x07,
+  0x09, 0x17, 0x01, 0x01, 0x95, 0x40, 0x00, 0x00, 0x1E, 0x20, 0x07, 0x07, 0x09, 0x04, 0x01, 0x01,
+  0xC6, 0x40, 0x00, 0x00, 0x20, 0x20, 0x0A, 0x17, 0x0D, 0x17, 0x02, 0x00, 0xF7, 0x40, 0x00, 0x00,
+  0x21, 0x20, 0x0A, 0x17, 0x0D, 0x17, 0x02, 0x00, 0x24, 0x41, 0x00, 0x00, 0x22, 0x20, 0x09, 0x09,
+  0x0D, 0x10, 0x02, 0x00, 0x4F, 0x41, 0x00, 0x00, 0x26, 0x20, 0x0C, 0x03, 0x0E, 0x03, 0x01, 0x00,
+  0x72, 0x41, 0x00, 0x00, 0x30, 0x20, 0x1A, 0x18, 0x1D, 0x18, 0x01, 0x00, 0x7F, 0x41, 0x00, 0x00,
+  0x39, 0x20, 0x06, 0x0B, 0x08, 0x0E, 0x01, 0x00, 0xB9, 0x42, 0x00, 0x00, 0x3A, 0x20, 0x06, 0x0B,
+  0x08, 0x0E, 0x01, 0x00, 0xF5, 0x42, 0x00, 0x00, 0x44, 0x20, 0x0E, 0x17, 0x05, 0x17, 0xFC, 0x00,
+  0x31, 0x43, 0x00, 0x00, 0xAC, 0x20, 0x0B, 0x17, 0x0C, 0x17, 0x00, 0x00, 0xAE, 0x43, 0x00, 0x00,
+  0x22, 0x21, 0x0E, 0x0D, 0x10, 0x17, 0x00, 0x00, 0xFC, 0x43, 0x00, 0x00, 0x02, 0x22, 0x09, 0x17,
+  0x0D, 0x17, 0x02, 0x00, 0x78, 0x44, 0x00, 0x00, 0x06, 0x22, 0x0B, 0x17, 0x0C, 0x17, 0x01, 0x00,
+  0xD0, 0x44, 0x00, 0x00, 0x0F, 0x22, 0x0B, 0x17, 0x0C, 0x17, 0x01, 0x00, 0x7F, 0x45, 0x00, 0x00,
+  0x11, 0x22, 0x09, 0x17, 0x0B, 0x17, 0x01, 0x00, 0xD5, 0x45, 0x00, 0x00, 0x1A, 0x22, 0x0B, 0x17,
+  0x0D, 0x17, 0x01, 0x00, 0x3D, 0x46, 0x00, 0x00, 0x1E, 0x22, 0x0F, 0x0B, 0x11, 0x0D, 0x01, 0x00,
+  0xC8, 0x46, 0x00, 0x00, 0x2B, 0x22, 0x08, 0x1D, 0x07, 0x17, 0xFF, 0x00, 0x41, 0x47, 0x00, 0x00,
+  0x48, 0x22, 0x0A, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xA2, 0x47, 0x00, 0x00, 0x60, 0x22, 0x0A, 0x12,
+  0x0D, 0x13, 0x02, 0x00, 0xD5, 0x47, 0x00, 0x00, 0x64, 0x22, 0x07, 0x0E, 0x0A, 0x10, 0x01, 0x00,
+  0x14, 0x48, 0x00, 0x00, 0x65, 0x22, 0x07, 0x0E, 0x0A, 0x10, 0x01, 0x00, 0x54, 0x48, 0x00, 0x00,
+  0xCA, 0x25, 0x0B, 0x0F, 0x0C, 0x10, 0x01, 0x00, 0x93, 0x48, 0x00, 0x00, 0x01, 0xFB, 0x0A, 0x17,
+  0x0C, 0x17, 0x00, 0x00, 0x0E, 0x49, 0x00, 0x00, 0x02, 0xFB, 0x0A, 0x17, 0x0C, 0x17, 0x00, 0x00,
+  0x6A, 0x49, 0x00, 0x00, 0x80, 0x05, 0x41, 0x00, 0xAE, 0xFE, 0xFA, 0x00, 0xF9, 0xF4, 0x00, 0xF3,
+  0xEE, 0x00, 0xED, 0xE8, 0x00, 0xE7, 0xE2, 0x00, 0xE1, 0xDC, 0x00, 0xDB, 0xD6, 0x00, 0xD4, 0xCF,
+  0x00, 0xCE, 0xC9, 0x00, 0xC8, 0xC3, 0x00, 0xC2, 0xBD, 0x00, 0xBC, 0xB7, 0x00, 0xB6, 0xB1, 0x00,
+  0xB0, 0xAB, 0x00, 0xAA, 0xA5, 0x00, 0xA3, 0x9F, 0x09, 0x41, 0x00, 0x41, 0x00, 0x41, 0xF8, 0xF7,
+  0x00, 0x00, 0xF9, 0xF8, 0xE9, 0xE8, 0x00, 0x00, 0xEA, 0xEA, 0xDA, 0xD9, 0x00, 0x00, 0xDB, 0xDC,
+  0xCA, 0xC9, 0x00, 0x00, 0xCC, 0xCD, 0xBB, 0xBA, 0x00, 0x00, 0xBD, 0xBF, 0xAB, 0xAA, 0x00, 0x00,
+  0xAE, 0xB1, 0x9C, 0x9B, 0x00, 0x00, 0x9F, 0xA3, 0x04, 0x82, 0x1D, 0xFF, 0xE1, 0x01, 0x82, 0x1C,
+  0xFF, 0xE2, 0x05, 0x82, 0x58, 0xFF, 0xA5, 0x01, 0x82, 0x55, 0xFF, 0xA7, 0x05, 0x82, 0x93, 0xFF,
+  0x69, 0x01, 0x82, 0x8E, 0xFF, 0x6C, 0x05, 0x82, 0xCE, 0xFF, 0x2D, 0x01, 0x82, 0xC7, 0xFF, 0x32,
+  0x04, 0x88, 0x0C, 0xFC, 0xEF, 0x02, 0x00, 0x06, 0xF8, 0xF3, 0x03, 0x04, 0x82, 0x43, 0xFF, 0xB5,
+  0x01, 0x82, 0x38, 0xFF, 0xBD, 0x02, 0x80, 0x70, 0x4A, 0x82, 0x80, 0x00, 0x70, 0x4A, 0x80, 0x80,
+  0x03, 0x82, 0xD9, 0xFF, 0x1F, 0x01, 0x82, 0xD5, 0xFF, 0x23, 0x04, 0x82, 0x11, 0xFE, 0xE8, 0x01,
+  0x82, 0x0F, 0xFD, 0xEC, 0x05, 0x82, 0x49, 0xFF, 0xB1, 0x01, 0x82, 0x46, 0xFF, 0xB5, 0x05, 0x82,
+  0x81, 0xFF, 0x79, 0x01, 0x82, 0x7E, 0xFF, 0x7D, 0x05, 0x82, 0xB9, 0xFF, 0x42, 0x01, 0x82, 0xB7,
+  0xFF, 0x46, 0x04, 0x88, 0x01, 0xEF, 0xFD, 0x0D, 0x00, 0x01, 0xED, 0xFE, 0x10, 0x04, 0x82, 0x28,
+  0xFF, 0xD3, 0x01, 0x82, 0x28, 0xFF, 0xD7, 0x03, 0x80, 0x7C, 0x4A, 0x82, 0x70, 0x00, 0x7C, 0x4A,
+  0x80, 0x70, 0x02, 0x82, 0xC2, 0xFF, 0x37, 0x01, 0x82, 0xB7, 0xFF, 0x42, 0x04, 0x88, 0x05, 0xF6,
+  0xF8, 0x06, 0x00, 0x02, 0xF0, 0xFC, 0x0B, 0x04, 0x82, 0x36, 0xFF, 0xC5, 0x01, 0x82, 0x2F, 0xFF,
+  0xCC, 0x05, 0x82, 0x70, 0xFF, 0x8D, 0x01, 0x82, 0x6B, 0xFF, 0x92, 0x05, 0x82, 0xAA, 0xFF, 0x54,
+  0x01, 0x82, 0xA7, 0xFF, 0x57, 0x05, 0x82, 0xE3, 0xFF, 0x1C, 0x01, 0x82, 0xE2, 0xFF, 0x1D, 0x04,
+  0x03, 0x41, 0x05, 0x81, 0x01, 0x05, 0x41, 0x81, 0x04, 0x01, 0x01, 0x82, 0x18, 0xB4, 0xF7, 0x43,
+  0x83, 0xF7, 0xAD, 0x11, 0xA9, 0x47, 0x82, 0x9D, 0xF1, 0xFF, 0x01, 0x41, 0x01, 0x40, 0x80, 0xEE,
+  0x41, 0x01, 0x41, 0x01, 0x43, 0x01, 0x41, 0x01, 0x43, 0x01, 0x41, 0x01, 0x43, 0x81, 0x03, 0x00,
+  0x41, 0x01, 0x41, 0x83, 0xDC, 0xFF, 0xAA, 0x04, 0x41, 0x03, 0x83, 0x49, 0xFC, 0xFF, 0xAF, 0x41,
+  0x04, 0x81, 0x5A, 0xFD, 0x42, 0x05, 0x81, 0x62, 0xFE, 0x41, 0x06, 0x80, 0x6A, 0x41, 0x80, 0x8D,
+  0x06, 0x42, 0x80, 0x92, 0x05, 0x43, 0x81, 0x96, 0x01, 0x03, 0x41, 0x80, 0x89, 0x41, 0x80, 0x83,
+  0x03, 0x41, 0x00, 0x82, 0x6B, 0xFF, 0xF1, 0x41, 0x01, 0x41, 0x01, 0x43, 0x01, 0x41, 0x01, 0x43,
+  0x01, 0x41, 0x01, 0x43, 0x01, 0x41, 0x01, 0x41, 0x81, 0xEB, 0xFF, 0x01, 0x41, 0x01, 0x40, 0x81,
+  0xEC, 0x8F, 0x47, 0x83, 0x90, 0x0A, 0x9C, 0xED, 0x43, 0x82, 0xF0, 0xA0, 0x0A, 0x03, 0x41, 0x80,
+  0x03, 0x06, 0x41, 0x03, 0x82, 0x07, 0x95, 0xF1, 0x41, 0x82, 0xF2, 0xA0, 0x0C, 0x04, 0x84, 0x43,
+  0xFF, 0xCC, 0x00, 0x93, 0x45, 0x80, 0x9F, 0x04, 0x85, 0xC8, 0xFF, 0x47, 0x00, 0xF1, 0xFF, 0x03,
+  0x40, 0x80, 0xF2, 0x03, 0x82, 0x50, 0xFF, 0xC0, 0x01, 0x41, 0x03, 0x41, 0x02, 0x83, 0x02, 0xD3,
+  0xFF, 0x3A, 0x01, 0x41, 0x03, 0x41, 0x02, 0x82, 0x5D, 0xFF, 0xB4, 0x02, 0x41, 0x03, 0x41, 0x01,
+  0x83, 0x05, 0xDD, 0xFE, 0x2F, 0x02, 0x41, 0x03, 0x41, 0x01, 0x82, 0x69, 0xFF, 0xA7, 0x03, 0x41,
+  0x03, 0x41, 0x00, 0x83, 0x09, 0xE5, 0xFB, 0x25, 0x03, 0x41, 0x03, 0x41, 0x00, 0x82, 0x76, 0xFF,
+  0x9B, 0x04, 0x81, 0xF2, 0xFF, 0x03, 0x40, 0x84, 0xF3, 0x0E, 0xED, 0xF8, 0x1D, 0x04, 0x80, 0x9A,
+  0x45, 0x83, 0xA7, 0x82, 0xFF, 0x8E, 0x05, 0x82, 0x0A, 0x9C, 0xF2, 0x41, 0x86, 0xF4, 0xA9, 0x27,
+  0xF3, 0xFB, 0xAA, 0xF1, 0x41, 0x82, 0xF2, 0xA0, 0x0C, 0x06, 0x80, 0x8F, 0x47, 0x80, 0x9F, 0x05,
+  0x82, 0x1D, 0xF8, 0xED, 0x41, 0x03, 0x40, 0x80, 0xF2, 0x05, 0x82, 0x9C, 0xFF, 0x75, 0x41, 0x03,
+  0x41, 0x04, 0x83, 0x25, 0xFB, 0xE5, 0x09, 0x41, 0x03, 0x41, 0x04, 0x83, 0xA8, 0xFF, 0x68, 0x00,
+  0x41, 0x03, 0x41, 0x03, 0x84, 0x2F, 0xFE, 0xDD, 0x05, 0x00, 0x41, 0x03, 0x41, 0x03, 0x82, 0xB5,
+  0xFF, 0x5C, 0x01, 0x41, 0x03, 0x41, 0x02, 0x83, 0x3A, 0xFF, 0xD3, 0x02, 0x01, 0x41, 0x03, 0x41,
+  0x02, 0x82, 0xC0, 0xFF, 0x4F, 0x02, 0x81, 0xF2, 0xFF, 0x03, 0x40, 0x80, 0xF3, 0x01, 0x82, 0x48,
+  0xFF, 0xC8, 0x03, 0x80, 0x9A, 0x45, 0x80, 0xA7, 0x01, 0x82, 0xCC, 0xFF, 0x43, 0x03, 0x82, 0x0A,
+  0x9C, 0xF2, 0x41, 0x82, 0xF4, 0xA9, 0x11, 0x82, 0x06, 0x8D, 0xEF, 0x42, 0x82, 0xF2, 0x9F, 0x0C,
+  0x01, 0x80, 0x8D, 0x46, 0x80, 0xA9, 0x01, 0x82, 0xE5, 0xFF, 0x10, 0x03, 0x86, 0xF4, 0xFD, 0x0B,
+  0x00, 0xF4, 0xFF, 0x10, 0x03, 0x86, 0xF4, 0xFF, 0x18, 0x00, 0xF4, 0xFF, 0x10, 0x03, 0x86, 0xF4,
+  0xFF, 0x18, 0x00, 0xF4, 0xFF, 0x10, 0x03, 0x86, 0xF4, 0xFF, 0x18, 0x00, 0xF4, 0xFF, 0x10, 0x07,
+  0x82, 0xF4, 0xFF, 0x10, 0x07, 0x82, 0xF2, 0xFF, 0x25, 0x07, 0x84, 0xAC, 0xFF, 0xF0, 0x66, 0x01,
+  0x05, 0x82, 0x09, 0x7D, 0xF1, 0x46, 0x83, 0xB0, 0x05, 0x71, 0xF0, 0x46, 0x84, 0xB0, 0xB1, 0xFF,
+  0xEB, 0x60, 0x02, 0x41, 0x01, 0x82, 0xFD, 0xFF, 0x13, 0x03, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01,
+  0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01,
+  0x41, 0x04, 0x41, 0x01, 0x81, 0xF2, 0xFF, 0x04, 0x41, 0x01, 0x80, 0x9C, 0x47, 0x01, 0x82, 0x0A,
+  0x99, 0xF2, 0x45, 0x01, 0xF8, 0xF7, 0xE9, 0xE8, 0xDA, 0xD9, 0xCA, 0xC9, 0xBB, 0xBA, 0xAB, 0xAA,
+  0x9C, 0x9B, 0x00, 0x00, 0x37, 0xFF, 0xD8, 0x00, 0x00, 0xA6, 0xFF, 0x6B, 0x00, 0x19, 0xFA, 0xF0,
+  0x0C, 0x00, 0x72, 0xFF, 0x95, 0x00, 0x00, 0xBF, 0xFF, 0x44, 0x00, 0x0F, 0xFA, 0xF0, 0x05, 0x00,
+  0x4B, 0xFF, 0xAF, 0x00, 0x00, 0x78, 0xFF, 0x82, 0x00, 0x00, 0xA3, 0xFF, 0x57, 0x00, 0x00, 0xCB,
+  0xFF, 0x30, 0x00, 0x00, 0xDE, 0xFF, 0x1F, 0x00, 0x00, 0xEC, 0xFF, 0x12, 0x00, 0x00, 0xF9, 0xFF,
+  0x06, 0x00, 0x00, 0xF9, 0xFF, 0x06, 0x00, 0x00, 0xEC, 0xFF, 0x12, 0x00, 0x00, 0xDE, 0xFF, 0x1F,
+  0x00, 0x00, 0xCB, 0xFF, 0x30, 0x00, 0x00, 0xA3, 0xFF, 0x57, 0x00, 0x00, 0x78, 0xFF, 0x82, 0x00,
+  0x00, 0x4B, 0xFF, 0xAF, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x05, 0x00, 0x00, 0xBF, 0xFF, 0x44, 0x00,
+  0x00, 0x72, 0xFF, 0x95, 0x00, 0x00, 0x1A, 0xFA, 0xF0, 0x0C, 0x00, 0x00, 0xA6, 0xFF, 0x6B, 0x00,
+  0x00, 0x37, 0xFF, 0xD8, 0xD9, 0xFF, 0x37, 0x00, 0x00, 0x6D, 0xFF, 0xA5, 0x00, 0x00, 0x0D, 0xF1,
+  0xFA, 0x19, 0x00, 0x00, 0x97, 0xFF, 0x72, 0x00, 0x00, 0x48, 0xFF, 0xBE, 0x00, 0x00, 0x06, 0xF2,
+  0xFA, 0x0E, 0x00, 0x00, 0xB3, 0xFF, 0x4B, 0x00, 0x00, 0x86, 0xFF, 0x77, 0x00, 0x00, 0x5A, 0xFF,
+  0xA2, 0x00, 0x00, 0x32, 0xFF, 0xCA, 0x00, 0x00, 0x21, 0xFF, 0xDD, 0x00, 0x00, 0x14, 0xFF, 0xEB,
+  0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x14, 0xFF, 0xEB, 0x00,
+  0x00, 0x21, 0xFF, 0xDD, 0x00, 0x00, 0x32, 0xFF, 0xCA, 0x00, 0x00, 0x5A, 0xFF, 0xA2, 0x00, 0x00,
+  0x86, 0xFF, 0x77, 0x00, 0x00, 0xB3, 0xFF, 0x4B, 0x00, 0x06, 0xF2, 0xFA, 0x0E, 0x00, 0x48, 0xFF,
+  0xBE, 0x00, 0x00, 0x97, 0xFF, 0x72, 0x00, 0x0C, 0xF1, 0xFA, 0x19, 0x00, 0x6D, 0xFF, 0xA5, 0x00,
+  0x00, 0xD9, 0xFF, 0x37, 0x00, 0x00, 0x02, 0x81, 0xF4, 0xF4, 0x05, 0x81, 0xDD, 0xDD, 0x02, 0x96,
+  0x92, 0x3E, 0x00, 0xC5, 0xC6, 0x00, 0x3E, 0x91, 0xB8, 0xFC, 0x76, 0xAE, 0xB0, 0x74, 0xFB, 0xB8,
+  0x00, 0x49, 0xCD, 0xF8, 0xF8, 0xCE, 0x4A, 0x01, 0x96, 0x43, 0xC6, 0xF5, 0xF5, 0xC7, 0x44, 0x00,
+  0xB7, 0xFB, 0x6F, 0xAE, 0xB0, 0x6D, 0xFA, 0xB6, 0x92, 0x3C, 0x00, 0xC6, 0xC7, 0x00, 0x3C, 0x91,
+  0x02, 0x81, 0xDD, 0xDD, 0x05, 0x81, 0xF4, 0xF4, 0x02, 0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07,
+  0x41, 0x03, 0x53, 0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x03, 0x19, 0xFF, 0xCC, 0x4D,
+  0xFF, 0x66, 0x80, 0xF3, 0x0C, 0xB3, 0x99, 0x00, 0xE6, 0x33, 0x00, 0x4B, 0x45, 0x07, 0x82, 0x27,
+  0xFF, 0xD9, 0x07, 0x82, 0x8C, 0xFF, 0x74, 0x06, 0x83, 0x06, 0xEA, 0xF9, 0x15, 0x06, 0x82, 0x56,
+  0xFF, 0xA9, 0x07, 0x82, 0xBC, 0xFF, 0x44, 0x06, 0x83, 0x22, 0xFE, 0xDE, 0x01, 0x06, 0x82, 0x86,
+  0xFF, 0x7A, 0x06, 0x83, 0x04, 0xE6, 0xFB, 0x19, 0x06, 0x82, 0x51, 0xFF, 0xAF, 0x07, 0x82, 0xB6,
+  0xFF, 0x4A, 0x06, 0x83, 0x1D, 0xFD, 0xE2, 0x02, 0x06, 0x82, 0x80, 0xFF, 0x7F, 0x06, 0x83, 0x02,
+  0xE2, 0xFD, 0x1D, 0x06, 0x82, 0x4B, 0xFF, 0xB5, 0x07, 0x82, 0xB0, 0xFF, 0x50, 0x06, 0x83, 0x19,
+  0xFB, 0xE6, 0x04, 0x06, 0x82, 0x7B, 0xFF, 0x85, 0x06, 0x83, 0x01, 0xDE, 0xFE, 0x22, 0x06, 0x82,
+  0x45, 0xFF, 0xBB, 0x07, 0x82, 0xAA, 0xFF, 0x55, 0x06, 0x83, 0x15, 0xF9, 0xEA, 0x06, 0x06, 0x82,
+  0x75, 0xFF, 0x8B, 0x07, 0x82, 0xD9, 0xFF, 0x27, 0x07, 0x82, 0x09, 0x9A, 0xF2, 0x42, 0x83, 0xF1,
+  0x98, 0x08, 0x98, 0x46, 0x82, 0x95, 0xF2, 0xFF, 0x04, 0x40, 0x80, 0xF1, 0x41, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81,
+  0xF2, 0xFF, 0x04, 0x40, 0x81, 0xF1, 0x99, 0x46, 0x83, 0x97, 0x0A, 0x9C, 0xF2, 0x42, 0x82, 0xF2,
+  0x9A, 0x09, 0x00, 0x88, 0x7F, 0xFF, 0x00, 0xBD, 0xFF, 0x05, 0xF5, 0xFF, 0x38, 0x41, 0x80, 0x76,
+  0x41, 0x80, 0xB3, 0x41, 0x80, 0xEE, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
+  0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
+  0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x82, 0x09, 0x9E, 0xF2, 0x42, 0x83, 0xF1, 0x98, 0x08,
+  0x96, 0x46, 0x82, 0x95, 0xF2, 0xFF, 0x04, 0x40, 0x80, 0xF1, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x40, 0x80, 0xF7, 0x05, 0x82, 0x14, 0xFF, 0xC2, 0x05, 0x82, 0x85, 0xFF, 0x59, 0x04,
+  0x83, 0x0F, 0xF0, 0xDC, 0x03, 0x04, 0x82, 0x7A, 0xFF, 0x65, 0x04, 0x83, 0x0A, 0xEA, 0xE4, 0x06,
+  0x04, 0x82, 0x70, 0xFF, 0x70, 0x04, 0x83, 0x06, 0xE4, 0xEB, 0x0A, 0x04, 0x82, 0x66, 0xFF, 0x7B,
+  0x04, 0x83, 0x03, 0xDD, 0xF1, 0x0F, 0x04, 0x82, 0x5C, 0xFF, 0x86, 0x04, 0x83, 0x01, 0xD5, 0xF6,
+  0x16, 0x04, 0x82, 0x52, 0xFF, 0x91, 0x05, 0x82, 0xCC, 0xFA, 0x1D, 0x04, 0x82, 0x48, 0xFF, 0x9D,
+  0x05, 0x80, 0xC3, 0x50, 0x82, 0x07, 0x92, 0xF0, 0x42, 0x83, 0xEF, 0x88, 0x03, 0x93, 0x46, 0x83,
+  0x85, 0xEA, 0xFF, 0x04, 0x02, 0x85, 0x08, 0xFF, 0xE8, 0xF8, 0xFF, 0x04, 0x02, 0x85, 0x08, 0xFF,
+  0xF8, 0xF8, 0xFF, 0x04, 0x02, 0x85, 0x08, 0xFF, 0xF8, 0xF8, 0xFF, 0x04, 0x02, 0x85, 0x08, 0xFF,
+  0xF8, 0xF8, 0xFF, 0x04, 0x02, 0x82, 0x08, 0xFF, 0xF7, 0x05, 0x82, 0x60, 0xFF, 0xCC, 0x03, 0x84,
+  0x09, 0x9D, 0xFF, 0xDC, 0x29, 0x02, 0x84, 0x28, 0xD3, 0xFC, 0x8B, 0x09, 0x03, 0x82, 0xE8, 0xFF,
+  0x64, 0x05, 0x84, 0x29, 0xD4, 0xFC, 0x8C, 0x0A, 0x04, 0x84, 0x0A, 0xA1, 0xFF, 0xDF, 0x2F, 0x05,
+  0x82, 0x64, 0xFF, 0xD5, 0x06, 0x41, 0x06, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41,
+  0x81, 0xF2, 0xFF, 0x04, 0x40, 0x81, 0xF0, 0x9C, 0x46, 0x83, 0x8E, 0x0A, 0x99, 0xF2, 0x42, 0x82,
+  0xF1, 0x90, 0x06, 0x04, 0x82, 0x9D, 0xFF, 0x6A, 0x05, 0x83, 0x06, 0xEF, 0xFB, 0x15, 0x05, 0x82,
+  0x4F, 0xFF, 0xB6, 0x06, 0x82, 0xA9, 0xFF, 0x5B, 0x05, 0x83, 0x0C, 0xF5, 0xF5, 0x0B, 0x05, 0x82,
+  0x5B, 0xFF, 0xA6, 0x06, 0x82, 0xB4, 0xFF, 0x4C, 0x05, 0x83, 0x13, 0xFA, 0xEC, 0x05, 0x41, 0x03,
+  0x83, 0x67, 0xFF, 0x97, 0x00, 0x41, 0x03, 0x83, 0xC0, 0xFF, 0x3D, 0x00, 0x41, 0x02, 0x84, 0x1B,
+  0xFD, 0xE1, 0x01, 0x00, 0x41, 0x02, 0x82, 0x73, 0xFF, 0x88, 0x01, 0x41, 0x02, 0x82, 0xCC, 0xFF,
+  0x2D, 0x01, 0x41, 0x01, 0x82, 0x25, 0xFF, 0xD3, 0x02, 0x41, 0x01, 0x82, 0x7E, 0xFF, 0x79, 0x02,
+  0x41, 0x01, 0x80, 0xD7, 0x52, 0x05, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07,
+  0x41, 0x01, 0x80, 0x86, 0x47, 0x80, 0x92, 0x47, 0x82, 0x9D, 0xFF, 0x3A, 0x05, 0x82, 0xA9, 0xFF,
+  0x31, 0x05, 0x82, 0xB5, 0xFF, 0x28, 0x05, 0x82, 0xC0, 0xFF, 0x1F, 0x05, 0x82, 0xCC, 0xFF, 0x16,
+  0x05, 0x82, 0xD8, 0xFF, 0x0D, 0x05, 0x82, 0xE3, 0xFF, 0x04, 0x05, 0x80, 0xEF, 0x44, 0x83, 0xF2,
+  0x9E, 0x0B, 0xFA, 0x46, 0x80, 0x96, 0x06, 0x40, 0x80, 0xE9, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41,
+  0x06, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF3, 0xFF, 0x04, 0x40, 0x81,
+  0xF2, 0xA3, 0x46, 0x83, 0xA1, 0x0F, 0xA4, 0xF3, 0x42, 0x82, 0xF3, 0xA2, 0x0E, 0x82, 0x09, 0x9A,
+  0xF2, 0x42, 0x83, 0xF0, 0x96, 0x08, 0x98, 0x46, 0x82, 0x95, 0xF2, 0xFF, 0x04, 0x40, 0x80, 0xF1,
+  0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x45, 0x82,
+  0xF3, 0xAA, 0x14, 0x47, 0x80, 0xAD, 0x41, 0x04, 0x40, 0x80, 0xF3, 0x41, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF2, 0xFF, 0x04, 0x40, 0x81,
+  0xF2, 0x99, 0x46, 0x83, 0x98, 0x0A, 0x9C, 0xF2, 0x42, 0x82, 0xF2, 0x9D, 0x0A, 0x50, 0x80, 0xEA,
+  0x41, 0x03, 0x82, 0x18, 0xFF, 0xBB, 0x41, 0x03, 0x82, 0x49, 0xFF, 0x8D, 0x41, 0x03, 0x82, 0x7A,
+  0xFF, 0x5E, 0x05, 0x82, 0xAB, 0xFF, 0x2F, 0x05, 0x82, 0xDC, 0xFA, 0x06, 0x04, 0x82, 0x0D, 0xFE,
+  0xD2, 0x05, 0x82, 0x3D, 0xFF, 0xA4, 0x05, 0x82, 0x6E, 0xFF, 0x75, 0x05, 0x82, 0x9F, 0xFF, 0x46,
+  0x05, 0x82, 0xCF, 0xFF, 0x18, 0x04, 0x82, 0x06, 0xF9, 0xE9, 0x05, 0x82, 0x31, 0xFF, 0xBA, 0x05,
+  0x82, 0x62, 0xFF, 0x8C, 0x05, 0x82, 0x92, 0xFF, 0x5D, 0x05, 0x82, 0xC3, 0xFF, 0x2E, 0x04, 0x83,
+  0x01, 0xF2, 0xFA, 0x05, 0x04, 0x82, 0x25, 0xFF, 0xD1, 0x05, 0x82, 0x55, 0xFF, 0xA2, 0x05, 0x82,
+  0x86, 0xFF, 0x74, 0x05, 0x82, 0xB7, 0xFF, 0x45, 0x05, 0x82, 0xE8, 0xFF, 0x17, 0x02, 0x82, 0x03,
+  0x84, 0xED, 0x42, 0x83, 0xEF, 0x86, 0x03, 0x80, 0x46, 0x83, 0x7F, 0xE1, 0xFF, 0x10, 0x02, 0x85,
+  0x10, 0xFF, 0xE0, 0xF0, 0xFF, 0x10, 0x02, 0x85, 0x10, 0xFF, 0xF0, 0xF0, 0xFF, 0x10, 0x02, 0x85,
+  0x10, 0xFF, 0xF0, 0xF0, 0xFF, 0x10, 0x02, 0x85, 0x10, 0xFF, 0xF0, 0xF0, 0xFF, 0x10, 0x02, 0x85,
+  0x10, 0xFF, 0xF0, 0xEC, 0xFF, 0x10, 0x02, 0x94, 0x10, 0xFF, 0xEB, 0x9F, 0xFF, 0xBC, 0x1B, 0x00,
+  0x1C, 0xBC, 0xFF, 0x9D, 0x10, 0xA3, 0xFF, 0xEE, 0x84, 0xEE, 0xFF, 0xA1, 0x0E, 0x01, 0x80, 0x8C,
+  0x42, 0x80, 0x8A, 0x01, 0x94, 0x0C, 0x99, 0xFF, 0xF3, 0x90, 0xF3, 0xFE, 0x94, 0x09, 0xAB, 0xFF,
+  0xC1, 0x21, 0x00, 0x21, 0xC2, 0xFF, 0xA4, 0xF1, 0xFF, 0x02, 0x02, 0x82, 0x02, 0xFF, 0xEF, 0x41,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF1, 0xFF, 0x04,
+  0x40, 0x81, 0xF0, 0x91, 0x46, 0x83, 0x8E, 0x07, 0x92, 0xF1, 0x42, 0x82, 0xF0, 0x8F, 0x06, 0x82,
+  0x07, 0x98, 0xF5, 0x42, 0x83, 0xF0, 0x8F, 0x06, 0x93, 0x46, 0x82, 0x8F, 0xF1, 0xFF, 0x04, 0x40,
+  0x80, 0xF0, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x41, 0x81, 0xED, 0xFF, 0x04, 0x41, 0x80, 0xA6, 0x47, 0x82, 0x16, 0xB4, 0xF7, 0x45, 0x06, 0x41,
+  0x06, 0x41, 0x06, 0x41, 0x06, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF1, 0xFF, 0x04,
+  0x40, 0x81, 0xF2, 0x97, 0x46, 0x83, 0x98, 0x09, 0x9A, 0xF2, 0x42, 0x82, 0xF2, 0x9D, 0x0A, 0x45,
+  0x0B, 0x45, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x11, 0x8E, 0x19, 0xFF, 0xCC, 0x4D, 0xFF, 0x66,
+  0x80, 0xF3, 0x0C, 0xB3, 0x99, 0x00, 0xE6, 0x33, 0x00, 0x04, 0x81, 0x03, 0x92, 0x03, 0x82, 0x0D,
+  0xB6, 0xFF, 0x02, 0x83, 0x1E, 0xD2, 0xFE, 0x73, 0x01, 0x83, 0x36, 0xE7, 0xFA, 0x5A, 0x01, 0x83,
+  0x54, 0xF6, 0xF3, 0x45, 0x01, 0x83, 0x78, 0xFE, 0xE9, 0x33, 0x02, 0x41, 0x80, 0x47, 0x03, 0x83,
+  0x85, 0xFF, 0xE9, 0x32, 0x03, 0x83, 0x60, 0xFA, 0xF3, 0x45, 0x03, 0x83, 0x40, 0xEE, 0xFA, 0x5A,
+  0x03, 0x83, 0x26, 0xDB, 0xFE, 0x73, 0x03, 0x82, 0x13, 0xC3, 0xFF, 0x04, 0x81, 0x06, 0xA3, 0x51,
+  0x1A, 0x51, 0x81, 0xA7, 0x07, 0x04, 0x40, 0x81, 0xC4, 0x13, 0x03, 0x83, 0x73, 0xFE, 0xDB, 0x25,
+  0x03, 0x83, 0x5B, 0xFA, 0xEC, 0x3C, 0x03, 0x83, 0x46, 0xF3, 0xF8, 0x58, 0x03, 0x83, 0x33, 0xE9,
+  0xFE, 0x7A, 0x03, 0x80, 0x47, 0x41, 0x02, 0x83, 0x33, 0xE9, 0xFF, 0x85, 0x01, 0x83, 0x45, 0xF3,
+  0xF8, 0x5D, 0x01, 0x83, 0x5A, 0xFA, 0xEA, 0x3B, 0x01, 0x83, 0x73, 0xFE, 0xD5, 0x21, 0x02, 0x40,
+  0x81, 0xB8, 0x0E, 0x03, 0x81, 0x94, 0x03, 0x04, 0x82, 0x05, 0x8C, 0xF0, 0x41, 0x83, 0xF0, 0x8F,
+  0x06, 0x8E, 0x45, 0x82, 0x8F, 0xF0, 0xFF, 0x03, 0x40, 0x80, 0xF0, 0x41, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x41, 0x05, 0x40, 0x80, 0xFC, 0x04, 0x82, 0x33, 0xFF, 0xCC, 0x03, 0x83, 0x02, 0xCB, 0xFF,
+  0x46, 0x03, 0x82, 0x6A, 0xFF, 0xA6, 0x03, 0x83, 0x16, 0xEF, 0xEF, 0x17, 0x03, 0x82, 0x9C, 0xFF,
+  0x66, 0x04, 0x82, 0xF0, 0xFF, 0x01, 0x04, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x1D, 0x41,
+  0x05, 0x41, 0x05, 0x41, 0x02, 0x81, 0x66, 0xEC, 0x47, 0x82, 0xEC, 0x66, 0xEC, 0x09, 0x81, 0xEC,
+  0xFF, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x01, 0x80, 0xC2, 0x43, 0x80, 0xC3, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x05, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x01, 0x80, 0xCF, 0x44, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x81, 0xEC, 0xFF, 0x01,
+  0x80, 0xC3, 0x45, 0x82, 0xEC, 0x66, 0xFF, 0x0A, 0x40, 0x0A, 0x40, 0x0A, 0x80, 0xEC, 0x0A, 0x81,
+  0x66, 0xEC, 0x49, 0x02, 0x80, 0x16, 0x41, 0x80, 0x16, 0x05, 0x80, 0x43, 0x41, 0x80, 0x42, 0x05,
+  0x80, 0x70, 0x41, 0x80, 0x6F, 0x05, 0x80, 0x9C, 0x41, 0x80, 0x9B, 0x05, 0x83, 0xC9, 0xE0, 0xEF,
+  0xC8, 0x04, 0x85, 0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x03, 0x85, 0x22, 0xFF, 0x94, 0xA3, 0xFF,
+  0x21, 0x03, 0x85, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 0x03, 0x85, 0x7C, 0xFF, 0x49, 0x55, 0xFF,
+  0x7A, 0x03, 0x85, 0xA8, 0xFF, 0x23, 0x2E, 0xFF, 0xA6, 0x03, 0x85, 0xD5, 0xF9, 0x03, 0x09, 0xFE,
+  0xD3, 0x02, 0x82, 0x06, 0xFB, 0xD7, 0x01, 0x82, 0xE1, 0xFA, 0x05, 0x01, 0x82, 0x2E, 0xFF, 0xB1,
+  0x01, 0x82, 0xBA, 0xFF, 0x2C, 0x01, 0x82, 0x5B, 0xFF, 0x8C, 0x01, 0x82, 0x94, 0xFF, 0x58, 0x01,
+  0x82, 0x88, 0xFF, 0x66, 0x01, 0x82, 0x6D, 0xFF, 0x85, 0x01, 0x82, 0xB4, 0xFF, 0x40, 0x01, 0x82,
+  0x46, 0xFF, 0xB1, 0x01, 0x82, 0xE1, 0xFF, 0x1A, 0x01, 0x84, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0x46,
+  0x82, 0xFE, 0x0C, 0x3A, 0x47, 0x83, 0x37, 0x67, 0xFF, 0xAE, 0x03, 0x85, 0xB3, 0xFF, 0x63, 0x93,
+  0xFF, 0x7C, 0x03, 0x85, 0x80, 0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x03, 0x85, 0x4D, 0xFF, 0xBC, 0xEC,
+  0xFF, 0x18, 0x03, 0x82, 0x1A, 0xFF, 0xE9, 0x45, 0x82, 0xF2, 0xA8, 0x11, 0x47, 0x80, 0xA0, 0x41,
+  0x03, 0x82, 0x10, 0xFF, 0xE4, 0x41, 0x03, 0x82, 0x10, 0xFF, 0xF0, 0x41, 0x03, 0x82, 0x10, 0xFF,
+  0xF0, 0x41, 0x03, 0x82, 0x10, 0xFF, 0xF0, 0x41, 0x03, 0x82, 0x10, 0xFF, 0xF0, 0x41, 0x03, 0x82,
+  0x10, 0xFF, 0xF0, 0x41, 0x03, 0x82, 0x25, 0xFF, 0xE1, 0x41, 0x02, 0x83, 0x63, 0xF0, 0xFF, 0x7D,
+  0x45, 0x82, 0xEF, 0x61, 0x00, 0x45, 0x82, 0xEE, 0x59, 0x00, 0x41, 0x02, 0x83, 0x5C, 0xEB, 0xFF,
+  0x85, 0x41, 0x03, 0x82, 0x13, 0xFF, 0xF2, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x40, 0x80, 0xF4, 0x47, 0x80, 0xB1, 0x45, 0x82, 0xF5, 0xB2, 0x18,
+  0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4, 0xAF, 0x17, 0xB2, 0x46, 0x82, 0xB0, 0xF5, 0xFF, 0x04,
+  0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x06, 0x41, 0x06, 0x41,
+  0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4, 0xB3, 0x46, 0x83,
+  0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB1, 0x18, 0x44, 0x83, 0xF2, 0xAD, 0x20, 0x00, 0x46,
+  0x81, 0xE5, 0x18, 0x41, 0x01, 0x84, 0x03, 0x34, 0xD4, 0xFF, 0x9E, 0x41, 0x03, 0x82, 0x38, 0xFF,
+  0xEB, 0x41, 0x03, 0x80, 0x05, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x03, 0x80, 0x05, 0x43, 0x03, 0x82, 0x38, 0xFF, 0xEB, 0x41, 0x01, 0x84, 0x04, 0x37, 0xD4, 0xFF,
+  0x9E, 0x46, 0x81, 0xE5, 0x19, 0x44, 0x83, 0xF2, 0xAD, 0x20, 0x00, 0x4F, 0x04, 0x41, 0x04, 0x41,
+  0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4F, 0x04, 0x41, 0x04, 0x41,
+  0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4D, 0x4F, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4F, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4, 0xB0, 0x17, 0xB2, 0x46, 0x82,
+  0xB0, 0xF5, 0xFF, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x02, 0x45, 0x02, 0x45, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81,
+  0xF4, 0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x41, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x55, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x6D, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06,
+  0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06,
+  0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4, 0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42,
+  0x82, 0xF5, 0xB2, 0x18, 0x41, 0x04, 0x82, 0x47, 0xFF, 0xCA, 0x41, 0x03, 0x83, 0x03, 0xD3, 0xFF,
+  0x40, 0x41, 0x03, 0x83, 0x65, 0xFF, 0xB5, 0x00, 0x41, 0x02, 0x84, 0x0C, 0xE7, 0xFD, 0x2D, 0x00,
+  0x41, 0x02, 0x82, 0x83, 0xFF, 0x9F, 0x01, 0x41, 0x01, 0x83, 0x1B, 0xF5, 0xF7, 0x1D, 0x01, 0x41,
+  0x01, 0x82, 0xA1, 0xFF, 0x8A, 0x02, 0x41, 0x00, 0x83, 0x31, 0xFE, 0xEE, 0x11, 0x02, 0x41, 0x00,
+  0x82, 0xBE, 0xFF, 0x74, 0x03, 0x41, 0x83, 0x4D, 0xFF, 0xE1, 0x08, 0x03, 0x41, 0x82, 0xD7, 0xFF,
+  0x5E, 0x04, 0x42, 0x81, 0xF1, 0x04, 0x04, 0x41, 0x82, 0xE2, 0xFF, 0x5D, 0x04, 0x41, 0x83, 0x5C,
+  0xFF, 0xDF, 0x06, 0x03, 0x41, 0x83, 0x01, 0xCA, 0xFF, 0x6F, 0x03, 0x41, 0x00, 0x83, 0x3B, 0xFF,
+  0xEB, 0x0E, 0x02, 0x41, 0x01, 0x82, 0xAB, 0xFF, 0x82, 0x02, 0x41, 0x01, 0x83, 0x21, 0xF8, 0xF4,
+  0x17, 0x01, 0x41, 0x02, 0x82, 0x8A, 0xFF, 0x95, 0x01, 0x41, 0x02, 0x84, 0x0F, 0xEA, 0xFA, 0x23,
+  0x00, 0x41, 0x03, 0x83, 0x69, 0xFF, 0xA8, 0x00, 0x41, 0x03, 0x83, 0x03, 0xD5, 0xFE, 0x32, 0x41,
+  0x04, 0x82, 0x48, 0xFF, 0xBB, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41,
+  0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41,
+  0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4D,
+  0x41, 0x80, 0x1E, 0x04, 0x80, 0x1E, 0x43, 0x80, 0x5C, 0x04, 0x80, 0x5D, 0x43, 0x80, 0x99, 0x04,
+  0x80, 0x9A, 0x43, 0x80, 0xD7, 0x04, 0x80, 0xD8, 0x44, 0x80, 0x15, 0x02, 0x80, 0x15, 0x45, 0x80,
+  0x52, 0x02, 0x80, 0x53, 0x43, 0x82, 0xF8, 0xFF, 0x8F, 0x02, 0x82, 0x90, 0xFF, 0xF9, 0x41, 0x82,
+  0xF0, 0xE8, 0xCD, 0x02, 0x82, 0xCE, 0xE7, 0xF0, 0x42, 0x86, 0xA7, 0xFC, 0x0E, 0x00, 0x0E, 0xFC,
+  0xA6, 0x43, 0x86, 0x65, 0xFF, 0x48, 0x00, 0x49, 0xFF, 0x64, 0x43, 0x86, 0x23, 0xFF, 0x86, 0x00,
+  0x87, 0xFF, 0x22, 0x43, 0x00, 0x85, 0xE1, 0xC3, 0x00, 0xC4, 0xE0, 0x00, 0x43, 0x00, 0x85, 0x9F,
+  0xF8, 0x11, 0xF9, 0x9E, 0x00, 0x43, 0x00, 0x85, 0x5D, 0xFF, 0x7E, 0xFF, 0x5C, 0x00, 0x43, 0x00,
+  0x85, 0x1B, 0xFF, 0xE7, 0xFF, 0x1A, 0x00, 0x43, 0x01, 0x82, 0xD9, 0xFF, 0xD8, 0x01, 0x43, 0x01,
+  0x82, 0x97, 0xFF, 0x96, 0x01, 0x43, 0x01, 0x82, 0x55, 0xFF, 0x54, 0x01, 0x43, 0x01, 0x82, 0x14,
+  0xFC, 0x14, 0x01, 0x43, 0x02, 0x80, 0xA1, 0x02, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x41, 0x40,
+  0x80, 0xC5, 0x04, 0x42, 0x81, 0xFE, 0x1A, 0x03, 0x43, 0x80, 0x6B, 0x03, 0x43, 0x80, 0xBE, 0x03,
+  0x43, 0x81, 0xFC, 0x14, 0x02, 0x44, 0x80, 0x64, 0x02, 0x43, 0x81, 0xDC, 0xB7, 0x02, 0x43, 0x82,
+  0x8A, 0xFA, 0x10, 0x01, 0x43, 0x82, 0x36, 0xFF, 0x5D, 0x01, 0x43, 0x00, 0x81, 0xE1, 0xB0, 0x01,
+  0x43, 0x00, 0x83, 0x8F, 0xF7, 0x0C, 0x00, 0x43, 0x00, 0x83, 0x3C, 0xFF, 0x56, 0x00, 0x43, 0x00,
+  0x83, 0x01, 0xE6, 0xA9, 0x00, 0x43, 0x01, 0x82, 0x95, 0xF3, 0x08, 0x43, 0x01, 0x82, 0x41, 0xFF,
+  0x4F, 0x43, 0x01, 0x82, 0x03, 0xEA, 0xA2, 0x43, 0x02, 0x81, 0x9B, 0xEF, 0x43, 0x02, 0x80, 0x47,
+  0x44, 0x02, 0x81, 0x05, 0xEE, 0x43, 0x03, 0x80, 0xA0, 0x43, 0x03, 0x80, 0x4D, 0x43, 0x03, 0x81,
+  0x07, 0xF2, 0x42, 0x04, 0x81, 0xA6, 0xFF, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4, 0xB0, 0x17,
+  0xB2, 0x46, 0x82, 0xB0, 0xF5, 0xFF, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF,
+  0x04, 0x40, 0x81, 0xF4, 0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18,
+  0x45, 0x82, 0xF4, 0xB0, 0x17, 0x47, 0x80, 0xB0, 0x41, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x40,
+  0x80, 0xF4, 0x47, 0x80, 0xB1, 0x45, 0x82, 0xF5, 0xB2, 0x18, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06,
+  0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x82, 0x18, 0xB1, 0xF4,
+  0x42, 0x82, 0xF4, 0xB2, 0x18, 0x01, 0x80, 0xB2, 0x46, 0x80, 0xB2, 0x01, 0x81, 0xF5, 0xFF, 0x04,
+  0x40, 0x80, 0xF4, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01,
+  0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01,
+  0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01,
+  0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x02, 0x81, 0x9E, 0x01, 0x41, 0x01, 0x41,
+  0x02, 0x40, 0x80, 0x91, 0x41, 0x01, 0x41, 0x02, 0x80, 0x88, 0x42, 0x01, 0x41, 0x03, 0x80, 0x96,
+  0x41, 0x83, 0x14, 0x00, 0xF5, 0xFF, 0x03, 0x80, 0x01, 0x41, 0x82, 0xE9, 0x54, 0xB3, 0x46, 0x85,
+  0xF1, 0xF7, 0xFF, 0x1A, 0xB3, 0xF5, 0x42, 0x84, 0xFB, 0xD5, 0x47, 0x29, 0xCA, 0x45, 0x82, 0xF4,
+  0xB0, 0x17, 0x47, 0x80, 0xB0, 0x41, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x40, 0x80, 0xF7, 0x41, 0x00, 0x80, 0xE3, 0x43,
+  0x80, 0xCB, 0x41, 0x00, 0x85, 0xA8, 0xFF, 0xFA, 0xFC, 0xD5, 0x37, 0x41, 0x00, 0x82, 0x57, 0xFF,
+  0x7E, 0x02, 0x41, 0x00, 0x82, 0x0D, 0xF8, 0xD3, 0x02, 0x41, 0x01, 0x82, 0xB4, 0xFF, 0x29, 0x01,
+  0x41, 0x01, 0x82, 0x63, 0xFF, 0x7E, 0x01, 0x41, 0x01, 0x82, 0x14, 0xFC, 0xD4, 0x01, 0x41, 0x02,
+  0x83, 0xC0, 0xFF, 0x29, 0x00, 0x41, 0x02, 0x83, 0x6F, 0xFF, 0x7F, 0x00, 0x41, 0x02, 0x83, 0x1E,
+  0xFF, 0xD4, 0x00, 0x41, 0x03, 0x82, 0xCC, 0xFF, 0x2A, 0x41, 0x03, 0x82, 0x7A, 0xFF, 0x7F, 0x41,
+  0x03, 0x82, 0x29, 0xFF, 0xD5, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4, 0xB2, 0x18, 0xB2, 0x46,
+  0x82, 0xB2, 0xF5, 0xFF, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x82,
+  0xEF, 0xFF, 0x1A, 0x03, 0x41, 0x83, 0x90, 0xFF, 0xCB, 0x09, 0x04, 0x84, 0x08, 0xCA, 0xFF, 0xA9,
+  0x01, 0x04, 0x83, 0x19, 0xE4, 0xFF, 0x80, 0x05, 0x83, 0x33, 0xF6, 0xFE, 0x57, 0x05, 0x83, 0x55,
+  0xFE, 0xF6, 0x34, 0x05, 0x83, 0x7F, 0xFF, 0xE5, 0x1B, 0x04, 0x84, 0x01, 0xA9, 0xFF, 0xCC, 0x0A,
+  0x04, 0x83, 0x09, 0xCB, 0xFF, 0x94, 0x05, 0x82, 0x1A, 0xFF, 0xEF, 0x41, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4, 0xB3, 0x46, 0x83, 0xB3, 0x1A,
+  0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB4, 0x1A, 0x53, 0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+  0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+  0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+  0x07, 0x41, 0x03, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04,
+  0x40, 0x81, 0xF4, 0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x82,
+  0xEA, 0xFF, 0x14, 0x03, 0x85, 0x13, 0xFF, 0xE9, 0xBD, 0xFF, 0x3C, 0x03, 0x85, 0x3C, 0xFF, 0xBC,
+  0x91, 0xFF, 0x64, 0x03, 0x85, 0x64, 0xFF, 0x90, 0x64, 0xFF, 0x8D, 0x03, 0x85, 0x8C, 0xFF, 0x63,
+  0x38, 0xFF, 0xB5, 0x03, 0x85, 0xB4, 0xFF, 0x37, 0x0C, 0xFE, 0xDE, 0x03, 0x86, 0xDB, 0xFE, 0x0C,
+  0x00, 0xDF, 0xFD, 0x09, 0x01, 0x82, 0x06, 0xFC, 0xDE, 0x01, 0x82, 0xB2, 0xFF, 0x2F, 0x01, 0x82,
+  0x2B, 0xFF, 0xB1, 0x01, 0x82, 0x86, 0xFF, 0x57, 0x01, 0x82, 0x53, 0xFF, 0x85, 0x01, 0x82, 0x59,
+  0xFF, 0x80, 0x01, 0x82, 0x7B, 0xFF, 0x58, 0x01, 0x82, 0x2D, 0xFF, 0xA8, 0x01, 0x82, 0xA2, 0xFF,
+  0x2C, 0x01, 0x82, 0x05, 0xFA, 0xD1, 0x01, 0x82, 0xCA, 0xFA, 0x05, 0x02, 0x85, 0xD4, 0xF7, 0x02,
+  0x00, 0xF1, 0xD3, 0x03, 0x85, 0xA7, 0xFF, 0x22, 0x1A, 0xFF, 0xA6, 0x03, 0x85, 0x7B, 0xFF, 0x4A,
+  0x42, 0xFF, 0x7A, 0x03, 0x85, 0x4E, 0xFF, 0x72, 0x6A, 0xFF, 0x4D, 0x03, 0x85, 0x22, 0xFF, 0x9B,
+  0x91, 0xFF, 0x21, 0x03, 0x85, 0x01, 0xF3, 0xC3, 0xB9, 0xF3, 0x01, 0x04, 0x83, 0xC9, 0xE9, 0xDE,
+  0xC8, 0x05, 0x83, 0x9C, 0xFB, 0xF5, 0x9B, 0x05, 0x80, 0x70, 0x41, 0x80, 0x6F, 0x05, 0x80, 0x43,
+  0x41, 0x80, 0x42, 0x05, 0x80, 0x16, 0x41, 0x80, 0x16, 0x02, 0x82, 0xEF, 0xFF, 0x10, 0x01, 0x80,
+  0x10, 0x41, 0x80, 0x0F, 0x01, 0x85, 0x11, 0xFF, 0xEE, 0xCE, 0xFF, 0x32, 0x01, 0x80, 0x31, 0x41,
+  0x80, 0x2F, 0x01, 0x85, 0x34, 0xFF, 0xCD, 0xAD, 0xFF, 0x53, 0x01, 0x80, 0x52, 0x41, 0x80, 0x4F,
+  0x01, 0x85, 0x56, 0xFF, 0xAC, 0x8B, 0xFF, 0x75, 0x01, 0x80, 0x73, 0x41, 0x80, 0x6E, 0x01, 0x85,
+  0x79, 0xFF, 0x8A, 0x6A, 0xFF, 0x96, 0x01, 0x80, 0x94, 0x41, 0x80, 0x8E, 0x01, 0x85, 0x9B, 0xFF,
+  0x69, 0x49, 0xFF, 0xB8, 0x01, 0x80, 0xB4, 0x41, 0x80, 0xAE, 0x01, 0x85, 0xBD, 0xFF, 0x48, 0x27,
+  0xFF, 0xD9, 0x01, 0x83, 0xD5, 0xFE, 0xFF, 0xCD, 0x01, 0x9D, 0xE0, 0xFF, 0x26, 0x07, 0xFE, 0xF9,
+  0x02, 0x00, 0xF5, 0xF1, 0xF8, 0xED, 0x00, 0x05, 0xFC, 0xFE, 0x07, 0x00, 0xE4, 0xFF, 0x1D, 0x17,
+  0xFF, 0xD5, 0xDD, 0xFF, 0x0D, 0x24, 0xFF, 0xE3, 0x01, 0x8B, 0xC3, 0xFF, 0x3E, 0x37, 0xFF, 0xB5,
+  0xBC, 0xFF, 0x2D, 0x47, 0xFF, 0xC2, 0x01, 0x8B, 0xA2, 0xFF, 0x60, 0x58, 0xFF, 0x94, 0x9B, 0xFF,
+  0x4C, 0x69, 0xFF, 0xA1, 0x01, 0x8B, 0x80, 0xFF, 0x81, 0x79, 0xFF, 0x74, 0x7B, 0xFF, 0x6C, 0x8C,
+  0xFF, 0x7F, 0x01, 0x8B, 0x5F, 0xFF, 0xA3, 0x9A, 0xFF, 0x53, 0x5A, 0xFF, 0x8C, 0xAE, 0xFF, 0x5E,
+  0x01, 0x8B, 0x3D, 0xFF, 0xC4, 0xBA, 0xFF, 0x33, 0x39, 0xFF, 0xAB, 0xD0, 0xFF, 0x3C, 0x01, 0x8B,
+  0x1C, 0xFF, 0xE6, 0xDB, 0xFF, 0x13, 0x18, 0xFF, 0xCB, 0xF2, 0xFF, 0x1B, 0x01, 0x84, 0x02, 0xF8,
+  0xFC, 0xF2, 0xF2, 0x01, 0x84, 0xF6, 0xED, 0xFF, 0xF8, 0x01, 0x02, 0x83, 0xD9, 0xFF, 0xFE, 0xD2,
+  0x01, 0x83, 0xD6, 0xFE, 0xFF, 0xD8, 0x03, 0x80, 0xB8, 0x41, 0x80, 0xB1, 0x01, 0x80, 0xB5, 0x41,
+  0x80, 0xB7, 0x03, 0x80, 0x96, 0x41, 0x80, 0x91, 0x01, 0x80, 0x94, 0x41, 0x80, 0x95, 0x03, 0x80,
+  0x75, 0x41, 0x80, 0x71, 0x01, 0x80, 0x73, 0x41, 0x80, 0x74, 0x03, 0x80, 0x54, 0x41, 0x80, 0x50,
+  0x01, 0x80, 0x52, 0x41, 0x80, 0x53, 0x03, 0x80, 0x32, 0x41, 0x80, 0x30, 0x01, 0x80, 0x31, 0x41,
+  0x80, 0x31, 0x03, 0x80, 0x11, 0x41, 0x80, 0x10, 0x01, 0x80, 0x10, 0x41, 0x80, 0x10, 0x01, 0x82,
+  0xD0, 0xFF, 0x33, 0x04, 0x85, 0x33, 0xFF, 0xD8, 0x6C, 0xFF, 0x9A, 0x04, 0x86, 0x9A, 0xFF, 0x73,
+  0x10, 0xF5, 0xF3, 0x0D, 0x02, 0x87, 0x0C, 0xF3, 0xF8, 0x14, 0x00, 0xA0, 0xFF, 0x68, 0x02, 0x82,
+  0x66, 0xFF, 0xA6, 0x01, 0x82, 0x39, 0xFF, 0xCF, 0x02, 0x82, 0xCC, 0xFF, 0x40, 0x02, 0x86, 0xD3,
+  0xFF, 0x36, 0x00, 0x31, 0xFF, 0xD8, 0x03, 0x86, 0x6C, 0xFF, 0x9D, 0x00, 0x98, 0xFF, 0x73, 0x03,
+  0x86, 0x0F, 0xF5, 0xF5, 0x1B, 0xF2, 0xF9, 0x14, 0x04, 0x84, 0x9E, 0xFF, 0xC8, 0xFF, 0xA6, 0x05,
+  0x80, 0x37, 0x42, 0x80, 0x40, 0x06, 0x82, 0xD0, 0xFF, 0xD9, 0x07, 0x82, 0xA4, 0xFF, 0xC2, 0x06,
+  0x84, 0x0C, 0xF4, 0xFF, 0xFE, 0x21, 0x05, 0x84, 0x64, 0xFF, 0xEC, 0xFF, 0x7F, 0x05, 0x85, 0xC6,
+  0xFF, 0x4C, 0xFF, 0xDD, 0x01, 0x03, 0x86, 0x28, 0xFF, 0xC6, 0x00, 0xC7, 0xFF, 0x3D, 0x03, 0x86,
+  0x8B, 0xFF, 0x67, 0x00, 0x68, 0xFF, 0x9C, 0x02, 0x88, 0x05, 0xE9, 0xF8, 0x10, 0x00, 0x11, 0xF8,
+  0xF1, 0x09, 0x01, 0x82, 0x51, 0xFF, 0xAA, 0x02, 0x82, 0xAB, 0xFF, 0x5A, 0x01, 0x82, 0xB3, 0xFF,
+  0x4B, 0x02, 0x87, 0x4C, 0xFF, 0xB9, 0x00, 0x19, 0xFC, 0xE8, 0x04, 0x02, 0x86, 0x04, 0xE8, 0xFD,
+  0x1A, 0x79, 0xFF, 0x8D, 0x04, 0x85, 0x8E, 0xFF, 0x75, 0xDA, 0xFF, 0x2F, 0x04, 0x82, 0x2F, 0xFF,
+  0xD3, 0x82, 0xDD, 0xFF, 0x2C, 0x05, 0x85, 0x2C, 0xFF, 0xDC, 0x82, 0xFF, 0x85, 0x05, 0x85, 0x85,
+  0xFF, 0x81, 0x27, 0xFF, 0xDE, 0x05, 0x86, 0xDD, 0xFF, 0x26, 0x00, 0xCB, 0xFF, 0x38, 0x03, 0x82,
+  0x36, 0xFF, 0xCA, 0x01, 0x82, 0x70, 0xFF, 0x91, 0x03, 0x82, 0x8F, 0xFF, 0x6F, 0x01, 0x83, 0x17,
+  0xFC, 0xE7, 0x03, 0x01, 0x83, 0x02, 0xE5, 0xFC, 0x17, 0x02, 0x82, 0xB9, 0xFF, 0x43, 0x01, 0x82,
+  0x40, 0xFF, 0xB8, 0x03, 0x82, 0x5E, 0xFF, 0x9D, 0x01, 0x82, 0x99, 0xFF, 0x5D, 0x03, 0x87, 0x0C,
+  0xF5, 0xEF, 0x06, 0x04, 0xEC, 0xF5, 0x0C, 0x04, 0x85, 0xA4, 0xFF, 0x4F, 0x4A, 0xFF, 0xA3, 0x05,
+  0x85, 0x3F, 0xFF, 0xA8, 0xA2, 0xFF, 0x3B, 0x06, 0x83, 0xD9, 0xF5, 0xF2, 0xDC, 0x07, 0x80, 0x83,
+  0x41, 0x80, 0x84, 0x07, 0x80, 0x31, 0x41, 0x80, 0x30, 0x08, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09,
+  0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x04, 0x00, 0x46, 0x00, 0x45,
+  0x80, 0xE9, 0x04, 0x82, 0x26, 0xFF, 0x9E, 0x04, 0x82, 0x75, 0xFF, 0x50, 0x04, 0x82, 0xC3, 0xF7,
+  0x0B, 0x03, 0x82, 0x13, 0xFC, 0xB5, 0x04, 0x82, 0x5F, 0xFF, 0x67, 0x04, 0x82, 0xAD, 0xFE, 0x1A,
+  0x03, 0x82, 0x07, 0xF3, 0xCC, 0x04, 0x82, 0x49, 0xFF, 0x7E, 0x04, 0x82, 0x97, 0xFF, 0x30, 0x04,
+  0x81, 0xE3, 0xE1, 0x04, 0x82, 0x32, 0xFF, 0x94, 0x04, 0x82, 0x80, 0xFF, 0x47, 0x04, 0x82, 0xCE,
+  0xF2, 0x06, 0x03, 0x82, 0x1C, 0xFF, 0xAB, 0x04, 0x82, 0x6A, 0xFF, 0x5D, 0x04, 0x82, 0xB8, 0xFC,
+  0x13, 0x03, 0x82, 0x0C, 0xF8, 0xC2, 0x04, 0x82, 0x54, 0xFF, 0x74, 0x04, 0x82, 0xA2, 0xFF, 0x26,
+  0x04, 0x80, 0xEC, 0x4E, 0x81, 0x86, 0xFA, 0x42, 0x80, 0xF7, 0x45, 0x02, 0x41, 0x02, 0x41, 0x02,
+  0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02,
+  0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02,
+  0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x80, 0xF7, 0x43, 0x81, 0x88, 0xFA, 0x42, 0x82,
+  0xCE, 0xFF, 0x26, 0x07, 0x82, 0x69, 0xFF, 0x8A, 0x07, 0x83, 0x0E, 0xF5, 0xE9, 0x05, 0x07, 0x82,
+  0xA0, 0xFF, 0x54, 0x07, 0x82, 0x3B, 0xFF, 0xB8, 0x08, 0x82, 0xD5, 0xFD, 0x1F, 0x07, 0x82, 0x72,
+  0xFF, 0x82, 0x07, 0x83, 0x14, 0xF9, 0xE3, 0x03, 0x07, 0x82, 0xA8, 0xFF, 0x4B, 0x07, 0x82, 0x44,
+  0xFF, 0xB0, 0x07, 0x83, 0x01, 0xDD, 0xFB, 0x19, 0x07, 0x82, 0x7A, 0xFF, 0x79, 0x07, 0x83, 0x19,
+  0xFB, 0xDD, 0x01, 0x07, 0x82, 0xB1, 0xFF, 0x43, 0x07, 0x82, 0x4C, 0xFF, 0xA7, 0x07, 0x83, 0x03,
+  0xE4, 0xF8, 0x13, 0x07, 0x82, 0x83, 0xFF, 0x71, 0x07, 0x82, 0x20, 0xFD, 0xD5, 0x08, 0x82, 0xB9,
+  0xFF, 0x3A, 0x07, 0x82, 0x55, 0xFF, 0x9F, 0x07, 0x83, 0x05, 0xEA, 0xF5, 0x0E, 0x07, 0x82, 0x8B,
+  0xFF, 0x68, 0x07, 0x82, 0x27, 0xFF, 0xCD, 0x43, 0x81, 0xF2, 0x6E, 0x44, 0x80, 0xF5, 0x03, 0x41,
+  0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+  0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+  0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x46, 0x80, 0xF5, 0x43, 0x81,
+  0xF2, 0x71, 0x02, 0x82, 0x7A, 0xFF, 0x86, 0x04, 0x84, 0x09, 0xE9, 0xFF, 0xEF, 0x0D, 0x03, 0x84,
+  0x6E, 0xFF, 0xD3, 0xFF, 0x73, 0x02, 0x86, 0x05, 0xE2, 0xE5, 0x13, 0xE7, 0xE4, 0x05, 0x01, 0x93,
+  0x62, 0xFF, 0x69, 0x00, 0x6C, 0xFF, 0x60, 0x00, 0x02, 0xD9, 0xDD, 0x05, 0x00, 0x06, 0xE1, 0xD6,
+  0x01, 0x57, 0xFF, 0x5D, 0x02, 0x85, 0x63, 0xFF, 0x4D, 0xCF, 0xD4, 0x02, 0x02, 0x82, 0x04, 0xDA,
+  0xC4, 0x55, 0x97, 0xFF, 0xEC, 0x09, 0x02, 0xAE, 0xFF, 0x64, 0x00, 0x08, 0xC2, 0xD1, 0x82, 0x5D,
+  0xBE, 0xF3, 0x41, 0x82, 0xF4, 0xBC, 0x39, 0x46, 0x80, 0xEA, 0x41, 0x03, 0x43, 0x03, 0x41, 0x05,
+  0x41, 0x05, 0x41, 0x82, 0x03, 0x85, 0xF1, 0x44, 0x80, 0x7F, 0x46, 0x81, 0xEA, 0xFF, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x41, 0x85, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0x41, 0x80, 0xBD, 0x46, 0x85,
+  0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0x41, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41,
+  0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x85, 0x15, 0x3F, 0x7F, 0xD8, 0xED,
+  0x53, 0x46, 0x80, 0xD0, 0x41, 0x85, 0xE0, 0xA1, 0x61, 0x20, 0xFF, 0xF5, 0x41, 0x03, 0x43, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x02, 0x82, 0x04, 0xFF, 0xF3,
+  0x41, 0x01, 0x83, 0x04, 0x62, 0xFF, 0xB6, 0x45, 0x81, 0xF4, 0x2F, 0x43, 0x83, 0xF4, 0xB6, 0x2F,
+  0x00, 0x82, 0x0C, 0x94, 0xED, 0x41, 0x83, 0xF0, 0xA0, 0x10, 0x9A, 0x45, 0x82, 0xA0, 0xF0, 0xFF,
+  0x03, 0x40, 0x80, 0xF0, 0x41, 0x03, 0x43, 0x03, 0x43, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05,
+  0x41, 0x03, 0x43, 0x03, 0x41, 0x81, 0xF0, 0xFF, 0x03, 0x40, 0x81, 0xF0, 0xA1, 0x45, 0x83, 0xA0,
+  0x10, 0xA1, 0xF0, 0x41, 0x82, 0xF0, 0xA1, 0x10, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41,
+  0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x00, 0x82, 0x2F, 0xB6, 0xF3, 0x43,
+  0x81, 0x2F, 0xF4, 0x45, 0x83, 0xB6, 0xFF, 0x64, 0x04, 0x01, 0x41, 0x82, 0xF4, 0xFF, 0x04, 0x02,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x80, 0x04, 0x02,
+  0x41, 0x83, 0xE9, 0xFF, 0x62, 0x04, 0x01, 0x41, 0x80, 0x94, 0x46, 0x82, 0x0A, 0x95, 0xE9, 0x44,
+  0x82, 0x15, 0xB3, 0xF5, 0x41, 0x83, 0xF5, 0xB2, 0x15, 0xA1, 0x45, 0x82, 0xA0, 0xEF, 0xFF, 0x03,
+  0x40, 0x80, 0xEF, 0x41, 0x03, 0x43, 0x03, 0x50, 0x80, 0xC6, 0x41, 0x05, 0x41, 0x05, 0x41, 0x03,
+  0x43, 0x03, 0x41, 0x81, 0xEF, 0xFF, 0x03, 0x41, 0x80, 0xA2, 0x45, 0x83, 0xC6, 0x15, 0xB4, 0xF6,
+  0x41, 0x82, 0xF2, 0xAA, 0x1A, 0x01, 0x83, 0x08, 0x8D, 0xED, 0xFF, 0x01, 0x80, 0x8E, 0x42, 0x01,
+  0x81, 0xED, 0xFF, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x01,
+  0x4B, 0x01, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03,
+  0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x01, 0x82, 0x0A, 0x94, 0xE8, 0x42, 0x82,
+  0xE8, 0xE8, 0x94, 0x46, 0x83, 0xE9, 0xFF, 0x62, 0x04, 0x01, 0x43, 0x80, 0x04, 0x02, 0x43, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x82, 0xF4, 0xFF, 0x04, 0x02,
+  0x41, 0x83, 0xB7, 0xFF, 0x62, 0x04, 0x01, 0x41, 0x81, 0x2F, 0xF4, 0x45, 0x00, 0x82, 0x2F, 0xB7,
+  0xF4, 0x43, 0x05, 0x41, 0x05, 0x41, 0x81, 0xF7, 0xFF, 0x03, 0x41, 0x81, 0xFD, 0xFF, 0x03, 0x40,
+  0x81, 0xEC, 0xD2, 0x45, 0x83, 0x95, 0x1B, 0xB6, 0xF7, 0x41, 0x82, 0xF5, 0xAD, 0x0F, 0x41, 0x05,
+  0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05,
+  0x41, 0x00, 0x84, 0x33, 0x91, 0xDE, 0xEF, 0x5C, 0x41, 0x80, 0xD1, 0x43, 0x80, 0xD9, 0x42, 0x84,
+  0xDC, 0x85, 0x2C, 0xFF, 0xF9, 0x41, 0x80, 0x34, 0x02, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x80, 0x08,
+  0x41, 0x81, 0x04, 0x08, 0x41, 0x81, 0x04, 0x08, 0x41, 0x80, 0x04, 0x0C, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x00, 0x00, 0x80, 0x08, 0x41, 0x82, 0x04, 0x00, 0x08,
+  0x41, 0x82, 0x04, 0x00, 0x08, 0x41, 0x80, 0x04, 0x10, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41,
+  0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41,
+  0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x40, 0x81, 0xF5, 0x00, 0x42,
+  0x86, 0xB1, 0x00, 0xFF, 0xE6, 0x9C, 0x14, 0x00, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05,
+  0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x02, 0x82, 0x54, 0xFF, 0xB9,
+  0x41, 0x01, 0x83, 0x14, 0xE9, 0xF7, 0x23, 0x41, 0x01, 0x83, 0xA9, 0xFF, 0x7B, 0x00, 0x41, 0x00,
+  0x84, 0x52, 0xFF, 0xD6, 0x06, 0x00, 0x41, 0x83, 0x13, 0xE8, 0xFF, 0x3F, 0x01, 0x41, 0x82, 0xA6,
+  0xFF, 0x9E, 0x02, 0x43, 0x80, 0x24, 0x02, 0x41, 0x82, 0xC7, 0xFF, 0x88, 0x02, 0x41, 0x83, 0x35,
+  0xFE, 0xF6, 0x1A, 0x01, 0x41, 0x00, 0x82, 0x9E, 0xFF, 0x99, 0x01, 0x41, 0x00, 0x84, 0x17, 0xF1,
+  0xFB, 0x26, 0x00, 0x41, 0x01, 0x83, 0x74, 0xFF, 0xAA, 0x00, 0x41, 0x01, 0x83, 0x05, 0xD9, 0xFE,
+  0x33, 0x41, 0x02, 0x82, 0x4A, 0xFF, 0xBB, 0x6D, 0x41, 0x00, 0x8A, 0x2B, 0x93, 0xDF, 0xEC, 0x35,
+  0x00, 0x30, 0x91, 0xDD, 0xEF, 0x5C, 0x41, 0x80, 0xB8, 0x41, 0x83, 0xF5, 0xFF, 0xCB, 0xC4, 0x41,
+  0x82, 0xF5, 0xFF, 0xD9, 0x42, 0x82, 0xDC, 0x73, 0x10, 0x42, 0x84, 0xDC, 0x73, 0x10, 0xFF, 0xF9,
+  0x41, 0x81, 0x4A, 0x01, 0x01, 0x41, 0x81, 0x4A, 0x01, 0x01, 0x43, 0x03, 0x41, 0x03, 0x43, 0x03,
+  0x41, 0x03, 0x43, 0x03, 0x41, 0x03, 0x43, 0x03, 0x41, 0x03, 0x43, 0x03, 0x41, 0x03, 0x43, 0x03,
+  0x41, 0x03, 0x43, 0x03, 0x41, 0x03, 0x43, 0x03, 0x41, 0x03, 0x43, 0x03, 0x41, 0x03, 0x43, 0x03,
+  0x41, 0x03, 0x41, 0x41, 0x85, 0x0F, 0x57, 0xA4, 0xED, 0xE5, 0x49, 0x41, 0x80, 0xF9, 0x43, 0x80,
+  0xD3, 0x41, 0x85, 0xF5, 0xB5, 0x6D, 0x24, 0xFF, 0xF8, 0x41, 0x80, 0x07, 0x02, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x41, 0x82, 0x0F, 0xAC, 0xF4, 0x41, 0x83, 0xF4, 0xAC, 0x0F, 0x96, 0x45, 0x82, 0x95, 0xED,
+  0xFF, 0x03, 0x40, 0x80, 0xEC, 0x41, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x81, 0xED, 0xFF, 0x03, 0x40, 0x81, 0xEC, 0x96, 0x45, 0x83,
+  0x95, 0x0F, 0xAD, 0xF5, 0x41, 0x82, 0xF5, 0xAD, 0x0F, 0x41, 0x85, 0x07, 0x3E, 0x86, 0xDB, 0xEF,
+  0x5C, 0x41, 0x80, 0xF7, 0x43, 0x80, 0xD9, 0x41, 0x85, 0xF5, 0xB5, 0x6D, 0x24, 0xFF, 0xF9, 0x41,
+  0x80, 0x07, 0x02, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x02, 0x82, 0x04, 0xFF, 0xEE, 0x41, 0x01, 0x83, 0x04, 0x62, 0xFF, 0x9C, 0x45, 0x81, 0xD8, 0x13,
+  0x43, 0x83, 0xEF, 0x9D, 0x13, 0x00, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05,
+  0x41, 0x05, 0x82, 0x0A, 0x94, 0xE8, 0x44, 0x80, 0x94, 0x46, 0x83, 0xE9, 0xFF, 0x6A, 0x08, 0x01,
+  0x43, 0x80, 0x03, 0x02, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x80,
+  0x01, 0x02, 0x41, 0x82, 0xF4, 0xFF, 0x24, 0x02, 0x41, 0x85, 0xB7, 0xFF, 0xBD, 0x29, 0x04, 0x00,
+  0x41, 0x81, 0x2F, 0xF4, 0x45, 0x00, 0x82, 0x2F, 0xB7, 0xF4, 0x43, 0x05, 0x41, 0x05, 0x41, 0x05,
+  0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x41, 0x85, 0x14, 0x6D, 0xBE, 0xF1, 0xE3, 0x37, 0x41,
+  0x80, 0xFA, 0x43, 0x80, 0xBD, 0x41, 0x85, 0xC4, 0x8D, 0x55, 0x1C, 0xFF, 0xF4, 0x41, 0x03, 0x43,
+  0x03, 0x43, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41,
+  0x05, 0x41, 0x05, 0x82, 0x0F, 0x94, 0xEB, 0x41, 0x83, 0xEA, 0x93, 0x0E, 0xAC, 0x45, 0x82, 0xAB,
+  0xF5, 0xFF, 0x03, 0x40, 0x80, 0xF4, 0x41, 0x03, 0x41, 0x83, 0xE4, 0xFF, 0x74, 0x01, 0x03, 0x84,
+  0x49, 0xF3, 0xFF, 0xB4, 0x13, 0x03, 0x84, 0x27, 0xD2, 0xFF, 0xE3, 0x3C, 0x03, 0x85, 0x09, 0x9A,
+  0xFF, 0xFC, 0x79, 0x01, 0x03, 0x83, 0x59, 0xF2, 0xFF, 0x93, 0x41, 0x02, 0x82, 0x26, 0xFF, 0xF4,
+  0x41, 0x03, 0x41, 0x81, 0xF5, 0xFF, 0x03, 0x40, 0x81, 0xF4, 0xAD, 0x45, 0x83, 0xAC, 0x0F, 0x96,
+  0xED, 0x41, 0x82, 0xED, 0x96, 0x0F, 0x01, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+  0x01, 0x4B, 0x01, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+  0x03, 0x41, 0x03, 0x41, 0x03, 0x81, 0xF3, 0xFF, 0x03, 0x80, 0xAD, 0x42, 0x01, 0x83, 0x16, 0xA8,
+  0xF1, 0xFF, 0x41, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x85, 0xF4, 0xFF, 0x0B, 0x23, 0x3B, 0x53,
+  0x41, 0x80, 0xB7, 0x46, 0x85, 0x2D, 0xE1, 0xF8, 0xE4, 0xCA, 0xAE, 0x41, 0x82, 0xE5, 0xFF, 0x19,
+  0x01, 0x85, 0x19, 0xFF, 0xE4, 0xAE, 0xFF, 0x4B, 0x01, 0x85, 0x4C, 0xFF, 0xAD, 0x77, 0xFF, 0x7D,
+  0x01, 0x85, 0x7E, 0xFF, 0x76, 0x40, 0xFF, 0xAF, 0x01, 0x85, 0xB0, 0xFF, 0x3F, 0x0C, 0xFD, 0xE1,
+  0x01, 0x89, 0xE2, 0xFC, 0x0C, 0x00, 0xD2, 0xFF, 0x13, 0x13, 0xFF, 0xD1, 0x01, 0x85, 0x9C, 0xFF,
+  0x45, 0x46, 0xFF, 0x9A, 0x01, 0x85, 0x65, 0xFF, 0x77, 0x78, 0xFF, 0x64, 0x01, 0x85, 0x2E, 0xFF,
+  0xA9, 0xAA, 0xFF, 0x2D, 0x01, 0x85, 0x03, 0xF4, 0xDB, 0xDC, 0xF3, 0x03, 0x02, 0x83, 0xC0, 0xFE,
+  0xFE, 0xBF, 0x03, 0x80, 0x89, 0x41, 0x80, 0x88, 0x03, 0x80, 0x52, 0x41, 0x80, 0x51, 0x03, 0x80,
+  0x1B, 0x41, 0x80, 0x1B, 0x01, 0x82, 0xE5, 0xFF, 0x19, 0x01, 0x80, 0x19, 0x41, 0x80, 0x19, 0x01,
+  0x85, 0x19, 0xFF, 0xE4, 0xAE, 0xFF, 0x4C, 0x01, 0x80, 0x4D, 0x41, 0x80, 0x4C, 0x01, 0x85, 0x4D,
+  0xFF, 0xAD, 0x77, 0xFF, 0x7F, 0x01, 0x80, 0x80, 0x41, 0x80, 0x7F, 0x01, 0x85, 0x80, 0xFF, 0x76,
+  0x40, 0xFF, 0xB2, 0x01, 0x80, 0xB3, 0x41, 0x80, 0xB2, 0x01, 0x85, 0xB3, 0xFF, 0x3F, 0x0C, 0xFD,
+  0xE6, 0x01, 0x83, 0xE6, 0xE5, 0xE6, 0xE6, 0x01, 0x8F, 0xE6, 0xFC, 0x0C, 0x00, 0xD2, 0xFF, 0x19,
+  0x19, 0xFF, 0xB2, 0xB3, 0xFF, 0x19, 0x19, 0xFF, 0xD1, 0x01, 0x8B, 0x9C, 0xFF, 0x4C, 0x4D, 0xFF,
+  0x7F, 0x80, 0xFF, 0x4C, 0x4D, 0xFF, 0x9A, 0x01, 0x8B, 0x65, 0xFF, 0x7F, 0x80, 0xFF, 0x4C, 0x4D,
+  0xFF, 0x7F, 0x80, 0xFF, 0x64, 0x01, 0x8B, 0x2E, 0xFF, 0xB2, 0xB3, 0xFF, 0x19, 0x1A, 0xFF, 0xB2,
+  0xB3, 0xFF, 0x2D, 0x01, 0x84, 0x03, 0xF4, 0xE6, 0xE6, 0xE5, 0x01, 0x84, 0xE6, 0xE6, 0xE6, 0xF3,
+  0x03, 0x02, 0x80, 0xC0, 0x41, 0x80, 0xB2, 0x01, 0x80, 0xB3, 0x41, 0x80, 0xBF, 0x03, 0x80, 0x89,
+  0x41, 0x80, 0x7F, 0x01, 0x80, 0x80, 0x41, 0x80, 0x88, 0x03, 0x80, 0x52, 0x41, 0x80, 0x4C, 0x01,
+  0x80, 0x4D, 0x41, 0x80, 0x51, 0x03, 0x80, 0x1B, 0x41, 0x80, 0x19, 0x01, 0x80, 0x1A, 0x41, 0x80,
+  0x1B, 0x01, 0x00, 0x82, 0xC1, 0xFF, 0x41, 0x02, 0x86, 0x41, 0xFF, 0xC3, 0x00, 0x42, 0xFF, 0xC4,
+  0x02, 0x82, 0xC5, 0xFF, 0x39, 0x01, 0x86, 0xC3, 0xFF, 0x49, 0x00, 0x4A, 0xFF, 0xAD, 0x02, 0x86,
+  0x44, 0xFF, 0xCB, 0x01, 0xCC, 0xFB, 0x27, 0x03, 0x84, 0xC5, 0xFF, 0x9E, 0xFF, 0x98, 0x04, 0x80,
+  0x46, 0x41, 0x81, 0xF5, 0x19, 0x05, 0x82, 0xC7, 0xFF, 0xA4, 0x06, 0x83, 0xC7, 0xFF, 0xEE, 0x0C,
+  0x04, 0x84, 0x49, 0xFF, 0xF4, 0xFF, 0x71, 0x04, 0x85, 0xC7, 0xFC, 0x44, 0xFC, 0xE3, 0x05, 0x02,
+  0x86, 0x49, 0xFF, 0xA5, 0x00, 0xA6, 0xFF, 0x5F, 0x02, 0x8B, 0xC7, 0xFF, 0x2E, 0x00, 0x2E, 0xFF,
+  0xD5, 0x01, 0x00, 0x49, 0xFF, 0xB4, 0x02, 0x86, 0xB5, 0xFF, 0x4D, 0x07, 0xC8, 0xFF, 0x3C, 0x02,
+  0x82, 0x3C, 0xFF, 0xC4, 0x82, 0xE5, 0xFF, 0x14, 0x01, 0x85, 0x15, 0xFF, 0xE4, 0xAE, 0xFF, 0x3E,
+  0x01, 0x85, 0x41, 0xFF, 0xAD, 0x77, 0xFF, 0x68, 0x01, 0x85, 0x6D, 0xFF, 0x76, 0x40, 0xFF, 0x92,
+  0x01, 0x85, 0x98, 0xFF, 0x3F, 0x0C, 0xFD, 0xBC, 0x01, 0x85, 0xC3, 0xFC, 0x0C, 0x00, 0xD2, 0xE6,
+  0x01, 0x81, 0xEE, 0xD1, 0x01, 0x85, 0x9C, 0xFF, 0x10, 0x1A, 0xFF, 0x9A, 0x01, 0x85, 0x65, 0xFF,
+  0x3A, 0x45, 0xFF, 0x64, 0x01, 0x85, 0x2E, 0xFF, 0x64, 0x71, 0xFF, 0x2D, 0x01, 0x85, 0x03, 0xF4,
+  0x8E, 0x9C, 0xF3, 0x03, 0x02, 0x83, 0xC0, 0xB8, 0xC7, 0xBF, 0x03, 0x83, 0x89, 0xE3, 0xF1, 0x88,
+  0x03, 0x80, 0x52, 0x41, 0x80, 0x51, 0x03, 0x80, 0x1B, 0x41, 0x80, 0x1B, 0x03, 0x82, 0x15, 0xFF,
+  0xEA, 0x04, 0x82, 0x40, 0xFF, 0xBF, 0x04, 0x82, 0x6B, 0xFF, 0x94, 0x04, 0x82, 0x96, 0xFF, 0x6A,
+  0x04, 0x82, 0xC0, 0xFF, 0x3F, 0x04, 0x82, 0xEB, 0xFF, 0x15, 0x02, 0x00, 0x46, 0x00, 0x45, 0x80,
+  0xD1, 0x04, 0x82, 0x90, 0xFF, 0x4C, 0x03, 0x82, 0x1D, 0xF8, 0xC4, 0x04, 0x82, 0x9C, 0xFF, 0x3D,
+  0x03, 0x82, 0x26, 0xFC, 0xB6, 0x04, 0x82, 0xA9, 0xFE, 0x31, 0x03, 0x82, 0x30, 0xFE, 0xA8, 0x04,
+  0x82, 0xB6, 0xFB, 0x25, 0x03, 0x82, 0x3C, 0xFF, 0x99, 0x04, 0x82, 0xC2, 0xF7, 0x1B, 0x03, 0x82,
+  0x4A, 0xFF, 0x8B, 0x04, 0x80, 0xCE, 0x4E, 0x01, 0x83, 0x03, 0x78, 0xDD, 0xFE, 0x41, 0x01, 0x80,
+  0x7B, 0x44, 0x01, 0x85, 0xE0, 0xFF, 0x8E, 0x1A, 0x03, 0x09, 0x01, 0x41, 0x80, 0x08, 0x04, 0x41,
+  0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x04, 0x82, 0x01, 0xFF, 0xFD, 0x04,
+  0x82, 0x83, 0xFF, 0xD2, 0x03, 0x83, 0x59, 0xFF, 0xF9, 0x44, 0x03, 0x82, 0xED, 0xFF, 0x8F, 0x04,
+  0x83, 0x4E, 0xFC, 0xFC, 0x51, 0x04, 0x82, 0x67, 0xFF, 0xDE, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41,
+  0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x80, 0x05, 0x04, 0x85, 0xE9, 0xFF,
+  0x84, 0x16, 0x01, 0x07, 0x01, 0x80, 0x8D, 0x44, 0x01, 0x83, 0x06, 0x84, 0xE1, 0xFE, 0x41, 0x77,
+  0x41, 0x83, 0xFE, 0xDD, 0x75, 0x02, 0x01, 0x81, 0xFD, 0xF7, 0x42, 0x80, 0x78, 0x03, 0x83, 0x0E,
+  0x85, 0xFF, 0xDF, 0x04, 0x80, 0x08, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05,
+  0x41, 0x05, 0x41, 0x05, 0x82, 0xFC, 0xFF, 0x01, 0x04, 0x82, 0xC5, 0xFF, 0x82, 0x04, 0x83, 0x27,
+  0xDF, 0xFF, 0x58, 0x04, 0x82, 0x2B, 0xF9, 0xED, 0x03, 0x83, 0x34, 0xE6, 0xFC, 0x4E, 0x03, 0x82,
+  0xD5, 0xFF, 0x66, 0x04, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05,
+  0x41, 0x04, 0x80, 0x05, 0x41, 0x03, 0x83, 0x0B, 0x7B, 0xFF, 0xE8, 0x01, 0x81, 0xFB, 0xF6, 0x42,
+  0x80, 0x89, 0x01, 0x41, 0x83, 0xFE, 0xE0, 0x7F, 0x05, 0x01, 0x84, 0xBF, 0xF0, 0xC3, 0x77, 0x24,
+  0x02, 0x46, 0x82, 0xD0, 0x7D, 0x29, 0x43, 0x82, 0x2A, 0x7E, 0xD1, 0x46, 0x02, 0x84, 0x25, 0x78,
+  0xC3, 0xF0, 0xBF, 0x00, 0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x0D, 0x81, 0xA4, 0x9E, 0x01, 0x81,
+  0xAA, 0xA5, 0x01, 0x81, 0xB0, 0xAB, 0x01, 0x81, 0xB6, 0xB1, 0x01, 0x81, 0xBC, 0xB7, 0x01, 0x81,
+  0xC2, 0xBD, 0x01, 0x81, 0xC8, 0xC3, 0x01, 0x81, 0xCE, 0xC9, 0x01, 0x81, 0xD4, 0xCF, 0x01, 0x81,
+  0xDB, 0xD6, 0x01, 0x81, 0xE1, 0xDC, 0x01, 0x81, 0xE7, 0xE2, 0x01, 0x81, 0xED, 0xE8, 0x01, 0x81,
+  0xF3, 0xEE, 0x01, 0x81, 0xF9, 0xF4, 0x01, 0x83, 0xFE, 0xFA, 0x00, 0x05, 0x41, 0x80, 0x01, 0x02,
+  0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x02, 0x82, 0x10, 0xA0, 0xF0, 0x41, 0x83, 0xF0, 0xA0,
+  0x10, 0xA1, 0x45, 0x83, 0xA0, 0xF0, 0xFF, 0x00, 0x41, 0x00, 0x40, 0x80, 0xF0, 0x41, 0x00, 0x41,
+  0x00, 0x43, 0x00, 0x41, 0x00, 0x43, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41,
+  0x02, 0x41, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41, 0x00, 0x43, 0x00, 0x41,
+  0x00, 0x41, 0x82, 0xF1, 0xFF, 0x00, 0x41, 0x00, 0x40, 0x81, 0xF0, 0xA4, 0x45, 0x83, 0xA2, 0x13,
+  0xA9, 0xF6, 0x41, 0x82, 0xF5, 0xA9, 0x12, 0x01, 0x80, 0x01, 0x41, 0x80, 0x01, 0x04, 0x41, 0x05,
+  0x41, 0x05, 0x41, 0x02, 0x01, 0x82, 0x0E, 0xA1, 0xF2, 0x41, 0x82, 0xF2, 0x9F, 0x0C, 0x01, 0x80,
+  0xA2, 0x45, 0x80, 0xA0, 0x01, 0x81, 0xF3, 0xFF, 0x03, 0x40, 0x80, 0xF2, 0x01, 0x41, 0x03, 0x41,
+  0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x07, 0x41,
+  0x07, 0x41, 0x07, 0x41, 0x05, 0x47, 0x01, 0x47, 0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+  0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x05, 0x53, 0x82, 0x1F, 0xC0, 0x22, 0x07, 0x86,
+  0x22, 0xC0, 0x1F, 0xBE, 0xFF, 0xE3, 0x25, 0x05, 0x88, 0x24, 0xE3, 0xFF, 0xBD, 0x1A, 0xD6, 0xFF,
+  0xE6, 0x29, 0x03, 0x87, 0x27, 0xE5, 0xFF, 0xD6, 0x1A, 0x00, 0x14, 0xCD, 0x47, 0x81, 0xCE, 0x15,
+  0x02, 0x80, 0x0E, 0x47, 0x80, 0x0F, 0x04, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41,
+  0x03, 0x41, 0x05, 0x41, 0x01, 0x81, 0x01, 0x02, 0x41, 0x04, 0x80, 0x0E, 0x47, 0x80, 0x0D, 0x02,
+  0x81, 0x14, 0xCC, 0x47, 0x87, 0xCA, 0x12, 0x00, 0x1A, 0xD5, 0xFF, 0xE5, 0x27, 0x03, 0x88, 0x2A,
+  0xE7, 0xFF, 0xD4, 0x19, 0xBE, 0xFF, 0xE3, 0x24, 0x05, 0x86, 0x26, 0xE4, 0xFF, 0xBD, 0x20, 0xC1,
+  0x22, 0x07, 0x82, 0x22, 0xC1, 0x1F, 0x82, 0xD4, 0xFF, 0x2B, 0x04, 0x85, 0x20, 0xFF, 0xE2, 0x78,
+  0xFF, 0x82, 0x04, 0x85, 0x62, 0xFF, 0x96, 0x1C, 0xFD, 0xD9, 0x04, 0x86, 0xA4, 0xFF, 0x49, 0x00,
+  0xBD, 0xFF, 0x31, 0x03, 0x86, 0xE5, 0xF5, 0x08, 0x00, 0x5F, 0xFF, 0x88, 0x02, 0x82, 0x27, 0xFF,
+  0xB0, 0x01, 0x82, 0x0B, 0xF4, 0xDE, 0x02, 0x82, 0x68, 0xFF, 0x63, 0x02, 0x82, 0xA1, 0xFF, 0x36,
+  0x01, 0x82, 0xAA, 0xFE, 0x18, 0x02, 0x86, 0x43, 0xFF, 0x8E, 0x00, 0x01, 0xEA, 0xCA, 0x03, 0x86,
+  0x02, 0xE1, 0xE3, 0x01, 0x2D, 0xFF, 0x7E, 0x02, 0x80, 0xF0, 0x42, 0x81, 0x3C, 0x6E, 0x42, 0x82,
+  0xEC, 0x00, 0xF0, 0x42, 0x81, 0x93, 0xAF, 0x42, 0x80, 0xEC, 0x03, 0x83, 0xCA, 0xE8, 0xEE, 0xC0,
+  0x06, 0x80, 0x84, 0x41, 0x80, 0x7B, 0x06, 0x80, 0x3F, 0x41, 0x80, 0x36, 0x03, 0x80, 0xF0, 0x47,
+  0x82, 0xEC, 0x00, 0xF0, 0x47, 0x80, 0xEC, 0x04, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08,
+  0x41, 0x08, 0x41, 0x08, 0x41, 0x03, 0x55, 0x0B, 0x57, 0x82, 0x0E, 0xA4, 0xF2, 0x44, 0x83, 0xF2,
+  0xA5, 0x0E, 0xA0, 0x48, 0x82, 0x9F, 0xF3, 0xFF, 0x06, 0x40, 0x80, 0xF2, 0x41, 0x06, 0x43, 0x06,
+  0x41, 0x84, 0xD1, 0xFF, 0xC8, 0x58, 0x04, 0x05, 0x86, 0x1A, 0xA0, 0xFC, 0xFF, 0xE4, 0x79, 0x13,
+  0x05, 0x81, 0x49, 0xF9, 0x41, 0x82, 0xF6, 0x9A, 0x2B, 0x01, 0x86, 0x10, 0x93, 0xFA, 0xFF, 0xEB,
+  0xB3, 0xF2, 0x41, 0x8E, 0xBA, 0x27, 0xC2, 0xFF, 0xAA, 0x4E, 0x05, 0x00, 0x08, 0x54, 0xAC, 0xFF,
+  0xD7, 0xFD, 0xFF, 0x06, 0x43, 0x06, 0x43, 0x06, 0x40, 0x84, 0xFD, 0xDA, 0xFF, 0xA0, 0x38, 0x01,
+  0x86, 0x03, 0x47, 0xA4, 0xFF, 0xB9, 0x28, 0xBA, 0x41, 0x86, 0xD1, 0x96, 0xE6, 0xFF, 0xEC, 0x7C,
+  0x0A, 0x01, 0x82, 0x2B, 0x9B, 0xF6, 0x41, 0x81, 0xD1, 0x18, 0x05, 0x86, 0x13, 0x7A, 0xE4, 0xFF,
+  0xEF, 0x88, 0x11, 0x05, 0x84, 0x04, 0x59, 0xC8, 0xFF, 0xC9, 0x41, 0x06, 0x43, 0x06, 0x41, 0x81,
+  0xF3, 0xFF, 0x06, 0x40, 0x81, 0xF3, 0xA1, 0x48, 0x83, 0xA0, 0x0F, 0xA6, 0xF3, 0x44, 0x82, 0xF3,
+  0xA7, 0x0F, 0x41, 0x01, 0x43, 0x01, 0x43, 0x01, 0x41, 0x82, 0x1C, 0xAC, 0xF1, 0x48, 0x84, 0xF1,
+  0xAC, 0x1C, 0xB9, 0xFF, 0x0A, 0x40, 0x82, 0xB8, 0xF6, 0xFF, 0x0A, 0x40, 0x80, 0xF5, 0x41, 0x0A,
+  0x43, 0x0A, 0x43, 0x01, 0x81, 0xBD, 0xFE, 0x42, 0x81, 0xFE, 0xC0, 0x01, 0x43, 0x01, 0x41, 0x02,
+  0x41, 0x01, 0x43, 0x01, 0x41, 0x02, 0x41, 0x01, 0x43, 0x01, 0x41, 0x02, 0x41, 0x01, 0x43, 0x01,
+  0x41, 0x06, 0x43, 0x01, 0x41, 0x06, 0x43, 0x01, 0x41, 0x06, 0x43, 0x01, 0x41, 0x06, 0x43, 0x01,
+  0x41, 0x06, 0x43, 0x01, 0x41, 0x02, 0x41, 0x01, 0x43, 0x01, 0x41, 0x02, 0x41, 0x01, 0x43, 0x01,
+  0x41, 0x02, 0x41, 0x01, 0x43, 0x01, 0x81, 0xBF, 0xFE, 0x42, 0x81, 0xFE, 0xC6, 0x01, 0x43, 0x0A,
+  0x43, 0x0A, 0x41, 0x81, 0xF6, 0xFF, 0x0A, 0x40, 0x82, 0xF5, 0xBA, 0xFF, 0x0A, 0x40, 0x83, 0xB8,
+  0x1C, 0xAD, 0xF2, 0x48, 0x82, 0xF2, 0xAD, 0x1C, 0x87, 0x1D, 0xB7, 0xF2, 0xFF, 0xF6, 0xC3, 0x2A,
+  0xAB, 0x44, 0x83, 0xC3, 0xDE, 0xFF, 0x20, 0x01, 0x40, 0x83, 0xF6, 0xE8, 0xFF, 0x20, 0x01, 0x41,
+  0x04, 0x41, 0x82, 0x2A, 0xC2, 0xF6, 0x43, 0x80, 0xC4, 0x45, 0x81, 0xF7, 0xFF, 0x02, 0x41, 0x81,
+  0xF8, 0xFF, 0x02, 0x41, 0x84, 0xCA, 0xFF, 0xF1, 0xF5, 0xF9, 0x41, 0x84, 0x33, 0xD4, 0xFE, 0xEF,
+  0xC4, 0x41, 0x01, 0x80, 0x06, 0x03, 0x86, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x46, 0x86,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x02, 0x82, 0x62, 0xFF, 0xB4, 0x01, 0x82, 0x62, 0xFF,
+  0xB4, 0x01, 0x92, 0x2F, 0xF6, 0xE3, 0x13, 0x00, 0x2F, 0xF6, 0xE3, 0x13, 0x00, 0x0E, 0xDB, 0xFC,
+  0x3D, 0x00, 0x0E, 0xDB, 0xFC, 0x3D, 0x01, 0x82, 0xAD, 0xFF, 0x7B, 0x01, 0x82, 0xAD, 0xFF, 0x7B,
+  0x01, 0x88, 0x73, 0xFF, 0xBB, 0x02, 0x00, 0x73, 0xFF, 0xBB, 0x02, 0x01, 0x82, 0xF6, 0xFF, 0x2E,
+  0x01, 0x82, 0xF6, 0xFF, 0x2E, 0x02, 0x88, 0x73, 0xFF, 0xB8, 0x01, 0x00, 0x73, 0xFF, 0xB8, 0x01,
+  0x02, 0x82, 0xAE, 0xFF, 0x74, 0x01, 0x82, 0xAE, 0xFF, 0x74, 0x02, 0x88, 0x0F, 0xDB, 0xFA, 0x33,
+  0x00, 0x0F, 0xDB, 0xFA, 0x33, 0x02, 0x88, 0x2F, 0xF7, 0xDB, 0x0C, 0x00, 0x2F, 0xF7, 0xDB, 0x0C,
+  0x02, 0x82, 0x62, 0xFF, 0xA2, 0x01, 0x82, 0x62, 0xFF, 0xA2, 0x53, 0x07, 0x41, 0x07, 0x41, 0x07,
+  0x41, 0x07, 0x41, 0x53, 0x82, 0x1C, 0xB8, 0xF5, 0x48, 0x84, 0xF5, 0xB8, 0x1C, 0xAD, 0xFF, 0x0A,
+  0x40, 0x82, 0xAC, 0xF2, 0xFF, 0x0A, 0x40, 0x80, 0xF1, 0x41, 0x0A, 0x43, 0x0A, 0x43, 0x01, 0x44,
+  0x81, 0xFE, 0xBE, 0x01, 0x43, 0x01, 0x41, 0x02, 0x41, 0x01, 0x43, 0x01, 0x41, 0x02, 0x41, 0x01,
+  0x43, 0x01, 0x41, 0x02, 0x41, 0x01, 0x43, 0x01, 0x41, 0x02, 0x41, 0x01, 0x43, 0x01, 0x41, 0x02,
+  0x41, 0x01, 0x43, 0x01, 0x41, 0x80, 0xD0, 0x41, 0x81, 0xF7, 0xA3, 0x01, 0x43, 0x01, 0x41, 0x82,
+  0x6B, 0xFF, 0x40, 0x03, 0x43, 0x01, 0x41, 0x82, 0x0B, 0xEE, 0xC2, 0x03, 0x43, 0x01, 0x41, 0x00,
+  0x82, 0x8A, 0xFF, 0x43, 0x02, 0x43, 0x01, 0x41, 0x00, 0x82, 0x1D, 0xFB, 0xC5, 0x02, 0x43, 0x01,
+  0x41, 0x01, 0x82, 0xA9, 0xFF, 0x46, 0x01, 0x43, 0x01, 0x41, 0x01, 0x82, 0x38, 0xFF, 0xC4, 0x01,
+  0x43, 0x0A, 0x43, 0x0A, 0x41, 0x81, 0xF2, 0xFF, 0x0A, 0x40, 0x82, 0xF1, 0xAD, 0xFF, 0x0A, 0x40,
+  0x83, 0xAC, 0x1C, 0xBA, 0xF6, 0x48, 0x82, 0xF6, 0xB9, 0x1C, 0x4B, 0x88, 0x37, 0xCF, 0xFA, 0xFF,
+  0xFA, 0xCF, 0x37, 0xD1, 0xFF, 0x02, 0x40, 0x82, 0xCF, 0xFB, 0xFF, 0x02, 0x40, 0x80, 0xFA, 0x41,
+  0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x41, 0x81, 0xFB, 0xFF, 0x02, 0x40, 0x82,
+  0xFA, 0xD1, 0xFF, 0x02, 0x40, 0x87, 0xCF, 0x38, 0xD0, 0xFA, 0xFF, 0xFA, 0xD0, 0x37, 0x03, 0x41,
+  0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x04, 0x80, 0xF8, 0x48, 0x00, 0x80, 0xF8, 0x48, 0x04, 0x41,
+  0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x0F, 0x49, 0x80, 0x10, 0x49, 0x80, 0x10, 0x09, 0xED, 0xFF,
+  0x98, 0x65, 0xFF, 0xB0, 0x03, 0xD1, 0xC5, 0x09, 0x00, 0x41, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x80, 0x0F,
+  0x02, 0x43, 0x83, 0x8B, 0x0D, 0x25, 0xA0, 0x4B, 0x84, 0xBC, 0xF5, 0xD6, 0x5E, 0xFC, 0x42, 0x05,
+  0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x82, 0x18, 0xB1, 0xF4, 0x48, 0x80, 0xB2, 0x4A,
+  0x80, 0xF5, 0x43, 0x04, 0x46, 0x04, 0x46, 0x04, 0x46, 0x04, 0x46, 0x04, 0x46, 0x04, 0x46, 0x04,
+  0x46, 0x04, 0x46, 0x04, 0x41, 0x80, 0xF5, 0x43, 0x04, 0x41, 0x80, 0xB3, 0x4A, 0x82, 0x1A, 0xB3,
+  0xF5, 0x48, 0x04, 0x41, 0x02, 0x41, 0x04, 0x41, 0x02, 0x41, 0x04, 0x41, 0x02, 0x41, 0x04, 0x41,
+  0x02, 0x41, 0x04, 0x41, 0x02, 0x41, 0x04, 0x41, 0x02, 0x41, 0x04, 0x41, 0x02, 0x41, 0x04, 0x41,
+  0x02, 0x41, 0x04, 0x41, 0x02, 0x41, 0x45, 0x01, 0x81, 0xF3, 0x9C, 0x03, 0x83, 0xBE, 0xF6, 0x9C,
+  0x22, 0x41, 0x83, 0x08, 0x64, 0xFF, 0xDF, 0x41, 0x01, 0x41, 0x80, 0xC0, 0x43, 0x80, 0xBF, 0x87,
+  0x2A, 0xC3, 0xF6, 0xFF, 0xF6, 0xC3, 0x2A, 0xC4, 0x44, 0x82, 0xC3, 0xF7, 0xFF, 0x02, 0x40, 0x80,
+  0xF6, 0x41, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x41, 0x81, 0xF7, 0xFF, 0x02,
+  0x40, 0x81, 0xF6, 0xC4, 0x44, 0x87, 0xC3, 0x2B, 0xC4, 0xF7, 0xFF, 0xF7, 0xC4, 0x2A, 0x0D, 0x4D,
+  0x82, 0xA3, 0xFF, 0x62, 0x01, 0x82, 0xA3, 0xFF, 0x62, 0x02, 0x88, 0x0D, 0xDB, 0xF6, 0x2F, 0x00,
+  0x0D, 0xDB, 0xF6, 0x2F, 0x02, 0x88, 0x34, 0xFA, 0xDB, 0x0E, 0x00, 0x34, 0xFA, 0xDB, 0x0E, 0x02,
+  0x82, 0x75, 0xFF, 0xAD, 0x01, 0x82, 0x75, 0xFF, 0xAD, 0x02, 0x88, 0x01, 0xB9, 0xFF, 0x72, 0x00,
+  0x01, 0xB9, 0xFF, 0x72, 0x02, 0x82, 0x2F, 0xFF, 0xF6, 0x01, 0x82, 0x2F, 0xFF, 0xF6, 0x01, 0x88,
+  0x02, 0xBB, 0xFF, 0x72, 0x00, 0x02, 0xBB, 0xFF, 0x72, 0x01, 0x82, 0x7C, 0xFF, 0xAE, 0x01, 0x82,
+  0x7C, 0xFF, 0xAE, 0x01, 0x92, 0x3D, 0xFC, 0xDB, 0x0E, 0x00, 0x3D, 0xFC, 0xDB, 0x0E, 0x00, 0x13,
+  0xE3, 0xF6, 0x2F, 0x00, 0x13, 0xE3, 0xF6, 0x2F, 0x01, 0x82, 0xB4, 0xFF, 0x62, 0x01, 0x82, 0xB4,
+  0xFF, 0x62, 0x02, 0x02, 0x41, 0x05, 0x41, 0x05, 0x41, 0x1D, 0x81, 0xEC, 0xEC, 0x05, 0x81, 0xEC,
+  0xEC, 0x05, 0x81, 0xEC, 0xEC, 0x05, 0x81, 0xEC, 0xEC, 0x04, 0x82, 0x04, 0xF1, 0xE1, 0x04, 0x82,
+  0x73, 0xFF, 0x96, 0x03, 0x83, 0x1B, 0xF3, 0xEF, 0x16, 0x03, 0x82, 0xAB, 0xFF, 0x6B, 0x03, 0x83,
+  0x47, 0xFF, 0xCE, 0x03, 0x03, 0x82, 0xCB, 0xFF, 0x38, 0x04, 0x81, 0xFC, 0xFF, 0x05, 0x41, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x41, 0x81, 0xF5, 0xFF, 0x03, 0x40, 0x81, 0xF4, 0xB2, 0x45, 0x83, 0xB1,
+  0x18, 0xB1, 0xF5, 0x41, 0x82, 0xF5, 0xB2, 0x18, 0x02, 0x83, 0x97, 0xFF, 0xEC, 0x09, 0x05, 0x83,
+  0x02, 0xAE, 0xFF, 0x64, 0x06, 0x82, 0x08, 0xC2, 0xD1, 0x19, 0x80, 0x16, 0x41, 0x80, 0x16, 0x05,
+  0x80, 0x43, 0x41, 0x80, 0x42, 0x05, 0x80, 0x70, 0x41, 0x80, 0x6F, 0x05, 0x80, 0x9C, 0x41, 0x80,
+  0x9B, 0x05, 0x83, 0xC9, 0xE0, 0xEF, 0xC8, 0x04, 0x85, 0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x03,
+  0x85, 0x22, 0xFF, 0x94, 0xA3, 0xFF, 0x21, 0x03, 0x85, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 0x03,
+  0x85, 0x7C, 0xFF, 0x49, 0x55, 0xFF, 0x7A, 0x03, 0x85, 0xA8, 0xFF, 0x23, 0x2E, 0xFF, 0xA6, 0x03,
+  0x85, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x02, 0x82, 0x06, 0xFB, 0xD7, 0x01, 0x82, 0xE1, 0xFA,
+  0x05, 0x01, 0x82, 0x2E, 0xFF, 0xB1, 0x01, 0x82, 0xBA, 0xFF, 0x2C, 0x01, 0x82, 0x5B, 0xFF, 0x8C,
+  0x01, 0x82, 0x94, 0xFF, 0x58, 0x01, 0x82, 0x88, 0xFF, 0x66, 0x01, 0x82, 0x6D, 0xFF, 0x85, 0x01,
+  0x82, 0xB4, 0xFF, 0x40, 0x01, 0x82, 0x46, 0xFF, 0xB1, 0x01, 0x82, 0xE1, 0xFF, 0x1A, 0x01, 0x84,
+  0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0x46, 0x82, 0xFE, 0x0C, 0x3A, 0x47, 0x83, 0x37, 0x67, 0xFF, 0xAE,
+  0x03, 0x85, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x03, 0x85, 0x80, 0xFF, 0x90, 0xC0, 0xFF, 0x4A,
+  0x03, 0x85, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 0x18, 0x03, 0x82, 0x1A, 0xFF, 0xE9, 0x04, 0x83, 0x09,
+  0xED, 0xFF, 0x98, 0x05, 0x83, 0x65, 0xFF, 0xB0, 0x03, 0x05, 0x82, 0xD1, 0xC5, 0x09, 0x18, 0x80,
+  0x16, 0x41, 0x80, 0x16, 0x05, 0x80, 0x43, 0x41, 0x80, 0x42, 0x05, 0x80, 0x70, 0x41, 0x80, 0x6F,
+  0x05, 0x80, 0x9C, 0x41, 0x80, 0x9B, 0x05, 0x83, 0xC9, 0xE0, 0xEF, 0xC8, 0x04, 0x85, 0x01, 0xF4,
+  0xBA, 0xC9, 0xF3, 0x01, 0x03, 0x85, 0x22, 0xFF, 0x94, 0xA3, 0xFF, 0x21, 0x03, 0x85, 0x4F, 0xFF,
+  0x6E, 0x7C, 0xFF, 0x4D, 0x03, 0x85, 0x7C, 0xFF, 0x49, 0x55, 0xFF, 0x7A, 0x03, 0x85, 0xA8, 0xFF,
+  0x23, 0x2E, 0xFF, 0xA6, 0x03, 0x85, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x02, 0x82, 0x06, 0xFB,
+  0xD7, 0x01, 0x82, 0xE1, 0xFA, 0x05, 0x01, 0x82, 0x2E, 0xFF, 0xB1, 0x01, 0x82, 0xBA, 0xFF, 0x2C,
+  0x01, 0x82, 0x5B, 0xFF, 0x8C, 0x01, 0x82, 0x94, 0xFF, 0x58, 0x01, 0x82, 0x88, 0xFF, 0x66, 0x01,
+  0x82, 0x6D, 0xFF, 0x85, 0x01, 0x82, 0xB4, 0xFF, 0x40, 0x01, 0x82, 0x46, 0xFF, 0xB1, 0x01, 0x82,
+  0xE1, 0xFF, 0x1A, 0x01, 0x84, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0x46, 0x82, 0xFE, 0x0C, 0x3A, 0x47,
+  0x83, 0x37, 0x67, 0xFF, 0xAE, 0x03, 0x85, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x03, 0x85, 0x80,
+  0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x03, 0x85, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 0x18, 0x03, 0x82, 0x1A,
+  0xFF, 0xE9, 0x02, 0x84, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x03, 0x86, 0x04, 0xA3, 0xFF, 0xDC, 0xFF,
+  0xA8, 0x05, 0x02, 0x86, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x0D, 0x80, 0x16, 0x41, 0x80,
+  0x16, 0x05, 0x80, 0x43, 0x41, 0x80, 0x42, 0x05, 0x80, 0x70, 0x41, 0x80, 0x6F, 0x05, 0x80, 0x9C,
+  0x41, 0x80, 0x9B, 0x05, 0x83, 0xC9, 0xE0, 0xEF, 0xC8, 0x04, 0x85, 0x01, 0xF4, 0xBA, 0xC9, 0xF3,
+  0x01, 0x03, 0x85, 0x22, 0xFF, 0x94, 0xA3, 0xFF, 0x21, 0x03, 0x85, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF,
+  0x4D, 0x03, 0x85, 0x7C, 0xFF, 0x49, 0x55, 0xFF, 0x7A, 0x03, 0x85, 0xA8, 0xFF, 0x23, 0x2E, 0xFF,
+  0xA6, 0x03, 0x85, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x02, 0x82, 0x06, 0xFB, 0xD7, 0x01, 0x82,
+  0xE1, 0xFA, 0x05, 0x01, 0x82, 0x2E, 0xFF, 0xB1, 0x01, 0x82, 0xBA, 0xFF, 0x2C, 0x01, 0x82, 0x5B,
+  0xFF, 0x8C, 0x01, 0x82, 0x94, 0xFF, 0x58, 0x01, 0x82, 0x88, 0xFF, 0x66, 0x01, 0x82, 0x6D, 0xFF,
+  0x85, 0x01, 0x82, 0xB4, 0xFF, 0x40, 0x01, 0x82, 0x46, 0xFF, 0xB1, 0x01, 0x82, 0xE1, 0xFF, 0x1A,
+  0x01, 0x84, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0x46, 0x82, 0xFE, 0x0C, 0x3A, 0x47, 0x83, 0x37, 0x67,
+  0xFF, 0xAE, 0x03, 0x85, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x03, 0x85, 0x80, 0xFF, 0x90, 0xC0,
+  0xFF, 0x4A, 0x03, 0x85, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 0x18, 0x03, 0x82, 0x1A, 0xFF, 0xE9, 0x01,
+  0x84, 0x66, 0xEC, 0xE9, 0x98, 0x32, 0x41, 0x02, 0x80, 0xEC, 0x44, 0x80, 0xEC, 0x02, 0x41, 0x84,
+  0x32, 0x97, 0xE9, 0xEC, 0x66, 0x17, 0x80, 0x16, 0x41, 0x80, 0x16, 0x05, 0x80, 0x43, 0x41, 0x80,
+  0x42, 0x05, 0x80, 0x70, 0x41, 0x80, 0x6F, 0x05, 0x80, 0x9C, 0x41, 0x80, 0x9B, 0x05, 0x83, 0xC9,
+  0xE0, 0xEF, 0xC8, 0x04, 0x85, 0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x03, 0x85, 0x22, 0xFF, 0x94,
+  0xA3, 0xFF, 0x21, 0x03, 0x85, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 0x03, 0x85, 0x7C, 0xFF, 0x49,
+  0x55, 0xFF, 0x7A, 0x03, 0x85, 0xA8, 0xFF, 0x23, 0x2E, 0xFF, 0xA6, 0x03, 0x85, 0xD5, 0xF9, 0x03,
+  0x09, 0xFE, 0xD3, 0x02, 0x82, 0x06, 0xFB, 0xD7, 0x01, 0x82, 0xE1, 0xFA, 0x05, 0x01, 0x82, 0x2E,
+  0xFF, 0xB1, 0x01, 0x82, 0xBA, 0xFF, 0x2C, 0x01, 0x82, 0x5B, 0xFF, 0x8C, 0x01, 0x82, 0x94, 0xFF,
+  0x58, 0x01, 0x82, 0x88, 0xFF, 0x66, 0x01, 0x82, 0x6D, 0xFF, 0x85, 0x01, 0x82, 0xB4, 0xFF, 0x40,
+  0x01, 0x82, 0x46, 0xFF, 0xB1, 0x01, 0x82, 0xE1, 0xFF, 0x1A, 0x01, 0x84, 0x1F, 0xFF, 0xDE, 0x00,
+  0x0E, 0x46, 0x82, 0xFE, 0x0C, 0x3A, 0x47, 0x83, 0x37, 0x67, 0xFF, 0xAE, 0x03, 0x85, 0xB3, 0xFF,
+  0x63, 0x93, 0xFF, 0x7C, 0x03, 0x85, 0x80, 0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x03, 0x85, 0x4D, 0xFF,
+  0xBC, 0xEC, 0xFF, 0x18, 0x03, 0x82, 0x1A, 0xFF, 0xE9, 0x01, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01,
+  0x41, 0x03, 0x41, 0x01, 0x41, 0x18, 0x80, 0x16, 0x41, 0x80, 0x16, 0x05, 0x80, 0x43, 0x41, 0x80,
+  0x42, 0x05, 0x80, 0x70, 0x41, 0x80, 0x6F, 0x05, 0x80, 0x9C, 0x41, 0x80, 0x9B, 0x05, 0x83, 0xC9,
+  0xE0, 0xEF, 0xC8, 0x04, 0x85, 0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x03, 0x85, 0x22, 0xFF, 0x94,
+  0xA3, 0xFF, 0x21, 0x03, 0x85, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 0x03, 0x85, 0x7C, 0xFF, 0x49,
+  0x55, 0xFF, 0x7A, 0x03, 0x85, 0xA8, 0xFF, 0x23, 0x2E, 0xFF, 0xA6, 0x03, 0x85, 0xD5, 0xF9, 0x03,
+  0x09, 0xFE, 0xD3, 0x02, 0x82, 0x06, 0xFB, 0xD7, 0x01, 0x82, 0xE1, 0xFA, 0x05, 0x01, 0x82, 0x2E,
+  0xFF, 0xB1, 0x01, 0x82, 0xBA, 0xFF, 0x2C, 0x01, 0x82, 0x5B, 0xFF, 0x8C, 0x01, 0x82, 0x94, 0xFF,
+  0x58, 0x01, 0x82, 0x88, 0xFF, 0x66, 0x01, 0x82, 0x6D, 0xFF, 0x85, 0x01, 0x82, 0xB4, 0xFF, 0x40,
+  0x01, 0x82, 0x46, 0xFF, 0xB1, 0x01, 0x82, 0xE1, 0xFF, 0x1A, 0x01, 0x84, 0x1F, 0xFF, 0xDE, 0x00,
+  0x0E, 0x46, 0x82, 0xFE, 0x0C, 0x3A, 0x47, 0x83, 0x37, 0x67, 0xFF, 0xAE, 0x03, 0x85, 0xB3, 0xFF,
+  0x63, 0x93, 0xFF, 0x7C, 0x03, 0x85, 0x80, 0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x03, 0x85, 0x4D, 0xFF,
+  0xBC, 0xEC, 0xFF, 0x18, 0x03, 0x82, 0x1A, 0xFF, 0xE9, 0x01, 0x85, 0x2A, 0xC3, 0xF6, 0xF6, 0xC3,
+  0x2A, 0x03, 0x81, 0xC4, 0xFF, 0x01, 0x40, 0x80, 0xC3, 0x03, 0x81, 0xEE, 0xFF, 0x01, 0x40, 0x80,
+  0xED, 0x03, 0x81, 0xC4, 0xFF, 0x01, 0x40, 0x80, 0xC3, 0x03, 0x81, 0x2B, 0xDA, 0x41, 0x81, 0xDA,
+  0x2A, 0x04, 0x80, 0x43, 0x41, 0x80, 0x42, 0x05, 0x80, 0x70, 0x41, 0x80, 0x6F, 0x05, 0x80, 0x9C,
+  0x41, 0x80, 0x9B, 0x05, 0x83, 0xC9, 0xE0, 0xEF, 0xC8, 0x04, 0x85, 0x01, 0xF4, 0xBA, 0xC9, 0xF3,
+  0x01, 0x03, 0x85, 0x22, 0xFF, 0x94, 0xA3, 0xFF, 0x21, 0x03, 0x85, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF,
+  0x4D, 0x03, 0x85, 0x7C, 0xFF, 0x49, 0x55, 0xFF, 0x7A, 0x03, 0x85, 0xA8, 0xFF, 0x23, 0x2E, 0xFF,
+  0xA6, 0x03, 0x85, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x02, 0x82, 0x06, 0xFB, 0xD7, 0x01, 0x82,
+  0xE1, 0xFA, 0x05, 0x01, 0x82, 0x2E, 0xFF, 0xB1, 0x01, 0x82, 0xBA, 0xFF, 0x2C, 0x01, 0x82, 0x5B,
+  0xFF, 0x8C, 0x01, 0x82, 0x94, 0xFF, 0x58, 0x01, 0x82, 0x88, 0xFF, 0x66, 0x01, 0x82, 0x6D, 0xFF,
+  0x85, 0x01, 0x82, 0xB4, 0xFF, 0x40, 0x01, 0x82, 0x46, 0xFF, 0xB1, 0x01, 0x82, 0xE1, 0xFF, 0x1A,
+  0x01, 0x84, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0x46, 0x82, 0xFE, 0x0C, 0x3A, 0x47, 0x83, 0x37, 0x67,
+  0xFF, 0xAE, 0x03, 0x85, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x03, 0x85, 0x80, 0xFF, 0x90, 0xC0,
+  0xFF, 0x4A, 0x03, 0x85, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 0x18, 0x03, 0x82, 0x1A, 0xFF, 0xE9, 0x05,
+  0x80, 0xD8, 0x48, 0x04, 0x82, 0x1D, 0xFF, 0xFD, 0x47, 0x04, 0x82, 0x64, 0xFF, 0xC9, 0x41, 0x0A,
+  0x82, 0xAA, 0xFF, 0x7F, 0x41, 0x09, 0x83, 0x02, 0xED, 0xFF, 0x35, 0x41, 0x09, 0x83, 0x37, 0xFF,
+  0xEA, 0x01, 0x41, 0x09, 0x83, 0x7D, 0xFF, 0xA2, 0x00, 0x41, 0x09, 0x83, 0xC3, 0xFF, 0x58, 0x00,
+  0x41, 0x08, 0x84, 0x0E, 0xFB, 0xFC, 0x11, 0x00, 0x41, 0x08, 0x82, 0x50, 0xFF, 0xC4, 0x01, 0x41,
+  0x08, 0x82, 0x96, 0xFF, 0x7A, 0x01, 0x46, 0x03, 0x82, 0xDD, 0xFF, 0x30, 0x01, 0x46, 0x02, 0x82,
+  0x22, 0xFF, 0xE5, 0x02, 0x41, 0x07, 0x82, 0x69, 0xFF, 0x9C, 0x02, 0x41, 0x07, 0x82, 0xAF, 0xFF,
+  0x52, 0x02, 0x41, 0x06, 0x83, 0x04, 0xF1, 0xFA, 0x0E, 0x02, 0x41, 0x06, 0x80, 0x3C, 0x47, 0x06,
+  0x80, 0x82, 0x47, 0x06, 0x82, 0xC9, 0xFF, 0x4A, 0x03, 0x41, 0x05, 0x83, 0x11, 0xFD, 0xF7, 0x09,
+  0x03, 0x41, 0x05, 0x82, 0x55, 0xFF, 0xB7, 0x04, 0x41, 0x05, 0x82, 0x9B, 0xFF, 0x6E, 0x04, 0x47,
+  0x82, 0xE1, 0xFF, 0x24, 0x04, 0x47, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4, 0xAF, 0x17, 0xB2,
+  0x46, 0x82, 0xB0, 0xF5, 0xFF, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41,
+  0x06, 0x41, 0x06, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04,
+  0x40, 0x81, 0xF4, 0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB1, 0x18, 0x03,
+  0x81, 0xF3, 0x9C, 0x06, 0x83, 0xBE, 0xF6, 0x9C, 0x22, 0x02, 0x41, 0x83, 0x08, 0x64, 0xFF, 0xDF,
+  0x02, 0x41, 0x01, 0x41, 0x02, 0x80, 0xC0, 0x43, 0x81, 0xBF, 0x00, 0x00, 0x83, 0x97, 0xFF, 0xEC,
+  0x09, 0x02, 0x83, 0x02, 0xAE, 0xFF, 0x64, 0x03, 0x82, 0x08, 0xC2, 0xD1, 0x0F, 0x4F, 0x04, 0x41,
+  0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4F, 0x04, 0x41,
+  0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4D,
+  0x02, 0x83, 0x09, 0xED, 0xFF, 0x98, 0x02, 0x83, 0x65, 0xFF, 0xB0, 0x03, 0x02, 0x82, 0xD1, 0xC5,
+  0x09, 0x0E, 0x4F, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x4F, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x4D, 0x00, 0x93, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x00, 0x04, 0xA3, 0xFF,
+  0xDC, 0xFF, 0xA8, 0x05, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x0D, 0x4F, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4F, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4D, 0x00,
+  0x41, 0x01, 0x41, 0x00, 0x41, 0x01, 0x41, 0x00, 0x41, 0x01, 0x41, 0x0D, 0x4F, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4F, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x4D, 0x8B,
+  0x97, 0xFF, 0xEC, 0x09, 0x02, 0xAE, 0xFF, 0x64, 0x00, 0x08, 0xC2, 0xD1, 0x08, 0x41, 0x01, 0x41,
+  0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+  0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+  0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x00, 0x00, 0x8C, 0x09, 0xED, 0xFF,
+  0x98, 0x00, 0x65, 0xFF, 0xB0, 0x03, 0x00, 0xD1, 0xC5, 0x09, 0x0A, 0x41, 0x02, 0x41, 0x02, 0x41,
+  0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41,
+  0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41,
+  0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x00, 0x93, 0x01, 0x93, 0xFF, 0x9B, 0x02,
+  0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x0F,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x02, 0x41, 0x01,
+  0x43, 0x01, 0x43, 0x01, 0x41, 0x0D, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03,
+  0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03,
+  0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03,
+  0x41, 0x03, 0x41, 0x01, 0x00, 0x84, 0x66, 0xEC, 0xE9, 0x98, 0x32, 0x41, 0x01, 0x80, 0xEC, 0x44,
+  0x80, 0xEC, 0x01, 0x41, 0x84, 0x32, 0x97, 0xE9, 0xEC, 0x66, 0x12, 0x40, 0x80, 0xC5, 0x04, 0x42,
+  0x81, 0xFE, 0x1A, 0x03, 0x43, 0x80, 0x6B, 0x03, 0x43, 0x80, 0xBE, 0x03, 0x43, 0x81, 0xFC, 0x14,
+  0x02, 0x44, 0x80, 0x64, 0x02, 0x43, 0x81, 0xDC, 0xB7, 0x02, 0x43, 0x82, 0x8A, 0xFA, 0x10, 0x01,
+  0x43, 0x82, 0x36, 0xFF, 0x5D, 0x01, 0x43, 0x00, 0x81, 0xE1, 0xB0, 0x01, 0x43, 0x00, 0x83, 0x8F,
+  0xF7, 0x0C, 0x00, 0x43, 0x00, 0x83, 0x3C, 0xFF, 0x56, 0x00, 0x43, 0x00, 0x83, 0x01, 0xE6, 0xA9,
+  0x00, 0x43, 0x01, 0x82, 0x95, 0xF3, 0x08, 0x43, 0x01, 0x82, 0x41, 0xFF, 0x4F, 0x43, 0x01, 0x82,
+  0x03, 0xEA, 0xA2, 0x43, 0x02, 0x81, 0x9B, 0xEF, 0x43, 0x02, 0x80, 0x47, 0x44, 0x02, 0x81, 0x05,
+  0xEE, 0x43, 0x03, 0x80, 0xA0, 0x43, 0x03, 0x80, 0x4D, 0x43, 0x03, 0x81, 0x07, 0xF2, 0x42, 0x04,
+  0x81, 0xA6, 0xFF, 0x00, 0x83, 0x97, 0xFF, 0xEC, 0x09, 0x04, 0x83, 0x02, 0xAE, 0xFF, 0x64, 0x05,
+  0x82, 0x08, 0xC2, 0xD1, 0x15, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4, 0xB0, 0x17, 0xB2, 0x46,
+  0x82, 0xB0, 0xF5, 0xFF, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40,
+  0x81, 0xF4, 0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x04, 0x83,
+  0x09, 0xED, 0xFF, 0x98, 0x04, 0x83, 0x65, 0xFF, 0xB0, 0x03, 0x04, 0x82, 0xD1, 0xC5, 0x09, 0x12,
+  0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4, 0xB0, 0x17, 0xB2, 0x46, 0x82, 0xB0, 0xF5, 0xFF, 0x04,
+  0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4, 0xB3, 0x46, 0x83,
+  0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x01, 0x84, 0x01, 0x93, 0xFF, 0x9B, 0x02,
+  0x02, 0x86, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x01, 0x86, 0xB2, 0xD2, 0x46, 0x00, 0x4B,
+  0xD8, 0xB3, 0x12, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4, 0xB0, 0x17, 0xB2, 0x46, 0x82, 0xB0,
+  0xF5, 0xFF, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4,
+  0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x01, 0x84, 0x66, 0xEC,
+  0xE9, 0x98, 0x32, 0x41, 0x01, 0x80, 0xEC, 0x44, 0x80, 0xEC, 0x01, 0x41, 0x84, 0x32, 0x97, 0xE9,
+  0xEC, 0x66, 0x11, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4, 0xB0, 0x17, 0xB2, 0x46, 0x82, 0xB0,
+  0xF5, 0xFF, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4,
+  0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x01, 0x41, 0x01, 0x41,
+  0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x12, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83, 0xF4,
+  0xB0, 0x17, 0xB2, 0x46, 0x82, 0xB0, 0xF5, 0xFF, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81,
+  0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4, 0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5,
+  0xB2, 0x18, 0x82, 0x1E, 0xBD, 0x1C, 0x02, 0x9C, 0x1A, 0xC0, 0x22, 0xBB, 0xFF, 0xD8, 0x16, 0x00,
+  0x13, 0xD5, 0xFF, 0xC2, 0x1A, 0xD6, 0xFF, 0xD0, 0x1E, 0xCB, 0xFF, 0xD8, 0x1C, 0x00, 0x15, 0xCF,
+  0xFF, 0xF8, 0xFF, 0xD0, 0x16, 0x02, 0x84, 0x21, 0xF9, 0xFF, 0xFA, 0x21, 0x02, 0x9C, 0x15, 0xCF,
+  0xFF, 0xF9, 0xFF, 0xD0, 0x16, 0x00, 0x1B, 0xD7, 0xFF, 0xCF, 0x21, 0xCF, 0xFF, 0xD8, 0x1C, 0xBE,
+  0xFF, 0xD7, 0x15, 0x00, 0x15, 0xD7, 0xFF, 0xBE, 0x20, 0xBE, 0x1B, 0x02, 0x82, 0x1B, 0xBE, 0x1F,
+  0x00, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x82, 0xF4, 0xB0, 0x17, 0x01, 0x83, 0x02, 0x4C, 0x00, 0xB2,
+  0x46, 0x80, 0xB0, 0x01, 0x84, 0x6E, 0x7F, 0x00, 0xF5, 0xFF, 0x04, 0x40, 0x85, 0xF4, 0x00, 0x19,
+  0xED, 0x2D, 0x00, 0x41, 0x04, 0x41, 0x00, 0x81, 0xAA, 0x8B, 0x01, 0x41, 0x04, 0x41, 0x82, 0x47,
+  0xE1, 0x0B, 0x01, 0x41, 0x04, 0x41, 0x81, 0xDC, 0x4F, 0x02, 0x41, 0x04, 0x41, 0x80, 0xB0, 0x03,
+  0x41, 0x04, 0x41, 0x80, 0x1E, 0x03, 0x41, 0x04, 0x41, 0x04, 0x41, 0x03, 0x80, 0x5F, 0x41, 0x04,
+  0x41, 0x02, 0x81, 0x11, 0xE8, 0x41, 0x04, 0x41, 0x02, 0x81, 0x9B, 0x9A, 0x41, 0x04, 0x41, 0x01,
+  0x82, 0x3A, 0xE8, 0x12, 0x41, 0x04, 0x41, 0x00, 0x83, 0x04, 0xD2, 0x5E, 0x00, 0x41, 0x04, 0x41,
+  0x00, 0x81, 0x75, 0xBF, 0x01, 0x41, 0x04, 0x41, 0x82, 0x1E, 0xED, 0x28, 0x01, 0x41, 0x04, 0x41,
+  0x81, 0xB1, 0x83, 0x02, 0x41, 0x04, 0x41, 0x81, 0xDC, 0x08, 0x02, 0x41, 0x04, 0x41, 0x80, 0x47,
+  0x03, 0x41, 0x04, 0x41, 0x04, 0x41, 0x03, 0x80, 0x2E, 0x41, 0x04, 0x40, 0x80, 0xF4, 0x03, 0x80,
+  0x7F, 0x47, 0x80, 0xB1, 0x03, 0x83, 0x4C, 0x1D, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x03,
+  0x01, 0x83, 0x97, 0xFF, 0xEC, 0x09, 0x04, 0x83, 0x02, 0xAE, 0xFF, 0x64, 0x05, 0x82, 0x08, 0xC2,
+  0xD1, 0x14, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40,
+  0x81, 0xF4, 0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x04, 0x83,
+  0x09, 0xED, 0xFF, 0x98, 0x04, 0x83, 0x65, 0xFF, 0xB0, 0x03, 0x04, 0x82, 0xD1, 0xC5, 0x09, 0x12,
+  0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4,
+  0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x01, 0x84, 0x01, 0x93,
+  0xFF, 0x9B, 0x02, 0x02, 0x86, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x01, 0x86, 0xB2, 0xD2,
+  0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x12, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81,
+  0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4, 0xB3, 0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5,
+  0xB2, 0x18, 0x01, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x12, 0x41,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4, 0xB3,
+  0x46, 0x83, 0xB1, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB2, 0x18, 0x05, 0x83, 0x09, 0xED, 0xFF,
+  0x98, 0x07, 0x83, 0x65, 0xFF, 0xB0, 0x03, 0x07, 0x82, 0xD1, 0xC5, 0x09, 0x0E, 0x82, 0xDD, 0xFF,
+  0x2C, 0x05, 0x85, 0x2C, 0xFF, 0xDC, 0x82, 0xFF, 0x85, 0x05, 0x85, 0x85, 0xFF, 0x81, 0x27, 0xFF,
+  0xDE, 0x05, 0x86, 0xDD, 0xFF, 0x26, 0x00, 0xCB, 0xFF, 0x38, 0x03, 0x82, 0x36, 0xFF, 0xCA, 0x01,
+  0x82, 0x70, 0xFF, 0x91, 0x03, 0x82, 0x8F, 0xFF, 0x6F, 0x01, 0x83, 0x17, 0xFC, 0xE7, 0x03, 0x01,
+  0x83, 0x02, 0xE5, 0xFC, 0x17, 0x02, 0x82, 0xB9, 0xFF, 0x43, 0x01, 0x82, 0x40, 0xFF, 0xB8, 0x03,
+  0x82, 0x5E, 0xFF, 0x9D, 0x01, 0x82, 0x99, 0xFF, 0x5D, 0x03, 0x87, 0x0C, 0xF5, 0xEF, 0x06, 0x04,
+  0xEC, 0xF5, 0x0C, 0x04, 0x85, 0xA4, 0xFF, 0x4F, 0x4A, 0xFF, 0xA3, 0x05, 0x85, 0x3F, 0xFF, 0xA8,
+  0xA2, 0xFF, 0x3B, 0x06, 0x83, 0xD9, 0xF5, 0xF2, 0xDC, 0x07, 0x80, 0x83, 0x41, 0x80, 0x84, 0x07,
+  0x80, 0x31, 0x41, 0x80, 0x30, 0x08, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09,
+  0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x04, 0x44, 0x82, 0xEB, 0x98, 0x0B, 0x46, 0x80, 0x97,
+  0x41, 0x01, 0x83, 0x03, 0x61, 0xFF, 0xEA, 0x41, 0x02, 0x80, 0x05, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x40, 0x80, 0xF8, 0x41, 0x02, 0x82, 0x4A, 0xFF, 0xBD, 0x41, 0x01, 0x83, 0x48,
+  0xF8, 0xCF, 0x1F, 0x41, 0x01, 0x83, 0xF0, 0xE9, 0x13, 0x00, 0x41, 0x01, 0x83, 0x55, 0xFE, 0xD5,
+  0x27, 0x41, 0x02, 0x82, 0x71, 0xFF, 0xC7, 0x41, 0x03, 0x40, 0x80, 0xFA, 0x41, 0x03, 0x43, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x40, 0x80, 0xF6, 0x41, 0x01, 0x42,
+  0x80, 0xC3, 0x41, 0x01, 0x40, 0x82, 0xF7, 0xC4, 0x2A, 0x00, 0x83, 0x97, 0xFF, 0xEC, 0x09, 0x03,
+  0x83, 0x02, 0xAE, 0xFF, 0x64, 0x04, 0x82, 0x08, 0xC2, 0xD1, 0x12, 0x82, 0x5D, 0xBE, 0xF3, 0x41,
+  0x82, 0xF4, 0xBC, 0x39, 0x46, 0x80, 0xEA, 0x41, 0x03, 0x43, 0x03, 0x41, 0x05, 0x41, 0x05, 0x41,
+  0x82, 0x03, 0x85, 0xF1, 0x44, 0x80, 0x7F, 0x46, 0x81, 0xEA, 0xFF, 0x03, 0x43, 0x03, 0x43, 0x03,
+  0x41, 0x85, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0x41, 0x80, 0xBD, 0x46, 0x85, 0x22, 0xB6, 0xEA,
+  0xC4, 0x8F, 0x5F, 0x41, 0x03, 0x83, 0x09, 0xED, 0xFF, 0x98, 0x03, 0x83, 0x65, 0xFF, 0xB0, 0x03,
+  0x03, 0x82, 0xD1, 0xC5, 0x09, 0x10, 0x82, 0x5D, 0xBE, 0xF3, 0x41, 0x82, 0xF4, 0xBC, 0x39, 0x46,
+  0x80, 0xEA, 0x41, 0x03, 0x43, 0x03, 0x41, 0x05, 0x41, 0x05, 0x41, 0x82, 0x03, 0x85, 0xF1, 0x44,
+  0x80, 0x7F, 0x46, 0x81, 0xEA, 0xFF, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x85, 0xF6, 0xFF, 0x17,
+  0x47, 0x77, 0xA7, 0x41, 0x80, 0xBD, 0x46, 0x85, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0x41, 0x01,
+  0x84, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x01, 0x8E, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x00,
+  0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x0F, 0x82, 0x5D, 0xBE, 0xF3, 0x41, 0x82, 0xF4, 0xBC,
+  0x39, 0x46, 0x80, 0xEA, 0x41, 0x03, 0x43, 0x03, 0x41, 0x05, 0x41, 0x05, 0x41, 0x82, 0x03, 0x85,
+  0xF1, 0x44, 0x80, 0x7F, 0x46, 0x81, 0xEA, 0xFF, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x85, 0xF6,
+  0xFF, 0x17, 0x47, 0x77, 0xA7, 0x41, 0x80, 0xBD, 0x46, 0x85, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F,
+  0x41, 0x00, 0x84, 0x66, 0xEC, 0xE9, 0x98, 0x32, 0x41, 0x00, 0x80, 0xEC, 0x44, 0x81, 0xEC, 0x00,
+  0x41, 0x84, 0x32, 0x97, 0xE9, 0xEC, 0x66, 0x0F, 0x82, 0x5D, 0xBE, 0xF3, 0x41, 0x82, 0xF4, 0xBC,
+  0x39, 0x46, 0x80, 0xEA, 0x41, 0x03, 0x43, 0x03, 0x41, 0x05, 0x41, 0x05, 0x41, 0x82, 0x03, 0x85,
+  0xF1, 0x44, 0x80, 0x7F, 0x46, 0x81, 0xEA, 0xFF, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x85, 0xF6,
+  0xFF, 0x17, 0x47, 0x77, 0xA7, 0x41, 0x80, 0xBD, 0x46, 0x85, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F,
+  0x41, 0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x10, 0x82, 0x5D,
+  0xBE, 0xF3, 0x41, 0x82, 0xF4, 0xBC, 0x39, 0x46, 0x80, 0xEA, 0x41, 0x03, 0x43, 0x03, 0x41, 0x05,
+  0x41, 0x05, 0x41, 0x82, 0x03, 0x85, 0xF1, 0x44, 0x80, 0x7F, 0x46, 0x81, 0xEA, 0xFF, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x41, 0x85, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0x41, 0x80, 0xBD, 0x46, 0x85,
+  0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0x41, 0x01, 0x85, 0x2A, 0xC3, 0xF6, 0xF6, 0xC3, 0x2A, 0x01,
+  0x81, 0xC4, 0xFF, 0x01, 0x40, 0x80, 0xC3, 0x01, 0x81, 0xEE, 0xFF, 0x01, 0x40, 0x80, 0xED, 0x01,
+  0x81, 0xC4, 0xFF, 0x01, 0x40, 0x80, 0xC3, 0x01, 0x85, 0x2B, 0xC4, 0xF7, 0xF7, 0xC4, 0x2A, 0x0F,
+  0x82, 0x5D, 0xBE, 0xF3, 0x41, 0x82, 0xF4, 0xBC, 0x39, 0x46, 0x80, 0xEA, 0x41, 0x03, 0x43, 0x03,
+  0x41, 0x05, 0x41, 0x05, 0x41, 0x82, 0x03, 0x85, 0xF1, 0x44, 0x80, 0x7F, 0x46, 0x81, 0xEA, 0xFF,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x85, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0x41, 0x80, 0xBD,
+  0x46, 0x85, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0x41, 0x82, 0x24, 0xB9, 0xF1, 0x47, 0x83, 0xF6,
+  0xC3, 0x2A, 0xC0, 0x4B, 0x82, 0xC3, 0xF6, 0xFF, 0x03, 0x41, 0x03, 0x40, 0x80, 0xF6, 0x41, 0x03,
+  0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x81, 0x63, 0xF4, 0x45, 0x83,
+  0xFC, 0xFC, 0xFC, 0xFC, 0x41, 0x80, 0xDD, 0x4B, 0x82, 0xD0, 0xFB, 0xFF, 0x03, 0x41, 0x85, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x02, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x85, 0xF7, 0xFF,
+  0x02, 0x08, 0x0E, 0x14, 0x41, 0x86, 0x08, 0x08, 0x08, 0x08, 0xF8, 0xEA, 0xC4, 0x4B, 0x88, 0xBB,
+  0x2B, 0xC4, 0xF6, 0xEC, 0xCF, 0xB1, 0xB4, 0xFB, 0x42, 0x82, 0xF6, 0xC1, 0x26, 0x82, 0x0C, 0x94,
+  0xED, 0x41, 0x83, 0xF0, 0xA0, 0x10, 0x9A, 0x45, 0x82, 0xA0, 0xF0, 0xFF, 0x03, 0x40, 0x80, 0xF0,
+  0x41, 0x03, 0x43, 0x03, 0x43, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x03, 0x43, 0x03,
+  0x41, 0x81, 0xF0, 0xFF, 0x03, 0x40, 0x81, 0xF0, 0xA1, 0x45, 0x83, 0xA0, 0x10, 0xA1, 0xF0, 0x41,
+  0x82, 0xF0, 0xA1, 0x10, 0x02, 0x81, 0xF3, 0x9C, 0x05, 0x83, 0xBE, 0xF6, 0x9C, 0x22, 0x01, 0x41,
+  0x83, 0x08, 0x64, 0xFF, 0xDF, 0x01, 0x41, 0x01, 0x41, 0x01, 0x80, 0xC0, 0x43, 0x81, 0xBF, 0x00,
+  0x00, 0x83, 0x97, 0xFF, 0xEC, 0x09, 0x03, 0x83, 0x02, 0xAE, 0xFF, 0x64, 0x04, 0x82, 0x08, 0xC2,
+  0xD1, 0x12, 0x82, 0x15, 0xB3, 0xF5, 0x41, 0x83, 0xF5, 0xB2, 0x15, 0xA1, 0x45, 0x82, 0xA0, 0xEF,
+  0xFF, 0x03, 0x40, 0x80, 0xEF, 0x41, 0x03, 0x43, 0x03, 0x50, 0x80, 0xC6, 0x41, 0x05, 0x41, 0x05,
+  0x41, 0x03, 0x43, 0x03, 0x41, 0x81, 0xEF, 0xFF, 0x03, 0x41, 0x80, 0xA2, 0x45, 0x83, 0xC6, 0x15,
+  0xB4, 0xF6, 0x41, 0x82, 0xF2, 0xAA, 0x1A, 0x03, 0x83, 0x09, 0xED, 0xFF, 0x98, 0x03, 0x83, 0x65,
+  0xFF, 0xB0, 0x03, 0x03, 0x82, 0xD1, 0xC5, 0x09, 0x10, 0x82, 0x15, 0xB3, 0xF5, 0x41, 0x83, 0xF5,
+  0xB2, 0x15, 0xA1, 0x45, 0x82, 0xA0, 0xEF, 0xFF, 0x03, 0x40, 0x80, 0xEF, 0x41, 0x03, 0x43, 0x03,
+  0x50, 0x80, 0xC6, 0x41, 0x05, 0x41, 0x05, 0x41, 0x03, 0x43, 0x03, 0x41, 0x81, 0xEF, 0xFF, 0x03,
+  0x41, 0x80, 0xA2, 0x45, 0x83, 0xC6, 0x15, 0xB4, 0xF6, 0x41, 0x82, 0xF2, 0xAA, 0x1A, 0x01, 0x84,
+  0x01, 0x93, 0xFF, 0x9B, 0x02, 0x01, 0x8E, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x00, 0xB2,
+  0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x0F, 0x82, 0x15, 0xB3, 0xF5, 0x41, 0x83, 0xF5, 0xB2, 0x15,
+  0xA1, 0x45, 0x82, 0xA0, 0xEF, 0xFF, 0x03, 0x40, 0x80, 0xEF, 0x41, 0x03, 0x43, 0x03, 0x50, 0x80,
+  0xC6, 0x41, 0x05, 0x41, 0x05, 0x41, 0x03, 0x43, 0x03, 0x41, 0x81, 0xEF, 0xFF, 0x03, 0x41, 0x80,
+  0xA2, 0x45, 0x83, 0xC6, 0x15, 0xB4, 0xF6, 0x41, 0x82, 0xF2, 0xAA, 0x1A, 0x00, 0x41, 0x01, 0x41,
+  0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x10, 0x82, 0x15, 0xB3, 0xF5, 0x41, 0x83, 0xF5,
+  0xB2, 0x15, 0xA1, 0x45, 0x82, 0xA0, 0xEF, 0xFF, 0x03, 0x40, 0x80, 0xEF, 0x41, 0x03, 0x43, 0x03,
+  0x50, 0x80, 0xC6, 0x41, 0x05, 0x41, 0x05, 0x41, 0x03, 0x43, 0x03, 0x41, 0x81, 0xEF, 0xFF, 0x03,
+  0x41, 0x80, 0xA2, 0x45, 0x83, 0xC6, 0x15, 0xB4, 0xF6, 0x41, 0x82, 0xF2, 0xAA, 0x1A, 0x8B, 0x97,
+  0xFF, 0xEC, 0x09, 0x02, 0xAE, 0xFF, 0x64, 0x00, 0x08, 0xC2, 0xD1, 0x09, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x00, 0x8C, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x65, 0xFF,
+  0xB0, 0x03, 0x00, 0xD1, 0xC5, 0x09, 0x0A, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41,
+  0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41,
+  0x02, 0x41, 0x02, 0x00, 0x93, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF,
+  0xA8, 0x05, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x0F, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x02, 0x41, 0x01, 0x43, 0x01, 0x43, 0x01, 0x41, 0x0D, 0x41, 0x03,
+  0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03,
+  0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x01, 0x00, 0x84, 0x66, 0xEC, 0xE9, 0x98,
+  0x32, 0x41, 0x00, 0x80, 0xEC, 0x44, 0x81, 0xEC, 0x00, 0x41, 0x84, 0x32, 0x97, 0xE9, 0xEC, 0x66,
+  0x0F, 0x41, 0x85, 0x0F, 0x57, 0xA4, 0xED, 0xE5, 0x49, 0x41, 0x80, 0xF9, 0x43, 0x80, 0xD3, 0x41,
+  0x85, 0xF5, 0xB5, 0x6D, 0x24, 0xFF, 0xF8, 0x41, 0x80, 0x07, 0x02, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41,
+  0x00, 0x83, 0x97, 0xFF, 0xEC, 0x09, 0x03, 0x83, 0x02, 0xAE, 0xFF, 0x64, 0x04, 0x82, 0x08, 0xC2,
+  0xD1, 0x12, 0x82, 0x0F, 0xAC, 0xF4, 0x41, 0x83, 0xF4, 0xAC, 0x0F, 0x96, 0x45, 0x82, 0x95, 0xED,
+  0xFF, 0x03, 0x40, 0x80, 0xEC, 0x41, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x81, 0xED, 0xFF, 0x03, 0x40, 0x81, 0xEC, 0x96, 0x45, 0x83,
+  0x95, 0x0F, 0xAD, 0xF5, 0x41, 0x82, 0xF5, 0xAD, 0x0F, 0x03, 0x83, 0x09, 0xED, 0xFF, 0x98, 0x03,
+  0x83, 0x65, 0xFF, 0xB0, 0x03, 0x03, 0x82, 0xD1, 0xC5, 0x09, 0x10, 0x82, 0x0F, 0xAC, 0xF4, 0x41,
+  0x83, 0xF4, 0xAC, 0x0F, 0x96, 0x45, 0x82, 0x95, 0xED, 0xFF, 0x03, 0x40, 0x80, 0xEC, 0x41, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x81,
+  0xED, 0xFF, 0x03, 0x40, 0x81, 0xEC, 0x96, 0x45, 0x83, 0x95, 0x0F, 0xAD, 0xF5, 0x41, 0x82, 0xF5,
+  0xAD, 0x0F, 0x01, 0x84, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x01, 0x8E, 0x04, 0xA3, 0xFF, 0xDC, 0xFF,
+  0xA8, 0x05, 0x00, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x0F, 0x82, 0x0F, 0xAC, 0xF4, 0x41,
+  0x83, 0xF4, 0xAC, 0x0F, 0x96, 0x45, 0x82, 0x95, 0xED, 0xFF, 0x03, 0x40, 0x80, 0xEC, 0x41, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x81,
+  0xED, 0xFF, 0x03, 0x40, 0x81, 0xEC, 0x96, 0x45, 0x83, 0x95, 0x0F, 0xAD, 0xF5, 0x41, 0x82, 0xF5,
+  0xAD, 0x0F, 0x00, 0x84, 0x66, 0xEC, 0xE9, 0x98, 0x32, 0x41, 0x00, 0x80, 0xEC, 0x44, 0x81, 0xEC,
+  0x00, 0x41, 0x84, 0x32, 0x97, 0xE9, 0xEC, 0x66, 0x0F, 0x82, 0x0F, 0xAC, 0xF4, 0x41, 0x83, 0xF4,
+  0xAC, 0x0F, 0x96, 0x45, 0x82, 0x95, 0xED, 0xFF, 0x03, 0x40, 0x80, 0xEC, 0x41, 0x03, 0x43, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x81, 0xED, 0xFF,
+  0x03, 0x40, 0x81, 0xEC, 0x96, 0x45, 0x83, 0x95, 0x0F, 0xAD, 0xF5, 0x41, 0x82, 0xF5, 0xAD, 0x0F,
+  0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x10, 0x82, 0x0F, 0xAC,
+  0xF4, 0x41, 0x83, 0xF4, 0xAC, 0x0F, 0x96, 0x45, 0x82, 0x95, 0xED, 0xFF, 0x03, 0x40, 0x80, 0xEC,
+  0x41, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+  0x41, 0x81, 0xED, 0xFF, 0x03, 0x40, 0x81, 0xEC, 0x96, 0x45, 0x83, 0x95, 0x0F, 0xAD, 0xF5, 0x41,
+  0x82, 0xF5, 0xAD, 0x0F, 0x03, 0x82, 0x87, 0xF3, 0x87, 0x07, 0x82, 0xF4, 0xFF, 0xF3, 0x07, 0x82,
+  0x86, 0xF4, 0x86, 0x0E, 0x55, 0x0E, 0x82, 0x84, 0xF3, 0x84, 0x07, 0x82, 0xF4, 0xFF, 0xF3, 0x07,
+  0x82, 0x87, 0xF4, 0x87, 0x03, 0x00, 0x82, 0x0F, 0xAC, 0xF4, 0x41, 0x87, 0xF4, 0xAC, 0x0F, 0x00,
+  0x14, 0x5B, 0x00, 0x96, 0x45, 0x86, 0x95, 0x09, 0xC7, 0x58, 0x00, 0xED, 0xFF, 0x03, 0x40, 0x82,
+  0xEF, 0xAF, 0x8B, 0x01, 0x41, 0x03, 0x41, 0x81, 0xAA, 0x01, 0x01, 0x41, 0x03, 0x41, 0x80, 0x08,
+  0x02, 0x41, 0x02, 0x80, 0x55, 0x41, 0x03, 0x41, 0x01, 0x81, 0x3C, 0xE2, 0x41, 0x03, 0x41, 0x00,
+  0x82, 0x27, 0xE3, 0x37, 0x41, 0x03, 0x41, 0x83, 0x17, 0xDC, 0x50, 0x00, 0x41, 0x03, 0x41, 0x81,
+  0xCB, 0x6E, 0x01, 0x41, 0x03, 0x41, 0x80, 0x8E, 0x02, 0x41, 0x03, 0x41, 0x80, 0x02, 0x02, 0x40,
+  0x80, 0xEC, 0x02, 0x80, 0x60, 0x46, 0x80, 0x95, 0x02, 0x83, 0x5B, 0x24, 0xAD, 0xF5, 0x41, 0x82,
+  0xF5, 0xAD, 0x0F, 0x02, 0x83, 0x97, 0xFF, 0xEC, 0x09, 0x03, 0x83, 0x02, 0xAE, 0xFF, 0x64, 0x04,
+  0x82, 0x08, 0xC2, 0xD1, 0x13, 0x41, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x85, 0xF4, 0xFF, 0x0B,
+  0x23, 0x3B, 0x53, 0x41, 0x80, 0xB7, 0x46, 0x85, 0x2D, 0xE1, 0xF8, 0xE4, 0xCA, 0xAE, 0x41, 0x03,
+  0x83, 0x09, 0xED, 0xFF, 0x98, 0x03, 0x83, 0x65, 0xFF, 0xB0, 0x03, 0x03, 0x82, 0xD1, 0xC5, 0x09,
+  0x10, 0x41, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x85, 0xF4, 0xFF, 0x0B, 0x23, 0x3B, 0x53, 0x41,
+  0x80, 0xB7, 0x46, 0x85, 0x2D, 0xE1, 0xF8, 0xE4, 0xCA, 0xAE, 0x41, 0x01, 0x84, 0x01, 0x93, 0xFF,
+  0x9B, 0x02, 0x01, 0x8E, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x00, 0xB2, 0xD2, 0x46, 0x00,
+  0x4B, 0xD8, 0xB3, 0x0F, 0x41, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+  0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x85, 0xF4, 0xFF, 0x0B, 0x23,
+  0x3B, 0x53, 0x41, 0x80, 0xB7, 0x46, 0x85, 0x2D, 0xE1, 0xF8, 0xE4, 0xCA, 0xAE, 0x41, 0x00, 0x41,
+  0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x10, 0x41, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+  0x03, 0x41, 0x85, 0xF4, 0xFF, 0x0B, 0x23, 0x3B, 0x53, 0x41, 0x80, 0xB7, 0x46, 0x85, 0x2D, 0xE1,
+  0xF8, 0xE4, 0xCA, 0xAE, 0x41, 0x03, 0x83, 0x09, 0xED, 0xFF, 0x98, 0x03, 0x83, 0x65, 0xFF, 0xB0,
+  0x03, 0x03, 0x82, 0xD1, 0xC5, 0x09, 0x10, 0x82, 0xE5, 0xFF, 0x14, 0x01, 0x85, 0x15, 0xFF, 0xE4,
+  0xAE, 0xFF, 0x3E, 0x01, 0x85, 0x41, 0xFF, 0xAD, 0x77, 0xFF, 0x68, 0x01, 0x85, 0x6D, 0xFF, 0x76,
+  0x40, 0xFF, 0x92, 0x01, 0x85, 0x98, 0xFF, 0x3F, 0x0C, 0xFD, 0xBC, 0x01, 0x85, 0xC3, 0xFC, 0x0C,
+  0x00, 0xD2, 0xE6, 0x01, 0x81, 0xEE, 0xD1, 0x01, 0x85, 0x9C, 0xFF, 0x10, 0x1A, 0xFF, 0x9A, 0x01,
+  0x85, 0x65, 0xFF, 0x3A, 0x45, 0xFF, 0x64, 0x01, 0x85, 0x2E, 0xFF, 0x64, 0x71, 0xFF, 0x2D, 0x01,
+  0x85, 0x03, 0xF4, 0x8E, 0x9C, 0xF3, 0x03, 0x02, 0x83, 0xC0, 0xB8, 0xC7, 0xBF, 0x03, 0x83, 0x89,
+  0xE3, 0xF1, 0x88, 0x03, 0x80, 0x52, 0x41, 0x80, 0x51, 0x03, 0x80, 0x1B, 0x41, 0x80, 0x1B, 0x03,
+  0x82, 0x15, 0xFF, 0xEA, 0x04, 0x82, 0x40, 0xFF, 0xBF, 0x04, 0x82, 0x6B, 0xFF, 0x94, 0x04, 0x82,
+  0x96, 0xFF, 0x6A, 0x04, 0x82, 0xC0, 0xFF, 0x3F, 0x04, 0x82, 0xEB, 0xFF, 0x15, 0x02, 0x00, 0x41,
+  0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x10, 0x82, 0xE5, 0xFF, 0x14, 0x01,
+  0x85, 0x15, 0xFF, 0xE4, 0xAE, 0xFF, 0x3E, 0x01, 0x85, 0x41, 0xFF, 0xAD, 0x77, 0xFF, 0x68, 0x01,
+  0x85, 0x6D, 0xFF, 0x76, 0x40, 0xFF, 0x92, 0x01, 0x85, 0x98, 0xFF, 0x3F, 0x0C, 0xFD, 0xBC, 0x01,
+  0x85, 0xC3, 0xFC, 0x0C, 0x00, 0xD2, 0xE6, 0x01, 0x81, 0xEE, 0xD1, 0x01, 0x85, 0x9C, 0xFF, 0x10,
+  0x1A, 0xFF, 0x9A, 0x01, 0x85, 0x65, 0xFF, 0x3A, 0x45, 0xFF, 0x64, 0x01, 0x85, 0x2E, 0xFF, 0x64,
+  0x71, 0xFF, 0x2D, 0x01, 0x85, 0x03, 0xF4, 0x8E, 0x9C, 0xF3, 0x03, 0x02, 0x83, 0xC0, 0xB8, 0xC7,
+  0xBF, 0x03, 0x83, 0x89, 0xE3, 0xF1, 0x88, 0x03, 0x80, 0x52, 0x41, 0x80, 0x51, 0x03, 0x80, 0x1B,
+  0x41, 0x80, 0x1B, 0x03, 0x82, 0x15, 0xFF, 0xEA, 0x04, 0x82, 0x40, 0xFF, 0xBF, 0x04, 0x82, 0x6B,
+  0xFF, 0x94, 0x04, 0x82, 0x96, 0xFF, 0x6A, 0x04, 0x82, 0xC0, 0xFF, 0x3F, 0x04, 0x82, 0xEB, 0xFF,
+  0x15, 0x02, 0x5B, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41,
+  0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x01, 0x82, 0x05, 0x96, 0x00, 0x41, 0x00, 0x83,
+  0x14, 0xBF, 0xFF, 0x00, 0x41, 0x84, 0x2D, 0xDE, 0xFD, 0x7A, 0x00, 0x41, 0x82, 0xF3, 0xF2, 0x4E,
+  0x01, 0x41, 0x81, 0xDE, 0x2C, 0x02, 0x41, 0x80, 0x13, 0x03, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x4D, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+  0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x81, 0x08,
+  0x9B, 0x41, 0x81, 0xCD, 0xFD, 0x41, 0x81, 0xEC, 0x46, 0x41, 0x81, 0x1F, 0x00, 0x41, 0x01, 0x41,
+  0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x82, 0x13, 0xA8, 0xF3, 0x4C,
+  0x80, 0xAC, 0x4E, 0x81, 0xF4, 0xFF, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41,
+  0x06, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41,
+  0x06, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x4A, 0x04, 0x4A, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41,
+  0x06, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41,
+  0x06, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41, 0x06, 0x81, 0xF4, 0xFF, 0x04, 0x41, 0x06, 0x80,
+  0xAD, 0x4E, 0x82, 0x14, 0xAA, 0xF4, 0x4C, 0x82, 0x2A, 0xC3, 0xF6, 0x47, 0x83, 0xF6, 0xC3, 0x2A,
+  0xC4, 0x4B, 0x82, 0xC3, 0xF7, 0xFF, 0x03, 0x41, 0x03, 0x40, 0x80, 0xF6, 0x41, 0x03, 0x41, 0x03,
+  0x43, 0x03, 0x41, 0x03, 0x43, 0x03, 0x41, 0x03, 0x43, 0x03, 0x49, 0x03, 0x46, 0x80, 0xC9, 0x41,
+  0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x81, 0xF7, 0xFF, 0x03, 0x41,
+  0x03, 0x40, 0x81, 0xF6, 0xC4, 0x4B, 0x83, 0xC3, 0x2B, 0xC4, 0xF7, 0x47, 0x82, 0xF7, 0xC4, 0x2A,
+  0x00, 0x86, 0xB4, 0xD6, 0x49, 0x00, 0x46, 0xD2, 0xB2, 0x01, 0x86, 0x05, 0xA9, 0xFF, 0xDB, 0xFF,
+  0xA3, 0x04, 0x02, 0x84, 0x02, 0x9C, 0xFF, 0x93, 0x01, 0x13, 0x82, 0x18, 0xB1, 0xF4, 0x42, 0x83,
+  0xF4, 0xB2, 0x18, 0xB2, 0x46, 0x82, 0xB2, 0xF5, 0xFF, 0x04, 0x40, 0x80, 0xF4, 0x41, 0x04, 0x43,
+  0x04, 0x43, 0x04, 0x41, 0x82, 0xEF, 0xFF, 0x1A, 0x03, 0x41, 0x83, 0x90, 0xFF, 0xCB, 0x09, 0x04,
+  0x84, 0x08, 0xCA, 0xFF, 0xA9, 0x01, 0x04, 0x83, 0x19, 0xE4, 0xFF, 0x80, 0x05, 0x83, 0x33, 0xF6,
+  0xFE, 0x57, 0x05, 0x83, 0x55, 0xFE, 0xF6, 0x34, 0x05, 0x83, 0x7F, 0xFF, 0xE5, 0x1B, 0x04, 0x84,
+  0x01, 0xA9, 0xFF, 0xCC, 0x0A, 0x04, 0x83, 0x09, 0xCB, 0xFF, 0x94, 0x05, 0x82, 0x1A, 0xFF, 0xEF,
+  0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x81, 0xF5, 0xFF, 0x04, 0x40, 0x81, 0xF4,
+  0xB3, 0x46, 0x83, 0xB3, 0x1A, 0xB3, 0xF5, 0x42, 0x82, 0xF5, 0xB4, 0x1A, 0x00, 0x8E, 0xB4, 0xD6,
+  0x49, 0x00, 0x46, 0xD2, 0xB2, 0x00, 0x05, 0xA9, 0xFF, 0xDB, 0xFF, 0xA3, 0x04, 0x01, 0x84, 0x02,
+  0x9C, 0xFF, 0x93, 0x01, 0x10, 0x82, 0x0F, 0x94, 0xEB, 0x41, 0x83, 0xEA, 0x93, 0x0E, 0xAC, 0x45,
+  0x82, 0xAB, 0xF5, 0xFF, 0x03, 0x40, 0x80, 0xF4, 0x41, 0x03, 0x41, 0x83, 0xE4, 0xFF, 0x74, 0x01,
+  0x03, 0x84, 0x49, 0xF3, 0xFF, 0xB4, 0x13, 0x03, 0x84, 0x27, 0xD2, 0xFF, 0xE3, 0x3C, 0x03, 0x85,
+  0x09, 0x9A, 0xFF, 0xFC, 0x79, 0x01, 0x03, 0x83, 0x59, 0xF2, 0xFF, 0x93, 0x41, 0x02, 0x82, 0x26,
+  0xFF, 0xF4, 0x41, 0x03, 0x41, 0x81, 0xF5, 0xFF, 0x03, 0x40, 0x81, 0xF4, 0xAD, 0x45, 0x83, 0xAC,
+  0x0F, 0x96, 0xED, 0x41, 0x82, 0xED, 0x96, 0x0F, 0x02, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41,
+  0x05, 0x41, 0x01, 0x41, 0x1A, 0x82, 0xDD, 0xFF, 0x2C, 0x05, 0x85, 0x2C, 0xFF, 0xDC, 0x82, 0xFF,
+  0x85, 0x05, 0x85, 0x85, 0xFF, 0x81, 0x27, 0xFF, 0xDE, 0x05, 0x86, 0xDD, 0xFF, 0x26, 0x00, 0xCB,
+  0xFF, 0x38, 0x03, 0x82, 0x36, 0xFF, 0xCA, 0x01, 0x82, 0x70, 0xFF, 0x91, 0x03, 0x82, 0x8F, 0xFF,
+  0x6F, 0x01, 0x83, 0x17, 0xFC, 0xE7, 0x03, 0x01, 0x83, 0x02, 0xE5, 0xFC, 0x17, 0x02, 0x82, 0xB9,
+  0xFF, 0x43, 0x01, 0x82, 0x40, 0xFF, 0xB8, 0x03, 0x82, 0x5E, 0xFF, 0x9D, 0x01, 0x82, 0x99, 0xFF,
+  0x5D, 0x03, 0x87, 0x0C, 0xF5, 0xEF, 0x06, 0x04, 0xEC, 0xF5, 0x0C, 0x04, 0x85, 0xA4, 0xFF, 0x4F,
+  0x4A, 0xFF, 0xA3, 0x05, 0x85, 0x3F, 0xFF, 0xA8, 0xA2, 0xFF, 0x3B, 0x06, 0x83, 0xD9, 0xF5, 0xF2,
+  0xDC, 0x07, 0x80, 0x83, 0x41, 0x80, 0x84, 0x07, 0x80, 0x31, 0x41, 0x80, 0x30, 0x08, 0x41, 0x09,
+  0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x04,
+  0x00, 0x8E, 0xB4, 0xD6, 0x49, 0x00, 0x46, 0xD2, 0xB2, 0x00, 0x05, 0xA9, 0xFF, 0xDB, 0xFF, 0xA3,
+  0x04, 0x01, 0x84, 0x02, 0x9C, 0xFF, 0x93, 0x01, 0x11, 0x46, 0x00, 0x45, 0x80, 0xE9, 0x04, 0x82,
+  0x26, 0xFF, 0x9E, 0x04, 0x82, 0x75, 0xFF, 0x50, 0x04, 0x82, 0xC3, 0xF7, 0x0B, 0x03, 0x82, 0x13,
+  0xFC, 0xB5, 0x04, 0x82, 0x5F, 0xFF, 0x67, 0x04, 0x82, 0xAD, 0xFE, 0x1A, 0x03, 0x82, 0x07, 0xF3,
+  0xCC, 0x04, 0x82, 0x49, 0xFF, 0x7E, 0x04, 0x82, 0x97, 0xFF, 0x30, 0x04, 0x81, 0xE3, 0xE1, 0x04,
+  0x82, 0x32, 0xFF, 0x94, 0x04, 0x82, 0x80, 0xFF, 0x47, 0x04, 0x82, 0xCE, 0xF2, 0x06, 0x03, 0x82,
+  0x1C, 0xFF, 0xAB, 0x04, 0x82, 0x6A, 0xFF, 0x5D, 0x04, 0x82, 0xB8, 0xFC, 0x13, 0x03, 0x82, 0x0C,
+  0xF8, 0xC2, 0x04, 0x82, 0x54, 0xFF, 0x74, 0x04, 0x82, 0xA2, 0xFF, 0x26, 0x04, 0x80, 0xEC, 0x4E,
+  0x00, 0x8E, 0xB4, 0xD6, 0x49, 0x00, 0x46, 0xD2, 0xB2, 0x00, 0x05, 0xA9, 0xFF, 0xDB, 0xFF, 0xA3,
+  0x04, 0x01, 0x84, 0x02, 0x9C, 0xFF, 0x93, 0x01, 0x11, 0x46, 0x00, 0x45, 0x80, 0xD1, 0x04, 0x82,
+  0x90, 0xFF, 0x4C, 0x03, 0x82, 0x1D, 0xF8, 0xC4, 0x04, 0x82, 0x9C, 0xFF, 0x3D, 0x03, 0x82, 0x26,
+  0xFC, 0xB6, 0x04, 0x82, 0xA9, 0xFE, 0x31, 0x03, 0x82, 0x30, 0xFE, 0xA8, 0x04, 0x82, 0xB6, 0xFB,
+  0x25, 0x03, 0x82, 0x3C, 0xFF, 0x99, 0x04, 0x82, 0xC2, 0xF7, 0x1B, 0x03, 0x82, 0x4A, 0xFF, 0x8B,
+  0x04, 0x80, 0xCE, 0x4E, 0x05, 0x81, 0x63, 0xEE, 0x41, 0x80, 0xF2, 0x04, 0x81, 0x01, 0xEE, 0x42,
+  0x80, 0xD8, 0x04, 0x82, 0x1E, 0xFF, 0xEB, 0x07, 0x82, 0x45, 0xFF, 0xC3, 0x07, 0x82, 0x6B, 0xFF,
+  0x9B, 0x07, 0x82, 0x92, 0xFF, 0x73, 0x07, 0x82, 0xB8, 0xFF, 0x4B, 0x07, 0x82, 0xDF, 0xFF, 0x23,
+  0x06, 0x83, 0x07, 0xFD, 0xF8, 0x03, 0x05, 0x80, 0xDA, 0x44, 0x80, 0x4A, 0x02, 0x81, 0x02, 0xF9,
+  0x44, 0x80, 0x28, 0x04, 0x82, 0x79, 0xFF, 0x83, 0x07, 0x82, 0xA3, 0xFF, 0x5A, 0x07, 0x82, 0xCD,
+  0xFF, 0x31, 0x06, 0x83, 0x01, 0xF4, 0xFE, 0x0A, 0x06, 0x82, 0x20, 0xFF, 0xE0, 0x07, 0x82, 0x4A,
+  0xFF, 0xB7, 0x07, 0x82, 0x74, 0xFF, 0x8F, 0x07, 0x82, 0x9E, 0xFF, 0x66, 0x07, 0x82, 0xC7, 0xFF,
+  0x3D, 0x07, 0x82, 0xF0, 0xFF, 0x14, 0x06, 0x82, 0x1B, 0xFF, 0xEC, 0x07, 0x82, 0x45, 0xFF, 0xC3,
+  0x07, 0x82, 0x6E, 0xFF, 0x9A, 0x07, 0x82, 0x98, 0xFF, 0x72, 0x07, 0x82, 0xC2, 0xFF, 0x49, 0x07,
+  0x82, 0xEB, 0xFF, 0x20, 0x05, 0x80, 0xE0, 0x41, 0x81, 0xF0, 0x01, 0x05, 0x83, 0xF5, 0xFF, 0xF5,
+  0x70, 0x06, 0x00, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05,
+  0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0xB4, 0xD6, 0x49, 0x00, 0x46, 0xD2, 0xB2, 0x05, 0xA9,
+  0xFF, 0xDB, 0xFF, 0xA3, 0x04, 0x00, 0x02, 0x9C, 0xFF, 0x93, 0x01, 0x00, 0x41, 0x01, 0x41, 0x81,
+  0xFD, 0xFF, 0x01, 0x40, 0x82, 0xFD, 0xAE, 0xFD, 0x41, 0x81, 0xFD, 0xAD, 0x48, 0x2A, 0xC3, 0xF6,
+  0xF6, 0xC3, 0x2A, 0xC4, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0xEE, 0xFF, 0x00, 0x00, 0xFF, 0xED, 0xC4,
+  0xFF, 0x00, 0x00, 0xFF, 0xC3, 0x2B, 0xC4, 0xF7, 0xF7, 0xC4, 0x2A, 0x00, 0x8B, 0x7D, 0xFF, 0xAD,
+  0x00, 0x6E, 0xFF, 0xCD, 0x0A, 0x00, 0xEF, 0xFF, 0x1A, 0x01, 0x41, 0x02, 0x80, 0xC1, 0x43, 0x84,
+  0x66, 0xEC, 0xE9, 0x98, 0x32, 0x41, 0x80, 0xEC, 0x44, 0x80, 0xEC, 0x41, 0x84, 0x32, 0x97, 0xE9,
+  0xEC, 0x66, 0x00, 0x7D, 0xFF, 0x8A, 0x00, 0x7D, 0xFF, 0x8A, 0x24, 0xF7, 0x86, 0x00, 0x24, 0xF7,
+  0x86, 0x00, 0xBC, 0x82, 0x00, 0x00, 0xBC, 0x82, 0x00, 0x00, 0x00, 0x81, 0x81, 0xF7, 0x47, 0x81,
+  0xF5, 0x7B, 0x01, 0x80, 0xF8, 0x44, 0x85, 0xFE, 0xFE, 0xFD, 0xFD, 0xFF, 0xF7, 0x01, 0x41, 0x07,
+  0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07,
+  0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07,
+  0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07,
+  0x41, 0x01, 0x81, 0xF8, 0xFF, 0x07, 0x40, 0x80, 0xF8, 0x01, 0x81, 0x82, 0xF8, 0x42, 0x01, 0x42,
+  0x81, 0xF8, 0x82, 0x04, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07,
+  0x41, 0x01, 0x41, 0x03, 0x45, 0x01, 0x4B, 0x01, 0x45, 0x53, 0x01, 0x41, 0x01, 0x41, 0x03, 0x41,
+  0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41,
+  0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41,
+  0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x01, 0x55, 0x61, 0x00, 0x24, 0xED, 0x00, 0x6E, 0xC8, 0x00,
+  0xB7, 0xA4, 0x09, 0xF6, 0x7F, 0x49, 0xFF, 0x5B, 0x92, 0xFF, 0x36, 0xDB, 0xFF, 0x12, 0x12, 0xFF,
+  0xDA, 0x37, 0xFF, 0x91, 0x5C, 0xFF, 0x48, 0x80, 0xF6, 0x09, 0xA5, 0xB6, 0x00, 0xC9, 0x6D, 0x00,
+  0xEE, 0x24, 0x00, 0x12, 0xFF, 0xDA, 0x37, 0xFF, 0x91, 0x5C, 0xFF, 0x48, 0x80, 0xF6, 0x09, 0xA5,
+  0xB6, 0x00, 0xC9, 0x6D, 0x00, 0xEE, 0x24, 0x00, 0x00, 0x24, 0xED, 0x00, 0x00, 0x24, 0xED, 0x00,
+  0x6E, 0xC8, 0x00, 0x00, 0x6E, 0xC8, 0x00, 0xB7, 0xA4, 0x00, 0x00, 0xB7, 0xA4, 0x09, 0xF6, 0x7F,
+  0x00, 0x09, 0xF6, 0x7F, 0x49, 0xFF, 0x5B, 0x00, 0x49, 0xFF, 0x5B, 0x92, 0xFF, 0x36, 0x00, 0x92,
+  0xFF, 0x36, 0xDB, 0xFF, 0x12, 0x00, 0xDB, 0xFF, 0x12, 0x12, 0xFF, 0xDA, 0x00, 0x12, 0xFF, 0xDA,
+  0x37, 0xFF, 0x91, 0x00, 0x37, 0xFF, 0x91, 0x5C, 0xFF, 0x48, 0x00, 0x5C, 0xFF, 0x48, 0x80, 0xF6,
+  0x09, 0x00, 0x80, 0xF6, 0x09, 0xA5, 0xB6, 0x00, 0x00, 0xA5, 0xB6, 0x00, 0xC9, 0x6D, 0x00, 0x00,
+  0xC9, 0x6D, 0x00, 0xEE, 0x24, 0x00, 0x00, 0xEE, 0x24, 0x00, 0x12, 0xFF, 0xDA, 0x00, 0x12, 0xFF,
+  0xDA, 0x37, 0xFF, 0x91, 0x00, 0x37, 0xFF, 0x91, 0x5C, 0xFF, 0x48, 0x00, 0x5C, 0xFF, 0x48, 0x80,
+  0xF6, 0x09, 0x00, 0x80, 0xF6, 0x09, 0xA5, 0xB6, 0x00, 0x00, 0xA5, 0xB6, 0x00, 0xC9, 0x6D, 0x00,
+  0x00, 0xC9, 0x6D, 0x00, 0xEE, 0x24, 0x00, 0x00, 0xEE, 0x24, 0x00, 0x03, 0x41, 0x07, 0x41, 0x07,
+  0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x03, 0x53, 0x03, 0x41, 0x07, 0x41, 0x07,
+  0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07,
+  0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x03, 0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+  0x07, 0x41, 0x07, 0x41, 0x03, 0x53, 0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+  0x07, 0x41, 0x07, 0x41, 0x03, 0x53, 0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+  0x07, 0x41, 0x03, 0x82, 0x10, 0xA0, 0xF0, 0x42, 0x83, 0xF0, 0xA0, 0x10, 0xA1, 0x46, 0x81, 0xA0,
+  0xF0, 0x46, 0x80, 0xF0, 0x5A, 0x80, 0xF0, 0x46, 0x81, 0xF5, 0xA1, 0x46, 0x83, 0xB8, 0x10, 0xA1,
+  0xF0, 0x42, 0x82, 0xF2, 0xAD, 0x1C, 0x41, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02, 0x43, 0x02,
+  0x41, 0x02, 0x41, 0x0D, 0x81, 0x10, 0x10, 0x09, 0x82, 0x07, 0x95, 0xF1, 0x41, 0x82, 0xF2, 0xA0,
+  0x0C, 0x04, 0x82, 0x4C, 0xFF, 0xC5, 0x09, 0x80, 0x93, 0x45, 0x80, 0x9F, 0x03, 0x83, 0x01, 0xD0,
+  0xFF, 0x3F, 0x09, 0x81, 0xF1, 0xFF, 0x03, 0x40, 0x80, 0xF2, 0x03, 0x82, 0x58, 0xFF, 0xB8, 0x0A,
+  0x41, 0x03, 0x41, 0x02, 0x83, 0x04, 0xDA, 0xFE, 0x33, 0x0A, 0x41, 0x03, 0x41, 0x02, 0x82, 0x65,
+  0xFF, 0xAB, 0x0B, 0x41, 0x03, 0x41, 0x01, 0x83, 0x07, 0xE2, 0xFC, 0x28, 0x0B, 0x41, 0x03, 0x41,
+  0x01, 0x82, 0x72, 0xFF, 0x9F, 0x0C, 0x41, 0x03, 0x41, 0x00, 0x83, 0x0C, 0xEA, 0xF9, 0x1F, 0x0C,
+  0x41, 0x03, 0x41, 0x00, 0x82, 0x7E, 0xFF, 0x92, 0x0D, 0x81, 0xF2, 0xFF, 0x03, 0x40, 0x84, 0xF3,
+  0x12, 0xF1, 0xF4, 0x17, 0x0D, 0x80, 0x9A, 0x45, 0x83, 0xA7, 0x8B, 0xFF, 0x86, 0x0E, 0x82, 0x0A,
+  0x9C, 0xF2, 0x41, 0x83, 0xF4, 0xA9, 0x2B, 0xFE, 0x43, 0x82, 0xF2, 0xA0, 0x0C, 0x01, 0x82, 0x07,
+  0x95, 0xF1, 0x41, 0x82, 0xF2, 0xA0, 0x0C, 0x06, 0x80, 0x97, 0x46, 0x80, 0x9F, 0x01, 0x80, 0x93,
+  0x45, 0x80, 0x9F, 0x05, 0x81, 0x22, 0xFA, 0x41, 0x03, 0x40, 0x80, 0xF2, 0x01, 0x81, 0xF1, 0xFF,
+  0x03, 0x40, 0x80, 0xF2, 0x05, 0x80, 0xA4, 0x42, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x04, 0x82,
+  0x2C, 0xFD, 0xE0, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x04, 0x82, 0xB1, 0xFF, 0x60, 0x41,
+  0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x03, 0x83, 0x37, 0xFF, 0xD7, 0x03, 0x41, 0x03, 0x41, 0x01,
+  0x41, 0x03, 0x41, 0x03, 0x83, 0xBD, 0xFF, 0x53, 0x00, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41,
+  0x02, 0x84, 0x43, 0xFF, 0xCC, 0x01, 0x00, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x02, 0x82,
+  0xC8, 0xFF, 0x47, 0x01, 0x81, 0xF2, 0xFF, 0x03, 0x40, 0x80, 0xF3, 0x01, 0x81, 0xF2, 0xFF, 0x03,
+  0x40, 0x80, 0xF3, 0x01, 0x82, 0x50, 0xFF, 0xC0, 0x02, 0x80, 0x9A, 0x45, 0x80, 0xA7, 0x01, 0x80,
+  0x9A, 0x45, 0x80, 0xA7, 0x01, 0x82, 0xC3, 0xF0, 0x3A, 0x02, 0x82, 0x0A, 0x9C, 0xF2, 0x41, 0x82,
+  0xF4, 0xA9, 0x11, 0x01, 0x82, 0x0A, 0x9C, 0xF2, 0x41, 0x82, 0xF4, 0xA9, 0x11, 0x02, 0x82, 0x62,
+  0xFF, 0xB4, 0x01, 0x88, 0x2F, 0xF6, 0xE3, 0x13, 0x00, 0x0E, 0xDB, 0xFC, 0x3D, 0x01, 0x82, 0xAD,
+  0xFF, 0x7B, 0x01, 0x83, 0x73, 0xFF, 0xBB, 0x02, 0x01, 0x82, 0xF6, 0xFF, 0x2E, 0x02, 0x83, 0x73,
+  0xFF, 0xB8, 0x01, 0x02, 0x82, 0xAE, 0xFF, 0x74, 0x02, 0x83, 0x0F, 0xDB, 0xFA, 0x33, 0x02, 0x83,
+  0x2F, 0xF7, 0xDB, 0x0C, 0x02, 0x82, 0x62, 0xFF, 0xA2, 0x82, 0xA3, 0xFF, 0x62, 0x02, 0x83, 0x0D,
+  0xDB, 0xF6, 0x2F, 0x02, 0x83, 0x34, 0xFA, 0xDB, 0x0E, 0x02, 0x82, 0x75, 0xFF, 0xAD, 0x02, 0x83,
+  0x01, 0xB9, 0xFF, 0x72, 0x02, 0x82, 0x2F, 0xFF, 0xF6, 0x01, 0x83, 0x02, 0xBB, 0xFF, 0x72, 0x01,
+  0x82, 0x7C, 0xFF, 0xAE, 0x01, 0x88, 0x3D, 0xFC, 0xDB, 0x0E, 0x00, 0x13, 0xE3, 0xF6, 0x2F, 0x01,
+  0x82, 0xB4, 0xFF, 0x62, 0x02, 0x0A, 0x82, 0x43, 0xFF, 0xCC, 0x0A, 0x82, 0xC8, 0xFF, 0x47, 0x09,
+  0x82, 0x50, 0xFF, 0xC0, 0x09, 0x83, 0x02, 0xD3, 0xFF, 0x3A, 0x09, 0x82, 0x5D, 0xFF, 0xB4, 0x09,
+  0x83, 0x05, 0xDD, 0xFE, 0x2F, 0x09, 0x82, 0x69, 0xFF, 0xA7, 0x09, 0x83, 0x09, 0xE5, 0xFB, 0x25,
+  0x09, 0x82, 0x76, 0xFF, 0x9B, 0x09, 0x83, 0x0E, 0xED, 0xF8, 0x1D, 0x09, 0x82, 0x82, 0xFF, 0x8E,
+  0x09, 0x83, 0x15, 0xF3, 0xF3, 0x15, 0x09, 0x82, 0x8F, 0xFF, 0x81, 0x09, 0x83, 0x1D, 0xF8, 0xED,
+  0x0E, 0x09, 0x82, 0x9C, 0xFF, 0x75, 0x09, 0x83, 0x25, 0xFB, 0xE5, 0x09, 0x09, 0x82, 0xA8, 0xFF,
+  0x68, 0x09, 0x83, 0x2F, 0xFE, 0xDD, 0x05, 0x09, 0x82, 0xB5, 0xFF, 0x5C, 0x09, 0x83, 0x3A, 0xFF,
+  0xD3, 0x02, 0x09, 0x82, 0xC0, 0xFF, 0x4F, 0x09, 0x82, 0x48, 0xFF, 0xC8, 0x0A, 0x82, 0xCC, 0xFF,
+  0x43, 0x0A, 0x00, 0x81, 0x53, 0xE6, 0x45, 0x83, 0xE6, 0x51, 0x00, 0xE7, 0x47, 0x81, 0xE7, 0x00,
+  0x41, 0x05, 0x41, 0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x08, 0x41, 0x08,
+  0x41, 0x07, 0x49, 0x00, 0x49, 0x01, 0x41, 0x08, 0x41, 0x07, 0x49, 0x00, 0x49, 0x01, 0x41, 0x08,
+  0x41, 0x08, 0x41, 0x08, 0x41, 0x05, 0x41, 0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x05, 0x41, 0x00,
+  0x41, 0x05, 0x41, 0x00, 0x80, 0xE8, 0x47, 0x83, 0xE6, 0x00, 0x56, 0xE8, 0x45, 0x81, 0xE7, 0x53,
+  0x46, 0x81, 0xFE, 0x1A, 0x01, 0x82, 0x04, 0xF8, 0xFF, 0x01, 0x41, 0x01, 0x41, 0x80, 0x66, 0x01,
+  0x80, 0x2D, 0x41, 0x01, 0x41, 0x01, 0x41, 0x80, 0xB3, 0x01, 0x80, 0x5D, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x83, 0xF6, 0x09, 0x00, 0x8E, 0x41, 0x01, 0x41, 0x01, 0x42, 0x82, 0x4C, 0x00, 0xBE, 0x41,
+  0x01, 0x41, 0x01, 0x41, 0x83, 0xDD, 0x99, 0x00, 0xDB, 0x41, 0x01, 0x41, 0x01, 0x41, 0x83, 0x8A,
+  0xE5, 0x20, 0xBE, 0x41, 0x01, 0x41, 0x01, 0x41, 0x83, 0x36, 0xFF, 0x82, 0x90, 0x41, 0x01, 0x41,
+  0x01, 0x41, 0x00, 0x82, 0xE1, 0xF0, 0x62, 0x41, 0x01, 0x41, 0x01, 0x41, 0x00, 0x82, 0x8E, 0xFF,
+  0x33, 0x41, 0x01, 0x41, 0x01, 0x41, 0x00, 0x82, 0x3A, 0xFC, 0x08, 0x41, 0x01, 0x41, 0x01, 0x41,
+  0x00, 0x82, 0x01, 0xBB, 0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x82, 0xC2, 0xFF,
+  0x3F, 0x05, 0x82, 0x47, 0xFF, 0xBE, 0x06, 0x82, 0xCB, 0xFF, 0x3E, 0x05, 0x82, 0x51, 0xFF, 0xBD,
+  0x05, 0x83, 0x01, 0xD4, 0xFF, 0x3D, 0x05, 0x82, 0x5B, 0xFF, 0xBC, 0x05, 0x83, 0x03, 0xDC, 0xFF,
+  0x3B, 0x05, 0x82, 0x64, 0xFF, 0xBB, 0x05, 0x83, 0x06, 0xE3, 0xFF, 0x3A, 0x05, 0x84, 0x6E, 0xFF,
+  0xBA, 0x7B, 0xF7, 0x46, 0x80, 0xF6, 0x49, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04,
+  0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x41, 0x80, 0xF6, 0x46, 0x82, 0xF6, 0x7B, 0xF7,
+  0x44, 0x81, 0xF7, 0x7B, 0x03, 0x82, 0x94, 0xFF, 0xA1, 0x07, 0x82, 0xCA, 0xFF, 0xD6, 0x06, 0x84,
+  0x07, 0xF9, 0xFF, 0xFD, 0x0E, 0x05, 0x80, 0x38, 0x42, 0x80, 0x42, 0x05, 0x84, 0x6F, 0xFF, 0xCB,
+  0xFF, 0x78, 0x05, 0x84, 0xA6, 0xFF, 0x62, 0xFF, 0xAE, 0x05, 0x84, 0xDC, 0xF7, 0x09, 0xF7, 0xE4,
+  0x04, 0x86, 0x13, 0xFF, 0xC7, 0x00, 0xC8, 0xFF, 0x1B, 0x03, 0x86, 0x4A, 0xFF, 0x92, 0x00, 0x93,
+  0xFF, 0x52, 0x03, 0x86, 0x81, 0xFF, 0x5D, 0x00, 0x5E, 0xFF, 0x88, 0x03, 0x86, 0xB8, 0xFF, 0x29,
+  0x00, 0x2A, 0xFF, 0xBF, 0x03, 0x87, 0xED, 0xF2, 0x02, 0x00, 0x02, 0xF2, 0xF3, 0x02, 0x01, 0x82,
+  0x25, 0xFF, 0xBF, 0x02, 0x82, 0xC0, 0xFF, 0x2C, 0x01, 0x82, 0x5C, 0xFF, 0x8A, 0x02, 0x82, 0x8B,
+  0xFF, 0x62, 0x01, 0x82, 0x93, 0xFF, 0x56, 0x02, 0x82, 0x57, 0xFF, 0x98, 0x01, 0x82, 0xCA, 0xFF,
+  0x21, 0x02, 0x86, 0x22, 0xFF, 0xCE, 0x00, 0x07, 0xF9, 0xEC, 0x04, 0x85, 0xEC, 0xFB, 0x09, 0x38,
+  0xFF, 0xB8, 0x04, 0x85, 0xB9, 0xFF, 0x3A, 0x6E, 0xFF, 0x83, 0x04, 0x85, 0x84, 0xFF, 0x71, 0xA5,
+  0xFF, 0x4E, 0x04, 0x85, 0x4F, 0xFF, 0xA6, 0xDC, 0xFF, 0x1A, 0x04, 0x82, 0x1A, 0xFF, 0xDA, 0x49,
+  0x80, 0xFE, 0x4A, 0x55, 0x01, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41,
+  0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41,
+  0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41,
+  0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41,
+  0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41,
+  0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x01, 0x51, 0x82, 0xA7, 0xFF, 0x59, 0x05, 0x83,
+  0x0E, 0xDC, 0xEE, 0x1B, 0x05, 0x83, 0x33, 0xF9, 0xBB, 0x01, 0x05, 0x82, 0x70, 0xFF, 0x6F, 0x06,
+  0x82, 0xB1, 0xF7, 0x29, 0x05, 0x83, 0x12, 0xE2, 0xCD, 0x05, 0x05, 0x82, 0x3C, 0xFC, 0x85, 0x06,
+  0x82, 0x7B, 0xFC, 0x3A, 0x05, 0x82, 0x02, 0xBB, 0xDC, 0x06, 0x81, 0x2F, 0xFF, 0x05, 0x82, 0x01,
+  0xB7, 0xDD, 0x05, 0x82, 0x71, 0xFC, 0x3A, 0x04, 0x82, 0x30, 0xF8, 0x85, 0x04, 0x83, 0x0A, 0xD7,
+  0xCE, 0x05, 0x04, 0x82, 0x9A, 0xF7, 0x2A, 0x04, 0x82, 0x52, 0xFF, 0x6F, 0x04, 0x83, 0x1C, 0xED,
+  0xBC, 0x01, 0x03, 0x83, 0x02, 0xC0, 0xEF, 0x1C, 0x04, 0x82, 0x7C, 0xFF, 0x59, 0x05, 0x80, 0xFB,
+  0x50, 0x07, 0x82, 0x1C, 0xFF, 0xE1, 0x07, 0x82, 0x55, 0xFF, 0xA4, 0x07, 0x82, 0x8D, 0xFF, 0x67,
+  0x07, 0x82, 0xC5, 0xFF, 0x2B, 0x06, 0x83, 0x05, 0xF7, 0xED, 0x01, 0x06, 0x82, 0x35, 0xFF, 0xB1,
+  0x07, 0x82, 0x6D, 0xFF, 0x75, 0x07, 0x82, 0xA5, 0xFF, 0x38, 0x07, 0x82, 0xDD, 0xF6, 0x05, 0x06,
+  0x82, 0x15, 0xFF, 0xBF, 0x07, 0x82, 0x4D, 0xFF, 0x82, 0x07, 0x82, 0x85, 0xFF, 0x45, 0x07, 0x82,
+  0xBD, 0xFC, 0x0C, 0x06, 0x82, 0x02, 0xF2, 0xCC, 0x07, 0x82, 0x2D, 0xFF, 0x8F, 0x02, 0x82, 0xC3,
+  0xFF, 0x39, 0x01, 0x82, 0x65, 0xFF, 0x52, 0x02, 0x82, 0x4A, 0xFF, 0xAC, 0x01, 0x82, 0x9D, 0xFF,
+  0x16, 0x03, 0x85, 0xCF, 0xFD, 0x22, 0x00, 0xD5, 0xD9, 0x04, 0x85, 0x57, 0xFF, 0x92, 0x0E, 0xFD,
+  0x9C, 0x04, 0x85, 0x02, 0xDA, 0xF4, 0x56, 0xFF, 0x60, 0x05, 0x84, 0x64, 0xFF, 0xE5, 0xFF, 0x23,
+  0x05, 0x83, 0x06, 0xE4, 0xFF, 0xE6, 0x07, 0x82, 0x71, 0xFF, 0xAA, 0x04, 0x81, 0x98, 0xFC, 0x41,
+  0x81, 0xFA, 0x72, 0x02, 0x81, 0x65, 0xF8, 0x41, 0x82, 0xFC, 0x97, 0xF9, 0x43, 0x84, 0xFD, 0x32,
+  0x00, 0x26, 0xF9, 0x43, 0x81, 0xF8, 0xFF, 0x02, 0x86, 0x6D, 0xFF, 0xBD, 0x00, 0xAE, 0xFF, 0x65,
+  0x02, 0x41, 0x02, 0x86, 0x01, 0xC4, 0xFF, 0x7F, 0xFF, 0xC1, 0x01, 0x02, 0x41, 0x03, 0x84, 0x27,
+  0xF7, 0xFF, 0xF7, 0x26, 0x03, 0x41, 0x04, 0x82, 0xA1, 0xFF, 0xA8, 0x04, 0x41, 0x03, 0x84, 0x23,
+  0xF6, 0xFF, 0xFA, 0x2C, 0x03, 0x41, 0x03, 0x85, 0xBC, 0xFF, 0x73, 0xFF, 0xC6, 0x02, 0x02, 0x41,
+  0x02, 0x86, 0x5F, 0xFF, 0xB2, 0x00, 0xB0, 0xFF, 0x6B, 0x02, 0x40, 0x80, 0xF9, 0x43, 0x84, 0xFC,
+  0x2C, 0x00, 0x27, 0xFA, 0x43, 0x82, 0xF8, 0x98, 0xFC, 0x41, 0x81, 0xFB, 0x7E, 0x02, 0x81, 0x66,
+  0xF9, 0x41, 0x81, 0xFC, 0x98, 0x02, 0x81, 0x82, 0xF5, 0x42, 0x02, 0x80, 0xF3, 0x43, 0x02, 0x81,
+  0xFD, 0xFF, 0x05, 0x81, 0xFD, 0xFF, 0x05, 0x81, 0xFD, 0xFF, 0x05, 0x81, 0xFD, 0xFF, 0x05, 0x81,
+  0xFD, 0xFF, 0x05, 0x81, 0xFD, 0xFF, 0x05, 0x81, 0xFE, 0xFF, 0x05, 0x81, 0xFE, 0xFF, 0x05, 0x81,
+  0xFE, 0xFF, 0x05, 0x81, 0xFE, 0xFF, 0x05, 0x81, 0xFE, 0xFF, 0x05, 0x81, 0xFE, 0xFF, 0x05, 0x81,
+  0xFE, 0xFF, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41,
+  0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x02, 0x43, 0x80, 0xF6, 0x02, 0x40,
+  0x83, 0xFE, 0xFD, 0xF1, 0x75, 0x02, 0x84, 0xBF, 0xF0, 0xC3, 0x77, 0x24, 0x02, 0x46, 0x82, 0xD0,
+  0x7D, 0x29, 0x43, 0x82, 0x2A, 0x7E, 0xD1, 0x46, 0x02, 0x84, 0x25, 0x78, 0xC3, 0xF0, 0xBF, 0x13,
+  0x84, 0xBF, 0xF0, 0xC3, 0x77, 0x24, 0x02, 0x46, 0x82, 0xD0, 0x7D, 0x29, 0x43, 0x82, 0x2A, 0x7E,
+  0xD1, 0x46, 0x02, 0x84, 0x25, 0x78, 0xC3, 0xF0, 0xBF, 0x05, 0x81, 0x25, 0xB6, 0x07, 0x81, 0x70,
+  0xB4, 0x07, 0x81, 0xBA, 0x68, 0x06, 0x82, 0x0B, 0xF8, 0x1D, 0x06, 0x81, 0x4F, 0xD1, 0x02, 0x53,
+  0x03, 0x81, 0x1E, 0xD4, 0x07, 0x81, 0x5C, 0x97, 0x07, 0x81, 0x99, 0x5A, 0x07, 0x81, 0xD6, 0x1E,
+  0x03, 0x53, 0x02, 0x81, 0xD2, 0x51, 0x06, 0x82, 0x1E, 0xF9, 0x0D, 0x06, 0x81, 0x69, 0xBB, 0x07,
+  0x81, 0xB5, 0x70, 0x07, 0x81, 0xB6, 0x25, 0x05, 0x04, 0x81, 0x0E, 0xA4, 0x03, 0x82, 0x3B, 0xDF,
+  0xFF, 0x01, 0x90, 0x04, 0x81, 0xFC, 0xEF, 0x59, 0x00, 0x22, 0xC7, 0xFF, 0xBE, 0x1D, 0x00, 0x5F,
+  0xF2, 0xF8, 0x73, 0x01, 0x01, 0x41, 0x80, 0x5B, 0x03, 0x84, 0x64, 0xF4, 0xF8, 0x72, 0x01, 0x02,
+  0x84, 0x27, 0xCD, 0xFF, 0xBD, 0x1D, 0x02, 0x84, 0x06, 0x8C, 0xFE, 0xEF, 0x59, 0x03, 0x82, 0x44,
+  0xE6, 0xFF, 0x04, 0x81, 0x14, 0xB2, 0x06, 0x4D, 0x81, 0xB1, 0x13, 0x04, 0x40, 0x81, 0xE5, 0x43,
+  0x03, 0x84, 0x5A, 0xEF, 0xFE, 0x89, 0x05, 0x02, 0x84, 0x1D, 0xBE, 0xFF, 0xCA, 0x24, 0x02, 0x84,
+  0x01, 0x73, 0xF8, 0xF3, 0x5F, 0x03, 0x80, 0x5B, 0x41, 0x01, 0x90, 0x01, 0x72, 0xF8, 0xF3, 0x63,
+  0x00, 0x1D, 0xBE, 0xFF, 0xC9, 0x24, 0x00, 0x59, 0xEF, 0xFC, 0x84, 0x04, 0x01, 0x40, 0x81, 0xE0,
+  0x3C, 0x03, 0x81, 0xA5, 0x0F, 0x0B, 0x4D, 0x03, 0x82, 0x55, 0xFF, 0x5C, 0x06, 0x84, 0x15, 0xEA,
+  0xFF, 0xED, 0x18, 0x05, 0x84, 0xAB, 0xFC, 0x65, 0xFC, 0xAF, 0x04, 0x86, 0x55, 0xFF, 0x8B, 0x00,
+  0x8C, 0xFF, 0x59, 0x02, 0x88, 0x15, 0xEA, 0xDE, 0x0A, 0x00, 0x0A, 0xDE, 0xEC, 0x16, 0x01, 0x82,
+  0xAB, 0xFF, 0x46, 0x02, 0x86, 0x46, 0xFF, 0xAC, 0x00, 0x55, 0xFF, 0xA2, 0x04, 0x85, 0xA3, 0xFF,
+  0x56, 0xD5, 0xFF, 0x28, 0x04, 0x85, 0x29, 0xFF, 0xD5, 0x55, 0xFF, 0xA2, 0x04, 0x86, 0xA3, 0xFF,
+  0x56, 0x00, 0xAB, 0xFF, 0x45, 0x02, 0x82, 0x46, 0xFF, 0xAC, 0x01, 0x88, 0x15, 0xEA, 0xDE, 0x0A,
+  0x00, 0x0A, 0xDE, 0xEC, 0x16, 0x02, 0x86, 0x55, 0xFF, 0x8B, 0x00, 0x8C, 0xFF, 0x59, 0x04, 0x84,
+  0xAB, 0xFC, 0x64, 0xFC, 0xB0, 0x05, 0x84, 0x15, 0xEA, 0xFF, 0xED, 0x18, 0x06, 0x82, 0x55, 0xFF,
+  0x5C, 0x03, 0x01, 0x82, 0x2A, 0xC3, 0xF6, 0x41, 0x82, 0xF6, 0xC3, 0x2A, 0x01, 0x80, 0xC4, 0x45,
+  0x80, 0xC3, 0x01, 0x81, 0xF7, 0xFF, 0x03, 0x40, 0x80, 0xF6, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41,
+  0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x07, 0x41, 0x07, 0x41, 0x05, 0x53, 0x01, 0x41,
+  0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41,
+  0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41,
+  0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x82,
+  0x2A, 0xC3, 0xF6, 0x44, 0x01, 0x80, 0xC4, 0x46, 0x01, 0x81, 0xF7, 0xFF, 0x03, 0x41, 0x01, 0x41,
+  0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41,
+  0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x80, 0xA8, 0x44, 0x01, 0x41, 0x80, 0xA8, 0x44, 0x01, 0x41,
+  0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41,
+  0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41,
+  0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41,
+  0xE9, 0x00, 0x2A, 0x00, 0x20, 0x00, 0x09, 0x00, 0x21, 0x00, 0x05, 0x20, 0x08, 0x20, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x09, 0x0A, 0x0D, 0x20, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x14, 0x20, 0x16, 0x20, 0x01, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0D, 0x26,
+  0x11, 0x23, 0x02, 0x00, 0x3C, 0x02, 0x00, 0x00, 0x25, 0x00, 0x18, 0x20, 0x1C, 0x20, 0x02, 0x00,
+  0x0E, 0x03, 0x00, 0x00, 0x26, 0x00, 0x10, 0x20, 0x12, 0x20, 0x02, 0x00, 0x63, 0x04, 0x00, 0x00,
+  0x27, 0x00, 0x03, 0x0A, 0x07, 0x20, 0x02, 0x01, 0x3B, 0x05, 0x00, 0x00, 0x28, 0x00, 0x08, 0x24,
+  0x0B, 0x20, 0x02, 0x00, 0x59, 0x05, 0x00, 0x00, 0x29, 0x00, 0x07, 0x24, 0x0B, 0x20, 0x02, 0x00,
+  0x2B, 0x06, 0x00, 0x00, 0x2A, 0x00, 0x0C, 0x0D, 0x11, 0x20, 0x02, 0x00, 0xE7, 0x06, 0x00, 0x00,
+  0x2B, 0x00, 0x0F, 0x0E, 0x11, 0x15, 0x01, 0x00, 0x62, 0x07, 0x00, 0x00, 0x2C, 0x00, 0x04, 0x06,
+  0x07, 0x04, 0x01, 0x01, 0x7D, 0x07, 0x00, 0x00, 0x2D, 0x00, 0x08, 0x03, 0x0C, 0x0E, 0x02, 0x00,
+  0x95, 0x07, 0x00, 0x00, 0x2E, 0x00, 0x03, 0x04, 0x08, 0x04, 0x02, 0x00, 0x96, 0x07, 0x00, 0x00,
+  0x2F, 0x00, 0x10, 0x20, 0x12, 0x20, 0x01, 0x00, 0x97, 0x07, 0x00, 0x00, 0x30, 0x00, 0x0D, 0x20,
+  0x12, 0x20, 0x02, 0x00, 0x5C, 0x08, 0x00, 0x00, 0x31, 0x00, 0x04, 0x20, 0x09, 0x20, 0x02, 0x00,
+  0xB3, 0x08, 0x00, 0x00, 0x32, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x33, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0x9D, 0x09, 0x00, 0x00, 0x34, 0x00, 0x0E, 0x20,
+  0x10, 0x20, 0x01, 0x00, 0x67, 0x0A, 0x00, 0x00, 0x35, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00,
+  0x18, 0x0B, 0x00, 0x00, 0x36, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0x91, 0x0B, 0x00, 0x00,
+  0x37, 0x00, 0x0D, 0x20, 0x0D, 0x20, 0x00, 0x00, 0xED, 0x0B, 0x00, 0x00, 0x38, 0x00, 0x0D, 0x20,
+  0x12, 0x20, 0x02, 0x00, 0xAA, 0x0C, 0x00, 0x00, 0x39, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00,
+  0x97, 0x0D, 0x00, 0x00, 0x3A, 0x00, 0x03, 0x11, 0x07, 0x11, 0x02, 0x00, 0xEF, 0x0D, 0x00, 0x00,
+  0x3B, 0x00, 0x04, 0x13, 0x07, 0x11, 0x01, 0x00, 0xF2, 0x0D, 0x00, 0x00, 0x3C, 0x00, 0x0A, 0x11,
+  0x0E, 0x16, 0x02, 0x00, 0x14, 0x0E, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x0B, 0x13, 0x12, 0x02, 0x00,
+  0x82, 0x0E, 0x00, 0x00, 0x3E, 0x00, 0x0A, 0x11, 0x0E, 0x16, 0x02, 0x00, 0x86, 0x0E, 0x00, 0x00,
+  0x3F, 0x00, 0x0C, 0x20, 0x11, 0x20, 0x02, 0x00, 0xF4, 0x0E, 0x00, 0x00, 0x40, 0x00, 0x11, 0x20,
+  0x16, 0x20, 0x02, 0x00, 0x5F, 0x0F, 0x00, 0x00, 0x41, 0x00, 0x0F, 0x20, 0x0F, 0x20, 0x00, 0x00,
+  0xF8, 0x0F, 0x00, 0x00, 0x42, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0x28, 0x11, 0x00, 0x00,
+  0x43, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0xBD, 0x11, 0x00, 0x00, 0x44, 0x00, 0x0D, 0x20,
+  0x12, 0x20, 0x02, 0x00, 0x14, 0x12, 0x00, 0x00, 0x45, 0x00, 0x0B, 0x20, 0x0F, 0x20, 0x02, 0x00,
+  0x90, 0x12, 0x00, 0x00, 0x46, 0x00, 0x0A, 0x20, 0x0D, 0x20, 0x02, 0x00, 0xC5, 0x12, 0x00, 0x00,
+  0x47, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0xFF, 0x12, 0x00, 0x00, 0x48, 0x00, 0x0D, 0x20,
+  0x12, 0x20, 0x02, 0x00, 0x56, 0x13, 0x00, 0x00, 0x49, 0x00, 0x03, 0x20, 0x08, 0x20, 0x02, 0x00,
+  0x91, 0x13, 0x00, 0x00, 0x4A, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0x93, 0x13, 0x00, 0x00,
+  0x4B, 0x00, 0x0D, 0x20, 0x0F, 0x20, 0x02, 0x00, 0xDE, 0x13, 0x00, 0x00, 0x4C, 0x00, 0x0A, 0x20,
+  0x0C, 0x20, 0x02, 0x00, 0xDA, 0x14, 0x00, 0x00, 0x4D, 0x00, 0x11, 0x20, 0x16, 0x20, 0x02, 0x00,
+  0x15, 0x15, 0x00, 0x00, 0x4E, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0x24, 0x16, 0x00, 0x00,
+  0x4F, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0xD5, 0x16, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x20,
+  0x12, 0x20, 0x02, 0x00, 0x2C, 0x17, 0x00, 0x00, 0x51, 0x00, 0x0F, 0x20, 0x12, 0x20, 0x02, 0x00,
+  0x76, 0x17, 0x00, 0x00, 0x52, 0x00, 0x0E, 0x20, 0x12, 0x20, 0x02, 0x00, 0x1B, 0x18, 0x00, 0x00,
+  0x53, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0xE7, 0x18, 0x00, 0x00, 0x54, 0x00, 0x0D, 0x20,
+  0x0D, 0x20, 0x00, 0x00, 0x82, 0x19, 0x00, 0x00, 0x55, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00,
+  0xBE, 0x19, 0x00, 0x00, 0x56, 0x00, 0x0F, 0x20, 0x0F, 0x20, 0x00, 0x00, 0x0A, 0x1A, 0x00, 0x00,
+  0x57, 0x00, 0x17, 0x20, 0x17, 0x20, 0x00, 0x00, 0x4D, 0x1B, 0x00, 0x00, 0x58, 0x00, 0x0F, 0x20,
+  0x0F, 0x20, 0x00, 0x00, 0x7B, 0x1D, 0x00, 0x00, 0x59, 0x00, 0x0F, 0x20, 0x0F, 0x20, 0x00, 0x00,
+  0xC6, 0x1E, 0x00, 0x00, 0x5A, 0x00, 0x0C, 0x20, 0x0C, 0x20, 0x00, 0x00, 0xA5, 0x1F, 0x00, 0x00,
+  0x5B, 0x00, 0x08, 0x25, 0x0C, 0x20, 0x03, 0x00, 0x45, 0x20, 0x00, 0x00, 0x5C, 0x00, 0x10, 0x20,
+  0x12, 0x20, 0x01, 0x00, 0x98, 0x20, 0x00, 0x00, 0x5D, 0x00, 0x08, 0x25, 0x0C, 0x20, 0x01, 0x00,
+  0x57, 0x21, 0x00, 0x00, 0x5E, 0x00, 0x0D, 0x0B, 0x11, 0x20, 0x02, 0x00, 0xAA, 0x21, 0x00, 0x00,
+  0x5F, 0x00, 0x0F, 0x03, 0x0F, 0xFB, 0x00, 0x00, 0x0F, 0x22, 0x00, 0x00, 0x60, 0x00, 0x06, 0x05,
+  0x11, 0x1B, 0x06, 0x01, 0x10, 0x22, 0x00, 0x00, 0x61, 0x00, 0x0C, 0x14, 0x10, 0x14, 0x02, 0x00,
+  0x2E, 0x22, 0x00, 0x00, 0x62, 0x00, 0x0C, 0x20, 0x10, 0x20, 0x02, 0x00, 0x7D, 0x22, 0x00, 0x00,
+  0x63, 0x00, 0x0C, 0x14, 0x10, 0x14, 0x02, 0x00, 0xE4, 0x22, 0x00, 0x00, 0x64, 0x00, 0x0C, 0x20,
+  0x10, 0x20, 0x02, 0x00, 0x27, 0x23, 0x00, 0x00, 0x65, 0x00, 0x0C, 0x14, 0x10, 0x14, 0x02, 0x00,
+  0x9C, 0x23, 0x00, 0x00, 0x66, 0x00, 0x08, 0x20, 0x09, 0x20, 0x00, 0x00, 0xDE, 0x23, 0x00, 0x00,
+  0x67, 0x00, 0x0C, 0x1D, 0x10, 0x14, 0x02, 0x00, 0x25, 0x24, 0x00, 0x00, 0x68, 0x00, 0x0C, 0x20,
+  0x10, 0x20, 0x02, 0x00, 0xAB, 0x24, 0x00, 0x00, 0x69, 0x00, 0x05, 0x1C, 0x07, 0x1C, 0x01, 0x00,
+  0x05, 0x25, 0x00, 0x00, 0x6A, 0x00, 0x07, 0x25, 0x07, 0x1C, 0xFF, 0x00, 0x3F, 0x25, 0x00, 0x00,
+  0x6B, 0x00, 0x0B, 0x20, 0x0D, 0x20, 0x02, 0x00, 0x99, 0x25, 0x00, 0x00, 0x6C, 0x00, 0x03, 0x20,
+  0x07, 0x20, 0x02, 0x00, 0x44, 0x26, 0x00, 0x00, 0x6D, 0x00, 0x15, 0x14, 0x19, 0x14, 0x02, 0x00,
+  0x46, 0x26, 0x00, 0x00, 0x6E, 0x00, 0x0C, 0x14, 0x10, 0x14, 0x02, 0x00, 0xC3, 0x26, 0x00, 0x00,
+  0x6F, 0x00, 0x0C, 0x14, 0x10, 0x14, 0x02, 0x00, 0x05, 0x27, 0x00, 0x00, 0x70, 0x00, 0x0C, 0x1D,
+  0x10, 0x14, 0x02, 0x00, 0x48, 0x27, 0x00, 0x00, 0x71, 0x00, 0x0C, 0x1D, 0x10, 0x14, 0x02, 0x00,
+  0xB2, 0x27, 0x00, 0x00, 0x72, 0x00, 0x0C, 0x14, 0x0E, 0x14, 0x02, 0x00, 0x25, 0x28, 0x00, 0x00,
+  0x73, 0x00, 0x0C, 0x14, 0x10, 0x14, 0x02, 0x00, 0x66, 0x28, 0x00, 0x00, 0x74, 0x00, 0x08, 0x1B,
+  0x08, 0x1B, 0x00, 0x00, 0xDC, 0x28, 0x00, 0x00, 0x75, 0x00, 0x0C, 0x14, 0x10, 0x14, 0x02, 0x00,
+  0x18, 0x29, 0x00, 0x00, 0x76, 0x00, 0x0D, 0x14, 0x0D, 0x14, 0x00, 0x00, 0x5A, 0x29, 0x00, 0x00,
+  0x77, 0x00, 0x17, 0x14, 0x17, 0x14, 0x00, 0x00, 0x1B, 0x2A, 0x00, 0x00, 0x78, 0x00, 0x0D, 0x14,
+  0x0D, 0x14, 0x00, 0x00, 0x77, 0x2B, 0x00, 0x00, 0x79, 0x00, 0x0D, 0x1D, 0x0D, 0x14, 0x00, 0x00,
+  0x43, 0x2C, 0x00, 0x00, 0x7A, 0x00, 0x0B, 0x14, 0x0F, 0x14, 0x02, 0x00, 0x3A, 0x2D, 0x00, 0x00,
+  0x7B, 0x00, 0x0B, 0x25, 0x0E, 0x20, 0x02, 0x00, 0xA9, 0x2D, 0x00, 0x00, 0x7C, 0x00, 0x03, 0x27,
+  0x09, 0x20, 0x03, 0x00, 0x3B, 0x2E, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0x25, 0x0E, 0x20, 0x02, 0x00,
+  0x3D, 0x2E, 0x00, 0x00, 0x7E, 0x00, 0x0E, 0x06, 0x15, 0x0F, 0x03, 0x00, 0xD4, 0x2E, 0x00, 0x00,
+  0xA0, 0x00, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x03, 0x2F, 0x00, 0x00, 0xA1, 0x00, 0x05, 0x20,
+  0x08, 0x20, 0x02, 0x00, 0x04, 0x2F, 0x00, 0x00, 0xA2, 0x00, 0x0D, 0x20, 0x10, 0x20, 0x02, 0x00,
+  0x84, 0x2F, 0x00, 0x00, 0xA3, 0x00, 0x0E, 0x20, 0x11, 0x20, 0x01, 0x00, 0x0B, 0x30, 0x00, 0x00,
+  0xA4, 0x00, 0x14, 0x14, 0x1A, 0x19, 0x03, 0x00, 0x65, 0x30, 0x00, 0x00, 0xA5, 0x00, 0x0F, 0x20,
+  0x11, 0x20, 0x01, 0x00, 0x07, 0x31, 0x00, 0x00, 0xA6, 0x00, 0x03, 0x2B, 0x08, 0x22, 0x03, 0x00,
+  0xE4, 0x31, 0x00, 0x00, 0xA7, 0x00, 0x0D, 0x20, 0x12, 0x20, 0x02, 0x00, 0xE7, 0x31, 0x00, 0x00,
+  0xA8, 0x00, 0x08, 0x04, 0x11, 0x1A, 0x04, 0x00, 0xB9, 0x32, 0x00, 0x00, 0xA9, 0x00, 0x13, 0x20,
+  0x18, 0x20, 0x02, 0x00, 0xC2, 0x32, 0x00, 0x00, 0xAA, 0x00, 0x0B, 0x15, 0x10, 0x20, 0x02, 0x00,
+  0x65, 0x33, 0x00, 0x00, 0xAB, 0x00, 0x0F, 0x11, 0x13, 0x14, 0x02, 0x00, 0xD7, 0x33, 0x00, 0x00,
+  0xAC, 0x00, 0x0F, 0x09, 0x13, 0x10, 0x02, 0x00, 0xB1, 0x34, 0x00, 0x00, 0xAD, 0x00, 0x0E, 0x02,
+  0x13, 0x0F, 0x02, 0x00, 0xBE, 0x34, 0x00, 0x00, 0xAE, 0x00, 0x13, 0x20, 0x18, 0x20, 0x02, 0x00,
+  0xBF, 0x34, 0x00, 0x00, 0xAF, 0x00, 0x09, 0x02, 0x11, 0x18, 0x04, 0x00, 0x80, 0x35, 0x00, 0x00,
+  0xB0, 0x00, 0x0A, 0x10, 0x0E, 0x20, 0x02, 0x00, 0x81, 0x35, 0x00, 0x00, 0xB1, 0x00, 0x0F, 0x12,
+  0x11, 0x16, 0x01, 0x00, 0xBC, 0x35, 0x00, 0x00, 0xB4, 0x00, 0x06, 0x05, 0x11, 0x1B, 0x05, 0x00,
+  0xE4, 0x35, 0x00, 0x00, 0xB5, 0x00, 0x0C, 0x1C, 0x10, 0x14, 0x02, 0x00, 0x01, 0x36, 0x00, 0x00,
+  0xB6, 0x00, 0x0E, 0x20, 0x13, 0x20, 0x02, 0x00, 0x48, 0x36, 0x00, 0x00, 0xB7, 0x00, 0x03, 0x04,
+  0x08, 0x0F, 0x02, 0x00, 0xAC, 0x36, 0x00, 0x00, 0xB8, 0x00, 0x07, 0x08, 0x11, 0x00, 0x05, 0x00,
+  0xAD, 0x36, 0x00, 0x00, 0xBA, 0x00, 0x0B, 0x15, 0x10, 0x20, 0x02, 0x00, 0xD5, 0x36, 0x00, 0x00,
+  0xBB, 0x00, 0x0F, 0x11, 0x13, 0x14, 0x02, 0x00, 0x12, 0x37, 0x00, 0x00, 0xBF, 0x00, 0x0C, 0x20,
+  0x11, 0x20, 0x02, 0x00, 0xF0, 0x37, 0x00, 0x00, 0xC0, 0x00, 0x0F, 0x27, 0x0F, 0x27, 0x00, 0x00,
+  0x6D, 0x38, 0x00, 0x00, 0xC1, 0x00, 0x0F, 0x27, 0x0F, 0x27, 0x00, 0x00, 0xBD, 0x39, 0x00, 0x00,
+  0xC2, 0x00, 0x0F, 0x27, 0x0F, 0x27, 0x00, 0x00, 0x0D, 0x3B, 0x00, 0x00, 0xC3, 0x00, 0x0F, 0x26,
+  0x0F, 0x26, 0x00, 0x00, 0x67, 0x3C, 0x00, 0x00, 0xC4, 0x00, 0x0F, 0x26, 0x0F, 0x26, 0x00, 0x00,
+  0xBB, 0x3D, 0x00, 0x00, 0xC5, 0x00, 0x0F, 0x27, 0x0F, 0x27, 0x00, 0x00, 0xFB, 0x3E, 0x00, 0x00,
+  0xC6, 0x00, 0x15, 0x20, 0x17, 0x20, 0x00, 0x00, 0x5B, 0x40, 0x00, 0x00, 0xC7, 0x00, 0x0D, 0x28,
+  0x12, 0x20, 0x02, 0x00, 0x3A, 0x41, 0x00, 0x00, 0xC8, 0x00, 0x0B, 0x27, 0x0F, 0x27, 0x02, 0x00,
+  0xC0, 0x41, 0x00, 0x00, 0xC9, 0x00, 0x0B, 0x27, 0x0F, 0x27, 0x02, 0x00, 0x16, 0x42, 0x00, 0x00,
+  0xCA, 0x00, 0x0B, 0x27, 0x0F, 0x27, 0x02, 0x00, 0x6C, 0x42, 0x00, 0x00, 0xCB, 0x00, 0x0B, 0x26,
+  0x0F, 0x26, 0x02, 0x00, 0xCC, 0x42, 0x00, 0x00, 0xCC, 0x00, 0x06, 0x27, 0x08, 0x27, 0x00, 0x00,
+  0x12, 0x43, 0x00, 0x00, 0xCD, 0x00, 0x06, 0x27, 0x08, 0x27, 0x02, 0x00, 0x71, 0x43, 0x00, 0x00,
+  0xCE, 0x00, 0x09, 0x27, 0x08, 0x27, 0xFF, 0x00, 0xCE, 0x43, 0x00, 0x00, 0xCF, 0x00, 0x08, 0x26,
+  0x08, 0x26, 0x00, 0x00, 0x36, 0x44, 0x00, 0x00, 0xD1, 0x00, 0x0D, 0x26, 0x12, 0x26, 0x02, 0x00,
+  0x80, 0x44, 0x00, 0x00, 0xD2, 0x00, 0x0D, 0x27, 0x12, 0x27, 0x02, 0x00, 0x56, 0x45, 0x00, 0x00,
+  0xD3, 0x00, 0x0D, 0x27, 0x12, 0x27, 0x02, 0x00, 0xCE, 0x45, 0x00, 0x00, 0xD4, 0x00, 0x0D, 0x27,
+  0x12, 0x27, 0x02, 0x00, 0x46, 0x46, 0x00, 0x00, 0xD5, 0x00, 0x0D, 0x26, 0x12, 0x26, 0x02, 0x00,
+  0xC8, 0x46, 0x00, 0x00, 0xD6, 0x00, 0x0D, 0x26, 0x12, 0x26, 0x02, 0x00, 0x44, 0x47, 0x00, 0x00,
+  0xD7, 0x00, 0x0D, 0x0D, 0x13, 0x14, 0x03, 0x00, 0xAC, 0x47, 0x00, 0x00, 0xD8, 0x00, 0x13, 0x20,
+  0x12, 0x20, 0x00, 0x00, 0x2F, 0x48, 0x00, 0x00, 0xD9, 0x00, 0x0D, 0x27, 0x12, 0x27, 0x02, 0x00,
+  0x27, 0x49, 0x00, 0x00, 0xDA, 0x00, 0x0D, 0x27, 0x12, 0x27, 0x02, 0x00, 0x94, 0x49, 0x00, 0x00,
+  0xDB, 0x00, 0x0D, 0x27, 0x12, 0x27, 0x02, 0x00, 0x01, 0x4A, 0x00, 0x00, 0xDC, 0x00, 0x0D, 0x26,
+  0x12, 0x26, 0x02, 0x00, 0x78, 0x4A, 0x00, 0x00, 0xDD, 0x00, 0x0F, 0x27, 0x0F, 0x27, 0x00, 0x00,
+  0xD5, 0x4A, 0x00, 0x00, 0xDF, 0x00, 0x0C, 0x20, 0x11, 0x20, 0x02, 0x00, 0xD5, 0x4B, 0x00, 0x00,
+  0xE0, 0x00, 0x0C, 0x1B, 0x10, 0x1B, 0x02, 0x00, 0x67, 0x4C, 0x00, 0x00, 0xE1, 0x00, 0x0C, 0x1B,
+  0x10, 0x1B, 0x02, 0x00, 0xD7, 0x4C, 0x00, 0x00, 0xE2, 0x00, 0x0C, 0x1B, 0x10, 0x1B, 0x02, 0x00,
+  0x47, 0x4D, 0x00, 0x00, 0xE3, 0x00, 0x0C, 0x1A, 0x10, 0x1A, 0x02, 0x00, 0xC1, 0x4D, 0x00, 0x00,
+  0xE4, 0x00, 0x0C, 0x1A, 0x10, 0x1A, 0x02, 0x00, 0x35, 0x4E, 0x00, 0x00, 0xE5, 0x00, 0x0C, 0x1E,
+  0x10, 0x1E, 0x02, 0x00, 0x95, 0x4E, 0x00, 0x00, 0xE6, 0x00, 0x15, 0x14, 0x19, 0x14, 0x02, 0x00,
+  0x1D, 0x4F, 0x00, 0x00, 0xE7, 0x00, 0x0C, 0x1C, 0x10, 0x14, 0x02, 0x00, 0xAE, 0x4F, 0x00, 0x00,
+  0xE8, 0x00, 0x0C, 0x1B, 0x10, 0x1B, 0x02, 0x00, 0x20, 0x50, 0x00, 0x00, 0xE9, 0x00, 0x0C, 0x1B,
+  0x10, 0x1B, 0x02, 0x00, 0x83, 0x50, 0x00, 0x00, 0xEA, 0x00, 0x0C, 0x1B, 0x10, 0x1B, 0x02, 0x00,
+  0xE6, 0x50, 0x00, 0x00, 0xEB, 0x00, 0x0C, 0x1A, 0x10, 0x1A, 0x02, 0x00, 0x53, 0x51, 0x00, 0x00,
+  0xEC, 0x00, 0x06, 0x1B, 0x07, 0x1B, 0xFF, 0x00, 0xA6, 0x51, 0x00, 0x00, 0xED, 0x00, 0x07, 0x1B,
+  0x07, 0x1B, 0x02, 0x00, 0xEC, 0x51, 0x00, 0x00, 0xEE, 0x00, 0x09, 0x1B, 0x07, 0x1B, 0xFF, 0x00,
+  0x34, 0x52, 0x00, 0x00, 0xEF, 0x00, 0x08, 0x1A, 0x07, 0x1A, 0x00, 0x00, 0x84, 0x52, 0x00, 0x00,
+  0xF1, 0x00, 0x0C, 0x1A, 0x10, 0x1A, 0x02, 0x00, 0xB6, 0x52, 0x00, 0x00, 0xF2, 0x00, 0x0C, 0x1B,
+  0x10, 0x1B, 0x02, 0x00, 0x1D, 0x53, 0x00, 0x00, 0xF3, 0x00, 0x0C, 0x1B, 0x10, 0x1B, 0x02, 0x00,
+  0x81, 0x53, 0x00, 0x00, 0xF4, 0x00, 0x0C, 0x1B, 0x10, 0x1B, 0x02, 0x00, 0xE5, 0x53, 0x00, 0x00,
+  0xF5, 0x00, 0x0C, 0x1A, 0x10, 0x1A, 0x02, 0x00, 0x53, 0x54, 0x00, 0x00, 0xF6, 0x00, 0x0C, 0x1A,
+  0x10, 0x1A, 0x02, 0x00, 0xBB, 0x54, 0x00, 0x00, 0xF7, 0x00, 0x0E, 0x0F, 0x11, 0x16, 0x01, 0x00,
+  0x0F, 0x55, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x14, 0x10, 0x14, 0x00, 0x00, 0x42, 0x55, 0x00, 0x00,
+  0xF9, 0x00, 0x0C, 0x1B, 0x10, 0x1B, 0x02, 0x00, 0xDD, 0x55, 0x00, 0x00, 0xFA, 0x00, 0x0C, 0x1B,
+  0x10, 0x1B, 0x02, 0x00, 0x3F, 0x56, 0x00, 0x00, 0xFB, 0x00, 0x0C, 0x1B, 0x10, 0x1B, 0x02, 0x00,
+  0xA2, 0x56, 0x00, 0x00, 0xFC, 0x00, 0x0C, 0x1A, 0x10, 0x1A, 0x02, 0x00, 0x0F, 0x57, 0x00, 0x00,
+  0xFD, 0x00, 0x0D, 0x24, 0x0D, 0x1B, 0x00, 0x00, 0x62, 0x57, 0x00, 0x00, 0xFF, 0x00, 0x0D, 0x23,
+  0x0D, 0x1A, 0x00, 0x00, 0x7A, 0x58, 0x00, 0x00, 0x31, 0x01, 0x03, 0x14, 0x07, 0x14, 0x02, 0x00,
+  0x82, 0x59, 0x00, 0x00, 0x41, 0x01, 0x0B, 0x20, 0x0C, 0x20, 0x01, 0x00, 0x83, 0x59, 0x00, 0x00,
+  0x42, 0x01, 0x06, 0x20, 0x07, 0x20, 0x01, 0x00, 0xE4, 0x59, 0x00, 0x00, 0x52, 0x01, 0x14, 0x20,
+  0x19, 0x20, 0x02, 0x00, 0x32, 0x5A, 0x00, 0x00, 0x53, 0x01, 0x14, 0x14, 0x18, 0x14, 0x02, 0x00,
+  0xA9, 0x5A, 0x00, 0x00, 0x60, 0x01, 0x0D, 0x27, 0x12, 0x27, 0x02, 0x00, 0x0B, 0x5B, 0x00, 0x00,
+  0x61, 0x01, 0x0C, 0x1B, 0x10, 0x1B, 0x02, 0x00, 0xD5, 0x5B, 0x00, 0x00, 0x78, 0x01, 0x0F, 0x26,
+  0x0F, 0x26, 0x00, 0x00, 0x7A, 0x5C, 0x00, 0x00, 0x7D, 0x01, 0x0C, 0x27, 0x0C, 0x27, 0x00, 0x00,
+  0x6A, 0x5D, 0x00, 0x00, 0x7E, 0x01, 0x0B, 0x1B, 0x0F, 0x1B, 0x02, 0x00, 0x38, 0x5E, 0x00, 0x00,
+  0x92, 0x01, 0x10, 0x29, 0x0D, 0x20, 0xFD, 0x00, 0xD4, 0x5E, 0x00, 0x00, 0xC6, 0x02, 0x09, 0x05,
+  0x11, 0x1B, 0x04, 0x00, 0xD4, 0x5F, 0x00, 0x00, 0xC7, 0x02, 0x0A, 0x05, 0x11, 0x1B, 0x03, 0x00,
+  0xFB, 0x5F, 0x00, 0x00, 0xD8, 0x02, 0x08, 0x05, 0x11, 0x1B, 0x04, 0x00, 0x26, 0x60, 0x00, 0x00,
+  0xD9, 0x02, 0x04, 0x04, 0x11, 0x1A, 0x07, 0x00, 0x38, 0x60, 0x00, 0x00, 0xDA, 0x02, 0x08, 0x08,
+  0x11, 0x1E, 0x04, 0x00, 0x39, 0x60, 0x00, 0x00, 0xDB, 0x02, 0x07, 0x08, 0x11, 0x00, 0x05, 0x00,
+  0x64, 0x60, 0x00, 0x00, 0xDC, 0x02, 0x09, 0x04, 0x11, 0x1A, 0x04, 0x00, 0x88, 0x60, 0x00, 0x00,
+  0xDD, 0x02, 0x0B, 0x05, 0x11, 0x1B, 0x04, 0x00, 0xA7, 0x60, 0x00, 0x00, 0xA9, 0x03, 0x11, 0x20,
+  0x14, 0x20, 0x02, 0x00, 0xDC, 0x60, 0x00, 0x00, 0xC0, 0x03, 0x0F, 0x12, 0x10, 0x12, 0x01, 0x00,
+  0x8F, 0x61, 0x00, 0x00, 0x13, 0x20, 0x0E, 0x02, 0x12, 0x0E, 0x02, 0x00, 0xCD, 0x61, 0x00, 0x00,
+  0x14, 0x20, 0x17, 0x02, 0x1B, 0x0E, 0x02, 0x00, 0xCE, 0x61, 0x00, 0x00, 0x18, 0x20, 0x04, 0x0A,
+  0x07, 0x20, 0x01, 0x01, 0xCF, 0x61, 0x00, 0x00, 0x19, 0x20, 0x04, 0x0A, 0x07, 0x20, 0x02, 0x01,
+  0xF7, 0x61, 0x00, 0x00, 0x1A, 0x20, 0x04, 0x0A, 0x07, 0x05, 0x01, 0x01, 0x1F, 0x62, 0x00, 0x00,
+  0x1C, 0x20, 0x0A, 0x0A, 0x0D, 0x20, 0x01, 0x00, 0x47, 0x62, 0x00, 0x00, 0x1D, 0x20, 0x0A, 0x0A,
+  0x0D, 0x20, 0x02, 0x00, 0xA7, 0x62, 0x00, 0x00, 0x1E, 0x20, 0x0A, 0x0A, 0x0D, 0x05, 0x02, 0x00,
+  0x07, 0x63, 0x00, 0x00, 0x20, 0x20, 0x0F, 0x20, 0x12, 0x20, 0x02, 0x00, 0x67, 0x63, 0x00, 0x00,
+  0x21, 0x20, 0x0F, 0x20, 0x12, 0x20, 0x02, 0x00, 0xA4, 0x63, 0x00, 0x00, 0x22, 0x20, 0x0C, 0x0C,
+  0x12, 0x16, 0x03, 0x00, 0xDD, 0x63, 0x00, 0x00, 0x26, 0x20, 0x11, 0x04, 0x15, 0x04, 0x02, 0x00,
+  0x01, 0x64, 0x00, 0x00, 0x30, 0x20, 0x25, 0x21, 0x29, 0x21, 0x02, 0x00, 0x12, 0x64, 0x00, 0x00,
+  0x39, 0x20, 0x08, 0x11, 0x0C, 0x14, 0x02, 0x00, 0xC3, 0x65, 0x00, 0x00, 0x3A, 0x20, 0x08, 0x11,
+  0x0C, 0x14, 0x02, 0x00, 0x30, 0x66, 0x00, 0x00, 0x44, 0x20, 0x14, 0x20, 0x07, 0x20, 0xFA, 0x00,
+  0x9F, 0x66, 0x00, 0x00, 0xAC, 0x20, 0x0E, 0x20, 0x11, 0x20, 0x00, 0x00, 0x50, 0x67, 0x00, 0x00,
+  0x22, 0x21, 0x14, 0x12, 0x17, 0x20, 0x01, 0x00, 0xB6, 0x67, 0x00, 0x00, 0x02, 0x22, 0x0D, 0x20,
+  0x13, 0x20, 0x03, 0x00, 0x71, 0x68, 0x00, 0x00, 0x06, 0x22, 0x0F, 0x20, 0x11, 0x20, 0x01, 0x00,
+  0xFF, 0x68, 0x00, 0x00, 0x0F, 0x22, 0x10, 0x20, 0x10, 0x20, 0x01, 0x00, 0x25, 0x6A, 0x00, 0x00,
+  0x11, 0x22, 0x0B, 0x20, 0x0F, 0x20, 0x02, 0x00, 0x9B, 0x6A, 0x00, 0x00, 0x1A, 0x22, 0x10, 0x20,
+  0x12, 0x20, 0x01, 0x00, 0x34, 0x6B, 0x00, 0x00, 0x1E, 0x22, 0x17, 0x0F, 0x19, 0x12, 0x01, 0x00,
+  0x15, 0x6C, 0x00, 0x00, 0x2B, 0x22, 0x0B, 0x28, 0x0A, 0x20, 0xFF, 0x00, 0xD0, 0x6C, 0x00, 0x00,
+  0x48, 0x22, 0x0E, 0x0E, 0x15, 0x15, 0x03, 0x00, 0x57, 0x6D, 0x00, 0x00, 0x60, 0x22, 0x0E, 0x17,
+  0x13, 0x18, 0x02, 0x00, 0xB6, 0x6D, 0x00, 0x00, 0x64, 0x22, 0x0A, 0x12, 0x0E, 0x15, 0x02, 0x00,
+  0x1D, 0x6E, 0x00, 0x00, 0x65, 0x22, 0x0A, 0x12, 0x0E, 0x15, 0x02, 0x00, 0x7B, 0x6E, 0x00, 0x00,
+  0xCA, 0x25, 0x0F, 0x15, 0x11, 0x16, 0x01, 0x00, 0xD8, 0x6E, 0x00, 0x00, 0x01, 0xFB, 0x0E, 0x20,
+  0x11, 0x20, 0x01, 0x00, 0xAD, 0x6F, 0x00, 0x00, 0x02, 0xFB, 0x0F, 0x20, 0x11, 0x20, 0x00, 0x00,
+  0x2B, 0x70, 0x00, 0x00, 0x80, 0x05, 0x42, 0x82, 0x08, 0x00, 0xFE, 0x41, 0x84, 0x02, 0x00, 0xF8,
+  0xFF, 0xFA, 0x01, 0x82, 0xF1, 0xFF, 0xF4, 0x01, 0x82, 0xEA, 0xFF, 0xED, 0x01, 0x82, 0xE4, 0xFF,
+  0xE6, 0x01, 0x82, 0xDD, 0xFF, 0xE0, 0x01, 0x82, 0xD6, 0xFF, 0xD9, 0x01, 0x82, 0xD0, 0xFF, 0xD2,
+  0x01, 0x82, 0xC9, 0xFF, 0xCC, 0x01, 0x82, 0xC2, 0xFF, 0xC5, 0x01, 0x82, 0xBC, 0xFF, 0xBE, 0x01,
+  0x82, 0xB5, 0xFF, 0xB8, 0x01, 0x82, 0xAE, 0xFF, 0xB1, 0x01, 0x82, 0xA8, 0xFF, 0xAA, 0x01, 0x82,
+  0xA1, 0xFF, 0xA4, 0x01, 0x82, 0x9A, 0xFF, 0x9D, 0x01, 0x82, 0x94, 0xFF, 0x96, 0x01, 0x82, 0x8D,
+  0xFF, 0x90, 0x01, 0x82, 0x86, 0xFF, 0x89, 0x01, 0x82, 0x80, 0xFF, 0x82, 0x01, 0x82, 0x79, 0xFF,
+  0x7C, 0x01, 0x82, 0x72, 0xFF, 0x75, 0x01, 0x82, 0x6B, 0xFF, 0x6F, 0x15, 0x42, 0x01, 0x42, 0x01,
+  0x42, 0x01, 0x42, 0x00, 0x82, 0xF8, 0xFF, 0xF7, 0x02, 0x85, 0xF8, 0xFF, 0xF8, 0xE9, 0xFF, 0xE7,
+  0x02, 0x85, 0xE9, 0xFF, 0xE9, 0xD9, 0xFF, 0xD7, 0x02, 0x85, 0xDA, 0xFF, 0xDA, 0xC9, 0xFF, 0xC7,
+  0x02, 0x85, 0xCB, 0xFF, 0xCB, 0xB9, 0xFF, 0xB7, 0x02, 0x85, 0xBC, 0xFF, 0xBC, 0xA9, 0xFF, 0xA7,
+  0x02, 0x85, 0xAD, 0xFF, 0xAE, 0x99, 0xFF, 0x97, 0x02, 0x85, 0x9D, 0xFF, 0x9F, 0x89, 0xFF, 0x87,
+  0x02, 0x85, 0x8E, 0xFF, 0x90, 0x79, 0xFF, 0x77, 0x02, 0x85, 0x7F, 0xFF, 0x81, 0x68, 0xFF, 0x67,
+  0x02, 0x82, 0x70, 0xFF, 0x73, 0x06, 0x80, 0x17, 0x41, 0x80, 0xE7, 0x02, 0x80, 0x16, 0x41, 0x80,
+  0xE8, 0x08, 0x80, 0x47, 0x41, 0x80, 0xB7, 0x02, 0x80, 0x45, 0x41, 0x80, 0xB9, 0x08, 0x80, 0x76,
+  0x41, 0x80, 0x87, 0x02, 0x80, 0x73, 0x41, 0x80, 0x8A, 0x08, 0x80, 0xA5, 0x41, 0x80, 0x57, 0x02,
+  0x80, 0xA1, 0x41, 0x80, 0x5C, 0x08, 0x80, 0xD4, 0x41, 0x80, 0x27, 0x02, 0x80, 0xCE, 0x41, 0x80,
+  0x2D, 0x07, 0x84, 0x07, 0xFB, 0xFF, 0xF5, 0x02, 0x01, 0x84, 0x03, 0xF7, 0xFF, 0xF9, 0x05, 0x07,
+  0x80, 0x32, 0x41, 0x80, 0xC7, 0x02, 0x80, 0x2A, 0x41, 0x80, 0xD0, 0x08, 0x80, 0x61, 0x41, 0x80,
+  0x97, 0x02, 0x80, 0x58, 0x41, 0x80, 0xA1, 0x08, 0x80, 0x90, 0x41, 0x80, 0x67, 0x02, 0x80, 0x85,
+  0x41, 0x80, 0x73, 0x03, 0x80, 0x38, 0x50, 0x82, 0xB4, 0x00, 0x38, 0x50, 0x80, 0xB4, 0x04, 0x80,
+  0x30, 0x41, 0x80, 0xC8, 0x02, 0x80, 0x28, 0x41, 0x80, 0xD0, 0x08, 0x80, 0x5E, 0x41, 0x80, 0x9A,
+  0x02, 0x80, 0x58, 0x41, 0x80, 0xA1, 0x08, 0x80, 0x8C, 0x41, 0x80, 0x6B, 0x02, 0x80, 0x87, 0x41,
+  0x80, 0x72, 0x08, 0x80, 0xBB, 0x41, 0x80, 0x3D, 0x02, 0x80, 0xB7, 0x41, 0x80, 0x43, 0x08, 0x80,
+  0xE9, 0x41, 0x80, 0x0F, 0x02, 0x80, 0xE7, 0x41, 0x80, 0x15, 0x07, 0x80, 0x17, 0x41, 0x80, 0xE0,
+  0x02, 0x80, 0x16, 0x41, 0x80, 0xE6, 0x08, 0x80, 0x46, 0x41, 0x80, 0xB2, 0x02, 0x80, 0x46, 0x41,
+  0x80, 0xB7, 0x08, 0x80, 0x74, 0x41, 0x80, 0x83, 0x02, 0x80, 0x75, 0x41, 0x80, 0x88, 0x08, 0x80,
+  0xA3, 0x41, 0x80, 0x55, 0x02, 0x80, 0xA5, 0x41, 0x80, 0x59, 0x08, 0x80, 0xD1, 0x41, 0x80, 0x27,
+  0x02, 0x80, 0xD4, 0x41, 0x80, 0x2B, 0x04, 0x80, 0xB0, 0x50, 0x82, 0x38, 0x00, 0xB0, 0x50, 0x80,
+  0x38, 0x03, 0x80, 0x78, 0x41, 0x80, 0x84, 0x02, 0x80, 0x69, 0x41, 0x80, 0x8C, 0x08, 0x80, 0xA6,
+  0x41, 0x80, 0x57, 0x02, 0x80, 0x99, 0x41, 0x80, 0x5D, 0x08, 0x80, 0xD4, 0x41, 0x80, 0x29, 0x02,
+  0x80, 0xC9, 0x41, 0x80, 0x2E, 0x07, 0x84, 0x06, 0xFB, 0xFF, 0xF7, 0x03, 0x01, 0x84, 0x02, 0xF5,
+  0xFF, 0xFA, 0x05, 0x07, 0x80, 0x30, 0x41, 0x80, 0xCD, 0x02, 0x80, 0x29, 0x41, 0x80, 0xD1, 0x08,
+  0x80, 0x5F, 0x41, 0x80, 0xA0, 0x02, 0x80, 0x59, 0x41, 0x80, 0xA2, 0x08, 0x80, 0x8D, 0x41, 0x80,
+  0x72, 0x02, 0x80, 0x89, 0x41, 0x80, 0x74, 0x08, 0x80, 0xBB, 0x41, 0x80, 0x44, 0x02, 0x80, 0xB9,
+  0x41, 0x80, 0x45, 0x08, 0x80, 0xE9, 0x41, 0x80, 0x16, 0x02, 0x80, 0xE8, 0x41, 0x80, 0x17, 0x06,
+  0x04, 0x42, 0x09, 0x42, 0x05, 0x83, 0x02, 0x0E, 0x07, 0x01, 0x42, 0x86, 0x02, 0x08, 0x0D, 0x02,
+  0x00, 0x47, 0xF0, 0x48, 0x82, 0xED, 0x3C, 0xCE, 0x4A, 0x81, 0xC4, 0xFC, 0x41, 0x01, 0x42, 0x01,
+  0x41, 0x80, 0xFB, 0x42, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x45,
+  0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x42, 0x80, 0xE3, 0x41, 0x81,
+  0x1F, 0x00, 0x42, 0x01, 0x42, 0x80, 0x91, 0x41, 0x81, 0xBC, 0x01, 0x42, 0x04, 0x81, 0x12, 0xE4,
+  0x41, 0x80, 0x69, 0x42, 0x05, 0x83, 0x38, 0xF9, 0xFF, 0xF3, 0x42, 0x06, 0x80, 0x68, 0x44, 0x07,
+  0x80, 0x9F, 0x43, 0x07, 0x81, 0x08, 0xCD, 0x42, 0x80, 0x36, 0x07, 0x80, 0x20, 0x42, 0x81, 0xE6,
+  0x1C, 0x07, 0x43, 0x81, 0xCD, 0x0A, 0x06, 0x44, 0x81, 0xAB, 0x01, 0x05, 0x42, 0x80, 0xE5, 0x41,
+  0x80, 0x81, 0x05, 0x42, 0x81, 0x40, 0xFD, 0x41, 0x80, 0x43, 0x04, 0x42, 0x00, 0x80, 0x7F, 0x41,
+  0x80, 0xC7, 0x42, 0x01, 0x42, 0x00, 0x80, 0x02, 0x41, 0x80, 0xF8, 0x42, 0x01, 0x42, 0x01, 0x45,
+  0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x45,
+  0x01, 0x42, 0x01, 0x42, 0x80, 0xFA, 0x41, 0x01, 0x42, 0x01, 0x41, 0x81, 0xFA, 0xB8, 0x4A, 0x82,
+  0xB9, 0x2C, 0xDD, 0x48, 0x81, 0xE4, 0x2F, 0x04, 0x42, 0x82, 0x01, 0x04, 0x07, 0x06, 0x42, 0x09,
+  0x42, 0x04, 0x82, 0x19, 0xBA, 0xFB, 0x44, 0x82, 0xFC, 0xC1, 0x20, 0x07, 0x82, 0x48, 0xFF, 0xD0,
+  0x01, 0x80, 0xBA, 0x48, 0x80, 0xC1, 0x06, 0x83, 0x03, 0xD5, 0xFF, 0x42, 0x01, 0x80, 0xFC, 0x41,
+  0x04, 0x41, 0x80, 0xFC, 0x06, 0x82, 0x6A, 0xFF, 0xB0, 0x02, 0x42, 0x04, 0x42, 0x05, 0x83, 0x0F,
+  0xEB, 0xFA, 0x25, 0x02, 0x42, 0x04, 0x42, 0x05, 0x82, 0x8B, 0xFF, 0x8E, 0x03, 0x42, 0x04, 0x42,
+  0x04, 0x83, 0x22, 0xF9, 0xED, 0x11, 0x03, 0x42, 0x04, 0x42, 0x04, 0x82, 0xAD, 0xFF, 0x6D, 0x04,
+  0x42, 0x04, 0x42, 0x03, 0x83, 0x3D, 0xFF, 0xD7, 0x04, 0x04, 0x42, 0x04, 0x42, 0x02, 0x83, 0x01,
+  0xCC, 0xFF, 0x4B, 0x05, 0x42, 0x04, 0x42, 0x02, 0x82, 0x5F, 0xFF, 0xBA, 0x06, 0x42, 0x04, 0x42,
+  0x01, 0x83, 0x0A, 0xE4, 0xFC, 0x2D, 0x06, 0x42, 0x04, 0x42, 0x01, 0x82, 0x80, 0xFF, 0x98, 0x07,
+  0x42, 0x04, 0x42, 0x00, 0x83, 0x1B, 0xF5, 0xF2, 0x16, 0x07, 0x80, 0xFC, 0x41, 0x04, 0x41, 0x84,
+  0xFC, 0x00, 0xA2, 0xFF, 0x77, 0x08, 0x80, 0xBE, 0x48, 0x84, 0xC8, 0x33, 0xFE, 0xDF, 0x07, 0x08,
+  0x82, 0x1E, 0xC0, 0xFC, 0x44, 0x85, 0xFC, 0xC9, 0x2A, 0xC2, 0xFF, 0x55, 0x13, 0x85, 0x54, 0xFF,
+  0xC4, 0x1A, 0xBA, 0xFB, 0x44, 0x82, 0xFC, 0xC1, 0x20, 0x08, 0x84, 0x06, 0xDD, 0xFE, 0x35, 0xBA,
+  0x48, 0x80, 0xC1, 0x08, 0x84, 0x75, 0xFF, 0xA3, 0x00, 0xFC, 0x41, 0x04, 0x41, 0x80, 0xFC, 0x07,
+  0x84, 0x15, 0xF0, 0xF5, 0x1C, 0x00, 0x42, 0x04, 0x42, 0x07, 0x82, 0x97, 0xFF, 0x81, 0x01, 0x42,
+  0x04, 0x42, 0x06, 0x83, 0x2B, 0xFC, 0xE5, 0x0B, 0x01, 0x42, 0x04, 0x42, 0x06, 0x82, 0xB8, 0xFF,
+  0x5F, 0x02, 0x42, 0x04, 0x42, 0x05, 0x83, 0x49, 0xFF, 0xCD, 0x01, 0x02, 0x42, 0x04, 0x42, 0x04,
+  0x83, 0x03, 0xD5, 0xFF, 0x3E, 0x03, 0x42, 0x04, 0x42, 0x04, 0x82, 0x6A, 0xFF, 0xAD, 0x04, 0x42,
+  0x04, 0x42, 0x03, 0x83, 0x0F, 0xEB, 0xF9, 0x23, 0x04, 0x42, 0x04, 0x42, 0x03, 0x82, 0x8C, 0xFF,
+  0x8B, 0x05, 0x42, 0x04, 0x42, 0x02, 0x83, 0x22, 0xF9, 0xEB, 0x0F, 0x05, 0x42, 0x04, 0x42, 0x02,
+  0x82, 0xAD, 0xFF, 0x69, 0x06, 0x80, 0xFC, 0x41, 0x04, 0x41, 0x80, 0xFC, 0x01, 0x83, 0x3D, 0xFF,
+  0xD5, 0x03, 0x06, 0x80, 0xBE, 0x48, 0x80, 0xC8, 0x01, 0x82, 0xCC, 0xFF, 0x48, 0x07, 0x82, 0x1E,
+  0xC0, 0xFC, 0x44, 0x82, 0xFC, 0xC9, 0x29, 0x82, 0x10, 0xAC, 0xF9, 0x46, 0x82, 0xFC, 0xC1, 0x22,
+  0x02, 0x80, 0xA7, 0x4A, 0x80, 0xD4, 0x02, 0x80, 0xE8, 0x4B, 0x80, 0x1B, 0x01, 0x80, 0xEC, 0x41,
+  0x80, 0x14, 0x05, 0x80, 0xEC, 0x41, 0x80, 0x20, 0x01, 0x80, 0xEC, 0x41, 0x80, 0x14, 0x05, 0x80,
+  0xEC, 0x41, 0x80, 0x20, 0x01, 0x80, 0xEC, 0x41, 0x80, 0x14, 0x05, 0x80, 0xEC, 0x41, 0x80, 0x20,
+  0x01, 0x80, 0xEC, 0x41, 0x80, 0x14, 0x05, 0x80, 0xEC, 0x41, 0x80, 0x20, 0x01, 0x80, 0xEC, 0x41,
+  0x80, 0x14, 0x05, 0x80, 0xEC, 0x41, 0x80, 0x20, 0x01, 0x80, 0xEC, 0x41, 0x80, 0x14, 0x05, 0x80,
+  0xEC, 0x41, 0x80, 0x20, 0x01, 0x80, 0xEC, 0x41, 0x80, 0x14, 0x0B, 0x80, 0xEC, 0x41, 0x80, 0x14,
+  0x0B, 0x80, 0xEC, 0x41, 0x80, 0x14, 0x0B, 0x80, 0xD7, 0x41, 0x81, 0x93, 0x0D, 0x0A, 0x80, 0x60,
+  0x42, 0x81, 0xE3, 0x51, 0x0A, 0x81, 0x4E, 0xE1, 0x4B, 0x80, 0x5C, 0x01, 0x81, 0x14, 0xDF, 0x4A,
+  0x83, 0x5C, 0x00, 0x45, 0xDC, 0x4B, 0x81, 0x5C, 0x73, 0x42, 0x81, 0xD5, 0x41, 0x03, 0x42, 0x02,
+  0x80, 0xED, 0x41, 0x81, 0x73, 0x04, 0x04, 0x42, 0x02, 0x42, 0x06, 0x42, 0x02, 0x42, 0x06, 0x42,
+  0x02, 0x42, 0x06, 0x42, 0x02, 0x42, 0x06, 0x42, 0x02, 0x42, 0x06, 0x42, 0x02, 0x42, 0x06, 0x42,
+  0x02, 0x42, 0x06, 0x42, 0x02, 0x42, 0x06, 0x42, 0x02, 0x42, 0x06, 0x42, 0x02, 0x42, 0x06, 0x42,
+  0x02, 0x80, 0xFC, 0x4B, 0x02, 0x80, 0xBD, 0x4B, 0x02, 0x82, 0x1B, 0xBB, 0xFC, 0x49, 0x02, 0xF8,
+  0xFF, 0xF7, 0xE9, 0xFF, 0xE7, 0xD9, 0xFF, 0xD7, 0xC9, 0xFF, 0xC7, 0xB9, 0xFF, 0xB7, 0xA9, 0xFF,
+  0xA7, 0x99, 0xFF, 0x97, 0x89, 0xFF, 0x87, 0x79, 0xFF, 0x77, 0x68, 0xFF, 0x67, 0x04, 0x82, 0x56,
+  0xFF, 0xD4, 0x03, 0x83, 0x17, 0xEB, 0xFF, 0x49, 0x03, 0x82, 0xA5, 0xFF, 0xBE, 0x03, 0x83, 0x39,
+  0xFE, 0xFF, 0x40, 0x03, 0x82, 0xC2, 0xFF, 0xC6, 0x03, 0x80, 0x3D, 0x41, 0x80, 0x59, 0x03, 0x83,
+  0xB1, 0xFF, 0xEB, 0x06, 0x02, 0x83, 0x18, 0xFB, 0xFF, 0x97, 0x03, 0x80, 0x73, 0x41, 0x80, 0x43,
+  0x03, 0x83, 0xC2, 0xFF, 0xF7, 0x07, 0x02, 0x83, 0x0F, 0xFB, 0xFF, 0xC1, 0x03, 0x80, 0x48, 0x41,
+  0x80, 0x8F, 0x03, 0x80, 0x7C, 0x41, 0x80, 0x66, 0x03, 0x80, 0xA8, 0x41, 0x80, 0x42, 0x03, 0x80,
+  0xC8, 0x41, 0x80, 0x2A, 0x03, 0x80, 0xE4, 0x41, 0x80, 0x14, 0x03, 0x80, 0xF2, 0x41, 0x80, 0x0A,
+  0x03, 0x80, 0xFB, 0x41, 0x80, 0x03, 0x03, 0x80, 0xFB, 0x41, 0x80, 0x03, 0x03, 0x80, 0xF2, 0x41,
+  0x80, 0x0A, 0x03, 0x80, 0xE4, 0x41, 0x80, 0x14, 0x03, 0x80, 0xC8, 0x41, 0x80, 0x2A, 0x03, 0x80,
+  0xA8, 0x41, 0x80, 0x42, 0x03, 0x80, 0x7C, 0x41, 0x80, 0x66, 0x03, 0x80, 0x48, 0x41, 0x80, 0x8F,
+  0x03, 0x83, 0x0F, 0xFB, 0xFF, 0xC1, 0x04, 0x83, 0xC2, 0xFF, 0xF7, 0x07, 0x03, 0x80, 0x73, 0x41,
+  0x80, 0x43, 0x03, 0x83, 0x18, 0xFB, 0xFF, 0x97, 0x04, 0x83, 0xB1, 0xFF, 0xEA, 0x06, 0x03, 0x80,
+  0x3D, 0x41, 0x80, 0x59, 0x04, 0x82, 0xC3, 0xFF, 0xC6, 0x04, 0x80, 0x39, 0x41, 0x80, 0x40, 0x04,
+  0x82, 0xA6, 0xFF, 0xBD, 0x04, 0x83, 0x17, 0xEC, 0xFF, 0x49, 0x04, 0x82, 0x57, 0xFF, 0xD4, 0x82,
+  0xD5, 0xFF, 0x48, 0x03, 0x83, 0x4B, 0xFF, 0xD4, 0x03, 0x03, 0x82, 0xC0, 0xFF, 0x5E, 0x03, 0x83,
+  0x43, 0xFF, 0xD7, 0x02, 0x03, 0x82, 0xC8, 0xFF, 0x4D, 0x03, 0x82, 0x5E, 0xFF, 0xB2, 0x03, 0x83,
+  0x08, 0xEE, 0xFC, 0x17, 0x03, 0x82, 0x9F, 0xFF, 0x65, 0x03, 0x82, 0x4C, 0xFF, 0xB5, 0x03, 0x83,
+  0x0B, 0xFB, 0xF2, 0x03, 0x03, 0x82, 0xC8, 0xFF, 0x33, 0x03, 0x82, 0x95, 0xFF, 0x65, 0x03, 0x82,
+  0x6A, 0xFF, 0x91, 0x03, 0x82, 0x45, 0xFF, 0xB6, 0x03, 0x82, 0x2D, 0xFF, 0xD0, 0x03, 0x82, 0x16,
+  0xFF, 0xE8, 0x03, 0x82, 0x0D, 0xFF, 0xF3, 0x03, 0x82, 0x04, 0xFF, 0xFB, 0x03, 0x82, 0x04, 0xFF,
+  0xFB, 0x03, 0x82, 0x0D, 0xFF, 0xF3, 0x03, 0x82, 0x16, 0xFF, 0xE8, 0x03, 0x82, 0x2D, 0xFF, 0xD0,
+  0x03, 0x82, 0x45, 0xFF, 0xB6, 0x03, 0x82, 0x6A, 0xFF, 0x91, 0x03, 0x82, 0x95, 0xFF, 0x66, 0x03,
+  0x82, 0xC8, 0xFF, 0x34, 0x02, 0x83, 0x0B, 0xFB, 0xF3, 0x03, 0x02, 0x82, 0x4C, 0xFF, 0xB5, 0x03,
+  0x82, 0x9F, 0xFF, 0x65, 0x02, 0x83, 0x08, 0xEE, 0xFC, 0x17, 0x02, 0x82, 0x5E, 0xFF, 0xB2, 0x03,
+  0x82, 0xC8, 0xFF, 0x4D, 0x02, 0x83, 0x43, 0xFF, 0xD7, 0x02, 0x02, 0x82, 0xC0, 0xFF, 0x5F, 0x02,
+  0x83, 0x4B, 0xFF, 0xD4, 0x03, 0x02, 0x82, 0xD5, 0xFF, 0x48, 0x03, 0x04, 0x81, 0xF2, 0xF2, 0x09,
+  0x81, 0xD7, 0xD9, 0x04, 0x82, 0x02, 0xB2, 0x3F, 0x01, 0x81, 0xBC, 0xBF, 0x01, 0x90, 0x3E, 0xB1,
+  0x02, 0x67, 0xFF, 0xFC, 0x78, 0x01, 0xA0, 0xA5, 0x00, 0x75, 0xFC, 0xFF, 0x66, 0xA2, 0xFD, 0x41,
+  0x83, 0xB3, 0x96, 0x9A, 0xAF, 0x41, 0x8C, 0xFE, 0xA3, 0x00, 0x22, 0x8B, 0xED, 0xFF, 0xFE, 0xFE,
+  0xFF, 0xEE, 0x8D, 0x23, 0x03, 0x81, 0x0C, 0xAF, 0x41, 0x81, 0xB4, 0x0E, 0x03, 0x8C, 0x1D, 0x82,
+  0xE5, 0xFF, 0xFC, 0xFC, 0xFF, 0xE7, 0x84, 0x1E, 0x00, 0xA0, 0xFD, 0x41, 0x83, 0xA8, 0x92, 0x96,
+  0xA4, 0x41, 0x90, 0xFD, 0xA0, 0x67, 0xFF, 0xFB, 0x71, 0x00, 0xA1, 0xA6, 0x00, 0x6E, 0xFA, 0xFF,
+  0x66, 0x02, 0xB2, 0x3D, 0x01, 0x81, 0xBC, 0xBF, 0x01, 0x82, 0x3C, 0xB1, 0x02, 0x04, 0x81, 0xD7,
+  0xD9, 0x09, 0x81, 0xF2, 0xF3, 0x04, 0x05, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42,
+  0x0B, 0x42, 0x05, 0x5D, 0x05, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42,
+  0x05, 0x15, 0xFF, 0xFF, 0xD4, 0x40, 0xFF, 0xFF, 0x7F, 0x6B, 0xFF, 0xFF, 0x2A, 0x96, 0xFF, 0xD4,
+  0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xEB, 0xFF, 0x2A, 0x00, 0x57, 0x4B, 0x0B, 0x83, 0x07, 0xEA, 0xFF,
+  0xDC, 0x0B, 0x80, 0x5C, 0x41, 0x80, 0x73, 0x0B, 0x83, 0xC7, 0xFF, 0xF6, 0x12, 0x0A, 0x80, 0x31,
+  0x41, 0x80, 0x9E, 0x0B, 0x80, 0x9C, 0x41, 0x80, 0x33, 0x0A, 0x83, 0x10, 0xF5, 0xFF, 0xC8, 0x0B,
+  0x80, 0x71, 0x41, 0x80, 0x5D, 0x0A, 0x84, 0x01, 0xDA, 0xFF, 0xEB, 0x07, 0x0A, 0x80, 0x47, 0x41,
+  0x80, 0x88, 0x0B, 0x83, 0xB1, 0xFF, 0xFD, 0x20, 0x0A, 0x83, 0x1F, 0xFC, 0xFF, 0xB2, 0x0B, 0x80,
+  0x87, 0x41, 0x80, 0x48, 0x0A, 0x84, 0x07, 0xEA, 0xFF, 0xDB, 0x01, 0x0A, 0x80, 0x5C, 0x41, 0x80,
+  0x72, 0x0B, 0x83, 0xC7, 0xFF, 0xF6, 0x11, 0x0A, 0x80, 0x31, 0x41, 0x80, 0x9D, 0x0B, 0x80, 0x9C,
+  0x41, 0x80, 0x32, 0x0A, 0x83, 0x10, 0xF5, 0xFF, 0xC7, 0x0B, 0x80, 0x71, 0x41, 0x80, 0x5C, 0x0A,
+  0x84, 0x01, 0xDA, 0xFF, 0xEB, 0x07, 0x0A, 0x80, 0x46, 0x41, 0x80, 0x87, 0x0B, 0x83, 0xB1, 0xFF,
+  0xFD, 0x1F, 0x0A, 0x83, 0x1E, 0xFC, 0xFF, 0xB1, 0x0B, 0x80, 0x86, 0x41, 0x80, 0x47, 0x0A, 0x84,
+  0x06, 0xEA, 0xFF, 0xDB, 0x01, 0x0A, 0x80, 0x5C, 0x41, 0x80, 0x71, 0x0B, 0x83, 0xC6, 0xFF, 0xF5,
+  0x11, 0x0A, 0x80, 0x31, 0x41, 0x80, 0x9C, 0x0B, 0x80, 0x9C, 0x41, 0x80, 0x31, 0x0A, 0x83, 0x10,
+  0xF5, 0xFF, 0xC6, 0x0B, 0x80, 0x71, 0x41, 0x80, 0x5B, 0x0B, 0x83, 0xDA, 0xFF, 0xEA, 0x06, 0x0B,
+  0x82, 0x1A, 0xBB, 0xFB, 0x46, 0x83, 0xFB, 0xB9, 0x18, 0xB9, 0x4A, 0x81, 0xB7, 0xFC, 0x4A, 0x80,
+  0xFB, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFC, 0x4A, 0x81, 0xFB, 0xBA, 0x4A, 0x83, 0xB8, 0x1B,
+  0xBD, 0xFC, 0x46, 0x82, 0xFC, 0xBC, 0x19, 0x00, 0x80, 0x78, 0x41, 0x00, 0x80, 0xA8, 0x41, 0x00,
+  0x80, 0xD7, 0x41, 0x81, 0x09, 0xFC, 0x41, 0x80, 0x36, 0x42, 0x80, 0x66, 0x42, 0x80, 0x95, 0x42,
+  0x80, 0xC5, 0x42, 0x80, 0xF2, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42,
+  0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42,
+  0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42,
+  0x00, 0x42, 0x00, 0x42, 0x82, 0x1A, 0xBF, 0xFB, 0x46, 0x83, 0xFB, 0xBA, 0x18, 0xB7, 0x4A, 0x81,
+  0xB7, 0xFB, 0x4A, 0x80, 0xFB, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x41, 0x80, 0xFA, 0x42, 0x06, 0x41, 0x80, 0xD6, 0x08, 0x80, 0x33, 0x41, 0x80, 0x82, 0x08,
+  0x83, 0xB1, 0xFF, 0xF7, 0x1A, 0x07, 0x83, 0x2F, 0xFE, 0xFF, 0x8D, 0x08, 0x83, 0xAC, 0xFF, 0xF3,
+  0x15, 0x07, 0x83, 0x2A, 0xFE, 0xFF, 0x84, 0x08, 0x83, 0xA6, 0xFF, 0xEF, 0x10, 0x07, 0x83, 0x26,
+  0xFD, 0xFF, 0x7A, 0x08, 0x83, 0xA1, 0xFF, 0xEA, 0x0C, 0x07, 0x83, 0x22, 0xFB, 0xFF, 0x71, 0x08,
+  0x83, 0x9C, 0xFF, 0xE4, 0x08, 0x07, 0x83, 0x1F, 0xFA, 0xFF, 0x67, 0x08, 0x83, 0x97, 0xFF, 0xDE,
+  0x05, 0x07, 0x83, 0x1B, 0xF8, 0xFF, 0x5E, 0x08, 0x83, 0x92, 0xFF, 0xD6, 0x03, 0x07, 0x83, 0x18,
+  0xF7, 0xFF, 0x54, 0x08, 0x83, 0x8D, 0xFF, 0xCF, 0x01, 0x07, 0x83, 0x15, 0xF5, 0xFF, 0x4B, 0x08,
+  0x82, 0x88, 0xFF, 0xC6, 0x08, 0x83, 0x12, 0xF2, 0xFF, 0x42, 0x08, 0x80, 0x83, 0x4B, 0x80, 0xF0,
+  0x58, 0x82, 0x15, 0xB3, 0xFA, 0x46, 0x83, 0xFA, 0xAC, 0x0F, 0xB0, 0x4A, 0x81, 0xA9, 0xF0, 0x4A,
+  0x81, 0xF3, 0xF4, 0x41, 0x80, 0x08, 0x04, 0x80, 0x0C, 0x41, 0x81, 0xF8, 0xF4, 0x41, 0x80, 0x08,
+  0x04, 0x80, 0x0C, 0x41, 0x81, 0xF8, 0xF4, 0x41, 0x80, 0x08, 0x04, 0x80, 0x0C, 0x41, 0x81, 0xF8,
+  0xF4, 0x41, 0x80, 0x08, 0x04, 0x80, 0x0C, 0x41, 0x81, 0xF8, 0xF4, 0x41, 0x80, 0x08, 0x04, 0x80,
+  0x0C, 0x41, 0x81, 0xF8, 0xF4, 0x41, 0x80, 0x08, 0x04, 0x80, 0x0C, 0x41, 0x81, 0xF8, 0xF4, 0x41,
+  0x80, 0x08, 0x04, 0x80, 0x0C, 0x41, 0x80, 0xF8, 0x08, 0x80, 0x0C, 0x41, 0x80, 0xF2, 0x07, 0x81,
+  0x12, 0xAA, 0x41, 0x80, 0xB6, 0x06, 0x81, 0x44, 0xE4, 0x41, 0x81, 0xCB, 0x1B, 0x04, 0x86, 0x08,
+  0x90, 0xFE, 0xFF, 0xEE, 0x6B, 0x03, 0x04, 0x85, 0x30, 0xD4, 0xFF, 0xFE, 0x9C, 0x14, 0x06, 0x80,
+  0xF4, 0x41, 0x80, 0x6B, 0x08, 0x85, 0x34, 0xD9, 0xFF, 0xFE, 0x9C, 0x15, 0x07, 0x81, 0x0A, 0x9A,
+  0x41, 0x82, 0xEF, 0x6E, 0x03, 0x07, 0x81, 0x4F, 0xEB, 0x41, 0x81, 0xCF, 0x1F, 0x07, 0x81, 0x18,
+  0xB8, 0x41, 0x80, 0xBD, 0x08, 0x80, 0x01, 0x41, 0x80, 0xF9, 0x09, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFC, 0x4A, 0x81, 0xFB, 0xBD,
+  0x4A, 0x83, 0xB2, 0x1B, 0xBA, 0xFC, 0x46, 0x82, 0xFB, 0xB3, 0x13, 0x06, 0x80, 0x65, 0x41, 0x80,
+  0xA5, 0x09, 0x80, 0xBD, 0x41, 0x80, 0x4B, 0x08, 0x84, 0x18, 0xFC, 0xFF, 0xEB, 0x04, 0x08, 0x80,
+  0x6E, 0x41, 0x80, 0x95, 0x09, 0x80, 0xC6, 0x41, 0x80, 0x3B, 0x08, 0x84, 0x1F, 0xFE, 0xFF, 0xDF,
+  0x01, 0x08, 0x80, 0x77, 0x41, 0x80, 0x85, 0x09, 0x80, 0xCF, 0x41, 0x80, 0x2B, 0x08, 0x80, 0x27,
+  0x41, 0x80, 0xD0, 0x09, 0x80, 0x80, 0x41, 0x80, 0x75, 0x09, 0x84, 0xD8, 0xFF, 0xFE, 0x1D, 0x00,
+  0x42, 0x04, 0x80, 0x31, 0x41, 0x80, 0xC0, 0x01, 0x42, 0x04, 0x80, 0x89, 0x41, 0x80, 0x66, 0x01,
+  0x42, 0x03, 0x84, 0x01, 0xE0, 0xFF, 0xF9, 0x12, 0x01, 0x42, 0x03, 0x80, 0x3A, 0x41, 0x80, 0xB0,
+  0x02, 0x42, 0x03, 0x80, 0x93, 0x41, 0x80, 0x56, 0x02, 0x42, 0x02, 0x84, 0x02, 0xE7, 0xFF, 0xF2,
+  0x09, 0x02, 0x42, 0x02, 0x80, 0x43, 0x41, 0x80, 0xA0, 0x03, 0x42, 0x02, 0x80, 0x9C, 0x41, 0x80,
+  0x46, 0x03, 0x42, 0x01, 0x84, 0x05, 0xEE, 0xFF, 0xE8, 0x03, 0x03, 0x42, 0x01, 0x80, 0x4D, 0x41,
+  0x80, 0x91, 0x04, 0x42, 0x01, 0x80, 0xA5, 0x4C, 0x80, 0xF3, 0x5A, 0x08, 0x42, 0x0A, 0x42, 0x0A,
+  0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x01, 0x80, 0x85, 0x4B, 0x80,
+  0x8D, 0x4B, 0x80, 0x96, 0x4B, 0x80, 0x9E, 0x41, 0x80, 0x52, 0x08, 0x80, 0xA7, 0x41, 0x80, 0x49,
+  0x08, 0x80, 0xAF, 0x41, 0x80, 0x3F, 0x08, 0x80, 0xB8, 0x41, 0x80, 0x35, 0x08, 0x80, 0xC0, 0x41,
+  0x80, 0x2B, 0x08, 0x80, 0xC9, 0x41, 0x80, 0x22, 0x08, 0x80, 0xD1, 0x41, 0x80, 0x18, 0x08, 0x80,
+  0xDA, 0x41, 0x80, 0x0E, 0x08, 0x80, 0xE2, 0x41, 0x80, 0x04, 0x08, 0x80, 0xEB, 0x48, 0x83, 0xFC,
+  0xCF, 0x37, 0xF3, 0x4A, 0x81, 0xDF, 0xFC, 0x4B, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42,
+  0x09, 0x42, 0x09, 0x42, 0x09, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x42, 0x80, 0xFC, 0x4A, 0x81, 0xFC, 0xC2, 0x4A, 0x83, 0xC0, 0x22, 0xC3, 0xFC,
+  0x46, 0x82, 0xFC, 0xC2, 0x20, 0x82, 0x1A, 0xBB, 0xFB, 0x46, 0x83, 0xFA, 0xB6, 0x16, 0xB9, 0x4A,
+  0x81, 0xB6, 0xFC, 0x4A, 0x80, 0xFB, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x49, 0x82, 0xFC, 0xC8,
+  0x29, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42,
+  0x80, 0xFC, 0x4A, 0x81, 0xFB, 0xBA, 0x4A, 0x83, 0xB9, 0x1B, 0xBD, 0xFC, 0x46, 0x82, 0xFC, 0xBD,
+  0x1B, 0x58, 0x80, 0xF8, 0x42, 0x05, 0x80, 0x19, 0x41, 0x80, 0xCB, 0x42, 0x05, 0x80, 0x4D, 0x41,
+  0x80, 0x99, 0x42, 0x05, 0x80, 0x80, 0x41, 0x80, 0x67, 0x42, 0x05, 0x80, 0xB3, 0x41, 0x80, 0x35,
+  0x42, 0x05, 0x83, 0xE6, 0xFF, 0xFA, 0x07, 0x07, 0x80, 0x19, 0x41, 0x80, 0xD0, 0x08, 0x80, 0x4D,
+  0x41, 0x80, 0x9E, 0x08, 0x80, 0x80, 0x41, 0x80, 0x6B, 0x08, 0x80, 0xB3, 0x41, 0x80, 0x39, 0x08,
+  0x83, 0xE6, 0xFF, 0xFC, 0x0A, 0x07, 0x80, 0x19, 0x41, 0x80, 0xD4, 0x08, 0x80, 0x4D, 0x41, 0x80,
+  0xA2, 0x08, 0x80, 0x80, 0x41, 0x80, 0x70, 0x08, 0x80, 0xB3, 0x41, 0x80, 0x3D, 0x08, 0x83, 0xE6,
+  0xFF, 0xFE, 0x0D, 0x07, 0x80, 0x19, 0x41, 0x80, 0xD9, 0x08, 0x80, 0x4D, 0x41, 0x80, 0xA7, 0x08,
+  0x80, 0x80, 0x41, 0x80, 0x74, 0x08, 0x80, 0xB3, 0x41, 0x80, 0x42, 0x08, 0x80, 0xE6, 0x41, 0x80,
+  0x10, 0x07, 0x80, 0x19, 0x41, 0x80, 0xDD, 0x08, 0x80, 0x4D, 0x41, 0x80, 0xAB, 0x08, 0x80, 0x80,
+  0x41, 0x80, 0x79, 0x08, 0x80, 0xB3, 0x41, 0x80, 0x46, 0x08, 0x80, 0xE6, 0x41, 0x80, 0x14, 0x07,
+  0x80, 0x19, 0x41, 0x80, 0xE2, 0x08, 0x80, 0x4D, 0x41, 0x80, 0xAF, 0x08, 0x80, 0x80, 0x41, 0x80,
+  0x7D, 0x08, 0x80, 0xB3, 0x41, 0x80, 0x4B, 0x08, 0x80, 0xE6, 0x41, 0x80, 0x19, 0x04, 0x82, 0x0C,
+  0xA4, 0xF8, 0x46, 0x83, 0xFA, 0xA8, 0x0D, 0x9D, 0x4A, 0x81, 0x9E, 0xE7, 0x4A, 0x81, 0xE7, 0xEC,
+  0x41, 0x80, 0x18, 0x04, 0x80, 0x18, 0x41, 0x81, 0xEC, 0xEC, 0x41, 0x80, 0x18, 0x04, 0x80, 0x18,
+  0x41, 0x81, 0xEC, 0xEC, 0x41, 0x80, 0x18, 0x04, 0x80, 0x18, 0x41, 0x81, 0xEC, 0xEC, 0x41, 0x80,
+  0x18, 0x04, 0x80, 0x18, 0x41, 0x81, 0xEC, 0xEC, 0x41, 0x80, 0x18, 0x04, 0x80, 0x18, 0x41, 0x81,
+  0xEC, 0xEC, 0x41, 0x80, 0x18, 0x04, 0x80, 0x18, 0x41, 0x81, 0xEC, 0xEC, 0x41, 0x80, 0x18, 0x04,
+  0x80, 0x18, 0x41, 0x81, 0xEC, 0xEC, 0x41, 0x80, 0x18, 0x04, 0x80, 0x18, 0x41, 0x81, 0xEC, 0xE8,
+  0x41, 0x80, 0x18, 0x04, 0x80, 0x18, 0x41, 0x81, 0xE8, 0xA4, 0x41, 0x81, 0xC4, 0x21, 0x02, 0x81,
+  0x22, 0xC4, 0x41, 0x82, 0xA2, 0x15, 0xD1, 0x41, 0x84, 0xF2, 0x62, 0x00, 0x62, 0xF2, 0x41, 0x85,
+  0xCF, 0x14, 0x00, 0x05, 0x78, 0xF6, 0x41, 0x80, 0xDC, 0x41, 0x82, 0xF6, 0x77, 0x04, 0x03, 0x81,
+  0x41, 0xFC, 0x42, 0x81, 0xFC, 0x42, 0x03, 0x82, 0x02, 0x6D, 0xF3, 0x41, 0x80, 0xE8, 0x41, 0x85,
+  0xF3, 0x69, 0x01, 0x00, 0x1B, 0xC5, 0x41, 0x84, 0xF7, 0x71, 0x03, 0x71, 0xF7, 0x41, 0x82, 0xBF,
+  0x16, 0xB4, 0x41, 0x81, 0xCB, 0x29, 0x02, 0x81, 0x29, 0xCC, 0x41, 0x81, 0xAE, 0xF4, 0x41, 0x80,
+  0x04, 0x04, 0x80, 0x04, 0x41, 0x80, 0xF2, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFB, 0x4A, 0x81, 0xFB, 0xB4,
+  0x4A, 0x83, 0xB2, 0x15, 0xB5, 0xFB, 0x46, 0x82, 0xFB, 0xB2, 0x13, 0x82, 0x18, 0xBF, 0xFE, 0x46,
+  0x83, 0xFB, 0xB3, 0x13, 0xB7, 0x4A, 0x81, 0xB2, 0xFB, 0x4A, 0x80, 0xFB, 0x42, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x4F, 0x80, 0xE5, 0x4B, 0x81, 0x4B, 0xDF, 0x4A, 0x09, 0x42, 0x09, 0x42,
+  0x09, 0x42, 0x09, 0x42, 0x09, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x42, 0x80, 0xFB, 0x4A, 0x81, 0xFB, 0xB8, 0x4A, 0x83, 0xB9, 0x1A, 0xBC, 0xFC, 0x46, 0x82,
+  0xFC, 0xBD, 0x1B, 0x4B, 0x1A, 0x4B, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x23, 0x80,
+  0x15, 0x41, 0x81, 0xD4, 0x40, 0x41, 0x81, 0x7F, 0x6B, 0x41, 0x8C, 0x2A, 0x96, 0xFF, 0xD4, 0x00,
+  0xC0, 0xFF, 0x7F, 0x00, 0xEB, 0xFF, 0x2A, 0x00, 0x07, 0x81, 0x07, 0x9B, 0x06, 0x82, 0x1F, 0xCC,
+  0xFF, 0x05, 0x81, 0x47, 0xED, 0x41, 0x03, 0x85, 0x01, 0x7D, 0xFD, 0xFF, 0xF8, 0x64, 0x02, 0x81,
+  0x10, 0xB4, 0x41, 0x81, 0xE2, 0x35, 0x02, 0x81, 0x30, 0xDD, 0x41, 0x81, 0xBC, 0x14, 0x02, 0x81,
+  0x5F, 0xF6, 0x41, 0x81, 0x89, 0x03, 0x02, 0x80, 0x97, 0x41, 0x81, 0xF2, 0x52, 0x04, 0x42, 0x80,
+  0x51, 0x05, 0x80, 0xA7, 0x41, 0x81, 0xF2, 0x52, 0x05, 0x81, 0x71, 0xFB, 0x41, 0x81, 0x88, 0x03,
+  0x04, 0x81, 0x3E, 0xE8, 0x41, 0x81, 0xBC, 0x14, 0x04, 0x81, 0x1A, 0xC5, 0x41, 0x81, 0xE1, 0x35,
+  0x04, 0x81, 0x05, 0x93, 0x41, 0x81, 0xF8, 0x64, 0x05, 0x81, 0x5B, 0xF5, 0x41, 0x06, 0x82, 0x2E,
+  0xDC, 0xFF, 0x07, 0x81, 0x10, 0xB3, 0x6C, 0x3F, 0x0A, 0x6C, 0x81, 0xB7, 0x11, 0x07, 0x40, 0x81,
+  0xDD, 0x2E, 0x06, 0x41, 0x81, 0xF5, 0x59, 0x05, 0x81, 0x65, 0xF8, 0x41, 0x81, 0x8E, 0x04, 0x04,
+  0x81, 0x35, 0xE2, 0x41, 0x81, 0xBF, 0x16, 0x04, 0x81, 0x15, 0xBD, 0x41, 0x81, 0xE3, 0x36, 0x04,
+  0x81, 0x03, 0x89, 0x41, 0x81, 0xF8, 0x63, 0x05, 0x81, 0x53, 0xF2, 0x41, 0x80, 0x98, 0x05, 0x80,
+  0x51, 0x42, 0x04, 0x81, 0x52, 0xF2, 0x41, 0x80, 0xA6, 0x02, 0x81, 0x03, 0x88, 0x41, 0x81, 0xFA,
+  0x6E, 0x02, 0x81, 0x14, 0xBC, 0x41, 0x81, 0xE3, 0x38, 0x02, 0x81, 0x35, 0xE2, 0x41, 0x81, 0xBC,
+  0x15, 0x02, 0x85, 0x64, 0xF8, 0xFF, 0xFE, 0x86, 0x02, 0x03, 0x41, 0x81, 0xEF, 0x4C, 0x05, 0x40,
+  0x81, 0xCE, 0x22, 0x06, 0x81, 0x9D, 0x08, 0x07, 0x82, 0x12, 0xB0, 0xFB, 0x45, 0x83, 0xFB, 0xB1,
+  0x12, 0xB1, 0x49, 0x81, 0xB1, 0xFB, 0x49, 0x80, 0xFB, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x08, 0x41, 0x80, 0xF4, 0x07, 0x80, 0x3E, 0x41, 0x80, 0xBA,
+  0x06, 0x84, 0x13, 0xE3, 0xFF, 0xFA, 0x32, 0x06, 0x80, 0xB2, 0x41, 0x80, 0x72, 0x06, 0x80, 0x70,
+  0x41, 0x81, 0xB5, 0x01, 0x05, 0x84, 0x32, 0xF9, 0xFF, 0xE5, 0x14, 0x05, 0x84, 0x0D, 0xDB, 0xFF,
+  0xFD, 0x40, 0x06, 0x80, 0x8E, 0x41, 0x80, 0x81, 0x07, 0x80, 0xE6, 0x41, 0x80, 0x03, 0x07, 0x42,
+  0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x38, 0x42, 0x08, 0x42, 0x08, 0x42,
+  0x08, 0x42, 0x04, 0x81, 0x66, 0xEC, 0x4C, 0x82, 0xEC, 0x66, 0xEC, 0x4E, 0x80, 0xEC, 0x41, 0x0D,
+  0x42, 0x0D, 0x42, 0x0D, 0x42, 0x0D, 0x42, 0x0D, 0x42, 0x02, 0x81, 0x90, 0xFA, 0x43, 0x81, 0xFA,
+  0x9D, 0x02, 0x42, 0x02, 0x80, 0xF8, 0x45, 0x80, 0xFC, 0x02, 0x42, 0x02, 0x41, 0x03, 0x41, 0x02,
+  0x42, 0x02, 0x41, 0x03, 0x41, 0x02, 0x42, 0x02, 0x41, 0x03, 0x41, 0x02, 0x42, 0x02, 0x41, 0x03,
+  0x41, 0x02, 0x42, 0x08, 0x41, 0x02, 0x42, 0x08, 0x41, 0x02, 0x42, 0x02, 0x81, 0xA0, 0xFA, 0x45,
+  0x02, 0x42, 0x02, 0x80, 0xFC, 0x46, 0x02, 0x42, 0x02, 0x41, 0x03, 0x41, 0x02, 0x42, 0x02, 0x41,
+  0x03, 0x41, 0x02, 0x42, 0x02, 0x41, 0x03, 0x41, 0x02, 0x42, 0x02, 0x41, 0x03, 0x41, 0x02, 0x42,
+  0x02, 0x41, 0x03, 0x41, 0x02, 0x42, 0x02, 0x41, 0x03, 0x41, 0x02, 0x42, 0x02, 0x80, 0xFD, 0x49,
+  0x80, 0xEC, 0x41, 0x02, 0x81, 0xAB, 0xFD, 0x47, 0x81, 0xEC, 0x66, 0x41, 0x0E, 0x41, 0x0E, 0x41,
+  0x0E, 0x41, 0x0E, 0x41, 0x0E, 0x80, 0xEC, 0x4F, 0x81, 0x66, 0xEC, 0x4E, 0x04, 0x80, 0x18, 0x42,
+  0x80, 0x17, 0x09, 0x80, 0x49, 0x42, 0x80, 0x47, 0x09, 0x80, 0x79, 0x42, 0x80, 0x77, 0x09, 0x80,
+  0xA9, 0x42, 0x80, 0xA7, 0x09, 0x80, 0xD9, 0x42, 0x80, 0xD7, 0x08, 0x86, 0x0B, 0xFD, 0xFF, 0xE7,
+  0xFF, 0xFD, 0x0A, 0x07, 0x80, 0x39, 0x41, 0x80, 0x95, 0x41, 0x80, 0x37, 0x07, 0x80, 0x69, 0x41,
+  0x80, 0x40, 0x41, 0x80, 0x67, 0x07, 0x86, 0x99, 0xFF, 0xE7, 0x07, 0xFC, 0xFF, 0x97, 0x07, 0x86,
+  0xCA, 0xFF, 0xBD, 0x00, 0xDA, 0xFF, 0xC7, 0x06, 0x88, 0x03, 0xF6, 0xFF, 0x93, 0x00, 0xAF, 0xFF,
+  0xF4, 0x02, 0x05, 0x80, 0x2A, 0x41, 0x82, 0x69, 0x00, 0x84, 0x41, 0x80, 0x27, 0x05, 0x80, 0x5A,
+  0x41, 0x82, 0x3F, 0x00, 0x59, 0x41, 0x80, 0x57, 0x05, 0x80, 0x8A, 0x41, 0x82, 0x15, 0x00, 0x2F,
+  0x41, 0x80, 0x87, 0x05, 0x82, 0xBA, 0xFF, 0xEB, 0x01, 0x83, 0x07, 0xFC, 0xFF, 0xB7, 0x05, 0x82,
+  0xE9, 0xFF, 0xC2, 0x02, 0x82, 0xD9, 0xFF, 0xE7, 0x04, 0x80, 0x1A, 0x41, 0x80, 0x98, 0x02, 0x80,
+  0xAE, 0x41, 0x80, 0x17, 0x03, 0x80, 0x4A, 0x41, 0x80, 0x6E, 0x02, 0x80, 0x83, 0x41, 0x80, 0x47,
+  0x03, 0x80, 0x7B, 0x41, 0x80, 0x44, 0x02, 0x80, 0x59, 0x41, 0x80, 0x77, 0x03, 0x80, 0xAB, 0x41,
+  0x80, 0x1A, 0x02, 0x80, 0x2E, 0x41, 0x80, 0xA7, 0x03, 0x82, 0xDB, 0xFF, 0xF0, 0x03, 0x83, 0x07,
+  0xFC, 0xFF, 0xD7, 0x02, 0x83, 0x0C, 0xFE, 0xFF, 0xC6, 0x04, 0x83, 0xD8, 0xFF, 0xFD, 0x0A, 0x01,
+  0x80, 0x3B, 0x41, 0x80, 0x9C, 0x04, 0x80, 0xAD, 0x41, 0x80, 0x37, 0x01, 0x80, 0x6B, 0x4A, 0x80,
+  0x67, 0x01, 0x80, 0x9B, 0x4A, 0x80, 0x97, 0x01, 0x80, 0xCB, 0x4A, 0x83, 0xC7, 0x00, 0x03, 0xF7,
+  0x41, 0x80, 0x0F, 0x04, 0x80, 0x17, 0x41, 0x82, 0xF4, 0x02, 0x2C, 0x41, 0x80, 0xDD, 0x06, 0x80,
+  0xE4, 0x41, 0x81, 0x27, 0x5C, 0x41, 0x80, 0xAC, 0x06, 0x80, 0xB2, 0x41, 0x81, 0x57, 0x8C, 0x41,
+  0x80, 0x7A, 0x06, 0x80, 0x7F, 0x41, 0x81, 0x87, 0xBC, 0x41, 0x80, 0x49, 0x06, 0x80, 0x4C, 0x41,
+  0x81, 0xB7, 0xEB, 0x41, 0x80, 0x18, 0x06, 0x80, 0x19, 0x41, 0x80, 0xE7, 0x49, 0x82, 0xFB, 0xC4,
+  0x23, 0x4B, 0x80, 0xB8, 0x4B, 0x80, 0xE8, 0x42, 0x05, 0x80, 0x14, 0x41, 0x80, 0xEC, 0x42, 0x05,
+  0x80, 0x14, 0x41, 0x80, 0xEC, 0x42, 0x05, 0x80, 0x14, 0x41, 0x80, 0xEC, 0x42, 0x05, 0x80, 0x14,
+  0x41, 0x80, 0xEC, 0x42, 0x05, 0x80, 0x14, 0x41, 0x80, 0xEC, 0x42, 0x05, 0x80, 0x14, 0x41, 0x80,
+  0xEC, 0x42, 0x05, 0x80, 0x14, 0x41, 0x80, 0xEC, 0x42, 0x05, 0x80, 0x14, 0x41, 0x80, 0xEC, 0x42,
+  0x05, 0x80, 0x14, 0x41, 0x80, 0xEC, 0x42, 0x04, 0x81, 0x0B, 0x91, 0x41, 0x80, 0xEC, 0x42, 0x03,
+  0x81, 0x45, 0xDE, 0x42, 0x80, 0xCE, 0x49, 0x82, 0xFA, 0xA9, 0x1F, 0x48, 0x81, 0xD9, 0x29, 0x01,
+  0x49, 0x82, 0xF7, 0xA1, 0x26, 0x42, 0x03, 0x81, 0x3E, 0xD3, 0x42, 0x80, 0xE5, 0x42, 0x04, 0x81,
+  0x04, 0x73, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x4E, 0x80, 0xFC, 0x4B, 0x80, 0xCD, 0x49, 0x82, 0xFD, 0xCE,
+  0x2F, 0x82, 0x2F, 0xCD, 0xFC, 0x46, 0x83, 0xFC, 0xCC, 0x2D, 0xCE, 0x4A, 0x81, 0xCC, 0xFD, 0x4A,
+  0x80, 0xFC, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09,
+  0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD,
+  0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCD, 0x2F, 0x46, 0x83, 0xF8, 0xD8, 0x88, 0x12, 0x01, 0x49,
+  0x82, 0xE4, 0x2B, 0x00, 0x4A, 0x81, 0xDF, 0x0F, 0x42, 0x02, 0x83, 0x02, 0x25, 0x8D, 0xFD, 0x41,
+  0x80, 0x80, 0x42, 0x05, 0x80, 0x90, 0x41, 0x80, 0xD4, 0x42, 0x05, 0x80, 0x26, 0x41, 0x80, 0xF8,
+  0x42, 0x05, 0x80, 0x03, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x05, 0x80, 0x04, 0x45, 0x05, 0x80, 0x28,
+  0x41, 0x80, 0xF8, 0x42, 0x05, 0x80, 0x94, 0x41, 0x80, 0xD5, 0x42, 0x02, 0x83, 0x04, 0x28, 0x94,
+  0xFE, 0x41, 0x80, 0x80, 0x4A, 0x81, 0xE0, 0x0F, 0x49, 0x82, 0xE4, 0x2B, 0x00, 0x46, 0x83, 0xF8,
+  0xD8, 0x88, 0x12, 0x01, 0x63, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07,
+  0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
+  0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07,
+  0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x60, 0x60, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42,
+  0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x48,
+  0x00, 0x48, 0x00, 0x48, 0x00, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42,
+  0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42,
+  0x06, 0x42, 0x06, 0x82, 0x2F, 0xCD, 0xFC, 0x46, 0x83, 0xFC, 0xCC, 0x2D, 0xCE, 0x4A, 0x81, 0xCC,
+  0xFD, 0x4A, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x03,
+  0x48, 0x03, 0x48, 0x03, 0x48, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A,
+  0x83, 0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x6C, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x42, 0x7F, 0x5F, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09,
+  0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09,
+  0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09,
+  0x42, 0x09, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD,
+  0xCE, 0x2F, 0x42, 0x04, 0x80, 0x35, 0x41, 0x81, 0xDC, 0x00, 0x42, 0x04, 0x80, 0xA0, 0x41, 0x81,
+  0x72, 0x00, 0x42, 0x03, 0x85, 0x12, 0xF7, 0xFF, 0xF5, 0x10, 0x00, 0x42, 0x03, 0x80, 0x74, 0x41,
+  0x80, 0x9B, 0x01, 0x42, 0x02, 0x81, 0x01, 0xDC, 0x41, 0x80, 0x2F, 0x01, 0x42, 0x02, 0x80, 0x49,
+  0x41, 0x80, 0xC4, 0x02, 0x42, 0x02, 0x80, 0xB3, 0x41, 0x80, 0x58, 0x02, 0x42, 0x01, 0x84, 0x1F,
+  0xFD, 0xFF, 0xE7, 0x05, 0x02, 0x42, 0x01, 0x80, 0x88, 0x41, 0x80, 0x81, 0x03, 0x42, 0x00, 0x84,
+  0x07, 0xEA, 0xFF, 0xFB, 0x1A, 0x03, 0x42, 0x00, 0x80, 0x5C, 0x41, 0x80, 0xA9, 0x04, 0x42, 0x00,
+  0x80, 0xC7, 0x41, 0x80, 0x3E, 0x04, 0x42, 0x80, 0x30, 0x41, 0x80, 0xD2, 0x05, 0x42, 0x80, 0x9B,
+  0x41, 0x80, 0x67, 0x05, 0x42, 0x83, 0xF5, 0xFF, 0xF0, 0x0B, 0x05, 0x44, 0x80, 0xAB, 0x06, 0x42,
+  0x83, 0xFA, 0xFF, 0xF3, 0x10, 0x05, 0x42, 0x80, 0xA3, 0x41, 0x80, 0x76, 0x05, 0x42, 0x80, 0x2E,
+  0x41, 0x81, 0xE4, 0x05, 0x04, 0x42, 0x00, 0x80, 0xB8, 0x41, 0x80, 0x5D, 0x04, 0x42, 0x00, 0x80,
+  0x43, 0x41, 0x80, 0xD0, 0x04, 0x42, 0x01, 0x80, 0xCE, 0x41, 0x80, 0x44, 0x03, 0x42, 0x01, 0x80,
+  0x59, 0x41, 0x80, 0xB7, 0x03, 0x42, 0x01, 0x81, 0x04, 0xE0, 0x41, 0x80, 0x2B, 0x02, 0x42, 0x02,
+  0x80, 0x6F, 0x41, 0x80, 0x9E, 0x02, 0x42, 0x02, 0x84, 0x0B, 0xED, 0xFF, 0xF9, 0x18, 0x01, 0x42,
+  0x03, 0x80, 0x84, 0x41, 0x80, 0x85, 0x01, 0x42, 0x03, 0x85, 0x17, 0xF8, 0xFF, 0xED, 0x0A, 0x00,
+  0x42, 0x04, 0x80, 0x9A, 0x41, 0x81, 0x6B, 0x00, 0x42, 0x04, 0x84, 0x27, 0xFE, 0xFF, 0xDC, 0x02,
+  0x42, 0x05, 0x80, 0xB0, 0x41, 0x80, 0x52, 0x42, 0x05, 0x80, 0x3B, 0x41, 0x80, 0xC6, 0x42, 0x06,
+  0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+  0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+  0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+  0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x5D, 0x42, 0x80, 0x21, 0x08, 0x80, 0x21, 0x45,
+  0x80, 0x63, 0x08, 0x80, 0x64, 0x45, 0x80, 0xA6, 0x08, 0x80, 0xA7, 0x45, 0x80, 0xE8, 0x08, 0x80,
+  0xE8, 0x46, 0x80, 0x2B, 0x06, 0x80, 0x2C, 0x47, 0x80, 0x6E, 0x06, 0x80, 0x6F, 0x47, 0x80, 0xB1,
+  0x06, 0x80, 0xB2, 0x47, 0x81, 0xF0, 0x03, 0x04, 0x81, 0x03, 0xF0, 0x48, 0x80, 0x36, 0x04, 0x80,
+  0x37, 0x46, 0x80, 0xF4, 0x41, 0x80, 0x79, 0x04, 0x80, 0x7A, 0x41, 0x80, 0xF4, 0x43, 0x83, 0xE3,
+  0xEB, 0xFF, 0xBB, 0x04, 0x83, 0xBC, 0xFF, 0xEA, 0xE3, 0x43, 0x84, 0xFA, 0xA6, 0xFF, 0xF6, 0x07,
+  0x02, 0x84, 0x07, 0xF7, 0xFF, 0xA5, 0xFB, 0x44, 0x80, 0x5F, 0x41, 0x80, 0x41, 0x02, 0x80, 0x42,
+  0x41, 0x80, 0x5E, 0x45, 0x80, 0x19, 0x41, 0x80, 0x83, 0x02, 0x80, 0x84, 0x41, 0x80, 0x18, 0x45,
+  0x00, 0x82, 0xD1, 0xFF, 0xC6, 0x02, 0x83, 0xC7, 0xFF, 0xD0, 0x00, 0x45, 0x00, 0x89, 0x8A, 0xFF,
+  0xFB, 0x0D, 0x00, 0x0E, 0xFB, 0xFF, 0x89, 0x00, 0x45, 0x00, 0x80, 0x43, 0x41, 0x82, 0x4C, 0x00,
+  0x4D, 0x41, 0x81, 0x42, 0x00, 0x45, 0x00, 0x89, 0x07, 0xF5, 0xFF, 0x8E, 0x00, 0x8F, 0xFF, 0xF4,
+  0x06, 0x00, 0x45, 0x01, 0x86, 0xB5, 0xFF, 0xD1, 0x00, 0xD2, 0xFF, 0xB4, 0x01, 0x45, 0x01, 0x86,
+  0x6E, 0xFF, 0xFE, 0x2B, 0xFE, 0xFF, 0x6D, 0x01, 0x45, 0x01, 0x80, 0x27, 0x41, 0x80, 0xAC, 0x41,
+  0x80, 0x26, 0x01, 0x45, 0x02, 0x84, 0xE0, 0xFF, 0xF6, 0xFF, 0xDF, 0x02, 0x45, 0x02, 0x80, 0x99,
+  0x42, 0x80, 0x98, 0x02, 0x45, 0x02, 0x80, 0x52, 0x42, 0x80, 0x51, 0x02, 0x45, 0x02, 0x84, 0x0F,
+  0xFB, 0xFF, 0xFB, 0x0F, 0x02, 0x45, 0x03, 0x82, 0xC4, 0xFF, 0xC3, 0x03, 0x45, 0x03, 0x82, 0x7D,
+  0xFF, 0x7C, 0x03, 0x45, 0x03, 0x82, 0x36, 0xFF, 0x35, 0x03, 0x45, 0x03, 0x82, 0x02, 0xDA, 0x02,
+  0x03, 0x45, 0x0A, 0x45, 0x0A, 0x45, 0x0A, 0x42, 0x41, 0x80, 0x9D, 0x06, 0x44, 0x81, 0xEC, 0x04,
+  0x05, 0x45, 0x80, 0x44, 0x05, 0x45, 0x80, 0x98, 0x05, 0x45, 0x81, 0xE8, 0x02, 0x04, 0x46, 0x80,
+  0x3F, 0x04, 0x46, 0x80, 0x92, 0x04, 0x46, 0x81, 0xE4, 0x01, 0x03, 0x45, 0x82, 0xF4, 0xFF, 0x39,
+  0x03, 0x45, 0x82, 0xAA, 0xFF, 0x8D, 0x03, 0x45, 0x82, 0x56, 0xFF, 0xE0, 0x03, 0x45, 0x83, 0x0B,
+  0xF6, 0xFF, 0x34, 0x02, 0x45, 0x00, 0x82, 0xAE, 0xFF, 0x88, 0x02, 0x45, 0x00, 0x82, 0x5A, 0xFF,
+  0xDB, 0x02, 0x45, 0x00, 0x83, 0x0D, 0xF8, 0xFF, 0x2F, 0x01, 0x45, 0x01, 0x82, 0xB2, 0xFF, 0x82,
+  0x01, 0x45, 0x01, 0x82, 0x5E, 0xFF, 0xD6, 0x01, 0x45, 0x01, 0x84, 0x10, 0xF9, 0xFF, 0x29, 0x00,
+  0x45, 0x02, 0x83, 0xB6, 0xFF, 0x7D, 0x00, 0x45, 0x02, 0x83, 0x62, 0xFF, 0xD0, 0x00, 0x45, 0x02,
+  0x83, 0x12, 0xFB, 0xFF, 0x24, 0x45, 0x03, 0x82, 0xBA, 0xFF, 0x78, 0x45, 0x03, 0x82, 0x66, 0xFF,
+  0xCB, 0x45, 0x03, 0x81, 0x15, 0xFC, 0x46, 0x04, 0x80, 0xBE, 0x46, 0x04, 0x80, 0x6A, 0x46, 0x04,
+  0x81, 0x18, 0xFD, 0x45, 0x05, 0x80, 0xC2, 0x45, 0x05, 0x80, 0x6E, 0x45, 0x05, 0x81, 0x1B, 0xFE,
+  0x44, 0x06, 0x80, 0xC6, 0x44, 0x06, 0x80, 0x72, 0x41, 0x82, 0x2F, 0xCD, 0xFC, 0x46, 0x83, 0xFC,
+  0xCC, 0x2D, 0xCE, 0x4A, 0x81, 0xCC, 0xFD, 0x4A, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80,
+  0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F,
+  0x49, 0x82, 0xFC, 0xCC, 0x2D, 0x4B, 0x80, 0xCC, 0x4B, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x4E, 0x80, 0xFC, 0x4B, 0x80, 0xCC, 0x49, 0x82, 0xFD, 0xCD, 0x2D,
+  0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09,
+  0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x82, 0x2F, 0xCD, 0xFC, 0x46, 0x82,
+  0xFC, 0xCD, 0x2F, 0x01, 0x80, 0xCE, 0x4A, 0x80, 0xCD, 0x01, 0x80, 0xFD, 0x4A, 0x80, 0xFC, 0x01,
+  0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01,
+  0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01,
+  0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01,
+  0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01,
+  0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x03, 0x82, 0xB4,
+  0x07, 0x00, 0x42, 0x01, 0x42, 0x03, 0x40, 0x81, 0xB6, 0x07, 0x42, 0x01, 0x42, 0x03, 0x41, 0x80,
+  0xB6, 0x42, 0x01, 0x42, 0x03, 0x80, 0x7F, 0x44, 0x01, 0x42, 0x04, 0x80, 0x7E, 0x43, 0x01, 0x42,
+  0x05, 0x80, 0x7D, 0x42, 0x81, 0x65, 0x00, 0x42, 0x06, 0x43, 0x81, 0x76, 0xFD, 0x4D, 0x80, 0xCE,
+  0x4A, 0x85, 0xC1, 0xC6, 0xFF, 0x31, 0xCE, 0xFD, 0x46, 0x84, 0xFD, 0xD1, 0x2A, 0x0B, 0xB9, 0x49,
+  0x83, 0xFC, 0xCC, 0x2D, 0x00, 0x4B, 0x81, 0xCC, 0x00, 0x4B, 0x81, 0xFC, 0x00, 0x42, 0x06, 0x42,
+  0x00, 0x42, 0x06, 0x42, 0x00, 0x42, 0x06, 0x42, 0x00, 0x42, 0x06, 0x42, 0x00, 0x42, 0x06, 0x42,
+  0x00, 0x42, 0x06, 0x42, 0x00, 0x42, 0x06, 0x42, 0x00, 0x42, 0x06, 0x42, 0x00, 0x42, 0x06, 0x42,
+  0x00, 0x42, 0x06, 0x42, 0x00, 0x42, 0x06, 0x42, 0x00, 0x42, 0x01, 0x80, 0xDD, 0x45, 0x81, 0xFC,
+  0x00, 0x42, 0x01, 0x80, 0xAF, 0x45, 0x81, 0xD0, 0x00, 0x42, 0x01, 0x80, 0x57, 0x41, 0x85, 0xF8,
+  0xFA, 0xF3, 0xC2, 0x30, 0x00, 0x42, 0x01, 0x83, 0x0A, 0xF4, 0xFF, 0xA8, 0x04, 0x42, 0x02, 0x83,
+  0xA7, 0xFF, 0xF7, 0x0F, 0x03, 0x42, 0x02, 0x80, 0x4E, 0x41, 0x80, 0x65, 0x03, 0x42, 0x02, 0x83,
+  0x06, 0xEF, 0xFF, 0xC3, 0x03, 0x42, 0x03, 0x80, 0x9E, 0x41, 0x80, 0x22, 0x02, 0x42, 0x03, 0x80,
+  0x46, 0x41, 0x80, 0x80, 0x02, 0x42, 0x03, 0x83, 0x03, 0xEA, 0xFF, 0xDD, 0x02, 0x42, 0x04, 0x80,
+  0x96, 0x41, 0x80, 0x3C, 0x01, 0x42, 0x04, 0x80, 0x3D, 0x41, 0x80, 0x9B, 0x01, 0x42, 0x04, 0x85,
+  0x01, 0xE3, 0xFF, 0xF0, 0x08, 0x00, 0x42, 0x05, 0x80, 0x8D, 0x41, 0x81, 0x57, 0x00, 0x42, 0x05,
+  0x80, 0x35, 0x41, 0x81, 0xB5, 0x00, 0x42, 0x06, 0x83, 0xDC, 0xFF, 0xFC, 0x17, 0x42, 0x06, 0x80,
+  0x85, 0x41, 0x80, 0x72, 0x42, 0x06, 0x80, 0x2C, 0x41, 0x80, 0xD0, 0x82, 0x2D, 0xCC, 0xFC, 0x46,
+  0x83, 0xFC, 0xCD, 0x2F, 0xCD, 0x4A, 0x81, 0xCD, 0xFD, 0x4A, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xE7, 0x41, 0x80, 0x1C, 0x05, 0x42,
+  0x80, 0x93, 0x41, 0x81, 0xD3, 0x10, 0x07, 0x81, 0x0E, 0xD6, 0x41, 0x81, 0xC0, 0x07, 0x07, 0x81,
+  0x1F, 0xE6, 0x41, 0x81, 0xAA, 0x02, 0x07, 0x81, 0x2F, 0xF1, 0x41, 0x80, 0x91, 0x08, 0x81, 0x42,
+  0xF9, 0x41, 0x80, 0x76, 0x08, 0x84, 0x5A, 0xFE, 0xFF, 0xFE, 0x5C, 0x08, 0x80, 0x75, 0x41, 0x81,
+  0xFA, 0x44, 0x08, 0x80, 0x90, 0x41, 0x81, 0xF2, 0x31, 0x07, 0x81, 0x02, 0xAA, 0x41, 0x81, 0xE7,
+  0x20, 0x07, 0x81, 0x07, 0xC1, 0x41, 0x81, 0xD8, 0x10, 0x07, 0x81, 0x10, 0xD4, 0x41, 0x80, 0x97,
+  0x08, 0x80, 0x1C, 0x41, 0x80, 0xE9, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCD, 0x4A, 0x83, 0xCE, 0x2F, 0xCD,
+  0xFD, 0x46, 0x82, 0xFD, 0xCF, 0x31, 0x66, 0x04, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09,
+  0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09,
+  0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09,
+  0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09,
+  0x42, 0x04, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A,
+  0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x80, 0xE8,
+  0x41, 0x80, 0x16, 0x06, 0x80, 0x16, 0x41, 0x81, 0xE7, 0xB9, 0x41, 0x80, 0x43, 0x06, 0x80, 0x43,
+  0x41, 0x81, 0xB7, 0x89, 0x41, 0x80, 0x70, 0x06, 0x80, 0x6F, 0x41, 0x81, 0x87, 0x59, 0x41, 0x80,
+  0x9D, 0x06, 0x80, 0x9B, 0x41, 0x81, 0x57, 0x29, 0x41, 0x80, 0xCA, 0x06, 0x80, 0xC7, 0x41, 0x85,
+  0x27, 0x02, 0xF5, 0xFF, 0xF5, 0x02, 0x04, 0x86, 0x01, 0xF2, 0xFF, 0xF5, 0x02, 0x00, 0xC9, 0x41,
+  0x80, 0x24, 0x04, 0x80, 0x20, 0x41, 0x80, 0xC7, 0x01, 0x80, 0x99, 0x41, 0x80, 0x51, 0x04, 0x80,
+  0x4C, 0x41, 0x80, 0x97, 0x01, 0x80, 0x69, 0x41, 0x80, 0x7E, 0x04, 0x80, 0x78, 0x41, 0x80, 0x67,
+  0x01, 0x80, 0x39, 0x41, 0x80, 0xAB, 0x04, 0x80, 0xA5, 0x41, 0x80, 0x37, 0x01, 0x83, 0x0B, 0xFD,
+  0xFF, 0xD8, 0x04, 0x83, 0xD1, 0xFF, 0xFD, 0x0A, 0x02, 0x83, 0xD9, 0xFF, 0xFC, 0x08, 0x02, 0x83,
+  0x04, 0xF8, 0xFF, 0xD7, 0x03, 0x80, 0xA9, 0x41, 0x80, 0x32, 0x02, 0x80, 0x29, 0x41, 0x80, 0xA7,
+  0x03, 0x80, 0x79, 0x41, 0x80, 0x5F, 0x02, 0x80, 0x56, 0x41, 0x80, 0x77, 0x03, 0x80, 0x49, 0x41,
+  0x80, 0x8C, 0x02, 0x80, 0x82, 0x41, 0x80, 0x47, 0x03, 0x80, 0x18, 0x41, 0x80, 0xB9, 0x02, 0x80,
+  0xAE, 0x41, 0x80, 0x17, 0x04, 0x82, 0xE8, 0xFF, 0xE6, 0x02, 0x82, 0xDA, 0xFF, 0xE7, 0x05, 0x80,
+  0xB9, 0x41, 0x85, 0x13, 0x00, 0x09, 0xFD, 0xFF, 0xB7, 0x05, 0x80, 0x89, 0x41, 0x82, 0x40, 0x00,
+  0x33, 0x41, 0x80, 0x87, 0x05, 0x80, 0x59, 0x41, 0x82, 0x6D, 0x00, 0x5F, 0x41, 0x80, 0x57, 0x05,
+  0x80, 0x29, 0x41, 0x82, 0x9A, 0x00, 0x8B, 0x41, 0x80, 0x27, 0x05, 0x88, 0x02, 0xF5, 0xFF, 0xC7,
+  0x00, 0xB8, 0xFF, 0xF5, 0x02, 0x06, 0x86, 0xC9, 0xFF, 0xF3, 0x01, 0xE4, 0xFF, 0xC7, 0x07, 0x80,
+  0x99, 0x41, 0x80, 0x32, 0x41, 0x80, 0x97, 0x07, 0x80, 0x69, 0x41, 0x80, 0x8B, 0x41, 0x80, 0x67,
+  0x07, 0x80, 0x39, 0x41, 0x80, 0xCA, 0x41, 0x80, 0x37, 0x07, 0x86, 0x0B, 0xFD, 0xFF, 0xF0, 0xFF,
+  0xFD, 0x0A, 0x08, 0x80, 0xD9, 0x42, 0x80, 0xD7, 0x09, 0x80, 0xA9, 0x42, 0x80, 0xA7, 0x09, 0x80,
+  0x79, 0x42, 0x80, 0x77, 0x09, 0x80, 0x49, 0x42, 0x80, 0x47, 0x09, 0x80, 0x18, 0x42, 0x80, 0x17,
+  0x04, 0x80, 0xEC, 0x41, 0x80, 0x14, 0x04, 0x80, 0x14, 0x42, 0x80, 0x13, 0x04, 0x80, 0x15, 0x41,
+  0x81, 0xEB, 0xC5, 0x41, 0x80, 0x3E, 0x04, 0x80, 0x3D, 0x42, 0x80, 0x3A, 0x04, 0x80, 0x40, 0x41,
+  0x81, 0xC3, 0x9D, 0x41, 0x80, 0x67, 0x04, 0x80, 0x65, 0x42, 0x80, 0x61, 0x04, 0x80, 0x6A, 0x41,
+  0x81, 0x9B, 0x75, 0x41, 0x80, 0x91, 0x04, 0x80, 0x8D, 0x42, 0x80, 0x89, 0x04, 0x80, 0x94, 0x41,
+  0x81, 0x73, 0x4D, 0x41, 0x80, 0xBA, 0x04, 0x80, 0xB5, 0x42, 0x80, 0xB0, 0x04, 0x80, 0xBE, 0x41,
+  0x81, 0x4B, 0x25, 0x41, 0x80, 0xE4, 0x04, 0x80, 0xDD, 0x42, 0x80, 0xD7, 0x04, 0x80, 0xE8, 0x41,
+  0x82, 0x23, 0x03, 0xF9, 0x41, 0x80, 0x0E, 0x02, 0x81, 0x07, 0xFD, 0x42, 0x81, 0xFA, 0x04, 0x02,
+  0x80, 0x11, 0x41, 0x83, 0xF8, 0x03, 0x00, 0xD5, 0x41, 0x80, 0x37, 0x02, 0x80, 0x2D, 0x44, 0x80,
+  0x26, 0x02, 0x80, 0x3C, 0x41, 0x80, 0xD3, 0x01, 0x80, 0xAD, 0x41, 0x80, 0x60, 0x02, 0x80, 0x55,
+  0x41, 0x80, 0xFD, 0x41, 0x80, 0x4D, 0x02, 0x80, 0x66, 0x41, 0x80, 0xAB, 0x01, 0x80, 0x85, 0x41,
+  0x80, 0x8A, 0x02, 0x80, 0x7D, 0x41, 0x80, 0xE9, 0x41, 0x80, 0x74, 0x02, 0x80, 0x90, 0x41, 0x80,
+  0x83, 0x01, 0x80, 0x5D, 0x41, 0x80, 0xB3, 0x02, 0x80, 0xA5, 0x41, 0x80, 0xBF, 0x41, 0x80, 0x9C,
+  0x02, 0x80, 0xBB, 0x41, 0x80, 0x5B, 0x01, 0x80, 0x35, 0x41, 0x80, 0xDD, 0x02, 0x80, 0xCD, 0x41,
+  0x80, 0x70, 0x41, 0x80, 0xC3, 0x02, 0x80, 0xE5, 0x41, 0x80, 0x33, 0x01, 0x80, 0x0D, 0x41, 0x81,
+  0xFD, 0x09, 0x01, 0x80, 0xF3, 0x41, 0x80, 0x20, 0x41, 0x80, 0xEA, 0x01, 0x80, 0x0F, 0x42, 0x80,
+  0x0C, 0x02, 0x80, 0xE5, 0x41, 0x82, 0x30, 0x00, 0x1D, 0x41, 0x82, 0xE4, 0x00, 0xEB, 0x41, 0x82,
+  0x12, 0x00, 0x39, 0x41, 0x80, 0xE3, 0x03, 0x80, 0xBD, 0x41, 0x82, 0x5A, 0x00, 0x45, 0x41, 0x82,
+  0xBC, 0x00, 0xC3, 0x41, 0x82, 0x39, 0x00, 0x63, 0x41, 0x80, 0xBB, 0x03, 0x80, 0x95, 0x41, 0x82,
+  0x83, 0x00, 0x6D, 0x41, 0x82, 0x94, 0x00, 0x9A, 0x41, 0x82, 0x60, 0x00, 0x8D, 0x41, 0x80, 0x93,
+  0x03, 0x80, 0x6D, 0x41, 0x82, 0xAD, 0x00, 0x95, 0x41, 0x82, 0x6C, 0x00, 0x72, 0x41, 0x82, 0x88,
+  0x00, 0xB7, 0x41, 0x80, 0x6B, 0x03, 0x80, 0x45, 0x41, 0x82, 0xD6, 0x00, 0xBD, 0x41, 0x82, 0x44,
+  0x00, 0x4A, 0x41, 0x82, 0xAF, 0x00, 0xE1, 0x41, 0x80, 0x43, 0x03, 0x80, 0x1D, 0x41, 0x82, 0xFA,
+  0x05, 0xE5, 0x41, 0x82, 0x1C, 0x00, 0x21, 0x41, 0x82, 0xD6, 0x0C, 0xFE, 0x41, 0x80, 0x1B, 0x04,
+  0x80, 0xF3, 0x41, 0x80, 0x37, 0x41, 0x80, 0xF3, 0x01, 0x84, 0x02, 0xF6, 0xFF, 0xFA, 0x39, 0x41,
+  0x80, 0xF2, 0x05, 0x80, 0xCD, 0x41, 0x80, 0x88, 0x41, 0x80, 0xCC, 0x02, 0x80, 0xD1, 0x41, 0x80,
+  0x85, 0x41, 0x80, 0xCB, 0x05, 0x80, 0xA5, 0x41, 0x80, 0xCF, 0x41, 0x80, 0xA4, 0x02, 0x80, 0xA8,
+  0x41, 0x80, 0xCC, 0x41, 0x80, 0xA3, 0x05, 0x80, 0x7D, 0x41, 0x80, 0xED, 0x41, 0x80, 0x7C, 0x02,
+  0x80, 0x80, 0x41, 0x80, 0xEC, 0x41, 0x80, 0x7B, 0x05, 0x80, 0x55, 0x41, 0x80, 0xFE, 0x41, 0x80,
+  0x54, 0x02, 0x80, 0x57, 0x41, 0x80, 0xFD, 0x41, 0x80, 0x53, 0x05, 0x80, 0x2D, 0x44, 0x80, 0x2C,
+  0x02, 0x80, 0x2F, 0x44, 0x80, 0x2B, 0x05, 0x81, 0x07, 0xFD, 0x42, 0x81, 0xFC, 0x07, 0x02, 0x81,
+  0x08, 0xFD, 0x42, 0x81, 0xFC, 0x06, 0x06, 0x80, 0xDD, 0x42, 0x80, 0xDC, 0x04, 0x80, 0xDE, 0x42,
+  0x80, 0xDB, 0x07, 0x80, 0xB5, 0x42, 0x80, 0xB4, 0x04, 0x80, 0xB6, 0x42, 0x80, 0xB3, 0x07, 0x80,
+  0x8D, 0x42, 0x80, 0x8C, 0x04, 0x80, 0x8E, 0x42, 0x80, 0x8B, 0x07, 0x80, 0x65, 0x42, 0x80, 0x64,
+  0x04, 0x80, 0x65, 0x42, 0x80, 0x63, 0x07, 0x80, 0x3D, 0x42, 0x80, 0x3C, 0x04, 0x80, 0x3D, 0x42,
+  0x80, 0x3B, 0x07, 0x80, 0x14, 0x42, 0x80, 0x14, 0x04, 0x80, 0x14, 0x42, 0x80, 0x13, 0x03, 0x80,
+  0xD1, 0x41, 0x80, 0x2F, 0x06, 0x80, 0x2E, 0x41, 0x81, 0xDF, 0x6F, 0x41, 0x80, 0x8F, 0x06, 0x80,
+  0x8D, 0x41, 0x85, 0x7D, 0x13, 0xF9, 0xFF, 0xEA, 0x05, 0x04, 0x86, 0x03, 0xE7, 0xFF, 0xFD, 0x1C,
+  0x00, 0xA8, 0x41, 0x80, 0x4F, 0x04, 0x80, 0x49, 0x41, 0x80, 0xB5, 0x01, 0x80, 0x45, 0x41, 0x80,
+  0xAF, 0x04, 0x80, 0xA7, 0x41, 0x80, 0x52, 0x01, 0x84, 0x01, 0xDF, 0xFF, 0xFA, 0x14, 0x02, 0x84,
+  0x0E, 0xF6, 0xFF, 0xE9, 0x05, 0x02, 0x80, 0x7D, 0x41, 0x80, 0x6F, 0x02, 0x80, 0x63, 0x41, 0x80,
+  0x8B, 0x03, 0x83, 0x1B, 0xFC, 0xFF, 0xCF, 0x02, 0x80, 0xC1, 0x41, 0x80, 0x28, 0x04, 0x80, 0xB4,
+  0x41, 0x85, 0x2E, 0x00, 0x1F, 0xFE, 0xFF, 0xC4, 0x05, 0x80, 0x50, 0x41, 0x82, 0x8E, 0x00, 0x7C,
+  0x41, 0x80, 0x60, 0x05, 0x88, 0x04, 0xE7, 0xFF, 0xE9, 0x05, 0xD9, 0xFF, 0xF2, 0x0A, 0x06, 0x80,
+  0x87, 0x41, 0x80, 0x86, 0x41, 0x80, 0x99, 0x07, 0x83, 0x24, 0xFE, 0xFF, 0xFE, 0x41, 0x80, 0x35,
+  0x08, 0x80, 0xBE, 0x42, 0x80, 0xD2, 0x09, 0x80, 0x59, 0x42, 0x80, 0x6E, 0x09, 0x81, 0x08, 0xFA,
+  0x41, 0x80, 0x27, 0x09, 0x80, 0x3D, 0x42, 0x80, 0x70, 0x09, 0x80, 0x9D, 0x42, 0x80, 0xCD, 0x08,
+  0x83, 0x0A, 0xF2, 0xFF, 0xFE, 0x41, 0x80, 0x2A, 0x07, 0x80, 0x5D, 0x41, 0x80, 0x90, 0x41, 0x80,
+  0x86, 0x07, 0x87, 0xBD, 0xFF, 0xEB, 0x09, 0xEB, 0xFF, 0xE1, 0x01, 0x05, 0x85, 0x1F, 0xFE, 0xFF,
+  0x98, 0x00, 0x99, 0x41, 0x80, 0x40, 0x05, 0x80, 0x7E, 0x41, 0x82, 0x40, 0x00, 0x41, 0x41, 0x80,
+  0x9D, 0x05, 0x89, 0xDC, 0xFF, 0xE6, 0x02, 0x00, 0x02, 0xE6, 0xFF, 0xF1, 0x08, 0x03, 0x80, 0x3E,
+  0x41, 0x80, 0x91, 0x02, 0x80, 0x92, 0x41, 0x80, 0x56, 0x03, 0x80, 0x9E, 0x41, 0x80, 0x39, 0x02,
+  0x80, 0x3A, 0x41, 0x80, 0xB2, 0x02, 0x84, 0x0B, 0xF2, 0xFF, 0xE0, 0x01, 0x02, 0x84, 0x01, 0xE1,
+  0xFF, 0xFA, 0x14, 0x01, 0x80, 0x5F, 0x41, 0x80, 0x8A, 0x04, 0x80, 0x8B, 0x41, 0x80, 0x6B, 0x01,
+  0x80, 0xBF, 0x41, 0x80, 0x32, 0x04, 0x80, 0x33, 0x41, 0x85, 0xC6, 0x00, 0x20, 0xFE, 0xFF, 0xDA,
+  0x06, 0x80, 0xDB, 0x41, 0x81, 0x23, 0x7F, 0x41, 0x80, 0x83, 0x06, 0x80, 0x84, 0x41, 0x81, 0x7D,
+  0xDD, 0x41, 0x80, 0x2B, 0x06, 0x80, 0x2C, 0x41, 0x80, 0xD6, 0x80, 0xE6, 0x41, 0x80, 0x24, 0x06,
+  0x80, 0x23, 0x41, 0x81, 0xE5, 0x98, 0x41, 0x80, 0x6C, 0x06, 0x80, 0x6C, 0x41, 0x81, 0x97, 0x49,
+  0x41, 0x80, 0xB4, 0x06, 0x80, 0xB3, 0x41, 0x85, 0x48, 0x07, 0xF3, 0xFF, 0xF5, 0x07, 0x04, 0x86,
+  0x06, 0xF4, 0xFF, 0xF2, 0x07, 0x00, 0xAB, 0x41, 0x80, 0x45, 0x04, 0x80, 0x42, 0x41, 0x80, 0xAA,
+  0x01, 0x80, 0x5C, 0x41, 0x80, 0x8E, 0x04, 0x80, 0x8A, 0x41, 0x80, 0x5B, 0x01, 0x83, 0x11, 0xFB,
+  0xFF, 0xD6, 0x04, 0x83, 0xD1, 0xFF, 0xFB, 0x10, 0x02, 0x80, 0xBD, 0x41, 0x80, 0x1F, 0x02, 0x80,
+  0x19, 0x41, 0x80, 0xBC, 0x03, 0x80, 0x6E, 0x41, 0x80, 0x67, 0x02, 0x80, 0x60, 0x41, 0x80, 0x6D,
+  0x03, 0x80, 0x1F, 0x41, 0x80, 0xB0, 0x02, 0x80, 0xA8, 0x41, 0x80, 0x1F, 0x04, 0x88, 0xD0, 0xFF,
+  0xF2, 0x05, 0x00, 0x02, 0xEC, 0xFF, 0xCF, 0x05, 0x80, 0x81, 0x41, 0x82, 0x41, 0x00, 0x37, 0x41,
+  0x80, 0x80, 0x05, 0x80, 0x32, 0x41, 0x82, 0x89, 0x00, 0x7E, 0x41, 0x80, 0x31, 0x06, 0x86, 0xDF,
+  0xFF, 0xD2, 0x00, 0xC6, 0xFF, 0xDC, 0x07, 0x80, 0x8A, 0x41, 0x83, 0x2C, 0xFC, 0xFF, 0x82, 0x07,
+  0x80, 0x32, 0x41, 0x80, 0xB8, 0x41, 0x80, 0x30, 0x08, 0x80, 0xDB, 0x42, 0x80, 0xE1, 0x09, 0x80,
+  0x8A, 0x42, 0x80, 0x96, 0x09, 0x80, 0x43, 0x42, 0x80, 0x4E, 0x09, 0x80, 0x0B, 0x42, 0x80, 0x0D,
+  0x0A, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42,
+  0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x00, 0x4A, 0x00, 0x4A, 0x00, 0x49, 0x80,
+  0xD1, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7B, 0x07, 0x80, 0x80, 0x41, 0x80, 0x26, 0x07, 0x82, 0xD5,
+  0xFF, 0xD1, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7C, 0x07, 0x80, 0x80, 0x41, 0x80, 0x27, 0x07, 0x82,
+  0xD5, 0xFF, 0xD1, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7C, 0x07, 0x80, 0x80, 0x41, 0x80, 0x27, 0x07,
+  0x82, 0xD5, 0xFF, 0xD2, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7D, 0x07, 0x80, 0x80, 0x41, 0x80, 0x28,
+  0x07, 0x82, 0xD5, 0xFF, 0xD2, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7D, 0x07, 0x80, 0x80, 0x41, 0x80,
+  0x28, 0x07, 0x82, 0xD5, 0xFF, 0xD3, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7E, 0x07, 0x80, 0x80, 0x41,
+  0x80, 0x29, 0x07, 0x82, 0xD5, 0xFF, 0xD3, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7E, 0x07, 0x80, 0x80,
+  0x41, 0x80, 0x29, 0x07, 0x82, 0xD5, 0xFF, 0xD4, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7E, 0x07, 0x80,
+  0x80, 0x41, 0x80, 0x29, 0x07, 0x82, 0xD5, 0xFF, 0xD4, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7F, 0x07,
+  0x80, 0x80, 0x41, 0x80, 0x2A, 0x07, 0x80, 0xD5, 0x62, 0x82, 0x34, 0xD0, 0xFD, 0x44, 0x80, 0xD4,
+  0x46, 0x80, 0xFE, 0x49, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x80, 0xFE, 0x46, 0x80, 0xD4, 0x46, 0x82, 0x36, 0xD2, 0xFD, 0x44, 0x83, 0xCB, 0xFF, 0xE9,
+  0x06, 0x0B, 0x80, 0x61, 0x41, 0x80, 0x5B, 0x0B, 0x83, 0x09, 0xED, 0xFF, 0xC5, 0x0C, 0x80, 0x8D,
+  0x41, 0x80, 0x2F, 0x0B, 0x83, 0x24, 0xFE, 0xFF, 0x99, 0x0C, 0x83, 0xB9, 0xFF, 0xF4, 0x0E, 0x0B,
+  0x80, 0x4F, 0x41, 0x80, 0x6D, 0x0B, 0x83, 0x03, 0xE1, 0xFF, 0xD6, 0x0C, 0x80, 0x7A, 0x41, 0x80,
+  0x41, 0x0B, 0x83, 0x16, 0xF9, 0xFF, 0xAC, 0x0C, 0x83, 0xA6, 0xFF, 0xFB, 0x1A, 0x0B, 0x80, 0x3C,
+  0x41, 0x80, 0x80, 0x0C, 0x83, 0xD1, 0xFF, 0xE5, 0x04, 0x0B, 0x80, 0x68, 0x41, 0x80, 0x54, 0x0B,
+  0x83, 0x0C, 0xF1, 0xFF, 0xBE, 0x0C, 0x80, 0x94, 0x41, 0x80, 0x29, 0x0B, 0x80, 0x2A, 0x41, 0x80,
+  0x92, 0x0C, 0x83, 0xBF, 0xFF, 0xF1, 0x0B, 0x0B, 0x80, 0x55, 0x41, 0x80, 0x67, 0x0B, 0x83, 0x04,
+  0xE6, 0xFF, 0xD0, 0x0C, 0x80, 0x81, 0x41, 0x80, 0x3B, 0x0B, 0x83, 0x1B, 0xFB, 0xFF, 0xA5, 0x0C,
+  0x83, 0xAD, 0xFF, 0xF9, 0x16, 0x0B, 0x80, 0x43, 0x41, 0x80, 0x79, 0x0C, 0x83, 0xD7, 0xFF, 0xE0,
+  0x02, 0x0B, 0x80, 0x6E, 0x41, 0x80, 0x4E, 0x0B, 0x83, 0x0F, 0xF4, 0xFF, 0xB8, 0x0C, 0x83, 0x9A,
+  0xFF, 0xFE, 0x23, 0x0B, 0x80, 0x2F, 0x41, 0x80, 0x8C, 0x0C, 0x83, 0xC6, 0xFF, 0xED, 0x08, 0x0B,
+  0x80, 0x5C, 0x41, 0x80, 0x60, 0x0B, 0x83, 0x07, 0xEA, 0xFF, 0xCA, 0x44, 0x82, 0xFC, 0xCE, 0x32,
+  0x46, 0x80, 0xD2, 0x46, 0x80, 0xFE, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x49, 0x80, 0xFE, 0x46, 0x80, 0xD3, 0x44, 0x82, 0xFC, 0xCF, 0x34, 0x04, 0x83,
+  0xC8, 0xFF, 0xDA, 0x03, 0x07, 0x80, 0x4A, 0x42, 0x80, 0x5B, 0x07, 0x80, 0xCA, 0x42, 0x81, 0xD6,
+  0x02, 0x05, 0x80, 0x4C, 0x41, 0x80, 0xCE, 0x41, 0x80, 0x55, 0x05, 0x87, 0xCC, 0xFF, 0xDD, 0x0D,
+  0xDF, 0xFF, 0xD1, 0x01, 0x03, 0x80, 0x4E, 0x41, 0x82, 0x54, 0x00, 0x5A, 0x41, 0x80, 0x4F, 0x03,
+  0x82, 0xCE, 0xFF, 0xC5, 0x01, 0x83, 0x01, 0xCB, 0xFF, 0xCC, 0x02, 0x80, 0x50, 0x41, 0x80, 0x38,
+  0x02, 0x80, 0x40, 0x41, 0x85, 0x49, 0x00, 0x01, 0xD0, 0xFF, 0xA8, 0x04, 0x87, 0xB4, 0xFF, 0xC6,
+  0x00, 0x53, 0xFF, 0xF8, 0x21, 0x04, 0x86, 0x2A, 0xFC, 0xFF, 0x43, 0xD2, 0xFF, 0x8B, 0x06, 0x82,
+  0x9A, 0xFF, 0xC1, 0x6C, 0xA5, 0xFF, 0xFF, 0xFA, 0x19, 0x00, 0x08, 0xC8, 0xFF, 0xFF, 0x84, 0x00,
+  0x00, 0x18, 0xE2, 0xFF, 0xEB, 0x09, 0x00, 0x00, 0x30, 0xF4, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x51,
+  0xFE, 0xD4, 0x82, 0x1F, 0xB4, 0xFA, 0x45, 0x83, 0xFA, 0xB7, 0x1A, 0xC9, 0x49, 0x80, 0xAD, 0x42,
+  0x05, 0x41, 0x80, 0xF4, 0x42, 0x05, 0x45, 0x05, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x82,
+  0x0E, 0xAB, 0xFE, 0x48, 0x80, 0xA0, 0x4A, 0x80, 0xF9, 0x41, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFD, 0x41, 0x85, 0x15, 0x3F, 0x6A, 0x94,
+  0xBF, 0xEA, 0x42, 0x80, 0xDF, 0x4A, 0x88, 0x55, 0xE9, 0xFA, 0xEC, 0xD0, 0xAB, 0x7D, 0x4A, 0x23,
+  0x42, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+  0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x88, 0x0D, 0x29, 0x44, 0x69, 0xA8,
+  0xDE, 0xF8, 0xDF, 0x55, 0x4A, 0x80, 0xE9, 0x42, 0x85, 0xEB, 0xC0, 0x96, 0x6B, 0x40, 0x15, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x04, 0x80, 0x03, 0x41, 0x80, 0xF4, 0x42, 0x04,
+  0x80, 0x27, 0x41, 0x80, 0xC7, 0x42, 0x02, 0x82, 0x01, 0x21, 0xB8, 0x41, 0x80, 0x5C, 0x49, 0x81,
+  0x9B, 0x00, 0x46, 0x82, 0xF5, 0xC7, 0x5D, 0x01, 0x82, 0x1A, 0xB2, 0xFA, 0x45, 0x83, 0xFB, 0xBC,
+  0x21, 0xB7, 0x49, 0x81, 0xBC, 0xFB, 0x41, 0x05, 0x41, 0x80, 0xFB, 0x42, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+  0x08, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFB, 0x41, 0x05, 0x41, 0x81, 0xFB, 0xBD,
+  0x49, 0x83, 0xBC, 0x22, 0xBD, 0xFB, 0x45, 0x82, 0xFB, 0xBD, 0x21, 0x08, 0x42, 0x08, 0x42, 0x08,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+  0x42, 0x08, 0x42, 0x01, 0x82, 0x5C, 0xC7, 0xF4, 0x46, 0x00, 0x80, 0x9B, 0x49, 0x80, 0x5D, 0x41,
+  0x82, 0xB8, 0x22, 0x01, 0x02, 0x42, 0x80, 0xC7, 0x41, 0x80, 0x26, 0x04, 0x42, 0x80, 0xF5, 0x41,
+  0x80, 0x02, 0x04, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xF8, 0x41, 0x80, 0x02, 0x04, 0x42, 0x80,
+  0xD4, 0x41, 0x80, 0x25, 0x04, 0x42, 0x80, 0x82, 0x41, 0x85, 0xB7, 0x21, 0x0C, 0x44, 0x8C, 0xD8,
+  0x42, 0x81, 0x0F, 0xDE, 0x49, 0x00, 0x87, 0x1D, 0xAB, 0xF2, 0xED, 0xBF, 0x8A, 0x54, 0x1B, 0x42,
+  0x82, 0x28, 0xCC, 0xFD, 0x45, 0x83, 0xFC, 0xCC, 0x28, 0xBC, 0x49, 0x81, 0xBB, 0xFB, 0x41, 0x05,
+  0x41, 0x80, 0xFA, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x59, 0x80, 0x8A,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80,
+  0xFB, 0x41, 0x05, 0x41, 0x81, 0xEA, 0xBC, 0x49, 0x83, 0x8F, 0x28, 0xCD, 0xFD, 0x45, 0x82, 0xFA,
+  0xAA, 0x0D, 0x01, 0x82, 0x14, 0xAC, 0xFA, 0x42, 0x01, 0x80, 0xAD, 0x44, 0x01, 0x80, 0xFA, 0x41,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x02, 0x4F, 0x01, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x02, 0x00, 0x8C, 0x1B, 0xA9, 0xF1, 0xED, 0xBE,
+  0x89, 0x53, 0x1B, 0xE0, 0xE0, 0xE0, 0x0E, 0xDC, 0x49, 0x80, 0x81, 0x41, 0x85, 0xB8, 0x22, 0x0C,
+  0x44, 0x8C, 0xD9, 0x42, 0x80, 0xD4, 0x41, 0x80, 0x25, 0x04, 0x42, 0x80, 0xF8, 0x41, 0x80, 0x02,
+  0x04, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xF5, 0x41, 0x80, 0x02, 0x04, 0x42, 0x80, 0xC7, 0x41,
+  0x80, 0x25, 0x04, 0x42, 0x80, 0x5E, 0x41, 0x82, 0xB7, 0x21, 0x01, 0x02, 0x42, 0x00, 0x80, 0x9B,
+  0x49, 0x01, 0x82, 0x5E, 0xC7, 0xF5, 0x46, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x80, 0xF1, 0x41,
+  0x05, 0x42, 0x80, 0xF6, 0x41, 0x05, 0x42, 0x80, 0xFC, 0x41, 0x05, 0x42, 0x80, 0xF6, 0x41, 0x05,
+  0x41, 0x81, 0xFA, 0x8B, 0x49, 0x83, 0xB2, 0x07, 0xAD, 0xFC, 0x45, 0x82, 0xFD, 0xC8, 0x20, 0x42,
+  0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+  0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x00, 0x87, 0x07, 0x3F, 0x7C, 0xB5, 0xE3, 0xF8,
+  0xD9, 0x43, 0x42, 0x81, 0xBF, 0xF7, 0x45, 0x80, 0xD9, 0x43, 0x84, 0xFC, 0xCE, 0x93, 0x58, 0x1D,
+  0x41, 0x80, 0xFD, 0x42, 0x81, 0x43, 0x0C, 0x03, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0x0C, 0x42, 0x81, 0x08, 0x0C, 0x42,
+  0x81, 0x08, 0x0C, 0x42, 0x81, 0x08, 0x0C, 0x42, 0x80, 0x08, 0x14, 0x42, 0x01, 0x42, 0x01, 0x42,
+  0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42,
+  0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42,
+  0x01, 0x42, 0x00, 0x01, 0x80, 0x0C, 0x42, 0x80, 0x08, 0x01, 0x80, 0x0C, 0x42, 0x80, 0x08, 0x01,
+  0x80, 0x0C, 0x42, 0x80, 0x08, 0x01, 0x80, 0x0C, 0x42, 0x80, 0x08, 0x1E, 0x42, 0x03, 0x42, 0x03,
+  0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03,
+  0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03,
+  0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03,
+  0x41, 0x81, 0xFD, 0x00, 0x44, 0x81, 0xD8, 0x00, 0x43, 0x82, 0xDB, 0x41, 0x00, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x03, 0x80, 0x51, 0x41, 0x80, 0xB2, 0x42, 0x02, 0x84, 0x0F,
+  0xE5, 0xFF, 0xE7, 0x15, 0x42, 0x02, 0x84, 0x98, 0xFF, 0xFE, 0x47, 0x00, 0x42, 0x01, 0x83, 0x3C,
+  0xFE, 0xFF, 0x8F, 0x01, 0x42, 0x00, 0x84, 0x07, 0xD7, 0xFF, 0xD2, 0x07, 0x01, 0x42, 0x00, 0x83,
+  0x82, 0xFF, 0xF7, 0x2B, 0x02, 0x42, 0x83, 0x2A, 0xF9, 0xFF, 0x6C, 0x03, 0x42, 0x82, 0xC6, 0xFF,
+  0xB5, 0x04, 0x44, 0x80, 0x27, 0x04, 0x42, 0x82, 0xE8, 0xFF, 0x85, 0x04, 0x42, 0x83, 0x79, 0xFF,
+  0xF4, 0x16, 0x03, 0x42, 0x83, 0x0F, 0xF1, 0xFF, 0x90, 0x03, 0x42, 0x00, 0x83, 0x88, 0xFF, 0xF8,
+  0x1D, 0x02, 0x42, 0x00, 0x83, 0x17, 0xF7, 0xFF, 0x9B, 0x02, 0x42, 0x01, 0x83, 0x97, 0xFF, 0xFB,
+  0x25, 0x01, 0x42, 0x01, 0x83, 0x22, 0xFC, 0xFF, 0xA6, 0x01, 0x42, 0x02, 0x84, 0xA6, 0xFF, 0xFE,
+  0x2E, 0x00, 0x42, 0x02, 0x80, 0x2E, 0x41, 0x81, 0xB1, 0x00, 0x42, 0x03, 0x80, 0xB5, 0x41, 0x80,
+  0x37, 0x42, 0x03, 0x80, 0x3C, 0x41, 0x80, 0xBD, 0x7F, 0x5F, 0x42, 0x01, 0x86, 0x19, 0x68, 0xAC,
+  0xE0, 0xF6, 0xB2, 0x07, 0x01, 0x86, 0x19, 0x65, 0xAA, 0xE0, 0xF9, 0xD9, 0x43, 0x42, 0x82, 0x6B,
+  0xC1, 0xFD, 0x44, 0x83, 0x88, 0x71, 0xC3, 0xFD, 0x44, 0x80, 0xD9, 0x45, 0x82, 0xFE, 0xD9, 0xA6,
+  0x45, 0x82, 0xFE, 0xD9, 0xA6, 0x41, 0x80, 0xFD, 0x42, 0x83, 0xA6, 0x73, 0x40, 0x0E, 0x01, 0x42,
+  0x83, 0xA6, 0x73, 0x40, 0x0E, 0x01, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05,
+  0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05,
+  0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05,
+  0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x45, 0x05,
+  0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x42, 0x42, 0x00, 0x87, 0x04, 0x33, 0x6B, 0xA4, 0xDA, 0xF4,
+  0xE9, 0x55, 0x42, 0x81, 0xBE, 0xF5, 0x45, 0x80, 0xDF, 0x43, 0x84, 0xFC, 0xCE, 0x93, 0x58, 0x1D,
+  0x41, 0x80, 0xFD, 0x42, 0x81, 0x43, 0x0C, 0x03, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x82, 0x20, 0xC7, 0xFC, 0x45, 0x83, 0xFC,
+  0xC7, 0x20, 0xB2, 0x49, 0x81, 0xB2, 0xFA, 0x41, 0x05, 0x41, 0x80, 0xF9, 0x42, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFA, 0x41, 0x05, 0x41, 0x81, 0xFA,
+  0xB2, 0x49, 0x83, 0xB2, 0x20, 0xC8, 0xFD, 0x45, 0x82, 0xFD, 0xC8, 0x20, 0x42, 0x01, 0x86, 0x22,
+  0x59, 0x9F, 0xDB, 0xF7, 0xD9, 0x43, 0x42, 0x81, 0xBA, 0xED, 0x45, 0x80, 0xD9, 0x43, 0x84, 0xFC,
+  0xCE, 0x93, 0x58, 0x1D, 0x41, 0x80, 0xFD, 0x42, 0x81, 0x43, 0x0C, 0x03, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x04, 0x80, 0x03, 0x41, 0x80, 0xF2, 0x42, 0x04, 0x80, 0x27, 0x41, 0x80, 0xB6,
+  0x42, 0x02, 0x85, 0x01, 0x21, 0xB8, 0xFF, 0xFC, 0x38, 0x48, 0x82, 0xFC, 0x61, 0x00, 0x46, 0x82,
+  0xF2, 0xB7, 0x38, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x00, 0x87, 0x1B, 0xA9, 0xF1, 0xED, 0xBE, 0x89, 0x53, 0x1B,
+  0x42, 0x81, 0x0E, 0xDC, 0x49, 0x80, 0x81, 0x41, 0x85, 0xD4, 0x27, 0x12, 0x4C, 0x91, 0xDB, 0x42,
+  0x80, 0xD4, 0x41, 0x80, 0x4E, 0x04, 0x42, 0x80, 0xF8, 0x41, 0x80, 0x16, 0x04, 0x45, 0x80, 0x03,
+  0x04, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x80, 0x02, 0x04, 0x42, 0x80, 0xF5, 0x41, 0x80, 0x1A, 0x04, 0x42, 0x80, 0xC7, 0x41,
+  0x80, 0x5E, 0x04, 0x42, 0x80, 0x5E, 0x41, 0x82, 0xE8, 0x4B, 0x0B, 0x02, 0x42, 0x00, 0x80, 0x9B,
+  0x49, 0x01, 0x82, 0x5E, 0xC7, 0xF5, 0x46, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x42, 0x00, 0x87, 0x1C, 0x6C, 0xAE, 0xE1,
+  0xF7, 0xED, 0xAE, 0x1B, 0x42, 0x81, 0xC9, 0xFE, 0x45, 0x80, 0xB9, 0x42, 0x85, 0xFD, 0xD9, 0xA9,
+  0x79, 0x49, 0x18, 0x41, 0x80, 0xFA, 0x42, 0x80, 0x0A, 0x04, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x1F, 0xAF, 0xF8, 0x45, 0x83,
+  0xF8, 0xAE, 0x1F, 0xC7, 0x49, 0x81, 0xC6, 0xFD, 0x41, 0x05, 0x41, 0x80, 0xFC, 0x42, 0x05, 0x45,
+  0x05, 0x42, 0x80, 0xFE, 0x41, 0x80, 0x04, 0x07, 0x80, 0xD4, 0x41, 0x81, 0xC3, 0x1C, 0x06, 0x81,
+  0x38, 0xED, 0x41, 0x81, 0xEC, 0x4A, 0x06, 0x81, 0x1E, 0xC6, 0x41, 0x82, 0xFE, 0x8A, 0x04, 0x05,
+  0x82, 0x04, 0x8B, 0xFE, 0x41, 0x81, 0xC6, 0x1E, 0x06, 0x81, 0x4C, 0xED, 0x41, 0x81, 0xEE, 0x4E,
+  0x06, 0x81, 0x1D, 0xC5, 0x42, 0x81, 0x8E, 0x03, 0x05, 0x82, 0x04, 0x89, 0xFE, 0x41, 0x80, 0x93,
+  0x07, 0x80, 0x4A, 0x41, 0x80, 0xF2, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFD, 0x41,
+  0x05, 0x41, 0x81, 0xFC, 0xC8, 0x49, 0x83, 0xC7, 0x20, 0xB2, 0xFA, 0x45, 0x82, 0xFA, 0xB2, 0x20,
+  0x01, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x02, 0x4F,
+  0x01, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+  0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x80,
+  0xFC, 0x41, 0x04, 0x80, 0xC7, 0x44, 0x01, 0x82, 0x29, 0xC1, 0xFB, 0x42, 0x42, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x03, 0x81, 0x0B,
+  0x42, 0x42, 0x80, 0xFB, 0x41, 0x84, 0x1D, 0x57, 0x92, 0xCC, 0xFC, 0x43, 0x80, 0xB7, 0x45, 0x81,
+  0xFA, 0xC2, 0x42, 0x88, 0x1B, 0xB2, 0xF6, 0xE7, 0xBF, 0x89, 0x49, 0x0B, 0x00, 0x42, 0x80, 0xE0,
+  0x41, 0x80, 0x1D, 0x04, 0x80, 0x1D, 0x41, 0x81, 0xDF, 0xA1, 0x41, 0x80, 0x57, 0x04, 0x80, 0x58,
+  0x41, 0x81, 0x9F, 0x61, 0x41, 0x80, 0x92, 0x04, 0x80, 0x93, 0x41, 0x81, 0x5F, 0x20, 0x41, 0x80,
+  0xCD, 0x04, 0x80, 0xCE, 0x41, 0x85, 0x1F, 0x00, 0xE0, 0xFF, 0xFC, 0x0C, 0x02, 0x83, 0x0C, 0xFC,
+  0xFF, 0xDF, 0x01, 0x80, 0xA1, 0x41, 0x80, 0x43, 0x02, 0x80, 0x44, 0x41, 0x80, 0x9F, 0x01, 0x80,
+  0x61, 0x41, 0x80, 0x7E, 0x02, 0x80, 0x7F, 0x41, 0x80, 0x5F, 0x01, 0x80, 0x20, 0x41, 0x80, 0xB9,
+  0x02, 0x80, 0xBA, 0x41, 0x80, 0x1F, 0x02, 0x88, 0xE0, 0xFF, 0xF1, 0x02, 0x00, 0x02, 0xF1, 0xFF,
+  0xDF, 0x03, 0x80, 0xA1, 0x41, 0x82, 0x2E, 0x00, 0x2F, 0x41, 0x80, 0x9F, 0x03, 0x80, 0x61, 0x41,
+  0x82, 0x69, 0x00, 0x6A, 0x41, 0x80, 0x5F, 0x03, 0x80, 0x20, 0x41, 0x82, 0xA4, 0x00, 0xA5, 0x41,
+  0x80, 0x1F, 0x04, 0x86, 0xE0, 0xFF, 0xDF, 0x00, 0xE0, 0xFF, 0xDF, 0x05, 0x80, 0xA1, 0x41, 0x80,
+  0x35, 0x41, 0x80, 0x9F, 0x05, 0x80, 0x61, 0x41, 0x80, 0xAC, 0x41, 0x80, 0x5F, 0x05, 0x80, 0x20,
+  0x41, 0x80, 0xFD, 0x41, 0x80, 0x1F, 0x06, 0x80, 0xE0, 0x42, 0x80, 0xDF, 0x07, 0x80, 0xA1, 0x42,
+  0x80, 0x9F, 0x07, 0x80, 0x61, 0x42, 0x80, 0x5F, 0x07, 0x80, 0x20, 0x42, 0x80, 0x1F, 0x03, 0x80,
+  0xE0, 0x41, 0x80, 0x1D, 0x04, 0x80, 0x1D, 0x42, 0x80, 0x1D, 0x04, 0x80, 0x1D, 0x41, 0x81, 0xDF,
+  0xA1, 0x41, 0x80, 0x59, 0x04, 0x80, 0x5A, 0x42, 0x80, 0x59, 0x04, 0x80, 0x5A, 0x41, 0x81, 0x9F,
+  0x61, 0x41, 0x80, 0x95, 0x04, 0x80, 0x96, 0x42, 0x80, 0x95, 0x04, 0x80, 0x96, 0x41, 0x81, 0x5F,
+  0x20, 0x41, 0x80, 0xD0, 0x04, 0x80, 0xD1, 0x42, 0x80, 0xD0, 0x04, 0x80, 0xD1, 0x41, 0x85, 0x1F,
+  0x00, 0xE0, 0xFF, 0xFD, 0x0E, 0x02, 0x81, 0x0F, 0xFD, 0x42, 0x81, 0xFD, 0x0E, 0x02, 0x83, 0x0F,
+  0xFD, 0xFF, 0xDF, 0x01, 0x80, 0xA1, 0x41, 0x80, 0x48, 0x02, 0x80, 0x49, 0x41, 0x80, 0xC4, 0x41,
+  0x80, 0x48, 0x02, 0x80, 0x49, 0x41, 0x80, 0x9F, 0x01, 0x80, 0x61, 0x41, 0x80, 0x84, 0x02, 0x80,
+  0x85, 0x41, 0x80, 0x4D, 0x41, 0x80, 0x84, 0x02, 0x80, 0x85, 0x41, 0x80, 0x5F, 0x01, 0x80, 0x20,
+  0x41, 0x80, 0xBF, 0x02, 0x86, 0xC0, 0xFF, 0xE9, 0x01, 0xEA, 0xFF, 0xBF, 0x02, 0x80, 0xC0, 0x41,
+  0x80, 0x1F, 0x02, 0x92, 0xE0, 0xFF, 0xF5, 0x05, 0x00, 0x05, 0xF6, 0xFF, 0xAE, 0x00, 0xAF, 0xFF,
+  0xF5, 0x05, 0x00, 0x05, 0xF6, 0xFF, 0xDF, 0x03, 0x80, 0xA1, 0x41, 0x82, 0x37, 0x00, 0x38, 0x41,
+  0x82, 0x73, 0x00, 0x74, 0x41, 0x82, 0x37, 0x00, 0x38, 0x41, 0x80, 0x9F, 0x03, 0x80, 0x61, 0x41,
+  0x82, 0x73, 0x00, 0x74, 0x41, 0x82, 0x37, 0x00, 0x38, 0x41, 0x82, 0x73, 0x00, 0x74, 0x41, 0x80,
+  0x5F, 0x03, 0x80, 0x20, 0x41, 0x8C, 0xAE, 0x00, 0xAF, 0xFF, 0xF6, 0x05, 0x00, 0x05, 0xF6, 0xFF,
+  0xAE, 0x00, 0xAF, 0x41, 0x80, 0x1F, 0x04, 0x86, 0xE0, 0xFF, 0xE9, 0x01, 0xEA, 0xFF, 0xBF, 0x02,
+  0x86, 0xC0, 0xFF, 0xE9, 0x01, 0xEA, 0xFF, 0xDF, 0x05, 0x80, 0xA1, 0x41, 0x80, 0x4D, 0x41, 0x80,
+  0x84, 0x02, 0x80, 0x85, 0x41, 0x80, 0x4D, 0x41, 0x80, 0x9F, 0x05, 0x80, 0x61, 0x41, 0x80, 0xC4,
+  0x41, 0x80, 0x48, 0x02, 0x80, 0x49, 0x41, 0x80, 0xC4, 0x41, 0x80, 0x5F, 0x05, 0x80, 0x20, 0x43,
+  0x81, 0xFD, 0x0F, 0x02, 0x81, 0x0F, 0xFD, 0x43, 0x80, 0x1F, 0x06, 0x80, 0xE0, 0x42, 0x80, 0xD0,
+  0x04, 0x80, 0xD1, 0x42, 0x80, 0xDF, 0x07, 0x80, 0xA1, 0x42, 0x80, 0x95, 0x04, 0x80, 0x96, 0x42,
+  0x80, 0x9F, 0x07, 0x80, 0x61, 0x42, 0x80, 0x59, 0x04, 0x80, 0x5A, 0x42, 0x80, 0x5F, 0x07, 0x80,
+  0x20, 0x42, 0x80, 0x1D, 0x04, 0x80, 0x1E, 0x42, 0x80, 0x1F, 0x03, 0x00, 0x80, 0xC3, 0x41, 0x80,
+  0x35, 0x03, 0x80, 0x35, 0x41, 0x82, 0xCB, 0x00, 0x48, 0x41, 0x80, 0x9F, 0x03, 0x80, 0xA0, 0x41,
+  0x80, 0x4F, 0x01, 0x83, 0xCC, 0xFF, 0xF7, 0x12, 0x01, 0x84, 0x13, 0xF7, 0xFF, 0xD2, 0x01, 0x01,
+  0x80, 0x52, 0x41, 0x80, 0x74, 0x01, 0x80, 0x75, 0x41, 0x80, 0x57, 0x02, 0x89, 0x01, 0xD5, 0xFF,
+  0xDD, 0x02, 0x02, 0xDD, 0xFF, 0xD8, 0x02, 0x03, 0x80, 0x5C, 0x41, 0x81, 0x4A, 0x4B, 0x41, 0x80,
+  0x5F, 0x04, 0x87, 0x03, 0xDD, 0xFF, 0xB4, 0xB5, 0xFF, 0xDE, 0x04, 0x05, 0x85, 0x66, 0xFF, 0xFD,
+  0xFD, 0xFF, 0x67, 0x06, 0x81, 0x06, 0xE4, 0x41, 0x81, 0xE4, 0x06, 0x07, 0x80, 0x8D, 0x41, 0x80,
+  0x8D, 0x07, 0x81, 0x02, 0xDD, 0x41, 0x81, 0xDC, 0x02, 0x06, 0x80, 0x51, 0x43, 0x80, 0x4E, 0x06,
+  0x85, 0xC1, 0xFF, 0xC3, 0xC4, 0xFF, 0xBD, 0x05, 0x80, 0x30, 0x41, 0x81, 0x65, 0x66, 0x41, 0x80,
+  0x2D, 0x04, 0x87, 0xA1, 0xFF, 0xF7, 0x0F, 0x0F, 0xF7, 0xFF, 0x9B, 0x03, 0x83, 0x17, 0xF9, 0xFF,
+  0xA8, 0x01, 0x83, 0xA9, 0xFF, 0xF7, 0x14, 0x02, 0x80, 0x81, 0x41, 0x80, 0x4A, 0x01, 0x80, 0x4B,
+  0x41, 0x80, 0x7A, 0x01, 0x84, 0x07, 0xE9, 0xFF, 0xE7, 0x03, 0x01, 0x86, 0x04, 0xE8, 0xFF, 0xE4,
+  0x04, 0x00, 0x61, 0x41, 0x80, 0x8D, 0x03, 0x80, 0x8E, 0x41, 0x82, 0x58, 0x09, 0xD0, 0x41, 0x80,
+  0x2F, 0x03, 0x80, 0x2F, 0x41, 0x80, 0xC8, 0x80, 0xE0, 0x41, 0x80, 0x1B, 0x04, 0x80, 0x1C, 0x41,
+  0x81, 0xDF, 0xA1, 0x41, 0x80, 0x52, 0x04, 0x80, 0x55, 0x41, 0x81, 0x9F, 0x61, 0x41, 0x80, 0x89,
+  0x04, 0x80, 0x8E, 0x41, 0x81, 0x5F, 0x20, 0x41, 0x80, 0xC0, 0x04, 0x80, 0xC7, 0x41, 0x85, 0x1F,
+  0x00, 0xE0, 0xFF, 0xF4, 0x03, 0x02, 0x83, 0x06, 0xF8, 0xFF, 0xDF, 0x01, 0x80, 0xA1, 0x41, 0x80,
+  0x2F, 0x02, 0x80, 0x38, 0x41, 0x80, 0x9F, 0x01, 0x80, 0x61, 0x41, 0x80, 0x66, 0x02, 0x80, 0x71,
+  0x41, 0x80, 0x5F, 0x01, 0x80, 0x20, 0x41, 0x80, 0x9D, 0x02, 0x80, 0xAA, 0x41, 0x80, 0x1F, 0x02,
+  0x82, 0xE0, 0xFF, 0xD5, 0x02, 0x82, 0xE3, 0xFF, 0xDF, 0x03, 0x85, 0xA1, 0xFF, 0xFD, 0x0E, 0x00,
+  0x1B, 0x41, 0x80, 0x9F, 0x03, 0x80, 0x61, 0x41, 0x82, 0x43, 0x00, 0x54, 0x41, 0x80, 0x5F, 0x03,
+  0x80, 0x20, 0x41, 0x82, 0x7A, 0x00, 0x8D, 0x41, 0x80, 0x1F, 0x04, 0x86, 0xE0, 0xFF, 0xB2, 0x00,
+  0xC6, 0xFF, 0xDF, 0x05, 0x86, 0xA1, 0xFF, 0xE9, 0x06, 0xF7, 0xFF, 0x9F, 0x05, 0x80, 0x61, 0x41,
+  0x80, 0x58, 0x41, 0x80, 0x5F, 0x05, 0x80, 0x20, 0x41, 0x80, 0xC8, 0x41, 0x80, 0x1F, 0x06, 0x80,
+  0xE0, 0x42, 0x80, 0xDF, 0x07, 0x80, 0xA1, 0x42, 0x80, 0x9F, 0x07, 0x80, 0x61, 0x42, 0x80, 0x5F,
+  0x07, 0x80, 0x20, 0x42, 0x80, 0x1F, 0x07, 0x80, 0x1C, 0x41, 0x80, 0xE3, 0x08, 0x80, 0x55, 0x41,
+  0x80, 0xAA, 0x08, 0x80, 0x8E, 0x41, 0x80, 0x71, 0x08, 0x80, 0xC7, 0x41, 0x80, 0x38, 0x07, 0x84,
+  0x07, 0xF8, 0xFF, 0xF8, 0x07, 0x07, 0x80, 0x39, 0x41, 0x80, 0xC6, 0x08, 0x80, 0x72, 0x41, 0x80,
+  0x8D, 0x08, 0x80, 0xAB, 0x41, 0x80, 0x54, 0x08, 0x80, 0xE4, 0x41, 0x80, 0x1C, 0x05, 0x00, 0x48,
+  0x81, 0xFE, 0x00, 0x48, 0x80, 0xB1, 0x06, 0x80, 0x72, 0x41, 0x80, 0x3D, 0x05, 0x83, 0x04, 0xE1,
+  0xFF, 0xC8, 0x06, 0x80, 0x5A, 0x41, 0x80, 0x54, 0x06, 0x83, 0xCD, 0xFF, 0xDC, 0x02, 0x05, 0x80,
+  0x42, 0x41, 0x80, 0x6B, 0x06, 0x83, 0xB6, 0xFF, 0xEC, 0x0A, 0x05, 0x83, 0x2A, 0xFE, 0xFF, 0x82,
+  0x06, 0x83, 0x9E, 0xFF, 0xF7, 0x16, 0x05, 0x83, 0x18, 0xF8, 0xFF, 0x99, 0x06, 0x83, 0x85, 0xFF,
+  0xFE, 0x26, 0x05, 0x83, 0x0B, 0xED, 0xFF, 0xB0, 0x06, 0x80, 0x6D, 0x41, 0x80, 0x3B, 0x05, 0x83,
+  0x03, 0xDD, 0xFF, 0xC7, 0x06, 0x80, 0x55, 0x41, 0x80, 0x52, 0x06, 0x83, 0xC8, 0xFF, 0xDB, 0x02,
+  0x05, 0x80, 0x3D, 0x41, 0x80, 0x6A, 0x06, 0x80, 0xB1, 0x49, 0x80, 0xFE, 0x49, 0x03, 0x83, 0x1E,
+  0xA1, 0xE9, 0xFE, 0x42, 0x02, 0x81, 0x22, 0xEA, 0x45, 0x02, 0x80, 0xAC, 0x46, 0x02, 0x80, 0xF1,
+  0x41, 0x84, 0xBD, 0x35, 0x0B, 0x03, 0x0C, 0x02, 0x42, 0x80, 0x1B, 0x06, 0x42, 0x07, 0x42, 0x07,
+  0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x06, 0x80, 0x62,
+  0x41, 0x80, 0xDF, 0x05, 0x81, 0x5B, 0xFD, 0x41, 0x80, 0x6D, 0x04, 0x84, 0x54, 0xFC, 0xFF, 0xFD,
+  0x78, 0x05, 0x80, 0xF6, 0x41, 0x80, 0x88, 0x06, 0x84, 0x5B, 0xFE, 0xFF, 0xFC, 0x69, 0x06, 0x80,
+  0x6C, 0x42, 0x80, 0x5B, 0x06, 0x80, 0x7E, 0x41, 0x80, 0xD7, 0x07, 0x41, 0x80, 0xFD, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x80, 0x20, 0x06, 0x80, 0xEC, 0x41, 0x84, 0xC2, 0x36, 0x0B, 0x03, 0x0C,
+  0x02, 0x80, 0xA3, 0x46, 0x02, 0x81, 0x1D, 0xE6, 0x45, 0x03, 0x82, 0x1C, 0xA0, 0xEA, 0x43, 0x7F,
+  0x74, 0x42, 0x83, 0xFE, 0xE9, 0xA0, 0x1D, 0x03, 0x45, 0x81, 0xE8, 0x20, 0x02, 0x82, 0xFC, 0xF3,
+  0xFA, 0x43, 0x80, 0xA9, 0x04, 0x82, 0x01, 0x25, 0xB3, 0x41, 0x80, 0xEF, 0x06, 0x80, 0x18, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x80, 0xDC, 0x41, 0x80, 0x62, 0x06, 0x80, 0x5E, 0x41, 0x81, 0xFD, 0x5B, 0x06,
+  0x84, 0x5B, 0xF3, 0xFF, 0xFC, 0x54, 0x06, 0x80, 0x48, 0x41, 0x80, 0xF5, 0x05, 0x84, 0x4D, 0xEF,
+  0xFF, 0xFE, 0x5A, 0x04, 0x81, 0x4C, 0xFE, 0x41, 0x80, 0x6C, 0x05, 0x80, 0xD3, 0x41, 0x80, 0x7D,
+  0x06, 0x80, 0xFD, 0x41, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x06, 0x80, 0x1C, 0x42, 0x04, 0x82, 0x01, 0x27,
+  0xB7, 0x41, 0x80, 0xEA, 0x02, 0x82, 0xFC, 0xF3, 0xFA, 0x43, 0x80, 0x9F, 0x02, 0x45, 0x81, 0xE3,
+  0x1A, 0x02, 0x43, 0x82, 0xE9, 0x9D, 0x19, 0x03, 0x85, 0x89, 0xF6, 0xE5, 0xA4, 0x4D, 0x05, 0x04,
+  0x42, 0x80, 0xF7, 0x43, 0x83, 0xEC, 0x98, 0x3D, 0x01, 0x01, 0x4A, 0x82, 0xE1, 0x87, 0x2D, 0x45,
+  0x82, 0x2E, 0x8A, 0xE3, 0x4A, 0x01, 0x83, 0x02, 0x42, 0x9E, 0xF1, 0x43, 0x80, 0xF6, 0x42, 0x04,
+  0x85, 0x08, 0x55, 0xAB, 0xE8, 0xF6, 0x89, 0x00, 0x00, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42,
+  0x15, 0x82, 0x6C, 0xFF, 0x6E, 0x01, 0x82, 0x72, 0xFF, 0x75, 0x01, 0x82, 0x79, 0xFF, 0x7C, 0x01,
+  0x82, 0x80, 0xFF, 0x82, 0x01, 0x82, 0x86, 0xFF, 0x89, 0x01, 0x82, 0x8D, 0xFF, 0x90, 0x01, 0x82,
+  0x94, 0xFF, 0x96, 0x01, 0x82, 0x9A, 0xFF, 0x9D, 0x01, 0x82, 0xA1, 0xFF, 0xA4, 0x01, 0x82, 0xA8,
+  0xFF, 0xAA, 0x01, 0x82, 0xAE, 0xFF, 0xB1, 0x01, 0x82, 0xB5, 0xFF, 0xB8, 0x01, 0x82, 0xBC, 0xFF,
+  0xBE, 0x01, 0x82, 0xC2, 0xFF, 0xC5, 0x01, 0x82, 0xC9, 0xFF, 0xCC, 0x01, 0x82, 0xD0, 0xFF, 0xD2,
+  0x01, 0x82, 0xD6, 0xFF, 0xD9, 0x01, 0x82, 0xDD, 0xFF, 0xE0, 0x01, 0x82, 0xE4, 0xFF, 0xE6, 0x01,
+  0x82, 0xEA, 0xFF, 0xED, 0x01, 0x82, 0xF1, 0xFF, 0xF4, 0x01, 0x82, 0xF8, 0xFF, 0xFA, 0x01, 0x80,
+  0xFD, 0x41, 0x81, 0x01, 0x05, 0x42, 0x80, 0x08, 0x04, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42,
+  0x06, 0x82, 0x02, 0x03, 0x00, 0x42, 0x00, 0x81, 0x03, 0x02, 0x01, 0x82, 0x23, 0xBF, 0xFC, 0x46,
+  0x83, 0xFC, 0xBF, 0x23, 0xBD, 0x4A, 0x81, 0xBD, 0xFB, 0x4A, 0x80, 0xFB, 0x42, 0x01, 0x42, 0x01,
+  0x45, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x04,
+  0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04,
+  0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01,
+  0x45, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x42, 0x80, 0xFB, 0x4A, 0x81, 0xFB, 0xBE, 0x4A,
+  0x83, 0xBE, 0x24, 0xC4, 0xFE, 0x46, 0x82, 0xFD, 0xC4, 0x24, 0x01, 0x82, 0x05, 0x04, 0x01, 0x42,
+  0x82, 0x01, 0x04, 0x05, 0x06, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x04, 0x01,
+  0x82, 0x20, 0xC0, 0xFC, 0x45, 0x82, 0xFC, 0xBF, 0x1E, 0x01, 0x80, 0xC2, 0x49, 0x80, 0xC0, 0x01,
+  0x80, 0xFC, 0x49, 0x80, 0xFC, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05,
+  0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05,
+  0x42, 0x01, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x08, 0x4A, 0x02, 0x4A, 0x02,
+  0x4A, 0x04, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A,
+  0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x08, 0x69, 0x00, 0x82, 0x1F, 0xBE, 0x1D, 0x0B, 0x88,
+  0x1D, 0xBE, 0x1F, 0x00, 0x1F, 0xE0, 0xFF, 0xDB, 0x1A, 0x09, 0x85, 0x1A, 0xDB, 0xFF, 0xDF, 0x1F,
+  0xBC, 0x42, 0x81, 0xD8, 0x17, 0x07, 0x81, 0x17, 0xD7, 0x42, 0x82, 0xBB, 0x16, 0xCB, 0x42, 0x81,
+  0xD4, 0x15, 0x05, 0x81, 0x13, 0xD3, 0x42, 0x84, 0xCB, 0x16, 0x00, 0x0B, 0xB6, 0x4D, 0x81, 0xB7,
+  0x0C, 0x02, 0x81, 0x04, 0x9D, 0x4B, 0x81, 0xA0, 0x04, 0x05, 0x4B, 0x07, 0x42, 0x05, 0x42, 0x07,
+  0x42, 0x05, 0x42, 0x07, 0x42, 0x05, 0x42, 0x07, 0x42, 0x05, 0x42, 0x07, 0x42, 0x05, 0x42, 0x07,
+  0x42, 0x01, 0x83, 0x01, 0x01, 0x02, 0x03, 0x42, 0x07, 0x4B, 0x05, 0x81, 0x04, 0x9C, 0x4B, 0x81,
+  0x96, 0x03, 0x02, 0x81, 0x0B, 0xB5, 0x4D, 0x84, 0xB1, 0x0A, 0x00, 0x15, 0xCA, 0x42, 0x81, 0xD3,
+  0x13, 0x05, 0x81, 0x15, 0xD5, 0x42, 0x82, 0xC8, 0x15, 0xBC, 0x42, 0x81, 0xD7, 0x16, 0x07, 0x81,
+  0x18, 0xD9, 0x42, 0x85, 0xBB, 0x20, 0xE0, 0xFF, 0xDB, 0x1A, 0x09, 0x88, 0x1B, 0xDC, 0xFF, 0xE0,
+  0x1F, 0x00, 0x20, 0xBF, 0x1D, 0x0B, 0x83, 0x1E, 0xBF, 0x1F, 0x00, 0x80, 0xD9, 0x41, 0x80, 0x24,
+  0x06, 0x80, 0x24, 0x41, 0x81, 0xE2, 0x87, 0x41, 0x80, 0x6C, 0x06, 0x80, 0x6D, 0x41, 0x81, 0x8D,
+  0x33, 0x41, 0x80, 0xB4, 0x06, 0x80, 0xB5, 0x41, 0x85, 0x37, 0x00, 0xDE, 0xFF, 0xF5, 0x07, 0x04,
+  0x83, 0x07, 0xF5, 0xFF, 0xDF, 0x01, 0x80, 0x8A, 0x41, 0x80, 0x45, 0x04, 0x80, 0x46, 0x41, 0x80,
+  0x8A, 0x01, 0x80, 0x36, 0x41, 0x80, 0x8D, 0x04, 0x80, 0x8E, 0x41, 0x80, 0x34, 0x02, 0x82, 0xE0,
+  0xFF, 0xD6, 0x04, 0x82, 0xD7, 0xFF, 0xDD, 0x03, 0x80, 0x8C, 0x41, 0x80, 0x1E, 0x02, 0x80, 0x1E,
+  0x41, 0x80, 0x87, 0x03, 0x80, 0x37, 0x41, 0x80, 0x66, 0x02, 0x80, 0x67, 0x41, 0x80, 0x31, 0x04,
+  0x82, 0xE1, 0xFF, 0xAF, 0x02, 0x82, 0xB0, 0xFF, 0xDB, 0x05, 0x88, 0x8D, 0xFF, 0xF2, 0x05, 0x00,
+  0x05, 0xF2, 0xFF, 0x85, 0x05, 0x80, 0x37, 0x41, 0x82, 0x3F, 0x00, 0x40, 0x41, 0x80, 0x2F, 0x02,
+  0x80, 0x84, 0x44, 0x82, 0x88, 0x00, 0x89, 0x44, 0x81, 0x7C, 0x84, 0x44, 0x82, 0xD0, 0x00, 0xD1,
+  0x44, 0x81, 0x7C, 0x84, 0x45, 0x80, 0x33, 0x45, 0x80, 0x7C, 0x03, 0x80, 0x20, 0x41, 0x80, 0xC2,
+  0x41, 0x80, 0x1C, 0x08, 0x80, 0xD7, 0x42, 0x80, 0xD3, 0x09, 0x80, 0x8E, 0x42, 0x80, 0x8B, 0x09,
+  0x80, 0x45, 0x42, 0x80, 0x43, 0x04, 0x80, 0x84, 0x4C, 0x81, 0x7C, 0x84, 0x4C, 0x81, 0x7C, 0x84,
+  0x4C, 0x80, 0x7C, 0x05, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B,
+  0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x72, 0x1A, 0x72, 0x82, 0x1F, 0xC2, 0xFC, 0x46,
+  0x83, 0xFC, 0xC4, 0x20, 0xBE, 0x4A, 0x81, 0xBF, 0xFC, 0x4A, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x42, 0x80, 0xFE, 0x41, 0x06, 0x42, 0x80, 0xDB, 0x41, 0x81, 0xB9, 0x2F, 0x07, 0x81,
+  0x44, 0xEF, 0x41, 0x82, 0xFD, 0xA1, 0x1D, 0x06, 0x82, 0x15, 0x90, 0xF9, 0x41, 0x82, 0xF7, 0x88,
+  0x0F, 0x06, 0x81, 0x43, 0xF9, 0x42, 0x82, 0xEC, 0x70, 0x06, 0x02, 0x82, 0x11, 0x8D, 0xF9, 0x41,
+  0x80, 0xFE, 0x42, 0x84, 0xDD, 0x53, 0x00, 0x38, 0xEA, 0x41, 0x84, 0xEA, 0x6E, 0x14, 0x7D, 0xEF,
+  0x42, 0x81, 0x73, 0xD1, 0x41, 0x81, 0x80, 0x0C, 0x02, 0x81, 0x10, 0x83, 0x41, 0x81, 0xE7, 0xFC,
+  0x41, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x41, 0x81, 0xFC, 0xE8, 0x41, 0x81, 0x81, 0x0E,
+  0x02, 0x81, 0x06, 0x78, 0x41, 0x81, 0xD1, 0x74, 0x42, 0x84, 0xEC, 0x75, 0x09, 0x4B, 0xDB, 0x41,
+  0x84, 0xEA, 0x38, 0x00, 0x53, 0xDD, 0x42, 0x80, 0xF2, 0x41, 0x82, 0xFD, 0x99, 0x12, 0x02, 0x82,
+  0x06, 0x6F, 0xEC, 0x43, 0x80, 0x66, 0x06, 0x82, 0x0F, 0x88, 0xF7, 0x41, 0x82, 0xFE, 0xA0, 0x1B,
+  0x06, 0x82, 0x1D, 0xA1, 0xFD, 0x41, 0x81, 0xF3, 0x49, 0x07, 0x81, 0x2F, 0xBA, 0x41, 0x80, 0xDC,
+  0x42, 0x06, 0x41, 0x80, 0xFE, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFC, 0x4A, 0x81,
+  0xFC, 0xBE, 0x4A, 0x83, 0xC0, 0x20, 0xC4, 0xFC, 0x46, 0x82, 0xFC, 0xC6, 0x22, 0x42, 0x01, 0x45,
+  0x01, 0x45, 0x01, 0x45, 0x01, 0x42, 0x82, 0x31, 0xC5, 0xFB, 0x4C, 0x83, 0xFB, 0xC5, 0x30, 0xD1,
+  0x50, 0x82, 0xD1, 0xFD, 0xFF, 0x0E, 0x40, 0x80, 0xFC, 0x41, 0x0E, 0x43, 0x0E, 0x43, 0x0E, 0x43,
+  0x0E, 0x43, 0x02, 0x81, 0x93, 0xF7, 0x44, 0x81, 0xF7, 0x91, 0x02, 0x43, 0x02, 0x80, 0xFB, 0x46,
+  0x80, 0xFA, 0x02, 0x43, 0x02, 0x41, 0x04, 0x41, 0x02, 0x43, 0x02, 0x41, 0x04, 0x41, 0x02, 0x43,
+  0x02, 0x41, 0x04, 0x41, 0x02, 0x43, 0x02, 0x41, 0x04, 0x41, 0x02, 0x43, 0x02, 0x41, 0x09, 0x43,
+  0x02, 0x41, 0x09, 0x43, 0x02, 0x41, 0x09, 0x43, 0x02, 0x41, 0x09, 0x43, 0x02, 0x41, 0x09, 0x43,
+  0x02, 0x41, 0x09, 0x43, 0x02, 0x41, 0x04, 0x41, 0x02, 0x43, 0x02, 0x41, 0x04, 0x41, 0x02, 0x43,
+  0x02, 0x41, 0x04, 0x41, 0x02, 0x43, 0x02, 0x41, 0x04, 0x41, 0x02, 0x43, 0x02, 0x80, 0xFC, 0x46,
+  0x80, 0xFC, 0x02, 0x43, 0x02, 0x81, 0x95, 0xF7, 0x44, 0x81, 0xF9, 0x99, 0x02, 0x43, 0x0E, 0x43,
+  0x0E, 0x43, 0x0E, 0x43, 0x0E, 0x41, 0x81, 0xFD, 0xFF, 0x0E, 0x40, 0x81, 0xFD, 0xD1, 0x50, 0x83,
+  0xD1, 0x31, 0xC6, 0xFB, 0x4C, 0x82, 0xFB, 0xC6, 0x31, 0x82, 0x2D, 0xCB, 0xF9, 0x44, 0x83, 0xFD,
+  0xD9, 0x43, 0xB8, 0x48, 0x81, 0xD9, 0xDD, 0x41, 0x80, 0x2C, 0x03, 0x41, 0x81, 0xFD, 0xE0, 0x41,
+  0x80, 0x2C, 0x03, 0x42, 0x80, 0xE0, 0x41, 0x80, 0x2C, 0x03, 0x42, 0x07, 0x42, 0x07, 0x42, 0x82,
+  0x41, 0xD7, 0xFC, 0x47, 0x80, 0xD9, 0x49, 0x80, 0xFD, 0x41, 0x04, 0x45, 0x04, 0x45, 0x04, 0x45,
+  0x04, 0x42, 0x80, 0xFE, 0x41, 0x03, 0x80, 0x01, 0x42, 0x80, 0xE0, 0x41, 0x83, 0xEA, 0xF0, 0xF5,
+  0xFB, 0x43, 0x87, 0x54, 0xF0, 0xFF, 0xFC, 0xE5, 0xCB, 0xB0, 0x9A, 0x42, 0x00, 0x82, 0x01, 0x12,
+  0x02, 0x11, 0x8A, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x4A, 0x8A,
+  0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x03, 0x80, 0x4F, 0x41, 0x80,
+  0xCB, 0x02, 0x80, 0x4F, 0x41, 0x80, 0xCB, 0x02, 0x84, 0x0B, 0xE2, 0xFF, 0xFD, 0x35, 0x01, 0x84,
+  0x0B, 0xE2, 0xFF, 0xFD, 0x35, 0x02, 0x80, 0x8C, 0x41, 0x80, 0x9A, 0x02, 0x80, 0x8C, 0x41, 0x80,
+  0x9A, 0x02, 0x84, 0x2E, 0xFB, 0xFF, 0xEC, 0x13, 0x01, 0x84, 0x2E, 0xFB, 0xFF, 0xEC, 0x13, 0x01,
+  0x81, 0x01, 0xC7, 0x41, 0x80, 0x66, 0x01, 0x81, 0x01, 0xC7, 0x41, 0x80, 0x66, 0x02, 0x80, 0x68,
+  0x41, 0x81, 0xCB, 0x02, 0x01, 0x80, 0x68, 0x41, 0x81, 0xCB, 0x02, 0x01, 0x84, 0x17, 0xEF, 0xFF,
+  0xFD, 0x35, 0x01, 0x84, 0x17, 0xEF, 0xFF, 0xFD, 0x35, 0x02, 0x80, 0xA5, 0x41, 0x80, 0x99, 0x02,
+  0x80, 0xA5, 0x41, 0x80, 0x99, 0x03, 0x42, 0x80, 0x25, 0x02, 0x42, 0x80, 0x25, 0x03, 0x80, 0xA5,
+  0x41, 0x80, 0x96, 0x02, 0x80, 0xA5, 0x41, 0x80, 0x96, 0x03, 0x84, 0x17, 0xEF, 0xFF, 0xFC, 0x2F,
+  0x01, 0x84, 0x17, 0xEF, 0xFF, 0xFC, 0x2F, 0x03, 0x80, 0x68, 0x41, 0x80, 0xC2, 0x02, 0x80, 0x68,
+  0x41, 0x80, 0xC2, 0x03, 0x81, 0x01, 0xC7, 0x41, 0x80, 0x5A, 0x01, 0x81, 0x01, 0xC7, 0x41, 0x80,
+  0x5A, 0x03, 0x84, 0x2E, 0xFB, 0xFF, 0xE4, 0x0B, 0x01, 0x84, 0x2E, 0xFB, 0xFF, 0xE4, 0x0B, 0x03,
+  0x80, 0x8C, 0x41, 0x80, 0x87, 0x02, 0x80, 0x8C, 0x41, 0x80, 0x87, 0x03, 0x84, 0x0B, 0xE2, 0xFF,
+  0xF9, 0x24, 0x01, 0x84, 0x0B, 0xE2, 0xFF, 0xF9, 0x24, 0x03, 0x80, 0x4F, 0x41, 0x80, 0xB4, 0x02,
+  0x80, 0x4F, 0x41, 0x80, 0xB4, 0x6C, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42,
+  0x0B, 0x42, 0x5B, 0x82, 0x31, 0xD1, 0xFD, 0x4C, 0x83, 0xFC, 0xD1, 0x30, 0xC6, 0x50, 0x82, 0xC5,
+  0xFB, 0xFF, 0x0E, 0x40, 0x80, 0xFB, 0x41, 0x0E, 0x43, 0x0E, 0x43, 0x0E, 0x43, 0x0E, 0x43, 0x03,
+  0x44, 0x81, 0xFE, 0xA7, 0x03, 0x43, 0x03, 0x45, 0x80, 0xFB, 0x03, 0x43, 0x03, 0x41, 0x02, 0x41,
+  0x03, 0x43, 0x03, 0x41, 0x02, 0x41, 0x03, 0x43, 0x03, 0x41, 0x02, 0x41, 0x03, 0x43, 0x03, 0x41,
+  0x02, 0x41, 0x03, 0x43, 0x03, 0x41, 0x02, 0x41, 0x03, 0x43, 0x03, 0x41, 0x02, 0x41, 0x03, 0x43,
+  0x03, 0x41, 0x80, 0xD1, 0x42, 0x80, 0xF7, 0x03, 0x43, 0x03, 0x41, 0x80, 0xC9, 0x41, 0x81, 0xF4,
+  0x83, 0x03, 0x43, 0x03, 0x41, 0x82, 0x76, 0xFF, 0x30, 0x05, 0x43, 0x03, 0x41, 0x82, 0x22, 0xFF,
+  0x92, 0x05, 0x43, 0x03, 0x41, 0x00, 0x82, 0xCE, 0xED, 0x07, 0x04, 0x43, 0x03, 0x41, 0x00, 0x82,
+  0x7A, 0xFF, 0x55, 0x04, 0x43, 0x03, 0x41, 0x00, 0x82, 0x25, 0xFF, 0xB6, 0x04, 0x43, 0x03, 0x41,
+  0x01, 0x82, 0xD2, 0xFC, 0x1B, 0x03, 0x43, 0x03, 0x41, 0x01, 0x82, 0x7E, 0xFF, 0x77, 0x03, 0x43,
+  0x03, 0x41, 0x01, 0x82, 0x2A, 0xFF, 0xD4, 0x03, 0x43, 0x0E, 0x43, 0x0E, 0x43, 0x0E, 0x43, 0x0E,
+  0x41, 0x81, 0xFB, 0xFF, 0x0E, 0x40, 0x81, 0xFB, 0xC6, 0x50, 0x83, 0xC5, 0x31, 0xD1, 0xFD, 0x4C,
+  0x82, 0xFD, 0xD1, 0x31, 0x51, 0x82, 0x13, 0xA1, 0xE8, 0x43, 0x83, 0xE8, 0xA1, 0x13, 0xA3, 0x47,
+  0x82, 0xA2, 0xEA, 0xFF, 0x05, 0x40, 0x80, 0xE8, 0x41, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05,
+  0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x41, 0x81, 0xEA, 0xFF,
+  0x05, 0x40, 0x81, 0xE8, 0xA3, 0x47, 0x83, 0xA2, 0x13, 0xA2, 0xE9, 0x43, 0x82, 0xE9, 0xA3, 0x13,
+  0x05, 0x41, 0x0C, 0x41, 0x0C, 0x41, 0x0C, 0x41, 0x0C, 0x41, 0x0C, 0x41, 0x06, 0x80, 0xF4, 0x4C,
+  0x00, 0x80, 0xF4, 0x4C, 0x06, 0x41, 0x0C, 0x41, 0x0C, 0x41, 0x0C, 0x41, 0x0C, 0x41, 0x24, 0x4D,
+  0x80, 0x14, 0x4D, 0x80, 0x14, 0x4D, 0x80, 0x14, 0x00, 0x81, 0x17, 0xF9, 0x41, 0x82, 0xA5, 0x00,
+  0x82, 0x41, 0x8B, 0xC8, 0x08, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x00, 0x64, 0xFF, 0xF5, 0x31, 0x01,
+  0x82, 0xD4, 0xFE, 0x53, 0x02, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x80, 0x0D, 0x04, 0x45, 0x80, 0x45, 0x04, 0x45, 0x85, 0xDB, 0x40, 0x0B,
+  0x1C, 0x4C, 0xC0, 0x51, 0x86, 0x95, 0xEC, 0xF9, 0xDD, 0xAF, 0x3F, 0xFC, 0x44, 0x08, 0x42, 0x08,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x2F, 0xCD, 0xFC,
+  0x4A, 0x80, 0xCE, 0x4C, 0x80, 0xFD, 0x51, 0x05, 0x47, 0x05, 0x47, 0x05, 0x47, 0x05, 0x47, 0x05,
+  0x47, 0x05, 0x47, 0x05, 0x47, 0x05, 0x47, 0x05, 0x47, 0x05, 0x47, 0x05, 0x47, 0x05, 0x47, 0x05,
+  0x42, 0x80, 0xFD, 0x4C, 0x80, 0xCD, 0x4C, 0x82, 0x2F, 0xCD, 0xFD, 0x4A, 0x04, 0x42, 0x02, 0x42,
+  0x04, 0x42, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42,
+  0x04, 0x42, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42,
+  0x04, 0x42, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42,
+  0x4B, 0x01, 0x82, 0xBC, 0xFF, 0x74, 0x03, 0x83, 0xAF, 0xFF, 0xB2, 0x14, 0x02, 0x84, 0x48, 0xFA,
+  0xFF, 0xF2, 0x52, 0x02, 0x83, 0x24, 0x9E, 0xFF, 0xE4, 0x41, 0x02, 0x43, 0x02, 0x41, 0x80, 0xF8,
+  0x44, 0x82, 0xF8, 0x8E, 0xF8, 0x42, 0x81, 0xF8, 0x8D, 0x82, 0x43, 0xD9, 0xFD, 0x44, 0x83, 0xFD,
+  0xD9, 0x43, 0xD9, 0x48, 0x81, 0xD9, 0xFD, 0x41, 0x04, 0x41, 0x80, 0xFD, 0x42, 0x04, 0x45, 0x04,
+  0x45, 0x04, 0x45, 0x04, 0x45, 0x04, 0x45, 0x04, 0x45, 0x04, 0x45, 0x04, 0x45, 0x04, 0x45, 0x04,
+  0x42, 0x80, 0xFD, 0x41, 0x04, 0x41, 0x81, 0xFD, 0xD9, 0x48, 0x83, 0xD9, 0x43, 0xD9, 0xFD, 0x44,
+  0x82, 0xFD, 0xD9, 0x43, 0x20, 0x55, 0x80, 0xB5, 0x41, 0x80, 0x4F, 0x02, 0x80, 0xB5, 0x41, 0x80,
+  0x4F, 0x03, 0x84, 0x25, 0xF9, 0xFF, 0xE1, 0x0B, 0x01, 0x84, 0x25, 0xF9, 0xFF, 0xE1, 0x0B, 0x03,
+  0x80, 0x88, 0x41, 0x80, 0x8B, 0x02, 0x80, 0x88, 0x41, 0x80, 0x8B, 0x03, 0x84, 0x0C, 0xE5, 0xFF,
+  0xFB, 0x2E, 0x01, 0x84, 0x0C, 0xE5, 0xFF, 0xFB, 0x2E, 0x03, 0x80, 0x5B, 0x41, 0x81, 0xC6, 0x01,
+  0x01, 0x80, 0x5B, 0x41, 0x81, 0xC6, 0x01, 0x03, 0x80, 0xC3, 0x41, 0x80, 0x67, 0x02, 0x80, 0xC3,
+  0x41, 0x80, 0x67, 0x03, 0x84, 0x30, 0xFD, 0xFF, 0xEE, 0x16, 0x01, 0x84, 0x30, 0xFD, 0xFF, 0xEE,
+  0x16, 0x03, 0x80, 0x97, 0x41, 0x80, 0xA4, 0x02, 0x80, 0x97, 0x41, 0x80, 0xA4, 0x03, 0x80, 0x26,
+  0x41, 0x80, 0xFE, 0x02, 0x80, 0x26, 0x41, 0x80, 0xFE, 0x03, 0x80, 0x9A, 0x41, 0x80, 0xA4, 0x02,
+  0x80, 0x9A, 0x41, 0x80, 0xA4, 0x02, 0x84, 0x35, 0xFD, 0xFF, 0xEE, 0x16, 0x01, 0x84, 0x35, 0xFD,
+  0xFF, 0xEE, 0x16, 0x01, 0x81, 0x02, 0xCB, 0x41, 0x80, 0x67, 0x01, 0x81, 0x02, 0xCB, 0x41, 0x80,
+  0x67, 0x02, 0x80, 0x67, 0x41, 0x81, 0xC7, 0x01, 0x01, 0x80, 0x67, 0x41, 0x81, 0xC7, 0x01, 0x01,
+  0x84, 0x13, 0xED, 0xFF, 0xFB, 0x2E, 0x01, 0x84, 0x13, 0xED, 0xFF, 0xFB, 0x2E, 0x02, 0x80, 0x9B,
+  0x41, 0x80, 0x8B, 0x02, 0x80, 0x9B, 0x41, 0x80, 0x8B, 0x02, 0x84, 0x35, 0xFE, 0xFF, 0xE1, 0x0B,
+  0x01, 0x84, 0x35, 0xFE, 0xFF, 0xE1, 0x0B, 0x02, 0x80, 0xCB, 0x41, 0x80, 0x4F, 0x02, 0x80, 0xCB,
+  0x41, 0x80, 0x4F, 0x03, 0x04, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x38, 0x82, 0xE0, 0xFF,
+  0xE4, 0x08, 0x82, 0xE0, 0xFF, 0xE4, 0x08, 0x82, 0xE0, 0xFF, 0xE4, 0x08, 0x82, 0xE0, 0xFF, 0xE4,
+  0x08, 0x82, 0xE0, 0xFF, 0xE4, 0x08, 0x82, 0xE0, 0xFF, 0xE3, 0x07, 0x83, 0x07, 0xEB, 0xFF, 0xCB,
+  0x07, 0x80, 0x90, 0x41, 0x80, 0x75, 0x06, 0x84, 0x48, 0xFE, 0xFF, 0xCC, 0x06, 0x05, 0x84, 0x17,
+  0xE9, 0xFF, 0xF4, 0x26, 0x05, 0x81, 0x01, 0xB7, 0x41, 0x80, 0x62, 0x06, 0x80, 0x71, 0x41, 0x80,
+  0xAA, 0x06, 0x84, 0x2E, 0xF8, 0xFF, 0xE1, 0x10, 0x06, 0x80, 0xB5, 0x41, 0x80, 0x3C, 0x07, 0x80,
+  0xF3, 0x41, 0x08, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42,
+  0x80, 0xFD, 0x49, 0x81, 0xFC, 0xCD, 0x49, 0x83, 0xCD, 0x2F, 0xCD, 0xFD, 0x45, 0x82, 0xFD, 0xCE,
+  0x2F, 0x03, 0x80, 0xA5, 0x41, 0x81, 0xFA, 0x19, 0x09, 0x81, 0x08, 0xC8, 0x41, 0x80, 0x84, 0x0A,
+  0x84, 0x18, 0xE2, 0xFF, 0xEB, 0x09, 0x0A, 0x83, 0x30, 0xF4, 0xFF, 0x65, 0x0B, 0x82, 0x51, 0xFE,
+  0xD4, 0x27, 0x80, 0x18, 0x42, 0x80, 0x17, 0x09, 0x80, 0x49, 0x42, 0x80, 0x47, 0x09, 0x80, 0x79,
+  0x42, 0x80, 0x77, 0x09, 0x80, 0xA9, 0x42, 0x80, 0xA7, 0x09, 0x80, 0xD9, 0x42, 0x80, 0xD7, 0x08,
+  0x86, 0x0B, 0xFD, 0xFF, 0xE7, 0xFF, 0xFD, 0x0A, 0x07, 0x80, 0x39, 0x41, 0x80, 0x95, 0x41, 0x80,
+  0x37, 0x07, 0x80, 0x69, 0x41, 0x80, 0x40, 0x41, 0x80, 0x67, 0x07, 0x86, 0x99, 0xFF, 0xE7, 0x07,
+  0xFC, 0xFF, 0x97, 0x07, 0x86, 0xCA, 0xFF, 0xBD, 0x00, 0xDA, 0xFF, 0xC7, 0x06, 0x88, 0x03, 0xF6,
+  0xFF, 0x93, 0x00, 0xAF, 0xFF, 0xF4, 0x02, 0x05, 0x80, 0x2A, 0x41, 0x82, 0x69, 0x00, 0x84, 0x41,
+  0x80, 0x27, 0x05, 0x80, 0x5A, 0x41, 0x82, 0x3F, 0x00, 0x59, 0x41, 0x80, 0x57, 0x05, 0x80, 0x8A,
+  0x41, 0x82, 0x15, 0x00, 0x2F, 0x41, 0x80, 0x87, 0x05, 0x82, 0xBA, 0xFF, 0xEB, 0x01, 0x83, 0x07,
+  0xFC, 0xFF, 0xB7, 0x05, 0x82, 0xE9, 0xFF, 0xC2, 0x02, 0x82, 0xD9, 0xFF, 0xE7, 0x04, 0x80, 0x1A,
+  0x41, 0x80, 0x98, 0x02, 0x80, 0xAE, 0x41, 0x80, 0x17, 0x03, 0x80, 0x4A, 0x41, 0x80, 0x6E, 0x02,
+  0x80, 0x83, 0x41, 0x80, 0x47, 0x03, 0x80, 0x7B, 0x41, 0x80, 0x44, 0x02, 0x80, 0x59, 0x41, 0x80,
+  0x77, 0x03, 0x80, 0xAB, 0x41, 0x80, 0x1A, 0x02, 0x80, 0x2E, 0x41, 0x80, 0xA7, 0x03, 0x82, 0xDB,
+  0xFF, 0xF0, 0x03, 0x83, 0x07, 0xFC, 0xFF, 0xD7, 0x02, 0x83, 0x0C, 0xFE, 0xFF, 0xC6, 0x04, 0x83,
+  0xD8, 0xFF, 0xFD, 0x0A, 0x01, 0x80, 0x3B, 0x41, 0x80, 0x9C, 0x04, 0x80, 0xAD, 0x41, 0x80, 0x37,
+  0x01, 0x80, 0x6B, 0x4A, 0x80, 0x67, 0x01, 0x80, 0x9B, 0x4A, 0x80, 0x97, 0x01, 0x80, 0xCB, 0x4A,
+  0x83, 0xC7, 0x00, 0x03, 0xF7, 0x41, 0x80, 0x0F, 0x04, 0x80, 0x17, 0x41, 0x82, 0xF4, 0x02, 0x2C,
+  0x41, 0x80, 0xDD, 0x06, 0x80, 0xE4, 0x41, 0x81, 0x27, 0x5C, 0x41, 0x80, 0xAC, 0x06, 0x80, 0xB2,
+  0x41, 0x81, 0x57, 0x8C, 0x41, 0x80, 0x7A, 0x06, 0x80, 0x7F, 0x41, 0x81, 0x87, 0xBC, 0x41, 0x80,
+  0x49, 0x06, 0x80, 0x4C, 0x41, 0x81, 0xB7, 0xEB, 0x41, 0x80, 0x18, 0x06, 0x80, 0x19, 0x41, 0x80,
+  0xE7, 0x06, 0x81, 0x17, 0xF9, 0x41, 0x80, 0xA5, 0x09, 0x80, 0x82, 0x41, 0x81, 0xC8, 0x08, 0x08,
+  0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x09, 0x83, 0x64, 0xFF, 0xF5, 0x31, 0x0A, 0x82, 0xD4, 0xFE,
+  0x53, 0x28, 0x80, 0x18, 0x42, 0x80, 0x17, 0x09, 0x80, 0x49, 0x42, 0x80, 0x47, 0x09, 0x80, 0x79,
+  0x42, 0x80, 0x77, 0x09, 0x80, 0xA9, 0x42, 0x80, 0xA7, 0x09, 0x80, 0xD9, 0x42, 0x80, 0xD7, 0x08,
+  0x86, 0x0B, 0xFD, 0xFF, 0xE7, 0xFF, 0xFD, 0x0A, 0x07, 0x80, 0x39, 0x41, 0x80, 0x95, 0x41, 0x80,
+  0x37, 0x07, 0x80, 0x69, 0x41, 0x80, 0x40, 0x41, 0x80, 0x67, 0x07, 0x86, 0x99, 0xFF, 0xE7, 0x07,
+  0xFC, 0xFF, 0x97, 0x07, 0x86, 0xCA, 0xFF, 0xBD, 0x00, 0xDA, 0xFF, 0xC7, 0x06, 0x88, 0x03, 0xF6,
+  0xFF, 0x93, 0x00, 0xAF, 0xFF, 0xF4, 0x02, 0x05, 0x80, 0x2A, 0x41, 0x82, 0x69, 0x00, 0x84, 0x41,
+  0x80, 0x27, 0x05, 0x80, 0x5A, 0x41, 0x82, 0x3F, 0x00, 0x59, 0x41, 0x80, 0x57, 0x05, 0x80, 0x8A,
+  0x41, 0x82, 0x15, 0x00, 0x2F, 0x41, 0x80, 0x87, 0x05, 0x82, 0xBA, 0xFF, 0xEB, 0x01, 0x83, 0x07,
+  0xFC, 0xFF, 0xB7, 0x05, 0x82, 0xE9, 0xFF, 0xC2, 0x02, 0x82, 0xD9, 0xFF, 0xE7, 0x04, 0x80, 0x1A,
+  0x41, 0x80, 0x98, 0x02, 0x80, 0xAE, 0x41, 0x80, 0x17, 0x03, 0x80, 0x4A, 0x41, 0x80, 0x6E, 0x02,
+  0x80, 0x83, 0x41, 0x80, 0x47, 0x03, 0x80, 0x7B, 0x41, 0x80, 0x44, 0x02, 0x80, 0x59, 0x41, 0x80,
+  0x77, 0x03, 0x80, 0xAB, 0x41, 0x80, 0x1A, 0x02, 0x80, 0x2E, 0x41, 0x80, 0xA7, 0x03, 0x82, 0xDB,
+  0xFF, 0xF0, 0x03, 0x83, 0x07, 0xFC, 0xFF, 0xD7, 0x02, 0x83, 0x0C, 0xFE, 0xFF, 0xC6, 0x04, 0x83,
+  0xD8, 0xFF, 0xFD, 0x0A, 0x01, 0x80, 0x3B, 0x41, 0x80, 0x9C, 0x04, 0x80, 0xAD, 0x41, 0x80, 0x37,
+  0x01, 0x80, 0x6B, 0x4A, 0x80, 0x67, 0x01, 0x80, 0x9B, 0x4A, 0x80, 0x97, 0x01, 0x80, 0xCB, 0x4A,
+  0x83, 0xC7, 0x00, 0x03, 0xF7, 0x41, 0x80, 0x0F, 0x04, 0x80, 0x17, 0x41, 0x82, 0xF4, 0x02, 0x2C,
+  0x41, 0x80, 0xDD, 0x06, 0x80, 0xE4, 0x41, 0x81, 0x27, 0x5C, 0x41, 0x80, 0xAC, 0x06, 0x80, 0xB2,
+  0x41, 0x81, 0x57, 0x8C, 0x41, 0x80, 0x7A, 0x06, 0x80, 0x7F, 0x41, 0x81, 0x87, 0xBC, 0x41, 0x80,
+  0x49, 0x06, 0x80, 0x4C, 0x41, 0x81, 0xB7, 0xEB, 0x41, 0x80, 0x18, 0x06, 0x80, 0x19, 0x41, 0x80,
+  0xE7, 0x05, 0x83, 0xA8, 0xFF, 0xB4, 0x01, 0x09, 0x80, 0x72, 0x42, 0x80, 0x7C, 0x08, 0x86, 0x3F,
+  0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x06, 0x88, 0x1B, 0xE8, 0xF9, 0x56, 0x00, 0x5D, 0xFC, 0xEB,
+  0x1D, 0x05, 0x82, 0xC7, 0xF4, 0x46, 0x02, 0x82, 0x52, 0xF9, 0xC7, 0x25, 0x80, 0x18, 0x42, 0x80,
+  0x17, 0x09, 0x80, 0x49, 0x42, 0x80, 0x47, 0x09, 0x80, 0x79, 0x42, 0x80, 0x77, 0x09, 0x80, 0xA9,
+  0x42, 0x80, 0xA7, 0x09, 0x80, 0xD9, 0x42, 0x80, 0xD7, 0x08, 0x86, 0x0B, 0xFD, 0xFF, 0xE7, 0xFF,
+  0xFD, 0x0A, 0x07, 0x80, 0x39, 0x41, 0x80, 0x95, 0x41, 0x80, 0x37, 0x07, 0x80, 0x69, 0x41, 0x80,
+  0x40, 0x41, 0x80, 0x67, 0x07, 0x86, 0x99, 0xFF, 0xE7, 0x07, 0xFC, 0xFF, 0x97, 0x07, 0x86, 0xCA,
+  0xFF, 0xBD, 0x00, 0xDA, 0xFF, 0xC7, 0x06, 0x88, 0x03, 0xF6, 0xFF, 0x93, 0x00, 0xAF, 0xFF, 0xF4,
+  0x02, 0x05, 0x80, 0x2A, 0x41, 0x82, 0x69, 0x00, 0x84, 0x41, 0x80, 0x27, 0x05, 0x80, 0x5A, 0x41,
+  0x82, 0x3F, 0x00, 0x59, 0x41, 0x80, 0x57, 0x05, 0x80, 0x8A, 0x41, 0x82, 0x15, 0x00, 0x2F, 0x41,
+  0x80, 0x87, 0x05, 0x82, 0xBA, 0xFF, 0xEB, 0x01, 0x83, 0x07, 0xFC, 0xFF, 0xB7, 0x05, 0x82, 0xE9,
+  0xFF, 0xC2, 0x02, 0x82, 0xD9, 0xFF, 0xE7, 0x04, 0x80, 0x1A, 0x41, 0x80, 0x98, 0x02, 0x80, 0xAE,
+  0x41, 0x80, 0x17, 0x03, 0x80, 0x4A, 0x41, 0x80, 0x6E, 0x02, 0x80, 0x83, 0x41, 0x80, 0x47, 0x03,
+  0x80, 0x7B, 0x41, 0x80, 0x44, 0x02, 0x80, 0x59, 0x41, 0x80, 0x77, 0x03, 0x80, 0xAB, 0x41, 0x80,
+  0x1A, 0x02, 0x80, 0x2E, 0x41, 0x80, 0xA7, 0x03, 0x82, 0xDB, 0xFF, 0xF0, 0x03, 0x83, 0x07, 0xFC,
+  0xFF, 0xD7, 0x02, 0x83, 0x0C, 0xFE, 0xFF, 0xC6, 0x04, 0x83, 0xD8, 0xFF, 0xFD, 0x0A, 0x01, 0x80,
+  0x3B, 0x41, 0x80, 0x9C, 0x04, 0x80, 0xAD, 0x41, 0x80, 0x37, 0x01, 0x80, 0x6B, 0x4A, 0x80, 0x67,
+  0x01, 0x80, 0x9B, 0x4A, 0x80, 0x97, 0x01, 0x80, 0xCB, 0x4A, 0x83, 0xC7, 0x00, 0x03, 0xF7, 0x41,
+  0x80, 0x0F, 0x04, 0x80, 0x17, 0x41, 0x82, 0xF4, 0x02, 0x2C, 0x41, 0x80, 0xDD, 0x06, 0x80, 0xE4,
+  0x41, 0x81, 0x27, 0x5C, 0x41, 0x80, 0xAC, 0x06, 0x80, 0xB2, 0x41, 0x81, 0x57, 0x8C, 0x41, 0x80,
+  0x7A, 0x06, 0x80, 0x7F, 0x41, 0x81, 0x87, 0xBC, 0x41, 0x80, 0x49, 0x06, 0x80, 0x4C, 0x41, 0x81,
+  0xB7, 0xEB, 0x41, 0x80, 0x18, 0x06, 0x80, 0x19, 0x41, 0x80, 0xE7, 0x02, 0x84, 0x66, 0xEC, 0xE0,
+  0x78, 0x0C, 0x01, 0x41, 0x05, 0x80, 0xEC, 0x42, 0x82, 0xF2, 0x98, 0x32, 0x41, 0x05, 0x41, 0x82,
+  0x32, 0x97, 0xF1, 0x42, 0x80, 0xEC, 0x05, 0x41, 0x01, 0x84, 0x0B, 0x78, 0xE0, 0xEC, 0x66, 0x25,
+  0x80, 0x18, 0x42, 0x80, 0x17, 0x09, 0x80, 0x49, 0x42, 0x80, 0x47, 0x09, 0x80, 0x79, 0x42, 0x80,
+  0x77, 0x09, 0x80, 0xA9, 0x42, 0x80, 0xA7, 0x09, 0x80, 0xD9, 0x42, 0x80, 0xD7, 0x08, 0x86, 0x0B,
+  0xFD, 0xFF, 0xE7, 0xFF, 0xFD, 0x0A, 0x07, 0x80, 0x39, 0x41, 0x80, 0x95, 0x41, 0x80, 0x37, 0x07,
+  0x80, 0x69, 0x41, 0x80, 0x40, 0x41, 0x80, 0x67, 0x07, 0x86, 0x99, 0xFF, 0xE7, 0x07, 0xFC, 0xFF,
+  0x97, 0x07, 0x86, 0xCA, 0xFF, 0xBD, 0x00, 0xDA, 0xFF, 0xC7, 0x06, 0x88, 0x03, 0xF6, 0xFF, 0x93,
+  0x00, 0xAF, 0xFF, 0xF4, 0x02, 0x05, 0x80, 0x2A, 0x41, 0x82, 0x69, 0x00, 0x84, 0x41, 0x80, 0x27,
+  0x05, 0x80, 0x5A, 0x41, 0x82, 0x3F, 0x00, 0x59, 0x41, 0x80, 0x57, 0x05, 0x80, 0x8A, 0x41, 0x82,
+  0x15, 0x00, 0x2F, 0x41, 0x80, 0x87, 0x05, 0x82, 0xBA, 0xFF, 0xEB, 0x01, 0x83, 0x07, 0xFC, 0xFF,
+  0xB7, 0x05, 0x82, 0xE9, 0xFF, 0xC2, 0x02, 0x82, 0xD9, 0xFF, 0xE7, 0x04, 0x80, 0x1A, 0x41, 0x80,
+  0x98, 0x02, 0x80, 0xAE, 0x41, 0x80, 0x17, 0x03, 0x80, 0x4A, 0x41, 0x80, 0x6E, 0x02, 0x80, 0x83,
+  0x41, 0x80, 0x47, 0x03, 0x80, 0x7B, 0x41, 0x80, 0x44, 0x02, 0x80, 0x59, 0x41, 0x80, 0x77, 0x03,
+  0x80, 0xAB, 0x41, 0x80, 0x1A, 0x02, 0x80, 0x2E, 0x41, 0x80, 0xA7, 0x03, 0x82, 0xDB, 0xFF, 0xF0,
+  0x03, 0x83, 0x07, 0xFC, 0xFF, 0xD7, 0x02, 0x83, 0x0C, 0xFE, 0xFF, 0xC6, 0x04, 0x83, 0xD8, 0xFF,
+  0xFD, 0x0A, 0x01, 0x80, 0x3B, 0x41, 0x80, 0x9C, 0x04, 0x80, 0xAD, 0x41, 0x80, 0x37, 0x01, 0x80,
+  0x6B, 0x4A, 0x80, 0x67, 0x01, 0x80, 0x9B, 0x4A, 0x80, 0x97, 0x01, 0x80, 0xCB, 0x4A, 0x83, 0xC7,
+  0x00, 0x03, 0xF7, 0x41, 0x80, 0x0F, 0x04, 0x80, 0x17, 0x41, 0x82, 0xF4, 0x02, 0x2C, 0x41, 0x80,
+  0xDD, 0x06, 0x80, 0xE4, 0x41, 0x81, 0x27, 0x5C, 0x41, 0x80, 0xAC, 0x06, 0x80, 0xB2, 0x41, 0x81,
+  0x57, 0x8C, 0x41, 0x80, 0x7A, 0x06, 0x80, 0x7F, 0x41, 0x81, 0x87, 0xBC, 0x41, 0x80, 0x49, 0x06,
+  0x80, 0x4C, 0x41, 0x81, 0xB7, 0xEB, 0x41, 0x80, 0x18, 0x06, 0x80, 0x19, 0x41, 0x80, 0xE7, 0x03,
+  0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x25,
+  0x80, 0x18, 0x42, 0x80, 0x17, 0x09, 0x80, 0x49, 0x42, 0x80, 0x47, 0x09, 0x80, 0x79, 0x42, 0x80,
+  0x77, 0x09, 0x80, 0xA9, 0x42, 0x80, 0xA7, 0x09, 0x80, 0xD9, 0x42, 0x80, 0xD7, 0x08, 0x86, 0x0B,
+  0xFD, 0xFF, 0xE7, 0xFF, 0xFD, 0x0A, 0x07, 0x80, 0x39, 0x41, 0x80, 0x95, 0x41, 0x80, 0x37, 0x07,
+  0x80, 0x69, 0x41, 0x80, 0x40, 0x41, 0x80, 0x67, 0x07, 0x86, 0x99, 0xFF, 0xE7, 0x07, 0xFC, 0xFF,
+  0x97, 0x07, 0x86, 0xCA, 0xFF, 0xBD, 0x00, 0xDA, 0xFF, 0xC7, 0x06, 0x88, 0x03, 0xF6, 0xFF, 0x93,
+  0x00, 0xAF, 0xFF, 0xF4, 0x02, 0x05, 0x80, 0x2A, 0x41, 0x82, 0x69, 0x00, 0x84, 0x41, 0x80, 0x27,
+  0x05, 0x80, 0x5A, 0x41, 0x82, 0x3F, 0x00, 0x59, 0x41, 0x80, 0x57, 0x05, 0x80, 0x8A, 0x41, 0x82,
+  0x15, 0x00, 0x2F, 0x41, 0x80, 0x87, 0x05, 0x82, 0xBA, 0xFF, 0xEB, 0x01, 0x83, 0x07, 0xFC, 0xFF,
+  0xB7, 0x05, 0x82, 0xE9, 0xFF, 0xC2, 0x02, 0x82, 0xD9, 0xFF, 0xE7, 0x04, 0x80, 0x1A, 0x41, 0x80,
+  0x98, 0x02, 0x80, 0xAE, 0x41, 0x80, 0x17, 0x03, 0x80, 0x4A, 0x41, 0x80, 0x6E, 0x02, 0x80, 0x83,
+  0x41, 0x80, 0x47, 0x03, 0x80, 0x7B, 0x41, 0x80, 0x44, 0x02, 0x80, 0x59, 0x41, 0x80, 0x77, 0x03,
+  0x80, 0xAB, 0x41, 0x80, 0x1A, 0x02, 0x80, 0x2E, 0x41, 0x80, 0xA7, 0x03, 0x82, 0xDB, 0xFF, 0xF0,
+  0x03, 0x83, 0x07, 0xFC, 0xFF, 0xD7, 0x02, 0x83, 0x0C, 0xFE, 0xFF, 0xC6, 0x04, 0x83, 0xD8, 0xFF,
+  0xFD, 0x0A, 0x01, 0x80, 0x3B, 0x41, 0x80, 0x9C, 0x04, 0x80, 0xAD, 0x41, 0x80, 0x37, 0x01, 0x80,
+  0x6B, 0x4A, 0x80, 0x67, 0x01, 0x80, 0x9B, 0x4A, 0x80, 0x97, 0x01, 0x80, 0xCB, 0x4A, 0x83, 0xC7,
+  0x00, 0x03, 0xF7, 0x41, 0x80, 0x0F, 0x04, 0x80, 0x17, 0x41, 0x82, 0xF4, 0x02, 0x2C, 0x41, 0x80,
+  0xDD, 0x06, 0x80, 0xE4, 0x41, 0x81, 0x27, 0x5C, 0x41, 0x80, 0xAC, 0x06, 0x80, 0xB2, 0x41, 0x81,
+  0x57, 0x8C, 0x41, 0x80, 0x7A, 0x06, 0x80, 0x7F, 0x41, 0x81, 0x87, 0xBC, 0x41, 0x80, 0x49, 0x06,
+  0x80, 0x4C, 0x41, 0x81, 0xB7, 0xEB, 0x41, 0x80, 0x18, 0x06, 0x80, 0x19, 0x41, 0x80, 0xE7, 0x03,
+  0x82, 0x43, 0xD9, 0xFD, 0x41, 0x82, 0xFD, 0xD9, 0x43, 0x06, 0x80, 0xD9, 0x45, 0x80, 0xD9, 0x06,
+  0x81, 0xFD, 0xFF, 0x03, 0x40, 0x80, 0xFD, 0x06, 0x41, 0x03, 0x41, 0x06, 0x41, 0x03, 0x41, 0x06,
+  0x81, 0xFD, 0xFF, 0x03, 0x40, 0x80, 0xFD, 0x06, 0x80, 0xD9, 0x45, 0x80, 0xD9, 0x06, 0x81, 0x43,
+  0xF2, 0x43, 0x81, 0xD9, 0x43, 0x07, 0x80, 0x49, 0x42, 0x80, 0x47, 0x09, 0x80, 0x79, 0x42, 0x80,
+  0x77, 0x09, 0x80, 0xA9, 0x42, 0x80, 0xA7, 0x09, 0x80, 0xD9, 0x42, 0x80, 0xD7, 0x08, 0x86, 0x0B,
+  0xFD, 0xFF, 0xE7, 0xFF, 0xFD, 0x0A, 0x07, 0x80, 0x39, 0x41, 0x80, 0x95, 0x41, 0x80, 0x37, 0x07,
+  0x80, 0x69, 0x41, 0x80, 0x40, 0x41, 0x80, 0x67, 0x07, 0x86, 0x99, 0xFF, 0xE7, 0x07, 0xFC, 0xFF,
+  0x97, 0x07, 0x86, 0xCA, 0xFF, 0xBD, 0x00, 0xDA, 0xFF, 0xC7, 0x06, 0x88, 0x03, 0xF6, 0xFF, 0x93,
+  0x00, 0xAF, 0xFF, 0xF4, 0x02, 0x05, 0x80, 0x2A, 0x41, 0x82, 0x69, 0x00, 0x84, 0x41, 0x80, 0x27,
+  0x05, 0x80, 0x5A, 0x41, 0x82, 0x3F, 0x00, 0x59, 0x41, 0x80, 0x57, 0x05, 0x80, 0x8A, 0x41, 0x82,
+  0x15, 0x00, 0x2F, 0x41, 0x80, 0x87, 0x05, 0x82, 0xBA, 0xFF, 0xEB, 0x01, 0x83, 0x07, 0xFC, 0xFF,
+  0xB7, 0x05, 0x82, 0xE9, 0xFF, 0xC2, 0x02, 0x82, 0xD9, 0xFF, 0xE7, 0x04, 0x80, 0x1A, 0x41, 0x80,
+  0x98, 0x02, 0x80, 0xAE, 0x41, 0x80, 0x17, 0x03, 0x80, 0x4A, 0x41, 0x80, 0x6E, 0x02, 0x80, 0x83,
+  0x41, 0x80, 0x47, 0x03, 0x80, 0x7B, 0x41, 0x80, 0x44, 0x02, 0x80, 0x59, 0x41, 0x80, 0x77, 0x03,
+  0x80, 0xAB, 0x41, 0x80, 0x1A, 0x02, 0x80, 0x2E, 0x41, 0x80, 0xA7, 0x03, 0x82, 0xDB, 0xFF, 0xF0,
+  0x03, 0x83, 0x07, 0xFC, 0xFF, 0xD7, 0x02, 0x83, 0x0C, 0xFE, 0xFF, 0xC6, 0x04, 0x83, 0xD8, 0xFF,
+  0xFD, 0x0A, 0x01, 0x80, 0x3B, 0x41, 0x80, 0x9C, 0x04, 0x80, 0xAD, 0x41, 0x80, 0x37, 0x01, 0x80,
+  0x6B, 0x4A, 0x80, 0x67, 0x01, 0x80, 0x9B, 0x4A, 0x80, 0x97, 0x01, 0x80, 0xCB, 0x4A, 0x83, 0xC7,
+  0x00, 0x03, 0xF7, 0x41, 0x80, 0x0F, 0x04, 0x80, 0x17, 0x41, 0x82, 0xF4, 0x02, 0x2C, 0x41, 0x80,
+  0xDD, 0x06, 0x80, 0xE4, 0x41, 0x81, 0x27, 0x5C, 0x41, 0x80, 0xAC, 0x06, 0x80, 0xB2, 0x41, 0x81,
+  0x57, 0x8C, 0x41, 0x80, 0x7A, 0x06, 0x80, 0x7F, 0x41, 0x81, 0x87, 0xBC, 0x41, 0x80, 0x49, 0x06,
+  0x80, 0x4C, 0x41, 0x81, 0xB7, 0xEB, 0x41, 0x80, 0x18, 0x06, 0x80, 0x19, 0x41, 0x80, 0xE7, 0x07,
+  0x80, 0xDE, 0x4B, 0x06, 0x80, 0x1F, 0x4C, 0x06, 0x82, 0x62, 0xFF, 0xFC, 0x4A, 0x06, 0x82, 0xA4,
+  0xFF, 0xCB, 0x42, 0x0E, 0x82, 0xE6, 0xFF, 0x8B, 0x42, 0x0D, 0x80, 0x29, 0x41, 0x80, 0x4C, 0x42,
+  0x0D, 0x83, 0x6B, 0xFF, 0xFD, 0x10, 0x42, 0x0D, 0x83, 0xAE, 0xFF, 0xCD, 0x00, 0x42, 0x0C, 0x84,
+  0x02, 0xED, 0xFF, 0x8E, 0x00, 0x42, 0x0C, 0x80, 0x32, 0x41, 0x81, 0x4F, 0x00, 0x42, 0x0C, 0x84,
+  0x74, 0xFF, 0xFE, 0x11, 0x00, 0x42, 0x0C, 0x82, 0xB7, 0xFF, 0xD0, 0x01, 0x42, 0x0B, 0x83, 0x05,
+  0xF3, 0xFF, 0x91, 0x01, 0x42, 0x0B, 0x80, 0x3B, 0x41, 0x80, 0x51, 0x01, 0x42, 0x0B, 0x83, 0x7E,
+  0xFF, 0xFE, 0x14, 0x01, 0x49, 0x04, 0x82, 0xC0, 0xFF, 0xD3, 0x02, 0x49, 0x03, 0x83, 0x09, 0xF8,
+  0xFF, 0x93, 0x02, 0x49, 0x03, 0x80, 0x44, 0x41, 0x80, 0x54, 0x02, 0x42, 0x0A, 0x80, 0x87, 0x41,
+  0x80, 0x16, 0x02, 0x42, 0x0A, 0x82, 0xC9, 0xFF, 0xD5, 0x03, 0x42, 0x09, 0x83, 0x0E, 0xFC, 0xFF,
+  0x96, 0x03, 0x42, 0x09, 0x80, 0x4E, 0x41, 0x80, 0x57, 0x03, 0x42, 0x09, 0x80, 0x90, 0x49, 0x09,
+  0x80, 0xD2, 0x49, 0x08, 0x81, 0x15, 0xFE, 0x49, 0x08, 0x80, 0x57, 0x41, 0x80, 0x8C, 0x04, 0x42,
+  0x08, 0x80, 0x99, 0x41, 0x80, 0x4F, 0x04, 0x42, 0x08, 0x83, 0xDB, 0xFF, 0xFE, 0x14, 0x04, 0x42,
+  0x07, 0x80, 0x1D, 0x41, 0x80, 0xD5, 0x05, 0x42, 0x07, 0x80, 0x60, 0x41, 0x80, 0x98, 0x05, 0x4A,
+  0x80, 0xA2, 0x41, 0x80, 0x5B, 0x05, 0x4A, 0x80, 0xE3, 0x41, 0x80, 0x1E, 0x05, 0x4A, 0x82, 0x2F,
+  0xCD, 0xFC, 0x46, 0x83, 0xFC, 0xCC, 0x2D, 0xCE, 0x4A, 0x81, 0xCC, 0xFD, 0x4A, 0x80, 0xFC, 0x42,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x09, 0x42,
+  0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x09, 0x42,
+  0x09, 0x42, 0x09, 0x42, 0x09, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD, 0x31, 0xCE, 0xFD,
+  0x46, 0x82, 0xFD, 0xCD, 0x2F, 0x05, 0x82, 0xBC, 0xFF, 0x74, 0x09, 0x83, 0xAF, 0xFF, 0xB2, 0x14,
+  0x08, 0x84, 0x48, 0xFA, 0xFF, 0xF2, 0x52, 0x08, 0x83, 0x24, 0x9E, 0xFF, 0xE4, 0x05, 0x41, 0x02,
+  0x41, 0x05, 0x41, 0x02, 0x41, 0x05, 0x80, 0xF8, 0x44, 0x80, 0xF8, 0x05, 0x81, 0x8E, 0xF8, 0x42,
+  0x81, 0xF8, 0x8D, 0x01, 0x01, 0x80, 0xA5, 0x41, 0x81, 0xFA, 0x19, 0x05, 0x81, 0x08, 0xC8, 0x41,
+  0x80, 0x84, 0x06, 0x84, 0x18, 0xE2, 0xFF, 0xEB, 0x09, 0x06, 0x83, 0x30, 0xF4, 0xFF, 0x65, 0x07,
+  0x82, 0x51, 0xFE, 0xD4, 0x18, 0x63, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x49, 0x00, 0x49, 0x00, 0x49,
+  0x00, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x60, 0x03, 0x81, 0x17, 0xF9, 0x41, 0x80,
+  0xA5, 0x05, 0x80, 0x82, 0x41, 0x81, 0xC8, 0x08, 0x04, 0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x05,
+  0x83, 0x64, 0xFF, 0xF5, 0x31, 0x06, 0x82, 0xD4, 0xFE, 0x53, 0x1A, 0x63, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x60,
+  0x03, 0x83, 0xA8, 0xFF, 0xB4, 0x01, 0x05, 0x80, 0x72, 0x42, 0x80, 0x7C, 0x04, 0x86, 0x3F, 0xFB,
+  0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x02, 0x88, 0x1B, 0xE8, 0xF9, 0x56, 0x00, 0x5D, 0xFC, 0xEB, 0x1D,
+  0x01, 0x82, 0xC7, 0xF4, 0x46, 0x02, 0x82, 0x52, 0xF9, 0xC7, 0x16, 0x63, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x60,
+  0x01, 0x42, 0x01, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42, 0x01, 0x42,
+  0x16, 0x63, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x60, 0x80, 0xA5, 0x41, 0x84, 0xFA, 0x19, 0x00, 0x08, 0xC8, 0x41,
+  0x80, 0x84, 0x01, 0x84, 0x18, 0xE2, 0xFF, 0xEB, 0x09, 0x01, 0x83, 0x30, 0xF4, 0xFF, 0x65, 0x02,
+  0x82, 0x51, 0xFE, 0xD4, 0x0D, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+  0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+  0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+  0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+  0x02, 0x42, 0x02, 0x42, 0x00, 0x00, 0x81, 0x17, 0xF9, 0x41, 0x82, 0xA5, 0x00, 0x82, 0x41, 0x8B,
+  0xC8, 0x08, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x00, 0x64, 0xFF, 0xF5, 0x31, 0x01, 0x82, 0xD4, 0xFE,
+  0x53, 0x0E, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02,
+  0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02,
+  0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02,
+  0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02,
+  0x42, 0x02, 0x02, 0x83, 0xA8, 0xFF, 0xB4, 0x01, 0x03, 0x80, 0x72, 0x42, 0x80, 0x7C, 0x02, 0x93,
+  0x3F, 0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x00, 0x1B, 0xE8, 0xF9, 0x56, 0x00, 0x5D, 0xFC, 0xEB,
+  0x1D, 0xC7, 0xF4, 0x46, 0x02, 0x82, 0x52, 0xF9, 0xC7, 0x14, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+  0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+  0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+  0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+  0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x02, 0x42, 0x01, 0x45, 0x01, 0x45, 0x01,
+  0x45, 0x01, 0x42, 0x11, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04,
+  0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04,
+  0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04,
+  0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04,
+  0x42, 0x04, 0x42, 0x02, 0x01, 0x84, 0x66, 0xEC, 0xE0, 0x78, 0x0C, 0x01, 0x41, 0x03, 0x80, 0xEC,
+  0x42, 0x82, 0xF2, 0x98, 0x32, 0x41, 0x03, 0x41, 0x82, 0x32, 0x97, 0xF1, 0x42, 0x80, 0xEC, 0x03,
+  0x41, 0x01, 0x84, 0x0B, 0x78, 0xE0, 0xEC, 0x66, 0x1B, 0x41, 0x80, 0x9D, 0x06, 0x44, 0x81, 0xEC,
+  0x04, 0x05, 0x45, 0x80, 0x44, 0x05, 0x45, 0x80, 0x98, 0x05, 0x45, 0x81, 0xE8, 0x02, 0x04, 0x46,
+  0x80, 0x3F, 0x04, 0x46, 0x80, 0x92, 0x04, 0x46, 0x81, 0xE4, 0x01, 0x03, 0x45, 0x82, 0xF4, 0xFF,
+  0x39, 0x03, 0x45, 0x82, 0xAA, 0xFF, 0x8D, 0x03, 0x45, 0x82, 0x56, 0xFF, 0xE0, 0x03, 0x45, 0x83,
+  0x0B, 0xF6, 0xFF, 0x34, 0x02, 0x45, 0x00, 0x82, 0xAE, 0xFF, 0x88, 0x02, 0x45, 0x00, 0x82, 0x5A,
+  0xFF, 0xDB, 0x02, 0x45, 0x00, 0x83, 0x0D, 0xF8, 0xFF, 0x2F, 0x01, 0x45, 0x01, 0x82, 0xB2, 0xFF,
+  0x82, 0x01, 0x45, 0x01, 0x82, 0x5E, 0xFF, 0xD6, 0x01, 0x45, 0x01, 0x84, 0x10, 0xF9, 0xFF, 0x29,
+  0x00, 0x45, 0x02, 0x83, 0xB6, 0xFF, 0x7D, 0x00, 0x45, 0x02, 0x83, 0x62, 0xFF, 0xD0, 0x00, 0x45,
+  0x02, 0x83, 0x12, 0xFB, 0xFF, 0x24, 0x45, 0x03, 0x82, 0xBA, 0xFF, 0x78, 0x45, 0x03, 0x82, 0x66,
+  0xFF, 0xCB, 0x45, 0x03, 0x81, 0x15, 0xFC, 0x46, 0x04, 0x80, 0xBE, 0x46, 0x04, 0x80, 0x6A, 0x46,
+  0x04, 0x81, 0x18, 0xFD, 0x45, 0x05, 0x80, 0xC2, 0x45, 0x05, 0x80, 0x6E, 0x45, 0x05, 0x81, 0x1B,
+  0xFE, 0x44, 0x06, 0x80, 0xC6, 0x44, 0x06, 0x80, 0x72, 0x41, 0x01, 0x80, 0xA5, 0x41, 0x81, 0xFA,
+  0x19, 0x07, 0x81, 0x08, 0xC8, 0x41, 0x80, 0x84, 0x08, 0x84, 0x18, 0xE2, 0xFF, 0xEB, 0x09, 0x08,
+  0x83, 0x30, 0xF4, 0xFF, 0x65, 0x09, 0x82, 0x51, 0xFE, 0xD4, 0x1E, 0x82, 0x2F, 0xCD, 0xFC, 0x46,
+  0x83, 0xFC, 0xCC, 0x2D, 0xCE, 0x4A, 0x81, 0xCC, 0xFD, 0x4A, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD,
+  0xCE, 0x2F, 0x07, 0x81, 0x17, 0xF9, 0x41, 0x80, 0xA5, 0x07, 0x80, 0x82, 0x41, 0x81, 0xC8, 0x08,
+  0x06, 0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x07, 0x83, 0x64, 0xFF, 0xF5, 0x31, 0x08, 0x82, 0xD4,
+  0xFE, 0x53, 0x1C, 0x82, 0x2F, 0xCD, 0xFC, 0x46, 0x83, 0xFC, 0xCC, 0x2D, 0xCE, 0x4A, 0x81, 0xCC,
+  0xFD, 0x4A, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A,
+  0x83, 0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x04, 0x83, 0xA8, 0xFF, 0xB4, 0x01,
+  0x07, 0x80, 0x72, 0x42, 0x80, 0x7C, 0x06, 0x86, 0x3F, 0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x04,
+  0x88, 0x1B, 0xE8, 0xF9, 0x56, 0x00, 0x5D, 0xFC, 0xEB, 0x1D, 0x03, 0x82, 0xC7, 0xF4, 0x46, 0x02,
+  0x82, 0x52, 0xF9, 0xC7, 0x1B, 0x82, 0x2F, 0xCD, 0xFC, 0x46, 0x83, 0xFC, 0xCC, 0x2D, 0xCE, 0x4A,
+  0x81, 0xCC, 0xFD, 0x4A, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC,
+  0xCE, 0x4A, 0x83, 0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x01, 0x84, 0x66, 0xEC,
+  0xE0, 0x78, 0x0C, 0x01, 0x41, 0x03, 0x80, 0xEC, 0x42, 0x82, 0xF2, 0x98, 0x32, 0x41, 0x03, 0x41,
+  0x82, 0x32, 0x97, 0xF1, 0x42, 0x80, 0xEC, 0x03, 0x41, 0x01, 0x84, 0x0B, 0x78, 0xE0, 0xEC, 0x66,
+  0x1B, 0x82, 0x2F, 0xCD, 0xFC, 0x46, 0x83, 0xFC, 0xCC, 0x2D, 0xCE, 0x4A, 0x81, 0xCC, 0xFD, 0x4A,
+  0x80, 0xFC, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD,
+  0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x02, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42,
+  0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x1B, 0x82, 0x2F, 0xCD, 0xFC, 0x46, 0x83, 0xFC,
+  0xCC, 0x2D, 0xCE, 0x4A, 0x81, 0xCC, 0xFD, 0x4A, 0x80, 0xFC, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80,
+  0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F,
+  0x82, 0x1D, 0xC1, 0x29, 0x06, 0x86, 0x29, 0xC9, 0x24, 0xBB, 0xFF, 0xEC, 0x36, 0x04, 0x88, 0x34,
+  0xEC, 0xFF, 0xCA, 0x24, 0xE8, 0xFF, 0xF3, 0x43, 0x02, 0x90, 0x41, 0xF2, 0xFF, 0xEE, 0x2C, 0x00,
+  0x30, 0xF1, 0xFF, 0xF8, 0x53, 0x00, 0x4E, 0xF7, 0xFF, 0xF4, 0x38, 0x02, 0x88, 0x3F, 0xF7, 0xFF,
+  0xFC, 0x9B, 0xFB, 0xFF, 0xF9, 0x45, 0x04, 0x81, 0x4F, 0xFC, 0x42, 0x81, 0xFD, 0x54, 0x06, 0x80,
+  0x9B, 0x42, 0x80, 0x9F, 0x06, 0x81, 0x50, 0xFC, 0x42, 0x81, 0xFC, 0x53, 0x04, 0x88, 0x41, 0xF8,
+  0xFF, 0xFB, 0x97, 0xFB, 0xFF, 0xF9, 0x43, 0x02, 0x90, 0x33, 0xF2, 0xFF, 0xF7, 0x4E, 0x00, 0x4E,
+  0xF7, 0xFF, 0xF3, 0x36, 0x00, 0x27, 0xEB, 0xFF, 0xF1, 0x3F, 0x02, 0x88, 0x40, 0xF2, 0xFF, 0xEC,
+  0x29, 0xC2, 0xFF, 0xEA, 0x32, 0x04, 0x86, 0x33, 0xEA, 0xFF, 0xC2, 0x20, 0xC2, 0x27, 0x06, 0x82,
+  0x27, 0xC2, 0x1F, 0x01, 0x82, 0x2F, 0xCD, 0xFC, 0x46, 0x82, 0xFC, 0xCC, 0x2D, 0x01, 0x81, 0x02,
+  0x4C, 0x01, 0x80, 0xCE, 0x4A, 0x80, 0xCC, 0x01, 0x81, 0x6C, 0x80, 0x01, 0x80, 0xFD, 0x4A, 0x84,
+  0xFC, 0x00, 0x18, 0xF0, 0x79, 0x01, 0x42, 0x06, 0x42, 0x00, 0x82, 0xA7, 0xEE, 0x16, 0x01, 0x42,
+  0x06, 0x42, 0x82, 0x44, 0xFF, 0x67, 0x02, 0x42, 0x06, 0x42, 0x82, 0xDA, 0xC8, 0x01, 0x02, 0x42,
+  0x06, 0x42, 0x81, 0xFC, 0x30, 0x03, 0x42, 0x06, 0x42, 0x80, 0x8F, 0x04, 0x42, 0x06, 0x42, 0x80,
+  0x0D, 0x04, 0x42, 0x06, 0x42, 0x05, 0x42, 0x05, 0x80, 0x0E, 0x42, 0x05, 0x42, 0x05, 0x80, 0x92,
+  0x42, 0x05, 0x42, 0x04, 0x81, 0x32, 0xFC, 0x42, 0x05, 0x42, 0x03, 0x82, 0x02, 0xCA, 0xD8, 0x42,
+  0x05, 0x42, 0x03, 0x82, 0x6A, 0xFF, 0x42, 0x42, 0x05, 0x42, 0x02, 0x83, 0x17, 0xEF, 0xA4, 0x00,
+  0x42, 0x05, 0x42, 0x02, 0x83, 0xA5, 0xEF, 0x17, 0x00, 0x42, 0x05, 0x42, 0x01, 0x82, 0x42, 0xFF,
+  0x69, 0x01, 0x42, 0x05, 0x42, 0x00, 0x83, 0x06, 0xD8, 0xCA, 0x02, 0x01, 0x42, 0x05, 0x42, 0x00,
+  0x82, 0x7D, 0xFC, 0x32, 0x02, 0x42, 0x05, 0x42, 0x82, 0x22, 0xF7, 0x91, 0x03, 0x42, 0x05, 0x42,
+  0x82, 0xB7, 0xE6, 0x0E, 0x03, 0x42, 0x05, 0x43, 0x80, 0x56, 0x04, 0x42, 0x05, 0x42, 0x80, 0xB9,
+  0x05, 0x42, 0x05, 0x42, 0x80, 0x24, 0x05, 0x42, 0x05, 0x42, 0x06, 0x42, 0x04, 0x80, 0x01, 0x42,
+  0x06, 0x42, 0x04, 0x80, 0x68, 0x42, 0x06, 0x42, 0x03, 0x81, 0x16, 0xEE, 0x42, 0x06, 0x42, 0x03,
+  0x81, 0x79, 0xF0, 0x4B, 0x80, 0xFC, 0x03, 0x82, 0x80, 0x6B, 0xCE, 0x4A, 0x80, 0xCD, 0x03, 0x84,
+  0x4C, 0x02, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x03, 0x02, 0x80, 0xA5, 0x41, 0x81,
+  0xFA, 0x19, 0x07, 0x81, 0x08, 0xC8, 0x41, 0x80, 0x84, 0x08, 0x84, 0x18, 0xE2, 0xFF, 0xEB, 0x09,
+  0x08, 0x83, 0x30, 0xF4, 0xFF, 0x65, 0x09, 0x82, 0x51, 0xFE, 0xD4, 0x1D, 0x42, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD,
+  0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x07, 0x81, 0x17, 0xF9, 0x41, 0x80, 0xA5, 0x07,
+  0x80, 0x82, 0x41, 0x81, 0xC8, 0x08, 0x06, 0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x07, 0x83, 0x64,
+  0xFF, 0xF5, 0x31, 0x08, 0x82, 0xD4, 0xFE, 0x53, 0x1C, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83, 0xCD, 0x31, 0xCE, 0xFD,
+  0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x04, 0x83, 0xA8, 0xFF, 0xB4, 0x01, 0x07, 0x80, 0x72, 0x42, 0x80,
+  0x7C, 0x06, 0x86, 0x3F, 0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x04, 0x88, 0x1B, 0xE8, 0xF9, 0x56,
+  0x00, 0x5D, 0xFC, 0xEB, 0x1D, 0x03, 0x82, 0xC7, 0xF4, 0x46, 0x02, 0x82, 0x52, 0xF9, 0xC7, 0x1B,
+  0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06,
+  0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC,
+  0xCE, 0x4A, 0x83, 0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x02, 0x42, 0x01, 0x42,
+  0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x1B, 0x42, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCE, 0x4A, 0x83,
+  0xCD, 0x31, 0xCE, 0xFD, 0x46, 0x82, 0xFD, 0xCE, 0x2F, 0x08, 0x81, 0x17, 0xF9, 0x41, 0x80, 0xA5,
+  0x09, 0x80, 0x82, 0x41, 0x81, 0xC8, 0x08, 0x08, 0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x09, 0x83,
+  0x64, 0xFF, 0xF5, 0x31, 0x0A, 0x82, 0xD4, 0xFE, 0x53, 0x21, 0x80, 0xE6, 0x41, 0x80, 0x24, 0x06,
+  0x80, 0x23, 0x41, 0x81, 0xE5, 0x98, 0x41, 0x80, 0x6C, 0x06, 0x80, 0x6C, 0x41, 0x81, 0x97, 0x49,
+  0x41, 0x80, 0xB4, 0x06, 0x80, 0xB3, 0x41, 0x85, 0x48, 0x07, 0xF3, 0xFF, 0xF5, 0x07, 0x04, 0x86,
+  0x06, 0xF4, 0xFF, 0xF2, 0x07, 0x00, 0xAB, 0x41, 0x80, 0x45, 0x04, 0x80, 0x42, 0x41, 0x80, 0xAA,
+  0x01, 0x80, 0x5C, 0x41, 0x80, 0x8E, 0x04, 0x80, 0x8A, 0x41, 0x80, 0x5B, 0x01, 0x83, 0x11, 0xFB,
+  0xFF, 0xD6, 0x04, 0x83, 0xD1, 0xFF, 0xFB, 0x10, 0x02, 0x80, 0xBD, 0x41, 0x80, 0x1F, 0x02, 0x80,
+  0x19, 0x41, 0x80, 0xBC, 0x03, 0x80, 0x6E, 0x41, 0x80, 0x67, 0x02, 0x80, 0x60, 0x41, 0x80, 0x6D,
+  0x03, 0x80, 0x1F, 0x41, 0x80, 0xB0, 0x02, 0x80, 0xA8, 0x41, 0x80, 0x1F, 0x04, 0x88, 0xD0, 0xFF,
+  0xF2, 0x05, 0x00, 0x02, 0xEC, 0xFF, 0xCF, 0x05, 0x80, 0x81, 0x41, 0x82, 0x41, 0x00, 0x37, 0x41,
+  0x80, 0x80, 0x05, 0x80, 0x32, 0x41, 0x82, 0x89, 0x00, 0x7E, 0x41, 0x80, 0x31, 0x06, 0x86, 0xDF,
+  0xFF, 0xD2, 0x00, 0xC6, 0xFF, 0xDC, 0x07, 0x80, 0x8A, 0x41, 0x83, 0x2C, 0xFC, 0xFF, 0x82, 0x07,
+  0x80, 0x32, 0x41, 0x80, 0xB8, 0x41, 0x80, 0x30, 0x08, 0x80, 0xDB, 0x42, 0x80, 0xE1, 0x09, 0x80,
+  0x8A, 0x42, 0x80, 0x96, 0x09, 0x80, 0x43, 0x42, 0x80, 0x4E, 0x09, 0x80, 0x0B, 0x42, 0x80, 0x0D,
+  0x0A, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42,
+  0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x46, 0x84, 0xFE, 0xE7, 0x99, 0x16, 0x00,
+  0x49, 0x81, 0xDE, 0x16, 0x42, 0x03, 0x81, 0x1E, 0xB5, 0x41, 0x80, 0x99, 0x42, 0x04, 0x80, 0x26,
+  0x41, 0x80, 0xE7, 0x42, 0x04, 0x80, 0x03, 0x41, 0x80, 0xFE, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x41, 0x80, 0xE9, 0x42, 0x04, 0x80, 0x86, 0x41,
+  0x80, 0xAF, 0x42, 0x03, 0x80, 0x75, 0x41, 0x81, 0xEB, 0x26, 0x42, 0x02, 0x80, 0x64, 0x41, 0x82,
+  0xD1, 0x20, 0x00, 0x42, 0x02, 0x83, 0xF9, 0xFF, 0xF0, 0x19, 0x01, 0x42, 0x02, 0x85, 0x5D, 0xFE,
+  0xFF, 0xD9, 0x2E, 0x00, 0x42, 0x03, 0x80, 0x66, 0x41, 0x81, 0xF6, 0x3A, 0x42, 0x04, 0x80, 0x70,
+  0x41, 0x80, 0xC2, 0x42, 0x05, 0x41, 0x80, 0xF2, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x41, 0x80, 0xFD, 0x42,
+  0x02, 0x44, 0x80, 0xD9, 0x42, 0x02, 0x42, 0x82, 0xFD, 0xD9, 0x43, 0x00, 0x80, 0xA5, 0x41, 0x81,
+  0xFA, 0x19, 0x06, 0x81, 0x08, 0xC8, 0x41, 0x80, 0x84, 0x07, 0x84, 0x18, 0xE2, 0xFF, 0xEB, 0x09,
+  0x07, 0x83, 0x30, 0xF4, 0xFF, 0x65, 0x08, 0x82, 0x51, 0xFE, 0xD4, 0x1C, 0x82, 0x1F, 0xB4, 0xFA,
+  0x45, 0x83, 0xFA, 0xB7, 0x1A, 0xC9, 0x49, 0x80, 0xAD, 0x42, 0x05, 0x41, 0x80, 0xF4, 0x42, 0x05,
+  0x45, 0x05, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x82, 0x0E, 0xAB, 0xFE, 0x48, 0x80, 0xA0,
+  0x4A, 0x80, 0xF9, 0x41, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x42, 0x80, 0xFD, 0x41, 0x85, 0x15, 0x3F, 0x6A, 0x94, 0xBF, 0xEA, 0x42, 0x80, 0xDF, 0x4A,
+  0x88, 0x55, 0xE9, 0xFA, 0xEC, 0xD0, 0xAB, 0x7D, 0x4A, 0x23, 0x42, 0x05, 0x81, 0x17, 0xF9, 0x41,
+  0x80, 0xA5, 0x06, 0x80, 0x82, 0x41, 0x81, 0xC8, 0x08, 0x05, 0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18,
+  0x06, 0x83, 0x64, 0xFF, 0xF5, 0x31, 0x07, 0x82, 0xD4, 0xFE, 0x53, 0x1B, 0x82, 0x1F, 0xB4, 0xFA,
+  0x45, 0x83, 0xFA, 0xB7, 0x1A, 0xC9, 0x49, 0x80, 0xAD, 0x42, 0x05, 0x41, 0x80, 0xF4, 0x42, 0x05,
+  0x45, 0x05, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x82, 0x0E, 0xAB, 0xFE, 0x48, 0x80, 0xA0,
+  0x4A, 0x80, 0xF9, 0x41, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x42, 0x80, 0xFD, 0x41, 0x85, 0x15, 0x3F, 0x6A, 0x94, 0xBF, 0xEA, 0x42, 0x80, 0xDF, 0x4A,
+  0x88, 0x55, 0xE9, 0xFA, 0xEC, 0xD0, 0xAB, 0x7D, 0x4A, 0x23, 0x42, 0x04, 0x83, 0xA8, 0xFF, 0xB4,
+  0x01, 0x06, 0x80, 0x72, 0x42, 0x80, 0x7C, 0x05, 0x86, 0x3F, 0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44,
+  0x03, 0x88, 0x1B, 0xE8, 0xF9, 0x56, 0x00, 0x5D, 0xFC, 0xEB, 0x1D, 0x02, 0x82, 0xC7, 0xF4, 0x46,
+  0x02, 0x82, 0x52, 0xF9, 0xC7, 0x18, 0x82, 0x1F, 0xB4, 0xFA, 0x45, 0x83, 0xFA, 0xB7, 0x1A, 0xC9,
+  0x49, 0x80, 0xAD, 0x42, 0x05, 0x41, 0x80, 0xF4, 0x42, 0x05, 0x45, 0x05, 0x42, 0x08, 0x42, 0x08,
+  0x42, 0x08, 0x42, 0x82, 0x0E, 0xAB, 0xFE, 0x48, 0x80, 0xA0, 0x4A, 0x80, 0xF9, 0x41, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFD, 0x41, 0x85,
+  0x15, 0x3F, 0x6A, 0x94, 0xBF, 0xEA, 0x42, 0x80, 0xDF, 0x4A, 0x88, 0x55, 0xE9, 0xFA, 0xEC, 0xD0,
+  0xAB, 0x7D, 0x4A, 0x23, 0x42, 0x01, 0x84, 0x66, 0xEC, 0xE0, 0x78, 0x0C, 0x01, 0x41, 0x02, 0x80,
+  0xEC, 0x42, 0x82, 0xF2, 0x98, 0x32, 0x41, 0x02, 0x41, 0x82, 0x32, 0x97, 0xF1, 0x42, 0x80, 0xEC,
+  0x02, 0x41, 0x01, 0x84, 0x0B, 0x78, 0xE0, 0xEC, 0x66, 0x18, 0x82, 0x1F, 0xB4, 0xFA, 0x45, 0x83,
+  0xFA, 0xB7, 0x1A, 0xC9, 0x49, 0x80, 0xAD, 0x42, 0x05, 0x41, 0x80, 0xF4, 0x42, 0x05, 0x45, 0x05,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x82, 0x0E, 0xAB, 0xFE, 0x48, 0x80, 0xA0, 0x4A, 0x80,
+  0xF9, 0x41, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42,
+  0x80, 0xFD, 0x41, 0x85, 0x15, 0x3F, 0x6A, 0x94, 0xBF, 0xEA, 0x42, 0x80, 0xDF, 0x4A, 0x88, 0x55,
+  0xE9, 0xFA, 0xEC, 0xD0, 0xAB, 0x7D, 0x4A, 0x23, 0x42, 0x01, 0x42, 0x01, 0x42, 0x03, 0x42, 0x01,
+  0x42, 0x03, 0x42, 0x01, 0x42, 0x03, 0x42, 0x01, 0x42, 0x19, 0x82, 0x1F, 0xB4, 0xFA, 0x45, 0x83,
+  0xFA, 0xB7, 0x1A, 0xC9, 0x49, 0x80, 0xAD, 0x42, 0x05, 0x41, 0x80, 0xF4, 0x42, 0x05, 0x45, 0x05,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x82, 0x0E, 0xAB, 0xFE, 0x48, 0x80, 0xA0, 0x4A, 0x80,
+  0xF9, 0x41, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42,
+  0x80, 0xFD, 0x41, 0x85, 0x15, 0x3F, 0x6A, 0x94, 0xBF, 0xEA, 0x42, 0x80, 0xDF, 0x4A, 0x88, 0x55,
+  0xE9, 0xFA, 0xEC, 0xD0, 0xAB, 0x7D, 0x4A, 0x23, 0x42, 0x01, 0x82, 0x43, 0xD9, 0xFD, 0x41, 0x82,
+  0xFD, 0xD9, 0x43, 0x03, 0x80, 0xD9, 0x45, 0x80, 0xD9, 0x03, 0x81, 0xFD, 0xFF, 0x03, 0x40, 0x80,
+  0xFD, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x81, 0xFD, 0xFF, 0x03, 0x40, 0x80,
+  0xFD, 0x03, 0x80, 0xD9, 0x45, 0x80, 0xD9, 0x03, 0x82, 0x43, 0xD9, 0xFD, 0x41, 0x82, 0xFD, 0xD9,
+  0x43, 0x19, 0x82, 0x1F, 0xB4, 0xFA, 0x45, 0x83, 0xFA, 0xB7, 0x1A, 0xC9, 0x49, 0x80, 0xAD, 0x42,
+  0x05, 0x41, 0x80, 0xF4, 0x42, 0x05, 0x45, 0x05, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x82,
+  0x0E, 0xAB, 0xFE, 0x48, 0x80, 0xA0, 0x4A, 0x80, 0xF9, 0x41, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFD, 0x41, 0x85, 0x15, 0x3F, 0x6A, 0x94,
+  0xBF, 0xEA, 0x42, 0x80, 0xDF, 0x4A, 0x88, 0x55, 0xE9, 0xFA, 0xEC, 0xD0, 0xAB, 0x7D, 0x4A, 0x23,
+  0x42, 0x82, 0x39, 0xCD, 0xF8, 0x4E, 0x83, 0xFD, 0xD9, 0x43, 0xD5, 0x52, 0x81, 0xD9, 0xFD, 0x41,
+  0x05, 0x42, 0x05, 0x41, 0x80, 0xFD, 0x42, 0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x42, 0x08,
+  0x42, 0x05, 0x42, 0x08, 0x42, 0x05, 0x42, 0x08, 0x42, 0x05, 0x42, 0x82, 0x41, 0xD7, 0xFC, 0x48,
+  0x85, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0x42, 0x80, 0xD9, 0x52, 0x81, 0x94, 0xFD, 0x41, 0x05,
+  0x42, 0x88, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x42, 0x05, 0x42, 0x08, 0x42,
+  0x05, 0x42, 0x08, 0x42, 0x05, 0x42, 0x08, 0x42, 0x05, 0x42, 0x05, 0x82, 0xF8, 0xF8, 0xF8, 0x42,
+  0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x42, 0x80, 0xFD, 0x41, 0x85, 0x03, 0x0B, 0x13, 0x1B,
+  0x23, 0x2B, 0x42, 0x85, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x41, 0x81, 0xFA, 0xD9, 0x52, 0x8C,
+  0xD0, 0x43, 0xD9, 0xFB, 0xED, 0xD9, 0xC3, 0xAD, 0x98, 0x81, 0x76, 0xD0, 0xFA, 0x45, 0x82, 0xFD,
+  0xD6, 0x3B, 0x82, 0x1A, 0xB2, 0xFA, 0x45, 0x83, 0xFB, 0xBC, 0x21, 0xB7, 0x49, 0x81, 0xBC, 0xFB,
+  0x41, 0x05, 0x41, 0x80, 0xFB, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x08, 0x42,
+  0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x42, 0x80, 0xFB, 0x41, 0x05, 0x41, 0x81, 0xFB, 0xBD, 0x49, 0x83, 0xBC, 0x22, 0xBD, 0xFB,
+  0x45, 0x82, 0xFB, 0xBD, 0x21, 0x04, 0x82, 0xBC, 0xFF, 0x74, 0x08, 0x83, 0xAF, 0xFF, 0xB2, 0x14,
+  0x07, 0x84, 0x48, 0xFA, 0xFF, 0xF2, 0x52, 0x07, 0x83, 0x24, 0x9E, 0xFF, 0xE4, 0x04, 0x41, 0x02,
+  0x41, 0x04, 0x41, 0x02, 0x41, 0x04, 0x80, 0xF8, 0x44, 0x80, 0xF8, 0x04, 0x81, 0x8E, 0xF8, 0x42,
+  0x81, 0xF8, 0x8D, 0x01, 0x00, 0x80, 0xA5, 0x41, 0x81, 0xFA, 0x19, 0x06, 0x81, 0x08, 0xC8, 0x41,
+  0x80, 0x84, 0x07, 0x84, 0x18, 0xE2, 0xFF, 0xEB, 0x09, 0x07, 0x83, 0x30, 0xF4, 0xFF, 0x65, 0x08,
+  0x82, 0x51, 0xFE, 0xD4, 0x1C, 0x82, 0x28, 0xCC, 0xFD, 0x45, 0x83, 0xFC, 0xCC, 0x28, 0xBC, 0x49,
+  0x81, 0xBB, 0xFB, 0x41, 0x05, 0x41, 0x80, 0xFA, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x59, 0x80, 0x8A, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x42, 0x80, 0xFB, 0x41, 0x05, 0x41, 0x81, 0xEA, 0xBC, 0x49, 0x83, 0x8F, 0x28,
+  0xCD, 0xFD, 0x45, 0x82, 0xFA, 0xAA, 0x0D, 0x05, 0x81, 0x17, 0xF9, 0x41, 0x80, 0xA5, 0x06, 0x80,
+  0x82, 0x41, 0x81, 0xC8, 0x08, 0x05, 0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x06, 0x83, 0x64, 0xFF,
+  0xF5, 0x31, 0x07, 0x82, 0xD4, 0xFE, 0x53, 0x1B, 0x82, 0x28, 0xCC, 0xFD, 0x45, 0x83, 0xFC, 0xCC,
+  0x28, 0xBC, 0x49, 0x81, 0xBB, 0xFB, 0x41, 0x05, 0x41, 0x80, 0xFA, 0x42, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x59, 0x80, 0x8A, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFB, 0x41, 0x05, 0x41, 0x81, 0xEA, 0xBC, 0x49,
+  0x83, 0x8F, 0x28, 0xCD, 0xFD, 0x45, 0x82, 0xFA, 0xAA, 0x0D, 0x04, 0x83, 0xA8, 0xFF, 0xB4, 0x01,
+  0x06, 0x80, 0x72, 0x42, 0x80, 0x7C, 0x05, 0x86, 0x3F, 0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x03,
+  0x88, 0x1B, 0xE8, 0xF9, 0x56, 0x00, 0x5D, 0xFC, 0xEB, 0x1D, 0x02, 0x82, 0xC7, 0xF4, 0x46, 0x02,
+  0x82, 0x52, 0xF9, 0xC7, 0x18, 0x82, 0x28, 0xCC, 0xFD, 0x45, 0x83, 0xFC, 0xCC, 0x28, 0xBC, 0x49,
+  0x81, 0xBB, 0xFB, 0x41, 0x05, 0x41, 0x80, 0xFA, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x59, 0x80, 0x8A, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x42, 0x80, 0xFB, 0x41, 0x05, 0x41, 0x81, 0xEA, 0xBC, 0x49, 0x83, 0x8F, 0x28,
+  0xCD, 0xFD, 0x45, 0x82, 0xFA, 0xAA, 0x0D, 0x01, 0x42, 0x01, 0x42, 0x03, 0x42, 0x01, 0x42, 0x03,
+  0x42, 0x01, 0x42, 0x03, 0x42, 0x01, 0x42, 0x19, 0x82, 0x28, 0xCC, 0xFD, 0x45, 0x83, 0xFC, 0xCC,
+  0x28, 0xBC, 0x49, 0x81, 0xBB, 0xFB, 0x41, 0x05, 0x41, 0x80, 0xFA, 0x42, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x59, 0x80, 0x8A, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFB, 0x41, 0x05, 0x41, 0x81, 0xEA, 0xBC, 0x49,
+  0x83, 0x8F, 0x28, 0xCD, 0xFD, 0x45, 0x82, 0xFA, 0xAA, 0x0D, 0x80, 0xA5, 0x41, 0x84, 0xFA, 0x19,
+  0x00, 0x08, 0xC8, 0x41, 0x80, 0x84, 0x01, 0x84, 0x18, 0xE2, 0xFF, 0xEB, 0x09, 0x01, 0x83, 0x30,
+  0xF4, 0xFF, 0x65, 0x02, 0x82, 0x51, 0xFE, 0xD4, 0x0E, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+  0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+  0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+  0x01, 0x81, 0x17, 0xF9, 0x41, 0x80, 0xA5, 0x01, 0x80, 0x82, 0x41, 0x87, 0xC8, 0x08, 0x00, 0x08,
+  0xEA, 0xFF, 0xE3, 0x18, 0x01, 0x83, 0x64, 0xFF, 0xF5, 0x31, 0x02, 0x82, 0xD4, 0xFE, 0x53, 0x10,
+  0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03,
+  0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03,
+  0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x02, 0x83, 0xA8, 0xFF, 0xB4, 0x01, 0x03, 0x80,
+  0x72, 0x42, 0x80, 0x7C, 0x02, 0x93, 0x3F, 0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x00, 0x1B, 0xE8,
+  0xF9, 0x56, 0x00, 0x5D, 0xFC, 0xEB, 0x1D, 0xC7, 0xF4, 0x46, 0x02, 0x82, 0x52, 0xF9, 0xC7, 0x14,
+  0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+  0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+  0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x02, 0x42, 0x01, 0x45, 0x01, 0x45, 0x01, 0x45, 0x01,
+  0x42, 0x11, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04,
+  0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04,
+  0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x02, 0x01, 0x84, 0x66, 0xEC, 0xE0, 0x78,
+  0x0C, 0x01, 0x41, 0x02, 0x80, 0xEC, 0x42, 0x82, 0xF2, 0x98, 0x32, 0x41, 0x02, 0x41, 0x82, 0x32,
+  0x97, 0xF1, 0x42, 0x80, 0xEC, 0x02, 0x41, 0x01, 0x84, 0x0B, 0x78, 0xE0, 0xEC, 0x66, 0x18, 0x42,
+  0x00, 0x87, 0x04, 0x33, 0x6B, 0xA4, 0xDA, 0xF4, 0xE9, 0x55, 0x42, 0x81, 0xBE, 0xF5, 0x45, 0x80,
+  0xDF, 0x43, 0x84, 0xFC, 0xCE, 0x93, 0x58, 0x1D, 0x41, 0x80, 0xFD, 0x42, 0x81, 0x43, 0x0C, 0x03,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x42, 0x00, 0x80, 0xA5, 0x41, 0x81, 0xFA, 0x19, 0x06, 0x81, 0x08, 0xC8, 0x41, 0x80, 0x84, 0x07,
+  0x84, 0x18, 0xE2, 0xFF, 0xEB, 0x09, 0x07, 0x83, 0x30, 0xF4, 0xFF, 0x65, 0x08, 0x82, 0x51, 0xFE,
+  0xD4, 0x1C, 0x82, 0x20, 0xC7, 0xFC, 0x45, 0x83, 0xFC, 0xC7, 0x20, 0xB2, 0x49, 0x81, 0xB2, 0xFA,
+  0x41, 0x05, 0x41, 0x80, 0xF9, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x42, 0x80, 0xFA, 0x41, 0x05, 0x41, 0x81, 0xFA, 0xB2, 0x49, 0x83, 0xB2, 0x20, 0xC8, 0xFD,
+  0x45, 0x82, 0xFD, 0xC8, 0x20, 0x06, 0x81, 0x17, 0xF9, 0x41, 0x80, 0xA5, 0x06, 0x80, 0x82, 0x41,
+  0x81, 0xC8, 0x08, 0x05, 0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x06, 0x83, 0x64, 0xFF, 0xF5, 0x31,
+  0x07, 0x82, 0xD4, 0xFE, 0x53, 0x1A, 0x82, 0x20, 0xC7, 0xFC, 0x45, 0x83, 0xFC, 0xC7, 0x20, 0xB2,
+  0x49, 0x81, 0xB2, 0xFA, 0x41, 0x05, 0x41, 0x80, 0xF9, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFA, 0x41, 0x05, 0x41, 0x81, 0xFA, 0xB2, 0x49, 0x83,
+  0xB2, 0x20, 0xC8, 0xFD, 0x45, 0x82, 0xFD, 0xC8, 0x20, 0x04, 0x83, 0xA8, 0xFF, 0xB4, 0x01, 0x06,
+  0x80, 0x72, 0x42, 0x80, 0x7C, 0x05, 0x86, 0x3F, 0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x03, 0x88,
+  0x1B, 0xE8, 0xF9, 0x56, 0x00, 0x5D, 0xFC, 0xEB, 0x1D, 0x02, 0x82, 0xC7, 0xF4, 0x46, 0x02, 0x82,
+  0x52, 0xF9, 0xC7, 0x18, 0x82, 0x20, 0xC7, 0xFC, 0x45, 0x83, 0xFC, 0xC7, 0x20, 0xB2, 0x49, 0x81,
+  0xB2, 0xFA, 0x41, 0x05, 0x41, 0x80, 0xF9, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x42, 0x80, 0xFA, 0x41, 0x05, 0x41, 0x81, 0xFA, 0xB2, 0x49, 0x83, 0xB2, 0x20,
+  0xC8, 0xFD, 0x45, 0x82, 0xFD, 0xC8, 0x20, 0x01, 0x84, 0x66, 0xEC, 0xE0, 0x78, 0x0C, 0x01, 0x41,
+  0x02, 0x80, 0xEC, 0x42, 0x82, 0xF2, 0x98, 0x32, 0x41, 0x02, 0x41, 0x82, 0x32, 0x97, 0xF1, 0x42,
+  0x80, 0xEC, 0x02, 0x41, 0x01, 0x84, 0x0B, 0x78, 0xE0, 0xEC, 0x66, 0x18, 0x82, 0x20, 0xC7, 0xFC,
+  0x45, 0x83, 0xFC, 0xC7, 0x20, 0xB2, 0x49, 0x81, 0xB2, 0xFA, 0x41, 0x05, 0x41, 0x80, 0xF9, 0x42,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFA, 0x41, 0x05,
+  0x41, 0x81, 0xFA, 0xB2, 0x49, 0x83, 0xB2, 0x20, 0xC8, 0xFD, 0x45, 0x82, 0xFD, 0xC8, 0x20, 0x01,
+  0x42, 0x01, 0x42, 0x03, 0x42, 0x01, 0x42, 0x03, 0x42, 0x01, 0x42, 0x03, 0x42, 0x01, 0x42, 0x19,
+  0x82, 0x20, 0xC7, 0xFC, 0x45, 0x83, 0xFC, 0xC7, 0x20, 0xB2, 0x49, 0x81, 0xB2, 0xFA, 0x41, 0x05,
+  0x41, 0x80, 0xF9, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42,
+  0x80, 0xFA, 0x41, 0x05, 0x41, 0x81, 0xFA, 0xB2, 0x49, 0x83, 0xB2, 0x20, 0xC8, 0xFD, 0x45, 0x82,
+  0xFD, 0xC8, 0x20, 0x04, 0x83, 0x49, 0xE4, 0xE2, 0x47, 0x09, 0x80, 0xE4, 0x41, 0x80, 0xE3, 0x09,
+  0x80, 0xE3, 0x41, 0x80, 0xE2, 0x09, 0x83, 0x49, 0xE4, 0xE3, 0x47, 0x20, 0x69, 0x20, 0x83, 0x49,
+  0xE4, 0xE2, 0x46, 0x09, 0x80, 0xE3, 0x41, 0x80, 0xE2, 0x09, 0x80, 0xE5, 0x41, 0x80, 0xE4, 0x09,
+  0x83, 0x4C, 0xE5, 0xE4, 0x49, 0x04, 0x01, 0x82, 0x20, 0xC7, 0xFC, 0x45, 0x84, 0xFC, 0xC7, 0x20,
+  0x11, 0x5A, 0x01, 0x80, 0xB2, 0x49, 0x82, 0xB6, 0xBC, 0x80, 0x01, 0x80, 0xFA, 0x41, 0x05, 0x42,
+  0x81, 0xF0, 0x28, 0x01, 0x42, 0x05, 0x42, 0x80, 0x46, 0x02, 0x42, 0x05, 0x42, 0x03, 0x42, 0x04,
+  0x80, 0x2A, 0x42, 0x03, 0x42, 0x03, 0x81, 0x14, 0xDD, 0x42, 0x03, 0x42, 0x02, 0x82, 0x06, 0xC2,
+  0xDB, 0x42, 0x03, 0x42, 0x02, 0x82, 0x9E, 0xEF, 0x27, 0x42, 0x03, 0x42, 0x01, 0x83, 0x76, 0xFC,
+  0x45, 0x00, 0x42, 0x03, 0x42, 0x00, 0x82, 0x4D, 0xFD, 0x6C, 0x01, 0x42, 0x03, 0x42, 0x82, 0x2E,
+  0xF3, 0x97, 0x02, 0x42, 0x03, 0x42, 0x82, 0xE1, 0xBC, 0x04, 0x02, 0x42, 0x03, 0x42, 0x81, 0xDA,
+  0x11, 0x03, 0x42, 0x03, 0x42, 0x80, 0x27, 0x04, 0x42, 0x03, 0x42, 0x05, 0x42, 0x02, 0x80, 0x53,
+  0x42, 0x05, 0x42, 0x01, 0x81, 0x32, 0xF5, 0x42, 0x05, 0x41, 0x80, 0xFA, 0x01, 0x82, 0x80, 0xBB,
+  0xB6, 0x49, 0x80, 0xB2, 0x01, 0x84, 0x59, 0x11, 0x20, 0xC8, 0xFD, 0x45, 0x82, 0xFD, 0xC8, 0x20,
+  0x01, 0x80, 0xA5, 0x41, 0x81, 0xFA, 0x19, 0x06, 0x81, 0x08, 0xC8, 0x41, 0x80, 0x84, 0x07, 0x84,
+  0x18, 0xE2, 0xFF, 0xEB, 0x09, 0x07, 0x83, 0x30, 0xF4, 0xFF, 0x65, 0x08, 0x82, 0x51, 0xFE, 0xD4,
+  0x1D, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x03, 0x81, 0x0B, 0x42, 0x42, 0x80, 0xFB, 0x41, 0x84, 0x1D, 0x57, 0x92, 0xCC, 0xFC,
+  0x43, 0x80, 0xB7, 0x45, 0x81, 0xFA, 0xC2, 0x42, 0x88, 0x1B, 0xB2, 0xF6, 0xE7, 0xBF, 0x89, 0x49,
+  0x0B, 0x00, 0x42, 0x06, 0x81, 0x17, 0xF9, 0x41, 0x80, 0xA5, 0x06, 0x80, 0x82, 0x41, 0x81, 0xC8,
+  0x08, 0x05, 0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x06, 0x83, 0x64, 0xFF, 0xF5, 0x31, 0x07, 0x82,
+  0xD4, 0xFE, 0x53, 0x1A, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x03, 0x81, 0x0B, 0x42, 0x42, 0x80, 0xFB, 0x41, 0x84, 0x1D, 0x57,
+  0x92, 0xCC, 0xFC, 0x43, 0x80, 0xB7, 0x45, 0x81, 0xFA, 0xC2, 0x42, 0x88, 0x1B, 0xB2, 0xF6, 0xE7,
+  0xBF, 0x89, 0x49, 0x0B, 0x00, 0x42, 0x04, 0x83, 0xA8, 0xFF, 0xB4, 0x01, 0x06, 0x80, 0x72, 0x42,
+  0x80, 0x7C, 0x05, 0x86, 0x3F, 0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x03, 0x88, 0x1B, 0xE8, 0xF9,
+  0x56, 0x00, 0x5D, 0xFC, 0xEB, 0x1D, 0x02, 0x82, 0xC7, 0xF4, 0x46, 0x02, 0x82, 0x52, 0xF9, 0xC7,
+  0x18, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45,
+  0x05, 0x45, 0x03, 0x81, 0x0B, 0x42, 0x42, 0x80, 0xFB, 0x41, 0x84, 0x1D, 0x57, 0x92, 0xCC, 0xFC,
+  0x43, 0x80, 0xB7, 0x45, 0x81, 0xFA, 0xC2, 0x42, 0x88, 0x1B, 0xB2, 0xF6, 0xE7, 0xBF, 0x89, 0x49,
+  0x0B, 0x00, 0x42, 0x01, 0x42, 0x01, 0x42, 0x03, 0x42, 0x01, 0x42, 0x03, 0x42, 0x01, 0x42, 0x03,
+  0x42, 0x01, 0x42, 0x19, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05, 0x45, 0x05,
+  0x45, 0x05, 0x45, 0x05, 0x45, 0x03, 0x81, 0x0B, 0x42, 0x42, 0x80, 0xFB, 0x41, 0x84, 0x1D, 0x57,
+  0x92, 0xCC, 0xFC, 0x43, 0x80, 0xB7, 0x45, 0x81, 0xFA, 0xC2, 0x42, 0x88, 0x1B, 0xB2, 0xF6, 0xE7,
+  0xBF, 0x89, 0x49, 0x0B, 0x00, 0x42, 0x05, 0x81, 0x17, 0xF9, 0x41, 0x80, 0xA5, 0x07, 0x80, 0x82,
+  0x41, 0x81, 0xC8, 0x08, 0x06, 0x84, 0x08, 0xEA, 0xFF, 0xE3, 0x18, 0x07, 0x83, 0x64, 0xFF, 0xF5,
+  0x31, 0x08, 0x82, 0xD4, 0xFE, 0x53, 0x1E, 0x80, 0xE0, 0x41, 0x80, 0x1B, 0x04, 0x80, 0x1C, 0x41,
+  0x81, 0xDF, 0xA1, 0x41, 0x80, 0x52, 0x04, 0x80, 0x55, 0x41, 0x81, 0x9F, 0x61, 0x41, 0x80, 0x89,
+  0x04, 0x80, 0x8E, 0x41, 0x81, 0x5F, 0x20, 0x41, 0x80, 0xC0, 0x04, 0x80, 0xC7, 0x41, 0x85, 0x1F,
+  0x00, 0xE0, 0xFF, 0xF4, 0x03, 0x02, 0x83, 0x06, 0xF8, 0xFF, 0xDF, 0x01, 0x80, 0xA1, 0x41, 0x80,
+  0x2F, 0x02, 0x80, 0x38, 0x41, 0x80, 0x9F, 0x01, 0x80, 0x61, 0x41, 0x80, 0x66, 0x02, 0x80, 0x71,
+  0x41, 0x80, 0x5F, 0x01, 0x80, 0x20, 0x41, 0x80, 0x9D, 0x02, 0x80, 0xAA, 0x41, 0x80, 0x1F, 0x02,
+  0x82, 0xE0, 0xFF, 0xD5, 0x02, 0x82, 0xE3, 0xFF, 0xDF, 0x03, 0x85, 0xA1, 0xFF, 0xFD, 0x0E, 0x00,
+  0x1B, 0x41, 0x80, 0x9F, 0x03, 0x80, 0x61, 0x41, 0x82, 0x43, 0x00, 0x54, 0x41, 0x80, 0x5F, 0x03,
+  0x80, 0x20, 0x41, 0x82, 0x7A, 0x00, 0x8D, 0x41, 0x80, 0x1F, 0x04, 0x86, 0xE0, 0xFF, 0xB2, 0x00,
+  0xC6, 0xFF, 0xDF, 0x05, 0x86, 0xA1, 0xFF, 0xE9, 0x06, 0xF7, 0xFF, 0x9F, 0x05, 0x80, 0x61, 0x41,
+  0x80, 0x58, 0x41, 0x80, 0x5F, 0x05, 0x80, 0x20, 0x41, 0x80, 0xC8, 0x41, 0x80, 0x1F, 0x06, 0x80,
+  0xE0, 0x42, 0x80, 0xDF, 0x07, 0x80, 0xA1, 0x42, 0x80, 0x9F, 0x07, 0x80, 0x61, 0x42, 0x80, 0x5F,
+  0x07, 0x80, 0x20, 0x42, 0x80, 0x1F, 0x07, 0x80, 0x1C, 0x41, 0x80, 0xE3, 0x08, 0x80, 0x55, 0x41,
+  0x80, 0xAA, 0x08, 0x80, 0x8E, 0x41, 0x80, 0x71, 0x08, 0x80, 0xC7, 0x41, 0x80, 0x38, 0x07, 0x84,
+  0x07, 0xF8, 0xFF, 0xF8, 0x07, 0x07, 0x80, 0x39, 0x41, 0x80, 0xC6, 0x08, 0x80, 0x72, 0x41, 0x80,
+  0x8D, 0x08, 0x80, 0xAB, 0x41, 0x80, 0x54, 0x08, 0x80, 0xE4, 0x41, 0x80, 0x1C, 0x05, 0x02, 0x42,
+  0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x1B, 0x80,
+  0xE0, 0x41, 0x80, 0x1B, 0x04, 0x80, 0x1C, 0x41, 0x81, 0xDF, 0xA1, 0x41, 0x80, 0x52, 0x04, 0x80,
+  0x55, 0x41, 0x81, 0x9F, 0x61, 0x41, 0x80, 0x89, 0x04, 0x80, 0x8E, 0x41, 0x81, 0x5F, 0x20, 0x41,
+  0x80, 0xC0, 0x04, 0x80, 0xC7, 0x41, 0x85, 0x1F, 0x00, 0xE0, 0xFF, 0xF4, 0x03, 0x02, 0x83, 0x06,
+  0xF8, 0xFF, 0xDF, 0x01, 0x80, 0xA1, 0x41, 0x80, 0x2F, 0x02, 0x80, 0x38, 0x41, 0x80, 0x9F, 0x01,
+  0x80, 0x61, 0x41, 0x80, 0x66, 0x02, 0x80, 0x71, 0x41, 0x80, 0x5F, 0x01, 0x80, 0x20, 0x41, 0x80,
+  0x9D, 0x02, 0x80, 0xAA, 0x41, 0x80, 0x1F, 0x02, 0x82, 0xE0, 0xFF, 0xD5, 0x02, 0x82, 0xE3, 0xFF,
+  0xDF, 0x03, 0x85, 0xA1, 0xFF, 0xFD, 0x0E, 0x00, 0x1B, 0x41, 0x80, 0x9F, 0x03, 0x80, 0x61, 0x41,
+  0x82, 0x43, 0x00, 0x54, 0x41, 0x80, 0x5F, 0x03, 0x80, 0x20, 0x41, 0x82, 0x7A, 0x00, 0x8D, 0x41,
+  0x80, 0x1F, 0x04, 0x86, 0xE0, 0xFF, 0xB2, 0x00, 0xC6, 0xFF, 0xDF, 0x05, 0x86, 0xA1, 0xFF, 0xE9,
+  0x06, 0xF7, 0xFF, 0x9F, 0x05, 0x80, 0x61, 0x41, 0x80, 0x58, 0x41, 0x80, 0x5F, 0x05, 0x80, 0x20,
+  0x41, 0x80, 0xC8, 0x41, 0x80, 0x1F, 0x06, 0x80, 0xE0, 0x42, 0x80, 0xDF, 0x07, 0x80, 0xA1, 0x42,
+  0x80, 0x9F, 0x07, 0x80, 0x61, 0x42, 0x80, 0x5F, 0x07, 0x80, 0x20, 0x42, 0x80, 0x1F, 0x07, 0x80,
+  0x1C, 0x41, 0x80, 0xE3, 0x08, 0x80, 0x55, 0x41, 0x80, 0xAA, 0x08, 0x80, 0x8E, 0x41, 0x80, 0x71,
+  0x08, 0x80, 0xC7, 0x41, 0x80, 0x38, 0x07, 0x84, 0x07, 0xF8, 0xFF, 0xF8, 0x07, 0x07, 0x80, 0x39,
+  0x41, 0x80, 0xC6, 0x08, 0x80, 0x72, 0x41, 0x80, 0x8D, 0x08, 0x80, 0xAB, 0x41, 0x80, 0x54, 0x08,
+  0x80, 0xE4, 0x41, 0x80, 0x1C, 0x05, 0x7B, 0x00, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07,
+  0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07,
+  0x42, 0x07, 0x42, 0x07, 0x42, 0x02, 0x81, 0x07, 0x9B, 0x02, 0x42, 0x01, 0x82, 0x1F, 0xCC, 0xFF,
+  0x02, 0x42, 0x00, 0x81, 0x47, 0xED, 0x41, 0x02, 0x42, 0x84, 0x7D, 0xFD, 0xFF, 0xF4, 0x58, 0x02,
+  0x44, 0x81, 0xDA, 0x2B, 0x03, 0x43, 0x81, 0xB0, 0x0E, 0x03, 0x80, 0x5F, 0x42, 0x81, 0x7A, 0x01,
+  0x04, 0x43, 0x06, 0x43, 0x06, 0x80, 0x9C, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+  0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+  0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x82, 0x04, 0x95, 0x00, 0x42, 0x82,
+  0xBD, 0xFF, 0x00, 0x44, 0x00, 0x42, 0x82, 0xFC, 0x6F, 0x71, 0x42, 0x81, 0x46, 0x00, 0x43, 0x01,
+  0x43, 0x01, 0x80, 0x96, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02,
+  0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x82, 0x28, 0xC6, 0xFC, 0x50, 0x80, 0xC9, 0x52, 0x80, 0xFC,
+  0x55, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+  0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+  0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x4C, 0x06,
+  0x4C, 0x06, 0x4C, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+  0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+  0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+  0x42, 0x06, 0x80, 0xFC, 0x52, 0x80, 0xCA, 0x52, 0x82, 0x29, 0xC8, 0xFC, 0x50, 0x82, 0x43, 0xD9,
+  0xFD, 0x4D, 0x83, 0xFD, 0xD9, 0x43, 0xD9, 0x51, 0x81, 0xD9, 0xFD, 0x41, 0x05, 0x42, 0x04, 0x41,
+  0x80, 0xFD, 0x42, 0x05, 0x42, 0x04, 0x45, 0x05, 0x42, 0x04, 0x45, 0x05, 0x42, 0x04, 0x45, 0x05,
+  0x42, 0x04, 0x45, 0x05, 0x42, 0x04, 0x45, 0x05, 0x4D, 0x05, 0x49, 0x80, 0x95, 0x42, 0x05, 0x42,
+  0x07, 0x42, 0x05, 0x42, 0x07, 0x42, 0x05, 0x42, 0x07, 0x42, 0x05, 0x42, 0x07, 0x42, 0x05, 0x42,
+  0x04, 0x45, 0x05, 0x42, 0x04, 0x45, 0x05, 0x42, 0x04, 0x42, 0x80, 0xFD, 0x41, 0x05, 0x42, 0x04,
+  0x41, 0x81, 0xFD, 0xD9, 0x51, 0x83, 0xD9, 0x43, 0xD9, 0xFD, 0x4D, 0x82, 0xFD, 0xD9, 0x43, 0x00,
+  0x83, 0xB9, 0xFA, 0x7A, 0x03, 0x02, 0x82, 0x44, 0xF3, 0xC7, 0x02, 0x89, 0x09, 0xBD, 0xFF, 0xC6,
+  0x24, 0x00, 0x55, 0xF9, 0xE8, 0x1B, 0x03, 0x87, 0x0A, 0xC1, 0xFF, 0xF4, 0x9B, 0xFD, 0xFB, 0x3E,
+  0x05, 0x81, 0x0C, 0xC4, 0x42, 0x80, 0x6F, 0x07, 0x83, 0x0D, 0xC7, 0xFF, 0xA4, 0x1E, 0x82, 0x2D,
+  0xCC, 0xFC, 0x46, 0x83, 0xFC, 0xCD, 0x2F, 0xCD, 0x4A, 0x81, 0xCD, 0xFD, 0x4A, 0x80, 0xFC, 0x42,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xE7, 0x41, 0x80,
+  0x1C, 0x05, 0x42, 0x80, 0x93, 0x41, 0x81, 0xD3, 0x10, 0x07, 0x81, 0x0E, 0xD6, 0x41, 0x81, 0xC0,
+  0x07, 0x07, 0x81, 0x1F, 0xE6, 0x41, 0x81, 0xAA, 0x02, 0x07, 0x81, 0x2F, 0xF1, 0x41, 0x80, 0x91,
+  0x08, 0x81, 0x42, 0xF9, 0x41, 0x80, 0x76, 0x08, 0x84, 0x5A, 0xFE, 0xFF, 0xFE, 0x5C, 0x08, 0x80,
+  0x75, 0x41, 0x81, 0xFA, 0x44, 0x08, 0x80, 0x90, 0x41, 0x81, 0xF2, 0x31, 0x07, 0x81, 0x02, 0xAA,
+  0x41, 0x81, 0xE7, 0x20, 0x07, 0x81, 0x07, 0xC1, 0x41, 0x81, 0xD8, 0x10, 0x07, 0x81, 0x10, 0xD4,
+  0x41, 0x80, 0x97, 0x08, 0x80, 0x1C, 0x41, 0x80, 0xE9, 0x42, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFC, 0xCD, 0x4A, 0x83,
+  0xCE, 0x2F, 0xCD, 0xFD, 0x46, 0x82, 0xFD, 0xCF, 0x31, 0x00, 0x83, 0xB9, 0xFA, 0x7A, 0x03, 0x02,
+  0x82, 0x44, 0xF3, 0xC7, 0x01, 0x89, 0x09, 0xBD, 0xFF, 0xC6, 0x24, 0x00, 0x55, 0xF9, 0xE8, 0x1B,
+  0x02, 0x87, 0x0A, 0xC1, 0xFF, 0xF4, 0x9B, 0xFD, 0xFB, 0x3E, 0x04, 0x81, 0x0C, 0xC4, 0x42, 0x80,
+  0x6F, 0x06, 0x83, 0x0D, 0xC7, 0xFF, 0xA4, 0x1B, 0x82, 0x1F, 0xAF, 0xF8, 0x45, 0x83, 0xF8, 0xAE,
+  0x1F, 0xC7, 0x49, 0x81, 0xC6, 0xFD, 0x41, 0x05, 0x41, 0x80, 0xFC, 0x42, 0x05, 0x45, 0x05, 0x42,
+  0x80, 0xFE, 0x41, 0x80, 0x04, 0x07, 0x80, 0xD4, 0x41, 0x81, 0xC3, 0x1C, 0x06, 0x81, 0x38, 0xED,
+  0x41, 0x81, 0xEC, 0x4A, 0x06, 0x81, 0x1E, 0xC6, 0x41, 0x82, 0xFE, 0x8A, 0x04, 0x05, 0x82, 0x04,
+  0x8B, 0xFE, 0x41, 0x81, 0xC6, 0x1E, 0x06, 0x81, 0x4C, 0xED, 0x41, 0x81, 0xEE, 0x4E, 0x06, 0x81,
+  0x1D, 0xC5, 0x42, 0x81, 0x8E, 0x03, 0x05, 0x82, 0x04, 0x89, 0xFE, 0x41, 0x80, 0x93, 0x07, 0x80,
+  0x4A, 0x41, 0x80, 0xF2, 0x42, 0x05, 0x45, 0x05, 0x45, 0x05, 0x42, 0x80, 0xFD, 0x41, 0x05, 0x41,
+  0x81, 0xFC, 0xC8, 0x49, 0x83, 0xC7, 0x20, 0xB2, 0xFA, 0x45, 0x82, 0xFA, 0xB2, 0x20, 0x03, 0x42,
+  0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x20, 0x80,
+  0xE6, 0x41, 0x80, 0x24, 0x06, 0x80, 0x23, 0x41, 0x81, 0xE5, 0x98, 0x41, 0x80, 0x6C, 0x06, 0x80,
+  0x6C, 0x41, 0x81, 0x97, 0x49, 0x41, 0x80, 0xB4, 0x06, 0x80, 0xB3, 0x41, 0x85, 0x48, 0x07, 0xF3,
+  0xFF, 0xF5, 0x07, 0x04, 0x86, 0x06, 0xF4, 0xFF, 0xF2, 0x07, 0x00, 0xAB, 0x41, 0x80, 0x45, 0x04,
+  0x80, 0x42, 0x41, 0x80, 0xAA, 0x01, 0x80, 0x5C, 0x41, 0x80, 0x8E, 0x04, 0x80, 0x8A, 0x41, 0x80,
+  0x5B, 0x01, 0x83, 0x11, 0xFB, 0xFF, 0xD6, 0x04, 0x83, 0xD1, 0xFF, 0xFB, 0x10, 0x02, 0x80, 0xBD,
+  0x41, 0x80, 0x1F, 0x02, 0x80, 0x19, 0x41, 0x80, 0xBC, 0x03, 0x80, 0x6E, 0x41, 0x80, 0x67, 0x02,
+  0x80, 0x60, 0x41, 0x80, 0x6D, 0x03, 0x80, 0x1F, 0x41, 0x80, 0xB0, 0x02, 0x80, 0xA8, 0x41, 0x80,
+  0x1F, 0x04, 0x88, 0xD0, 0xFF, 0xF2, 0x05, 0x00, 0x02, 0xEC, 0xFF, 0xCF, 0x05, 0x80, 0x81, 0x41,
+  0x82, 0x41, 0x00, 0x37, 0x41, 0x80, 0x80, 0x05, 0x80, 0x32, 0x41, 0x82, 0x89, 0x00, 0x7E, 0x41,
+  0x80, 0x31, 0x06, 0x86, 0xDF, 0xFF, 0xD2, 0x00, 0xC6, 0xFF, 0xDC, 0x07, 0x80, 0x8A, 0x41, 0x83,
+  0x2C, 0xFC, 0xFF, 0x82, 0x07, 0x80, 0x32, 0x41, 0x80, 0xB8, 0x41, 0x80, 0x30, 0x08, 0x80, 0xDB,
+  0x42, 0x80, 0xE1, 0x09, 0x80, 0x8A, 0x42, 0x80, 0x96, 0x09, 0x80, 0x43, 0x42, 0x80, 0x4E, 0x09,
+  0x80, 0x0B, 0x42, 0x80, 0x0D, 0x0A, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B,
+  0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x00, 0x83,
+  0xB9, 0xFA, 0x7A, 0x03, 0x02, 0x82, 0x44, 0xF3, 0xC7, 0x01, 0x89, 0x09, 0xBD, 0xFF, 0xC6, 0x24,
+  0x00, 0x55, 0xF9, 0xE8, 0x1B, 0x02, 0x87, 0x0A, 0xC1, 0xFF, 0xF4, 0x9B, 0xFD, 0xFB, 0x3E, 0x04,
+  0x81, 0x0C, 0xC4, 0x42, 0x80, 0x6F, 0x06, 0x83, 0x0D, 0xC7, 0xFF, 0xA4, 0x1C, 0x4A, 0x00, 0x4A,
+  0x00, 0x49, 0x80, 0xD1, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7B, 0x07, 0x80, 0x80, 0x41, 0x80, 0x26,
+  0x07, 0x82, 0xD5, 0xFF, 0xD1, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7C, 0x07, 0x80, 0x80, 0x41, 0x80,
+  0x27, 0x07, 0x82, 0xD5, 0xFF, 0xD1, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7C, 0x07, 0x80, 0x80, 0x41,
+  0x80, 0x27, 0x07, 0x82, 0xD5, 0xFF, 0xD2, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7D, 0x07, 0x80, 0x80,
+  0x41, 0x80, 0x28, 0x07, 0x82, 0xD5, 0xFF, 0xD2, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7D, 0x07, 0x80,
+  0x80, 0x41, 0x80, 0x28, 0x07, 0x82, 0xD5, 0xFF, 0xD3, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7E, 0x07,
+  0x80, 0x80, 0x41, 0x80, 0x29, 0x07, 0x82, 0xD5, 0xFF, 0xD3, 0x07, 0x80, 0x2A, 0x41, 0x80, 0x7E,
+  0x07, 0x80, 0x80, 0x41, 0x80, 0x29, 0x07, 0x82, 0xD5, 0xFF, 0xD4, 0x07, 0x80, 0x2A, 0x41, 0x80,
+  0x7E, 0x07, 0x80, 0x80, 0x41, 0x80, 0x29, 0x07, 0x82, 0xD5, 0xFF, 0xD4, 0x07, 0x80, 0x2A, 0x41,
+  0x80, 0x7F, 0x07, 0x80, 0x80, 0x41, 0x80, 0x2A, 0x07, 0x80, 0xD5, 0x62, 0x00, 0x83, 0xB9, 0xFA,
+  0x7A, 0x03, 0x02, 0x8D, 0x44, 0xF3, 0xC7, 0x00, 0x09, 0xBD, 0xFF, 0xC6, 0x24, 0x00, 0x55, 0xF9,
+  0xE8, 0x1B, 0x01, 0x87, 0x0A, 0xC1, 0xFF, 0xF4, 0x9B, 0xFD, 0xFB, 0x3E, 0x03, 0x81, 0x0C, 0xC4,
+  0x42, 0x80, 0x6F, 0x05, 0x83, 0x0D, 0xC7, 0xFF, 0xA4, 0x19, 0x48, 0x81, 0xFE, 0x00, 0x48, 0x80,
+  0xB1, 0x06, 0x80, 0x72, 0x41, 0x80, 0x3D, 0x05, 0x83, 0x04, 0xE1, 0xFF, 0xC8, 0x06, 0x80, 0x5A,
+  0x41, 0x80, 0x54, 0x06, 0x83, 0xCD, 0xFF, 0xDC, 0x02, 0x05, 0x80, 0x42, 0x41, 0x80, 0x6B, 0x06,
+  0x83, 0xB6, 0xFF, 0xEC, 0x0A, 0x05, 0x83, 0x2A, 0xFE, 0xFF, 0x82, 0x06, 0x83, 0x9E, 0xFF, 0xF7,
+  0x16, 0x05, 0x83, 0x18, 0xF8, 0xFF, 0x99, 0x06, 0x83, 0x85, 0xFF, 0xFE, 0x26, 0x05, 0x83, 0x0B,
+  0xED, 0xFF, 0xB0, 0x06, 0x80, 0x6D, 0x41, 0x80, 0x3B, 0x05, 0x83, 0x03, 0xDD, 0xFF, 0xC7, 0x06,
+  0x80, 0x55, 0x41, 0x80, 0x52, 0x06, 0x83, 0xC8, 0xFF, 0xDB, 0x02, 0x05, 0x80, 0x3D, 0x41, 0x80,
+  0x6A, 0x06, 0x80, 0xB1, 0x49, 0x80, 0xFE, 0x49, 0x08, 0x82, 0x1E, 0xBB, 0xF6, 0x42, 0x80, 0xF3,
+  0x08, 0x80, 0xB3, 0x44, 0x80, 0xDB, 0x07, 0x81, 0x05, 0xF8, 0x44, 0x80, 0xC3, 0x07, 0x80, 0x28,
+  0x41, 0x80, 0xEA, 0x0B, 0x80, 0x50, 0x41, 0x80, 0xC0, 0x0B, 0x80, 0x78, 0x41, 0x80, 0x95, 0x0B,
+  0x80, 0x9F, 0x41, 0x80, 0x6B, 0x0B, 0x80, 0xC7, 0x41, 0x80, 0x40, 0x0B, 0x80, 0xEE, 0x41, 0x80,
+  0x16, 0x0A, 0x80, 0x16, 0x41, 0x80, 0xEC, 0x0B, 0x80, 0x3D, 0x41, 0x80, 0xC1, 0x0B, 0x80, 0x65,
+  0x41, 0x80, 0x97, 0x0B, 0x80, 0x8C, 0x41, 0x80, 0x6D, 0x08, 0x80, 0x15, 0x47, 0x80, 0xB8, 0x05,
+  0x80, 0x35, 0x47, 0x80, 0x99, 0x05, 0x80, 0x54, 0x47, 0x80, 0x7B, 0x07, 0x80, 0x2B, 0x41, 0x80,
+  0xD1, 0x0B, 0x80, 0x59, 0x41, 0x80, 0xA5, 0x0B, 0x80, 0x86, 0x41, 0x80, 0x79, 0x0B, 0x80, 0xB4,
+  0x41, 0x80, 0x4D, 0x0B, 0x80, 0xE2, 0x41, 0x80, 0x21, 0x0A, 0x80, 0x0F, 0x41, 0x81, 0xF3, 0x01,
+  0x0A, 0x80, 0x3D, 0x41, 0x80, 0xC8, 0x0B, 0x80, 0x6B, 0x41, 0x80, 0x9C, 0x0B, 0x80, 0x98, 0x41,
+  0x80, 0x70, 0x0B, 0x80, 0xC6, 0x41, 0x80, 0x44, 0x0A, 0x81, 0x01, 0xF2, 0x41, 0x80, 0x18, 0x0A,
+  0x80, 0x21, 0x41, 0x80, 0xEB, 0x0B, 0x80, 0x4F, 0x41, 0x80, 0xBF, 0x0B, 0x80, 0x7C, 0x41, 0x80,
+  0x93, 0x0B, 0x80, 0xAA, 0x41, 0x80, 0x67, 0x0B, 0x80, 0xD8, 0x41, 0x80, 0x3B, 0x0A, 0x81, 0x08,
+  0xFC, 0x41, 0x80, 0x0F, 0x0A, 0x80, 0x33, 0x41, 0x80, 0xE2, 0x0B, 0x80, 0x61, 0x41, 0x80, 0xB6,
+  0x0B, 0x80, 0x8E, 0x41, 0x80, 0x8A, 0x0B, 0x80, 0xBC, 0x41, 0x80, 0x5E, 0x0B, 0x80, 0xE9, 0x41,
+  0x80, 0x32, 0x08, 0x80, 0xC8, 0x43, 0x81, 0xFB, 0x08, 0x08, 0x80, 0xDE, 0x43, 0x80, 0xBD, 0x09,
+  0x80, 0xF5, 0x41, 0x82, 0xF9, 0xC5, 0x25, 0x09, 0x02, 0x83, 0xA8, 0xFF, 0xB4, 0x01, 0x03, 0x80,
+  0x72, 0x42, 0x80, 0x7C, 0x02, 0x93, 0x3F, 0xFB, 0xFD, 0xA4, 0xFE, 0xFD, 0x44, 0x00, 0x1B, 0xE8,
+  0xF9, 0x56, 0x00, 0x5D, 0xFC, 0xEB, 0x1D, 0xC7, 0xF4, 0x46, 0x02, 0x82, 0x52, 0xF9, 0xC7, 0x83,
+  0xB9, 0xFA, 0x7A, 0x03, 0x02, 0x95, 0x44, 0xF3, 0xC7, 0x09, 0xBD, 0xFF, 0xC6, 0x24, 0x00, 0x55,
+  0xF9, 0xE8, 0x1B, 0x00, 0x0A, 0xC1, 0xFF, 0xF4, 0x9B, 0xFD, 0xFB, 0x3E, 0x02, 0x81, 0x0C, 0xC4,
+  0x42, 0x80, 0x6F, 0x04, 0x83, 0x0D, 0xC7, 0xFF, 0xA4, 0x02, 0x41, 0x03, 0x43, 0x03, 0x43, 0x03,
+  0x41, 0x80, 0xF1, 0x45, 0x82, 0xF0, 0x72, 0xF1, 0x43, 0x81, 0xF1, 0x71, 0x4F, 0x82, 0x43, 0xD9,
+  0xFD, 0x41, 0x83, 0xFD, 0xD9, 0x43, 0xD9, 0x45, 0x82, 0xD9, 0xFD, 0xFF, 0x03, 0x40, 0x80, 0xFD,
+  0x41, 0x03, 0x43, 0x03, 0x41, 0x81, 0xFD, 0xFF, 0x03, 0x40, 0x81, 0xFD, 0xD9, 0x45, 0x83, 0xD9,
+  0x43, 0xD9, 0xFD, 0x41, 0x82, 0xFD, 0xD9, 0x43, 0x00, 0x80, 0x59, 0x41, 0x80, 0xAE, 0x01, 0x84,
+  0x1D, 0xEF, 0xFF, 0xC1, 0x08, 0x01, 0x83, 0xA9, 0xFF, 0xD2, 0x10, 0x02, 0x82, 0xF1, 0xFF, 0x1A,
+  0x03, 0x41, 0x04, 0x41, 0x04, 0x80, 0xF8, 0x45, 0x81, 0x90, 0xF9, 0x44, 0x84, 0x66, 0xEC, 0xE0,
+  0x78, 0x0C, 0x01, 0x41, 0x80, 0xEC, 0x42, 0x82, 0xF2, 0x98, 0x32, 0x43, 0x82, 0x32, 0x97, 0xF1,
+  0x42, 0x80, 0xEC, 0x41, 0x01, 0x84, 0x0B, 0x78, 0xE0, 0xEC, 0x66, 0x01, 0x80, 0x89, 0x41, 0x82,
+  0xA7, 0x00, 0x89, 0x41, 0x9F, 0xA7, 0x00, 0x20, 0xF8, 0xFF, 0xCE, 0x0A, 0x20, 0xF8, 0xFF, 0xCE,
+  0x0A, 0x00, 0xA9, 0xFF, 0xEA, 0x1E, 0x00, 0xA9, 0xFF, 0xEA, 0x1E, 0x00, 0x3A, 0xFF, 0xFA, 0x3D,
+  0x00, 0x3A, 0xFF, 0xFA, 0x3D, 0x01, 0x82, 0xC8, 0xFF, 0x68, 0x01, 0x82, 0xC8, 0xFF, 0x68, 0x02,
+  0x00, 0x81, 0x46, 0xE1, 0x4A, 0x81, 0xDD, 0x3E, 0x01, 0x80, 0xDD, 0x4C, 0x80, 0xD9, 0x01, 0x44,
+  0x86, 0xFE, 0xFD, 0xFC, 0xFB, 0xFA, 0xF9, 0xF9, 0x41, 0x80, 0xFE, 0x01, 0x42, 0x80, 0x03, 0x07,
+  0x42, 0x01, 0x42, 0x80, 0x03, 0x07, 0x42, 0x01, 0x42, 0x80, 0x03, 0x07, 0x42, 0x01, 0x42, 0x80,
+  0x03, 0x07, 0x42, 0x01, 0x42, 0x80, 0x02, 0x07, 0x42, 0x01, 0x42, 0x80, 0x02, 0x07, 0x42, 0x01,
+  0x42, 0x80, 0x02, 0x07, 0x42, 0x01, 0x42, 0x80, 0x02, 0x07, 0x42, 0x01, 0x42, 0x80, 0x02, 0x07,
+  0x42, 0x01, 0x42, 0x80, 0x01, 0x07, 0x42, 0x01, 0x42, 0x80, 0x01, 0x07, 0x42, 0x01, 0x42, 0x80,
+  0x01, 0x07, 0x42, 0x01, 0x42, 0x80, 0x01, 0x07, 0x42, 0x01, 0x42, 0x80, 0x01, 0x07, 0x42, 0x01,
+  0x42, 0x08, 0x42, 0x01, 0x42, 0x08, 0x42, 0x01, 0x42, 0x08, 0x42, 0x01, 0x42, 0x08, 0x42, 0x01,
+  0x42, 0x08, 0x41, 0x80, 0xFE, 0x01, 0x80, 0xDB, 0x44, 0x02, 0x44, 0x80, 0xDA, 0x01, 0x81, 0x42,
+  0xDD, 0x43, 0x02, 0x43, 0x81, 0xDC, 0x40, 0x05, 0x41, 0x02, 0x41, 0x09, 0x41, 0x02, 0x41, 0x09,
+  0x41, 0x02, 0x41, 0x09, 0x41, 0x02, 0x41, 0x09, 0x41, 0x02, 0x41, 0x04, 0x46, 0x02, 0x4D, 0x02,
+  0x4D, 0x02, 0x46, 0x6C, 0x02, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42,
+  0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42,
+  0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42,
+  0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42,
+  0x02, 0x5B, 0x6D, 0x00, 0x19, 0xFF, 0xF2, 0x00, 0x4D, 0xFF, 0xD9, 0x00, 0x80, 0xFF, 0xBF, 0x00,
+  0xB3, 0xFF, 0xA6, 0x00, 0xE6, 0xFF, 0x8C, 0x19, 0xFF, 0xFF, 0x72, 0x4D, 0xFF, 0xFF, 0x59, 0x80,
+  0xFF, 0xFF, 0x3F, 0xB3, 0xFF, 0xFF, 0x26, 0xE6, 0xFF, 0xFF, 0x0C, 0x0C, 0xFF, 0xFF, 0xE5, 0x27,
+  0xFF, 0xFF, 0xB2, 0x40, 0xFF, 0xFF, 0x7F, 0x5A, 0xFF, 0xFF, 0x4C, 0x74, 0xFF, 0xFF, 0x19, 0x8D,
+  0xFF, 0xE5, 0x00, 0xA7, 0xFF, 0xB2, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xDA, 0xFF, 0x4C, 0x00, 0xF3,
+  0xFF, 0x19, 0x00, 0x0C, 0xFF, 0xFF, 0xE5, 0x27, 0xFF, 0xFF, 0xB2, 0x40, 0xFF, 0xFF, 0x7F, 0x5A,
+  0xFF, 0xFF, 0x4C, 0x74, 0xFF, 0xFF, 0x19, 0x8D, 0xFF, 0xE5, 0x00, 0xA7, 0xFF, 0xB2, 0x00, 0xC0,
+  0xFF, 0x7F, 0x00, 0xDA, 0xFF, 0x4C, 0x00, 0xF3, 0xFF, 0x19, 0x00, 0x00, 0x82, 0x19, 0xFF, 0xF2,
+  0x02, 0x86, 0x19, 0xFF, 0xF2, 0x00, 0x4D, 0xFF, 0xD9, 0x02, 0x86, 0x4D, 0xFF, 0xD9, 0x00, 0x80,
+  0xFF, 0xBF, 0x02, 0x86, 0x80, 0xFF, 0xBF, 0x00, 0xB3, 0xFF, 0xA6, 0x02, 0x86, 0xB3, 0xFF, 0xA6,
+  0x00, 0xE6, 0xFF, 0x8C, 0x02, 0x83, 0xE6, 0xFF, 0x8C, 0x19, 0x41, 0x80, 0x72, 0x01, 0x80, 0x19,
+  0x41, 0x81, 0x72, 0x4D, 0x41, 0x80, 0x59, 0x01, 0x80, 0x4D, 0x41, 0x81, 0x59, 0x80, 0x41, 0x80,
+  0x3F, 0x01, 0x80, 0x80, 0x41, 0x81, 0x3F, 0xB3, 0x41, 0x80, 0x26, 0x01, 0x80, 0xB3, 0x41, 0x81,
+  0x26, 0xE6, 0x41, 0x80, 0x0C, 0x01, 0x80, 0xE6, 0x41, 0x80, 0x0C, 0x80, 0x0C, 0x41, 0x80, 0xE5,
+  0x01, 0x80, 0x0C, 0x41, 0x81, 0xE5, 0x27, 0x41, 0x80, 0xB2, 0x01, 0x80, 0x27, 0x41, 0x81, 0xB2,
+  0x40, 0x41, 0x80, 0x7F, 0x01, 0x80, 0x40, 0x41, 0x81, 0x7F, 0x5A, 0x41, 0x80, 0x4C, 0x01, 0x80,
+  0x5A, 0x41, 0x81, 0x4C, 0x74, 0x41, 0x80, 0x19, 0x01, 0x80, 0x74, 0x41, 0x83, 0x19, 0x8D, 0xFF,
+  0xE5, 0x02, 0x86, 0x8D, 0xFF, 0xE5, 0x00, 0xA7, 0xFF, 0xB2, 0x02, 0x86, 0xA7, 0xFF, 0xB2, 0x00,
+  0xC0, 0xFF, 0x7F, 0x02, 0x86, 0xC0, 0xFF, 0x7F, 0x00, 0xDA, 0xFF, 0x4C, 0x02, 0x86, 0xDA, 0xFF,
+  0x4C, 0x00, 0xF3, 0xFF, 0x19, 0x02, 0x83, 0xF3, 0xFF, 0x19, 0x00, 0x80, 0x0C, 0x41, 0x80, 0xE5,
+  0x01, 0x80, 0x0C, 0x41, 0x81, 0xE5, 0x27, 0x41, 0x80, 0xB2, 0x01, 0x80, 0x27, 0x41, 0x81, 0xB2,
+  0x40, 0x41, 0x80, 0x7F, 0x01, 0x80, 0x40, 0x41, 0x81, 0x7F, 0x5A, 0x41, 0x80, 0x4C, 0x01, 0x80,
+  0x5A, 0x41, 0x81, 0x4C, 0x74, 0x41, 0x80, 0x19, 0x01, 0x80, 0x74, 0x41, 0x83, 0x19, 0x8D, 0xFF,
+  0xE5, 0x02, 0x86, 0x8D, 0xFF, 0xE5, 0x00, 0xA7, 0xFF, 0xB2, 0x02, 0x86, 0xA7, 0xFF, 0xB2, 0x00,
+  0xC0, 0xFF, 0x7F, 0x02, 0x86, 0xC0, 0xFF, 0x7F, 0x00, 0xDA, 0xFF, 0x4C, 0x02, 0x86, 0xDA, 0xFF,
+  0x4C, 0x00, 0xF3, 0xFF, 0x19, 0x02, 0x83, 0xF3, 0xFF, 0x19, 0x00, 0x05, 0x42, 0x0B, 0x42, 0x0B,
+  0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x6C, 0x05,
+  0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B,
+  0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B,
+  0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x05, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42,
+  0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x6C, 0x05, 0x42, 0x0B, 0x42,
+  0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x6C,
+  0x05, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42,
+  0x05, 0x82, 0x21, 0xBC, 0xFB, 0x45, 0x83, 0xFB, 0xBC, 0x21, 0xBD, 0x49, 0x81, 0xBC, 0xFB, 0x49,
+  0x80, 0xFB, 0x7F, 0x47, 0x80, 0xFB, 0x49, 0x81, 0xFD, 0xBD, 0x49, 0x83, 0xD1, 0x22, 0xBD, 0xFB,
+  0x45, 0x82, 0xFB, 0xC6, 0x31, 0x42, 0x03, 0x42, 0x03, 0x45, 0x03, 0x42, 0x03, 0x45, 0x03, 0x42,
+  0x03, 0x45, 0x03, 0x42, 0x03, 0x42, 0x13, 0x81, 0x14, 0x14, 0x0E, 0x82, 0x19, 0xBA, 0xFB, 0x44,
+  0x82, 0xFC, 0xC1, 0x20, 0x07, 0x82, 0x54, 0xFF, 0xC6, 0x0E, 0x80, 0xBA, 0x48, 0x80, 0xC1, 0x06,
+  0x83, 0x06, 0xDD, 0xFE, 0x37, 0x0E, 0x80, 0xFC, 0x41, 0x04, 0x41, 0x80, 0xFC, 0x06, 0x82, 0x75,
+  0xFF, 0xA5, 0x0F, 0x42, 0x04, 0x42, 0x05, 0x83, 0x15, 0xF0, 0xF6, 0x1D, 0x0F, 0x42, 0x04, 0x42,
+  0x05, 0x82, 0x97, 0xFF, 0x83, 0x10, 0x42, 0x04, 0x42, 0x04, 0x83, 0x2B, 0xFC, 0xE6, 0x0C, 0x10,
+  0x42, 0x04, 0x42, 0x04, 0x82, 0xB8, 0xFF, 0x61, 0x11, 0x42, 0x04, 0x42, 0x03, 0x83, 0x49, 0xFF,
+  0xCF, 0x02, 0x11, 0x42, 0x04, 0x42, 0x02, 0x83, 0x03, 0xD5, 0xFF, 0x41, 0x12, 0x42, 0x04, 0x42,
+  0x02, 0x82, 0x6A, 0xFF, 0xAF, 0x13, 0x42, 0x04, 0x42, 0x01, 0x83, 0x0F, 0xEB, 0xFA, 0x24, 0x13,
+  0x42, 0x04, 0x42, 0x01, 0x82, 0x8C, 0xFF, 0x8D, 0x14, 0x42, 0x04, 0x42, 0x00, 0x83, 0x22, 0xF9,
+  0xEC, 0x10, 0x14, 0x80, 0xFC, 0x41, 0x04, 0x41, 0x84, 0xFC, 0x00, 0xAD, 0xFF, 0x6B, 0x15, 0x80,
+  0xBE, 0x48, 0x84, 0xC8, 0x3D, 0xFF, 0xD7, 0x04, 0x15, 0x82, 0x1E, 0xC0, 0xFC, 0x44, 0x85, 0xFC,
+  0xC9, 0x2B, 0xCC, 0xFF, 0x4A, 0x20, 0x85, 0x5F, 0xFF, 0xB9, 0x19, 0xBA, 0xFB, 0x44, 0x82, 0xFC,
+  0xC1, 0x20, 0x01, 0x82, 0x19, 0xBA, 0xFB, 0x44, 0x82, 0xFC, 0xC1, 0x20, 0x08, 0x84, 0x0B, 0xE5,
+  0xFC, 0x2C, 0xBA, 0x48, 0x80, 0xC1, 0x01, 0x80, 0xBA, 0x48, 0x80, 0xC1, 0x08, 0x84, 0x81, 0xFF,
+  0x97, 0x00, 0xFC, 0x41, 0x04, 0x41, 0x80, 0xFC, 0x01, 0x80, 0xFC, 0x41, 0x04, 0x41, 0x80, 0xFC,
+  0x07, 0x84, 0x1B, 0xF5, 0xF1, 0x15, 0x00, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x07, 0x82,
+  0xA2, 0xFF, 0x76, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x06, 0x83, 0x34, 0xFE, 0xDE,
+  0x07, 0x01, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x06, 0x82, 0xC2, 0xFF, 0x54, 0x02, 0x42,
+  0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x05, 0x82, 0x54, 0xFF, 0xC3, 0x03, 0x42, 0x04, 0x42, 0x01,
+  0x42, 0x04, 0x42, 0x04, 0x83, 0x06, 0xDD, 0xFE, 0x34, 0x03, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04,
+  0x42, 0x04, 0x82, 0x75, 0xFF, 0xA1, 0x04, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x03, 0x83,
+  0x15, 0xF0, 0xF5, 0x1B, 0x04, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x03, 0x82, 0x97, 0xFF,
+  0x80, 0x05, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x02, 0x83, 0x2B, 0xFC, 0xE4, 0x0A, 0x05,
+  0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x02, 0x82, 0xB8, 0xFF, 0x5E, 0x06, 0x80, 0xFC, 0x41,
+  0x04, 0x41, 0x80, 0xFC, 0x01, 0x80, 0xFC, 0x41, 0x04, 0x41, 0x80, 0xFC, 0x01, 0x83, 0x49, 0xFF,
+  0xCC, 0x01, 0x06, 0x80, 0xBE, 0x48, 0x80, 0xC8, 0x01, 0x80, 0xBE, 0x48, 0x80, 0xC8, 0x01, 0x82,
+  0xC1, 0xEC, 0x3D, 0x07, 0x82, 0x1E, 0xC0, 0xFC, 0x44, 0x82, 0xFC, 0xC9, 0x29, 0x01, 0x82, 0x1E,
+  0xC0, 0xFC, 0x44, 0x82, 0xFC, 0xC9, 0x29, 0x03, 0x80, 0x4F, 0x41, 0x80, 0xCB, 0x02, 0x84, 0x0B,
+  0xE2, 0xFF, 0xFD, 0x35, 0x02, 0x80, 0x8C, 0x41, 0x80, 0x9A, 0x02, 0x84, 0x2E, 0xFB, 0xFF, 0xEC,
+  0x13, 0x01, 0x81, 0x01, 0xC7, 0x41, 0x80, 0x66, 0x02, 0x80, 0x68, 0x41, 0x81, 0xCB, 0x02, 0x01,
+  0x84, 0x17, 0xEF, 0xFF, 0xFD, 0x35, 0x02, 0x80, 0xA5, 0x41, 0x80, 0x99, 0x03, 0x42, 0x80, 0x25,
+  0x03, 0x80, 0xA5, 0x41, 0x80, 0x96, 0x03, 0x84, 0x17, 0xEF, 0xFF, 0xFC, 0x2F, 0x03, 0x80, 0x68,
+  0x41, 0x80, 0xC2, 0x03, 0x81, 0x01, 0xC7, 0x41, 0x80, 0x5A, 0x03, 0x84, 0x2E, 0xFB, 0xFF, 0xE4,
+  0x0B, 0x03, 0x80, 0x8C, 0x41, 0x80, 0x87, 0x03, 0x84, 0x0B, 0xE2, 0xFF, 0xF9, 0x24, 0x03, 0x80,
+  0x4F, 0x41, 0x80, 0xB4, 0x80, 0xB5, 0x41, 0x80, 0x4F, 0x03, 0x84, 0x25, 0xF9, 0xFF, 0xE1, 0x0B,
+  0x03, 0x80, 0x88, 0x41, 0x80, 0x8B, 0x03, 0x84, 0x0C, 0xE5, 0xFF, 0xFB, 0x2E, 0x03, 0x80, 0x5B,
+  0x41, 0x81, 0xC6, 0x01, 0x03, 0x80, 0xC3, 0x41, 0x80, 0x67, 0x03, 0x84, 0x30, 0xFD, 0xFF, 0xEE,
+  0x16, 0x03, 0x80, 0x97, 0x41, 0x80, 0xA4, 0x03, 0x80, 0x26, 0x41, 0x80, 0xFE, 0x03, 0x80, 0x9A,
+  0x41, 0x80, 0xA4, 0x02, 0x84, 0x35, 0xFD, 0xFF, 0xEE, 0x16, 0x01, 0x81, 0x02, 0xCB, 0x41, 0x80,
+  0x67, 0x02, 0x80, 0x67, 0x41, 0x81, 0xC7, 0x01, 0x01, 0x84, 0x13, 0xED, 0xFF, 0xFB, 0x2E, 0x02,
+  0x80, 0x9B, 0x41, 0x80, 0x8B, 0x02, 0x84, 0x35, 0xFE, 0xFF, 0xE1, 0x0B, 0x02, 0x80, 0xCB, 0x41,
+  0x80, 0x4F, 0x03, 0x10, 0x82, 0x48, 0xFF, 0xD0, 0x0F, 0x83, 0x03, 0xD5, 0xFF, 0x42, 0x0F, 0x82,
+  0x6A, 0xFF, 0xB0, 0x0F, 0x83, 0x0F, 0xEB, 0xFA, 0x25, 0x0F, 0x82, 0x8B, 0xFF, 0x8E, 0x0F, 0x83,
+  0x22, 0xF9, 0xED, 0x11, 0x0F, 0x82, 0xAD, 0xFF, 0x6D, 0x0F, 0x83, 0x3D, 0xFF, 0xD7, 0x04, 0x0E,
+  0x83, 0x01, 0xCC, 0xFF, 0x4B, 0x0F, 0x82, 0x5F, 0xFF, 0xBA, 0x0F, 0x83, 0x0A, 0xE4, 0xFC, 0x2D,
+  0x0F, 0x82, 0x80, 0xFF, 0x98, 0x0F, 0x83, 0x1B, 0xF5, 0xF2, 0x16, 0x0F, 0x82, 0xA2, 0xFF, 0x77,
+  0x0F, 0x83, 0x33, 0xFE, 0xDF, 0x07, 0x0F, 0x82, 0xC2, 0xFF, 0x55, 0x0F, 0x82, 0x54, 0xFF, 0xC4,
+  0x0F, 0x83, 0x06, 0xDD, 0xFE, 0x35, 0x0F, 0x82, 0x75, 0xFF, 0xA3, 0x0F, 0x83, 0x15, 0xF0, 0xF5,
+  0x1C, 0x0F, 0x82, 0x97, 0xFF, 0x81, 0x0F, 0x83, 0x2B, 0xFC, 0xE5, 0x0B, 0x0F, 0x82, 0xB8, 0xFF,
+  0x5F, 0x0F, 0x83, 0x49, 0xFF, 0xCD, 0x01, 0x0E, 0x83, 0x03, 0xD5, 0xFF, 0x3E, 0x0F, 0x82, 0x6A,
+  0xFF, 0xAD, 0x0F, 0x83, 0x0F, 0xEB, 0xF9, 0x23, 0x0F, 0x82, 0x8C, 0xFF, 0x8B, 0x0F, 0x83, 0x22,
+  0xF9, 0xEB, 0x0F, 0x0F, 0x82, 0xAD, 0xFF, 0x69, 0x0F, 0x83, 0x3D, 0xFF, 0xD5, 0x03, 0x0F, 0x82,
+  0xCC, 0xFF, 0x48, 0x10, 0x01, 0x81, 0x53, 0xE6, 0x47, 0x81, 0xE6, 0x51, 0x01, 0x80, 0xE7, 0x49,
+  0x80, 0xE7, 0x01, 0x4B, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42,
+  0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42,
+  0x08, 0x4C, 0x00, 0x4C, 0x00, 0x4C, 0x02, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x08, 0x4C, 0x00, 0x4C,
+  0x00, 0x4C, 0x02, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x05, 0x42, 0x01, 0x42,
+  0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x4B, 0x01, 0x80, 0xE8, 0x49,
+  0x80, 0xE6, 0x01, 0x81, 0x56, 0xE8, 0x47, 0x81, 0xE7, 0x53, 0x47, 0x01, 0x40, 0x81, 0xFD, 0x17,
+  0x03, 0x81, 0x03, 0xF3, 0x48, 0x01, 0x41, 0x80, 0x67, 0x03, 0x80, 0x34, 0x41, 0x02, 0x41, 0x04,
+  0x41, 0x80, 0xBA, 0x03, 0x80, 0x71, 0x41, 0x02, 0x41, 0x04, 0x41, 0x81, 0xFB, 0x11, 0x02, 0x80,
+  0xAF, 0x41, 0x02, 0x41, 0x04, 0x42, 0x80, 0x5F, 0x02, 0x80, 0xEB, 0x41, 0x02, 0x41, 0x04, 0x42,
+  0x80, 0xB1, 0x01, 0x80, 0x29, 0x42, 0x02, 0x41, 0x04, 0x42, 0x83, 0xF7, 0x0C, 0x00, 0x67, 0x42,
+  0x02, 0x41, 0x04, 0x41, 0x85, 0xDE, 0xFF, 0x56, 0x00, 0xA4, 0xE8, 0x41, 0x02, 0x41, 0x04, 0x41,
+  0x85, 0x84, 0xFF, 0xA9, 0x00, 0xE1, 0xAB, 0x41, 0x02, 0x41, 0x04, 0x41, 0x85, 0x28, 0xFF, 0xF3,
+  0x26, 0xFF, 0x6C, 0x41, 0x02, 0x41, 0x04, 0x41, 0x00, 0x84, 0xCC, 0xFF, 0xAA, 0xFF, 0x2E, 0x41,
+  0x02, 0x41, 0x04, 0x41, 0x00, 0x80, 0x71, 0x41, 0x81, 0xEE, 0x01, 0x41, 0x02, 0x41, 0x04, 0x41,
+  0x00, 0x84, 0x18, 0xFC, 0xFF, 0xB1, 0x00, 0x41, 0x02, 0x41, 0x04, 0x41, 0x01, 0x83, 0xB9, 0xFF,
+  0x73, 0x00, 0x41, 0x02, 0x41, 0x04, 0x41, 0x01, 0x83, 0x5E, 0xFF, 0x35, 0x00, 0x41, 0x02, 0x41,
+  0x04, 0x41, 0x01, 0x83, 0x0C, 0xE8, 0x03, 0x00, 0x41, 0x02, 0x41, 0x04, 0x41, 0x05, 0x41, 0x02,
+  0x41, 0x04, 0x41, 0x05, 0x41, 0x02, 0x80, 0xC2, 0x41, 0x80, 0x3F, 0x08, 0x80, 0x47, 0x41, 0x80,
+  0xBE, 0x09, 0x80, 0xCC, 0x41, 0x80, 0x3E, 0x08, 0x80, 0x51, 0x41, 0x80, 0xBD, 0x08, 0x81, 0x01,
+  0xD4, 0x41, 0x80, 0x3D, 0x08, 0x80, 0x5B, 0x41, 0x80, 0xBC, 0x08, 0x81, 0x03, 0xDC, 0x41, 0x80,
+  0x3C, 0x08, 0x80, 0x65, 0x41, 0x80, 0xBB, 0x08, 0x81, 0x06, 0xE3, 0x41, 0x80, 0x3A, 0x08, 0x80,
+  0x6E, 0x41, 0x80, 0xBA, 0x08, 0x81, 0x09, 0xE9, 0x41, 0x80, 0x39, 0x08, 0x80, 0x78, 0x41, 0x80,
+  0xB9, 0x08, 0x81, 0x0E, 0xEF, 0x41, 0x80, 0x38, 0x08, 0x80, 0x82, 0x41, 0x83, 0xB8, 0x36, 0xD2,
+  0xFD, 0x49, 0x80, 0xD4, 0x4B, 0x80, 0xFE, 0x41, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45, 0x06, 0x45,
+  0x06, 0x42, 0x80, 0xFD, 0x4A, 0x81, 0xFD, 0xD3, 0x4A, 0x83, 0xD1, 0x36, 0xD2, 0xFD, 0x46, 0x82,
+  0xFD, 0xD2, 0x34, 0x04, 0x84, 0x02, 0xF4, 0xFF, 0xFE, 0x0D, 0x09, 0x80, 0x2D, 0x42, 0x80, 0x3F,
+  0x09, 0x80, 0x63, 0x42, 0x80, 0x73, 0x09, 0x80, 0x99, 0x42, 0x80, 0xA8, 0x09, 0x80, 0xCF, 0x42,
+  0x80, 0xDD, 0x08, 0x83, 0x08, 0xFB, 0xFF, 0xD0, 0x41, 0x80, 0x13, 0x07, 0x80, 0x3A, 0x41, 0x80,
+  0x70, 0x41, 0x80, 0x47, 0x07, 0x86, 0x70, 0xFF, 0xFD, 0x15, 0xFD, 0xFF, 0x7C, 0x07, 0x86, 0xA6,
+  0xFF, 0xD7, 0x00, 0xD9, 0xFF, 0xB1, 0x07, 0x86, 0xDC, 0xFF, 0xA7, 0x00, 0xA9, 0xFF, 0xE7, 0x06,
+  0x80, 0x12, 0x41, 0x82, 0x77, 0x00, 0x79, 0x41, 0x80, 0x1D, 0x05, 0x80, 0x47, 0x41, 0x82, 0x47,
+  0x00, 0x49, 0x41, 0x80, 0x52, 0x05, 0x80, 0x7D, 0x41, 0x82, 0x17, 0x00, 0x18, 0x41, 0x80, 0x88,
+  0x05, 0x82, 0xB3, 0xFF, 0xE7, 0x02, 0x82, 0xE8, 0xFF, 0xBE, 0x05, 0x82, 0xE8, 0xFF, 0xB7, 0x02,
+  0x83, 0xB9, 0xFF, 0xF1, 0x01, 0x03, 0x80, 0x1F, 0x41, 0x80, 0x87, 0x02, 0x80, 0x89, 0x41, 0x80,
+  0x29, 0x03, 0x80, 0x55, 0x41, 0x80, 0x57, 0x02, 0x80, 0x59, 0x41, 0x80, 0x5E, 0x03, 0x80, 0x8A,
+  0x41, 0x80, 0x27, 0x02, 0x80, 0x29, 0x41, 0x80, 0x94, 0x03, 0x83, 0xC0, 0xFF, 0xF5, 0x02, 0x02,
+  0x83, 0x02, 0xF5, 0xFF, 0xC9, 0x02, 0x83, 0x02, 0xF3, 0xFF, 0xC7, 0x04, 0x83, 0xC9, 0xFF, 0xF8,
+  0x06, 0x01, 0x80, 0x2C, 0x41, 0x80, 0x97, 0x04, 0x80, 0x99, 0x41, 0x80, 0x33, 0x01, 0x80, 0x62,
+  0x41, 0x80, 0x67, 0x04, 0x80, 0x69, 0x41, 0x80, 0x68, 0x01, 0x80, 0x98, 0x41, 0x80, 0x37, 0x04,
+  0x80, 0x39, 0x41, 0x80, 0x9D, 0x01, 0x83, 0xCD, 0xFF, 0xFD, 0x0A, 0x04, 0x88, 0x0B, 0xFD, 0xFF,
+  0xD2, 0x00, 0x08, 0xFA, 0xFF, 0xD7, 0x06, 0x84, 0xD9, 0xFF, 0xFC, 0x0B, 0x39, 0x41, 0x80, 0xA7,
+  0x06, 0x80, 0xA9, 0x41, 0x81, 0x3D, 0x6F, 0x41, 0x80, 0x77, 0x06, 0x80, 0x79, 0x41, 0x81, 0x71,
+  0xA5, 0x41, 0x80, 0x47, 0x06, 0x80, 0x49, 0x41, 0x81, 0xA5, 0xDB, 0x41, 0x80, 0x17, 0x06, 0x80,
+  0x18, 0x41, 0x81, 0xD9, 0xFE, 0x4C, 0x80, 0xFE, 0x5D, 0x6F, 0x02, 0x42, 0x03, 0x42, 0x05, 0x42,
+  0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42,
+  0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42,
+  0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42,
+  0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42,
+  0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42,
+  0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42,
+  0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x02, 0x60,
+  0x82, 0xB5, 0xFF, 0x5A, 0x07, 0x83, 0x1E, 0xF3, 0xF0, 0x1F, 0x07, 0x83, 0x6D, 0xFF, 0xC1, 0x02,
+  0x06, 0x83, 0x02, 0xC6, 0xFF, 0x7A, 0x07, 0x83, 0x2A, 0xF9, 0xFA, 0x34, 0x07, 0x83, 0x7F, 0xFF,
+  0xD9, 0x0A, 0x06, 0x83, 0x06, 0xD5, 0xFF, 0x9A, 0x07, 0x83, 0x38, 0xFD, 0xFF, 0x4F, 0x07, 0x83,
+  0x92, 0xFF, 0xEB, 0x18, 0x06, 0x84, 0x0C, 0xE1, 0xFF, 0xB8, 0x01, 0x06, 0x80, 0x49, 0x41, 0x80,
+  0x6F, 0x07, 0x82, 0xA5, 0xFF, 0xF7, 0x07, 0x80, 0x27, 0x41, 0x07, 0x82, 0x95, 0xFF, 0xFA, 0x06,
+  0x83, 0x2C, 0xFC, 0xFF, 0x7F, 0x06, 0x83, 0xBD, 0xFF, 0xD3, 0x05, 0x05, 0x83, 0x52, 0xFF, 0xFC,
+  0x35, 0x05, 0x83, 0x07, 0xDE, 0xFF, 0x8A, 0x06, 0x83, 0x7B, 0xFF, 0xDA, 0x09, 0x05, 0x83, 0x1A,
+  0xF4, 0xFE, 0x3E, 0x06, 0x82, 0xA4, 0xFF, 0x95, 0x06, 0x83, 0x39, 0xFE, 0xE1, 0x0D, 0x05, 0x83,
+  0x01, 0xCA, 0xFF, 0x48, 0x06, 0x82, 0x61, 0xFF, 0xA0, 0x06, 0x83, 0x0D, 0xE7, 0xE8, 0x12, 0x06,
+  0x82, 0x8A, 0xFF, 0x53, 0x07, 0x80, 0xF9, 0x5F, 0x0B, 0x80, 0x1D, 0x41, 0x80, 0xDF, 0x0B, 0x80,
+  0x58, 0x41, 0x80, 0x9F, 0x0B, 0x80, 0x92, 0x41, 0x80, 0x5F, 0x0B, 0x80, 0xCC, 0x41, 0x80, 0x1F,
+  0x0A, 0x83, 0x0A, 0xFB, 0xFF, 0xDE, 0x0B, 0x80, 0x40, 0x41, 0x80, 0x9E, 0x0B, 0x80, 0x7B, 0x41,
+  0x80, 0x5E, 0x0B, 0x80, 0xB5, 0x41, 0x80, 0x1E, 0x0A, 0x83, 0x01, 0xED, 0xFF, 0xDD, 0x0B, 0x80,
+  0x29, 0x41, 0x80, 0x9D, 0x0B, 0x80, 0x63, 0x41, 0x80, 0x5D, 0x0B, 0x80, 0x9E, 0x41, 0x80, 0x1D,
+  0x0B, 0x82, 0xD8, 0xFF, 0xDC, 0x0B, 0x83, 0x12, 0xFE, 0xFF, 0x9C, 0x0B, 0x80, 0x4C, 0x41, 0x80,
+  0x5C, 0x0B, 0x80, 0x86, 0x41, 0x80, 0x1C, 0x0B, 0x82, 0xC1, 0xFF, 0xDB, 0x0B, 0x83, 0x04, 0xF5,
+  0xFF, 0x9B, 0x0B, 0x80, 0x35, 0x41, 0x80, 0x5B, 0x0B, 0x80, 0x6F, 0x41, 0x80, 0x1B, 0x0B, 0x82,
+  0xA9, 0xFF, 0xDA, 0x04, 0x80, 0xC0, 0x41, 0x80, 0x3A, 0x03, 0x82, 0xE3, 0xFF, 0x9A, 0x04, 0x80,
+  0x3F, 0x41, 0x80, 0xB0, 0x02, 0x80, 0x1E, 0x41, 0x80, 0x5A, 0x05, 0x83, 0xBE, 0xFF, 0xFE, 0x28,
+  0x01, 0x80, 0x58, 0x41, 0x80, 0x1A, 0x05, 0x80, 0x3D, 0x41, 0x80, 0x9C, 0x01, 0x82, 0x92, 0xFF,
+  0xD9, 0x07, 0x87, 0xBD, 0xFF, 0xF9, 0x19, 0x00, 0xCC, 0xFF, 0x99, 0x07, 0x80, 0x3C, 0x41, 0x84,
+  0x88, 0x0A, 0xFB, 0xFF, 0x59, 0x08, 0x83, 0xBB, 0xFF, 0xF0, 0x4E, 0x41, 0x80, 0x19, 0x08, 0x80,
+  0x3A, 0x41, 0x82, 0xE0, 0xFF, 0xD8, 0x0A, 0x80, 0xBA, 0x42, 0x80, 0x98, 0x0A, 0x80, 0x39, 0x42,
+  0x80, 0x58, 0x0B, 0x80, 0xB8, 0x41, 0x80, 0x18, 0x06, 0x81, 0x4F, 0xE2, 0x44, 0x81, 0xDD, 0x40,
+  0x04, 0x81, 0x32, 0xD5, 0x44, 0x82, 0xE2, 0x4E, 0xDF, 0x46, 0x81, 0xF5, 0x2B, 0x02, 0x81, 0x1A,
+  0xEB, 0x46, 0x82, 0xDD, 0xFE, 0xFF, 0x03, 0x84, 0x08, 0xDD, 0xFF, 0xCB, 0x02, 0x01, 0x83, 0xB3,
+  0xFF, 0xD8, 0x06, 0x03, 0x40, 0x80, 0xFE, 0x41, 0x04, 0x80, 0x49, 0x41, 0x82, 0x6A, 0x00, 0x51,
+  0x41, 0x80, 0x45, 0x04, 0x43, 0x05, 0x86, 0xAD, 0xFF, 0xEF, 0x22, 0xE1, 0xFF, 0xAC, 0x05, 0x43,
+  0x05, 0x86, 0x1C, 0xF4, 0xFF, 0xEB, 0xFF, 0xF5, 0x1E, 0x05, 0x43, 0x06, 0x80, 0x75, 0x42, 0x80,
+  0x79, 0x06, 0x43, 0x06, 0x84, 0x09, 0xF5, 0xFF, 0xFC, 0x11, 0x06, 0x43, 0x06, 0x80, 0x71, 0x42,
+  0x80, 0x86, 0x06, 0x43, 0x05, 0x86, 0x17, 0xF0, 0xFF, 0xE4, 0xFF, 0xF8, 0x24, 0x05, 0x43, 0x05,
+  0x86, 0xA1, 0xFF, 0xE5, 0x19, 0xE3, 0xFF, 0xB4, 0x05, 0x43, 0x04, 0x85, 0x39, 0xFE, 0xFF, 0x59,
+  0x00, 0x54, 0x41, 0x80, 0x4C, 0x04, 0x41, 0x81, 0xFE, 0xFF, 0x03, 0x83, 0x02, 0xCD, 0xFF, 0xC0,
+  0x02, 0x83, 0xB6, 0xFF, 0xDC, 0x07, 0x03, 0x40, 0x81, 0xFE, 0xDF, 0x46, 0x81, 0xF7, 0x27, 0x02,
+  0x81, 0x1C, 0xEC, 0x46, 0x82, 0xDE, 0x4F, 0xE3, 0x44, 0x81, 0xE6, 0x52, 0x04, 0x81, 0x33, 0xD7,
+  0x44, 0x81, 0xE3, 0x4F, 0x03, 0x82, 0x3F, 0xD4, 0xFC, 0x43, 0x03, 0x80, 0xD6, 0x45, 0x03, 0x80,
+  0xFA, 0x41, 0x07, 0x80, 0xFD, 0x41, 0x07, 0x80, 0xFD, 0x41, 0x07, 0x80, 0xFD, 0x41, 0x07, 0x80,
+  0xFD, 0x41, 0x07, 0x80, 0xFD, 0x41, 0x07, 0x80, 0xFD, 0x41, 0x07, 0x80, 0xFD, 0x41, 0x07, 0x80,
+  0xFD, 0x41, 0x07, 0x80, 0xFD, 0x41, 0x07, 0x80, 0xFE, 0x41, 0x07, 0x80, 0xFE, 0x41, 0x07, 0x80,
+  0xFE, 0x41, 0x07, 0x80, 0xFE, 0x41, 0x07, 0x80, 0xFE, 0x41, 0x07, 0x80, 0xFE, 0x41, 0x07, 0x80,
+  0xFE, 0x41, 0x07, 0x80, 0xFE, 0x41, 0x07, 0x80, 0xFE, 0x41, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x41, 0x80, 0xFE, 0x03, 0x45,
+  0x80, 0xD1, 0x03, 0x41, 0x84, 0xFE, 0xFD, 0xF9, 0xCC, 0x30, 0x03, 0x85, 0x89, 0xF6, 0xE5, 0xA4,
+  0x4D, 0x05, 0x04, 0x42, 0x80, 0xF7, 0x43, 0x83, 0xEC, 0x98, 0x3D, 0x01, 0x01, 0x4A, 0x82, 0xE1,
+  0x87, 0x2D, 0x45, 0x82, 0x2E, 0x8A, 0xE3, 0x4A, 0x01, 0x83, 0x02, 0x42, 0x9E, 0xF1, 0x43, 0x80,
+  0xF6, 0x42, 0x04, 0x85, 0x08, 0x55, 0xAB, 0xE8, 0xF6, 0x89, 0x1B, 0x85, 0x89, 0xF6, 0xE5, 0xA4,
+  0x4D, 0x05, 0x04, 0x42, 0x80, 0xF7, 0x43, 0x83, 0xEC, 0x98, 0x3D, 0x01, 0x01, 0x4A, 0x82, 0xE1,
+  0x87, 0x2D, 0x45, 0x82, 0x2E, 0x8A, 0xE3, 0x4A, 0x01, 0x83, 0x02, 0x42, 0x9E, 0xF1, 0x43, 0x80,
+  0xF6, 0x42, 0x04, 0x85, 0x08, 0x55, 0xAB, 0xE8, 0xF6, 0x89, 0x07, 0x82, 0x20, 0xDF, 0x97, 0x0A,
+  0x82, 0x61, 0xFF, 0xC0, 0x0A, 0x82, 0xA1, 0xFF, 0x82, 0x0A, 0x82, 0xE0, 0xFF, 0x43, 0x09, 0x83,
+  0x20, 0xFF, 0xFA, 0x0A, 0x09, 0x82, 0x61, 0xFF, 0xC5, 0x0A, 0x82, 0xA0, 0xFF, 0x87, 0x03, 0x5B,
+  0x05, 0x82, 0x89, 0xFF, 0x8B, 0x0A, 0x82, 0xC9, 0xFF, 0x4A, 0x09, 0x83, 0x0E, 0xFC, 0xFC, 0x0D,
+  0x09, 0x82, 0x4B, 0xFF, 0xC8, 0x0A, 0x82, 0x8C, 0xFF, 0x88, 0x05, 0x5B, 0x03, 0x82, 0x88, 0xFF,
+  0xA3, 0x0A, 0x82, 0xC6, 0xFF, 0x62, 0x09, 0x83, 0x0A, 0xFA, 0xFF, 0x22, 0x09, 0x82, 0x44, 0xFF,
+  0xE1, 0x0A, 0x82, 0x83, 0xFF, 0xA1, 0x0A, 0x82, 0xC1, 0xFF, 0x60, 0x0A, 0x82, 0x98, 0xE0, 0x20,
+  0x07, 0x07, 0x81, 0x13, 0xA8, 0x06, 0x82, 0x4E, 0xE7, 0xFF, 0x04, 0x84, 0x0F, 0xA0, 0xFF, 0xED,
+  0x58, 0x03, 0x84, 0x45, 0xE3, 0xFF, 0xB7, 0x1A, 0x02, 0x84, 0x0C, 0x97, 0xFF, 0xF4, 0x69, 0x03,
+  0x84, 0x3E, 0xDD, 0xFF, 0xC5, 0x23, 0x03, 0x84, 0x8E, 0xFD, 0xF9, 0x79, 0x02, 0x04, 0x41, 0x80,
+  0x5D, 0x06, 0x84, 0x97, 0xFF, 0xF9, 0x77, 0x02, 0x05, 0x84, 0x47, 0xE4, 0xFF, 0xC4, 0x23, 0x05,
+  0x84, 0x10, 0xA4, 0xFF, 0xF4, 0x67, 0x06, 0x84, 0x53, 0xEB, 0xFF, 0xB6, 0x19, 0x05, 0x84, 0x17,
+  0xB1, 0xFF, 0xED, 0x57, 0x06, 0x82, 0x60, 0xF1, 0xFF, 0x07, 0x81, 0x1E, 0xBD, 0x09, 0x53, 0x81,
+  0xBC, 0x1D, 0x07, 0x40, 0x81, 0xF0, 0x5E, 0x06, 0x84, 0x58, 0xEE, 0xFF, 0xAD, 0x15, 0x05, 0x84,
+  0x1A, 0xB7, 0xFF, 0xE9, 0x4E, 0x06, 0x84, 0x69, 0xF4, 0xFF, 0x9F, 0x0E, 0x05, 0x84, 0x23, 0xC5,
+  0xFF, 0xE0, 0x40, 0x05, 0x84, 0x03, 0x79, 0xF9, 0xFE, 0x8F, 0x06, 0x80, 0x5D, 0x41, 0x04, 0x84,
+  0x02, 0x77, 0xF9, 0xFE, 0x97, 0x03, 0x84, 0x23, 0xC4, 0xFF, 0xE1, 0x44, 0x03, 0x84, 0x67, 0xF4,
+  0xFF, 0x9D, 0x0E, 0x02, 0x84, 0x19, 0xB7, 0xFF, 0xE5, 0x4A, 0x03, 0x84, 0x57, 0xED, 0xFF, 0xA3,
+  0x10, 0x04, 0x40, 0x81, 0xE8, 0x50, 0x06, 0x81, 0xAA, 0x14, 0x11, 0x53, 0x05, 0x82, 0x84, 0xFF,
+  0x8A, 0x0A, 0x84, 0x2E, 0xFA, 0xFF, 0xFC, 0x33, 0x08, 0x81, 0x03, 0xCB, 0x42, 0x81, 0xD0, 0x04,
+  0x07, 0x86, 0x76, 0xFF, 0xFD, 0x6B, 0xFD, 0xFF, 0x7A, 0x06, 0x88, 0x24, 0xF6, 0xFF, 0x99, 0x00,
+  0x9A, 0xFF, 0xF8, 0x27, 0x04, 0x8A, 0x01, 0xC0, 0xFF, 0xEC, 0x13, 0x00, 0x13, 0xED, 0xFF, 0xC3,
+  0x01, 0x03, 0x80, 0x68, 0x41, 0x80, 0x66, 0x02, 0x80, 0x67, 0x41, 0x80, 0x6A, 0x02, 0x84, 0x1C,
+  0xF1, 0xFF, 0xCA, 0x02, 0x02, 0x84, 0x02, 0xCB, 0xFF, 0xF2, 0x1D, 0x01, 0x83, 0xB3, 0xFF, 0xFD,
+  0x35, 0x04, 0x85, 0x35, 0xFD, 0xFF, 0xB4, 0x00, 0x5A, 0x41, 0x80, 0x99, 0x06, 0x80, 0x9A, 0x41,
+  0x81, 0x5A, 0xD6, 0x41, 0x80, 0x26, 0x06, 0x80, 0x26, 0x41, 0x81, 0xD6, 0x5A, 0x41, 0x80, 0x99,
+  0x06, 0x80, 0x9A, 0x41, 0x85, 0x5A, 0x00, 0xB3, 0xFF, 0xFD, 0x34, 0x04, 0x83, 0x35, 0xFD, 0xFF,
+  0xB5, 0x01, 0x84, 0x1C, 0xF1, 0xFF, 0xCA, 0x02, 0x02, 0x84, 0x02, 0xCA, 0xFF, 0xF2, 0x1D, 0x02,
+  0x80, 0x68, 0x41, 0x80, 0x66, 0x02, 0x80, 0x67, 0x41, 0x80, 0x6A, 0x03, 0x8A, 0x01, 0xC0, 0xFF,
+  0xEC, 0x12, 0x00, 0x13, 0xEC, 0xFF, 0xC3, 0x01, 0x04, 0x88, 0x25, 0xF6, 0xFF, 0x99, 0x00, 0x9A,
+  0xFF, 0xF8, 0x27, 0x06, 0x86, 0x76, 0xFF, 0xFD, 0x6A, 0xFD, 0xFF, 0x7A, 0x07, 0x81, 0x03, 0xCC,
+  0x42, 0x81, 0xD0, 0x04, 0x08, 0x84, 0x2E, 0xFA, 0xFF, 0xFC, 0x33, 0x0A, 0x82, 0x83, 0xFF, 0x8A,
+  0x05, 0x01, 0x82, 0x43, 0xD9, 0xFD, 0x45, 0x82, 0xFD, 0xD9, 0x43, 0x01, 0x80, 0xD9, 0x49, 0x80,
+  0xD9, 0x01, 0x80, 0xFD, 0x41, 0x05, 0x41, 0x80, 0xFD, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05,
+  0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x0A,
+  0x42, 0x0A, 0x42, 0x0A, 0x42, 0x08, 0x5B, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01,
+  0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01,
+  0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01,
+  0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01,
+  0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x02,
+  0x82, 0x43, 0xD9, 0xFD, 0x48, 0x02, 0x80, 0xD9, 0x4A, 0x02, 0x80, 0xFD, 0x41, 0x05, 0x42, 0x02,
+  0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02,
+  0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02,
+  0x42, 0x05, 0x42, 0x80, 0x50, 0x47, 0x02, 0x42, 0x80, 0x50, 0x47, 0x02, 0x42, 0x02, 0x42, 0x05,
+  0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05,
+  0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05,
+  0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05,
+  0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05,
+  0x42, 0x02, 0x42, 0x05, 0x42, 0x00, 0x00, 0x00,
+};
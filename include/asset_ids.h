@@ -0,0 +1,28 @@
+// Generated by pack_assets.py - do not edit.
+#pragma once
+
+#include <stdint.h>
+
+enum AssetId : uint8_t {
+  ASSET_ICON_01D,  // 24x24 icon, 1152 -> 91 bytes
+  ASSET_ICON_01N,  // 24x24 icon, 1152 -> 91 bytes
+  ASSET_ICON_02D,  // 24x24 icon, 1152 -> 100 bytes
+  ASSET_ICON_02N,  // 24x24 icon, 1152 -> 100 bytes
+  ASSET_ICON_03D,  // 24x24 icon, 1152 -> 48 bytes
+  ASSET_ICON_03N,  // 24x24 icon, 1152 -> 48 bytes
+  ASSET_ICON_04D,  // 24x24 icon, 1152 -> 48 bytes
+  ASSET_ICON_04N,  // 24x24 icon, 1152 -> 48 bytes
+  ASSET_ICON_09D,  // 24x24 icon, 1152 -> 157 bytes
+  ASSET_ICON_09N,  // 24x24 icon, 1152 -> 157 bytes
+  ASSET_ICON_10D,  // 24x24 icon, 1152 -> 103 bytes
+  ASSET_ICON_10N,  // 24x24 icon, 1152 -> 103 bytes
+  ASSET_ICON_11D,  // 24x24 icon, 1152 -> 96 bytes
+  ASSET_ICON_11N,  // 24x24 icon, 1152 -> 96 bytes
+  ASSET_ICON_13D,  // 24x24 icon, 1152 -> 235 bytes
+  ASSET_ICON_13N,  // 24x24 icon, 1152 -> 235 bytes
+  ASSET_ICON_50D,  // 24x24 icon, 1152 -> 37 bytes
+  ASSET_ICON_50N,  // 24x24 icon, 1152 -> 37 bytes
+  ASSET_FONT_MIDLE,  // 30 px font, 37945 -> 21696 bytes (2804 of them glyph table)
+  ASSET_FONT_TINY,  // 42 px font, 76094 -> 31653 bytes (2804 of them glyph table)
+  ASSET_COUNT
+};
@@ -1,1472 +0,0 @@
-const uint8_t font18[] PROGMEM = {0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 
-0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xED, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x53, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x61, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x92, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC6, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC7, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xD9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDA, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDB, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xDD, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA9, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x19, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1D, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x21, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x26, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x39, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3A, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFD, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xAC, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x21, 0x22, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x22, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1A, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2B, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x22, 0x48, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x60, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x64, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x65, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x25, 0xCA, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x01, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x02, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x14, 0x06, 0xFF, 0xFF, 0x0D, 0x00, 0xFF, 0xFF, 0x07, 
-0x00, 0xF9, 0xFF, 0x01, 0x00, 0xF3, 0xFA, 0x00, 0x00, 0xEC, 0xF3, 0x00, 0x00, 0xE6, 0xED, 0x00, 
-0x00, 0xDF, 0xE6, 0x00, 0x00, 0xD9, 0xE0, 0x00, 0x00, 0xD2, 0xD9, 0x00, 0x00, 0xCB, 0xD3, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0xF2, 0x00, 0xF4, 
-0xF3, 0xDB, 0xD9, 0x00, 0xDD, 0xDB, 0xC2, 0xC0, 0x00, 0xC5, 0xC3, 0xA9, 0xA8, 0x00, 0xAC, 0xAB, 
-0x00, 0x00, 0x00, 0x20, 0xFF, 0xDF, 0x20, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x9F, 0x62, 
-0xFF, 0x9B, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x5F, 0xA3, 0xFF, 0x59, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x39, 
-0xFF, 0xC6, 0x39, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x69, 0xFF, 0x95, 0x69, 0xFF, 0x93, 0x00, 0x00, 
-0x00, 0x99, 0xFF, 0x64, 0x99, 0xFF, 0x63, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x34, 0xC8, 0xFF, 0x33, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x5D, 0xFF, 0x9F, 0x61, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0x5F, 
-0xA1, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x1F, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0x84, 0x00, 0x00, 0x4E, 0xEE, 0xFF, 0xFF, 0xEE, 0x4F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x44, 0x00, 
-0x00, 0x00, 0xAE, 0xFF, 0xF6, 0x42, 0x00, 0x00, 0x07, 0xB1, 0xFF, 0xF5, 0x40, 0x00, 0x00, 0x04, 
-0xA6, 0xFF, 0xF5, 0x3E, 0x00, 0x00, 0x02, 0x9A, 0xFF, 0xE4, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xE0, 0x4F, 0xEE, 0xFF, 0xFF, 0xED, 0x4C, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x5D, 0xE7, 
-0xE7, 0x5C, 0x00, 0x00, 0x00, 0x41, 0xDC, 0x00, 0xE8, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0xC3, 
-0x5E, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x46, 0xD9, 0x03, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0xC7, 0x59, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x4B, 0xD5, 0x02, 0x00, 0x00, 
-0xE8, 0x00, 0x00, 0xE7, 0x00, 0xCC, 0x54, 0x00, 0x00, 0x00, 0x5D, 0xE8, 0xE8, 0x5D, 0x4F, 0xD0, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x4F, 0x5D, 0xE7, 0xE7, 0x5C, 0x00, 0x00, 
-0x00, 0x54, 0xCC, 0x00, 0xE8, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x02, 0xD3, 0x4A, 0x00, 0xFF, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0x59, 0xC8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xD7, 0x45, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x5D, 0xC3, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xE7, 
-0x00, 0xDB, 0x41, 0x00, 0x00, 0x00, 0x5D, 0xE8, 0xE8, 0x5D, 0x2F, 0xCE, 0xFF, 0xFF, 0xFF, 0xD1, 
-0x34, 0x00, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0xF7, 0xFF, 0x10, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xF8, 0xFF, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0x10, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xCD, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x97, 0xF9, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x1B, 0x98, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xFF, 0x52, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF4, 0xF2, 0xDB, 0xD9, 0xC2, 0xC0, 
-0xA9, 0xA8, 0x00, 0x3B, 0xFF, 0xCF, 0x00, 0xB2, 0xFF, 0x59, 0x15, 0xFC, 0xEF, 0x05, 0x64, 0xFF, 
-0xA3, 0x00, 0x9F, 0xFF, 0x65, 0x00, 0xCE, 0xFF, 0x35, 0x00, 0xE9, 0xFF, 0x17, 0x00, 0xF8, 0xFF, 
-0x07, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0xE9, 0xFF, 0x17, 0x00, 0xCE, 0xFF, 0x35, 0x00, 0x9F, 0xFF, 
-0x65, 0x00, 0x64, 0xFF, 0xA3, 0x00, 0x16, 0xFD, 0xEF, 0x05, 0x00, 0xB3, 0xFF, 0x59, 0x00, 0x3C, 
-0xFF, 0xCE, 0xCF, 0xFF, 0x3B, 0x00, 0x59, 0xFF, 0xB2, 0x00, 0x06, 0xF0, 0xFC, 0x15, 0x00, 0xA4, 
-0xFF, 0x63, 0x00, 0x66, 0xFF, 0x9E, 0x00, 0x35, 0xFF, 0xCD, 0x00, 0x18, 0xFF, 0xE8, 0x00, 0x08, 
-0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF7, 0x00, 0x18, 0xFF, 0xE8, 0x00, 0x35, 0xFF, 0xCD, 0x00, 0x66, 
-0xFF, 0x9E, 0x00, 0xA4, 0xFF, 0x63, 0x06, 0xF0, 0xFD, 0x15, 0x59, 0xFF, 0xB2, 0x00, 0xCF, 0xFF, 
-0x3B, 0x00, 0x00, 0x00, 0xF5, 0xF6, 0x00, 0x00, 0x92, 0x40, 0xDE, 0xE5, 0x3C, 0x90, 0xC3, 0xFC, 
-0xF5, 0xF7, 0xFA, 0xC3, 0x07, 0xC9, 0xFF, 0xFF, 0xCE, 0x08, 0xC3, 0xFB, 0xF4, 0xF6, 0xF9, 0xC3, 
-0x92, 0x3D, 0xDF, 0xE5, 0x39, 0x91, 0x00, 0x00, 0xF5, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xFF, 0x9F, 
-0xFF, 0x5F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 
-0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFA, 0xEF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 
-0x8B, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xAD, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xCF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xAD, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xEA, 0x08, 0x00, 
-0x00, 0x00, 0x00, 0x8B, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xEE, 0xFA, 0x1A, 0x00, 0x00, 
-0x00, 0x00, 0x68, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0x37, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x33, 0xD0, 0xFF, 0xFF, 0xD1, 0x34, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 
-0x35, 0xD3, 0xFF, 0xFF, 0xD3, 0x35, 0x03, 0xE7, 0xFF, 0x47, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0xF4, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x24, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xD1, 
-0x04, 0x00, 0x00, 0x0D, 0xE5, 0xFE, 0x3A, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x9C, 0x00, 0x00, 0x00, 
-0x2F, 0xFC, 0xEC, 0x13, 0x00, 0x00, 0x01, 0xC6, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xC5, 
-0x01, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x33, 0xD0, 0xFF, 0xFF, 0xD1, 0x34, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x17, 0xFF, 0xC6, 
-0x00, 0x10, 0x85, 0xF4, 0xD0, 0x20, 0x00, 0xDB, 0xFF, 0xDF, 0x0E, 0x00, 0x00, 0x12, 0x96, 0xFC, 
-0xD3, 0x24, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xCC, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 
-0x35, 0xD3, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 
-0x1C, 0xFE, 0xE6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xCD, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0xFF, 0x79, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xD9, 0xFE, 0x1E, 0x00, 0xFF, 0xFF, 0x00, 0x33, 0xFF, 
-0xC1, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0x65, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xE3, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 0x35, 0x36, 0xD4, 0xFF, 0xFF, 0xD0, 0x33, 
-0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD1, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x2C, 0xCB, 0xFF, 0xFF, 0xD3, 0x35, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x00, 
-0x20, 0xFF, 0xB7, 0xFF, 0xFF, 0x00, 0x00, 0x61, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 
-0x3E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF9, 0x08, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xC5, 0x00, 0x00, 
-0x00, 0x00, 0x61, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 
-0xE0, 0xFE, 0x11, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x97, 
-0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1E, 0x00, 0x00, 
-0x33, 0xCF, 0xFF, 0xFF, 0xD1, 0x34, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x0C, 0x04, 
-0xFF, 0xFF, 0xFC, 0xFF, 0x0C, 0x04, 0xFF, 0xFC, 0xDC, 0xFF, 0x0C, 0x04, 0xFF, 0xDC, 0x67, 0xFF, 
-0xA0, 0x9D, 0xFF, 0x67, 0x00, 0xC5, 0xFF, 0xFF, 0xC5, 0x00, 0x6D, 0xFF, 0xB6, 0xB6, 0xFF, 0x6A, 
-0xE0, 0xFF, 0x01, 0x02, 0xFF, 0xDE, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 
-0xFF, 0xFF, 0xD3, 0x35, 0x38, 0xD7, 0xFF, 0xFF, 0xD1, 0x34, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xD8, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xD4, 0xFF, 0x7F, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x06, 0x99, 0x00, 
-0x00, 0x19, 0xC6, 0xFF, 0x00, 0x39, 0xE6, 0xFB, 0x6A, 0x66, 0xF9, 0xEE, 0x44, 0x00, 0xFF, 0xFF, 
-0x4C, 0x00, 0x00, 0x68, 0xFA, 0xEE, 0x43, 0x00, 0x00, 0x3E, 0xEA, 0xFB, 0x6A, 0x00, 0x00, 0x1F, 
-0xD0, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x0C, 0x00, 0x00, 0x00, 
-0xFF, 0xD2, 0x20, 0x00, 0x00, 0x6B, 0xFB, 0xEB, 0x3F, 0x00, 0x00, 0x44, 0xEF, 0xFA, 0x69, 0x00, 
-0x00, 0x4D, 0xFF, 0xFF, 0x00, 0x44, 0xEE, 0xFA, 0x69, 0x6A, 0xFB, 0xEB, 0x40, 0x00, 0xFF, 0xD2, 
-0x21, 0x00, 0x00, 0xAF, 0x0C, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x0C, 0xFF, 0xEB, 0x00, 0x00, 0x07, 0xBC, 0xFF, 0x61, 0x00, 0x03, 0xAD, 0xFF, 
-0x84, 0x00, 0x00, 0x91, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x28, 0xAD, 0x46, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xBB, 0x08, 0xD8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xE7, 0x08, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x35, 0xD2, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xD2, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xD3, 0x00, 0xFF, 0x00, 0x00, 0xD1, 0xFF, 0x00, 0x00, 0x35, 0xD3, 0xFF, 0xFF, 0xD2, 0x34, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x39, 
-0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xA3, 
-0x00, 0x00, 0x00, 0x00, 0xC0, 0xF7, 0xF7, 0xD7, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xCC, 0xCE, 0xFE, 
-0x0E, 0x00, 0x00, 0x2E, 0xFF, 0x9E, 0xA0, 0xFF, 0x40, 0x00, 0x00, 0x65, 0xFF, 0x70, 0x73, 0xFF, 
-0x75, 0x00, 0x00, 0x9C, 0xFF, 0x42, 0x46, 0xFF, 0xA9, 0x00, 0x00, 0xD3, 0xFF, 0x14, 0x18, 0xFF, 
-0xDE, 0x00, 0x0C, 0xFD, 0xE6, 0x00, 0x00, 0xEA, 0xFF, 0x13, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x47, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xAF, 0xFF, 0x5C, 0x00, 0x00, 0x5E, 
-0xFF, 0xB0, 0xE6, 0xFF, 0x1E, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 
-0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0xFF, 0xEB, 0xFF, 
-0xFF, 0x00, 0x00, 0x14, 0xFF, 0xEC, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0xFF, 0xE1, 0xFF, 0xFF, 0x00, 
-0x00, 0x6C, 0xFF, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD8, 0x15, 0xFF, 0xFF, 0x00, 0x00, 0x4D, 0xFF, 0xAB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xEF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0x35, 0xD2, 0xFF, 0xFF, 
-0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE4, 0x76, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0xFF, 0xFF, 0x00, 0x01, 
-0x46, 0xFF, 0xE4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0x48, 
-0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x79, 0x02, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x33, 0xD0, 0xFF, 0xFF, 
-0xFF, 0xD1, 0x34, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0xFF, 0xFF, 
-0x00, 0x00, 0x43, 0xFF, 0xC4, 0xFF, 0xFF, 0x00, 0x00, 0xCA, 0xFE, 0x35, 0xFF, 0xFF, 0x00, 0x52, 
-0xFF, 0xA3, 0x00, 0xFF, 0xFF, 0x03, 0xD5, 0xF5, 0x1C, 0x00, 0xFF, 0xFF, 0x60, 0xFF, 0x81, 0x00, 
-0x00, 0xFF, 0xFF, 0xE0, 0xE5, 0x0B, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xF0, 0xD8, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0x89, 0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0x19, 
-0xF9, 0xD1, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x9D, 0xFF, 0x4E, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFE, 
-0xC9, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xB1, 0xFF, 0x46, 0xFF, 0xFF, 0x00, 0x00, 0x3B, 0xFF, 0xC2, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x04, 0x00, 0x00, 0x00, 0x04, 0xEA, 0xFF, 0xFF, 
-0xFF, 0x4D, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0xAC, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xF8, 0x10, 0x00, 0x11, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0x00, 0x68, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFA, 0xC5, 0x00, 0xC6, 0xFB, 0xF6, 0xFF, 0xFF, 0xFC, 0xBD, 0xFF, 
-0x48, 0xFF, 0xC0, 0xFB, 0xFF, 0xFF, 0xFF, 0x70, 0xFF, 0xE4, 0xFF, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x23, 0xFF, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xD7, 0xFF, 0xDA, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x8B, 0xFF, 0x8E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0x42, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF2, 0x0A, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xF4, 0xE6, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xA1, 0xFF, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xB0, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0xDE, 
-0xFB, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x0A, 0xF2, 0xFF, 0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xD0, 0xFF, 0xFF, 0xFF, 0xD1, 
-0x34, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xA7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0x52, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xA2, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 
-0x47, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE9, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF6, 
-0x7D, 0x00, 0xFF, 0xFF, 0x00, 0xED, 0xFE, 0x19, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA4, 0xFF, 0x67, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x58, 0xFF, 0xB7, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x10, 0xFB, 0xF9, 
-0x0E, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x57, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x73, 0xFF, 
-0xA7, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x26, 0xFF, 0xF1, 0x06, 0x47, 0xD8, 0xFF, 0xFF, 0xFF, 0xD8, 
-0x47, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x58, 0xF8, 0xF1, 
-0x4E, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE4, 0xFE, 0x80, 0x01, 0x00, 0x00, 0x00, 0x18, 0xC4, 0xFF, 
-0xB1, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x99, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x48, 0xD9, 0xFF, 0xFF, 0xFF, 0xD9, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 
-0xD3, 0x35, 0xEE, 0xFF, 0x0B, 0x09, 0xFF, 0xED, 0xC9, 0xFF, 0x21, 0x1D, 0xFF, 0xC8, 0xA5, 0xFF, 
-0x38, 0x30, 0xFF, 0xA4, 0x80, 0xFF, 0x4E, 0x43, 0xFF, 0x7F, 0x5C, 0xFF, 0x65, 0x57, 0xFF, 0x5B, 
-0x37, 0xFF, 0x7B, 0x6A, 0xFF, 0x36, 0x12, 0xFF, 0x92, 0x7D, 0xFF, 0x12, 0x00, 0xEE, 0xA8, 0x90, 
-0xED, 0x00, 0x00, 0xC9, 0xBF, 0xA3, 0xC8, 0x00, 0x00, 0xA5, 0xD8, 0xBB, 0xA4, 0x00, 0x00, 0x80, 
-0xFA, 0xF3, 0x7F, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0x37, 0xFF, 0xFF, 0x36, 0x00, 
-0x00, 0x12, 0xFF, 0xFF, 0x12, 0x00, 0x2C, 0xFF, 0xFF, 0x0A, 0x0A, 0xFF, 0xFF, 0x0A, 0x0A, 0xFF, 
-0xFF, 0x2A, 0x06, 0xFC, 0xFF, 0x1E, 0x1F, 0xFF, 0xFF, 0x1E, 0x1F, 0xFF, 0xFB, 0x06, 0x00, 0xD9, 
-0xFF, 0x32, 0x33, 0xFF, 0xFF, 0x32, 0x33, 0xFF, 0xD8, 0x00, 0x00, 0xB0, 0xFF, 0x46, 0x47, 0xFF, 
-0xFF, 0x46, 0x47, 0xFF, 0xAF, 0x00, 0x00, 0x87, 0xFF, 0x5B, 0x5C, 0xFC, 0xFA, 0x5B, 0x5C, 0xFF, 
-0x86, 0x00, 0x00, 0x5E, 0xFF, 0x6F, 0x70, 0xEF, 0xEF, 0x6F, 0x70, 0xFF, 0x5D, 0x00, 0x00, 0x35, 
-0xFF, 0x83, 0x84, 0xD4, 0xD5, 0x83, 0x84, 0xFF, 0x34, 0x00, 0x00, 0x0C, 0xFF, 0x98, 0x99, 0xB8, 
-0xB9, 0x98, 0x99, 0xFE, 0x0C, 0x00, 0x00, 0x00, 0xE2, 0xB0, 0xAF, 0x9B, 0x9C, 0xB0, 0xAF, 0xE1, 
-0x00, 0x00, 0x00, 0x00, 0xB9, 0xEE, 0xEA, 0x7F, 0x80, 0xED, 0xEA, 0xB8, 0x00, 0x00, 0x00, 0x00, 
-0x90, 0xFF, 0xFF, 0x63, 0x64, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x67, 0xFF, 0xFF, 0x46, 
-0x47, 0xFF, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x2A, 0x2B, 0xFF, 0xFF, 0x3D, 
-0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 0xFF, 0x0E, 0x0E, 0xFF, 0xFF, 0x14, 0x00, 0x00, 0xD4, 0xFF, 
-0x2A, 0x00, 0x29, 0xFF, 0xD8, 0x79, 0xFF, 0x7F, 0x00, 0x7D, 0xFF, 0x7D, 0x1F, 0xFE, 0xD4, 0x00, 
-0xD0, 0xFF, 0x22, 0x00, 0xC4, 0xFF, 0x4D, 0xFF, 0xC5, 0x00, 0x00, 0x69, 0xFF, 0xE5, 0xFF, 0x69, 
-0x00, 0x00, 0x13, 0xFA, 0xFF, 0xFA, 0x13, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xB5, 0x00, 0x00, 0x00, 
-0x00, 0xCF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x26, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x7E, 0xFF, 
-0xBE, 0xFF, 0x7F, 0x00, 0x00, 0xD5, 0xFC, 0x28, 0xFD, 0xD5, 0x00, 0x2D, 0xFF, 0xC3, 0x00, 0xC4, 
-0xFF, 0x2A, 0x84, 0xFF, 0x75, 0x00, 0x76, 0xFF, 0x7F, 0xDB, 0xFF, 0x27, 0x00, 0x27, 0xFF, 0xD5, 
-0xDB, 0xFF, 0x2A, 0x00, 0x00, 0x29, 0xFF, 0xDA, 0x84, 0xFF, 0x7E, 0x00, 0x00, 0x7C, 0xFF, 0x83, 
-0x2D, 0xFF, 0xD2, 0x00, 0x00, 0xCF, 0xFF, 0x2C, 0x00, 0xD5, 0xFF, 0x26, 0x22, 0xFF, 0xD5, 0x00, 
-0x00, 0x7E, 0xFF, 0x7A, 0x75, 0xFF, 0x7D, 0x00, 0x00, 0x26, 0xFF, 0xCF, 0xC8, 0xFF, 0x25, 0x00, 
-0x00, 0x00, 0xCB, 0xFF, 0xFE, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 
-0x00, 0x00, 0x1D, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x2F, 
-0xFF, 0x90, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x00, 0x04, 0xE9, 0xD0, 0x00, 0x00, 0x00, 
-0x4D, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xAC, 0xFA, 0x15, 0x00, 0x00, 0x12, 0xF9, 0xB0, 0x00, 0x00, 
-0x00, 0x6A, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xC9, 0xEA, 0x05, 0x00, 0x00, 0x29, 0xFF, 0x90, 0x00, 
-0x00, 0x00, 0x88, 0xFF, 0x30, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xE7, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 
-0x5D, 0xE8, 0xFF, 0xFF, 0xDB, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x6D, 0x00, 0x00, 0x00, 
-0x49, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x09, 0xF7, 0xF6, 0x08, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0x48, 
-0x00, 0x00, 0x00, 0x6E, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xDB, 0x00, 0x00, 0x00, 0x00, 
-0xDB, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xB6, 0x00, 
-0x00, 0x00, 0x09, 0xF7, 0xF6, 0x08, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x6E, 
-0xFF, 0x91, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xDB, 0xFF, 0xFF, 0xE7, 0x5C, 0xFF, 0xFF, 0xFF, 0xE7, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE8, 0x5D, 0x00, 0x00, 0x4E, 0xFF, 0x4C, 0x00, 0x00, 0x00, 
-0x0A, 0xE0, 0xFF, 0xDD, 0x08, 0x00, 0x00, 0x89, 0xFF, 0x8F, 0xFF, 0x7F, 0x00, 0x2B, 0xFA, 0xB2, 
-0x00, 0xB5, 0xF7, 0x21, 0xC2, 0xF9, 0x24, 0x00, 0x27, 0xFA, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0xFB, 0xD4, 0x0B, 0x00, 0x3B, 0xE4, 
-0xA7, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x39, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x3B, 0xDB, 0xDF, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xFF, 0xFF, 0xFF, 0xF3, 0xBF, 0x27, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 
-0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 
-0x35, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3A, 
-0xD2, 0xFB, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x71, 0xFF, 0xFF, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 
-0xE6, 0xDD, 0x77, 0xFF, 0xFF, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0x35, 0xD2, 0xFF, 0x00, 
-0xD3, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x4F, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x19, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x47, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 
-0x35, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x30, 0xC7, 0xD8, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0x90, 0x30, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x04, 0x08, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xFF, 0x04, 0x08, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xCE, 
-0x00, 0xFF, 0xCA, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xCA, 0xFF, 0xFF, 0x00, 0xC8, 0xFF, 0x57, 0xFF, 
-0xFF, 0x50, 0xFF, 0xE0, 0x04, 0xFF, 0xFF, 0xD3, 0xFF, 0x72, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 
-0x00, 0xFF, 0xFF, 0xD9, 0xFF, 0x71, 0x00, 0xFF, 0xFF, 0x56, 0xFF, 0xDF, 0x03, 0xFF, 0xFF, 0x01, 
-0xCC, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0x44, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0xCF, 0xE5, 0x40, 0x21, 0xC6, 0xE2, 0x4B, 0xFF, 
-0xFF, 0xE2, 0xFF, 0xFF, 0xDB, 0xEA, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xA8, 0x38, 0xFF, 0xFF, 0xA8, 
-0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x1D, 0xC3, 0xE7, 0x5C, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xA8, 0x38, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x47, 0xDD, 0xFF, 0xFF, 0xDD, 0x47, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xDE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x48, 0xDE, 0xFF, 0xFF, 0xDE, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 
-0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xFB, 0xF6, 0xC1, 
-0x27, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x58, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 
-0x00, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xD8, 0xD1, 0x34, 0xFF, 0xFF, 0xF6, 
-0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xA8, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x34, 0xD1, 0xFF, 
-0xFF, 0xD1, 0x34, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xCC, 
-0xFF, 0x82, 0x13, 0x00, 0x00, 0x16, 0x8C, 0xF4, 0xF4, 0x8D, 0x16, 0x00, 0x00, 0x13, 0x83, 0xFF, 
-0xCD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 
-0xFF, 0xD3, 0x35, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0x00, 0x35, 0xD3, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 
-0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0x15, 0x15, 0xFF, 0xE1, 0xA6, 0xFF, 0x41, 0x42, 0xFF, 
-0xA5, 0x69, 0xFF, 0x6C, 0x6D, 0xFF, 0x68, 0x2D, 0xFF, 0x98, 0x99, 0xFF, 0x2C, 0x01, 0xEE, 0xC3, 
-0xC4, 0xEE, 0x01, 0x00, 0xB4, 0xEE, 0xEF, 0xB3, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0x76, 0x00, 0x00, 
-0x3B, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x06, 0xF7, 0xF7, 0x06, 0x00, 0xE2, 0xFF, 0x13, 0x13, 0xFF, 
-0xFF, 0x13, 0x13, 0xFF, 0xE1, 0xA6, 0xFF, 0x3A, 0x3B, 0xFF, 0xFF, 0x3A, 0x3B, 0xFF, 0xA5, 0x69, 
-0xFF, 0x62, 0x63, 0xFF, 0xFF, 0x62, 0x63, 0xFF, 0x68, 0x2D, 0xFF, 0x89, 0x8A, 0xFF, 0xFF, 0x89, 
-0x8A, 0xFF, 0x2C, 0x01, 0xEE, 0xB0, 0xB1, 0xE2, 0xE6, 0xB0, 0xB1, 0xEE, 0x01, 0x00, 0xB4, 0xD8, 
-0xD9, 0xB0, 0xAD, 0xD8, 0xD9, 0xB3, 0x00, 0x00, 0x77, 0xFA, 0xFB, 0x7D, 0x72, 0xFA, 0xFB, 0x76, 
-0x00, 0x00, 0x3B, 0xFF, 0xFF, 0x4B, 0x38, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x06, 0xF7, 0xFF, 0x19, 
-0x06, 0xF7, 0xF7, 0x06, 0x00, 0xBC, 0xFF, 0x44, 0x00, 0x44, 0xFF, 0xBF, 0x34, 0xFE, 0xCC, 0x02, 
-0xCC, 0xFF, 0x36, 0x00, 0xAA, 0xFF, 0xA8, 0xFF, 0xAB, 0x00, 0x00, 0x25, 0xFB, 0xFF, 0xFB, 0x26, 
-0x00, 0x00, 0x00, 0xBA, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x26, 0xFB, 0xFF, 0xFB, 0x25, 0x00, 0x00, 
-0xAC, 0xFF, 0xBA, 0xFF, 0xA9, 0x00, 0x36, 0xFF, 0xD2, 0x05, 0xD2, 0xFE, 0x33, 0xBF, 0xFF, 0x47, 
-0x00, 0x47, 0xFF, 0xBB, 0xE4, 0xFF, 0x15, 0x15, 0xFF, 0xE2, 0xAB, 0xFF, 0x3F, 0x40, 0xFF, 0xA9, 
-0x72, 0xFF, 0x6A, 0x6B, 0xFF, 0x70, 0x39, 0xFF, 0x94, 0x96, 0xFF, 0x37, 0x07, 0xF9, 0xBF, 0xC0, 
-0xF8, 0x06, 0x00, 0xC7, 0xEA, 0xEB, 0xC5, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x55, 
-0xFF, 0xFF, 0x53, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x20, 0xFF, 0xDE, 0x00, 0x00, 
-0x00, 0x61, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0xA2, 0xFF, 
-0x8A, 0x00, 0x20, 0xFB, 0xF7, 0x17, 0x00, 0x96, 0xFF, 0x93, 0x00, 0x18, 0xF7, 0xFA, 0x1E, 0x00, 
-0x8B, 0xFF, 0x9D, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x26, 0xC7, 0xFE, 0xFF, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFA, 0xFF, 0x2B, 
-0x03, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xF8, 0x00, 0x00, 0x32, 0xEB, 0xF9, 0x6A, 0x00, 0x00, 0xE1, 
-0xFF, 0x59, 0x00, 0x00, 0x00, 0x34, 0xEE, 0xF5, 0x59, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xF5, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x30, 0x03, 0x00, 
-0x00, 0xB8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x23, 0xC6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC7, 
-0x26, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x03, 0x2B, 0xFF, 0xFA, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xF9, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x6C, 0xF9, 0xEA, 0x32, 0x00, 0x00, 0x00, 
-0x5A, 0xFF, 0xE1, 0x00, 0x00, 0x5D, 0xF6, 0xEE, 0x34, 0x00, 0x00, 0xF6, 0xFF, 0x30, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x31, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xB8, 0x00, 0x00, 0xFF, 0xFE, 0xC6, 0x23, 0x00, 0x00, 0xCF, 0xEA, 0xB4, 0x6C, 0x24, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x6D, 0xB5, 0xEB, 0xBF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xD2, 0x00, 0x00, 
-0xD2, 0xD9, 0x00, 0x00, 0xD9, 0xE0, 0x00, 0x00, 0xDF, 0xE6, 0x00, 0x00, 0xE6, 0xED, 0x00, 0x00, 
-0xEC, 0xF3, 0x00, 0x00, 0xF3, 0xFA, 0x00, 0x00, 0xF9, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0x07, 0x06, 
-0xFF, 0xFF, 0x0D, 0x0D, 0xFF, 0xFF, 0x14, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0x3D, 0xC9, 0xFF, 0xC9, 0x3D, 0xE1, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xFF, 0xE5, 0x4D, 0xDB, 0xFF, 0xDC, 0x4E, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x35, 0xD2, 
-0xFF, 0xFF, 0xC9, 0x2C, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 
-0xAB, 0x02, 0x00, 0x00, 0x02, 0xAB, 0x1F, 0xA5, 0xFF, 0x6C, 0x00, 0x00, 0x6D, 0xFF, 0xA6, 0x00, 
-0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 
-0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0x00, 0xA5, 0xFF, 0x6C, 0x00, 0x00, 0x71, 0xFF, 0xA4, 0x20, 
-0xAC, 0x02, 0x00, 0x00, 0x03, 0xAD, 0x1F, 0xD9, 0xFF, 0x2B, 0x00, 0x00, 0x2B, 0xFF, 0xDB, 0x85, 
-0xFF, 0x81, 0x00, 0x00, 0x82, 0xFF, 0x85, 0x31, 0xFF, 0xD6, 0x00, 0x00, 0xD7, 0xFF, 0x2F, 0x00, 
-0xDC, 0xFF, 0x2D, 0x2E, 0xFF, 0xD9, 0x00, 0x00, 0x87, 0xFF, 0x83, 0x84, 0xFF, 0x83, 0x00, 0xFF, 
-0xFF, 0xFF, 0xD8, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0x5C, 
-0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE6, 0xFF, 
-0xD0, 0x70, 0x16, 0x00, 0x00, 0x24, 0xC7, 0xFF, 0xFF, 0xFB, 0xB2, 0x3D, 0x9F, 0xFF, 0xB3, 0x62, 
-0xAE, 0xFF, 0xF2, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xF9, 0xEC, 0xFF, 0xAB, 0x64, 0xB0, 0xFF, 0x99, 0x35, 0xAF, 0xFA, 0xFF, 0xFF, 0xC7, 0x25, 0x00, 
-0x00, 0x15, 0x70, 0xD0, 0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE7, 0x5D, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0x5D, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 
-0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xE7, 0x5C, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xD2, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x35, 0xD3, 0xFF, 0xD3, 0x35, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0x4C, 
-0xE1, 0xFF, 0xFF, 0xD1, 0x34, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x5B, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 
-0x05, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xD3, 0xF2, 0xCF, 0xF8, 0xF8, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x4C, 0xFF, 0xBE, 0x4C, 0xFF, 0xBE, 0x08, 0xDD, 0xFC, 0x35, 0xDD, 0xFC, 0x2D, 0x7F, 
-0xFF, 0x94, 0x7F, 0xFF, 0x94, 0x00, 0xEE, 0xFF, 0x24, 0xEE, 0xFF, 0x24, 0x00, 0x7F, 0xFF, 0x92, 
-0x7F, 0xFF, 0x92, 0x00, 0x08, 0xDD, 0xFB, 0x31, 0xDD, 0xFB, 0x28, 0x00, 0x4D, 0xFF, 0xB6, 0x4D, 
-0xFF, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 
-0x34, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xC3, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xD0, 0x2A, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x7D, 0x7F, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x2A, 0xD5, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xFF, 0xFF, 0x6F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x6F, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x0C, 0xD6, 0xFB, 0x72, 0xA9, 0xE4, 0x3A, 0x00, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFF, 
-0xFF, 0x4F, 0x10, 0x86, 0xFF, 0xFF, 0xDE, 0xEB, 0x78, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF6, 0x4E, 
-0x07, 0x00, 0x1F, 0x5F, 0xD7, 0xC0, 0xFF, 0xFF, 0xBF, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 
-0xFF, 0xD3, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xFF, 0x4C, 0xB7, 0xFF, 0x4C, 0x00, 0x29, 0xFB, 0xDD, 0x31, 
-0xFB, 0xDD, 0x08, 0x00, 0x93, 0xFF, 0x7E, 0x93, 0xFF, 0x7E, 0x00, 0x25, 0xFF, 0xED, 0x25, 0xFF, 
-0xED, 0x00, 0x95, 0xFF, 0x7E, 0x95, 0xFF, 0x7E, 0x2D, 0xFC, 0xDD, 0x35, 0xFC, 0xDD, 0x08, 0xBE, 
-0xFF, 0x4C, 0xBE, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 
-0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFA, 0xEF, 0x00, 0x00, 0x03, 0xAE, 0xFF, 0x8F, 0x00, 
-0x00, 0x9A, 0xFF, 0xAD, 0x03, 0x00, 0x7C, 0xFF, 0xBC, 0x07, 0x00, 0x00, 0xF3, 0xFF, 0x0C, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0x72, 0xFB, 0xD4, 0x0B, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x3B, 0xE4, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x6E, 
-0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF7, 0xF7, 0xD7, 
-0x00, 0x00, 0x00, 0x03, 0xF4, 0xCC, 0xCE, 0xFE, 0x0E, 0x00, 0x00, 0x2E, 0xFF, 0x9E, 0xA0, 0xFF, 
-0x40, 0x00, 0x00, 0x65, 0xFF, 0x70, 0x73, 0xFF, 0x75, 0x00, 0x00, 0x9C, 0xFF, 0x42, 0x46, 0xFF, 
-0xA9, 0x00, 0x00, 0xD3, 0xFF, 0x14, 0x18, 0xFF, 0xDE, 0x00, 0x0C, 0xFD, 0xE6, 0x00, 0x00, 0xEA, 
-0xFF, 0x13, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x7C, 0xAF, 0xFF, 0x5C, 0x00, 0x00, 0x5E, 0xFF, 0xB0, 0xE6, 0xFF, 0x1E, 0x00, 0x00, 0x1F, 
-0xFF, 0xE5, 0x00, 0x00, 0x00, 0x0C, 0xD6, 0xFB, 0x72, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xE4, 0x3A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x39, 
-0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xA3, 
-0x00, 0x00, 0x00, 0x00, 0xC0, 0xF7, 0xF7, 0xD7, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xCC, 0xCE, 0xFE, 
-0x0E, 0x00, 0x00, 0x2E, 0xFF, 0x9E, 0xA0, 0xFF, 0x40, 0x00, 0x00, 0x65, 0xFF, 0x70, 0x73, 0xFF, 
-0x75, 0x00, 0x00, 0x9C, 0xFF, 0x42, 0x46, 0xFF, 0xA9, 0x00, 0x00, 0xD3, 0xFF, 0x14, 0x18, 0xFF, 
-0xDE, 0x00, 0x0C, 0xFD, 0xE6, 0x00, 0x00, 0xEA, 0xFF, 0x13, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x47, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xAF, 0xFF, 0x5C, 0x00, 0x00, 0x5E, 
-0xFF, 0xB0, 0xE6, 0xFF, 0x1E, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0x00, 0x00, 0x02, 0xA5, 0xFF, 0xA7, 
-0x02, 0x00, 0x00, 0x00, 0x97, 0xD0, 0x49, 0xD3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x6E, 
-0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF7, 0xF7, 0xD7, 
-0x00, 0x00, 0x00, 0x03, 0xF4, 0xCC, 0xCE, 0xFE, 0x0E, 0x00, 0x00, 0x2E, 0xFF, 0x9E, 0xA0, 0xFF, 
-0x40, 0x00, 0x00, 0x65, 0xFF, 0x70, 0x73, 0xFF, 0x75, 0x00, 0x00, 0x9C, 0xFF, 0x42, 0x46, 0xFF, 
-0xA9, 0x00, 0x00, 0xD3, 0xFF, 0x14, 0x18, 0xFF, 0xDE, 0x00, 0x0C, 0xFD, 0xE6, 0x00, 0x00, 0xEA, 
-0xFF, 0x13, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x7C, 0xAF, 0xFF, 0x5C, 0x00, 0x00, 0x5E, 0xFF, 0xB0, 0xE6, 0xFF, 0x1E, 0x00, 0x00, 0x1F, 
-0xFF, 0xE5, 0x00, 0x00, 0x66, 0xE4, 0xE5, 0x68, 0xE9, 0x00, 0x00, 0x00, 0xEC, 0x48, 0xE3, 0xEC, 
-0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x39, 
-0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xA3, 
-0x00, 0x00, 0x00, 0x00, 0xC0, 0xF7, 0xF7, 0xD7, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xCC, 0xCE, 0xFE, 
-0x0E, 0x00, 0x00, 0x2E, 0xFF, 0x9E, 0xA0, 0xFF, 0x40, 0x00, 0x00, 0x65, 0xFF, 0x70, 0x73, 0xFF, 
-0x75, 0x00, 0x00, 0x9C, 0xFF, 0x42, 0x46, 0xFF, 0xA9, 0x00, 0x00, 0xD3, 0xFF, 0x14, 0x18, 0xFF, 
-0xDE, 0x00, 0x0C, 0xFD, 0xE6, 0x00, 0x00, 0xEA, 0xFF, 0x13, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x47, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xAF, 0xFF, 0x5C, 0x00, 0x00, 0x5E, 
-0xFF, 0xB0, 0xE6, 0xFF, 0x1E, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x6E, 
-0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF7, 0xF7, 0xD7, 
-0x00, 0x00, 0x00, 0x03, 0xF4, 0xCC, 0xCE, 0xFE, 0x0E, 0x00, 0x00, 0x2E, 0xFF, 0x9E, 0xA0, 0xFF, 
-0x40, 0x00, 0x00, 0x65, 0xFF, 0x70, 0x73, 0xFF, 0x75, 0x00, 0x00, 0x9C, 0xFF, 0x42, 0x46, 0xFF, 
-0xA9, 0x00, 0x00, 0xD3, 0xFF, 0x14, 0x18, 0xFF, 0xDE, 0x00, 0x0C, 0xFD, 0xE6, 0x00, 0x00, 0xEA, 
-0xFF, 0x13, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x7C, 0xAF, 0xFF, 0x5C, 0x00, 0x00, 0x5E, 0xFF, 0xB0, 0xE6, 0xFF, 0x1E, 0x00, 0x00, 0x1F, 
-0xFF, 0xE5, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x39, 
-0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xA3, 
-0x00, 0x00, 0x00, 0x00, 0xC0, 0xF7, 0xF7, 0xD7, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xCC, 0xCE, 0xFE, 
-0x0E, 0x00, 0x00, 0x2E, 0xFF, 0x9E, 0xA0, 0xFF, 0x40, 0x00, 0x00, 0x65, 0xFF, 0x70, 0x73, 0xFF, 
-0x75, 0x00, 0x00, 0x9C, 0xFF, 0x42, 0x46, 0xFF, 0xA9, 0x00, 0x00, 0xD3, 0xFF, 0x14, 0x18, 0xFF, 
-0xDE, 0x00, 0x0C, 0xFD, 0xE6, 0x00, 0x00, 0xEA, 0xFF, 0x13, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x47, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xAF, 0xFF, 0x5C, 0x00, 0x00, 0x5E, 
-0xFF, 0xB0, 0xE6, 0xFF, 0x1E, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x14, 0xFD, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xA7, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEE, 0xC8, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x7E, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 
-0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xD2, 0xEA, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x1D, 0xFF, 0xA2, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x67, 0xFF, 0x58, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF5, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x9C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x92, 0xFF, 0x5D, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0x1F, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0x00, 0x00, 0xF6, 0x4E, 0x07, 0x00, 0x00, 
-0x00, 0x00, 0x1F, 0x5F, 0xD7, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xBF, 0x00, 0x72, 0xFB, 0xD4, 
-0x0B, 0x00, 0x00, 0x3B, 0xE4, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x0C, 0xD6, 0xFB, 0x72, 0x00, 0x00, 0xA9, 0xE4, 0x3A, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xA5, 0xFF, 0xA7, 0x02, 0x97, 0xD0, 0x49, 
-0xD3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x72, 0xFB, 0xD4, 0x0B, 0x00, 0x3B, 0xE4, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0C, 0xD6, 0xFB, 0x72, 0xA9, 0xE4, 0x3A, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xA5, 0xFF, 0xA7, 0x02, 0x97, 
-0xD0, 0x49, 0xD3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x66, 0xE4, 0xE5, 0x68, 0xE9, 0x00, 0x00, 0xEC, 0x48, 0xE3, 
-0xEC, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x0A, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x26, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xF4, 0xE6, 
-0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0xFF, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xB0, 0xFE, 
-0xFF, 0xFF, 0xFF, 0x01, 0xDE, 0xFB, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0A, 0xF2, 0xFF, 0x00, 0x72, 0xFB, 0xD4, 0x0B, 
-0x00, 0x00, 0x00, 0x00, 0x3B, 0xE4, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 
-0xD3, 0x35, 0x00, 0x00, 0x0C, 0xD6, 0xFB, 0x72, 0x00, 0x00, 0x00, 0xA9, 0xE4, 0x3A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0x02, 0xA5, 0xFF, 0xA7, 0x02, 0x00, 
-0x00, 0x97, 0xD0, 0x49, 0xD3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xD2, 
-0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 
-0x00, 0x66, 0xE4, 0xE5, 0x68, 0xE9, 0x00, 0x00, 0xEC, 0x48, 0xE3, 0xEC, 0x61, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 
-0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 
-0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0x1F, 0xB4, 
-0x14, 0xB6, 0x22, 0xB1, 0xFF, 0xE9, 0xFF, 0xB8, 0x13, 0xE7, 0xFF, 0xEB, 0x15, 0xB5, 0xFF, 0xE9, 
-0xFF, 0xB4, 0x20, 0xB5, 0x14, 0xB5, 0x1F, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xD7, 0x35, 0xD2, 0xFF, 
-0xFF, 0xFF, 0xB8, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xC1, 0xFF, 0xFF, 0xFF, 0xD3, 
-0x35, 0xD9, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFB, 0xD4, 0x0B, 0x00, 0x00, 0x00, 0x00, 
-0x3B, 0xE4, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0x00, 
-0x0C, 0xD6, 0xFB, 0x72, 0x00, 0x00, 0x00, 0xA9, 0xE4, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 
-0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0x02, 0xA5, 0xFF, 0xA7, 0x02, 0x00, 0x00, 0x97, 0xD0, 0x49, 
-0xD3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 
-0xFF, 0xD3, 0x35, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xD6, 0xFB, 0x72, 0x00, 0x00, 0x00, 0x00, 0xA9, 
-0xE4, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFF, 0x2A, 0x00, 0x00, 
-0x29, 0xFF, 0xDA, 0x84, 0xFF, 0x7E, 0x00, 0x00, 0x7C, 0xFF, 0x83, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 
-0xCF, 0xFF, 0x2C, 0x00, 0xD5, 0xFF, 0x26, 0x22, 0xFF, 0xD5, 0x00, 0x00, 0x7E, 0xFF, 0x7A, 0x75, 
-0xFF, 0x7D, 0x00, 0x00, 0x26, 0xFF, 0xCF, 0xC8, 0xFF, 0x25, 0x00, 0x00, 0x00, 0xCB, 0xFF, 0xFE, 
-0xC7, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 
-0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEB, 0x54, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFC, 0xFF, 0xFF, 0x75, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xEA, 0x0F, 0xFF, 0xFF, 
-0x8B, 0xFF, 0xB5, 0xFF, 0xFF, 0x00, 0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0xE8, 
-0x5D, 0x72, 0xFB, 0xD4, 0x0B, 0x00, 0x00, 0x00, 0x3B, 0xE4, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x39, 0xD9, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xD4, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x3B, 0xDB, 0xDF, 0x7C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0C, 0xD6, 0xFB, 0x72, 
-0x00, 0x00, 0x00, 0xA9, 0xE4, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xD2, 
-0xFF, 0xFF, 0xD1, 0x34, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x39, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0xD4, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xD4, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3B, 0xDB, 0xDF, 0x7C, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xA5, 
-0xFF, 0xA7, 0x02, 0x00, 0x97, 0xD0, 0x49, 0xD3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 
-0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x39, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 
-0xDB, 0xDF, 0x7C, 0xFF, 0xFF, 0x00, 0x66, 0xE4, 0xE5, 0x68, 0xE9, 0x00, 0xEC, 0x48, 0xE3, 0xEC, 
-0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x39, 
-0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0xDB, 0xDF, 0x7C, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 
-0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x39, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 
-0xDB, 0xDF, 0x7C, 0xFF, 0xFF, 0x00, 0x93, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x93, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 
-0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x39, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0xDB, 0xDF, 
-0x7C, 0xFF, 0xFF, 0x30, 0xC9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x34, 0xD1, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x5B, 0xE6, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE8, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x03, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xCF, 0x35, 0xD3, 0xE9, 0x8F, 0x7C, 0xE7, 0xFF, 0xFF, 0xD2, 0x33, 0x35, 0xD2, 0xFF, 
-0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 
-0xFF, 0xD3, 0x35, 0x00, 0x00, 0xF6, 0x4E, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x5F, 0xD7, 0x00, 0x00, 
-0xC0, 0xFF, 0xFF, 0xBF, 0x00, 0x72, 0xFB, 0xD4, 0x0B, 0x00, 0x00, 0x00, 0x3B, 0xE4, 0xA7, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x24, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0x00, 0x00, 
-0x0C, 0xD6, 0xFB, 0x72, 0x00, 0x00, 0x00, 0xA9, 0xE4, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x24, 0x24, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xD7, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 0x35, 
-0x00, 0x00, 0x02, 0xA5, 0xFF, 0xA7, 0x02, 0x00, 0x97, 0xD0, 0x49, 0xD3, 0x97, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 0x35, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 
-0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 
-0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xD3, 
-0x35, 0x72, 0xFB, 0xD4, 0x0B, 0x00, 0x3B, 0xE4, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x0C, 0xD6, 0xFB, 0x72, 0x00, 0xA9, 0xE4, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xA5, 0xFF, 
-0xA7, 0x02, 0x97, 0xD0, 0x49, 0xD3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x66, 0xE4, 0xE5, 0x68, 0xE9, 0x00, 0xEC, 0x48, 0xE3, 0xEC, 
-0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1D, 0xC3, 0xE7, 0x5C, 0xFF, 0xFF, 0xF3, 
-0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xA8, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x72, 0xFB, 0xD4, 
-0x0B, 0x00, 0x00, 0x00, 0x3B, 0xE4, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 
-0xDD, 0xFF, 0xFF, 0xDD, 0x47, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x48, 
-0xDE, 0xFF, 0xFF, 0xDE, 0x47, 0x00, 0x00, 0x00, 0x0C, 0xD6, 0xFB, 0x72, 0x00, 0x00, 0x00, 0xA9, 
-0xE4, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xDD, 0xFF, 0xFF, 0xDD, 0x47, 
-0x00, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDD, 0x00, 0x48, 0xDE, 0xFF, 0xFF, 0xDE, 0x47, 0x00, 0x00, 0x02, 0xA5, 0xFF, 0xA7, 0x02, 0x00, 
-0x97, 0xD0, 0x49, 0xD3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xDD, 0xFF, 0xFF, 0xDD, 
-0x47, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x48, 0xDE, 0xFF, 0xFF, 0xDE, 
-0x47, 0x00, 0x66, 0xE4, 0xE5, 0x68, 0xE9, 0x00, 0xEC, 0x48, 0xE3, 0xEC, 0x61, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x47, 0xDD, 0xFF, 0xFF, 0xDD, 0x47, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDD, 0x48, 0xDE, 0xFF, 0xFF, 0xDE, 0x47, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xDD, 0xFF, 0xFF, 0xDD, 
-0x47, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x48, 0xDE, 0xFF, 0xFF, 0xDE, 
-0x47, 0x00, 0x00, 0xC5, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC5, 0xC3, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF8, 0x70, 
-0x35, 0xD2, 0xFF, 0xE6, 0x45, 0xD3, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xD2, 0x47, 0xE9, 0xFF, 0xD3, 0x35, 0x73, 0xF9, 0x13, 
-0x00, 0x00, 0x72, 0xFB, 0xD4, 0x0B, 0x00, 0x00, 0x00, 0x3B, 0xE4, 0xA7, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0C, 0xD6, 0xFB, 
-0x72, 0x00, 0x00, 0x00, 0xA9, 0xE4, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 
-0xA5, 0xFF, 0xA7, 0x02, 0x00, 0x97, 0xD0, 0x49, 0xD3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x0C, 0xD6, 0xFB, 0x72, 0x00, 0x00, 0xA9, 0xE4, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xE4, 0xFF, 0x15, 0x15, 0xFF, 0xE2, 0xAB, 0xFF, 0x3F, 0x40, 0xFF, 0xA9, 0x72, 0xFF, 0x6A, 0x6B, 
-0xFF, 0x70, 0x39, 0xFF, 0x94, 0x96, 0xFF, 0x37, 0x07, 0xF9, 0xBF, 0xC0, 0xF8, 0x06, 0x00, 0xC7, 
-0xEA, 0xEB, 0xC5, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x53, 0x00, 
-0x00, 0x1C, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x20, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x9E, 
-0x00, 0x00, 0x00, 0xA1, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xE4, 0xFF, 0x15, 0x15, 0xFF, 0xE2, 0xAB, 0xFF, 0x3F, 0x40, 0xFF, 0xA9, 0x72, 0xFF, 0x6A, 0x6B, 
-0xFF, 0x70, 0x39, 0xFF, 0x94, 0x96, 0xFF, 0x37, 0x07, 0xF9, 0xBF, 0xC0, 0xF8, 0x06, 0x00, 0xC7, 
-0xEA, 0xEB, 0xC5, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x53, 0x00, 
-0x00, 0x1C, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x20, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x9E, 
-0x00, 0x00, 0x00, 0xA1, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x1B, 0xAE, 0x00, 0x00, 0xFF, 0xFF, 0xF1, 0xFA, 0x00, 0x2D, 0xFF, 0xFF, 0xC5, 0x2B, 0x00, 
-0xFB, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xCA, 
-0x90, 0xFF, 0xFF, 0x91, 0xCC, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x0C, 0x0C, 0x0C, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD1, 0x34, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD3, 0x35, 0x00, 0x97, 0xDD, 0x7B, 0xDF, 0x97, 0x00, 0x00, 0x02, 0xA5, 0xFF, 0xA8, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xD8, 0xFF, 0xFF, 0xFF, 0xD8, 0x47, 
-0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x58, 0xF8, 0xF1, 0x4E, 
-0x00, 0x00, 0x00, 0x00, 0x35, 0xE4, 0xFE, 0x80, 0x01, 0x00, 0x00, 0x00, 0x18, 0xC4, 0xFF, 0xB1, 
-0x0E, 0x00, 0x00, 0x00, 0x06, 0x99, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE3, 0x48, 0xD9, 0xFF, 0xFF, 0xFF, 0xD9, 0x47, 0x00, 0x97, 0xDD, 0x7B, 0xDF, 
-0x97, 0x00, 0x02, 0xA5, 0xFF, 0xA8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xD1, 0xFF, 
-0xFF, 0xD1, 0x34, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xCC, 
-0xFF, 0x82, 0x13, 0x00, 0x00, 0x16, 0x8C, 0xF4, 0xF4, 0x8D, 0x16, 0x00, 0x00, 0x13, 0x83, 0xFF, 
-0xCD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x35, 0xD3, 0xFF, 
-0xFF, 0xD3, 0x35, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFF, 0x2A, 0x00, 0x00, 
-0x29, 0xFF, 0xDA, 0x84, 0xFF, 0x7E, 0x00, 0x00, 0x7C, 0xFF, 0x83, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 
-0xCF, 0xFF, 0x2C, 0x00, 0xD5, 0xFF, 0x26, 0x22, 0xFF, 0xD5, 0x00, 0x00, 0x7E, 0xFF, 0x7A, 0x75, 
-0xFF, 0x7D, 0x00, 0x00, 0x26, 0xFF, 0xCF, 0xC8, 0xFF, 0x25, 0x00, 0x00, 0x00, 0xCB, 0xFF, 0xFE, 
-0xC7, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 
-0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x97, 0xDD, 0x7B, 0xDF, 
-0x97, 0x00, 0x02, 0xA5, 0xFF, 0xA8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 
-0x00, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x00, 0x04, 0xE9, 0xD0, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0x70, 
-0x00, 0x00, 0x00, 0xAC, 0xFA, 0x15, 0x00, 0x00, 0x12, 0xF9, 0xB0, 0x00, 0x00, 0x00, 0x6A, 0xFF, 
-0x50, 0x00, 0x00, 0x00, 0xC9, 0xEA, 0x05, 0x00, 0x00, 0x29, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x88, 
-0xFF, 0x30, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x97, 0xDD, 0x7B, 0xDF, 0x97, 0x02, 0xA5, 0xFF, 0xA8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0xA2, 0xFF, 0x8A, 0x00, 
-0x20, 0xFB, 0xF7, 0x17, 0x00, 0x96, 0xFF, 0x93, 0x00, 0x18, 0xF7, 0xFA, 0x1E, 0x00, 0x8B, 0xFF, 
-0x9D, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xAE, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x18, 0xFF, 0xF6, 
-0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xD1, 0x00, 0x00, 
-0x00, 0x37, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x00, 0x00, 
-0x69, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 
-0x7C, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x5A, 0x00, 
-0x00, 0x00, 0x00, 0xC2, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0x38, 0x00, 0x00, 0x00, 
-0x00, 0xE6, 0xFF, 0x27, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x16, 0x00, 0x00, 0xCB, 0xFF, 0xFF, 
-0xFE, 0x05, 0x00, 0x00, 0xEE, 0xFF, 0xFD, 0xA3, 0x00, 0x00, 0x00, 0x02, 0xA5, 0xFF, 0xA7, 0x02, 
-0x97, 0xD0, 0x49, 0xD3, 0x97, 0x97, 0xDD, 0x7B, 0xDF, 0x97, 0x02, 0xA5, 0xFF, 0xA8, 0x02, 0xFF, 
-0x00, 0xFF, 0xCA, 0xFF, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0x93, 0xFF, 0xFF, 0x90, 0xFF, 0x00, 0x00, 
-0xFF, 0x93, 0xFF, 0xFF, 0x91, 0x62, 0xFF, 0xBB, 0x00, 0xEE, 0xFF, 0x20, 0x00, 0xC7, 0xFF, 0xFF, 
-0xFF, 0x66, 0xE4, 0xE5, 0x68, 0xE9, 0xEC, 0x48, 0xE3, 0xEC, 0x61, 0x6C, 0xC4, 0x00, 0x6C, 0xC4, 
-0xD3, 0x41, 0x00, 0xD3, 0x41, 0x00, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0xDF, 0x00, 0xC0, 
-0x9F, 0x40, 0xFF, 0x5F, 0xC0, 0xFF, 0x1F, 0x20, 0xFF, 0xBF, 0x61, 0xFF, 0x3F, 0xA1, 0xBF, 0x00, 
-0xE0, 0x3F, 0x00, 0x20, 0xFF, 0xBF, 0x61, 0xFF, 0x3F, 0xA1, 0xBF, 0x00, 0xE0, 0x3F, 0x00, 0x00, 
-0x40, 0xDF, 0x00, 0x40, 0xDF, 0x00, 0xC0, 0x9F, 0x00, 0xC0, 0x9F, 0x40, 0xFF, 0x5F, 0x40, 0xFF, 
-0x5F, 0xC0, 0xFF, 0x1F, 0xC0, 0xFF, 0x1F, 0x20, 0xFF, 0xBF, 0x20, 0xFF, 0xBF, 0x61, 0xFF, 0x3F, 
-0x61, 0xFF, 0x3F, 0xA1, 0xBF, 0x00, 0xA1, 0xBF, 0x00, 0xE0, 0x3F, 0x00, 0xE0, 0x3F, 0x00, 0x20, 
-0xFF, 0xBF, 0x20, 0xFF, 0xBF, 0x61, 0xFF, 0x3F, 0x61, 0xFF, 0x3F, 0xA1, 0xBF, 0x00, 0xA1, 0xBF, 
-0x00, 0xE0, 0x3F, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x5D, 
-0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0x5C, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x5D, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0x5D, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x5D, 0xE7, 0xE7, 0x5C, 0x00, 0x00, 0x00, 0x41, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 
-0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0xC3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0x46, 0xD9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xC7, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x4B, 0xD5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xE7, 0x00, 
-0xCC, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xE8, 0xE8, 0x5D, 0x4F, 0xD0, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x4F, 0x5D, 
-0xE7, 0xE7, 0x5C, 0x00, 0x5D, 0xE7, 0xE7, 0x5C, 0x00, 0x00, 0x00, 0x54, 0xCC, 0x00, 0xE8, 0x00, 
-0x00, 0xE7, 0x00, 0xE8, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x02, 0xD3, 0x4A, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x59, 0xC8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xD7, 0x45, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0x5D, 0xC3, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xE7, 0x00, 0xE8, 
-0x00, 0x00, 0xE7, 0x00, 0xDB, 0x41, 0x00, 0x00, 0x00, 0x5D, 0xE8, 0xE8, 0x5D, 0x00, 0x5D, 0xE8, 
-0xE8, 0x5D, 0x00, 0x4C, 0xFF, 0xBE, 0x08, 0xDD, 0xFC, 0x2D, 0x7F, 0xFF, 0x94, 0x00, 0xEE, 0xFF, 
-0x24, 0x00, 0x7F, 0xFF, 0x92, 0x00, 0x08, 0xDD, 0xFB, 0x28, 0x00, 0x4D, 0xFF, 0xB6, 0xB7, 0xFF, 
-0x4C, 0x00, 0x29, 0xFB, 0xDD, 0x08, 0x00, 0x93, 0xFF, 0x7E, 0x00, 0x25, 0xFF, 0xED, 0x00, 0x95, 
-0xFF, 0x7E, 0x2D, 0xFC, 0xDD, 0x08, 0xBE, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x81, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xF9, 0x2B, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xB4, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x1A, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0xCA, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xEA, 0x0D, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x06, 0xDD, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xDB, 0x05, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x0F, 0xEC, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC8, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF7, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xB1, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF9, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 
-0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xD9, 0xFF, 0xFF, 0xD9, 0x3C, 0x00, 
-0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xD9, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD9, 0x00, 0x3C, 0xD9, 0xFF, 0xFF, 0xD9, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x40, 0x00, 0x3A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x99, 0x00, 0x95, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0xED, 0x0A, 0xEB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x97, 
-0xFB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xBA, 0xFF, 0xB8, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0xFF, 0x64, 0xFF, 0x61, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x13, 0xF5, 0x11, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xAD, 0x54, 0x00, 0x00, 0x00, 
-0x00, 0x18, 0xD8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x62, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 
-0x51, 0x00, 0x00, 0x00, 0x00, 0x21, 0xDD, 0x12, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA5, 0xC0, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 
-0x35, 0xFF, 0x35, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xC5, 
-0xA6, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x51, 0xDF, 0x00, 0x00, 0x00, 0x18, 0xED, 0x02, 0xED, 0x18, 
-0x00, 0x00, 0x51, 0xB4, 0x00, 0xB5, 0x52, 0x00, 0x00, 0x8A, 0x7A, 0x00, 0x7B, 0x8C, 0x00, 0x00, 
-0xC3, 0x3F, 0x00, 0x40, 0xC5, 0x00, 0x05, 0xF1, 0x0A, 0x00, 0x0A, 0xF3, 0x05, 0x35, 0xCB, 0x00, 
-0x00, 0x00, 0xCC, 0x35, 0x6D, 0x91, 0x00, 0x00, 0x00, 0x92, 0x6E, 0xA6, 0x57, 0x00, 0x00, 0x00, 
-0x58, 0xA6, 0xDF, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x4D, 0x00, 0x00, 0x00, 0x32, 0xDC, 
-0x08, 0x00, 0x00, 0x00, 0xA5, 0x81, 0x00, 0x00, 0x00, 0x20, 0xF0, 0x23, 0x00, 0x00, 0x00, 0x8D, 
-0xB4, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x00, 0x00, 0x00, 0x74, 0xC3, 0x00, 0x00, 0x04, 0xE2, 0x42, 
-0x00, 0x00, 0x5C, 0xC2, 0x00, 0x00, 0x00, 0xCF, 0x41, 0x00, 0x00, 0x44, 0xC0, 0x00, 0x00, 0x00, 
-0xB8, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x26, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xBF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xE8, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x58, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0x4C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0xED, 0xF4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xAD, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0x5E, 0x00, 0x00, 0xBC, 0xFF, 0x46, 0x00, 0xD6, 
-0xFC, 0x13, 0x00, 0x00, 0x35, 0xFF, 0xD0, 0x24, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFF, 
-0xC5, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFC, 0xFF, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x9C, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFF, 0xFF, 0xED, 0x35, 0x00, 0x2F, 0xEA, 
-0xFF, 0xFF, 0xC9, 0xFF, 0x00, 0x00, 0x61, 0xD6, 0x09, 0xD0, 0x5A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xBA, 0xCC, 0xB7, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x40, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xB4, 0xC6, 0xBB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x54, 0xD2, 0x07, 0xD0, 0x5E, 0x00, 0x00, 0xFF, 0xCB, 0xFF, 0xFF, 0xEA, 0x36, 0x00, 
-0x2F, 0xEB, 0xFF, 0xFF, 0xCA, 0x00, 0x00, 0x5A, 0xE7, 0xFF, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 
-0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 
-0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 
-0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0xFD, 0xDD, 0x46, 0x00, 0x00, 0xD4, 
-0xC6, 0x4E, 0x00, 0x00, 0xFF, 0xFF, 0x43, 0xC8, 0xC7, 0x42, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xC7, 
-0xD4, 0xD4, 0xC6, 0x4E, 0x00, 0x00, 0xFF, 0xFF, 0x43, 0xC8, 0xC7, 0x42, 0xFF, 0xFF, 0x00, 0x00, 
-0x4F, 0xC7, 0xD4, 0x00, 0x00, 0x18, 0xB8, 0x00, 0x00, 0x00, 0x4A, 0xC9, 0x00, 0x00, 0x00, 0x7B, 
-0x93, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE7, 0x1C, 0x00, 0x00, 0x1D, 0xE7, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x94, 0x7E, 0x00, 0x00, 0x00, 0xCA, 0x4B, 0x00, 0x00, 
-0x00, 0xB9, 0x19, 0x00, 0x00, 0x00, 0x00, 0x06, 0x99, 0x00, 0x1A, 0xC2, 0x6A, 0x3B, 0xD6, 0x44, 
-0x00, 0xF4, 0x4C, 0x00, 0x00, 0x3D, 0xD7, 0x43, 0x00, 0x00, 0x1C, 0xC7, 0x6A, 0x00, 0x00, 0x08, 
-0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x08, 0x00, 0x00, 0x6B, 0xC6, 0x1C, 0x00, 0x00, 0x44, 0xD7, 
-0x3C, 0x00, 0x00, 0x4D, 0xF4, 0x00, 0x44, 0xD6, 0x3B, 0x6A, 0xC3, 0x1A, 0x00, 0x9A, 0x06, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x31, 0xF5, 0x35, 0x00, 0x00, 0x00, 0x09, 0xCE, 0x5A, 
-0xD1, 0x0A, 0x00, 0x00, 0x96, 0x6D, 0x00, 0x6E, 0x98, 0x00, 0x4B, 0xB5, 0x00, 0x00, 0x00, 0xB5, 
-0x4C, 0xD3, 0x2D, 0x00, 0x00, 0x00, 0x2E, 0xD3, 0x4B, 0xB4, 0x00, 0x00, 0x00, 0xB5, 0x4C, 0x00, 
-0x96, 0x6D, 0x00, 0x6E, 0x98, 0x00, 0x00, 0x09, 0xCE, 0x59, 0xD1, 0x0B, 0x00, 0x00, 0x00, 0x31, 
-0xF5, 0x36, 0x00, 0x00, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xD1, 0x34, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xD1, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xD3, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xEC, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0E, 0x41, 0x67, 0x65, 0x6E, 0x63, 0x79, 
-0x20, 0x46, 0x42, 0x20, 0x42, 0x6F, 0x6C, 0x64, 0x00, 0x0D, 0x41, 0x67, 0x65, 0x6E, 0x63, 0x79, 
-0x46, 0x42, 0x2D, 0x42, 0x6F, 0x6C, 0x64, 0x01};
\ No newline at end of file
@@ -1,2783 +0,0 @@
-const uint8_t midleFont[] PROGMEM = {0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 
-0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x19, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
-0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1A, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x1B, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 
-0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1B, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x1D, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1C, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x1B, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xED, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x53, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x61, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 
-0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x00, 0x1C, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x92, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x17, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC6, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC7, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xD9, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDA, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDB, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDC, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xDD, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA9, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x19, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1A, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1D, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x21, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x26, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1A, 
-0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x39, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3A, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x17, 0xFF, 0xFF, 0xFF, 0xFC, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xAC, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x21, 0x22, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x22, 0x11, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1A, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2B, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x22, 0x48, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x60, 
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x64, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x65, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x25, 0xCA, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x01, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x02, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x00, 0xFE, 0xFA, 0x00, 0xF9, 0xF4, 0x00, 0xF3, 0xEE, 
-0x00, 0xED, 0xE8, 0x00, 0xE7, 0xE2, 0x00, 0xE1, 0xDC, 0x00, 0xDB, 0xD6, 0x00, 0xD4, 0xCF, 0x00, 
-0xCE, 0xC9, 0x00, 0xC8, 0xC3, 0x00, 0xC2, 0xBD, 0x00, 0xBC, 0xB7, 0x00, 0xB6, 0xB1, 0x00, 0xB0, 
-0xAB, 0x00, 0xAA, 0xA5, 0x00, 0xA3, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0xF7, 0x00, 0x00, 0xF9, 0xF8, 0xE9, 
-0xE8, 0x00, 0x00, 0xEA, 0xEA, 0xDA, 0xD9, 0x00, 0x00, 0xDB, 0xDC, 0xCA, 0xC9, 0x00, 0x00, 0xCC, 
-0xCD, 0xBB, 0xBA, 0x00, 0x00, 0xBD, 0xBF, 0xAB, 0xAA, 0x00, 0x00, 0xAE, 0xB1, 0x9C, 0x9B, 0x00, 
-0x00, 0x9F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xE1, 0x00, 0x00, 0x1C, 0xFF, 0xE2, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0xA5, 0x00, 0x00, 0x55, 0xFF, 0xA7, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0x69, 0x00, 0x00, 0x8E, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xCE, 0xFF, 0x2D, 0x00, 0x00, 0xC7, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 
-0xFC, 0xEF, 0x02, 0x00, 0x06, 0xF8, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xB5, 
-0x00, 0x00, 0x38, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xFF, 0x1F, 0x00, 0x00, 0xD5, 0xFF, 0x23, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x11, 0xFE, 0xE8, 0x00, 0x00, 0x0F, 0xFD, 0xEC, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x49, 0xFF, 0xB1, 0x00, 0x00, 0x46, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x81, 0xFF, 0x79, 0x00, 0x00, 0x7E, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 
-0x42, 0x00, 0x00, 0xB7, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFD, 0x0D, 0x00, 
-0x01, 0xED, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xD3, 0x00, 0x00, 0x28, 0xFF, 
-0xD7, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x70, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 
-0x00, 0x00, 0x00, 0xC2, 0xFF, 0x37, 0x00, 0x00, 0xB7, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x05, 0xF6, 0xF8, 0x06, 0x00, 0x02, 0xF0, 0xFC, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 
-0xC5, 0x00, 0x00, 0x2F, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x8D, 0x00, 
-0x00, 0x6B, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x54, 0x00, 0x00, 0xA7, 
-0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x1C, 0x00, 0x00, 0xE2, 0xFF, 0x1D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x05, 0xFF, 0xFF, 0x04, 0x01, 0x00, 0x00, 0x18, 0xB4, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xF7, 0xAD, 0x11, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xF1, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xDC, 
-0xFF, 0xAA, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFC, 0xFF, 0xAF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x5A, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 
-0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xFF, 0x8D, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x96, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x89, 0xFF, 0xFF, 0x83, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6B, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xEB, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x0A, 0x9C, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xA0, 0x0A, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x07, 0x95, 0xF1, 0xFF, 0xFF, 0xF2, 0xA0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x43, 0xFF, 0xCC, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC8, 0xFF, 0x47, 0x00, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 
-0x00, 0x50, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x02, 0xD3, 0xFF, 0x3A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x5D, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x05, 0xDD, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x69, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x09, 0xE5, 0xFB, 0x25, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x76, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xF3, 0x0E, 0xED, 0xF8, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x82, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x9C, 
-0xF2, 0xFF, 0xFF, 0xF4, 0xA9, 0x27, 0xF3, 0xFB, 0xAA, 0xF1, 0xFF, 0xFF, 0xF2, 0xA0, 0x0C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF8, 0xED, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0x75, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFB, 0xE5, 0x09, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x68, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0xDD, 0x05, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x5C, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xD3, 0x02, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x4F, 0x00, 0x00, 0x00, 
-0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0x00, 0x00, 0x48, 0xFF, 0xC8, 0x00, 0x00, 0x00, 
-0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0xCC, 0xFF, 0x43, 0x00, 0x00, 
-0x00, 0x00, 0x0A, 0x9C, 0xF2, 0xFF, 0xFF, 0xF4, 0xA9, 0x11, 0x06, 0x8D, 0xEF, 0xFF, 0xFF, 0xFF, 
-0xF2, 0x9F, 0x0C, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 
-0xE5, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFD, 0x0B, 0x00, 0xF4, 0xFF, 0x10, 0x00, 0x00, 
-0x00, 0x00, 0xF4, 0xFF, 0x18, 0x00, 0xF4, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x18, 
-0x00, 0xF4, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x18, 0x00, 0xF4, 0xFF, 0x10, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xF2, 0xFF, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xF0, 
-0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7D, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xB0, 0x05, 0x71, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xB1, 0xFF, 
-0xEB, 0x60, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0xFF, 0x13, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0A, 0x99, 0xF2, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0xF7, 0xE9, 0xE8, 0xDA, 0xD9, 0xCA, 0xC9, 0xBB, 
-0xBA, 0xAB, 0xAA, 0x9C, 0x9B, 0x00, 0x00, 0x37, 0xFF, 0xD8, 0x00, 0x00, 0xA6, 0xFF, 0x6B, 0x00, 
-0x19, 0xFA, 0xF0, 0x0C, 0x00, 0x72, 0xFF, 0x95, 0x00, 0x00, 0xBF, 0xFF, 0x44, 0x00, 0x0F, 0xFA, 
-0xF0, 0x05, 0x00, 0x4B, 0xFF, 0xAF, 0x00, 0x00, 0x78, 0xFF, 0x82, 0x00, 0x00, 0xA3, 0xFF, 0x57, 
-0x00, 0x00, 0xCB, 0xFF, 0x30, 0x00, 0x00, 0xDE, 0xFF, 0x1F, 0x00, 0x00, 0xEC, 0xFF, 0x12, 0x00, 
-0x00, 0xF9, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0xFF, 0x06, 0x00, 0x00, 0xEC, 0xFF, 0x12, 0x00, 0x00, 
-0xDE, 0xFF, 0x1F, 0x00, 0x00, 0xCB, 0xFF, 0x30, 0x00, 0x00, 0xA3, 0xFF, 0x57, 0x00, 0x00, 0x78, 
-0xFF, 0x82, 0x00, 0x00, 0x4B, 0xFF, 0xAF, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x05, 0x00, 0x00, 0xBF, 
-0xFF, 0x44, 0x00, 0x00, 0x72, 0xFF, 0x95, 0x00, 0x00, 0x1A, 0xFA, 0xF0, 0x0C, 0x00, 0x00, 0xA6, 
-0xFF, 0x6B, 0x00, 0x00, 0x37, 0xFF, 0xD8, 0xD9, 0xFF, 0x37, 0x00, 0x00, 0x6D, 0xFF, 0xA5, 0x00, 
-0x00, 0x0D, 0xF1, 0xFA, 0x19, 0x00, 0x00, 0x97, 0xFF, 0x72, 0x00, 0x00, 0x48, 0xFF, 0xBE, 0x00, 
-0x00, 0x06, 0xF2, 0xFA, 0x0E, 0x00, 0x00, 0xB3, 0xFF, 0x4B, 0x00, 0x00, 0x86, 0xFF, 0x77, 0x00, 
-0x00, 0x5A, 0xFF, 0xA2, 0x00, 0x00, 0x32, 0xFF, 0xCA, 0x00, 0x00, 0x21, 0xFF, 0xDD, 0x00, 0x00, 
-0x14, 0xFF, 0xEB, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x14, 
-0xFF, 0xEB, 0x00, 0x00, 0x21, 0xFF, 0xDD, 0x00, 0x00, 0x32, 0xFF, 0xCA, 0x00, 0x00, 0x5A, 0xFF, 
-0xA2, 0x00, 0x00, 0x86, 0xFF, 0x77, 0x00, 0x00, 0xB3, 0xFF, 0x4B, 0x00, 0x06, 0xF2, 0xFA, 0x0E, 
-0x00, 0x48, 0xFF, 0xBE, 0x00, 0x00, 0x97, 0xFF, 0x72, 0x00, 0x0C, 0xF1, 0xFA, 0x19, 0x00, 0x6D, 
-0xFF, 0xA5, 0x00, 0x00, 0xD9, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xF4, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x92, 0x3E, 0x00, 0xC5, 0xC6, 0x00, 0x3E, 
-0x91, 0xB8, 0xFC, 0x76, 0xAE, 0xB0, 0x74, 0xFB, 0xB8, 0x00, 0x49, 0xCD, 0xF8, 0xF8, 0xCE, 0x4A, 
-0x00, 0x00, 0x43, 0xC6, 0xF5, 0xF5, 0xC7, 0x44, 0x00, 0xB7, 0xFB, 0x6F, 0xAE, 0xB0, 0x6D, 0xFA, 
-0xB6, 0x92, 0x3C, 0x00, 0xC6, 0xC7, 0x00, 0x3C, 0x91, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xF4, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xCC, 
-0x4D, 0xFF, 0x66, 0x80, 0xF3, 0x0C, 0xB3, 0x99, 0x00, 0xE6, 0x33, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x8C, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEA, 0xF9, 0x15, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xBC, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFE, 0xDE, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0xE6, 0xFB, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xAF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x1D, 0xFD, 0xE2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xFD, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x4B, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x50, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFB, 0xE6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x7B, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDE, 0xFE, 0x22, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xAA, 0xFF, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xF9, 0xEA, 0x06, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xD9, 0xFF, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9A, 0xF2, 0xFF, 0xFF, 
-0xFF, 0xF1, 0x98, 0x08, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xF2, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF2, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x97, 0x0A, 0x9C, 0xF2, 0xFF, 0xFF, 0xFF, 0xF2, 0x9A, 0x09, 0x00, 0x7F, 0xFF, 0x00, 0xBD, 0xFF, 
-0x05, 0xF5, 0xFF, 0x38, 0xFF, 0xFF, 0x76, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x09, 
-0x9E, 0xF2, 0xFF, 0xFF, 0xFF, 0xF1, 0x98, 0x08, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x95, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF7, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x59, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xDC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 
-0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xEA, 0xE4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE4, 0xEB, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x66, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDD, 0xF1, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x5C, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD5, 0xF6, 0x16, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x52, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFA, 0x1D, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x48, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x92, 
-0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0x88, 0x03, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 
-0xEA, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xE8, 0xF8, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x08, 
-0xFF, 0xF8, 0xF8, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xF8, 0xFF, 0x04, 0x00, 0x00, 
-0x00, 0x08, 0xFF, 0xF8, 0xF8, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x60, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9D, 0xFF, 0xDC, 0x29, 0x00, 
-0x00, 0x00, 0x28, 0xD3, 0xFC, 0x8B, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0x64, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x29, 0xD4, 0xFC, 0x8C, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA1, 
-0xFF, 0xDF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x8E, 0x0A, 0x99, 0xF2, 0xFF, 0xFF, 0xFF, 0xF1, 0x90, 0x06, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x9D, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFB, 0x15, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 
-0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0xF5, 0x0B, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x5B, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0x4C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFA, 0xEC, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x67, 
-0xFF, 0x97, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3D, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x1B, 0xFD, 0xE1, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x73, 0xFF, 0x88, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x2D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x25, 
-0xFF, 0xD3, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7E, 0xFF, 0x79, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 
-0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xD8, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x9E, 0x0B, 0xFA, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE9, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 
-0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x0F, 0xA4, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3, 
-0xA2, 0x0E, 0x09, 0x9A, 0xF2, 0xFF, 0xFF, 0xFF, 0xF0, 0x96, 0x08, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x95, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xF3, 0xAA, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x99, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x98, 0x0A, 0x9C, 0xF2, 0xFF, 0xFF, 0xFF, 0xF2, 0x9D, 
-0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xBB, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x49, 0xFF, 0x8D, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x5E, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFA, 0x06, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFE, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 
-0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x9F, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x06, 0xF9, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xBA, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x62, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x5D, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF2, 0xFA, 
-0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 
-0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xB7, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0x17, 0x00, 0x00, 0x00, 
-0x03, 0x84, 0xED, 0xFF, 0xFF, 0xFF, 0xEF, 0x86, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x7F, 0xE1, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xE0, 0xF0, 0xFF, 0x10, 0x00, 0x00, 
-0x00, 0x10, 0xFF, 0xF0, 0xF0, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xF0, 0xF0, 0xFF, 0x10, 
-0x00, 0x00, 0x00, 0x10, 0xFF, 0xF0, 0xF0, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xF0, 0xEC, 
-0xFF, 0x10, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xEB, 0x9F, 0xFF, 0xBC, 0x1B, 0x00, 0x1C, 0xBC, 0xFF, 
-0x9D, 0x10, 0xA3, 0xFF, 0xEE, 0x84, 0xEE, 0xFF, 0xA1, 0x0E, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 
-0x8A, 0x00, 0x00, 0x0C, 0x99, 0xFF, 0xF3, 0x90, 0xF3, 0xFE, 0x94, 0x09, 0xAB, 0xFF, 0xC1, 0x21, 
-0x00, 0x21, 0xC2, 0xFF, 0xA4, 0xF1, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xEF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x91, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x07, 0x92, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0x06, 0x07, 
-0x98, 0xF5, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0x06, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x8F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x16, 0xB4, 0xF7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x97, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x98, 0x09, 0x9A, 0xF2, 0xFF, 0xFF, 0xFF, 0xF2, 0x9D, 0x0A, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x19, 0xFF, 0xCC, 0x4D, 0xFF, 0x66, 0x80, 0xF3, 0x0C, 0xB3, 0x99, 0x00, 0xE6, 0x33, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x92, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xB6, 0xFF, 0x00, 0x00, 
-0x00, 0x1E, 0xD2, 0xFE, 0x73, 0x00, 0x00, 0x36, 0xE7, 0xFA, 0x5A, 0x00, 0x00, 0x54, 0xF6, 0xF3, 
-0x45, 0x00, 0x00, 0x78, 0xFE, 0xE9, 0x33, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x47, 0x00, 0x00, 0x00, 
-0x00, 0x85, 0xFF, 0xE9, 0x32, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFA, 0xF3, 0x45, 0x00, 0x00, 0x00, 
-0x00, 0x40, 0xEE, 0xFA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x26, 0xDB, 0xFE, 0x73, 0x00, 0x00, 0x00, 
-0x00, 0x13, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x07, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xC4, 0x13, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFE, 0xDB, 0x25, 0x00, 0x00, 0x00, 0x00, 
-0x5B, 0xFA, 0xEC, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x46, 0xF3, 0xF8, 0x58, 0x00, 0x00, 0x00, 0x00, 
-0x33, 0xE9, 0xFE, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x33, 0xE9, 
-0xFF, 0x85, 0x00, 0x00, 0x45, 0xF3, 0xF8, 0x5D, 0x00, 0x00, 0x5A, 0xFA, 0xEA, 0x3B, 0x00, 0x00, 
-0x73, 0xFE, 0xD5, 0x21, 0x00, 0x00, 0x00, 0xFF, 0xB8, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x94, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x8C, 0xF0, 0xFF, 0xFF, 0xF0, 0x8F, 0x06, 0x8E, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x33, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCB, 0xFF, 0x46, 0x00, 0x00, 0x00, 
-0x00, 0x6A, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xEF, 0x17, 0x00, 0x00, 0x00, 0x00, 
-0x9C, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x66, 0xEC, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x66, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xEC, 0xFF, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xEC, 0x66, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 
-0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x9C, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xE0, 0xEF, 0xC8, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 
-0xFF, 0x94, 0xA3, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 0x00, 
-0x00, 0x00, 0x00, 0x7C, 0xFF, 0x49, 0x55, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x23, 
-0x2E, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x00, 0x00, 0x00, 
-0x06, 0xFB, 0xD7, 0x00, 0x00, 0xE1, 0xFA, 0x05, 0x00, 0x00, 0x2E, 0xFF, 0xB1, 0x00, 0x00, 0xBA, 
-0xFF, 0x2C, 0x00, 0x00, 0x5B, 0xFF, 0x8C, 0x00, 0x00, 0x94, 0xFF, 0x58, 0x00, 0x00, 0x88, 0xFF, 
-0x66, 0x00, 0x00, 0x6D, 0xFF, 0x85, 0x00, 0x00, 0xB4, 0xFF, 0x40, 0x00, 0x00, 0x46, 0xFF, 0xB1, 
-0x00, 0x00, 0xE1, 0xFF, 0x1A, 0x00, 0x00, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFE, 0x0C, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x67, 
-0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 0x18, 
-0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xA8, 0x11, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 
-0xFF, 0xE4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x10, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x10, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xF0, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xE1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x63, 0xF0, 0xFF, 
-0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x61, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xEE, 0x59, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x5C, 0xEB, 0xFF, 0x85, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x13, 0xFF, 0xF2, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 0x18, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xAF, 0x17, 0xB2, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 
-0xFF, 0xFF, 0xF5, 0xB1, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAD, 0x20, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x34, 0xD4, 0xFF, 0x9E, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xEB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x05, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xEB, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0x37, 0xD4, 
-0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xF2, 0xAD, 0x20, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x17, 0xB2, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 
-0xFF, 0xFF, 0xF5, 0xB2, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xB3, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 
-0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xCA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0xD3, 0xFF, 0x40, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xB5, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x0C, 0xE7, 0xFD, 0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x83, 0xFF, 
-0x9F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xF5, 0xF7, 0x1D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xA1, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x31, 0xFE, 0xEE, 0x11, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xBE, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4D, 0xFF, 0xE1, 
-0x08, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD7, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xF1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xFF, 0x5D, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x5C, 0xFF, 0xDF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 
-0xCA, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0xEB, 0x0E, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xAB, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x21, 
-0xF8, 0xF4, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x95, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0xFA, 0x23, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x69, 
-0xFF, 0xA8, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD5, 0xFE, 0x32, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xBB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x8F, 0x00, 0x00, 
-0x00, 0x90, 0xFF, 0xF9, 0xFF, 0xFF, 0xF0, 0xE8, 0xCD, 0x00, 0x00, 0x00, 0xCE, 0xE7, 0xF0, 0xFF, 
-0xFF, 0xFF, 0xA7, 0xFC, 0x0E, 0x00, 0x0E, 0xFC, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0x65, 0xFF, 0x48, 
-0x00, 0x49, 0xFF, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0xFF, 0x86, 0x00, 0x87, 0xFF, 0x22, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0xE1, 0xC3, 0x00, 0xC4, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x9F, 
-0xF8, 0x11, 0xF9, 0x9E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0x7E, 0xFF, 0x5C, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1B, 0xFF, 0xE7, 0xFF, 0x1A, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xD9, 0xFF, 0xD8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x97, 0xFF, 0x96, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x14, 0xFC, 0x14, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA1, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 
-0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x14, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0xB7, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0xFA, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 
-0xFF, 0x5D, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE1, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x8F, 0xF7, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0x56, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xE6, 0xA9, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x95, 0xF3, 
-0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x41, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x03, 0xEA, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x9B, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xEE, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4D, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xA6, 0xFF, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x17, 0xB2, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 
-0xF5, 0xB2, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 
-0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB2, 0x18, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x9E, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0x91, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0x14, 0x00, 0xF5, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE9, 0x54, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xF1, 0xF7, 0xFF, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xFB, 0xD5, 0x47, 0x29, 0xCA, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xB0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0xA8, 0xFF, 0xFA, 0xFC, 0xD5, 0x37, 0xFF, 0xFF, 0x00, 0x57, 0xFF, 
-0x7E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0D, 0xF8, 0xD3, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xB4, 0xFF, 0x29, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x63, 0xFF, 0x7E, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x14, 0xFC, 0xD4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x29, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1E, 
-0xFF, 0xD4, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x2A, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x7A, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xD5, 0x18, 0xB1, 
-0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB2, 0x18, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 
-0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0xFF, 0xCB, 
-0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCA, 0xFF, 0xA9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x19, 0xE4, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xF6, 0xFE, 0x57, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x55, 0xFE, 0xF6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
-0xE5, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0xFF, 0xCC, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x09, 0xCB, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xEF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xB3, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xB4, 0x1A, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 
-0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 
-0xB2, 0x18, 0xEA, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xE9, 0xBD, 0xFF, 0x3C, 0x00, 
-0x00, 0x00, 0x00, 0x3C, 0xFF, 0xBC, 0x91, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0x90, 
-0x64, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x63, 0x38, 0xFF, 0xB5, 0x00, 0x00, 0x00, 
-0x00, 0xB4, 0xFF, 0x37, 0x0C, 0xFE, 0xDE, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0x0C, 0x00, 0xDF, 
-0xFD, 0x09, 0x00, 0x00, 0x06, 0xFC, 0xDE, 0x00, 0x00, 0xB2, 0xFF, 0x2F, 0x00, 0x00, 0x2B, 0xFF, 
-0xB1, 0x00, 0x00, 0x86, 0xFF, 0x57, 0x00, 0x00, 0x53, 0xFF, 0x85, 0x00, 0x00, 0x59, 0xFF, 0x80, 
-0x00, 0x00, 0x7B, 0xFF, 0x58, 0x00, 0x00, 0x2D, 0xFF, 0xA8, 0x00, 0x00, 0xA2, 0xFF, 0x2C, 0x00, 
-0x00, 0x05, 0xFA, 0xD1, 0x00, 0x00, 0xCA, 0xFA, 0x05, 0x00, 0x00, 0x00, 0xD4, 0xF7, 0x02, 0x00, 
-0xF1, 0xD3, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0x22, 0x1A, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 
-0x7B, 0xFF, 0x4A, 0x42, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0x72, 0x6A, 0xFF, 0x4D, 
-0x00, 0x00, 0x00, 0x00, 0x22, 0xFF, 0x9B, 0x91, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF3, 
-0xC3, 0xB9, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xE9, 0xDE, 0xC8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x9C, 0xFB, 0xF5, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 
-0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x10, 0xFF, 0xFF, 
-0x0F, 0x00, 0x00, 0x11, 0xFF, 0xEE, 0xCE, 0xFF, 0x32, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0x2F, 0x00, 
-0x00, 0x34, 0xFF, 0xCD, 0xAD, 0xFF, 0x53, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x56, 
-0xFF, 0xAC, 0x8B, 0xFF, 0x75, 0x00, 0x00, 0x73, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x79, 0xFF, 0x8A, 
-0x6A, 0xFF, 0x96, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x9B, 0xFF, 0x69, 0x49, 0xFF, 
-0xB8, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xAE, 0x00, 0x00, 0xBD, 0xFF, 0x48, 0x27, 0xFF, 0xD9, 0x00, 
-0x00, 0xD5, 0xFE, 0xFF, 0xCD, 0x00, 0x00, 0xE0, 0xFF, 0x26, 0x07, 0xFE, 0xF9, 0x02, 0x00, 0xF5, 
-0xF1, 0xF8, 0xED, 0x00, 0x05, 0xFC, 0xFE, 0x07, 0x00, 0xE4, 0xFF, 0x1D, 0x17, 0xFF, 0xD5, 0xDD, 
-0xFF, 0x0D, 0x24, 0xFF, 0xE3, 0x00, 0x00, 0xC3, 0xFF, 0x3E, 0x37, 0xFF, 0xB5, 0xBC, 0xFF, 0x2D, 
-0x47, 0xFF, 0xC2, 0x00, 0x00, 0xA2, 0xFF, 0x60, 0x58, 0xFF, 0x94, 0x9B, 0xFF, 0x4C, 0x69, 0xFF, 
-0xA1, 0x00, 0x00, 0x80, 0xFF, 0x81, 0x79, 0xFF, 0x74, 0x7B, 0xFF, 0x6C, 0x8C, 0xFF, 0x7F, 0x00, 
-0x00, 0x5F, 0xFF, 0xA3, 0x9A, 0xFF, 0x53, 0x5A, 0xFF, 0x8C, 0xAE, 0xFF, 0x5E, 0x00, 0x00, 0x3D, 
-0xFF, 0xC4, 0xBA, 0xFF, 0x33, 0x39, 0xFF, 0xAB, 0xD0, 0xFF, 0x3C, 0x00, 0x00, 0x1C, 0xFF, 0xE6, 
-0xDB, 0xFF, 0x13, 0x18, 0xFF, 0xCB, 0xF2, 0xFF, 0x1B, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0xF2, 0xF2, 
-0x00, 0x00, 0xF6, 0xED, 0xFF, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xD9, 0xFF, 0xFE, 0xD2, 0x00, 0x00, 
-0xD6, 0xFE, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0xB5, 0xFF, 
-0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0x95, 
-0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x73, 0xFF, 0xFF, 0x74, 0x00, 0x00, 
-0x00, 0x00, 0x54, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 
-0x32, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x00, 0x11, 0xFF, 
-0xFF, 0x10, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0xD0, 0xFF, 0x33, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x33, 0xFF, 0xD8, 0x6C, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0x73, 
-0x10, 0xF5, 0xF3, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0xF8, 0x14, 0x00, 0xA0, 0xFF, 0x68, 0x00, 
-0x00, 0x00, 0x66, 0xFF, 0xA6, 0x00, 0x00, 0x39, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x40, 
-0x00, 0x00, 0x00, 0xD3, 0xFF, 0x36, 0x00, 0x31, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 
-0x9D, 0x00, 0x98, 0xFF, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0xF5, 0x1B, 0xF2, 0xF9, 0x14, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0xC8, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x37, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xD9, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0C, 0xF4, 0xFF, 0xFE, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xEC, 0xFF, 
-0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xFF, 0x4C, 0xFF, 0xDD, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x28, 0xFF, 0xC6, 0x00, 0xC7, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0x67, 0x00, 
-0x68, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x05, 0xE9, 0xF8, 0x10, 0x00, 0x11, 0xF8, 0xF1, 0x09, 0x00, 
-0x00, 0x51, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x5A, 0x00, 0x00, 0xB3, 0xFF, 0x4B, 0x00, 
-0x00, 0x00, 0x4C, 0xFF, 0xB9, 0x00, 0x19, 0xFC, 0xE8, 0x04, 0x00, 0x00, 0x00, 0x04, 0xE8, 0xFD, 
-0x1A, 0x79, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0x75, 0xDA, 0xFF, 0x2F, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD3, 0xDD, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x2C, 0xFF, 0xDC, 0x82, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x81, 0x27, 
-0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xFF, 0x26, 0x00, 0xCB, 0xFF, 0x38, 0x00, 
-0x00, 0x00, 0x00, 0x36, 0xFF, 0xCA, 0x00, 0x00, 0x70, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x8F, 
-0xFF, 0x6F, 0x00, 0x00, 0x17, 0xFC, 0xE7, 0x03, 0x00, 0x00, 0x02, 0xE5, 0xFC, 0x17, 0x00, 0x00, 
-0x00, 0xB9, 0xFF, 0x43, 0x00, 0x00, 0x40, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x9D, 
-0x00, 0x00, 0x99, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0xEF, 0x06, 0x04, 0xEC, 0xF5, 
-0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0x4F, 0x4A, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x3F, 0xFF, 0xA8, 0xA2, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 
-0xF5, 0xF2, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x84, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x26, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xC3, 0xF7, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFC, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 
-0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFE, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF3, 
-0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 
-0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0x94, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xF2, 0x06, 
-0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0x5D, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xB8, 0xFC, 0x13, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0xC2, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x54, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0x26, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x86, 0xFA, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xFA, 0xFF, 0xFF, 0xFF, 0xCE, 0xFF, 0x26, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x0E, 0xF5, 0xE9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x54, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD5, 0xFD, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 
-0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xF9, 0xE3, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x44, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDD, 0xFB, 0x19, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x19, 0xFB, 0xDD, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 
-0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0xE4, 0xF8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x83, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xD5, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x55, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEA, 0xF5, 
-0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x6E, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x71, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x86, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x09, 0xE9, 0xFF, 0xEF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xD3, 
-0xFF, 0x73, 0x00, 0x00, 0x00, 0x05, 0xE2, 0xE5, 0x13, 0xE7, 0xE4, 0x05, 0x00, 0x00, 0x62, 0xFF, 
-0x69, 0x00, 0x6C, 0xFF, 0x60, 0x00, 0x02, 0xD9, 0xDD, 0x05, 0x00, 0x06, 0xE1, 0xD6, 0x01, 0x57, 
-0xFF, 0x5D, 0x00, 0x00, 0x00, 0x63, 0xFF, 0x4D, 0xCF, 0xD4, 0x02, 0x00, 0x00, 0x00, 0x04, 0xDA, 
-0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0xFF, 0xEC, 0x09, 0x02, 0xAE, 0xFF, 0x64, 0x00, 
-0x08, 0xC2, 0xD1, 0x5D, 0xBE, 0xF3, 0xFF, 0xFF, 0xF4, 0xBC, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x03, 0x85, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xFF, 0x17, 0x47, 0x77, 
-0xA7, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 
-0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x15, 0x3F, 0x7F, 
-0xD8, 0xED, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xE0, 0xA1, 0x61, 
-0x20, 0xFF, 0xF5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x04, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0x62, 0xFF, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xB6, 0x2F, 0x00, 0x0C, 0x94, 0xED, 0xFF, 0xFF, 
-0xF0, 0xA0, 0x10, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xF0, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xA0, 0x10, 0xA1, 0xF0, 0xFF, 0xFF, 0xF0, 0xA1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x2F, 0xB6, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF4, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xB6, 0xFF, 0x64, 0x04, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0x04, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE9, 0xFF, 0x62, 0x04, 0x00, 
-0x00, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x95, 0xE9, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x15, 0xB3, 0xF5, 0xFF, 0xFF, 0xF5, 0xB2, 0x15, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xA0, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x15, 0xB4, 0xF6, 0xFF, 0xFF, 
-0xF2, 0xAA, 0x1A, 0x00, 0x00, 0x08, 0x8D, 0xED, 0xFF, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0A, 0x94, 0xE8, 
-0xFF, 0xFF, 0xFF, 0xE8, 0xE8, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xFF, 0x62, 
-0x04, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0x04, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB7, 0xFF, 0x62, 0x04, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0xF4, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xB7, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xD2, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x1B, 0xB6, 0xF7, 0xFF, 0xFF, 0xF5, 0xAD, 0x0F, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x33, 0x91, 0xDE, 0xEF, 0x5C, 0xFF, 0xFF, 0xD1, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xFF, 0xDC, 0x85, 0x2C, 0xFF, 0xF9, 0xFF, 0xFF, 0x34, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x04, 0x08, 0xFF, 0xFF, 0x04, 0x08, 0xFF, 0xFF, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x04, 0x00, 0x08, 0xFF, 0xFF, 0x04, 0x00, 
-0x08, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0xFF, 0xFF, 0xFF, 
-0xB1, 0x00, 0xFF, 0xE6, 0x9C, 0x14, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xB9, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0xE9, 0xF7, 0x23, 0xFF, 
-0xFF, 0x00, 0x00, 0xA9, 0xFF, 0x7B, 0x00, 0xFF, 0xFF, 0x00, 0x52, 0xFF, 0xD6, 0x06, 0x00, 0xFF, 
-0xFF, 0x13, 0xE8, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xA6, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x24, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0xFF, 0x88, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x35, 0xFE, 0xF6, 0x1A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x9E, 0xFF, 0x99, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x17, 0xF1, 0xFB, 0x26, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x74, 0xFF, 0xAA, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x05, 0xD9, 0xFE, 0x33, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xBB, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x2B, 0x93, 0xDF, 0xEC, 0x35, 0x00, 0x30, 0x91, 0xDD, 0xEF, 0x5C, 0xFF, 0xFF, 0xB8, 0xFF, 0xFF, 
-0xF5, 0xFF, 0xCB, 0xC4, 0xFF, 0xFF, 0xF5, 0xFF, 0xD9, 0xFF, 0xFF, 0xFF, 0xDC, 0x73, 0x10, 0xFF, 
-0xFF, 0xFF, 0xDC, 0x73, 0x10, 0xFF, 0xF9, 0xFF, 0xFF, 0x4A, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x4A, 
-0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x0F, 0x57, 0xA4, 0xED, 0xE5, 0x49, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD3, 0xFF, 0xFF, 0xF5, 0xB5, 0x6D, 0x24, 0xFF, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x0F, 0xAC, 0xF4, 0xFF, 0xFF, 0xF4, 0xAC, 0x0F, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x95, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xEC, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x0F, 0xAD, 0xF5, 0xFF, 0xFF, 0xF5, 0xAD, 
-0x0F, 0xFF, 0xFF, 0x07, 0x3E, 0x86, 0xDB, 0xEF, 0x5C, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD9, 0xFF, 0xFF, 0xF5, 0xB5, 0x6D, 0x24, 0xFF, 0xF9, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xEE, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0x62, 0xFF, 
-0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x9D, 0x13, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0A, 0x94, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xE9, 0xFF, 0x6A, 0x08, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xF4, 0xFF, 0x24, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB7, 0xFF, 0xBD, 0x29, 0x04, 0x00, 0xFF, 
-0xFF, 0x2F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xB7, 0xF4, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x14, 0x6D, 0xBE, 0xF1, 0xE3, 0x37, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xBD, 0xFF, 0xFF, 0xC4, 0x8D, 0x55, 0x1C, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0F, 0x94, 0xEB, 0xFF, 0xFF, 0xEA, 0x93, 0x0E, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xAB, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xE4, 0xFF, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x49, 0xF3, 0xFF, 0xB4, 0x13, 0x00, 0x00, 
-0x00, 0x00, 0x27, 0xD2, 0xFF, 0xE3, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9A, 0xFF, 0xFC, 0x79, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x59, 0xF2, 0xFF, 0x93, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x26, 0xFF, 
-0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF4, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x0F, 0x96, 0xED, 0xFF, 0xFF, 0xED, 0x96, 
-0x0F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x16, 
-0xA8, 0xF1, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0x0B, 0x23, 0x3B, 
-0x53, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xE1, 0xF8, 0xE4, 0xCA, 
-0xAE, 0xFF, 0xFF, 0xE5, 0xFF, 0x19, 0x00, 0x00, 0x19, 0xFF, 0xE4, 0xAE, 0xFF, 0x4B, 0x00, 0x00, 
-0x4C, 0xFF, 0xAD, 0x77, 0xFF, 0x7D, 0x00, 0x00, 0x7E, 0xFF, 0x76, 0x40, 0xFF, 0xAF, 0x00, 0x00, 
-0xB0, 0xFF, 0x3F, 0x0C, 0xFD, 0xE1, 0x00, 0x00, 0xE2, 0xFC, 0x0C, 0x00, 0xD2, 0xFF, 0x13, 0x13, 
-0xFF, 0xD1, 0x00, 0x00, 0x9C, 0xFF, 0x45, 0x46, 0xFF, 0x9A, 0x00, 0x00, 0x65, 0xFF, 0x77, 0x78, 
-0xFF, 0x64, 0x00, 0x00, 0x2E, 0xFF, 0xA9, 0xAA, 0xFF, 0x2D, 0x00, 0x00, 0x03, 0xF4, 0xDB, 0xDC, 
-0xF3, 0x03, 0x00, 0x00, 0x00, 0xC0, 0xFE, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 
-0x88, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 
-0x1B, 0x00, 0x00, 0xE5, 0xFF, 0x19, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x19, 0xFF, 
-0xE4, 0xAE, 0xFF, 0x4C, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x4D, 0xFF, 0xAD, 0x77, 
-0xFF, 0x7F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x80, 0xFF, 0x76, 0x40, 0xFF, 0xB2, 
-0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0xB3, 0xFF, 0x3F, 0x0C, 0xFD, 0xE6, 0x00, 0x00, 
-0xE6, 0xE5, 0xE6, 0xE6, 0x00, 0x00, 0xE6, 0xFC, 0x0C, 0x00, 0xD2, 0xFF, 0x19, 0x19, 0xFF, 0xB2, 
-0xB3, 0xFF, 0x19, 0x19, 0xFF, 0xD1, 0x00, 0x00, 0x9C, 0xFF, 0x4C, 0x4D, 0xFF, 0x7F, 0x80, 0xFF, 
-0x4C, 0x4D, 0xFF, 0x9A, 0x00, 0x00, 0x65, 0xFF, 0x7F, 0x80, 0xFF, 0x4C, 0x4D, 0xFF, 0x7F, 0x80, 
-0xFF, 0x64, 0x00, 0x00, 0x2E, 0xFF, 0xB2, 0xB3, 0xFF, 0x19, 0x1A, 0xFF, 0xB2, 0xB3, 0xFF, 0x2D, 
-0x00, 0x00, 0x03, 0xF4, 0xE6, 0xE6, 0xE5, 0x00, 0x00, 0xE6, 0xE6, 0xE6, 0xF3, 0x03, 0x00, 0x00, 
-0x00, 0xC0, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x89, 
-0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 
-0x4C, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x19, 0x00, 
-0x00, 0x1A, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x41, 0xFF, 
-0xC3, 0x00, 0x42, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0x39, 0x00, 0x00, 0xC3, 0xFF, 0x49, 
-0x00, 0x4A, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xCB, 0x01, 0xCC, 0xFB, 0x27, 0x00, 0x00, 
-0x00, 0x00, 0xC5, 0xFF, 0x9E, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xF5, 
-0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC7, 0xFF, 0xEE, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xF4, 0xFF, 0x71, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xC7, 0xFC, 0x44, 0xFC, 0xE3, 0x05, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xA5, 
-0x00, 0xA6, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x2E, 0x00, 0x2E, 0xFF, 0xD5, 0x01, 0x00, 
-0x49, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x4D, 0x07, 0xC8, 0xFF, 0x3C, 0x00, 0x00, 0x00, 
-0x3C, 0xFF, 0xC4, 0xE5, 0xFF, 0x14, 0x00, 0x00, 0x15, 0xFF, 0xE4, 0xAE, 0xFF, 0x3E, 0x00, 0x00, 
-0x41, 0xFF, 0xAD, 0x77, 0xFF, 0x68, 0x00, 0x00, 0x6D, 0xFF, 0x76, 0x40, 0xFF, 0x92, 0x00, 0x00, 
-0x98, 0xFF, 0x3F, 0x0C, 0xFD, 0xBC, 0x00, 0x00, 0xC3, 0xFC, 0x0C, 0x00, 0xD2, 0xE6, 0x00, 0x00, 
-0xEE, 0xD1, 0x00, 0x00, 0x9C, 0xFF, 0x10, 0x1A, 0xFF, 0x9A, 0x00, 0x00, 0x65, 0xFF, 0x3A, 0x45, 
-0xFF, 0x64, 0x00, 0x00, 0x2E, 0xFF, 0x64, 0x71, 0xFF, 0x2D, 0x00, 0x00, 0x03, 0xF4, 0x8E, 0x9C, 
-0xF3, 0x03, 0x00, 0x00, 0x00, 0xC0, 0xB8, 0xC7, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x89, 0xE3, 0xF1, 
-0x88, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 
-0x1B, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xBF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x6A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0x15, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x1D, 
-0xF8, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFC, 
-0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFE, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xA8, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFB, 0x25, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x99, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xC2, 0xF7, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0x8B, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x78, 0xDD, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x7B, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0xFF, 0x8E, 0x1A, 0x03, 0x09, 0x00, 0x00, 0xFF, 0xFF, 0x08, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xD2, 0x00, 
-0x00, 0x00, 0x00, 0x59, 0xFF, 0xF9, 0x44, 0x00, 0x00, 0x00, 0x00, 0xED, 0xFF, 0x8F, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4E, 0xFC, 0xFC, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xFF, 0xDE, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x05, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0x84, 0x16, 0x01, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0x84, 0xE1, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xDD, 0x75, 0x02, 0x00, 0x00, 0xFD, 0xF7, 0xFF, 0xFF, 0xFF, 
-0x78, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x85, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 
-0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDF, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x2B, 0xF9, 0xED, 0x00, 0x00, 0x00, 0x00, 0x34, 0xE6, 0xFC, 0x4E, 0x00, 0x00, 0x00, 0x00, 0xD5, 
-0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x7B, 0xFF, 0xE8, 0x00, 0x00, 0xFB, 0xF6, 0xFF, 0xFF, 0xFF, 
-0x89, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xE0, 0x7F, 0x05, 0x00, 0x00, 0xBF, 0xF0, 0xC3, 0x77, 0x24, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7D, 0x29, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x2A, 0x7E, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x25, 0x78, 
-0xC3, 0xF0, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x9E, 0x00, 
-0x00, 0xAA, 0xA5, 0x00, 0x00, 0xB0, 0xAB, 0x00, 0x00, 0xB6, 0xB1, 0x00, 0x00, 0xBC, 0xB7, 0x00, 
-0x00, 0xC2, 0xBD, 0x00, 0x00, 0xC8, 0xC3, 0x00, 0x00, 0xCE, 0xC9, 0x00, 0x00, 0xD4, 0xCF, 0x00, 
-0x00, 0xDB, 0xD6, 0x00, 0x00, 0xE1, 0xDC, 0x00, 0x00, 0xE7, 0xE2, 0x00, 0x00, 0xED, 0xE8, 0x00, 
-0x00, 0xF3, 0xEE, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0xFE, 0xFA, 0x00, 0x05, 0xFF, 0xFF, 0x01, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x10, 0xA0, 0xF0, 0xFF, 0xFF, 0xF0, 0xA0, 0x10, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 
-0xF0, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xF1, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 
-0x13, 0xA9, 0xF6, 0xFF, 0xFF, 0xF5, 0xA9, 0x12, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA1, 0xF2, 0xFF, 0xFF, 0xF2, 
-0x9F, 0x0C, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0xF3, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 
-0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xC0, 0x1F, 0xBE, 0xFF, 0xE3, 0x25, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xE3, 0xFF, 0xBD, 0x1A, 0xD6, 0xFF, 0xE6, 0x29, 0x00, 
-0x00, 0x00, 0x00, 0x27, 0xE5, 0xFF, 0xD6, 0x1A, 0x00, 0x14, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xCE, 0x15, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x14, 0xCC, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0x12, 0x00, 0x1A, 0xD5, 0xFF, 0xE5, 0x27, 0x00, 0x00, 0x00, 
-0x00, 0x2A, 0xE7, 0xFF, 0xD4, 0x19, 0xBE, 0xFF, 0xE3, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x26, 0xE4, 0xFF, 0xBD, 0x20, 0xC1, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-0xC1, 0x1F, 0xD4, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xE2, 0x78, 0xFF, 0x82, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0x96, 0x1C, 0xFD, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xA4, 0xFF, 0x49, 0x00, 0xBD, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xF5, 0x08, 0x00, 0x5F, 
-0xFF, 0x88, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xB0, 0x00, 0x00, 0x0B, 0xF4, 0xDE, 0x00, 0x00, 0x00, 
-0x68, 0xFF, 0x63, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x36, 0x00, 0x00, 0xAA, 0xFE, 0x18, 0x00, 0x00, 
-0x00, 0x43, 0xFF, 0x8E, 0x00, 0x01, 0xEA, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE1, 0xE3, 0x01, 
-0x2D, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x3C, 0x6E, 0xFF, 0xFF, 0xFF, 0xEC, 
-0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x93, 0xAF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xCA, 
-0xE8, 0xEE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x36, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0xA4, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xF2, 0xA5, 0x0E, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF3, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xD1, 0xFF, 0xC8, 0x58, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0xFC, 0xFF, 0xE4, 
-0x79, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xF9, 0xFF, 0xFF, 0xF6, 0x9A, 0x2B, 0x00, 
-0x00, 0x10, 0x93, 0xFA, 0xFF, 0xEB, 0xB3, 0xF2, 0xFF, 0xFF, 0xBA, 0x27, 0xC2, 0xFF, 0xAA, 0x4E, 
-0x05, 0x00, 0x08, 0x54, 0xAC, 0xFF, 0xD7, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0xDA, 0xFF, 0xA0, 0x38, 0x00, 0x00, 0x03, 0x47, 
-0xA4, 0xFF, 0xB9, 0x28, 0xBA, 0xFF, 0xFF, 0xD1, 0x96, 0xE6, 0xFF, 0xEC, 0x7C, 0x0A, 0x00, 0x00, 
-0x2B, 0x9B, 0xF6, 0xFF, 0xFF, 0xD1, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x7A, 0xE4, 
-0xFF, 0xEF, 0x88, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0xC8, 0xFF, 0xC9, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 
-0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0F, 0xA6, 0xF3, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xF3, 0xA7, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x1C, 0xAC, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xAC, 0x1C, 0xB9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xB8, 0xF6, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xC6, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xF5, 0xBA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xB8, 0x1C, 0xAD, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAD, 
-0x1C, 0x1D, 0xB7, 0xF2, 0xFF, 0xF6, 0xC3, 0x2A, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xDE, 
-0xFF, 0x20, 0x00, 0x00, 0xFF, 0xF6, 0xE8, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x2A, 0xC2, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xCA, 0xFF, 0xF1, 0xF5, 0xF9, 0xFF, 0xFF, 0x33, 0xD4, 0xFE, 0xEF, 0xC4, 0xFF, 0xFF, 0x00, 0x00, 
-0x06, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xB4, 
-0x00, 0x00, 0x62, 0xFF, 0xB4, 0x00, 0x00, 0x2F, 0xF6, 0xE3, 0x13, 0x00, 0x2F, 0xF6, 0xE3, 0x13, 
-0x00, 0x0E, 0xDB, 0xFC, 0x3D, 0x00, 0x0E, 0xDB, 0xFC, 0x3D, 0x00, 0x00, 0xAD, 0xFF, 0x7B, 0x00, 
-0x00, 0xAD, 0xFF, 0x7B, 0x00, 0x00, 0x73, 0xFF, 0xBB, 0x02, 0x00, 0x73, 0xFF, 0xBB, 0x02, 0x00, 
-0x00, 0xF6, 0xFF, 0x2E, 0x00, 0x00, 0xF6, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x73, 0xFF, 0xB8, 0x01, 
-0x00, 0x73, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0x74, 0x00, 0x00, 0xAE, 0xFF, 0x74, 
-0x00, 0x00, 0x00, 0x0F, 0xDB, 0xFA, 0x33, 0x00, 0x0F, 0xDB, 0xFA, 0x33, 0x00, 0x00, 0x00, 0x2F, 
-0xF7, 0xDB, 0x0C, 0x00, 0x2F, 0xF7, 0xDB, 0x0C, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xA2, 0x00, 0x00, 
-0x62, 0xFF, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x1C, 0xB8, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 
-0xB8, 0x1C, 0xAD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xAC, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0xFF, 
-0xFF, 0xF7, 0xA3, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x6B, 0xFF, 0x40, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x0B, 0xEE, 0xC2, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8A, 0xFF, 0x43, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0xFB, 0xC5, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xA9, 0xFF, 0x46, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x38, 0xFF, 0xC4, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF2, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xAD, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAC, 0x1C, 0xBA, 0xF6, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xB9, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0xCF, 0xFA, 0xFF, 0xFA, 0xCF, 0x37, 0xD1, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFB, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xD1, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0x38, 0xD0, 
-0xFA, 0xFF, 0xFA, 0xD0, 0x37, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x10, 0x09, 0xED, 0xFF, 0x98, 0x65, 0xFF, 0xB0, 0x03, 0xD1, 0xC5, 0x09, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x0D, 0x25, 0xA0, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xF5, 0xD6, 0x5E, 0xFC, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xF3, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xF6, 0x9C, 0x22, 0xFF, 0xFF, 
-0x08, 0x64, 0xFF, 0xDF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 
-0x2A, 0xC3, 0xF6, 0xFF, 0xF6, 0xC3, 0x2A, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF7, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xC4, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x2B, 0xC4, 0xF7, 0xFF, 0xF7, 0xC4, 0x2A, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0xFF, 0x62, 0x00, 0x00, 0xA3, 0xFF, 
-0x62, 0x00, 0x00, 0x00, 0x0D, 0xDB, 0xF6, 0x2F, 0x00, 0x0D, 0xDB, 0xF6, 0x2F, 0x00, 0x00, 0x00, 
-0x34, 0xFA, 0xDB, 0x0E, 0x00, 0x34, 0xFA, 0xDB, 0x0E, 0x00, 0x00, 0x00, 0x75, 0xFF, 0xAD, 0x00, 
-0x00, 0x75, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x01, 0xB9, 0xFF, 0x72, 0x00, 0x01, 0xB9, 0xFF, 0x72, 
-0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF6, 0x00, 0x00, 0x2F, 0xFF, 0xF6, 0x00, 0x00, 0x02, 0xBB, 0xFF, 
-0x72, 0x00, 0x02, 0xBB, 0xFF, 0x72, 0x00, 0x00, 0x7C, 0xFF, 0xAE, 0x00, 0x00, 0x7C, 0xFF, 0xAE, 
-0x00, 0x00, 0x3D, 0xFC, 0xDB, 0x0E, 0x00, 0x3D, 0xFC, 0xDB, 0x0E, 0x00, 0x13, 0xE3, 0xF6, 0x2F, 
-0x00, 0x13, 0xE3, 0xF6, 0x2F, 0x00, 0x00, 0xB4, 0xFF, 0x62, 0x00, 0x00, 0xB4, 0xFF, 0x62, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xEC, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xEC, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0xF1, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFF, 0x96, 0x00, 
-0x00, 0x00, 0x00, 0x1B, 0xF3, 0xEF, 0x16, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x6B, 0x00, 0x00, 
-0x00, 0x00, 0x47, 0xFF, 0xCE, 0x03, 0x00, 0x00, 0x00, 0x00, 0xCB, 0xFF, 0x38, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xB1, 0x18, 0xB1, 0xF5, 0xFF, 0xFF, 0xF5, 0xB2, 0x18, 0x00, 0x00, 0x00, 0x97, 0xFF, 0xEC, 
-0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0xC2, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 
-0xFF, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 
-0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xE0, 0xEF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFF, 0x94, 0xA3, 0xFF, 0x21, 
-0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 
-0x49, 0x55, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x23, 0x2E, 0xFF, 0xA6, 0x00, 0x00, 
-0x00, 0x00, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x00, 0x00, 0x00, 0x06, 0xFB, 0xD7, 0x00, 0x00, 
-0xE1, 0xFA, 0x05, 0x00, 0x00, 0x2E, 0xFF, 0xB1, 0x00, 0x00, 0xBA, 0xFF, 0x2C, 0x00, 0x00, 0x5B, 
-0xFF, 0x8C, 0x00, 0x00, 0x94, 0xFF, 0x58, 0x00, 0x00, 0x88, 0xFF, 0x66, 0x00, 0x00, 0x6D, 0xFF, 
-0x85, 0x00, 0x00, 0xB4, 0xFF, 0x40, 0x00, 0x00, 0x46, 0xFF, 0xB1, 0x00, 0x00, 0xE1, 0xFF, 0x1A, 
-0x00, 0x00, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0C, 
-0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x67, 0xFF, 0xAE, 0x00, 0x00, 0x00, 
-0x00, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x90, 0xC0, 0xFF, 
-0x4A, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1A, 
-0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x65, 0xFF, 0xB0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x43, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6F, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 
-0xE0, 0xEF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x22, 0xFF, 0x94, 0xA3, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x6E, 0x7C, 
-0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x49, 0x55, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 
-0xA8, 0xFF, 0x23, 0x2E, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 
-0x00, 0x00, 0x00, 0x06, 0xFB, 0xD7, 0x00, 0x00, 0xE1, 0xFA, 0x05, 0x00, 0x00, 0x2E, 0xFF, 0xB1, 
-0x00, 0x00, 0xBA, 0xFF, 0x2C, 0x00, 0x00, 0x5B, 0xFF, 0x8C, 0x00, 0x00, 0x94, 0xFF, 0x58, 0x00, 
-0x00, 0x88, 0xFF, 0x66, 0x00, 0x00, 0x6D, 0xFF, 0x85, 0x00, 0x00, 0xB4, 0xFF, 0x40, 0x00, 0x00, 
-0x46, 0xFF, 0xB1, 0x00, 0x00, 0xE1, 0xFF, 0x1A, 0x00, 0x00, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0C, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x37, 0x67, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xBC, 
-0xEC, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x01, 0x93, 0xFF, 
-0x9B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x00, 0x00, 0x00, 
-0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 
-0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xE0, 0xEF, 
-0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x22, 0xFF, 0x94, 0xA3, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 
-0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x49, 0x55, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 
-0x23, 0x2E, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x00, 0x00, 
-0x00, 0x06, 0xFB, 0xD7, 0x00, 0x00, 0xE1, 0xFA, 0x05, 0x00, 0x00, 0x2E, 0xFF, 0xB1, 0x00, 0x00, 
-0xBA, 0xFF, 0x2C, 0x00, 0x00, 0x5B, 0xFF, 0x8C, 0x00, 0x00, 0x94, 0xFF, 0x58, 0x00, 0x00, 0x88, 
-0xFF, 0x66, 0x00, 0x00, 0x6D, 0xFF, 0x85, 0x00, 0x00, 0xB4, 0xFF, 0x40, 0x00, 0x00, 0x46, 0xFF, 
-0xB1, 0x00, 0x00, 0xE1, 0xFF, 0x1A, 0x00, 0x00, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0C, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 
-0x67, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 
-0x18, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x00, 0x00, 0x66, 0xEC, 0xE9, 0x98, 0x32, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x32, 0x97, 0xE9, 0xEC, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 
-0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x70, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0x9B, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xE0, 0xEF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 
-0xBA, 0xC9, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFF, 0x94, 0xA3, 0xFF, 0x21, 0x00, 0x00, 
-0x00, 0x00, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x49, 0x55, 
-0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x23, 0x2E, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 
-0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x00, 0x00, 0x00, 0x06, 0xFB, 0xD7, 0x00, 0x00, 0xE1, 0xFA, 
-0x05, 0x00, 0x00, 0x2E, 0xFF, 0xB1, 0x00, 0x00, 0xBA, 0xFF, 0x2C, 0x00, 0x00, 0x5B, 0xFF, 0x8C, 
-0x00, 0x00, 0x94, 0xFF, 0x58, 0x00, 0x00, 0x88, 0xFF, 0x66, 0x00, 0x00, 0x6D, 0xFF, 0x85, 0x00, 
-0x00, 0xB4, 0xFF, 0x40, 0x00, 0x00, 0x46, 0xFF, 0xB1, 0x00, 0x00, 0xE1, 0xFF, 0x1A, 0x00, 0x00, 
-0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0C, 0x3A, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x67, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xB3, 
-0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x00, 
-0x00, 0x00, 0x00, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 
-0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xE0, 0xEF, 
-0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x22, 0xFF, 0x94, 0xA3, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 
-0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x49, 0x55, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 
-0x23, 0x2E, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x00, 0x00, 
-0x00, 0x06, 0xFB, 0xD7, 0x00, 0x00, 0xE1, 0xFA, 0x05, 0x00, 0x00, 0x2E, 0xFF, 0xB1, 0x00, 0x00, 
-0xBA, 0xFF, 0x2C, 0x00, 0x00, 0x5B, 0xFF, 0x8C, 0x00, 0x00, 0x94, 0xFF, 0x58, 0x00, 0x00, 0x88, 
-0xFF, 0x66, 0x00, 0x00, 0x6D, 0xFF, 0x85, 0x00, 0x00, 0xB4, 0xFF, 0x40, 0x00, 0x00, 0x46, 0xFF, 
-0xB1, 0x00, 0x00, 0xE1, 0xFF, 0x1A, 0x00, 0x00, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0C, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 
-0x67, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 
-0x18, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x00, 0x00, 0x2A, 0xC3, 0xF6, 0xF6, 0xC3, 0x2A, 
-0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xFF, 
-0x00, 0x00, 0xFF, 0xED, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0x00, 0x00, 
-0x00, 0x00, 0x2B, 0xDA, 0xFF, 0xFF, 0xDA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 
-0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x9C, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xE0, 0xEF, 0xC8, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xBA, 0xC9, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFF, 
-0x94, 0xA3, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x6E, 0x7C, 0xFF, 0x4D, 0x00, 0x00, 
-0x00, 0x00, 0x7C, 0xFF, 0x49, 0x55, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x23, 0x2E, 
-0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xF9, 0x03, 0x09, 0xFE, 0xD3, 0x00, 0x00, 0x00, 0x06, 
-0xFB, 0xD7, 0x00, 0x00, 0xE1, 0xFA, 0x05, 0x00, 0x00, 0x2E, 0xFF, 0xB1, 0x00, 0x00, 0xBA, 0xFF, 
-0x2C, 0x00, 0x00, 0x5B, 0xFF, 0x8C, 0x00, 0x00, 0x94, 0xFF, 0x58, 0x00, 0x00, 0x88, 0xFF, 0x66, 
-0x00, 0x00, 0x6D, 0xFF, 0x85, 0x00, 0x00, 0xB4, 0xFF, 0x40, 0x00, 0x00, 0x46, 0xFF, 0xB1, 0x00, 
-0x00, 0xE1, 0xFF, 0x1A, 0x00, 0x00, 0x1F, 0xFF, 0xDE, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0x0C, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x67, 0xFF, 
-0xAE, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x63, 0x93, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0xFF, 0x90, 0xC0, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xBC, 0xEC, 0xFF, 0x18, 0x00, 
-0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFD, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xC9, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x7F, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xED, 0xFF, 0x35, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xFF, 0xEA, 0x01, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xA2, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0x58, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0xFC, 0x11, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xC4, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x7A, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xFF, 0x30, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x22, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF1, 0xFA, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xFD, 0xF7, 0x09, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xAF, 0x17, 0xB2, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 
-0xFF, 0xFF, 0xF5, 0xB1, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xBE, 0xF6, 0x9C, 0x22, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x08, 0x64, 0xFF, 0xDF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xBF, 0x00, 0x00, 0x97, 0xFF, 0xEC, 0x09, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFF, 0x64, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0xC2, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x00, 0x00, 
-0x65, 0xFF, 0xB0, 0x03, 0x00, 0x00, 0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x93, 0xFF, 0x9B, 0x02, 
-0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x97, 0xFF, 0xEC, 0x09, 0x02, 0xAE, 0xFF, 0x64, 0x00, 0x08, 0xC2, 0xD1, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x65, 0xFF, 0xB0, 0x03, 0x00, 0xD1, 0xC5, 0x09, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x93, 0xFF, 0x9B, 0x02, 0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0xB2, 0xD2, 0x46, 0x00, 
-0x4B, 0xD8, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x66, 0xEC, 0xE9, 0x98, 0x32, 
-0xFF, 0xFF, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xFF, 0x32, 
-0x97, 0xE9, 0xEC, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFE, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x14, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 
-0xB7, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0xFA, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x36, 0xFF, 0x5D, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE1, 0xB0, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x8F, 0xF7, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0x56, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xE6, 0xA9, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x95, 0xF3, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x41, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x03, 0xEA, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x9B, 0xEF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xEE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0x00, 0x97, 0xFF, 0xEC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0xAE, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC2, 0xD1, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x17, 0xB2, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 
-0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 
-0xB2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x65, 0xFF, 0xB0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
-0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x17, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xB0, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 0x18, 0x00, 0x00, 
-0x01, 0x93, 0xFF, 0x9B, 0x02, 0x00, 0x00, 0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x00, 
-0x00, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 
-0xFF, 0xF4, 0xB0, 0x17, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xF5, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 0x18, 0x00, 0x00, 0x66, 0xEC, 0xE9, 0x98, 
-0x32, 0xFF, 0xFF, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xFF, 
-0x32, 0x97, 0xE9, 0xEC, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x17, 
-0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 
-0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x17, 0xB2, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 
-0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 
-0xB2, 0x18, 0x1E, 0xBD, 0x1C, 0x00, 0x00, 0x00, 0x1A, 0xC0, 0x22, 0xBB, 0xFF, 0xD8, 0x16, 0x00, 
-0x13, 0xD5, 0xFF, 0xC2, 0x1A, 0xD6, 0xFF, 0xD0, 0x1E, 0xCB, 0xFF, 0xD8, 0x1C, 0x00, 0x15, 0xCF, 
-0xFF, 0xF8, 0xFF, 0xD0, 0x16, 0x00, 0x00, 0x00, 0x21, 0xF9, 0xFF, 0xFA, 0x21, 0x00, 0x00, 0x00, 
-0x15, 0xCF, 0xFF, 0xF9, 0xFF, 0xD0, 0x16, 0x00, 0x1B, 0xD7, 0xFF, 0xCF, 0x21, 0xCF, 0xFF, 0xD8, 
-0x1C, 0xBE, 0xFF, 0xD7, 0x15, 0x00, 0x15, 0xD7, 0xFF, 0xBE, 0x20, 0xBE, 0x1B, 0x00, 0x00, 0x00, 
-0x1B, 0xBE, 0x1F, 0x00, 0x18, 0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x17, 0x00, 0x00, 0x02, 
-0x4C, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x6E, 0x7F, 0x00, 
-0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x19, 0xED, 0x2D, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAA, 0x8B, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x47, 0xE1, 0x0B, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xDC, 0x4F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1E, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x11, 0xE8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x9B, 0x9A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x3A, 0xE8, 0x12, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x04, 0xD2, 0x5E, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x75, 0xBF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1E, 0xED, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB1, 0x83, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xDC, 0x08, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x1D, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 
-0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 0xEC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0xAE, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC2, 0xD1, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xB3, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 
-0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 
-0xFF, 0xB0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 0x18, 0x00, 0x00, 0x01, 
-0x93, 0xFF, 0x9B, 0x02, 0x00, 0x00, 0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x00, 0x00, 
-0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 
-0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xB2, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x1A, 0xB3, 0xF5, 0xFF, 
-0xFF, 0xFF, 0xF5, 0xB2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xB0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 
-0xDC, 0x82, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x81, 0x27, 0xFF, 0xDE, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xFF, 0x26, 0x00, 0xCB, 0xFF, 0x38, 0x00, 0x00, 0x00, 
-0x00, 0x36, 0xFF, 0xCA, 0x00, 0x00, 0x70, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x6F, 
-0x00, 0x00, 0x17, 0xFC, 0xE7, 0x03, 0x00, 0x00, 0x02, 0xE5, 0xFC, 0x17, 0x00, 0x00, 0x00, 0xB9, 
-0xFF, 0x43, 0x00, 0x00, 0x40, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x9D, 0x00, 0x00, 
-0x99, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0xEF, 0x06, 0x04, 0xEC, 0xF5, 0x0C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0x4F, 0x4A, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x3F, 0xFF, 0xA8, 0xA2, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xF5, 0xF2, 
-0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x98, 
-0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x61, 0xFF, 
-0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4A, 0xFF, 
-0xBD, 0xFF, 0xFF, 0x00, 0x00, 0x48, 0xF8, 0xCF, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0xE9, 0x13, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFE, 0xD5, 0x27, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x71, 0xFF, 
-0xC7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF6, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xF7, 0xC4, 
-0x2A, 0x00, 0x97, 0xFF, 0xEC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFF, 0x64, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x08, 0xC2, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xBE, 0xF3, 0xFF, 0xFF, 0xF4, 0xBC, 
-0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x85, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 
-0x98, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xB0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC5, 0x09, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x5D, 0xBE, 0xF3, 0xFF, 0xFF, 0xF4, 0xBC, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x03, 0x85, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0xFF, 
-0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0xFF, 
-0xFF, 0x00, 0x00, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x00, 0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 
-0x05, 0x00, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xBE, 0xF3, 0xFF, 0xFF, 0xF4, 0xBC, 
-0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x85, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0xFF, 0xFF, 0x00, 0x66, 0xEC, 0xE9, 0x98, 0x32, 0xFF, 
-0xFF, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0xFF, 0xFF, 0x32, 0x97, 0xE9, 0xEC, 
-0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x5D, 0xBE, 0xF3, 0xFF, 0xFF, 0xF4, 0xBC, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x03, 0x85, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0xFF, 
-0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xBE, 0xF3, 0xFF, 0xFF, 0xF4, 0xBC, 
-0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x85, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0xFF, 0xFF, 0x00, 0x00, 0x2A, 0xC3, 0xF6, 0xF6, 0xC3, 
-0x2A, 0x00, 0x00, 0xC4, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0x00, 0x00, 0xEE, 0xFF, 0x00, 0x00, 0xFF, 
-0xED, 0x00, 0x00, 0xC4, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0x00, 0x00, 0x2B, 0xC4, 0xF7, 0xF7, 0xC4, 
-0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x5D, 0xBE, 0xF3, 0xFF, 0xFF, 0xF4, 0xBC, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x03, 0x85, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xFF, 0x17, 0x47, 0x77, 0xA7, 0xFF, 
-0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xB6, 0xEA, 0xC4, 0x8F, 0x5F, 0xFF, 
-0xFF, 0x24, 0xB9, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC3, 0x2A, 0xC0, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF6, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x63, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 
-0xFC, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD0, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x02, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x02, 0x08, 0x0E, 
-0x14, 0xFF, 0xFF, 0x08, 0x08, 0x08, 0x08, 0xF8, 0xEA, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x2B, 0xC4, 0xF6, 0xEC, 0xCF, 0xB1, 0xB4, 0xFB, 0xFF, 
-0xFF, 0xFF, 0xF6, 0xC1, 0x26, 0x0C, 0x94, 0xED, 0xFF, 0xFF, 0xF0, 0xA0, 0x10, 0x9A, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xF0, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x10, 0xA1, 0xF0, 
-0xFF, 0xFF, 0xF0, 0xA1, 0x10, 0x00, 0x00, 0x00, 0xF3, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xBE, 0xF6, 0x9C, 0x22, 0x00, 0x00, 0xFF, 0xFF, 0x08, 0x64, 0xFF, 0xDF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x97, 0xFF, 
-0xEC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-0xC2, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xB3, 0xF5, 0xFF, 0xFF, 0xF5, 0xB2, 0x15, 0xA1, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x15, 0xB4, 0xF6, 
-0xFF, 0xFF, 0xF2, 0xAA, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x00, 0x00, 
-0x00, 0x65, 0xFF, 0xB0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xB3, 0xF5, 
-0xFF, 0xFF, 0xF5, 0xB2, 0x15, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x15, 0xB4, 0xF6, 0xFF, 0xFF, 0xF2, 0xAA, 0x1A, 0x00, 0x00, 0x01, 
-0x93, 0xFF, 0x9B, 0x02, 0x00, 0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x00, 0xB2, 0xD2, 
-0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xB3, 0xF5, 0xFF, 0xFF, 0xF5, 0xB2, 0x15, 0xA1, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x15, 0xB4, 0xF6, 
-0xFF, 0xFF, 0xF2, 0xAA, 0x1A, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xB3, 0xF5, 
-0xFF, 0xFF, 0xF5, 0xB2, 0x15, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x15, 0xB4, 0xF6, 0xFF, 0xFF, 0xF2, 0xAA, 0x1A, 0x97, 0xFF, 0xEC, 
-0x09, 0x02, 0xAE, 0xFF, 0x64, 0x00, 0x08, 0xC2, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x65, 
-0xFF, 0xB0, 0x03, 0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x00, 0x04, 
-0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x66, 0xEC, 0xE9, 0x98, 0x32, 0xFF, 0xFF, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 
-0xFF, 0xFF, 0x32, 0x97, 0xE9, 0xEC, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x57, 0xA4, 0xED, 0xE5, 0x49, 0xFF, 
-0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF5, 0xB5, 0x6D, 0x24, 0xFF, 0xF8, 0xFF, 
-0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x97, 0xFF, 0xEC, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0xAE, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC2, 0xD1, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
-0xAC, 0xF4, 0xFF, 0xFF, 0xF4, 0xAC, 0x0F, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xED, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x96, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x0F, 0xAD, 0xF5, 0xFF, 0xFF, 0xF5, 0xAD, 0x0F, 0x00, 
-0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xB0, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xAC, 0xF4, 0xFF, 0xFF, 0xF4, 0xAC, 0x0F, 0x96, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x0F, 
-0xAD, 0xF5, 0xFF, 0xFF, 0xF5, 0xAD, 0x0F, 0x00, 0x00, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x00, 0x00, 
-0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x00, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
-0xAC, 0xF4, 0xFF, 0xFF, 0xF4, 0xAC, 0x0F, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xED, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x96, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x0F, 0xAD, 0xF5, 0xFF, 0xFF, 0xF5, 0xAD, 0x0F, 0x00, 
-0x66, 0xEC, 0xE9, 0x98, 0x32, 0xFF, 0xFF, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 
-0xFF, 0xFF, 0x32, 0x97, 0xE9, 0xEC, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xAC, 0xF4, 0xFF, 0xFF, 0xF4, 0xAC, 0x0F, 0x96, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x0F, 
-0xAD, 0xF5, 0xFF, 0xFF, 0xF5, 0xAD, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
-0xAC, 0xF4, 0xFF, 0xFF, 0xF4, 0xAC, 0x0F, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xED, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x96, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x0F, 0xAD, 0xF5, 0xFF, 0xFF, 0xF5, 0xAD, 0x0F, 0x00, 
-0x00, 0x00, 0x00, 0x87, 0xF3, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xF4, 0x86, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x84, 0xF3, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF3, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xF4, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xAC, 
-0xF4, 0xFF, 0xFF, 0xF4, 0xAC, 0x0F, 0x00, 0x14, 0x5B, 0x00, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x95, 0x09, 0xC7, 0x58, 0x00, 0xED, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xAF, 0x8B, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x01, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3C, 0xE2, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x27, 0xE3, 0x37, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x17, 0xDC, 0x50, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xCB, 0x6E, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x5B, 0x24, 0xAD, 0xF5, 0xFF, 0xFF, 0xF5, 
-0xAD, 0x0F, 0x00, 0x00, 0x00, 0x97, 0xFF, 0xEC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFF, 
-0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC2, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0x0B, 0x23, 0x3B, 0x53, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xE1, 0xF8, 0xE4, 0xCA, 0xAE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xB0, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0x0B, 
-0x23, 0x3B, 0x53, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xE1, 0xF8, 
-0xE4, 0xCA, 0xAE, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x93, 0xFF, 0x9B, 0x02, 0x00, 0x00, 0x04, 0xA3, 
-0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0x00, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 0xD8, 0xB3, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0x0B, 0x23, 0x3B, 0x53, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xE1, 0xF8, 0xE4, 0xCA, 0xAE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0x0B, 
-0x23, 0x3B, 0x53, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xE1, 0xF8, 
-0xE4, 0xCA, 0xAE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x98, 0x00, 0x00, 0x00, 
-0x00, 0x65, 0xFF, 0xB0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC5, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0x14, 
-0x00, 0x00, 0x15, 0xFF, 0xE4, 0xAE, 0xFF, 0x3E, 0x00, 0x00, 0x41, 0xFF, 0xAD, 0x77, 0xFF, 0x68, 
-0x00, 0x00, 0x6D, 0xFF, 0x76, 0x40, 0xFF, 0x92, 0x00, 0x00, 0x98, 0xFF, 0x3F, 0x0C, 0xFD, 0xBC, 
-0x00, 0x00, 0xC3, 0xFC, 0x0C, 0x00, 0xD2, 0xE6, 0x00, 0x00, 0xEE, 0xD1, 0x00, 0x00, 0x9C, 0xFF, 
-0x10, 0x1A, 0xFF, 0x9A, 0x00, 0x00, 0x65, 0xFF, 0x3A, 0x45, 0xFF, 0x64, 0x00, 0x00, 0x2E, 0xFF, 
-0x64, 0x71, 0xFF, 0x2D, 0x00, 0x00, 0x03, 0xF4, 0x8E, 0x9C, 0xF3, 0x03, 0x00, 0x00, 0x00, 0xC0, 
-0xB8, 0xC7, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x89, 0xE3, 0xF1, 0x88, 0x00, 0x00, 0x00, 0x00, 0x52, 
-0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x15, 
-0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 
-0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 
-0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0x14, 0x00, 0x00, 0x15, 0xFF, 0xE4, 0xAE, 0xFF, 0x3E, 
-0x00, 0x00, 0x41, 0xFF, 0xAD, 0x77, 0xFF, 0x68, 0x00, 0x00, 0x6D, 0xFF, 0x76, 0x40, 0xFF, 0x92, 
-0x00, 0x00, 0x98, 0xFF, 0x3F, 0x0C, 0xFD, 0xBC, 0x00, 0x00, 0xC3, 0xFC, 0x0C, 0x00, 0xD2, 0xE6, 
-0x00, 0x00, 0xEE, 0xD1, 0x00, 0x00, 0x9C, 0xFF, 0x10, 0x1A, 0xFF, 0x9A, 0x00, 0x00, 0x65, 0xFF, 
-0x3A, 0x45, 0xFF, 0x64, 0x00, 0x00, 0x2E, 0xFF, 0x64, 0x71, 0xFF, 0x2D, 0x00, 0x00, 0x03, 0xF4, 
-0x8E, 0x9C, 0xF3, 0x03, 0x00, 0x00, 0x00, 0xC0, 0xB8, 0xC7, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x89, 
-0xE3, 0xF1, 0x88, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x1B, 
-0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 
-0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 
-0xFF, 0x15, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x96, 0x00, 0xFF, 0xFF, 
-0x00, 0x14, 0xBF, 0xFF, 0x00, 0xFF, 0xFF, 0x2D, 0xDE, 0xFD, 0x7A, 0x00, 0xFF, 0xFF, 0xF3, 0xF2, 
-0x4E, 0x00, 0x00, 0xFF, 0xFF, 0xDE, 0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x08, 0x9B, 0xFF, 0xFF, 0xCD, 0xFD, 0xFF, 0xFF, 0xEC, 0x46, 0xFF, 0xFF, 
-0x1F, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x13, 0xA8, 
-0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xAA, 
-0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xC3, 
-0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC3, 0x2A, 0xC4, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xC3, 0x2B, 0xC4, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
-0xC4, 0x2A, 0x00, 0xB4, 0xD6, 0x49, 0x00, 0x46, 0xD2, 0xB2, 0x00, 0x00, 0x05, 0xA9, 0xFF, 0xDB, 
-0xFF, 0xA3, 0x04, 0x00, 0x00, 0x00, 0x02, 0x9C, 0xFF, 0x93, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
-0xB1, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xB2, 0x18, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xB2, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0xFF, 
-0xCB, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCA, 0xFF, 0xA9, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x19, 0xE4, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xF6, 0xFE, 0x57, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFE, 0xF6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
-0xFF, 0xE5, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0xFF, 0xCC, 0x0A, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x09, 0xCB, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xEF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xB3, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x1A, 0xB3, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xB4, 0x1A, 0x00, 0xB4, 
-0xD6, 0x49, 0x00, 0x46, 0xD2, 0xB2, 0x00, 0x05, 0xA9, 0xFF, 0xDB, 0xFF, 0xA3, 0x04, 0x00, 0x00, 
-0x02, 0x9C, 0xFF, 0x93, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x94, 0xEB, 0xFF, 0xFF, 0xEA, 0x93, 0x0E, 0xAC, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0xFF, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x49, 0xF3, 
-0xFF, 0xB4, 0x13, 0x00, 0x00, 0x00, 0x00, 0x27, 0xD2, 0xFF, 0xE3, 0x3C, 0x00, 0x00, 0x00, 0x00, 
-0x09, 0x9A, 0xFF, 0xFC, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x59, 0xF2, 0xFF, 0x93, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x26, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x0F, 0x96, 
-0xED, 0xFF, 0xFF, 0xED, 0x96, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xDD, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xDC, 0x82, 0xFF, 
-0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x81, 0x27, 0xFF, 0xDE, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xDD, 0xFF, 0x26, 0x00, 0xCB, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 
-0xCA, 0x00, 0x00, 0x70, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x6F, 0x00, 0x00, 0x17, 
-0xFC, 0xE7, 0x03, 0x00, 0x00, 0x02, 0xE5, 0xFC, 0x17, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0x43, 0x00, 
-0x00, 0x40, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x9D, 0x00, 0x00, 0x99, 0xFF, 0x5D, 
-0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0xEF, 0x06, 0x04, 0xEC, 0xF5, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xA4, 0xFF, 0x4F, 0x4A, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xA8, 
-0xA2, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xF5, 0xF2, 0xDC, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x31, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xD6, 0x49, 0x00, 0x46, 0xD2, 0xB2, 0x00, 0x05, 
-0xA9, 0xFF, 0xDB, 0xFF, 0xA3, 0x04, 0x00, 0x00, 0x02, 0x9C, 0xFF, 0x93, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x26, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0x50, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC3, 0xF7, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFC, 0xB5, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x5F, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFE, 0x1A, 0x00, 0x00, 0x00, 
-0x00, 0x07, 0xF3, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x97, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x32, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xCE, 0xF2, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 
-0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFC, 0x13, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8, 
-0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 
-0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xB4, 0xD6, 0x49, 0x00, 0x46, 0xD2, 0xB2, 0x00, 0x05, 
-0xA9, 0xFF, 0xDB, 0xFF, 0xA3, 0x04, 0x00, 0x00, 0x02, 0x9C, 0xFF, 0x93, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x90, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF8, 0xC4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x9C, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFC, 0xB6, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xA9, 0xFE, 0x31, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB6, 0xFB, 0x25, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 
-0xF7, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x63, 0xEE, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEE, 
-0xFF, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 
-0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x73, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xDF, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0xF8, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x02, 0xF9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0x83, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xCD, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xFE, 0x0A, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x4A, 0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0x8F, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xC7, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x14, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x45, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x9A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC2, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 
-0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xF5, 0xFF, 0xF5, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93, 
-0xFF, 0x9B, 0x02, 0x00, 0x04, 0xA3, 0xFF, 0xDC, 0xFF, 0xA8, 0x05, 0xB2, 0xD2, 0x46, 0x00, 0x4B, 
-0xD8, 0xB3, 0xB4, 0xD6, 0x49, 0x00, 0x46, 0xD2, 0xB2, 0x05, 0xA9, 0xFF, 0xDB, 0xFF, 0xA3, 0x04, 
-0x00, 0x02, 0x9C, 0xFF, 0x93, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 
-0x00, 0xFF, 0xFD, 0xAE, 0xFD, 0xFF, 0xFF, 0xFD, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x2A, 0xC3, 0xF6, 0xF6, 0xC3, 0x2A, 0xC4, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0xEE, 0xFF, 
-0x00, 0x00, 0xFF, 0xED, 0xC4, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0x2B, 0xC4, 0xF7, 0xF7, 0xC4, 0x2A, 
-0x00, 0x7D, 0xFF, 0xAD, 0x00, 0x6E, 0xFF, 0xCD, 0x0A, 0x00, 0xEF, 0xFF, 0x1A, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0xEC, 0xE9, 0x98, 0x32, 0xFF, 0xFF, 
-0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0x32, 0x97, 0xE9, 0xEC, 0x66, 0x00, 0x7D, 
-0xFF, 0x8A, 0x00, 0x7D, 0xFF, 0x8A, 0x24, 0xF7, 0x86, 0x00, 0x24, 0xF7, 0x86, 0x00, 0xBC, 0x82, 
-0x00, 0x00, 0xBC, 0x82, 0x00, 0x00, 0x00, 0x81, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xF5, 0x7B, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFD, 0xFF, 
-0xF7, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x82, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xF8, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x24, 0xED, 0x00, 0x6E, 0xC8, 0x00, 0xB7, 0xA4, 0x09, 0xF6, 0x7F, 0x49, 0xFF, 
-0x5B, 0x92, 0xFF, 0x36, 0xDB, 0xFF, 0x12, 0x12, 0xFF, 0xDA, 0x37, 0xFF, 0x91, 0x5C, 0xFF, 0x48, 
-0x80, 0xF6, 0x09, 0xA5, 0xB6, 0x00, 0xC9, 0x6D, 0x00, 0xEE, 0x24, 0x00, 0x12, 0xFF, 0xDA, 0x37, 
-0xFF, 0x91, 0x5C, 0xFF, 0x48, 0x80, 0xF6, 0x09, 0xA5, 0xB6, 0x00, 0xC9, 0x6D, 0x00, 0xEE, 0x24, 
-0x00, 0x00, 0x24, 0xED, 0x00, 0x00, 0x24, 0xED, 0x00, 0x6E, 0xC8, 0x00, 0x00, 0x6E, 0xC8, 0x00, 
-0xB7, 0xA4, 0x00, 0x00, 0xB7, 0xA4, 0x09, 0xF6, 0x7F, 0x00, 0x09, 0xF6, 0x7F, 0x49, 0xFF, 0x5B, 
-0x00, 0x49, 0xFF, 0x5B, 0x92, 0xFF, 0x36, 0x00, 0x92, 0xFF, 0x36, 0xDB, 0xFF, 0x12, 0x00, 0xDB, 
-0xFF, 0x12, 0x12, 0xFF, 0xDA, 0x00, 0x12, 0xFF, 0xDA, 0x37, 0xFF, 0x91, 0x00, 0x37, 0xFF, 0x91, 
-0x5C, 0xFF, 0x48, 0x00, 0x5C, 0xFF, 0x48, 0x80, 0xF6, 0x09, 0x00, 0x80, 0xF6, 0x09, 0xA5, 0xB6, 
-0x00, 0x00, 0xA5, 0xB6, 0x00, 0xC9, 0x6D, 0x00, 0x00, 0xC9, 0x6D, 0x00, 0xEE, 0x24, 0x00, 0x00, 
-0xEE, 0x24, 0x00, 0x12, 0xFF, 0xDA, 0x00, 0x12, 0xFF, 0xDA, 0x37, 0xFF, 0x91, 0x00, 0x37, 0xFF, 
-0x91, 0x5C, 0xFF, 0x48, 0x00, 0x5C, 0xFF, 0x48, 0x80, 0xF6, 0x09, 0x00, 0x80, 0xF6, 0x09, 0xA5, 
-0xB6, 0x00, 0x00, 0xA5, 0xB6, 0x00, 0xC9, 0x6D, 0x00, 0x00, 0xC9, 0x6D, 0x00, 0xEE, 0x24, 0x00, 
-0x00, 0xEE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x10, 0xA0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xA0, 0x10, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xA0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xA1, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x10, 0xA1, 0xF0, 0xFF, 0xFF, 0xFF, 0xF2, 0xAD, 
-0x1C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-0x95, 0xF1, 0xFF, 0xFF, 0xF2, 0xA0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xC5, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x58, 
-0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xDA, 0xFE, 0x33, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x65, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xE2, 0xFC, 0x28, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x72, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0C, 0xEA, 
-0xF9, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x7E, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF3, 0x12, 0xF1, 0xF4, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x8B, 0xFF, 0x86, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x9C, 0xF2, 
-0xFF, 0xFF, 0xF4, 0xA9, 0x2B, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xA0, 0x0C, 0x00, 0x00, 0x07, 
-0x95, 0xF1, 0xFF, 0xFF, 0xF2, 0xA0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF2, 0x00, 0x00, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFD, 0xE0, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0x60, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x37, 0xFF, 0xD7, 
-0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xFF, 0x53, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x43, 0xFF, 0xCC, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x47, 0x00, 0x00, 0xF2, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0x00, 0x00, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xF3, 0x00, 0x00, 0x50, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xA7, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0xC3, 0xF0, 0x3A, 
-0x00, 0x00, 0x00, 0x0A, 0x9C, 0xF2, 0xFF, 0xFF, 0xF4, 0xA9, 0x11, 0x00, 0x00, 0x0A, 0x9C, 0xF2, 
-0xFF, 0xFF, 0xF4, 0xA9, 0x11, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xB4, 0x00, 0x00, 0x2F, 0xF6, 0xE3, 
-0x13, 0x00, 0x0E, 0xDB, 0xFC, 0x3D, 0x00, 0x00, 0xAD, 0xFF, 0x7B, 0x00, 0x00, 0x73, 0xFF, 0xBB, 
-0x02, 0x00, 0x00, 0xF6, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x73, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 
-0xAE, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xFA, 0x33, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0xDB, 
-0x0C, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xA2, 0xA3, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x0D, 0xDB, 0xF6, 
-0x2F, 0x00, 0x00, 0x00, 0x34, 0xFA, 0xDB, 0x0E, 0x00, 0x00, 0x00, 0x75, 0xFF, 0xAD, 0x00, 0x00, 
-0x00, 0x01, 0xB9, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF6, 0x00, 0x00, 0x02, 0xBB, 0xFF, 
-0x72, 0x00, 0x00, 0x7C, 0xFF, 0xAE, 0x00, 0x00, 0x3D, 0xFC, 0xDB, 0x0E, 0x00, 0x13, 0xE3, 0xF6, 
-0x2F, 0x00, 0x00, 0xB4, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xC8, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD3, 0xFF, 0x3A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xB4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDD, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x09, 0xE5, 0xFB, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x76, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xED, 0xF8, 
-0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFF, 0x8E, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xF3, 0xF3, 0x15, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1D, 0xF8, 0xED, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x9C, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFB, 
-0xE5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x68, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0xDD, 0x05, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xD3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xC0, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x43, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xE6, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x51, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xE7, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x56, 0xE8, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
-0x1A, 0x00, 0x00, 0x04, 0xF8, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x66, 0x00, 
-0x00, 0x2D, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x5D, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0x09, 0x00, 0x8E, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0xBE, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xDD, 0x99, 0x00, 0xDB, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x8A, 0xE5, 0x20, 0xBE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x36, 0xFF, 0x82, 0x90, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0xE1, 0xF0, 0x62, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8E, 
-0xFF, 0x33, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3A, 0xFC, 0x08, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xC2, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCB, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xBD, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD4, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 
-0xFF, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDC, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x64, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE3, 0xFF, 0x3A, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xBA, 0x7B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xF6, 0x7B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7B, 0x00, 0x00, 0x00, 
-0x00, 0x94, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFF, 0xD6, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0xFF, 0xFD, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x38, 0xFF, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xCB, 0xFF, 
-0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0x62, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xDC, 0xF7, 0x09, 0xF7, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xC7, 0x00, 
-0xC8, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0x92, 0x00, 0x93, 0xFF, 0x52, 0x00, 0x00, 
-0x00, 0x00, 0x81, 0xFF, 0x5D, 0x00, 0x5E, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0x29, 
-0x00, 0x2A, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xED, 0xF2, 0x02, 0x00, 0x02, 0xF2, 0xF3, 0x02, 
-0x00, 0x00, 0x25, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x2C, 0x00, 0x00, 0x5C, 0xFF, 0x8A, 
-0x00, 0x00, 0x00, 0x8B, 0xFF, 0x62, 0x00, 0x00, 0x93, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x57, 0xFF, 
-0x98, 0x00, 0x00, 0xCA, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x22, 0xFF, 0xCE, 0x00, 0x07, 0xF9, 0xEC, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFB, 0x09, 0x38, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB9, 0xFF, 0x3A, 0x6E, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x71, 0xA5, 0xFF, 
-0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xA6, 0xDC, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x1A, 0xFF, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x0E, 0xDC, 0xEE, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xF9, 0xBB, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB1, 0xF7, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xE2, 0xCD, 0x05, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3C, 0xFC, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFC, 0x3A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBB, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB7, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x71, 0xFC, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF8, 0x85, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0A, 0xD7, 0xCE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xF7, 0x2A, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x52, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xED, 0xBC, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xC0, 0xEF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x59, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 
-0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 
-0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF7, 0xED, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 
-0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0x38, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xF6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 
-0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0x82, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xBD, 0xFC, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xCC, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0x39, 0x00, 0x00, 
-0x65, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xAC, 0x00, 0x00, 0x9D, 0xFF, 0x16, 0x00, 0x00, 
-0x00, 0x00, 0xCF, 0xFD, 0x22, 0x00, 0xD5, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x92, 
-0x0E, 0xFD, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDA, 0xF4, 0x56, 0xFF, 0x60, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xE5, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-0xE4, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFF, 0xAA, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x98, 0xFC, 0xFF, 0xFF, 0xFA, 0x72, 0x00, 0x00, 0x00, 0x65, 0xF8, 0xFF, 0xFF, 
-0xFC, 0x97, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x32, 0x00, 0x26, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xF8, 0xFF, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xBD, 0x00, 0xAE, 0xFF, 0x65, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x01, 0xC4, 0xFF, 0x7F, 0xFF, 0xC1, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x27, 0xF7, 0xFF, 0xF7, 0x26, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x23, 0xF6, 0xFF, 0xFA, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xBC, 0xFF, 0x73, 0xFF, 0xC6, 0x02, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x5F, 
-0xFF, 0xB2, 0x00, 0xB0, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
-0x2C, 0x00, 0x27, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x98, 0xFC, 0xFF, 0xFF, 0xFB, 0x7E, 0x00, 
-0x00, 0x00, 0x66, 0xF9, 0xFF, 0xFF, 0xFC, 0x98, 0x00, 0x00, 0x00, 0x82, 0xF5, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFD, 0xF1, 0x75, 0x00, 0x00, 0x00, 
-0xBF, 0xF0, 0xC3, 0x77, 0x24, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 
-0x7D, 0x29, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x7E, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x25, 0x78, 0xC3, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xC3, 0x77, 
-0x24, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7D, 0x29, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x2A, 0x7E, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x25, 
-0x78, 0xC3, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xB6, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x70, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x68, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x4F, 0xD1, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xD4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x99, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x1E, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xD2, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x1E, 0xF9, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xBB, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA4, 0x00, 
-0x00, 0x00, 0x00, 0x3B, 0xDF, 0xFF, 0x00, 0x00, 0x04, 0x81, 0xFC, 0xEF, 0x59, 0x00, 0x22, 0xC7, 
-0xFF, 0xBE, 0x1D, 0x00, 0x5F, 0xF2, 0xF8, 0x73, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 
-0x00, 0x00, 0x64, 0xF4, 0xF8, 0x72, 0x01, 0x00, 0x00, 0x00, 0x27, 0xCD, 0xFF, 0xBD, 0x1D, 0x00, 
-0x00, 0x00, 0x06, 0x8C, 0xFE, 0xEF, 0x59, 0x00, 0x00, 0x00, 0x00, 0x44, 0xE6, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x14, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x13, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xE5, 0x43, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEF, 0xFE, 0x89, 0x05, 0x00, 0x00, 0x00, 
-0x1D, 0xBE, 0xFF, 0xCA, 0x24, 0x00, 0x00, 0x00, 0x01, 0x73, 0xF8, 0xF3, 0x5F, 0x00, 0x00, 0x00, 
-0x00, 0x5B, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x72, 0xF8, 0xF3, 0x63, 0x00, 0x1D, 0xBE, 0xFF, 0xC9, 
-0x24, 0x00, 0x59, 0xEF, 0xFC, 0x84, 0x04, 0x00, 0x00, 0xFF, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 
-0xA5, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x55, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEA, 0xFF, 0xED, 0x18, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFC, 0x65, 0xFC, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 
-0xFF, 0x8B, 0x00, 0x8C, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x15, 0xEA, 0xDE, 0x0A, 0x00, 0x0A, 0xDE, 
-0xEC, 0x16, 0x00, 0x00, 0xAB, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xAC, 0x00, 0x55, 0xFF, 
-0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0x56, 0xD5, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x29, 0xFF, 0xD5, 0x55, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0x56, 0x00, 
-0xAB, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xAC, 0x00, 0x00, 0x15, 0xEA, 0xDE, 0x0A, 0x00, 
-0x0A, 0xDE, 0xEC, 0x16, 0x00, 0x00, 0x00, 0x55, 0xFF, 0x8B, 0x00, 0x8C, 0xFF, 0x59, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xAB, 0xFC, 0x64, 0xFC, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEA, 
-0xFF, 0xED, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0x5C, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2A, 0xC3, 0xF6, 0xFF, 0xFF, 0xF6, 0xC3, 0x2A, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x2A, 0xC3, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF7, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x09, 0x41, 
-0x67, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x46, 0x42, 0x00, 0x0C, 0x41, 0x67, 0x65, 0x6E, 0x63, 0x79, 
-0x46, 0x42, 0x2D, 0x52, 0x65, 0x67, 0x01};
\ No newline at end of file
@@ -20,6 +20,11 @@
 #define WIFI_SSID "YourWiFiSSID"
 #define WIFI_PASSWORD "YourWiFiPassword"
 
+// ==================== DEVICE SETTINGS ====================
+// Token for changing settings over HTTP (POST /weather/config, sent as an
+// X-Config-Token header). Leave empty to turn remote changes off.
+#define CONFIG_TOKEN ""
+
 // ==================== SETUP INSTRUCTIONS ====================
 // 1. Copy this file to secrets.h: cp secrets_template.h secrets.h
 // 2. Replace the placeholder values above with your actual credentials
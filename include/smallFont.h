@@ -1,1758 +0,0 @@
-const uint8_t smallFont[] PROGMEM = {0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x11, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xED, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x53, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x61, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x92, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC6, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC7, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xD9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDA, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDB, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xDD, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA9, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x19, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1A, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1D, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x21, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x26, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x39, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3A, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0xFF, 0xFF, 0xFF, 0xFE, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xAC, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x21, 0x22, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x22, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1A, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2B, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x22, 0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x60, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x64, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x65, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x25, 0xCA, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x01, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x02, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFE, 0x00, 0xFC, 0xF7, 0x00, 0xF5, 0xEF, 0x00, 0xED, 0xE7, 
-0x00, 0xE5, 0xDF, 0x00, 0xDD, 0xD7, 0x00, 0xD5, 0xCF, 0x00, 0xCD, 0xC7, 0x00, 0xC5, 0xBF, 0x00, 
-0xBD, 0xB7, 0x00, 0xB5, 0xAF, 0x00, 0xAD, 0xA7, 0x00, 0xA4, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF5, 0xF4, 0x00, 0x00, 0xF6, 0xF5, 0xE0, 0xDF, 0x00, 
-0x00, 0xE1, 0xE1, 0xCA, 0xC9, 0x00, 0x00, 0xCC, 0xCD, 0xB5, 0xB4, 0x00, 0x00, 0xB7, 0xB9, 0x9F, 
-0x9E, 0x00, 0x00, 0xA2, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF6, 0x00, 0x08, 0xFF, 0xF6, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xE4, 0x00, 0x1A, 0xFF, 0xE4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xD2, 0x00, 0x2B, 0xFF, 0xD2, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3C, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 
-0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 
-0x00, 0x00, 0x00, 0x61, 0xFF, 0x9B, 0x00, 0x61, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x71, 0xFF, 0x8C, 0x00, 0x71, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x81, 0xFF, 0x7D, 0x00, 0x81, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x91, 0xFF, 0x6E, 0x00, 0x91, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 
-0xFF, 0x5F, 0x00, 0xA0, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0x3A, 0x00, 
-0xC2, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0x29, 0x00, 0xD4, 
-0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0x18, 0x00, 0xE6, 0xFF, 
-0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x08, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x48, 0xEC, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE9, 0x3D, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0xFE, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xED, 0xFF, 0x4D, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x58, 0xFD, 0xF0, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF, 
-0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xE5, 0xFF, 0x89, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFD, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x31, 0xDF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE2, 0x32, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x23, 0xC7, 0xFE, 0xFF, 
-0xFE, 0xCC, 0x28, 0x00, 0x00, 0x44, 0xC8, 0x00, 0x00, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 
-0x00, 0x01, 0xCB, 0x40, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x55, 0xB7, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x04, 0xD7, 0x30, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x66, 0xA7, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xDF, 0x24, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x26, 0xCA, 0xFE, 0xFF, 0xFE, 0xFF, 0xDB, 0xC7, 0xFE, 0xFF, 0xFE, 0xCC, 
-0x28, 0x00, 0x00, 0x00, 0x00, 0x19, 0xE3, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x00, 0x00, 
-0x00, 0x00, 0x97, 0x75, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x24, 0xDF, 
-0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA8, 0x65, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x31, 0xD7, 0x04, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xB8, 0x54, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 
-0x40, 0xCB, 0x01, 0x00, 0x00, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0xC8, 0x44, 0x00, 
-0x00, 0x00, 0x26, 0xCA, 0xFE, 0xFF, 0xFE, 0xD2, 0x32, 0x1D, 0xBE, 0xFD, 0xFF, 0xFE, 0xC9, 0x26, 
-0x00, 0x00, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0xF2, 0xFF, 0x0C, 0x00, 0x00, 
-0xF4, 0xFF, 0x0E, 0x00, 0xF4, 0xFF, 0x0C, 0x00, 0x00, 0xF4, 0xFF, 0x10, 0x00, 0xF4, 0xFF, 0x0C, 
-0x00, 0x00, 0xF4, 0xFF, 0x10, 0x00, 0xF4, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 
-0xFF, 0x94, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x3C, 0x39, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xF0, 0xFF, 0x86, 0x05, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x23, 0xC5, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xF5, 0xF4, 0xE0, 0xDF, 0xCA, 0xC9, 0xB5, 0xB4, 0x9F, 0x9E, 0x00, 0x32, 0xFF, 0xD9, 
-0x00, 0x97, 0xFF, 0x74, 0x03, 0xEF, 0xFD, 0x16, 0x38, 0xFF, 0xC9, 0x00, 0x7A, 0xFF, 0x84, 0x00, 
-0xA6, 0xFF, 0x56, 0x00, 0xCD, 0xFF, 0x2F, 0x00, 0xE7, 0xFF, 0x17, 0x00, 0xF4, 0xFF, 0x0B, 0x00, 
-0xFD, 0xFF, 0x02, 0x00, 0xF4, 0xFF, 0x0B, 0x00, 0xE7, 0xFF, 0x17, 0x00, 0xCD, 0xFF, 0x2F, 0x00, 
-0xA6, 0xFF, 0x56, 0x00, 0x7A, 0xFF, 0x84, 0x00, 0x39, 0xFF, 0xC9, 0x00, 0x03, 0xEF, 0xFD, 0x16, 
-0x00, 0x98, 0xFF, 0x74, 0x00, 0x33, 0xFF, 0xD8, 0xD9, 0xFF, 0x32, 0x00, 0x76, 0xFF, 0x96, 0x00, 
-0x17, 0xFE, 0xEF, 0x03, 0x00, 0xCD, 0xFF, 0x37, 0x00, 0x88, 0xFF, 0x79, 0x00, 0x5A, 0xFF, 0xA5, 
-0x00, 0x31, 0xFF, 0xCD, 0x00, 0x19, 0xFF, 0xE6, 0x00, 0x0D, 0xFF, 0xF3, 0x00, 0x03, 0xFF, 0xFC, 
-0x00, 0x0D, 0xFF, 0xF3, 0x00, 0x19, 0xFF, 0xE6, 0x00, 0x31, 0xFF, 0xCD, 0x00, 0x5A, 0xFF, 0xA5, 
-0x00, 0x88, 0xFF, 0x79, 0x00, 0xCD, 0xFF, 0x38, 0x17, 0xFE, 0xEF, 0x03, 0x76, 0xFF, 0x97, 0x00, 
-0xD9, 0xFF, 0x32, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x8E, 0x29, 0xB0, 0x28, 0x8C, 0xB9, 0xEC, 
-0xC4, 0xEB, 0xB9, 0x00, 0x8F, 0xFF, 0x91, 0x00, 0xB7, 0xEA, 0xC1, 0xE9, 0xB6, 0x8D, 0x27, 0xB0, 
-0x26, 0x8C, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xD4, 0xFF, 0x7F, 0xFF, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xA6, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFB, 0x5E, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xE5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x78, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xF4, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 
-0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFD, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xC8, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xAE, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xFD, 0x55, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x94, 0xDF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF4, 0x70, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x79, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE5, 0x8A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xA5, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC8, 0xFE, 0xFF, 0xFE, 0xC6, 0x20, 0xC5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC5, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x23, 0xC8, 0xFE, 0xFF, 0xFE, 0xC6, 0x21, 0x00, 0x8C, 0xFF, 
-0x01, 0xE2, 0xFF, 0x3B, 0xFF, 0xFF, 0x93, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x24, 0xCB, 0xFE, 0xFF, 0xFE, 0xC8, 0x22, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0xFE, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 
-0x38, 0x00, 0x00, 0x00, 0x12, 0xF3, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0x3A, 0x00, 0x00, 
-0x00, 0x0A, 0xEB, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x04, 0xE0, 
-0xBC, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xD3, 0xBE, 0x00, 0x00, 
-0x00, 0x00, 0x4D, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0xC2, 0xFD, 0xFF, 0xFD, 0xBC, 0x18, 0xC4, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xFA, 0xFF, 0x04, 0x00, 0x04, 0xFF, 0xF5, 0xFC, 0xFF, 0x04, 0x00, 
-0x04, 0xFF, 0xF8, 0xFC, 0xFF, 0x04, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 
-0xF7, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x45, 0xFA, 0xE5, 0x28, 0x00, 
-0x00, 0x00, 0xE7, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFA, 0xE6, 0x2C, 0x00, 0x00, 0x00, 
-0x00, 0x5C, 0xFF, 0xD6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFD, 
-0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x23, 0xC5, 0xFE, 0xFF, 0xFE, 0xC0, 0x1C, 0x00, 0x00, 
-0x00, 0x1C, 0xFE, 0xE5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC5, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x70, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0x24, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 
-0xFE, 0xCA, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFF, 0x6F, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xC5, 
-0xFC, 0x18, 0x00, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0xBB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 
-0x61, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x21, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD5, 0x3D, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xCD, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0x2A, 0xCD, 0xFE, 0xFF, 0xFE, 0xCD, 0x2A, 0x23, 0xC8, 0xFE, 
-0xFF, 0xFD, 0xC4, 0x20, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xD1, 0x32, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x23, 0xC8, 0xFE, 
-0xFF, 0xFE, 0xC8, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xDD, 0xFF, 0xFF, 0x00, 0x00, 0x19, 0xFF, 0xAE, 0xFF, 0xFF, 0x00, 0x00, 0x4D, 0xFF, 0x7E, 
-0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x20, 0x00, 0x00, 
-0x00, 0x00, 0xE6, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x4D, 
-0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x33, 
-0x00, 0x00, 0x00, 0x00, 0xE6, 0xFB, 0x08, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xD4, 0x00, 0x00, 0x00, 
-0x00, 0x4D, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0xB3, 
-0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0x17, 0x00, 0x00, 0x16, 0xB9, 0xFD, 0xFF, 0xFD, 
-0xBB, 0x16, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xF2, 0xFF, 0x0C, 0x00, 0x0C, 0xFF, 0xF1, 
-0xF4, 0xFF, 0x0C, 0x00, 0x0C, 0xFF, 0xF4, 0xF4, 0xFF, 0x0C, 0x00, 0x0C, 0xFF, 0xF4, 0xF4, 0xFF, 
-0x0C, 0x00, 0x0C, 0xFF, 0xF4, 0xE3, 0xFF, 0x20, 0x00, 0x21, 0xFF, 0xE3, 0x51, 0xF1, 0xE2, 0x57, 
-0xE2, 0xF1, 0x51, 0x00, 0x2E, 0xF3, 0xFF, 0xF4, 0x2F, 0x00, 0x52, 0xEE, 0xE3, 0x5D, 0xE4, 0xED, 
-0x4E, 0xE8, 0xFF, 0x19, 0x00, 0x19, 0xFF, 0xE6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFD, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x1C, 0xC0, 0xFE, 0xFF, 0xFE, 
-0xBD, 0x1A, 0x1F, 0xC7, 0xFF, 0xFF, 0xFD, 0xBF, 0x1B, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 
-0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x4E, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xC5, 0x21, 0xC6, 0xFE, 0xFF, 0xFE, 0xC8, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD4, 0xFF, 0x7F, 0xFF, 0x2A, 0x00, 
-0x00, 0x00, 0x00, 0x12, 0xA7, 0x00, 0x00, 0x00, 0x48, 0xE5, 0xFF, 0x00, 0x0B, 0x97, 0xFF, 0xE3, 
-0x50, 0x3A, 0xDC, 0xFC, 0x91, 0x0C, 0x00, 0xFB, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x42, 0xE2, 0xFC, 
-0x8F, 0x0C, 0x00, 0x00, 0x0F, 0xA2, 0xFF, 0xE2, 0x4F, 0x00, 0x00, 0x00, 0x53, 0xEC, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x18, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x18, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0x51, 0x00, 0x00, 
-0x00, 0x50, 0xE3, 0xFF, 0x9E, 0x0D, 0x00, 0x00, 0x0D, 0x91, 0xFC, 0xDE, 0x3B, 0x00, 0x00, 0x00, 
-0x66, 0xFF, 0xFB, 0x00, 0x0C, 0x8F, 0xFC, 0xE0, 0x40, 0x4F, 0xE3, 0xFF, 0x9D, 0x0D, 0x00, 0xFF, 
-0xE7, 0x4B, 0x00, 0x00, 0x00, 0xA9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBD, 0xFD, 0xFD, 0xBF, 
-0x1B, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xDD, 0x00, 
-0x00, 0x00, 0x5C, 0xFF, 0x72, 0x00, 0x00, 0x07, 0xE0, 0xEA, 0x0A, 0x00, 0x00, 0x76, 0xFF, 0x76, 
-0x00, 0x00, 0x00, 0xDB, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x66, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x66, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xEC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xD6, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xDD, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xEC, 0xFF, 0x00, 0xDF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x66, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x66, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 
-0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0x70, 
-0x00, 0x00, 0x00, 0x00, 0x9F, 0xDC, 0xEC, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xB9, 0xC7, 0xCA, 
-0x00, 0x00, 0x00, 0x02, 0xF6, 0x95, 0xA3, 0xF5, 0x02, 0x00, 0x00, 0x27, 0xFF, 0x72, 0x7E, 0xFF, 
-0x25, 0x00, 0x00, 0x54, 0xFF, 0x4E, 0x59, 0xFF, 0x52, 0x00, 0x00, 0x81, 0xFF, 0x2B, 0x35, 0xFF, 
-0x7F, 0x00, 0x00, 0xAF, 0xFE, 0x09, 0x10, 0xFF, 0xAC, 0x00, 0x00, 0xDC, 0xE4, 0x00, 0x00, 0xEB, 
-0xD9, 0x00, 0x0B, 0xFE, 0xC1, 0x00, 0x00, 0xC6, 0xFD, 0x09, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x34, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0x91, 0xFF, 0x6D, 0x00, 0x00, 0x72, 
-0xFF, 0x8E, 0xBE, 0xFF, 0x41, 0x00, 0x00, 0x44, 0xFF, 0xBB, 0xEB, 0xFF, 0x15, 0x00, 0x00, 0x17, 
-0xFF, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xD3, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 
-0xFF, 0xFF, 0x00, 0x00, 0x0C, 0xFF, 0xF2, 0xFF, 0xFF, 0x00, 0x00, 0x0C, 0xFF, 0xF4, 0xFF, 0xFF, 
-0x00, 0x00, 0x0C, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x0C, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x15, 
-0x95, 0xFF, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x86, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x80, 
-0x08, 0xFF, 0xFF, 0x00, 0x14, 0x97, 0xFF, 0xB9, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD7, 0x3B, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD5, 0x39, 
-0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x74, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xFF, 0xFF, 
-0x00, 0x04, 0x79, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x09, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x05, 0x7A, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x77, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD7, 0x3B, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFE, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD7, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD7, 0x3B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD7, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD7, 0x3B, 0xFF, 0xFF, 0x00, 0x00, 0x17, 0xFB, 0xD1, 0xFF, 
-0xFF, 0x00, 0x00, 0x77, 0xFF, 0x62, 0xFF, 0xFF, 0x00, 0x00, 0xDA, 0xEA, 0x08, 0xFF, 0xFF, 0x00, 
-0x40, 0xFF, 0x83, 0x00, 0xFF, 0xFF, 0x00, 0xA5, 0xFA, 0x19, 0x00, 0xFF, 0xFF, 0x11, 0xF7, 0xA3, 
-0x00, 0x00, 0xFF, 0xFF, 0x6E, 0xFF, 0x33, 0x00, 0x00, 0xFF, 0xFF, 0xD2, 0xC3, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDA, 0xC2, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x76, 0xFF, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0x15, 0xF9, 0x9F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAA, 
-0xF8, 0x15, 0x00, 0xFF, 0xFF, 0x00, 0x45, 0xFF, 0x7C, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xDD, 0xE5, 
-0x05, 0xFF, 0xFF, 0x00, 0x00, 0x79, 0xFF, 0x59, 0xFF, 0xFF, 0x00, 0x00, 0x18, 0xFB, 0xC8, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 
-0x00, 0x00, 0x00, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xCC, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x0B, 0x00, 0x0C, 0xFC, 0xFF, 
-0xFF, 0xFF, 0xF4, 0xF4, 0x42, 0x00, 0x43, 0xF4, 0xF5, 0xFF, 0xFF, 0xFF, 0xBB, 0x7C, 0x00, 0x7D, 
-0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xB7, 0x00, 0xB8, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0xEF, 
-0x04, 0xF0, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF7, 0x5A, 0xF7, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0xBF, 0xCD, 0xBE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x41, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x09, 0xF2, 0x08, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x86, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBB, 0x2D, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x72, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x31, 0xB7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xDF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xA6, 
-0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1C, 0xC9, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0xFA, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xC3, 0xFF, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xD6, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xD6, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
-0xD6, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD6, 
-0x39, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD7, 0x3B, 0x00, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD7, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x5F, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xB5, 0xFF, 
-0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x25, 0xFF, 0xFF, 0x87, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x3B, 0xD7, 0xFE, 0xFF, 0xFF, 0xEB, 0x76, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD7, 
-0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0xFD, 0xFF, 
-0xFF, 0xE9, 0xFF, 0xFF, 0x04, 0xF5, 0xFF, 0xF6, 0x74, 0xFF, 0xFF, 0x00, 0xBF, 0xEB, 0x01, 0x00, 
-0xFF, 0xFF, 0x00, 0x83, 0xFF, 0x33, 0x00, 0xFF, 0xFF, 0x00, 0x48, 0xFF, 0x7A, 0x00, 0xFF, 0xFF, 
-0x00, 0x0E, 0xFD, 0xC1, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xD1, 0xFA, 0x0D, 0xFF, 0xFF, 0x00, 0x00, 
-0x95, 0xFF, 0x4E, 0xFF, 0xFF, 0x00, 0x00, 0x5A, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0x00, 0x1E, 0xFF, 
-0xDC, 0x3B, 0xD6, 0xFE, 0xFF, 0xFE, 0xD7, 0x3B, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFE, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0x18, 
-0x00, 0x00, 0xFF, 0xFF, 0x8E, 0xFF, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x07, 0xCC, 0xFF, 0x88, 0x00, 
-0x00, 0x00, 0x00, 0x21, 0xEE, 0xFE, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFE, 0xEF, 0x22, 0x00, 
-0x00, 0x00, 0x00, 0x88, 0xFF, 0xCE, 0x08, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0x91, 0x00, 0x00, 
-0x00, 0x00, 0x18, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD7, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD7, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 
-0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0xE9, 0xFF, 0x12, 0x00, 0x00, 0x11, 0xFF, 0xE8, 0xBC, 
-0xFF, 0x36, 0x00, 0x00, 0x35, 0xFF, 0xBB, 0x8F, 0xFF, 0x5A, 0x00, 0x00, 0x59, 0xFF, 0x8E, 0x62, 
-0xFF, 0x7E, 0x00, 0x00, 0x7C, 0xFF, 0x61, 0x35, 0xFF, 0xA2, 0x00, 0x00, 0xA0, 0xFF, 0x34, 0x0A, 
-0xFD, 0xC6, 0x00, 0x00, 0xC3, 0xFD, 0x0A, 0x00, 0xDA, 0xEA, 0x00, 0x00, 0xE7, 0xD9, 0x00, 0x00, 
-0xAD, 0xFF, 0x0E, 0x0A, 0xFF, 0xAC, 0x00, 0x00, 0x80, 0xFF, 0x32, 0x2E, 0xFF, 0x7F, 0x00, 0x00, 
-0x53, 0xFF, 0x56, 0x51, 0xFF, 0x52, 0x00, 0x00, 0x26, 0xFF, 0x7A, 0x75, 0xFF, 0x25, 0x00, 0x00, 
-0x02, 0xF6, 0x9E, 0x98, 0xF5, 0x02, 0x00, 0x00, 0x00, 0xCB, 0xC2, 0xBC, 0xCA, 0x00, 0x00, 0x00, 
-0x00, 0x9E, 0xE6, 0xDF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFC, 0xF7, 0x70, 0x00, 0x00, 0x00, 
-0x00, 0x44, 0xFF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x17, 0xFF, 0xFF, 0x16, 0x00, 0x00, 0xF0, 
-0xE9, 0x00, 0x00, 0xEA, 0xFF, 0x08, 0x00, 0xEB, 0xEF, 0xD1, 0xFC, 0x01, 0x01, 0xFC, 0xFF, 0x18, 
-0x02, 0xFD, 0xCF, 0xB1, 0xFF, 0x12, 0x11, 0xFF, 0xFF, 0x28, 0x15, 0xFF, 0xAF, 0x91, 0xFF, 0x27, 
-0x25, 0xFF, 0xFF, 0x38, 0x2B, 0xFF, 0x8F, 0x71, 0xFF, 0x3B, 0x38, 0xFF, 0xFF, 0x48, 0x40, 0xFF, 
-0x6F, 0x51, 0xFF, 0x50, 0x4C, 0xFE, 0xFF, 0x58, 0x55, 0xFF, 0x4F, 0x31, 0xFF, 0x64, 0x60, 0xF2, 
-0xF9, 0x69, 0x6B, 0xFF, 0x2F, 0x10, 0xFF, 0x79, 0x73, 0xDC, 0xE0, 0x79, 0x80, 0xFF, 0x0F, 0x00, 
-0xF0, 0x8D, 0x87, 0xC5, 0xC5, 0x89, 0x95, 0xEF, 0x00, 0x00, 0xD1, 0xA1, 0x9A, 0xAD, 0xAA, 0x99, 
-0xAA, 0xCF, 0x00, 0x00, 0xB1, 0xB6, 0xAE, 0x96, 0x8F, 0xA9, 0xC0, 0xAF, 0x00, 0x00, 0x91, 0xCA, 
-0xC1, 0x7F, 0x74, 0xB9, 0xD5, 0x8F, 0x00, 0x00, 0x71, 0xDF, 0xD5, 0x68, 0x59, 0xCA, 0xEA, 0x6F, 
-0x00, 0x00, 0x51, 0xF3, 0xE9, 0x50, 0x3E, 0xDC, 0xFD, 0x4F, 0x00, 0x00, 0x31, 0xFF, 0xF9, 0x39, 
-0x23, 0xF5, 0xFF, 0x2F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x22, 0x08, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 
-0x00, 0xF0, 0xFF, 0x0B, 0x00, 0xED, 0xEF, 0x00, 0x00, 0xD8, 0xFF, 0x1E, 0x00, 0x1D, 0xFF, 0xDD, 
-0x85, 0xFF, 0x5A, 0x00, 0x58, 0xFF, 0x88, 0x30, 0xFF, 0x96, 0x00, 0x93, 0xFF, 0x33, 0x00, 0xDB, 
-0xD2, 0x00, 0xCE, 0xDE, 0x00, 0x00, 0x86, 0xFD, 0x1D, 0xFC, 0x8A, 0x00, 0x00, 0x31, 0xFF, 0x8E, 
-0xFF, 0x35, 0x00, 0x00, 0x00, 0xDA, 0xF3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x8C, 0x00, 
-0x00, 0x00, 0x00, 0x58, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xB4, 0x00, 0x00, 0x00, 
-0x05, 0xEF, 0xCA, 0xF8, 0x0B, 0x00, 0x00, 0x46, 0xFF, 0x5C, 0xFF, 0x52, 0x00, 0x00, 0x98, 0xF3, 
-0x06, 0xF4, 0xA1, 0x00, 0x02, 0xE7, 0xBF, 0x00, 0xC0, 0xED, 0x03, 0x3C, 0xFF, 0x88, 0x00, 0x89, 
-0xFF, 0x3F, 0x8D, 0xFF, 0x51, 0x00, 0x52, 0xFF, 0x8D, 0xDE, 0xFF, 0x1B, 0x00, 0x1B, 0xFF, 0xDA, 
-0xD7, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xD6, 0x75, 0xFF, 0x87, 0x00, 0x00, 0x00, 
-0x00, 0x87, 0xFF, 0x73, 0x16, 0xFA, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xDF, 0xFA, 0x16, 0x00, 0xAE, 
-0xFF, 0x3C, 0x00, 0x00, 0x3A, 0xFF, 0xAC, 0x00, 0x00, 0x4B, 0xFF, 0x96, 0x00, 0x00, 0x93, 0xFF, 
-0x49, 0x00, 0x00, 0x03, 0xE4, 0xEC, 0x05, 0x03, 0xE9, 0xE3, 0x02, 0x00, 0x00, 0x00, 0x84, 0xFF, 
-0x4B, 0x46, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xA6, 0xA0, 0xFB, 0x1C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB1, 0xF5, 0xF1, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 
-0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x9C, 0x00, 
-0x00, 0x00, 0x00, 0x8E, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x04, 0xE8, 0xDE, 0x01, 0x00, 0x00, 0x00, 
-0x4B, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x10, 0xF7, 0xC4, 
-0x00, 0x00, 0x00, 0x00, 0x67, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xF7, 0x0F, 0x00, 0x00, 
-0x00, 0x24, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x01, 0xDF, 
-0xE7, 0x03, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x2F, 0x00, 
-0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xA1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xA1, 0xFC, 0xFF, 0xFF, 0xFF, 0xC7, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFA, 
-0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x71, 0xEF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF1, 0x6D, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x8D, 0xDC, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFB, 0x51, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x36, 0xFF, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xA8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x52, 0xFB, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDD, 0x8C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 
-0xEF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xDF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x1C, 0xFB, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xC6, 0xFF, 0xFF, 
-0xFF, 0xFB, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFB, 0x9E, 0x00, 0x00, 0x4D, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0xCB, 0xF9, 0xCD, 0x00, 0x00, 
-0x00, 0x4D, 0xF9, 0x46, 0xFA, 0x4B, 0x00, 0x00, 0xCB, 0x91, 0x00, 0x96, 0xC7, 0x00, 0x4D, 0xF2, 
-0x15, 0x00, 0x18, 0xF4, 0x44, 0xCB, 0x7D, 0x00, 0x00, 0x00, 0x84, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0x2E, 0x17, 
-0xEB, 0x85, 0x00, 0x53, 0xDA, 0x65, 0xCE, 0xFE, 0xFE, 0xD0, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x12, 0xB0, 0xFE, 
-0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x2F, 0x8F, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xE0, 0xAC, 0x66, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x21, 0x75, 0xE9, 
-0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x91, 0xFF, 0xFF, 0xFF, 0xE9, 0x92, 0x09, 0x22, 0xBC, 0xFD, 0xFD, 0xC6, 0x29, 0xC2, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xC6, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x29, 0xC6, 0xFE, 
-0xFE, 0xC6, 0x29, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x09, 0x91, 0xE8, 
-0xFF, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xFF, 0x2B, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE9, 0xFF, 0x2B, 0x00, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x0A, 0x95, 0xE9, 0xFF, 0xFF, 0xFF, 0x31, 0xD5, 0xFE, 0xFE, 0xD5, 0x31, 0xC5, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x31, 
-0xD6, 0xFE, 0xFE, 0xCB, 0x39, 0x00, 0x1B, 0xB7, 0xFD, 0xFF, 0x00, 0xB8, 0xFF, 0xFF, 0xFF, 0x00, 
-0xFD, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0A, 0x94, 0xE8, 0xFF, 0xF0, 0xF0, 
-0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xFF, 0x2B, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xE9, 0xFF, 0x2B, 0x00, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x0A, 0x94, 0xE9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFD, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x45, 0xD8, 0xFF, 0xFE, 0xD1, 0x28, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0A, 0x83, 0xEC, 0x8D, 0xFF, 0xFF, 
-0xE2, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xED, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x04, 0x04, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x04, 0xFF, 0xFF, 0x04, 0x00, 0x04, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xDE, 0x00, 0xFF, 0xFF, 0xDC, 0x46, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3D, 0xFF, 0xBB, 0xFF, 
-0xFF, 0x00, 0xB9, 0xFB, 0x29, 0xFF, 0xFF, 0x34, 0xFF, 0x8D, 0x00, 0xFF, 0xFF, 0xAF, 0xE8, 0x0E, 
-0x00, 0xFF, 0xFF, 0xFE, 0x82, 0x00, 0x00, 0xFF, 0xFF, 0xCA, 0xD7, 0x02, 0x00, 0xFF, 0xFF, 0x65, 
-0xFF, 0x54, 0x00, 0xFF, 0xFF, 0x0C, 0xF2, 0xCD, 0x00, 0xFF, 0xFF, 0x00, 0x99, 0xFF, 0x48, 0xFF, 
-0xFF, 0x00, 0x33, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x82, 0xEC, 0x60, 0x0B, 0x86, 0xEC, 
-0x8D, 0xFF, 0xFF, 0xD2, 0xCA, 0xFF, 0xDB, 0xE0, 0xCA, 0xFF, 0xEE, 0xFF, 0xFF, 0xD7, 0x14, 0xFF, 
-0xFF, 0xD7, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xFF, 0xFF, 0x1D, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x76, 0xE0, 
-0xA2, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xD4, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xD1, 0xFE, 0xFE, 0xD1, 0x28, 0xBD, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBC, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x29, 0xD1, 0xFE, 
-0xFE, 0xD1, 0x28, 0xFF, 0xFF, 0x15, 0x77, 0xEA, 0x8D, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xEE, 0xFF, 
-0xFF, 0xD4, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x2B, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0xFF, 0xFF, 0xFF, 0xE2, 0x69, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x94, 0xE8, 0xFF, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE9, 0xFF, 0x5B, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xE9, 0xFF, 0x4B, 0x02, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x94, 0xE9, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x9B, 0xEE, 
-0x7A, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xA8, 0x38, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x28, 0xBB, 0xFC, 0xFC, 0xBA, 0x27, 0xD1, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD0, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0x90, 0x06, 0xFF, 0xFF, 0x24, 
-0xD7, 0xFF, 0xCB, 0x23, 0x00, 0x00, 0x0E, 0xB4, 0xFF, 0xF1, 0x4E, 0xFF, 0xFF, 0x02, 0x88, 0xFF, 
-0xEE, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x29, 0xBD, 0xFD, 
-0xFD, 0xBD, 0x28, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0xD0, 0xFF, 0xFF, 0xFF, 0x00, 0x32, 0xCB, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x17, 0x47, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 
-0xF6, 0xE0, 0xB6, 0xFF, 0xFF, 0xE6, 0xFF, 0x11, 0x11, 0xFF, 0xE5, 0xB3, 0xFF, 0x34, 0x35, 0xFF, 
-0xB2, 0x80, 0xFF, 0x58, 0x59, 0xFF, 0x7F, 0x4D, 0xFF, 0x7B, 0x7C, 0xFF, 0x4C, 0x1A, 0xFF, 0x9F, 
-0xA0, 0xFF, 0x19, 0x00, 0xE6, 0xC2, 0xC3, 0xE5, 0x00, 0x00, 0xB3, 0xE6, 0xE7, 0xB2, 0x00, 0x00, 
-0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x19, 
-0x00, 0xE6, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xE5, 0xB3, 0xFF, 0x30, 0x31, 0xFF, 
-0xFF, 0x31, 0x32, 0xFF, 0xB2, 0x80, 0xFF, 0x51, 0x52, 0xFF, 0xFF, 0x52, 0x53, 0xFF, 0x7F, 0x4D, 
-0xFF, 0x71, 0x72, 0xED, 0xEE, 0x73, 0x74, 0xFF, 0x4C, 0x1A, 0xFF, 0x92, 0x93, 0xC8, 0xC9, 0x94, 
-0x95, 0xFF, 0x19, 0x00, 0xE6, 0xB2, 0xB3, 0xA4, 0xA5, 0xB5, 0xB6, 0xE5, 0x00, 0x00, 0xB3, 0xD3, 
-0xD4, 0x7F, 0x80, 0xD6, 0xD7, 0xB2, 0x00, 0x00, 0x80, 0xF3, 0xF3, 0x5B, 0x5C, 0xF6, 0xF7, 0x7F, 
-0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x36, 0x37, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x12, 
-0x12, 0xFF, 0xFF, 0x19, 0x00, 0xC6, 0xFF, 0x21, 0x21, 0xFF, 0xCB, 0x53, 0xFF, 0x64, 0x65, 0xFF, 
-0x56, 0x02, 0xDD, 0xA8, 0xA9, 0xDF, 0x03, 0x00, 0x6D, 0xEA, 0xEA, 0x6E, 0x00, 0x00, 0x0B, 0xEE, 
-0xEE, 0x0B, 0x00, 0x00, 0x0B, 0xEE, 0xED, 0x0B, 0x00, 0x00, 0x6F, 0xEB, 0xEC, 0x6C, 0x00, 0x03, 
-0xDF, 0xA9, 0xAA, 0xDC, 0x02, 0x57, 0xFF, 0x65, 0x66, 0xFF, 0x52, 0xCB, 0xFF, 0x21, 0x22, 0xFF, 
-0xC6, 0xE6, 0xFF, 0x0F, 0x10, 0xFF, 0xE5, 0xB3, 0xFF, 0x2D, 0x32, 0xFF, 0xB2, 0x80, 0xFF, 0x4C, 
-0x53, 0xFF, 0x7F, 0x4D, 0xFF, 0x6B, 0x74, 0xFF, 0x4C, 0x1A, 0xFF, 0x8A, 0x95, 0xFF, 0x19, 0x00, 
-0xE6, 0xA9, 0xB6, 0xE5, 0x00, 0x00, 0xB3, 0xC8, 0xD7, 0xB2, 0x00, 0x00, 0x80, 0xE8, 0xF6, 0x7F, 
-0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x20, 0xFF, 
-0xDF, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x5F, 0x00, 0x00, 0x00, 
-0xE0, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xE1, 0x00, 0x00, 0x00, 0x16, 0xEC, 0x47, 0x00, 0x00, 0x00, 0xAA, 0x9F, 0x00, 0x00, 0x00, 0x50, 
-0xE7, 0x11, 0x00, 0x00, 0x10, 0xE6, 0x51, 0x00, 0x00, 0x00, 0x9E, 0xAA, 0x00, 0x00, 0x00, 0x45, 
-0xEC, 0x16, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x26, 0xBD, 0xF6, 0xFF, 0xFF, 0x00, 0x00, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFE, 0xFF, 0x51, 0x06, 0x05, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x13, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x28, 0xDC, 0xF9, 0x76, 0x00, 0x00, 0x00, 
-0xDC, 0xF4, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDE, 0xF7, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x16, 
-0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x53, 0x06, 0x04, 0x00, 
-0x00, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x26, 0xBD, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xBB, 0x25, 0x00, 0x00, 0xFC, 0xFD, 
-0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x01, 0x4A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x13, 0x00, 0x00, 
-0x00, 0x00, 0x9C, 0xFF, 0xDC, 0x27, 0x00, 0x00, 0x00, 0x01, 0xBC, 0xFF, 0xDC, 0x00, 0x00, 0x00, 
-0x92, 0xFF, 0xDD, 0x26, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 
-0x4D, 0xFF, 0xFD, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xBA, 
-0x22, 0x00, 0x00, 0xD4, 0xC6, 0x4E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0x90, 0x42, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xC7, 0xD4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x9F, 0x00, 0xAD, 0xA7, 0x00, 0xB5, 0xAF, 0x00, 0xBD, 
-0xB7, 0x00, 0xC5, 0xBF, 0x00, 0xCD, 0xC7, 0x00, 0xD5, 0xCF, 0x00, 0xDD, 0xD7, 0x00, 0xE5, 0xDF, 
-0x00, 0xED, 0xE7, 0x00, 0xF5, 0xEF, 0x00, 0xFC, 0xF7, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x29, 0xC6, 0xFD, 0xFF, 0xFF, 0xFD, 0xC6, 0x29, 0xC6, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xC6, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFD, 0xC8, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xC7, 0x2D, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x2D, 0x00, 0x00, 0x03, 0xFF, 
-0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xCC, 0xFE, 0xFF, 0xFE, 0xCA, 0x28, 0x00, 0xCD, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xCB, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xC2, 0x28, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x28, 0xC2, 0x1F, 0xC0, 0xFF, 0xEC, 0x37, 0x00, 0x00, 0x00, 0x35, 0xEB, 
-0xFF, 0xBF, 0x20, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x20, 0x00, 0x20, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x1F, 0x00, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x1F, 0xC0, 
-0xFF, 0xEB, 0x35, 0x00, 0x00, 0x00, 0x37, 0xEC, 0xFF, 0xBF, 0x20, 0xC3, 0x28, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x29, 0xC3, 0x1F, 0xCA, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xDB, 0x5B, 0xFF, 
-0x89, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x85, 0x05, 0xE4, 0xE2, 0x01, 0x00, 0x00, 0x99, 0xFF, 0x30, 
-0x00, 0x79, 0xFF, 0x40, 0x00, 0x00, 0xD6, 0xDA, 0x00, 0x00, 0x12, 0xF5, 0x9B, 0x00, 0x14, 0xFE, 
-0x84, 0x00, 0x00, 0x00, 0x95, 0xEF, 0x07, 0x50, 0xFF, 0x2E, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0x52, 
-0x8D, 0xFF, 0xFF, 0xE4, 0x00, 0xE4, 0xFF, 0xFF, 0xAE, 0xCA, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 
-0x87, 0xF8, 0xFB, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0x35, 0x00, 0x00, 0x00, 
-0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xE4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xCE, 0xFE, 0xFF, 0xFE, 0xCF, 0x2A, 0xCB, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xB4, 0xFF, 0xB6, 0x28, 0x00, 0x00, 0x00, 0x03, 0x59, 0xE1, 0xFB, 0x90, 
-0x11, 0x00, 0x30, 0xB5, 0xFE, 0xDB, 0xFF, 0xEC, 0x56, 0xEA, 0xFF, 0x43, 0x00, 0x47, 0xFF, 0xF2, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0x46, 0x00, 0x2C, 0xFF, 0xEF, 0x57, 0xEC, 
-0xFF, 0xC8, 0xF3, 0xDD, 0x44, 0x00, 0x11, 0x91, 0xFB, 0xFF, 0x89, 0x0A, 0x00, 0x00, 0x00, 0x28, 
-0xB7, 0xFF, 0xC1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFE, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0x2B, 0xCF, 0xFE, 0xFF, 0xFE, 0xCF, 0x2B, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x3A, 0xCE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFD, 0xCE, 0x3A, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xFE, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xDA, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x3A, 0xCE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xCE, 0x3A, 0x41, 0xD9, 0xFD, 0xFE, 0xE0, 0x4E, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xEE, 
-0xFF, 0x14, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4D, 0xDF, 0xFE, 0xFF, 0xFF, 
-0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE3, 0xFF, 0xF8, 
-0xFA, 0xFF, 0xFF, 0x54, 0xE8, 0xFA, 0xD6, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA0, 
-0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x60, 0x60, 0x60, 0x60, 
-0x60, 0x00, 0x3B, 0xFF, 0xB8, 0x00, 0x3B, 0xFF, 0xB8, 0x00, 0xB4, 0xEF, 0x1B, 0x00, 0xB4, 0xEF, 
-0x1B, 0x2C, 0xFE, 0x5C, 0x00, 0x2C, 0xFE, 0x5C, 0x00, 0xA3, 0xAE, 0x00, 0x00, 0xA3, 0xAE, 0x00, 
-0x00, 0xF6, 0x2B, 0x00, 0x00, 0xF6, 0x2B, 0x00, 0x00, 0xA3, 0xAA, 0x00, 0x00, 0xA3, 0xAA, 0x00, 
-0x00, 0x2C, 0xFE, 0x55, 0x00, 0x2C, 0xFE, 0x55, 0x00, 0x00, 0xB4, 0xEA, 0x15, 0x00, 0xB4, 0xEA, 
-0x15, 0x00, 0x3C, 0xFF, 0xAA, 0x00, 0x3C, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xD9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xD9, 0x3A, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xFE, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xDB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xDD, 0xFE, 0xD2, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x85, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0x1B, 0xBD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xA7, 0x44, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x38, 0xC2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xCE, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x3A, 0xDA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xDA, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xE6, 0xFF, 0xE6, 0x5A, 0xE7, 0x00, 0x00, 
-0x00, 0xE7, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0xE7, 0x5B, 0xE7, 0xFF, 0xE7, 0x5B, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x33, 0xFF, 0xB1, 0x87, 0xEC, 0x17, 0xDC, 0x56, 
-0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x58, 0x11, 0x86, 0xFF, 0xFF, 0xD7, 
-0xEB, 0x78, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xD7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 
-0xD7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x69, 0xC7, 0x02, 0x00, 0x19, 0xB7, 0xBE, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 
-0xFF, 0xFF, 0xBF, 0x4E, 0xE0, 0xFE, 0xFE, 0xE0, 0x4E, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 
-0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE0, 0x4E, 0xE0, 0xFE, 0xFE, 0xE0, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0x3B, 0x00, 0xAB, 
-0xFF, 0x3B, 0x00, 0x15, 0xEA, 0xB3, 0x00, 0x15, 0xEA, 0xB3, 0x00, 0x00, 0x55, 0xFE, 0x2B, 0x00, 
-0x55, 0xFE, 0x2B, 0x00, 0x00, 0xAB, 0xA2, 0x00, 0x00, 0xAB, 0xA2, 0x00, 0x00, 0x2B, 0xF6, 0x00, 
-0x00, 0x2B, 0xF6, 0x00, 0x00, 0xAE, 0xA2, 0x00, 0x00, 0xAE, 0xA2, 0x00, 0x5D, 0xFE, 0x2C, 0x00, 
-0x5D, 0xFE, 0x2C, 0x1B, 0xEF, 0xB3, 0x00, 0x1B, 0xEF, 0xB3, 0x00, 0xB8, 0xFF, 0x3B, 0x00, 0xB8, 
-0xFF, 0x3B, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xEC, 0x00, 
-0x00, 0x00, 0x00, 0xF0, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xEC, 0x00, 0x00, 0x00, 0x07, 0xF6, 
-0xD0, 0x00, 0x00, 0x00, 0x73, 0xFF, 0x79, 0x00, 0x00, 0x0F, 0xED, 0xE5, 0x09, 0x00, 0x00, 0x86, 
-0xFF, 0x65, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xD6, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD6, 0x39, 0xD6, 0xFE, 0xFE, 0xD6, 0x39, 0x00, 0x00, 0xB0, 0xFF, 0x2E, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x17, 0xEB, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xDA, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 
-0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0x70, 0x00, 
-0x00, 0x00, 0x00, 0x9F, 0xDC, 0xEC, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xB9, 0xC7, 0xCA, 0x00, 
-0x00, 0x00, 0x02, 0xF6, 0x95, 0xA3, 0xF5, 0x02, 0x00, 0x00, 0x27, 0xFF, 0x72, 0x7E, 0xFF, 0x25, 
-0x00, 0x00, 0x54, 0xFF, 0x4E, 0x59, 0xFF, 0x52, 0x00, 0x00, 0x81, 0xFF, 0x2B, 0x35, 0xFF, 0x7F, 
-0x00, 0x00, 0xAF, 0xFE, 0x09, 0x10, 0xFF, 0xAC, 0x00, 0x00, 0xDC, 0xE4, 0x00, 0x00, 0xEB, 0xD9, 
-0x00, 0x0B, 0xFE, 0xC1, 0x00, 0x00, 0xC6, 0xFD, 0x09, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x34, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0x91, 0xFF, 0x6D, 0x00, 0x00, 0x72, 0xFF, 
-0x8E, 0xBE, 0xFF, 0x41, 0x00, 0x00, 0x44, 0xFF, 0xBB, 0xEB, 0xFF, 0x15, 0x00, 0x00, 0x17, 0xFF, 
-0xE9, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xEC, 0x17, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0x43, 0x00, 
-0x00, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xDC, 0xEC, 0x9D, 0x00, 
-0x00, 0x00, 0x00, 0xCC, 0xB9, 0xC7, 0xCA, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x95, 0xA3, 0xF5, 0x02, 
-0x00, 0x00, 0x27, 0xFF, 0x72, 0x7E, 0xFF, 0x25, 0x00, 0x00, 0x54, 0xFF, 0x4E, 0x59, 0xFF, 0x52, 
-0x00, 0x00, 0x81, 0xFF, 0x2B, 0x35, 0xFF, 0x7F, 0x00, 0x00, 0xAF, 0xFE, 0x09, 0x10, 0xFF, 0xAC, 
-0x00, 0x00, 0xDC, 0xE4, 0x00, 0x00, 0xEB, 0xD9, 0x00, 0x0B, 0xFE, 0xC1, 0x00, 0x00, 0xC6, 0xFD, 
-0x09, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x61, 0x91, 0xFF, 0x6D, 0x00, 0x00, 0x72, 0xFF, 0x8E, 0xBE, 0xFF, 0x41, 0x00, 0x00, 0x44, 0xFF, 
-0xBB, 0xEB, 0xFF, 0x15, 0x00, 0x00, 0x17, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x4A, 0xFD, 0x4F, 0x00, 
-0x00, 0x00, 0x00, 0x1E, 0xE8, 0x89, 0xEB, 0x20, 0x00, 0x00, 0x00, 0xC7, 0x59, 0x00, 0x61, 0xC8, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 
-0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0x70, 0x00, 
-0x00, 0x00, 0x00, 0x9F, 0xDC, 0xEC, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xB9, 0xC7, 0xCA, 0x00, 
-0x00, 0x00, 0x02, 0xF6, 0x95, 0xA3, 0xF5, 0x02, 0x00, 0x00, 0x27, 0xFF, 0x72, 0x7E, 0xFF, 0x25, 
-0x00, 0x00, 0x54, 0xFF, 0x4E, 0x59, 0xFF, 0x52, 0x00, 0x00, 0x81, 0xFF, 0x2B, 0x35, 0xFF, 0x7F, 
-0x00, 0x00, 0xAF, 0xFE, 0x09, 0x10, 0xFF, 0xAC, 0x00, 0x00, 0xDC, 0xE4, 0x00, 0x00, 0xEB, 0xD9, 
-0x00, 0x0B, 0xFE, 0xC1, 0x00, 0x00, 0xC6, 0xFD, 0x09, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x34, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0x91, 0xFF, 0x6D, 0x00, 0x00, 0x72, 0xFF, 
-0x8E, 0xBE, 0xFF, 0x41, 0x00, 0x00, 0x44, 0xFF, 0xBB, 0xEB, 0xFF, 0x15, 0x00, 0x00, 0x17, 0xFF, 
-0xE9, 0x00, 0x00, 0xBF, 0xDD, 0x7C, 0x29, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x2B, 0x80, 0xDF, 0xBF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 
-0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0x70, 0x00, 
-0x00, 0x00, 0x00, 0x9F, 0xDC, 0xEC, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xB9, 0xC7, 0xCA, 0x00, 
-0x00, 0x00, 0x02, 0xF6, 0x95, 0xA3, 0xF5, 0x02, 0x00, 0x00, 0x27, 0xFF, 0x72, 0x7E, 0xFF, 0x25, 
-0x00, 0x00, 0x54, 0xFF, 0x4E, 0x59, 0xFF, 0x52, 0x00, 0x00, 0x81, 0xFF, 0x2B, 0x35, 0xFF, 0x7F, 
-0x00, 0x00, 0xAF, 0xFE, 0x09, 0x10, 0xFF, 0xAC, 0x00, 0x00, 0xDC, 0xE4, 0x00, 0x00, 0xEB, 0xD9, 
-0x00, 0x0B, 0xFE, 0xC1, 0x00, 0x00, 0xC6, 0xFD, 0x09, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x34, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0x91, 0xFF, 0x6D, 0x00, 0x00, 0x72, 0xFF, 
-0x8E, 0xBE, 0xFF, 0x41, 0x00, 0x00, 0x44, 0xFF, 0xBB, 0xEB, 0xFF, 0x15, 0x00, 0x00, 0x17, 0xFF, 
-0xE9, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 
-0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0x70, 0x00, 
-0x00, 0x00, 0x00, 0x9F, 0xDC, 0xEC, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xB9, 0xC7, 0xCA, 0x00, 
-0x00, 0x00, 0x02, 0xF6, 0x95, 0xA3, 0xF5, 0x02, 0x00, 0x00, 0x27, 0xFF, 0x72, 0x7E, 0xFF, 0x25, 
-0x00, 0x00, 0x54, 0xFF, 0x4E, 0x59, 0xFF, 0x52, 0x00, 0x00, 0x81, 0xFF, 0x2B, 0x35, 0xFF, 0x7F, 
-0x00, 0x00, 0xAF, 0xFE, 0x09, 0x10, 0xFF, 0xAC, 0x00, 0x00, 0xDC, 0xE4, 0x00, 0x00, 0xEB, 0xD9, 
-0x00, 0x0B, 0xFE, 0xC1, 0x00, 0x00, 0xC6, 0xFD, 0x09, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x34, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0x91, 0xFF, 0x6D, 0x00, 0x00, 0x72, 0xFF, 
-0x8E, 0xBE, 0xFF, 0x41, 0x00, 0x00, 0x44, 0xFF, 0xBB, 0xEB, 0xFF, 0x15, 0x00, 0x00, 0x17, 0xFF, 
-0xE9, 0x00, 0x00, 0x4E, 0xDE, 0xDE, 0x4E, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0xDE, 0x00, 
-0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xFF, 0x65, 0x00, 
-0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0x70, 0x00, 
-0x00, 0x00, 0x00, 0x9F, 0xDC, 0xEC, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xB9, 0xC7, 0xCA, 0x00, 
-0x00, 0x00, 0x02, 0xF6, 0x95, 0xA3, 0xF5, 0x02, 0x00, 0x00, 0x27, 0xFF, 0x72, 0x7E, 0xFF, 0x25, 
-0x00, 0x00, 0x54, 0xFF, 0x4E, 0x59, 0xFF, 0x52, 0x00, 0x00, 0x81, 0xFF, 0x2B, 0x35, 0xFF, 0x7F, 
-0x00, 0x00, 0xAF, 0xFE, 0x09, 0x10, 0xFF, 0xAC, 0x00, 0x00, 0xDC, 0xE4, 0x00, 0x00, 0xEB, 0xD9, 
-0x00, 0x0B, 0xFE, 0xC1, 0x00, 0x00, 0xC6, 0xFD, 0x09, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x34, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0x91, 0xFF, 0x6D, 0x00, 0x00, 0x72, 0xFF, 
-0x8E, 0xBE, 0xFF, 0x41, 0x00, 0x00, 0x44, 0xFF, 0xBB, 0xEB, 0xFF, 0x15, 0x00, 0x00, 0x17, 0xFF, 
-0xE9, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x10, 
-0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x50, 0xD9, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xA0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xD2, 0x66, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFE, 0x2D, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xF2, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x96, 0xBB, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x82, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x19, 0xFF, 0x49, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x5A, 0xFE, 0x11, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x1E, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x72, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x44, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xE2, 0xFF, 0x16, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0xD7, 0xFE, 0xFF, 
-0xFE, 0xD5, 0x39, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x3B, 0xD7, 0xFE, 0xFF, 
-0xFE, 0xD6, 0x39, 0x00, 0x00, 0x69, 0xC7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x19, 0xB7, 0xBE, 0x00, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 
-0xB0, 0xFF, 0x2E, 0x00, 0x00, 0x17, 0xEB, 0x85, 0x00, 0x00, 0x00, 0x53, 0xDA, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x33, 0xFF, 0xB1, 0x00, 0x00, 0x87, 
-0xEC, 0x17, 0x00, 0x00, 0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x4A, 0xFD, 0x4F, 0x00, 0x1E, 0xE8, 0x89, 0xEB, 0x20, 0xC7, 0x59, 0x00, 0x61, 0xC8, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 
-0x2E, 0x17, 0xEB, 0x85, 0x00, 0x53, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x33, 0xFF, 0xB1, 
-0x87, 0xEC, 0x17, 0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x4A, 0xFD, 0x4F, 
-0x00, 0x1E, 0xE8, 0x89, 0xEB, 0x20, 0xC7, 0x59, 0x00, 0x61, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xDD, 0x7C, 0x29, 0xFF, 0x00, 
-0x00, 0xFF, 0x2B, 0x80, 0xDF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD5, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xBB, 0x2D, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x72, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x31, 0xB7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xDF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0xA6, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1C, 0xC9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x92, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0xFA, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xC3, 0xFF, 0x00, 0xB0, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x17, 0xEB, 0x85, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xFE, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD6, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xB1, 0x00, 
-0x00, 0x00, 0x00, 0x87, 0xEC, 0x17, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xD6, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xD6, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0x00, 0x00, 0x4A, 0xFD, 0x4F, 
-0x00, 0x00, 0x00, 0x1E, 0xE8, 0x89, 0xEB, 0x20, 0x00, 0x00, 0xC7, 0x59, 0x00, 0x61, 0xC8, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0xD7, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
-0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0x00, 0xBF, 
-0xDD, 0x7C, 0x29, 0xFF, 0x00, 0x00, 0xFF, 0x2B, 0x80, 0xDF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD6, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD6, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 
-0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xFE, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x3B, 
-0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0xAA, 0x34, 0x00, 0x00, 0x00, 0x30, 0xA9, 0x33, 0xEB, 0x54, 
-0x00, 0x4E, 0xE9, 0x33, 0x00, 0x52, 0xFC, 0xAD, 0xFC, 0x53, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0xB1, 
-0x00, 0x00, 0x00, 0x51, 0xFC, 0xB2, 0xFD, 0x54, 0x00, 0x32, 0xEB, 0x54, 0x00, 0x54, 0xEC, 0x34, 
-0xAA, 0x33, 0x00, 0x00, 0x00, 0x33, 0xAA, 0x00, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0x01, 
-0x48, 0x00, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x5F, 0x68, 0x00, 0xFE, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xC1, 0x06, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x42, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x03, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6B, 0x6A, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x11, 0xBF, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x92, 0x42, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x21, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x68, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x48, 0x3C, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0x00, 
-0x00, 0x00, 0x00, 0xB0, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x17, 0xEB, 0x85, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x53, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x3B, 0xD7, 0xFE, 
-0xFF, 0xFE, 0xD6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x87, 
-0xEC, 0x17, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 
-0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0x00, 0x00, 0x4A, 0xFD, 0x4F, 0x00, 0x00, 0x00, 0x1E, 
-0xE8, 0x89, 0xEB, 0x20, 0x00, 0x00, 0xC7, 0x59, 0x00, 0x61, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD6, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x3B, 
-0xD7, 0xFE, 0xFF, 0xFE, 0xD6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xB1, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xEC, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 
-0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFF, 
-0x2D, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xD6, 0x75, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x87, 
-0xFF, 0x73, 0x16, 0xFA, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xDF, 0xFA, 0x16, 0x00, 0xAE, 0xFF, 0x3C, 
-0x00, 0x00, 0x3A, 0xFF, 0xAC, 0x00, 0x00, 0x4B, 0xFF, 0x96, 0x00, 0x00, 0x93, 0xFF, 0x49, 0x00, 
-0x00, 0x03, 0xE4, 0xEC, 0x05, 0x03, 0xE9, 0xE3, 0x02, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x4B, 0x46, 
-0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xA6, 0xA0, 0xFB, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xB1, 0xF5, 0xF1, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0x52, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0x25, 0xFF, 
-0xFF, 0x00, 0x00, 0x44, 0xFF, 0xC6, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x8C, 0xFD, 0x65, 
-0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x9D, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7E, 0xFF, 0x9E, 0xFF, 0xFF, 
-0x00, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xE0, 0x4E, 0x00, 
-0xB0, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x17, 0xEB, 0x85, 0x00, 0x00, 0x00, 0x00, 0x53, 0xDA, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFE, 0xFE, 0xD0, 0x46, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x12, 
-0xB0, 0xFE, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x2F, 0x8F, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xE0, 0xAC, 
-0x66, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x87, 0xEC, 0x17, 0x00, 
-0x00, 0x00, 0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFE, 0xFE, 0xD0, 
-0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x12, 0xB0, 0xFE, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x8F, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x5A, 0xE0, 0xAC, 0x66, 0xFF, 0xFF, 0x00, 0x00, 0x4A, 0xFD, 0x4F, 0x00, 0x00, 0x1E, 0xE8, 
-0x89, 0xEB, 0x20, 0x00, 0xC7, 0x59, 0x00, 0x61, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 
-0xCE, 0xFE, 0xFE, 0xD0, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x12, 0xB0, 0xFE, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x8F, 0xFF, 0xFF, 0xE4, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xE0, 0xAC, 0x66, 0xFF, 0xFF, 0x00, 0xBF, 0xDD, 0x7C, 0x29, 
-0xFF, 0x00, 0xFF, 0x2B, 0x80, 0xDF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFE, 
-0xFE, 0xD0, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x12, 0xB0, 0xFE, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x8F, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x5A, 0xE0, 0xAC, 0x66, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFE, 0xFE, 0xD0, 
-0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x12, 0xB0, 0xFE, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x8F, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x5A, 0xE0, 0xAC, 0x66, 0xFF, 0xFF, 0x00, 0x4E, 0xDE, 0xDE, 0x4E, 0x00, 0x00, 0xDF, 0x00, 
-0x00, 0xDE, 0x00, 0x00, 0xDF, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x4E, 0xDF, 0xDF, 0x4E, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFE, 0xFE, 0xD0, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x12, 0xB0, 0xFE, 
-0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x2F, 0x8F, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xE0, 0xAC, 0x66, 0xFF, 
-0xFF, 0x47, 0xDA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE0, 0x4E, 0xDE, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x86, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xED, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x08, 0x08, 0x08, 0x08, 0x03, 0xFE, 0xFF, 0x01, 0x05, 0x09, 0xFF, 0xFF, 0x04, 0x04, 0x04, 0x00, 
-0x02, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xD3, 0x4E, 0xE0, 0xF9, 
-0xE2, 0xC8, 0xCA, 0xFD, 0xFF, 0xFF, 0xFE, 0xDE, 0x49, 0x22, 0xBC, 0xFD, 0xFD, 0xC6, 0x29, 0xC2, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x29, 
-0xC6, 0xFE, 0xFE, 0xC6, 0x29, 0x00, 0x00, 0x69, 0xC7, 0x02, 0x00, 0x00, 0x00, 0x19, 0xB7, 0xBE, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xB0, 0xFF, 
-0x2E, 0x00, 0x00, 0x00, 0x17, 0xEB, 0x85, 0x00, 0x00, 0x00, 0x00, 0x53, 0xDA, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD5, 0xFE, 0xFE, 0xD5, 0x31, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC5, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x31, 0xD6, 0xFE, 0xFE, 0xCB, 
-0x39, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x87, 0xEC, 0x17, 0x00, 0x00, 0x00, 
-0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD5, 0xFE, 0xFE, 0xD5, 0x31, 0xC5, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x31, 
-0xD6, 0xFE, 0xFE, 0xCB, 0x39, 0x00, 0x00, 0x4A, 0xFD, 0x4F, 0x00, 0x00, 0x1E, 0xE8, 0x89, 0xEB, 
-0x20, 0x00, 0xC7, 0x59, 0x00, 0x61, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD5, 0xFE, 
-0xFE, 0xD5, 0x31, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE9, 0x31, 0xD6, 0xFE, 0xFE, 0xCB, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD5, 0xFE, 0xFE, 0xD5, 
-0x31, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xE9, 0x31, 0xD6, 0xFE, 0xFE, 0xCB, 0x39, 0xB0, 0xFF, 0x2E, 0x17, 0xEB, 0x85, 0x00, 0x53, 0xDA, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x33, 0xFF, 0xB1, 0x00, 0x87, 0xEC, 0x17, 0x00, 0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4A, 0xFD, 0x4F, 0x00, 0x1E, 0xE8, 
-0x89, 0xEB, 0x20, 0xC7, 0x59, 0x00, 0x61, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xBF, 0xDD, 0x7C, 0x29, 0xFF, 0x00, 0xFF, 0x2B, 0x80, 0xDF, 0xBF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x1A, 0x76, 0xE0, 0xA2, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 
-0xD4, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xB0, 
-0xFF, 0x2E, 0x00, 0x00, 0x00, 0x17, 0xEB, 0x85, 0x00, 0x00, 0x00, 0x00, 0x53, 0xDA, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xD1, 0xFE, 0xFE, 0xD1, 0x28, 0xBD, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xBC, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x29, 0xD1, 0xFE, 0xFE, 
-0xD1, 0x28, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x87, 0xEC, 0x17, 0x00, 0x00, 
-0x00, 0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xD1, 0xFE, 0xFE, 0xD1, 0x28, 
-0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 
-0x29, 0xD1, 0xFE, 0xFE, 0xD1, 0x28, 0x00, 0x00, 0x4A, 0xFD, 0x4F, 0x00, 0x00, 0x1E, 0xE8, 0x89, 
-0xEB, 0x20, 0x00, 0xC7, 0x59, 0x00, 0x61, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xD1, 
-0xFE, 0xFE, 0xD1, 0x28, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xBD, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xBC, 0x29, 0xD1, 0xFE, 0xFE, 0xD1, 0x28, 0x00, 0xBF, 0xDD, 0x7C, 0x29, 0xFF, 
-0x00, 0xFF, 0x2B, 0x80, 0xDF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xD1, 0xFE, 0xFE, 
-0xD1, 0x28, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xBD, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xBC, 0x29, 0xD1, 0xFE, 0xFE, 0xD1, 0x28, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xD1, 0xFE, 0xFE, 0xD1, 0x28, 
-0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 
-0x29, 0xD1, 0xFE, 0xFE, 0xD1, 0x28, 0x00, 0x00, 0x00, 0xC5, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC5, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC5, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x28, 
-0xD1, 0xFE, 0xFE, 0xD1, 0x28, 0x16, 0x5C, 0x00, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xB5, 0x23, 
-0x00, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x35, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x85, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6A, 0x7F, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x99, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x04, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x5C, 
-0x3E, 0xD1, 0xFE, 0xFE, 0xD1, 0x28, 0x00, 0x00, 0xB0, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x17, 0xEB, 
-0x85, 0x00, 0x00, 0x00, 0x00, 0x53, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x17, 0x47, 0xFF, 0xFF, 
-0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0xF6, 0xE0, 0xB6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x33, 
-0xFF, 0xB1, 0x00, 0x00, 0x00, 0x87, 0xEC, 0x17, 0x00, 0x00, 0x00, 0xDC, 0x56, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x17, 0x47, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0xF6, 0xE0, 0xB6, 0xFF, 0xFF, 
-0x00, 0x00, 0x4A, 0xFD, 0x4F, 0x00, 0x00, 0x1E, 0xE8, 0x89, 0xEB, 0x20, 0x00, 0xC7, 0x59, 0x00, 
-0x61, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x17, 0x47, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0xF6, 
-0xE0, 0xB6, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFE, 0xFF, 0x17, 0x47, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0xF6, 0xE0, 0xB6, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x87, 0xEC, 0x17, 0x00, 0x00, 
-0x00, 0xDC, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0x0F, 0x10, 0xFF, 0xE5, 
-0xB3, 0xFF, 0x2D, 0x32, 0xFF, 0xB2, 0x80, 0xFF, 0x4C, 0x53, 0xFF, 0x7F, 0x4D, 0xFF, 0x6B, 0x74, 
-0xFF, 0x4C, 0x1A, 0xFF, 0x8A, 0x95, 0xFF, 0x19, 0x00, 0xE6, 0xA9, 0xB6, 0xE5, 0x00, 0x00, 0xB3, 
-0xC8, 0xD7, 0xB2, 0x00, 0x00, 0x80, 0xE8, 0xF6, 0x7F, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x4C, 0x00, 
-0x00, 0x1A, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x20, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x9F, 
-0x00, 0x00, 0x00, 0xA1, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xE6, 0xFF, 0x0F, 0x10, 0xFF, 0xE5, 0xB3, 0xFF, 0x2D, 0x32, 0xFF, 0xB2, 0x80, 0xFF, 0x4C, 0x53, 
-0xFF, 0x7F, 0x4D, 0xFF, 0x6B, 0x74, 0xFF, 0x4C, 0x1A, 0xFF, 0x8A, 0x95, 0xFF, 0x19, 0x00, 0xE6, 
-0xA9, 0xB6, 0xE5, 0x00, 0x00, 0xB3, 0xC8, 0xD7, 0xB2, 0x00, 0x00, 0x80, 0xE8, 0xF6, 0x7F, 0x00, 
-0x00, 0x4D, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x20, 0xFF, 0xDF, 
-0x00, 0x00, 0x00, 0x61, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xE0, 
-0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xA5, 0x00, 0x00, 0xFF, 
-0xFF, 0xE1, 0xCF, 0x00, 0x06, 0xFF, 0xFF, 0x8B, 0x06, 0x00, 0xCF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xA6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x03, 0xFF, 0xFF, 0xCD, 0xCF, 0xFF, 0xFF, 0x03, 0xB0, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x32, 0xD1, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x33, 0xD1, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xE0, 0xFE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE0, 0x4E, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE0, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 
-0x4E, 0xE0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE0, 0x4E, 0x00, 0xC9, 0x60, 0x00, 0x5C, 
-0xC7, 0x00, 0x00, 0x21, 0xEB, 0x89, 0xE8, 0x1E, 0x00, 0x00, 0x00, 0x51, 0xFD, 0x4A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xD6, 0xFE, 0xFF, 0xFE, 0xD7, 0x3B, 0xD7, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0x8E, 0xFF, 0xC0, 0x03, 0x00, 0x00, 
-0x00, 0x07, 0xCC, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x21, 0xEE, 0xFE, 0x4E, 0x00, 0x00, 0x00, 
-0x00, 0x4D, 0xFE, 0xEF, 0x22, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xCE, 0x08, 0x00, 0x00, 0x00, 
-0x03, 0xC0, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
-0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x3B, 0xD7, 0xFE, 0xFF, 0xFE, 0xD7, 0x3B, 0x00, 0xC9, 
-0x60, 0x00, 0x5C, 0xC7, 0x00, 0x21, 0xEB, 0x89, 0xE8, 0x1E, 0x00, 0x00, 0x51, 0xFD, 0x4A, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xBB, 0xFC, 0xFC, 0xBA, 0x27, 0xD1, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xD0, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xD7, 0xFF, 0x90, 0x06, 0xFF, 0xFF, 0x24, 0xD7, 
-0xFF, 0xCB, 0x23, 0x00, 0x00, 0x0E, 0xB4, 0xFF, 0xF1, 0x4E, 0xFF, 0xFF, 0x02, 0x88, 0xFF, 0xEE, 
-0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x29, 0xBD, 0xFD, 0xFD, 
-0xBD, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xD7, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xD6, 0x75, 0xFF, 0x87, 0x00, 0x00, 0x00, 
-0x00, 0x87, 0xFF, 0x73, 0x16, 0xFA, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xDF, 0xFA, 0x16, 0x00, 0xAE, 
-0xFF, 0x3C, 0x00, 0x00, 0x3A, 0xFF, 0xAC, 0x00, 0x00, 0x4B, 0xFF, 0x96, 0x00, 0x00, 0x93, 0xFF, 
-0x49, 0x00, 0x00, 0x03, 0xE4, 0xEC, 0x05, 0x03, 0xE9, 0xE3, 0x02, 0x00, 0x00, 0x00, 0x84, 0xFF, 
-0x4B, 0x46, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xA6, 0xA0, 0xFB, 0x1C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB1, 0xF5, 0xF1, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 
-0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x60, 0x00, 0x5C, 
-0xC7, 0x00, 0x00, 0x21, 0xEB, 0x89, 0xE8, 0x1E, 0x00, 0x00, 0x00, 0x51, 0xFD, 0x4A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x8E, 
-0xFF, 0x3E, 0x00, 0x00, 0x00, 0x04, 0xE8, 0xDE, 0x01, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x81, 0x00, 
-0x00, 0x00, 0x00, 0xAA, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x10, 0xF7, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x67, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xF7, 0x0F, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xA8, 
-0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xE7, 0x03, 0x00, 0x00, 
-0x00, 0x40, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF2, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC9, 0x60, 
-0x00, 0x5C, 0xC7, 0x00, 0x21, 0xEB, 0x89, 0xE8, 0x1E, 0x00, 0x00, 0x51, 0xFD, 0x4A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xE1, 0x00, 0x00, 0x00, 0x16, 0xEC, 0x47, 0x00, 0x00, 0x00, 0xAA, 0x9F, 0x00, 0x00, 0x00, 0x50, 
-0xE7, 0x11, 0x00, 0x00, 0x10, 0xE6, 0x51, 0x00, 0x00, 0x00, 0x9E, 0xAA, 0x00, 0x00, 0x00, 0x45, 
-0xEC, 0x16, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
-0xE4, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xAF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x46, 0x00, 
-0x00, 0x00, 0x00, 0x21, 0xFF, 0xFF, 0xFF, 0xEE, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0xFF, 0xD4, 
-0x00, 0x00, 0x00, 0x00, 0x23, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xB3, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x7E, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x5E, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xD9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0x0A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x34, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xB4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x8F, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x5E, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE9, 0x34, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFD, 0x0B, 0x00, 0x00, 0x00, 
-0x00, 0xF5, 0xFE, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFD, 0x4F, 0x00, 0x1E, 0xE8, 
-0x89, 0xEB, 0x20, 0xC7, 0x59, 0x00, 0x61, 0xC8, 0xC9, 0x60, 0x00, 0x5C, 0xC7, 0x21, 0xEB, 0x89, 
-0xE8, 0x1E, 0x00, 0x51, 0xFD, 0x4A, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xBF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x4E, 0xDE, 0xDE, 0x4E, 0xDF, 0x00, 0x00, 0xDE, 0xDF, 0x00, 0x00, 0xDE, 0x4E, 
-0xDF, 0xDF, 0x4E, 0x0B, 0x9F, 0x88, 0x00, 0xC3, 0x65, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xC6, 
-0xFF, 0xFF, 0xFF, 0xBF, 0xDD, 0x7C, 0x29, 0xFF, 0xFF, 0x2B, 0x80, 0xDF, 0xBF, 0x02, 0xD9, 0xB1, 
-0x02, 0xD9, 0xB1, 0x55, 0xEC, 0x17, 0x55, 0xEC, 0x17, 0xCC, 0x56, 0x00, 0xCC, 0x56, 0x00, 0x00, 
-0xA7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xA3, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 
-0x9C, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFA, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x19, 0xFF, 0x4D, 0xFF, 0x80, 0xFF, 0xB3, 0xFF, 0xE6, 0xFF, 0xFF, 0xE5, 0xFF, 0xB2, 0xFF, 
-0x7F, 0xFF, 0x4C, 0xFF, 0x19, 0xFF, 0xE5, 0xFF, 0xB2, 0xFF, 0x7F, 0xFF, 0x4C, 0xFF, 0x19, 0x19, 
-0xFF, 0x00, 0x19, 0xFF, 0x4D, 0xFF, 0x00, 0x4D, 0xFF, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0xB3, 0xFF, 
-0x00, 0xB3, 0xFF, 0xE6, 0xFF, 0x00, 0xE6, 0xFF, 0xFF, 0xE5, 0x00, 0xFF, 0xE5, 0xFF, 0xB2, 0x00, 
-0xFF, 0xB2, 0xFF, 0x7F, 0x00, 0xFF, 0x7F, 0xFF, 0x4C, 0x00, 0xFF, 0x4C, 0xFF, 0x19, 0x00, 0xFF, 
-0x19, 0xFF, 0xE5, 0x00, 0xFF, 0xE5, 0xFF, 0xB2, 0x00, 0xFF, 0xB2, 0xFF, 0x7F, 0x00, 0xFF, 0x7F, 
-0xFF, 0x4C, 0x00, 0xFF, 0x4C, 0xFF, 0x19, 0x00, 0xFF, 0x19, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x29, 0xC6, 0xFD, 0xFD, 0xC6, 0x29, 
-0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFE, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x29, 0xC6, 0xFE, 0xFE, 0xCE, 0x3A, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC7, 0xFE, 0xFF, 0xFE, 0xCC, 0x28, 0x00, 0x00, 0x4B, 0xC2, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x00, 
-0x01, 0xD0, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFE, 0x00, 0x5B, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x05, 0xDB, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6C, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE1, 0x1F, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xCA, 0xFE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xCC, 0x28, 0x00, 0x23, 0xC7, 0xFE, 0xFF, 0xFE, 0xCC, 0x28, 
-0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x00, 0xC6, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFE, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x37, 0xD3, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xBE, 0x4E, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFE, 0x00, 0x47, 0xC5, 0x00, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0xC9, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0xC1, 0x3D, 0x00, 0x26, 0xCA, 0xFE, 0xFF, 0xFE, 0xD2, 0x32, 
-0x00, 0x26, 0xCA, 0xFE, 0xFF, 0xFE, 0xD2, 0x32, 0x00, 0x3B, 0xFF, 0xB8, 0x00, 0xB4, 0xEF, 0x1B, 
-0x2C, 0xFE, 0x5C, 0x00, 0xA3, 0xAE, 0x00, 0x00, 0xF6, 0x2B, 0x00, 0x00, 0xA3, 0xAA, 0x00, 0x00, 
-0x2C, 0xFE, 0x55, 0x00, 0x00, 0xB4, 0xEA, 0x15, 0x00, 0x3C, 0xFF, 0xAA, 0xAB, 0xFF, 0x3B, 0x00, 
-0x15, 0xEA, 0xB3, 0x00, 0x00, 0x55, 0xFE, 0x2B, 0x00, 0x00, 0xAB, 0xA2, 0x00, 0x00, 0x2B, 0xF6, 
-0x00, 0x00, 0xAE, 0xA2, 0x00, 0x5D, 0xFE, 0x2C, 0x1B, 0xEF, 0xB3, 0x00, 0xB8, 0xFF, 0x3B, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0xCB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xB7, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0xD7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xA7, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x76, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE3, 0x18, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x87, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xE3, 0x10, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x24, 0xDF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x65, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x31, 0xD7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x54, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xCB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xC8, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xE6, 0xFF, 0xFF, 0xFF, 
-0xE6, 0x51, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x56, 0xE8, 0xFF, 0xFF, 0xFF, 
-0xE7, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0x13, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0x50, 0x00, 0x47, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x8D, 
-0x00, 0x87, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC8, 0x00, 0xC4, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0x17, 0xC9, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0x8E, 0x8B, 0x8F, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4E, 0xF4, 0x4F, 0xFF, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x10, 0xFB, 0x11, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0x00, 0x9C, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0xC2, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xBF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCB, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xBE, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0xD3, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF, 0xBD, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0xDA, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xBC, 
-0xA9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xAA, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xA8, 0x00, 0x00, 0x4F, 0xFF, 0x54, 0x00, 0x00, 0x00, 
-0x00, 0x7B, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x00, 0xD3, 
-0xCE, 0xD6, 0x00, 0x00, 0x00, 0x04, 0xF9, 0x6C, 0xFB, 0x06, 0x00, 0x00, 0x2B, 0xFC, 0x11, 0xFC, 
-0x2E, 0x00, 0x00, 0x58, 0xD3, 0x00, 0xD4, 0x5B, 0x00, 0x00, 0x84, 0xA2, 0x00, 0xA3, 0x87, 0x00, 
-0x00, 0xB0, 0x70, 0x00, 0x71, 0xB3, 0x00, 0x00, 0xDC, 0x3F, 0x00, 0x40, 0xDF, 0x00, 0x0A, 0xFC, 
-0x0F, 0x00, 0x10, 0xFD, 0x0C, 0x35, 0xDD, 0x00, 0x00, 0x00, 0xDE, 0x36, 0x61, 0xAB, 0x00, 0x00, 
-0x00, 0xAC, 0x62, 0x8D, 0x7A, 0x00, 0x00, 0x00, 0x7B, 0x8E, 0xB9, 0x49, 0x00, 0x00, 0x00, 0x4A, 
-0xB9, 0xE5, 0x18, 0x00, 0x00, 0x00, 0x19, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x4A, 0x00, 
-0x00, 0x00, 0x00, 0x36, 0xD8, 0x05, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x74, 0x00, 0x00, 0x00, 0x00, 
-0x27, 0xED, 0x18, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF5, 0x36, 
-0x00, 0x00, 0x00, 0x00, 0x89, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x86, 0xC8, 0x00, 0x00, 0x00, 0x16, 0xF2, 0x36, 0x00, 0x00, 0x00, 0x91, 0x9F, 0x00, 0x00, 0x00, 
-0x1D, 0xEA, 0x18, 0x00, 0x00, 0x00, 0x9C, 0x74, 0x00, 0x00, 0x00, 0x25, 0xD5, 0x06, 0x00, 0x00, 
-0x00, 0xA7, 0x4A, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 
-0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0E, 0xFA, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0x7B, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEA, 
-0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x84, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xCB, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x75, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x2D, 0x00, 0x67, 
-0xFF, 0x1F, 0x00, 0x00, 0x00, 0x41, 0xFF, 0x88, 0x00, 0xB3, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xC2, 0xE1, 0x09, 0xF5, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0x88, 0xFE, 0x1D, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFC, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xD0, 0x1D, 0x00, 0x18, 0xCB, 
-0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x05, 0xC5, 0xCE, 0x0E, 0xC6, 0xBD, 0x03, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1A, 0xE7, 0xE4, 0xE3, 0x15, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x69, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x15, 
-0xE5, 0xDF, 0xE8, 0x19, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xBB, 0xC8, 0x0B, 0xC4, 
-0xC1, 0x04, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xCF, 0x1C, 0x00, 0x17, 0xCA, 0xFF, 0xFF, 
-0xFF, 0xC1, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 
-0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 
-0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 
-0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0xB1, 0x00, 0x00, 0xCE, 0xDB, 0x86, 0x1B, 0x00, 
-0x00, 0xFF, 0xFF, 0x38, 0xA8, 0xF6, 0xA7, 0x37, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0x87, 0xDC, 0xCE, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xDB, 0x86, 0x1B, 0x00, 0x00, 0xFF, 0xFF, 0x38, 
-0xA8, 0xF6, 0xA7, 0x37, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0x87, 0xDC, 0xCE, 0x00, 0x00, 0x00, 0x00, 
-0x25, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xBB, 0x5C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x54, 
-0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 
-0x53, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x5D, 0xBA, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x25, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x95, 0x00, 0x00, 0x12, 0xBC, 0x70, 0x00, 0x2A, 
-0xD3, 0x52, 0x00, 0x4C, 0xDD, 0x39, 0x00, 0x00, 0xFB, 0x49, 0x00, 0x00, 0x00, 0x51, 0xDF, 0x38, 
-0x00, 0x00, 0x00, 0x2F, 0xD8, 0x51, 0x00, 0x00, 0x00, 0x17, 0xC4, 0x6F, 0x00, 0x00, 0x00, 0x07, 
-0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x07, 0x00, 0x00, 0x00, 0x70, 0xC2, 0x15, 0x00, 0x00, 
-0x00, 0x52, 0xD7, 0x2D, 0x00, 0x00, 0x00, 0x39, 0xDE, 0x4C, 0x00, 0x00, 0x00, 0x49, 0xFB, 0x00, 
-0x00, 0x38, 0xDE, 0x4E, 0x00, 0x52, 0xD4, 0x2C, 0x00, 0x6F, 0xBD, 0x13, 0x00, 0x00, 0x97, 0x04, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x48, 0xFD, 0x4F, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1A, 0xEA, 0x73, 0xEC, 0x1D, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xAA, 0x00, 0xAB, 
-0xC4, 0x04, 0x00, 0x00, 0x83, 0xF9, 0x22, 0x00, 0x23, 0xF9, 0x85, 0x00, 0x43, 0xFD, 0x8E, 0x00, 
-0x00, 0x00, 0x8F, 0xFD, 0x44, 0xD0, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xD0, 0x43, 0xFD, 
-0x8E, 0x00, 0x00, 0x00, 0x8F, 0xFD, 0x44, 0x00, 0x83, 0xF9, 0x22, 0x00, 0x22, 0xF9, 0x85, 0x00, 
-0x00, 0x03, 0xC1, 0xAA, 0x00, 0xAB, 0xC4, 0x04, 0x00, 0x00, 0x00, 0x1B, 0xEA, 0x73, 0xED, 0x1D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFD, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xE0, 0xFE, 0xFE, 
-0xE0, 0x4E, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x4E, 0xE0, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x09, 0x41, 0x67, 0x65, 0x6E, 
-0x63, 0x79, 0x20, 0x46, 0x42, 0x00, 0x0C, 0x41, 0x67, 0x65, 0x6E, 0x63, 0x79, 0x46, 0x42, 0x2D, 
-0x52, 0x65, 0x67, 0x01};
\ No newline at end of file
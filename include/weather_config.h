@@ -5,13 +5,17 @@
 // Period between automatic weather refreshes.
 constexpr uint32_t UPDATE_INTERVAL_MS = 5UL * 60UL * 1000UL;
 
-// How many successful updates before we re-sync NTP time.
-constexpr uint8_t SYNC_INTERVAL_UPDATES = 6;
+// How often the background SNTP client re-syncs the clock.
+constexpr uint32_t TIME_SYNC_INTERVAL_MS = 30UL * 60UL * 1000UL;
 
 // Sprite width/height match the PC dashboard canvas (M5Stack Core3: 320x240).
 constexpr int WEATHER_SCREEN_WIDTH = 320;
 constexpr int WEATHER_SCREEN_HEIGHT = 240;
 
+// Weather icons in the asset bundle (pack_assets.py checks the size).
+constexpr int WEATHER_ICON_WIDTH = 24;
+constexpr int WEATHER_ICON_HEIGHT = 24;
+
 // Scrolling text animation
 constexpr int16_t ANIMATION_START_POSITION = WEATHER_SCREEN_WIDTH;
 constexpr uint8_t WEATHER_SCROLL_STEP = 2;
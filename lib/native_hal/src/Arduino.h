@@ -0,0 +1,105 @@
+#pragma once
+
+// Host stand-in for the ESP32 Arduino core. Time is the process's monotonic
+// clock, Serial is whatever --serial points at (see native_hal.h) and
+// FreeRTOS tasks are threads.
+
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+
+#include "Stream.h"
+#include "WString.h"
+#include "native_freertos.h"
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define DEC 10
+#define HEX 16
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+typedef uint8_t byte;
+
+unsigned long millis();  // 32-bit wrap, as on the ESP32
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// No GPIO on the host: inputs read idle (pulled up).
+inline void pinMode(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+inline void digitalWrite(uint8_t, uint8_t) {}
+
+uint32_t esp_random();
+inline void *ps_malloc(size_t size) { return malloc(size); }
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+#define NATIVE_HAL_STRLCPY 1
+extern "C" size_t strlcpy(char *dst, const char *src, size_t size);
+#endif
+
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char *server1,
+                const char *server2 = nullptr, const char *server3 = nullptr);
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long baud);
+  void end() {}
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  int availableForWrite() { return 4096; }  // stdout never pushes back
+  void flush() override;
+  operator bool() const { return true; }
+
+ private:
+  bool fill();
+
+  uint8_t rx_[512];
+  size_t rxHead_ = 0;
+  size_t rxLen_ = 0;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+ public:
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap() { return getFreeHeap(); }
+  uint32_t getMaxAllocHeap() { return getFreeHeap(); }
+  uint32_t getHeapSize();
+  uint32_t getPsramSize() { return 0; }
+  uint32_t getFreePsram() { return 0; }
+  uint32_t getCycleCount() { return micros() * 240; }
+  void restart();
+};
+
+extern EspClass ESP;
+
+// Firmware entry points, called by the host main() (native_main.cpp).
+void setup();
+void loop();
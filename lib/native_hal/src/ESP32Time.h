@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Arduino.h>
+#include <sys/time.h>
+
+#include <atomic>
+
+// RTC on the host: the system clock plus whatever correction setTime()
+// asked for (the host clock itself is never changed).
+class ESP32Time {
+ public:
+  explicit ESP32Time(long offsetSec = 0) : offset_(offsetSec) {}
+
+  void setTime(unsigned long epoch, int ms = 0);
+  void setTimeStruct(tm t) { setTime((unsigned long)timegm(&t)); }
+  tm getTimeStruct() const;
+  unsigned long getEpoch() const;
+  unsigned long getLocalEpoch() const { return getEpoch() + offset_; }
+  unsigned long getMillis() const;
+
+ private:
+  long offset_;
+  static std::atomic<int64_t> correctionUs_;  // shared, like the one clock on the chip
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <memory>
+
+struct NativeFile;
+
+// A host file opened through LittleFS (paths are under --fs, see
+// native_hal.h). Copies share the handle.
+class File : public Stream {
+ public:
+  File() {}
+  explicit File(std::shared_ptr<NativeFile> file) : file_(file) {}
+
+  explicit operator bool() const;
+  size_t size() const;
+  size_t position() const;
+  bool seek(size_t pos);
+  time_t getLastWrite() const;
+  bool isDirectory() const;
+  const char *name() const;
+  const char *path() const;
+  void close() { file_.reset(); }
+
+  int available() override;
+  int read() override;
+  size_t read(uint8_t *buffer, size_t size);
+  int peek() override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  void flush() override;
+
+ private:
+  std::shared_ptr<NativeFile> file_;
+};
+
+namespace fs {
+
+class FS {
+ public:
+  bool exists(const char *path) const;
+  bool exists(const String &path) const { return exists(path.c_str()); }
+  File open(const char *path, const char *mode = "r", bool create = false);
+  File open(const String &path, const char *mode = "r", bool create = false) {
+    return open(path.c_str(), mode, create);
+  }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool mkdir(const char *path);
+
+ protected:
+  String hostPath(const char *path) const;
+};
+
+}  // namespace fs
@@ -0,0 +1,68 @@
+#pragma once
+
+// HTTP/1.1 GET over a WiFiClient the caller owns, with keep-alive reuse,
+// Content-Length and chunked bodies: the part of the ESP32 HTTPClient the
+// weather fetch relies on.
+
+#include <Arduino.h>
+
+#include <utility>
+#include <vector>
+
+#include "WiFiClient.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_STREAM (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM (-8)
+#define HTTPC_ERROR_ENCODING (-9)
+#define HTTPC_ERROR_STREAM_WRITE (-10)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_NOT_MODIFIED 304
+#define HTTP_CODE_NOT_FOUND 404
+#define HTTP_CODE_TOO_MANY_REQUESTS 429
+
+class HTTPClient {
+ public:
+  bool begin(WiFiClient &client, const String &url);
+  void end();
+
+  void useHTTP10(bool http10 = true) { http10_ = http10; }
+  void setReuse(bool reuse) { reuse_ = reuse; }
+  void setTimeout(uint16_t timeoutMs) { timeoutMs_ = timeoutMs; }
+  void setConnectTimeout(int32_t timeoutMs) { connectTimeoutMs_ = timeoutMs; }
+  void collectHeaders(const char *const headerKeys[], size_t count);
+
+  int GET();
+  String header(const char *name) const;
+  bool hasHeader(const char *name) const;
+  int getSize() const { return size_; }
+  WiFiClient &getStream() { return *client_; }
+  WiFiClient *getStreamPtr() { return client_; }
+  int writeToStream(Stream *out);
+  String getString();
+  bool connected() { return client_ && client_->connected(); }
+  static String errorToString(int error);
+
+ private:
+  int readHeaders();
+
+  WiFiClient *client_ = nullptr;
+  String host_;
+  uint16_t port_ = 80;
+  String path_;
+  bool http10_ = false;
+  bool reuse_ = true;
+  bool canReuse_ = false;
+  bool chunked_ = false;
+  uint16_t timeoutMs_ = 5000;
+  int32_t connectTimeoutMs_ = 5000;
+  int size_ = -1;
+  std::vector<std::pair<String, String>> headers_;  // collected names, received values
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "FS.h"
+
+// LittleFS mounted on a host directory (--fs, default "data", i.e. what
+// `pio run -t uploadfs` would flash).
+class LittleFSFS : public fs::FS {
+ public:
+  bool begin(bool formatOnFail = false, const char *basePath = "/littlefs", uint8_t maxOpenFiles = 10,
+             const char *partitionLabel = "spiffs");
+  void end() {}
+  size_t totalBytes() const { return 0; }
+  size_t usedBytes() const { return 0; }
+};
+
+extern LittleFSFS LittleFS;
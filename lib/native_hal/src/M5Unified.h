@@ -0,0 +1,211 @@
+#pragma once
+
+// M5Unified / LovyanGFX on the host: the display is a 320x240 RGB565
+// framebuffer in memory (see native_hal.h to read it back), sprites are
+// plain pixel buffers and touch comes from nativeTouch().
+
+#include <Arduino.h>
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_DARKCYAN 0x03EF
+#define TFT_MAROON 0x7800
+#define TFT_PURPLE 0x780F
+#define TFT_OLIVE 0x7BE0
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_DARKGREY 0x7BEF
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+#define TFT_ORANGE 0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK 0xFE19
+
+// Adafruit GFX font layout, as the Free_Fonts.h names expect.
+struct GFXglyph {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;  // top of the bitmap relative to the baseline
+};
+
+struct GFXfont {
+  const uint8_t *bitmap;
+  const GFXglyph *glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+};
+
+// Only the fonts the firmware draws with; see native_fonts.h.
+extern const GFXfont FreeSans9pt7b;
+extern const GFXfont FreeSans12pt7b;
+extern const GFXfont FreeSansBold12pt7b;
+
+enum textdatum_t : uint8_t {
+  TL_DATUM = 0,
+  TC_DATUM = 1,
+  TR_DATUM = 2,
+  ML_DATUM = 4,
+  MC_DATUM = 5,
+  MR_DATUM = 6,
+  BL_DATUM = 8,
+  BC_DATUM = 9,
+  BR_DATUM = 10,
+  L_BASELINE = 16,
+  C_BASELINE = 17,
+  R_BASELINE = 18,
+};
+
+class LovyanGFX {
+ public:
+  virtual ~LovyanGFX() {}
+
+  int32_t width() const { return width_; }
+  int32_t height() const { return height_; }
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+  void fillScreen(uint32_t color) { fillRect(0, 0, width_, height_, color); }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *pixels);
+  uint16_t readPixel(int32_t x, int32_t y) const;
+
+  void setTextColor(uint32_t fg) {
+    textFg_ = fg;
+    textBg_ = fg;
+  }
+  void setTextColor(uint32_t fg, uint32_t bg) {
+    textFg_ = fg;
+    textBg_ = bg;
+  }
+  void setTextDatum(uint8_t datum) { datum_ = datum; }
+  void setFreeFont(const GFXfont *font) { font_ = font; }
+  void setFont(const GFXfont *font) { font_ = font; }
+
+  int32_t drawString(const char *text, int32_t x, int32_t y);
+  int32_t drawString(const String &text, int32_t x, int32_t y) { return drawString(text.c_str(), x, y); }
+  int32_t textWidth(const char *text) const;
+  int32_t textWidth(const String &text) const { return textWidth(text.c_str()); }
+  int32_t fontHeight() const;
+
+  void startWrite() {}
+  void endWrite() {}
+  void waitDMA() {}
+
+ protected:
+  void allocate(int32_t w, int32_t h);
+  void release();
+  int32_t drawGlyph(const GFXglyph &glyph, int32_t x, int32_t top, int32_t baseline, int32_t cellH);
+  void countPixels(int32_t n);  // see nativePixelCounts()
+
+  uint16_t *buffer_ = nullptr;
+  int32_t width_ = 0;
+  int32_t height_ = 0;
+  uint32_t textFg_ = TFT_WHITE;
+  uint32_t textBg_ = TFT_WHITE;
+  uint8_t datum_ = TL_DATUM;
+  const GFXfont *font_ = nullptr;
+};
+
+class M5GFX : public LovyanGFX {
+ public:
+  bool begin();
+  void setRotation(uint8_t rotation);
+  void setBrightness(uint8_t brightness) { brightness_ = brightness; }
+  uint8_t getBrightness() const { return brightness_; }
+
+  const uint16_t *framebuffer() const { return buffer_; }
+  uint32_t frames() const { return frames_; }
+
+ private:
+  friend class LGFX_Sprite;
+
+  uint8_t brightness_ = 127;
+  uint32_t frames_ = 0;  // sprite pushes landed on the panel
+};
+
+class LGFX_Sprite : public LovyanGFX {
+ public:
+  explicit LGFX_Sprite(LovyanGFX *parent = nullptr) : parent_(parent) {}
+  ~LGFX_Sprite() override { release(); }
+
+  void setColorDepth(int bits) { (void)bits; }  // always RGB565
+  void setPsram(bool) {}
+  void *createSprite(int32_t w, int32_t h);
+  void deleteSprite() { release(); }
+  void *getBuffer() { return buffer_; }
+  void fillSprite(uint32_t color) { fillScreen(color); }
+  void pushSprite(int32_t x, int32_t y) { pushSprite(parent_, x, y); }
+  void pushSprite(LovyanGFX *dst, int32_t x, int32_t y);
+
+ private:
+  LovyanGFX *parent_;
+};
+
+namespace m5 {
+
+struct touch_detail_t {
+  int16_t x = -1;
+  int16_t y = -1;
+  int16_t base_x = -1;
+  int16_t base_y = -1;
+  uint8_t state = 0;  // bit 0: pressed now, bit 1: changed on this update
+
+  bool isPressed() const { return state & 1; }
+  bool wasPressed() const { return state == 3; }
+  bool wasReleased() const { return state == 2; }
+  bool wasClicked() const { return wasReleased(); }
+  bool isHolding() const { return state == 1; }
+  int distanceX() const { return x - base_x; }
+  int distanceY() const { return y - base_y; }
+};
+
+class Touch_Class {
+ public:
+  // Latest state as of the last M5.update().
+  const touch_detail_t &getDetail(size_t index = 0) const {
+    (void)index;
+    return detail_;
+  }
+  uint8_t getCount() const { return detail_.isPressed() ? 1 : 0; }
+  bool isEnabled() const { return true; }
+
+  void update();
+
+ private:
+  touch_detail_t detail_;
+};
+
+struct config_t {
+  uint32_t serial_baudrate = 115200;
+  bool clear_display = true;
+};
+
+class M5Unified {
+ public:
+  M5GFX Display;
+  M5GFX &Lcd = Display;
+  Touch_Class Touch;
+
+  config_t config() const { return config_t(); }
+  void begin(const config_t &cfg = config_t()) {
+    (void)cfg;
+    Display.begin();
+  }
+  void update() { Touch.update(); }
+};
+
+}  // namespace m5
+
+extern m5::M5Unified M5;
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+
+// NVS on the host: one key/value store per namespace, shared by every
+// Preferences object, kept in memory and saved to --nvs after each write
+// when that option is given.
+class Preferences {
+ public:
+  bool begin(const char *name, bool readOnly = false, const char *partitionLabel = nullptr);
+  void end() { ns_ = String(); }
+
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key) const;
+
+  size_t putBytes(const char *key, const void *value, size_t len);
+  size_t getBytes(const char *key, void *buf, size_t maxLen) const;
+  size_t getBytesLength(const char *key) const;
+
+  size_t putString(const char *key, const char *value);
+  size_t putString(const char *key, const String &value) { return putString(key, value.c_str()); }
+  String getString(const char *key, const String &defaultValue = String()) const;
+
+  size_t putUChar(const char *key, uint8_t value) { return putBytes(key, &value, sizeof(value)); }
+  uint8_t getUChar(const char *key, uint8_t defaultValue = 0) const { return get(key, defaultValue); }
+  size_t putUShort(const char *key, uint16_t value) { return putBytes(key, &value, sizeof(value)); }
+  uint16_t getUShort(const char *key, uint16_t defaultValue = 0) const { return get(key, defaultValue); }
+  size_t putUInt(const char *key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0) const { return get(key, defaultValue); }
+  size_t putInt(const char *key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+  int32_t getInt(const char *key, int32_t defaultValue = 0) const { return get(key, defaultValue); }
+  size_t putBool(const char *key, bool value) { return putUChar(key, value ? 1 : 0); }
+  bool getBool(const char *key, bool defaultValue = false) const {
+    return getUChar(key, defaultValue ? 1 : 0) != 0;
+  }
+  size_t putFloat(const char *key, float value) { return putBytes(key, &value, sizeof(value)); }
+  float getFloat(const char *key, float defaultValue = NAN) const { return get(key, defaultValue); }
+
+ private:
+  template <typename T>
+  T get(const char *key, T defaultValue) const {
+    T value;
+    return getBytesLength(key) == sizeof(T) && getBytes(key, &value, sizeof(T)) == sizeof(T)
+               ? value
+               : defaultValue;
+  }
+
+  String ns_;
+  bool readOnly_ = false;
+};
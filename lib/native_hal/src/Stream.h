@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "WString.h"
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+  virtual void flush() {}
+
+  size_t print(const char *str) { return write(str); }
+  size_t print(const String &s) { return write(s.c_str(), s.length()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = 10) { return print(String(v, base)); }
+  size_t print(unsigned v, int base = 10) { return print(String(v, base)); }
+  size_t print(long v, int base = 10) { return print(String(v, base)); }
+  size_t print(unsigned long v, int base = 10) { return print(String(v, base)); }
+  size_t print(double v, int decimals = 2) { return print(String(v, decimals)); }
+
+  size_t println() { return write("\n"); }
+  template <typename T>
+  size_t println(const T &v) {
+    return print(v) + println();
+  }
+  template <typename T>
+  size_t println(const T &v, int format) {
+    return print(v, format) + println();
+  }
+
+  // One write() per call, so lines from different tasks don't interleave.
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  void setTimeout(unsigned long timeoutMs) { timeout_ = timeoutMs; }
+  unsigned long getTimeout() const { return timeout_; }
+
+  // Like Arduino: wait up to the timeout for each byte.
+  virtual size_t readBytes(char *buffer, size_t length);
+  size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+  String readStringUntil(char terminator);
+  bool find(const char *target);
+  bool findUntil(const char *target, const char *terminator);
+
+ protected:
+  int timedRead();
+  int timedPeek();
+
+  unsigned long timeout_ = 1000;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Arduino.h>
+
+// A String you can write into and read back out of.
+class StreamString : public Stream, public String {
+ public:
+  size_t write(uint8_t c) override {
+    concat((char)c);
+    return 1;
+  }
+  size_t write(const uint8_t *buffer, size_t size) override {
+    concat((const char *)buffer, size);
+    return size;
+  }
+  using Print::write;
+
+  int available() override { return (int)(length() - readPos_); }
+  int read() override { return readPos_ < length() ? (uint8_t)charAt(readPos_++) : -1; }
+  int peek() override { return readPos_ < length() ? (uint8_t)charAt(readPos_) : -1; }
+
+ private:
+  unsigned int readPos_ = 0;
+};
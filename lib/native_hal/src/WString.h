@@ -0,0 +1,163 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+// Arduino String on std::string: the subset the firmware (and ArduinoJson's
+// ARDUINOJSON_ENABLE_ARDUINO_STRING adapter) uses, with the same semantics.
+class String {
+ public:
+  String(const char *cstr = "") : s_(cstr ? cstr : "") {}
+  String(const char *cstr, size_t len) : s_(cstr, len) {}
+  String(const std::string &s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(int v, unsigned char base = 10);
+  explicit String(unsigned v, unsigned char base = 10);
+  explicit String(long v, unsigned char base = 10);
+  explicit String(unsigned long v, unsigned char base = 10);
+  explicit String(long long v);
+  explicit String(unsigned long long v);
+  explicit String(float v, unsigned int decimals = 2);
+  explicit String(double v, unsigned int decimals = 2);
+
+  const char *c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+  bool reserve(unsigned int size) {
+    s_.reserve(size);
+    return true;
+  }
+  char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  void setCharAt(unsigned int i, char c) {
+    if (i < s_.size()) s_[i] = c;
+  }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char &operator[](unsigned int i) { return s_[i]; }
+
+  bool concat(const char *cstr) {
+    if (!cstr) return false;
+    s_ += cstr;
+    return true;
+  }
+  bool concat(const char *cstr, unsigned int len) {
+    if (!cstr) return false;
+    s_.append(cstr, len);
+    return true;
+  }
+  bool concat(const String &s) {
+    s_ += s.s_;
+    return true;
+  }
+  bool concat(char c) {
+    s_ += c;
+    return true;
+  }
+  template <typename T>
+  bool concat(T v) {
+    return concat(String(v));
+  }
+
+  String &operator+=(const String &s) {
+    concat(s);
+    return *this;
+  }
+  String &operator+=(const char *cstr) {
+    concat(cstr);
+    return *this;
+  }
+  String &operator+=(char c) {
+    concat(c);
+    return *this;
+  }
+  template <typename T>
+  String &operator+=(T v) {
+    concat(String(v));
+    return *this;
+  }
+
+  bool equals(const String &s) const { return s_ == s.s_; }
+  bool equals(const char *cstr) const { return s_ == (cstr ? cstr : ""); }
+  bool operator==(const String &s) const { return equals(s); }
+  bool operator==(const char *cstr) const { return equals(cstr); }
+  bool operator!=(const String &s) const { return !equals(s); }
+  bool operator!=(const char *cstr) const { return !equals(cstr); }
+  bool operator<(const String &s) const { return s_ < s.s_; }
+  bool equalsIgnoreCase(const String &s) const;
+
+  bool startsWith(const String &prefix) const { return s_.compare(0, prefix.s_.size(), prefix.s_) == 0; }
+  bool endsWith(const String &suffix) const {
+    return s_.size() >= suffix.s_.size() &&
+           s_.compare(s_.size() - suffix.s_.size(), suffix.s_.size(), suffix.s_) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { return pos(s_.find(c, from)); }
+  int indexOf(const String &s, unsigned int from = 0) const { return pos(s_.find(s.s_, from)); }
+  int lastIndexOf(char c) const { return pos(s_.rfind(c)); }
+  int lastIndexOf(const String &s) const { return pos(s_.rfind(s.s_)); }
+
+  String substring(unsigned int begin) const { return substring(begin, length()); }
+  String substring(unsigned int begin, unsigned int end) const;
+
+  void remove(unsigned int index) { remove(index, length()); }
+  void remove(unsigned int index, unsigned int count) {
+    if (index < s_.size()) s_.erase(index, count);
+  }
+  void replace(const String &find, const String &with);
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+  void toCharArray(char *buf, unsigned int size, unsigned int index = 0) const;
+  void getBytes(unsigned char *buf, unsigned int size, unsigned int index = 0) const {
+    toCharArray(reinterpret_cast<char *>(buf), size, index);
+  }
+
+  long toInt() const { return atol(s_.c_str()); }
+  float toFloat() const { return (float)atof(s_.c_str()); }
+  double toDouble() const { return atof(s_.c_str()); }
+
+  const std::string &str() const { return s_; }
+
+ private:
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+
+  std::string s_;
+};
+
+// ArduinoJson recognises concatenation temporaries by this type.
+class StringSumHelper : public String {
+ public:
+  StringSumHelper(const String &s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String &a, const String &b) {
+  String r(a);
+  r += b;
+  return r;
+}
+inline StringSumHelper operator+(const String &a, const char *b) {
+  String r(a);
+  r += b;
+  return r;
+}
+inline StringSumHelper operator+(const char *a, const String &b) {
+  String r(a);
+  r += b;
+  return r;
+}
+inline StringSumHelper operator+(const String &a, char b) {
+  String r(a);
+  r += b;
+  return r;
+}
+template <typename T>
+StringSumHelper operator+(const String &a, T b) {
+  String r(a);
+  r += String(b);
+  return r;
+}
+inline bool operator==(const char *a, const String &b) { return b == a; }
+inline bool operator!=(const char *a, const String &b) { return b != a; }
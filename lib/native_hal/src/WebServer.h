@@ -0,0 +1,80 @@
+#pragma once
+
+// ESP32 WebServer on a host listening socket. Port 80 is remapped to
+// --http-port (default 8080) so the host build needs no privileges.
+// One request per connection (Connection: close), served from
+// handleClient() on the calling task, as on the device.
+
+#include <Arduino.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "WiFiClient.h"
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+class WebServer {
+ public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  explicit WebServer(int port = 80) : port_(port) {}
+  ~WebServer();
+
+  void begin();
+  void close();
+  void handleClient();
+
+  void on(const String &uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+  void on(const String &uri, HTTPMethod method, THandlerFunction handler);
+  void onNotFound(THandlerFunction handler) { notFound_ = handler; }
+
+  String uri() const { return uri_; }
+  HTTPMethod method() const { return method_; }
+  WiFiClient client() const { return client_; }
+
+  String arg(const String &name) const;
+  bool hasArg(const String &name) const;
+  int args() const { return (int)args_.size(); }
+  void collectHeaders(const char *const headerKeys[], size_t count);
+  String header(const String &name) const;
+  bool hasHeader(const String &name) const;
+
+  void sendHeader(const String &name, const String &value, bool first = false);
+  void setContentLength(size_t length) { contentLength_ = length; }
+  void send(int code, const char *contentType = nullptr, const String &content = String());
+  void send(int code, const String &contentType, const String &content) {
+    send(code, contentType.c_str(), content);
+  }
+  void sendContent(const char *content, size_t size);
+  void sendContent(const String &content) { sendContent(content.c_str(), content.length()); }
+
+ private:
+  struct Route {
+    String uri;
+    HTTPMethod method;
+    THandlerFunction handler;
+  };
+
+  bool readRequest();
+  void parseArgs(const String &encoded);
+
+  int port_;
+  int listenFd_ = -1;
+  std::vector<Route> routes_;
+  THandlerFunction notFound_;
+
+  WiFiClient client_;
+  String uri_;
+  HTTPMethod method_ = HTTP_GET;
+  std::vector<std::pair<String, String>> args_;
+  std::vector<std::pair<String, String>> headers_;
+  std::vector<String> collected_;
+  String responseHeaders_;
+  size_t contentLength_ = CONTENT_LENGTH_NOT_SET;
+  bool responded_ = false;
+};
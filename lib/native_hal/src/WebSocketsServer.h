@@ -0,0 +1,70 @@
+#pragma once
+
+// Placeholder for links2004/WebSockets: the server never has clients on
+// the host, so the stats feed only counts what it would have sent. The
+// dashboard falls back to polling /metrics.
+
+#include <Arduino.h>
+
+#include <functional>
+
+enum WStype_t {
+  WStype_ERROR,
+  WStype_DISCONNECTED,
+  WStype_CONNECTED,
+  WStype_TEXT,
+  WStype_BIN,
+  WStype_FRAGMENT_TEXT_START,
+  WStype_FRAGMENT_BIN_START,
+  WStype_FRAGMENT,
+  WStype_FRAGMENT_FIN,
+  WStype_PING,
+  WStype_PONG,
+};
+
+class WebSocketsServer {
+ public:
+  typedef std::function<void(uint8_t num, WStype_t type, uint8_t *payload, size_t length)>
+      WebSocketServerEvent;
+
+  explicit WebSocketsServer(uint16_t port, const String &origin = "", const String &protocol = "arduino")
+      : port_(port) {
+    (void)origin;
+    (void)protocol;
+  }
+
+  void begin() {}
+  void close() {}
+  void loop() {}
+  void onEvent(WebSocketServerEvent event) { event_ = event; }
+  int connectedClients(bool ping = false) {
+    (void)ping;
+    return 0;
+  }
+  bool sendBIN(uint8_t num, const uint8_t *payload, size_t length, bool headerToPayload = false) {
+    (void)num;
+    (void)payload;
+    (void)length;
+    (void)headerToPayload;
+    return false;
+  }
+  bool broadcastBIN(const uint8_t *payload, size_t length, bool headerToPayload = false) {
+    (void)payload;
+    (void)length;
+    (void)headerToPayload;
+    return false;
+  }
+  bool sendTXT(uint8_t num, const char *payload) {
+    (void)num;
+    (void)payload;
+    return false;
+  }
+  bool broadcastTXT(const char *payload) {
+    (void)payload;
+    return false;
+  }
+
+ private:
+  uint16_t port_;
+  WebSocketServerEvent event_;
+};
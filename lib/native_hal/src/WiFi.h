@@ -0,0 +1,46 @@
+#pragma once
+
+// The host is always "connected" on loopback; sockets are the host's own.
+
+#include <Arduino.h>
+
+#include "WiFiClient.h"
+
+#define WL_IDLE_STATUS 0
+#define WL_NO_SSID_AVAIL 1
+#define WL_CONNECTED 3
+#define WL_CONNECT_FAILED 4
+#define WL_DISCONNECTED 6
+
+#define WIFI_OFF 0
+#define WIFI_STA 1
+#define WIFI_AP 2
+#define WIFI_AP_STA 3
+
+class WiFiClass {
+ public:
+  int status() const { return WL_CONNECTED; }
+  bool mode(int m) {
+    (void)m;
+    return true;
+  }
+  int begin(const char *ssid, const char *pass = nullptr) {
+    (void)ssid;
+    (void)pass;
+    return WL_CONNECTED;
+  }
+  bool disconnect(bool wifiOff = false) {
+    (void)wifiOff;
+    return true;
+  }
+  bool isConnected() const { return true; }
+  bool setSleep(bool enable) {
+    (void)enable;
+    return true;
+  }
+  IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+  int8_t RSSI() const { return -40; }
+  String SSID() const { return "native"; }
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <memory>
+
+class IPAddress {
+ public:
+  IPAddress() : addr_(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+      : addr_((uint32_t)a | (uint32_t)b << 8 | (uint32_t)c << 16 | (uint32_t)d << 24) {}
+  IPAddress(uint32_t addr) : addr_(addr) {}  // network order, as on ESP32
+
+  operator uint32_t() const { return addr_; }
+  uint8_t operator[](int i) const { return (uint8_t)(addr_ >> (8 * i)); }
+  String toString() const;
+
+ private:
+  uint32_t addr_;
+};
+
+struct NativeSocket;
+
+// TCP client on a host socket. Copies share the connection, like the ESP32
+// WiFiClient; reads are buffered and never block (Stream's timeout waits).
+class WiFiClient : public Stream {
+ public:
+  WiFiClient() {}
+  explicit WiFiClient(int fd);
+  ~WiFiClient() override {}
+
+  virtual int connect(const char *host, uint16_t port);
+  virtual int connect(const char *host, uint16_t port, int32_t timeoutMs);
+  int connect(IPAddress ip, uint16_t port);
+  virtual uint8_t connected();
+  virtual void stop();
+  operator bool() { return connected(); }
+
+  int available() override;
+  int read() override;
+  int read(uint8_t *buffer, size_t size);
+  int peek() override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  size_t readBytes(char *buffer, size_t length) override;
+  using Stream::readBytes;
+  void flush() override {}
+
+  IPAddress remoteIP() const;
+  uint16_t remotePort() const;
+  void setNoDelay(bool) {}
+  int fd() const;
+
+ protected:
+  std::shared_ptr<NativeSocket> socket_;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "WiFi.h"
+#include "WiFiClient.h"
+
+// No TLS on the host: connect() fails (logged once). Point the weather URLs
+// at plain http://, e.g. mock_weather_server.py, through /weather/config.
+class WiFiClientSecure : public WiFiClient {
+ public:
+  void setInsecure() {}
+  void setCACert(const char *) {}
+  void setHandshakeTimeout(unsigned long) {}
+
+  int connect(const char *host, uint16_t port) override;
+  int connect(const char *host, uint16_t port, int32_t timeoutMs) override;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+#include <sys/time.h>
+
+// The host clock is already disciplined, so configTime() reports one
+// immediate "sync" with the current time and nothing further.
+
+typedef enum { SNTP_SYNC_MODE_IMMED, SNTP_SYNC_MODE_SMOOTH } sntp_sync_mode_t;
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+
+void sntp_set_sync_mode(sntp_sync_mode_t mode);
+void sntp_set_sync_interval(uint32_t intervalMs);
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
+bool sntp_restart();
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+// Microseconds since start, like the ESP32 boot-relative timer.
+int64_t esp_timer_get_time();
@@ -0,0 +1,333 @@
+#include <Arduino.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <malloc.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "native_hal.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+namespace {
+
+std::chrono::steady_clock::time_point startTime() {
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return start;
+}
+
+uint64_t elapsedUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                               startTime())
+      .count();
+}
+
+void writeAll(int fd, const uint8_t *data, size_t len) {
+  while (len) {
+    ssize_t n = ::write(fd, data, len);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return;
+    data += n;
+    len -= n;
+  }
+}
+
+String formatUnsigned(unsigned long long v, unsigned char base) {
+  if (base < 2 || base > 36) base = 10;
+  char buf[66];
+  char *p = buf + sizeof(buf);
+  *--p = '\0';
+  do {
+    unsigned digit = v % base;
+    *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    v /= base;
+  } while (v);
+  return String(p);
+}
+
+String formatSigned(long long v, unsigned char base) {
+  if (v >= 0 || base != 10) return formatUnsigned((unsigned long long)v, base);
+  String s("-");
+  s += formatUnsigned(0ULL - (unsigned long long)v, base);
+  return s;
+}
+
+String formatFloat(double v, unsigned int decimals) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+  return String(buf);
+}
+
+}  // namespace
+
+// ------------------- Time -------------------
+
+unsigned long millis() { return (uint32_t)(elapsedUs() / 1000); }
+unsigned long micros() { return (uint32_t)elapsedUs(); }
+int64_t esp_timer_get_time() { return (int64_t)elapsedUs(); }
+
+void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+void yield() { std::this_thread::yield(); }
+
+uint32_t esp_random() {
+  static std::mutex lock;
+  static std::mt19937 rng{std::random_device{}()};
+  std::lock_guard<std::mutex> guard(lock);
+  return rng();
+}
+
+#ifdef NATIVE_HAL_STRLCPY
+extern "C" size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
+
+// ------------------- String -------------------
+
+String::String(int v, unsigned char base) : String(formatSigned(v, base)) {}
+String::String(unsigned v, unsigned char base) : String(formatUnsigned(v, base)) {}
+String::String(long v, unsigned char base) : String(formatSigned(v, base)) {}
+String::String(unsigned long v, unsigned char base) : String(formatUnsigned(v, base)) {}
+String::String(long long v) : String(formatSigned(v, 10)) {}
+String::String(unsigned long long v) : String(formatUnsigned(v, 10)) {}
+String::String(float v, unsigned int decimals) : String(formatFloat(v, decimals)) {}
+String::String(double v, unsigned int decimals) : String(formatFloat(v, decimals)) {}
+
+bool String::equalsIgnoreCase(const String &s) const {
+  if (s_.size() != s.s_.size()) return false;
+  for (size_t i = 0; i < s_.size(); ++i) {
+    if (tolower((unsigned char)s_[i]) != tolower((unsigned char)s.s_[i])) return false;
+  }
+  return true;
+}
+
+String String::substring(unsigned int begin, unsigned int end) const {
+  if (begin > end) std::swap(begin, end);
+  if (begin >= s_.size()) return String();
+  if (end > s_.size()) end = (unsigned int)s_.size();
+  return String(s_.substr(begin, end - begin));
+}
+
+void String::replace(const String &find, const String &with) {
+  if (find.s_.empty()) return;
+  size_t pos = 0;
+  while ((pos = s_.find(find.s_, pos)) != std::string::npos) {
+    s_.replace(pos, find.s_.size(), with.s_);
+    pos += with.s_.size();
+  }
+}
+
+void String::toLowerCase() {
+  for (char &c : s_) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+  for (char &c : s_) c = (char)toupper((unsigned char)c);
+}
+
+void String::trim() {
+  size_t begin = 0, end = s_.size();
+  while (begin < end && isspace((unsigned char)s_[begin])) ++begin;
+  while (end > begin && isspace((unsigned char)s_[end - 1])) --end;
+  s_ = s_.substr(begin, end - begin);
+}
+
+void String::toCharArray(char *buf, unsigned int size, unsigned int index) const {
+  if (!size || !buf) return;
+  if (index >= s_.size()) {
+    buf[0] = '\0';
+    return;
+  }
+  size_t n = s_.size() - index;
+  if (n > size - 1) n = size - 1;
+  memcpy(buf, s_.data() + index, n);
+  buf[n] = '\0';
+}
+
+// ------------------- Print / Stream -------------------
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (n < size && write(buffer[n])) ++n;
+  return n;
+}
+
+size_t Print::printf(const char *format, ...) {
+  char small[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (len < 0) return 0;
+  if ((size_t)len < sizeof(small)) return write((const uint8_t *)small, len);
+
+  std::string big(len + 1, '\0');
+  va_start(args, format);
+  vsnprintf(&big[0], big.size(), format, args);
+  va_end(args);
+  return write((const uint8_t *)big.data(), len);
+}
+
+int Stream::timedRead() {
+  uint32_t start = millis();
+  do {
+    int c = read();
+    if (c >= 0) return c;
+    delay(1);
+  } while (millis() - start < timeout_);
+  return -1;
+}
+
+int Stream::timedPeek() {
+  uint32_t start = millis();
+  do {
+    int c = peek();
+    if (c >= 0) return c;
+    delay(1);
+  } while (millis() - start < timeout_);
+  return -1;
+}
+
+size_t Stream::readBytes(char *buffer, size_t length) {
+  size_t n = 0;
+  while (n < length) {
+    int c = timedRead();
+    if (c < 0) break;
+    buffer[n++] = (char)c;
+  }
+  return n;
+}
+
+String Stream::readStringUntil(char terminator) {
+  String out;
+  int c = timedRead();
+  while (c >= 0 && c != terminator) {
+    out += (char)c;
+    c = timedRead();
+  }
+  return out;
+}
+
+bool Stream::find(const char *target) { return findUntil(target, nullptr); }
+
+bool Stream::findUntil(const char *target, const char *terminator) {
+  size_t targetLen = strlen(target);
+  size_t termLen = terminator ? strlen(terminator) : 0;
+  size_t matched = 0, termMatched = 0;
+  if (!targetLen) return true;
+  int c;
+  while ((c = timedRead()) >= 0) {
+    matched = (c == target[matched]) ? matched + 1 : (c == target[0] ? 1 : 0);
+    if (matched == targetLen) return true;
+    if (termLen) {
+      termMatched = (c == terminator[termMatched]) ? termMatched + 1 : (c == terminator[0] ? 1 : 0);
+      if (termMatched == termLen) return false;
+    }
+  }
+  return false;
+}
+
+// ------------------- Serial -------------------
+// Output is the host's stdout (and a pty's other end, like a USB serial
+// port, dropped if nobody reads it); input is the fd nativeSerialOpen() set
+// up, read without blocking.
+
+namespace {
+int serialFd = -1;
+int ptySlaveFd = -1;  // held open so the master never sees a hangup
+}  // namespace
+
+bool nativeSerialOpen() {
+  const char *path = nativeOptions().serialPath;
+  if (!path || !*path) return true;
+  if (strcmp(path, "-") == 0) {
+    serialFd = STDIN_FILENO;
+  } else if (strcmp(path, "pty") == 0) {
+    serialFd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (serialFd < 0 || grantpt(serialFd) != 0 || unlockpt(serialFd) != 0) {
+      perror("serial: pty");
+      return false;
+    }
+    ptySlaveFd = open(ptsname(serialFd), O_RDWR | O_NOCTTY);
+    // A serial port, not a terminal: no echo or line editing
+    struct termios raw;
+    if (tcgetattr(ptySlaveFd, &raw) == 0) {
+      cfmakeraw(&raw);
+      tcsetattr(ptySlaveFd, TCSANOW, &raw);
+    }
+    printf("Serial: pty %s\n", ptsname(serialFd));
+    fflush(stdout);
+  } else {
+    serialFd = open(path, O_RDONLY | O_NONBLOCK | O_NOCTTY);
+    if (serialFd < 0) {
+      perror(path);
+      return false;
+    }
+  }
+  fcntl(serialFd, F_SETFL, fcntl(serialFd, F_GETFL) | O_NONBLOCK);
+  return true;
+}
+
+void HardwareSerial::begin(unsigned long baud) { (void)baud; }
+
+bool HardwareSerial::fill() {
+  if (rxHead_ < rxLen_) return true;
+  if (serialFd < 0) return false;
+  ssize_t n = ::read(serialFd, rx_, sizeof(rx_));
+  if (n <= 0) return false;  // nothing yet, EOF, or no peer on the pty
+  rxHead_ = 0;
+  rxLen_ = (size_t)n;
+  return true;
+}
+
+int HardwareSerial::available() { return fill() ? (int)(rxLen_ - rxHead_) : 0; }
+
+int HardwareSerial::read() { return fill() ? rx_[rxHead_++] : -1; }
+
+int HardwareSerial::peek() { return fill() ? rx_[rxHead_] : -1; }
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  writeAll(STDOUT_FILENO, buffer, size);
+  if (ptySlaveFd >= 0) writeAll(serialFd, buffer, size);
+  return size;
+}
+
+void HardwareSerial::flush() {}
+
+// ------------------- ESP -------------------
+
+uint32_t EspClass::getFreeHeap() {
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+  return (uint32_t)mallinfo2().fordblks;
+#else
+  return 0;
+#endif
+}
+
+uint32_t EspClass::getHeapSize() {
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+  return (uint32_t)mallinfo2().arena;
+#else
+  return 0;
+#endif
+}
+
+void EspClass::restart() {
+  Serial.println("ESP.restart(): exiting");
+  fflush(stdout);
+  _exit(0);
+}
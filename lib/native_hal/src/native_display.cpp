@@ -0,0 +1,277 @@
+#include <M5Unified.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <deque>
+#include <mutex>
+
+#include "native_fonts.h"
+#include "native_hal.h"
+
+m5::M5Unified M5;
+
+namespace {
+
+NativePixelCounts pixelCounts;
+
+}  // namespace
+
+// ------------------- Drawing -------------------
+
+void LovyanGFX::allocate(int32_t w, int32_t h) {
+  release();
+  buffer_ = static_cast<uint16_t *>(calloc((size_t)w * h, sizeof(uint16_t)));
+  if (!buffer_) return;
+  width_ = w;
+  height_ = h;
+}
+
+void LovyanGFX::release() {
+  free(buffer_);
+  buffer_ = nullptr;
+  width_ = height_ = 0;
+}
+
+// Writes into the panel are pushes; anything else is drawing.
+void LovyanGFX::countPixels(int32_t n) {
+  if (n <= 0) return;
+  if (this == &M5.Display) {
+    pixelCounts.pushed += n;
+  } else {
+    pixelCounts.touched += n;
+  }
+}
+
+void LovyanGFX::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_) return;
+  buffer_[y * width_ + x] = (uint16_t)color;
+  countPixels(1);
+}
+
+void LovyanGFX::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  int32_t x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y;
+  int32_t x1 = x + w > width_ ? width_ : x + w, y1 = y + h > height_ ? height_ : y + h;
+  if (x1 <= x0 || y1 <= y0) return;
+  for (int32_t row = y0; row < y1; ++row) {
+    uint16_t *p = buffer_ + row * width_;
+    for (int32_t col = x0; col < x1; ++col) p[col] = (uint16_t)color;
+  }
+  countPixels((x1 - x0) * (y1 - y0));
+}
+
+void LovyanGFX::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (w <= 0 || h <= 0) return;
+  fillRect(x, y, w, 1, color);
+  if (h > 1) fillRect(x, y + h - 1, w, 1, color);
+  if (h > 2) {
+    fillRect(x, y + 1, 1, h - 2, color);
+    if (w > 1) fillRect(x + w - 1, y + 1, 1, h - 2, color);
+  }
+}
+
+void LovyanGFX::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+  int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int32_t err = dx + dy;
+  for (;;) {
+    drawPixel(x0, y0, color);
+    if (x0 == x1 && y0 == y1) break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+void LovyanGFX::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *pixels) {
+  int32_t x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y;
+  int32_t x1 = x + w > width_ ? width_ : x + w, y1 = y + h > height_ ? height_ : y + h;
+  if (x1 <= x0 || y1 <= y0) return;
+  for (int32_t row = y0; row < y1; ++row) {
+    memcpy(buffer_ + row * width_ + x0, pixels + (row - y) * w + (x0 - x),
+           (size_t)(x1 - x0) * sizeof(uint16_t));
+  }
+  countPixels((x1 - x0) * (y1 - y0));
+}
+
+uint16_t LovyanGFX::readPixel(int32_t x, int32_t y) const {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_) return 0;
+  return buffer_[y * width_ + x];
+}
+
+// ------------------- Text -------------------
+// GFX fonts only, ASCII only: other bytes (UTF-8 sequences) are skipped.
+
+namespace {
+
+const GFXglyph *glyphFor(const GFXfont *font, unsigned char c) {
+  if (!font || c < font->first || c > font->last) return nullptr;
+  return &font->glyph[c - font->first];
+}
+
+// Extent of the font around the baseline, over all its glyphs.
+void fontExtent(const GFXfont *font, int32_t &ascent, int32_t &descent) {
+  ascent = descent = 0;
+  if (!font) return;
+  for (uint16_t c = font->first; c <= font->last; ++c) {
+    const GFXglyph &g = font->glyph[c - font->first];
+    if (!g.height) continue;
+    if (-g.yOffset > ascent) ascent = -g.yOffset;
+    if (g.yOffset + g.height > descent) descent = g.yOffset + g.height;
+  }
+}
+
+}  // namespace
+
+int32_t LovyanGFX::textWidth(const char *text) const {
+  int32_t w = 0;
+  for (const unsigned char *p = (const unsigned char *)text; *p; ++p) {
+    const GFXglyph *g = glyphFor(font_, *p);
+    if (g) w += g->xAdvance;
+  }
+  return w;
+}
+
+int32_t LovyanGFX::fontHeight() const { return font_ ? font_->yAdvance : 8; }
+
+int32_t LovyanGFX::drawGlyph(const GFXglyph &glyph, int32_t x, int32_t top, int32_t baseline,
+                             int32_t cellH) {
+  if (textBg_ != textFg_) fillRect(x, top, glyph.xAdvance, cellH, textBg_);
+  const uint8_t *bits = font_->bitmap + glyph.bitmapOffset;
+  uint32_t bit = 0;
+  for (int32_t row = 0; row < glyph.height; ++row) {
+    for (int32_t col = 0; col < glyph.width; ++col, ++bit) {
+      if (bits[bit >> 3] & (0x80 >> (bit & 7))) {
+        drawPixel(x + glyph.xOffset + col, baseline + glyph.yOffset + row, textFg_);
+      }
+    }
+  }
+  return glyph.xAdvance;
+}
+
+int32_t LovyanGFX::drawString(const char *text, int32_t x, int32_t y) {
+  if (!font_ || !text) return 0;
+  int32_t ascent, descent;
+  fontExtent(font_, ascent, descent);
+  int32_t w = textWidth(text);
+  int32_t cellH = ascent + descent;
+
+  uint8_t horizontal = datum_ & 3;
+  if (horizontal == 1) x -= w / 2;
+  if (horizontal == 2) x -= w;
+
+  int32_t top = y;
+  if (datum_ & L_BASELINE) {
+    top = y - ascent;
+  } else if ((datum_ & 12) == 4) {
+    top = y - cellH / 2;
+  } else if ((datum_ & 12) == 8) {
+    top = y - cellH;
+  }
+
+  int32_t cx = x;
+  for (const unsigned char *p = (const unsigned char *)text; *p; ++p) {
+    const GFXglyph *g = glyphFor(font_, *p);
+    if (g) cx += drawGlyph(*g, cx, top, top + ascent, cellH);
+  }
+  return w;
+}
+
+// ------------------- Panel and sprites -------------------
+
+bool M5GFX::begin() {
+  if (!buffer_) allocate(NATIVE_PANEL_WIDTH, NATIVE_PANEL_HEIGHT);
+  return buffer_ != nullptr;
+}
+
+void M5GFX::setRotation(uint8_t rotation) {
+  // Landscape (1, 3) is the panel's native buffer; portrait swaps it.
+  int32_t w = (rotation & 1) ? NATIVE_PANEL_WIDTH : NATIVE_PANEL_HEIGHT;
+  int32_t h = (rotation & 1) ? NATIVE_PANEL_HEIGHT : NATIVE_PANEL_WIDTH;
+  if (w != width_ || h != height_) allocate(w, h);
+}
+
+void *LGFX_Sprite::createSprite(int32_t w, int32_t h) {
+  allocate(w, h);
+  return buffer_;
+}
+
+void LGFX_Sprite::pushSprite(LovyanGFX *dst, int32_t x, int32_t y) {
+  if (!dst || !buffer_) return;
+  dst->pushImage(x, y, width_, height_, buffer_);
+  if (dst == &M5.Display) M5.Display.frames_++;
+}
+
+const uint16_t *nativePanel() { return M5.Display.framebuffer(); }
+
+uint32_t nativePanelFrames() { return M5.Display.frames(); }
+
+NativePixelCounts nativePixelCounts() { return pixelCounts; }
+
+bool nativeWritePpm(const char *path, const uint16_t *pixels, int width, int height) {
+  if (!pixels) pixels = nativePanel();
+  if (!pixels) return false;
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", width, height);
+  for (int i = 0; i < width * height; ++i) {
+    uint16_t c = pixels[i];
+    uint8_t rgb[3] = {(uint8_t)((c >> 11) * 255 / 31), (uint8_t)(((c >> 5) & 63) * 255 / 63),
+                      (uint8_t)((c & 31) * 255 / 31)};
+    fwrite(rgb, 1, 3, f);
+  }
+  return fclose(f) == 0;
+}
+
+// ------------------- Touch -------------------
+
+namespace {
+
+struct TouchEvent {
+  int16_t x;
+  int16_t y;
+  bool pressed;
+};
+
+std::mutex touchLock;
+std::deque<TouchEvent> touchEvents;
+
+}  // namespace
+
+void nativeTouch(int x, int y, bool pressed) {
+  std::lock_guard<std::mutex> held(touchLock);
+  touchEvents.push_back(TouchEvent{(int16_t)x, (int16_t)y, pressed});
+}
+
+void m5::Touch_Class::update() {
+  bool was = detail_.isPressed();
+  TouchEvent event = {detail_.x, detail_.y, was};
+  {
+    std::lock_guard<std::mutex> held(touchLock);
+    if (!touchEvents.empty()) {
+      event = touchEvents.front();
+      touchEvents.pop_front();
+    }
+  }
+  detail_.x = event.x;
+  detail_.y = event.y;
+  if (event.pressed && !was) {
+    detail_.base_x = event.x;
+    detail_.base_y = event.y;
+  }
+  detail_.state = (event.pressed ? 1 : 0) | (event.pressed != was ? 2 : 0);
+}
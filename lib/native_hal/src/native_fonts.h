@@ -0,0 +1,522 @@
+// Generated by pack_assets.py - do not edit.
+// Stand-ins for the LovyanGFX free fonts, cut from assets/fonts.
+#pragma once
+
+#include <M5Unified.h>
+
+const uint8_t kFreeSans9pt7bBitmaps[892] = {
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x66, 0xDE, 0xF7, 0xB0, 0x0D, 0x86, 0xC6, 0xCF, 0xF7, 0xF8,
+  0xD8, 0x6C, 0x6C, 0x36, 0x7F, 0xBF, 0xC6, 0xC6, 0xC3, 0x60, 0x31, 0xEF, 0xF3, 0xCF, 0x0E, 0x1C,
+  0x38, 0x7C, 0xF3, 0xCF, 0xF7, 0x8C, 0x60, 0xA4, 0x49, 0x12, 0x48, 0x92, 0x25, 0x06, 0x40, 0x26,
+  0x0A, 0x44, 0x91, 0x24, 0x89, 0x22, 0x50, 0x60, 0x7C, 0xFE, 0xC6, 0xC6, 0xC6, 0xC0, 0x7F, 0x7F,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xFE, 0x7E, 0xFF, 0x36, 0x66, 0xCC, 0xCC, 0xCC, 0xCC, 0x66, 0x63, 0xC6,
+  0x66, 0x33, 0x33, 0x33, 0x33, 0x66, 0x6C, 0x32, 0xDF, 0xDE, 0xFE, 0xD3, 0x00, 0x18, 0x18, 0x18,
+  0xFF, 0xFF, 0x18, 0x18, 0x18, 0xFA, 0xFF, 0xFC, 0x03, 0x06, 0x06, 0x0E, 0x0C, 0x0C, 0x18, 0x18,
+  0x30, 0x30, 0x70, 0x60, 0x60, 0xC0, 0x7B, 0xFC, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xFD,
+  0xE0, 0x6F, 0xF6, 0xDB, 0x6D, 0xB6, 0xC0, 0x7D, 0xFF, 0x1E, 0x30, 0x61, 0x83, 0x0C, 0x38, 0x61,
+  0x83, 0x0F, 0xFF, 0xC0, 0x7B, 0xFC, 0xF3, 0x0C, 0xE7, 0x0E, 0x0F, 0x3C, 0xF3, 0xFD, 0xE0, 0x18,
+  0x18, 0x18, 0x30, 0x30, 0x66, 0x66, 0x66, 0xC6, 0xFF, 0xFF, 0x06, 0x06, 0x06, 0xFF, 0xFC, 0x30,
+  0xC3, 0xEF, 0xC3, 0x0F, 0x3C, 0xF3, 0xFD, 0xE0, 0x7B, 0xFC, 0xF3, 0xC3, 0x0F, 0xBF, 0xCF, 0x3C,
+  0xF3, 0xFD, 0xE0, 0xFF, 0xFF, 0x1E, 0x20, 0xC1, 0x83, 0x06, 0x18, 0x30, 0x60, 0xC3, 0x06, 0x00,
+  0x7B, 0xFC, 0xF3, 0xCD, 0xE7, 0x9E, 0xCF, 0x3C, 0xF3, 0xFD, 0xE0, 0x7B, 0xFC, 0xF3, 0xCF, 0x3F,
+  0xDF, 0x0C, 0x3C, 0xF3, 0xFD, 0xE0, 0xF0, 0x0F, 0xF0, 0x0E, 0x80, 0x08, 0xCC, 0xCC, 0x30, 0xC3,
+  0x08, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x86, 0x18, 0x61, 0x99, 0x98, 0x80, 0x7B, 0xFC, 0xF3, 0x0C,
+  0x63, 0x9C, 0x61, 0x86, 0x00, 0x61, 0x80, 0x7F, 0x40, 0x60, 0x31, 0x19, 0x4C, 0xA6, 0x13, 0x19,
+  0x94, 0xCA, 0x63, 0xD0, 0x08, 0x03, 0xFC, 0x18, 0x18, 0x3C, 0x3C, 0x3C, 0x3C, 0x24, 0x66, 0x66,
+  0x66, 0x7E, 0x7E, 0xC3, 0xC3, 0xFD, 0xFF, 0x1E, 0x3C, 0x78, 0xFF, 0x7E, 0xC7, 0x8F, 0x1E, 0x3F,
+  0xFF, 0x80, 0x7D, 0xFF, 0x1E, 0x3C, 0x78, 0x30, 0x60, 0xC1, 0x83, 0x1E, 0x3F, 0xEF, 0x80, 0xF9,
+  0xFB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3F, 0xDF, 0x00, 0xFF, 0xF1, 0x8C, 0x63,
+  0xFF, 0xC6, 0x31, 0x8F, 0xFC, 0xFF, 0xF1, 0x8C, 0x63, 0xDE, 0xC6, 0x31, 0x8C, 0x60, 0x7D, 0xFF,
+  0x1E, 0x3C, 0x18, 0x33, 0xE7, 0xC7, 0x8F, 0x1E, 0x3F, 0xEF, 0x80, 0xC7, 0x8F, 0x1E, 0x3C, 0x78,
+  0xFF, 0xFF, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x07, 0x8F, 0x1E, 0x3F, 0xEF, 0x80, 0xC7, 0x9B, 0x36, 0xCD, 0x9E, 0x3C, 0x78,
+  0xF1, 0xB3, 0x66, 0x6C, 0xD8, 0xC0, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8F, 0xFC, 0xC1,
+  0xE0, 0xF8, 0xFC, 0x7E, 0x3F, 0xBF, 0xDF, 0xBB, 0xDD, 0xEE, 0xF7, 0x79, 0x3C, 0x1E, 0x0C, 0xC7,
+  0x8F, 0x9F, 0x3F, 0x7E, 0xFD, 0xEF, 0xDF, 0x9F, 0x3E, 0x7C, 0x78, 0xC0, 0x7D, 0xFF, 0x1E, 0x3C,
+  0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3F, 0xEF, 0x80, 0xFD, 0xFF, 0x1E, 0x3C, 0x78, 0xF1, 0xFF,
+  0xFD, 0x83, 0x06, 0x0C, 0x18, 0x00, 0x7C, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xCE,
+  0xCE, 0xC6, 0xFF, 0x7F, 0xFC, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xDC, 0xD8, 0xD8, 0xCC, 0xCC, 0xCC,
+  0xC6, 0xC6, 0x7D, 0xFF, 0x1E, 0x3C, 0x0C, 0x0E, 0x0E, 0x0E, 0x0F, 0x1E, 0x3F, 0xEF, 0x80, 0xFF,
+  0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1,
+  0xE3, 0xC7, 0x8F, 0x1E, 0x3F, 0xEF, 0x80, 0xCF, 0x3C, 0xF2, 0x49, 0x26, 0x9E, 0x79, 0xE7, 0x0C,
+  0x30, 0xC0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x64, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
+  0xBC, 0x39, 0xC1, 0x98, 0x19, 0x81, 0x98, 0xC6, 0x89, 0xB3, 0x63, 0x87, 0x0E, 0x1C, 0x38, 0x71,
+  0xB3, 0x6C, 0x58, 0xC0, 0xC3, 0xC3, 0x66, 0x66, 0x24, 0x3C, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0xFF, 0xF0, 0xC6, 0x18, 0x43, 0x0C, 0x21, 0x86, 0x30, 0xFF, 0xF0, 0x7F, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xF7, 0xC3, 0x06, 0x18, 0x60, 0xC3, 0x0C, 0x30, 0x61, 0x86, 0x0C, 0x30,
+  0xEF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFE, 0x10, 0x71, 0xE3, 0x6C, 0x60, 0xFF, 0xFC, 0x63,
+  0x7B, 0xFC, 0xC3, 0x7F, 0x3C, 0xFF, 0x6C, 0xC3, 0x0C, 0x30, 0xC3, 0xEF, 0xF3, 0xCF, 0x3C, 0xF3,
+  0xFF, 0xE0, 0x7B, 0xFC, 0xF0, 0xC3, 0x0C, 0xFF, 0x78, 0x0C, 0x30, 0xC3, 0x0D, 0xFF, 0xF3, 0xCF,
+  0x3C, 0xF3, 0xFD, 0xB0, 0x7B, 0xFC, 0xF3, 0xFF, 0x0C, 0xFF, 0x78, 0x37, 0x66, 0x6F, 0xF6, 0x66,
+  0x66, 0x66, 0x7F, 0xFC, 0xF3, 0xCF, 0x3C, 0xFF, 0x7C, 0x3C, 0xFF, 0x78, 0xC3, 0x0C, 0x30, 0xC3,
+  0x6F, 0xFB, 0xCF, 0x3C, 0xF3, 0xCF, 0x30, 0x66, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0xEC, 0xC3, 0x0C, 0x30, 0xC3, 0x3D, 0xB6, 0xF3, 0xCF, 0x36, 0xDB, 0x30,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xD9, 0xBF, 0xFE, 0xEF, 0x33, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0xCC, 0xC0,
+  0xDB, 0xFE, 0xF3, 0xCF, 0x3C, 0xF3, 0xCC, 0x7B, 0xFC, 0xF3, 0xCF, 0x3C, 0xFF, 0x78, 0xFB, 0xFC,
+  0xF3, 0xCF, 0x3C, 0xFF, 0xFB, 0x0C, 0x30, 0xC0, 0x7F, 0xFC, 0xF3, 0xCF, 0x3C, 0xFF, 0x7C, 0x30,
+  0xC3, 0x0C, 0xDB, 0xFE, 0xF3, 0xC3, 0x0C, 0x30, 0xC0, 0x7B, 0xFC, 0xF8, 0x78, 0x7C, 0xFF, 0x78,
+  0x66, 0xFF, 0x66, 0x66, 0x67, 0x30, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xFF, 0x7C, 0xCF, 0x34, 0x9E,
+  0x79, 0xE3, 0x0C, 0x30, 0xCC, 0xF3, 0x34, 0xC9, 0xFE, 0x7F, 0x9F, 0xE3, 0x30, 0xCC, 0x33, 0x00,
+  0xC6, 0xD9, 0xF1, 0xC3, 0x87, 0x1F, 0x36, 0xC6, 0xCF, 0x34, 0x9E, 0x79, 0xE7, 0x8C, 0x30, 0xC3,
+  0x18, 0x60, 0xFF, 0xCE, 0x67, 0x33, 0x9F, 0xF8, 0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x18, 0xC1, 0x83,
+  0x0C, 0x30, 0xC3, 0x0C, 0x3C, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xE3, 0xC3, 0x0C, 0x30, 0xC3,
+  0x06, 0x0C, 0x63, 0x0C, 0x30, 0xC3, 0x0C, 0xF3, 0x80, 0xE7, 0xFF, 0x38,
+};
+
+const GFXglyph kFreeSans9pt7bGlyphs[] = {
+  {0, 0, 0, 5, 0, 0},  // ' '
+  {0, 4, 14, 3, -1, -14},  // '!'
+  {7, 5, 4, 6, 0, -14},  // '"'
+  {10, 9, 14, 10, 0, -14},  // '#'
+  {26, 6, 16, 7, 0, -15},  // '$'
+  {38, 10, 14, 10, 0, -14},  // '%'
+  {56, 8, 14, 9, 0, -14},  // '&'
+  {70, 2, 4, 4, 1, -14},  // "'"
+  {71, 4, 16, 6, 1, -14},  // '('
+  {79, 4, 16, 5, 0, -14},  // ')'
+  {87, 6, 7, 8, 1, -14},  // '*'
+  {93, 8, 8, 8, 0, -10},  // '+'
+  {101, 2, 4, 4, 1, -3},  // ','
+  {102, 4, 2, 5, 0, -6},  // '-'
+  {103, 2, 3, 3, 0, -3},  // '.'
+  {104, 8, 14, 8, 0, -14},  // '/'
+  {118, 6, 14, 7, 0, -14},  // '0'
+  {129, 3, 14, 4, 0, -14},  // '1'
+  {135, 7, 14, 8, 0, -14},  // '2'
+  {148, 6, 14, 7, 0, -14},  // '3'
+  {159, 8, 14, 8, 0, -14},  // '4'
+  {173, 6, 14, 7, 0, -14},  // '5'
+  {184, 6, 14, 7, 0, -14},  // '6'
+  {195, 7, 14, 8, 1, -14},  // '7'
+  {208, 6, 14, 7, 0, -14},  // '8'
+  {219, 6, 14, 7, 0, -14},  // '9'
+  {230, 2, 8, 4, 1, -8},  // ':'
+  {232, 2, 9, 4, 1, -8},  // ';'
+  {235, 5, 9, 7, 1, -10},  // '<'
+  {241, 6, 6, 8, 1, -8},  // '='
+  {246, 5, 9, 7, 1, -10},  // '>'
+  {252, 6, 14, 7, 0, -14},  // '?'
+  {263, 9, 14, 11, 0, -14},  // '@'
+  {279, 8, 14, 9, 0, -14},  // 'A'
+  {293, 7, 14, 8, 0, -14},  // 'B'
+  {306, 7, 14, 8, 0, -14},  // 'C'
+  {319, 7, 14, 8, 0, -14},  // 'D'
+  {332, 5, 14, 6, 0, -14},  // 'E'
+  {341, 5, 14, 6, 0, -14},  // 'F'
+  {350, 7, 14, 8, 0, -14},  // 'G'
+  {363, 7, 14, 8, 0, -14},  // 'H'
+  {376, 2, 14, 3, 0, -14},  // 'I'
+  {380, 7, 14, 8, 0, -14},  // 'J'
+  {393, 7, 14, 7, 0, -14},  // 'K'
+  {406, 5, 14, 6, 0, -14},  // 'L'
+  {415, 9, 14, 10, 0, -14},  // 'M'
+  {431, 7, 14, 8, 0, -14},  // 'N'
+  {444, 7, 14, 8, 0, -14},  // 'O'
+  {457, 7, 14, 8, 0, -14},  // 'P'
+  {470, 8, 14, 8, 0, -14},  // 'Q'
+  {484, 8, 14, 8, 0, -14},  // 'R'
+  {498, 7, 14, 8, 0, -14},  // 'S'
+  {511, 6, 14, 7, 0, -14},  // 'T'
+  {522, 7, 14, 8, 0, -14},  // 'U'
+  {535, 6, 14, 7, 0, -14},  // 'V'
+  {546, 12, 14, 11, -1, -14},  // 'W'
+  {567, 7, 14, 8, 0, -14},  // 'X'
+  {580, 8, 14, 9, 0, -14},  // 'Y'
+  {594, 6, 14, 7, 0, -14},  // 'Z'
+  {605, 4, 16, 5, 1, -14},  // '['
+  {613, 6, 14, 8, 1, -14},  // '\\'
+  {624, 4, 16, 6, 1, -14},  // ']'
+  {632, 7, 5, 8, 0, -14},  // '^'
+  {637, 7, 2, 7, 0, 2},  // '_'
+  {639, 4, 2, 7, 2, -12},  // '`'
+  {640, 6, 9, 7, 0, -9},  // 'a'
+  {647, 6, 14, 7, 0, -14},  // 'b'
+  {658, 6, 9, 7, 0, -9},  // 'c'
+  {665, 6, 14, 7, 0, -14},  // 'd'
+  {676, 6, 9, 7, 0, -9},  // 'e'
+  {683, 4, 14, 3, -1, -14},  // 'f'
+  {690, 6, 13, 7, 0, -9},  // 'g'
+  {700, 6, 14, 7, 0, -14},  // 'h'
+  {711, 4, 12, 3, -1, -12},  // 'i'
+  {717, 4, 16, 3, -1, -12},  // 'j'
+  {725, 6, 14, 7, 0, -14},  // 'k'
+  {736, 2, 14, 3, 0, -14},  // 'l'
+  {740, 10, 9, 11, 0, -9},  // 'm'
+  {752, 6, 9, 7, 0, -9},  // 'n'
+  {759, 6, 9, 7, 0, -9},  // 'o'
+  {766, 6, 13, 7, 0, -9},  // 'p'
+  {776, 6, 13, 7, 0, -9},  // 'q'
+  {786, 6, 9, 6, 0, -9},  // 'r'
+  {793, 6, 9, 7, 0, -9},  // 's'
+  {800, 4, 11, 3, -1, -11},  // 't'
+  {806, 6, 9, 7, 0, -9},  // 'u'
+  {813, 6, 9, 7, 0, -9},  // 'v'
+  {820, 10, 9, 11, 0, -9},  // 'w'
+  {832, 7, 9, 8, 0, -9},  // 'x'
+  {840, 6, 13, 7, 0, -9},  // 'y'
+  {850, 5, 9, 6, 0, -9},  // 'z'
+  {856, 6, 18, 7, 0, -14},  // '{'
+  {870, 2, 17, 4, 1, -14},  // '|'
+  {875, 6, 18, 7, 0, -14},  // '}'
+  {889, 7, 3, 9, 1, -7},  // '~'
+};
+
+const GFXfont FreeSans9pt7b = {kFreeSans9pt7bBitmaps, kFreeSans9pt7bGlyphs, 0x20, 0x7E, 23};
+
+const uint8_t kFreeSans12pt7bBitmaps[1121] = {
+  0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0x03, 0x60, 0xCF, 0x3C, 0xF3, 0xCC, 0x06, 0x60, 0x0C, 0xC0, 0x19,
+  0x80, 0x33, 0x03, 0xFF, 0xC7, 0xFF, 0x81, 0x98, 0x03, 0x30, 0x0C, 0xC0, 0x19, 0x80, 0x33, 0x03,
+  0xFF, 0xC7, 0xFF, 0x81, 0x98, 0x03, 0x30, 0x06, 0x60, 0x0C, 0xC0, 0x18, 0x7E, 0xFF, 0xDB, 0xDB,
+  0xDB, 0xD8, 0x78, 0x38, 0x18, 0x1E, 0x1F, 0x1B, 0xDB, 0xDB, 0xDB, 0xFF, 0x7E, 0x18, 0x7C, 0x27,
+  0xF2, 0x31, 0x91, 0x8D, 0x0C, 0x68, 0x63, 0x83, 0x1C, 0x1F, 0xC0, 0x7F, 0xF0, 0x3F, 0xC2, 0xC6,
+  0x16, 0x31, 0x31, 0x89, 0x8C, 0x8C, 0x64, 0x7F, 0x41, 0xF0, 0x7C, 0x7F, 0x31, 0x98, 0xCC, 0x66,
+  0x03, 0x80, 0xFE, 0x7F, 0x73, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x19, 0xFC, 0x7E, 0x00, 0xFF, 0xC0,
+  0x36, 0x66, 0x6C, 0xCC, 0xCC, 0xCC, 0xCC, 0x66, 0x66, 0x30, 0xC6, 0x66, 0x63, 0x33, 0x33, 0x33,
+  0x33, 0x66, 0x66, 0xC0, 0x25, 0x7E, 0xEF, 0xD4, 0x80, 0x18, 0x18, 0x18, 0xFF, 0x18, 0x18, 0x18,
+  0xE8, 0xF0, 0xF0, 0x01, 0x80, 0x80, 0xC0, 0x40, 0x20, 0x30, 0x10, 0x18, 0x08, 0x0C, 0x04, 0x06,
+  0x02, 0x01, 0x01, 0x80, 0x80, 0xC0, 0x00, 0x7D, 0xFF, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F,
+  0x1E, 0x3C, 0x78, 0xF1, 0xFF, 0x7C, 0x6D, 0xFE, 0xDB, 0x6D, 0xB6, 0xDB, 0x60, 0x7D, 0xFF, 0x1E,
+  0x3C, 0x60, 0xC3, 0x06, 0x08, 0x30, 0x41, 0x82, 0x0C, 0x10, 0x7F, 0xFE, 0x7D, 0xFF, 0x1E, 0x3C,
+  0x60, 0xC1, 0x86, 0x18, 0x18, 0x1E, 0x3C, 0x78, 0xF1, 0xFF, 0x7C, 0x0C, 0x0C, 0x18, 0x18, 0x10,
+  0x36, 0x36, 0x26, 0x66, 0x66, 0x46, 0xFF, 0xFF, 0x06, 0x06, 0x06, 0x06, 0xFF, 0xFF, 0x06, 0x0C,
+  0x18, 0x30, 0x7E, 0xFE, 0x0C, 0x18, 0x30, 0x78, 0xF1, 0xFF, 0x7C, 0x7D, 0xFF, 0x1E, 0x3C, 0x18,
+  0x30, 0x7E, 0xFF, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xFF, 0x7C, 0xFF, 0xFF, 0x1E, 0x20, 0xC1, 0x83,
+  0x06, 0x0C, 0x30, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30, 0x7D, 0xFF, 0x1E, 0x3C, 0x78, 0xF1, 0xB6,
+  0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xFF, 0x7C, 0x7D, 0xFF, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xFE,
+  0xFC, 0x18, 0x30, 0x78, 0xF1, 0xFF, 0x7C, 0xF0, 0x03, 0xC0, 0xF0, 0x03, 0xA0, 0x04, 0x33, 0x9C,
+  0xC1, 0xC3, 0x83, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x83, 0x07, 0x0E, 0x0C, 0xE7, 0x30,
+  0x80, 0x7B, 0xFC, 0xF3, 0xCC, 0x30, 0x86, 0x10, 0xC3, 0x0C, 0x30, 0x00, 0x0C, 0x30, 0x7F, 0x40,
+  0x60, 0x30, 0x1B, 0xCD, 0x26, 0x93, 0x09, 0xBC, 0xD2, 0x69, 0x34, 0x9B, 0xF4, 0x02, 0x01, 0x00,
+  0x7F, 0x80, 0x18, 0x18, 0x18, 0x3C, 0x3C, 0x3C, 0x24, 0x24, 0x64, 0x66, 0x66, 0x66, 0x7E, 0x7E,
+  0xC3, 0xC3, 0xC3, 0xFD, 0xFF, 0x1E, 0x3C, 0x78, 0xF3, 0xFE, 0xFD, 0x9F, 0x1E, 0x3C, 0x78, 0xF1,
+  0xFF, 0xFC, 0x7D, 0xFF, 0x1E, 0x3C, 0x78, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x78, 0xF1, 0xFF,
+  0x7C, 0xF9, 0xFB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xFE, 0xF8,
+  0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xFF, 0xF1, 0x8C, 0x63, 0x1F, 0xF8, 0xFF, 0xF1, 0x8C, 0x63, 0x1F,
+  0xFE, 0x31, 0x8C, 0x63, 0x18, 0xC0, 0x7D, 0xFF, 0x1E, 0x3C, 0x78, 0xF0, 0x60, 0xCF, 0x9F, 0x1E,
+  0x3C, 0x78, 0xF1, 0xFF, 0x7C, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xFF, 0xFF, 0x8F, 0x1E, 0x3C,
+  0x78, 0xF1, 0xE3, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0C, 0x18, 0x3C, 0x78, 0xF1, 0xFF, 0x7C, 0xC7, 0x8B, 0x36, 0x6D, 0x9B, 0x34, 0x78, 0xE1,
+  0xE3, 0x46, 0xCD, 0x99, 0x33, 0x62, 0xC6, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63,
+  0x1F, 0xF8, 0xC1, 0xE0, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xAB, 0xD5, 0xEA, 0xF7, 0x7B, 0x3C,
+  0x9E, 0x4F, 0x27, 0x83, 0xC1, 0x80, 0xC7, 0x8F, 0x1F, 0x3E, 0x7C, 0xF1, 0xEB, 0xD7, 0xAF, 0x3E,
+  0x7C, 0xF9, 0xF1, 0xE3, 0xC6, 0x7D, 0xFF, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C,
+  0x78, 0xF1, 0xFF, 0x7C, 0xFD, 0xFF, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xFF, 0xFB, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC0, 0x7C, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xCE,
+  0xCE, 0xC7, 0xFF, 0x7D, 0xFD, 0xFF, 0x1E, 0x3C, 0x78, 0xF1, 0xEF, 0xDD, 0xB3, 0x66, 0x4C, 0xD9,
+  0xB3, 0x63, 0xC6, 0x7D, 0xFF, 0x1E, 0x3C, 0x7C, 0x1C, 0x18, 0x18, 0x38, 0x38, 0x3C, 0x78, 0xF1,
+  0xFF, 0x7C, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1,
+  0xFF, 0x7C, 0xC3, 0xC3, 0xC3, 0x42, 0x66, 0x66, 0x66, 0x66, 0x64, 0x24, 0x24, 0x3C, 0x3C, 0x3C,
+  0x18, 0x18, 0x18, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0x4C, 0x93, 0x24, 0xC9, 0x36, 0x7F, 0x9F, 0xE7,
+  0xF9, 0xCE, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x00, 0xC7, 0x8D, 0xB3, 0x66, 0xC7, 0x0E, 0x1C,
+  0x10, 0x70, 0xE1, 0x46, 0xCD, 0x9B, 0x63, 0xC6, 0xC0, 0xD8, 0x66, 0x19, 0x86, 0x33, 0x0C, 0xC3,
+  0x30, 0x78, 0x1E, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0x7E, 0xFC,
+  0x18, 0x60, 0xC1, 0x86, 0x0C, 0x10, 0x60, 0xC3, 0x06, 0x0C, 0x30, 0x7F, 0xFE, 0xFF, 0xF1, 0x8C,
+  0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x3F, 0xF0, 0xC0, 0x20, 0x18, 0x04, 0x02, 0x01,
+  0x80, 0x40, 0x30, 0x08, 0x06, 0x01, 0x00, 0xC0, 0x20, 0x10, 0x0C, 0x02, 0x01, 0x80, 0xFF, 0xC6,
+  0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xF0, 0x10, 0x70, 0xA3, 0x64, 0x50,
+  0xC0, 0xFF, 0xFF, 0xCC, 0x80, 0x7B, 0xF0, 0xC3, 0x7F, 0xFC, 0xF7, 0xFD, 0xB0, 0xC3, 0x0C, 0x30,
+  0xC3, 0x0C, 0x32, 0xFF, 0xBC, 0xF3, 0xCF, 0x3C, 0xFF, 0xF8, 0x7B, 0xFC, 0xF3, 0xC3, 0x0C, 0xF3,
+  0xFD, 0xE0, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xDF, 0xFF, 0x3C, 0xF3, 0xCF, 0x3C, 0xFF, 0x7C, 0x7B,
+  0xFC, 0xFF, 0xFF, 0x0C, 0xF3, 0xFD, 0xE0, 0x3B, 0xD8, 0xC6, 0x31, 0x9F, 0xFB, 0x18, 0xC6, 0x31,
+  0x8C, 0x60, 0x7F, 0xFC, 0xF3, 0xCF, 0x3C, 0xF3, 0xFD, 0xF0, 0xC3, 0xFD, 0xE0, 0xC3, 0x0C, 0x30,
+  0xC3, 0x0C, 0x37, 0xFF, 0xBC, 0xF3, 0xCF, 0x3C, 0xF3, 0xCC, 0x66, 0x00, 0x06, 0x66, 0x66, 0x66,
+  0x66, 0x60, 0x31, 0x80, 0x00, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x37, 0xB8, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0x33, 0xDB, 0x6F, 0x3C, 0xF3, 0x4D, 0xB6, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0xD9, 0xFF, 0xFE, 0xEF, 0x33, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0xCC, 0xF3, 0x30, 0xCF, 0xFE, 0xF3,
+  0xCF, 0x3C, 0xF3, 0xCF, 0x30, 0x7B, 0xFC, 0xF3, 0xCF, 0x3C, 0xF3, 0xFD, 0xE0, 0xCF, 0xFE, 0xF3,
+  0xCF, 0x3C, 0xF3, 0xFB, 0xCC, 0x30, 0xC3, 0x00, 0x7F, 0xFC, 0xF3, 0xCF, 0x3C, 0xF3, 0xFD, 0xF0,
+  0xC3, 0x0C, 0x30, 0xDB, 0xFE, 0xF3, 0xC3, 0x0C, 0x30, 0xC3, 0x00, 0x7B, 0xFC, 0xFB, 0x70, 0xED,
+  0xF3, 0xFD, 0xE0, 0x63, 0x18, 0xCF, 0xFD, 0x8C, 0x63, 0x18, 0xC7, 0x9C, 0xCF, 0x3C, 0xF3, 0xCF,
+  0x3C, 0xF3, 0xFD, 0xF0, 0xCF, 0x3C, 0x92, 0x79, 0xE7, 0x9C, 0x30, 0xC0, 0xCC, 0xF3, 0x3C, 0xC9,
+  0x32, 0x7F, 0x9F, 0xE7, 0x79, 0xCC, 0x33, 0x0C, 0xC0, 0xCD, 0x27, 0x8C, 0x30, 0xC3, 0x1E, 0x4B,
+  0x30, 0xCF, 0x3C, 0x92, 0x79, 0xE7, 0x9C, 0x30, 0xC3, 0x0C, 0x61, 0x80, 0xFF, 0xF0, 0x86, 0x10,
+  0x86, 0x10, 0xFF, 0xF0, 0x1E, 0x7C, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x61, 0x81, 0x81, 0x83, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xF8, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF1, 0xF0, 0x60, 0xC1,
+  0x83, 0x06, 0x0C, 0x1C, 0x1C, 0x70, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x33, 0xE7, 0x80, 0xC7, 0xAF,
+  0x18,
+};
+
+const GFXglyph kFreeSans12pt7bGlyphs[] = {
+  {0, 0, 0, 6, 0, 0},  // ' '
+  {0, 3, 17, 4, 0, -17},  // '!'
+  {7, 6, 5, 7, 1, -17},  // '"'
+  {11, 15, 17, 11, -2, -17},  // '#'
+  {43, 8, 19, 9, 1, -18},  // '$'
+  {62, 13, 17, 15, 1, -17},  // '%'
+  {90, 9, 17, 10, 1, -17},  // '&'
+  {110, 2, 5, 4, 1, -17},  // "'"
+  {112, 4, 19, 6, 1, -17},  // '('
+  {122, 4, 19, 6, 1, -17},  // ')'
+  {132, 5, 7, 9, 2, -17},  // '*'
+  {137, 8, 7, 9, 1, -11},  // '+'
+  {144, 2, 3, 4, 1, -2},  // ','
+  {145, 4, 1, 6, 1, -7},  // '-'
+  {146, 2, 2, 4, 1, -2},  // '.'
+  {147, 9, 17, 10, 0, -17},  // '/'
+  {167, 7, 17, 9, 1, -17},  // '0'
+  {182, 3, 17, 5, 1, -17},  // '1'
+  {189, 7, 17, 9, 1, -17},  // '2'
+  {204, 7, 17, 9, 1, -17},  // '3'
+  {219, 8, 17, 8, 0, -17},  // '4'
+  {236, 7, 17, 9, 1, -17},  // '5'
+  {251, 7, 17, 9, 1, -17},  // '6'
+  {266, 7, 17, 7, 0, -17},  // '7'
+  {281, 7, 17, 9, 1, -17},  // '8'
+  {296, 7, 17, 9, 1, -17},  // '9'
+  {311, 2, 9, 4, 1, -9},  // ':'
+  {314, 2, 10, 4, 1, -9},  // ';'
+  {317, 6, 9, 8, 1, -12},  // '<'
+  {324, 8, 6, 10, 1, -9},  // '='
+  {330, 6, 9, 8, 1, -12},  // '>'
+  {337, 6, 17, 8, 1, -17},  // '?'
+  {350, 9, 17, 11, 1, -17},  // '@'
+  {370, 8, 17, 8, 0, -17},  // 'A'
+  {387, 7, 17, 9, 1, -17},  // 'B'
+  {402, 7, 17, 9, 1, -17},  // 'C'
+  {417, 7, 17, 9, 1, -17},  // 'D'
+  {432, 5, 17, 7, 1, -17},  // 'E'
+  {443, 5, 17, 6, 1, -17},  // 'F'
+  {454, 7, 17, 9, 1, -17},  // 'G'
+  {469, 7, 17, 9, 1, -17},  // 'H'
+  {484, 2, 17, 4, 1, -17},  // 'I'
+  {489, 7, 17, 8, 0, -17},  // 'J'
+  {504, 7, 17, 8, 1, -17},  // 'K'
+  {519, 5, 17, 6, 1, -17},  // 'L'
+  {530, 9, 17, 11, 1, -17},  // 'M'
+  {550, 7, 17, 9, 1, -17},  // 'N'
+  {565, 7, 17, 9, 1, -17},  // 'O'
+  {580, 7, 17, 9, 1, -17},  // 'P'
+  {595, 8, 17, 9, 1, -17},  // 'Q'
+  {612, 7, 17, 9, 1, -17},  // 'R'
+  {627, 7, 17, 9, 1, -17},  // 'S'
+  {642, 8, 17, 8, 0, -17},  // 'T'
+  {659, 7, 17, 9, 1, -17},  // 'U'
+  {674, 8, 17, 8, 0, -17},  // 'V'
+  {691, 10, 17, 10, 0, -17},  // 'W'
+  {713, 7, 17, 7, 0, -17},  // 'X'
+  {728, 10, 17, 10, 0, -17},  // 'Y'
+  {750, 7, 17, 7, 0, -17},  // 'Z'
+  {765, 5, 20, 6, 1, -17},  // '['
+  {778, 9, 17, 10, 0, -17},  // '\\'
+  {798, 5, 20, 6, 0, -17},  // ']'
+  {811, 7, 6, 9, 1, -17},  // '^'
+  {817, 8, 2, 8, 0, 2},  // '_'
+  {819, 3, 3, 9, 3, -14},  // '`'
+  {821, 6, 10, 8, 1, -10},  // 'a'
+  {829, 6, 17, 8, 1, -17},  // 'b'
+  {842, 6, 10, 8, 1, -10},  // 'c'
+  {850, 6, 17, 8, 1, -17},  // 'd'
+  {863, 6, 10, 8, 1, -10},  // 'e'
+  {871, 5, 17, 4, 0, -17},  // 'f'
+  {882, 6, 14, 8, 1, -10},  // 'g'
+  {893, 6, 17, 8, 1, -17},  // 'h'
+  {906, 4, 15, 4, 0, -15},  // 'i'
+  {914, 5, 19, 4, -1, -15},  // 'j'
+  {926, 6, 17, 7, 1, -17},  // 'k'
+  {939, 2, 17, 4, 1, -17},  // 'l'
+  {944, 10, 10, 12, 1, -10},  // 'm'
+  {957, 6, 10, 8, 1, -10},  // 'n'
+  {965, 6, 10, 8, 1, -10},  // 'o'
+  {973, 6, 14, 8, 1, -10},  // 'p'
+  {984, 6, 14, 8, 1, -10},  // 'q'
+  {995, 6, 10, 7, 1, -10},  // 'r'
+  {1003, 6, 10, 8, 1, -10},  // 's'
+  {1011, 5, 14, 5, 0, -14},  // 't'
+  {1020, 6, 10, 8, 1, -10},  // 'u'
+  {1028, 6, 10, 6, 0, -10},  // 'v'
+  {1036, 10, 10, 10, 0, -10},  // 'w'
+  {1049, 6, 10, 6, 0, -10},  // 'x'
+  {1057, 6, 14, 6, 0, -10},  // 'y'
+  {1068, 6, 10, 8, 1, -10},  // 'z'
+  {1076, 7, 20, 8, 0, -17},  // '{'
+  {1094, 2, 21, 4, 2, -17},  // '|'
+  {1100, 7, 20, 8, 0, -17},  // '}'
+  {1118, 7, 3, 11, 2, -8},  // '~'
+};
+
+const GFXfont FreeSans12pt7b = {kFreeSans12pt7bBitmaps, kFreeSans12pt7bGlyphs, 0x20, 0x7E, 29};
+
+const uint8_t kFreeSansBold12pt7bBitmaps[1281] = {
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x07, 0x70, 0xEF, 0xDF, 0xBF, 0x7E, 0xE0, 0x07, 0x70,
+  0x07, 0x70, 0x07, 0x70, 0x07, 0x70, 0x3F, 0xFE, 0x3F, 0xFE, 0x07, 0x70, 0x07, 0x70, 0x0E, 0xE0,
+  0x0E, 0xE0, 0x0E, 0xE0, 0x7F, 0xFC, 0x7F, 0xFC, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0,
+  0x1C, 0x3F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x3C, 0x0E, 0x07, 0xC3, 0xF1, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xBF, 0x87, 0x00, 0x7E, 0x33, 0xFD, 0x8E, 0x76, 0x39, 0xF0, 0xE7, 0xC3, 0x9E,
+  0x0E, 0x78, 0x3F, 0xC0, 0x7F, 0xF8, 0x1F, 0xF0, 0xF9, 0xC3, 0xE7, 0x1B, 0x9C, 0x6E, 0x73, 0x39,
+  0xCC, 0xFF, 0x61, 0xF8, 0x7E, 0x3F, 0xCE, 0x73, 0x9C, 0xE7, 0x38, 0x0F, 0x01, 0xFE, 0x7F, 0xBD,
+  0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0xFC, 0x7F, 0x00, 0xFF, 0xFE, 0x3B, 0x9C, 0xE7, 0x73,
+  0x9C, 0xE7, 0x39, 0xCE, 0x71, 0xCE, 0x73, 0x8E, 0xE3, 0x9C, 0xE7, 0x1C, 0xE7, 0x39, 0xCE, 0x73,
+  0x9D, 0xCE, 0x73, 0xB8, 0x33, 0xFF, 0xDE, 0xFF, 0xF3, 0x00, 0x1C, 0x0E, 0x07, 0x1F, 0xF1, 0xC0,
+  0xE0, 0x70, 0xFB, 0x00, 0xF8, 0xFC, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38,
+  0x0C, 0x07, 0x01, 0x80, 0xE0, 0x30, 0x0C, 0x07, 0x01, 0x80, 0xE0, 0x00, 0x7E, 0xFF, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0x7E, 0x77, 0x7F, 0xF7,
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x7E, 0xFF, 0xE7, 0xE7, 0xE7, 0x07, 0x0E, 0x0E, 0x0C, 0x1C,
+  0x18, 0x38, 0x30, 0x70, 0x60, 0xFF, 0xFF, 0x7E, 0xFF, 0xE7, 0xE7, 0xE7, 0x07, 0x07, 0x0E, 0x1C,
+  0x0E, 0x07, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0x7E, 0x0E, 0x07, 0x07, 0x03, 0x81, 0x81, 0xF8, 0xFC,
+  0x6E, 0x77, 0x3B, 0x99, 0xDF, 0xFF, 0xF8, 0x38, 0x1C, 0x0E, 0x07, 0x00, 0xFF, 0xFF, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xFE, 0xFF, 0x07, 0x07, 0x07, 0x07, 0xE7, 0xE7, 0xFF, 0x7E, 0x7E, 0xFF, 0xE7,
+  0xE7, 0xE0, 0xE0, 0xE0, 0xFE, 0xFF, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0x7E, 0xFF, 0xFF,
+  0xE7, 0xE6, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x7E,
+  0xFF, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x7E, 0x3C, 0x7E, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0x7E,
+  0x7E, 0xFF, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0x7F, 0x07, 0x07, 0x07, 0xE7, 0xE7, 0xFF,
+  0x7E, 0xFC, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x07, 0xD8, 0x06, 0x1C, 0xF3, 0xCE, 0x0F, 0x0F, 0x07,
+  0x06, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0xC1, 0xC1, 0xE1, 0xE0, 0xE7, 0x9E, 0x70, 0xC0,
+  0x7D, 0xFF, 0xBF, 0x7E, 0xE1, 0xC3, 0x0E, 0x18, 0x70, 0xE1, 0xC3, 0x80, 0x00, 0x1C, 0x38, 0x7F,
+  0xB0, 0x3C, 0x0F, 0x03, 0xFE, 0xFD, 0xBF, 0x6F, 0x1B, 0xFE, 0xFD, 0xBF, 0x6F, 0xDB, 0xFF, 0xB0,
+  0x0C, 0x03, 0x00, 0x7F, 0xC0, 0x1C, 0x0E, 0x07, 0x07, 0xC3, 0xE1, 0xF0, 0xD8, 0x6C, 0x76, 0x3B,
+  0x9D, 0xCE, 0xE7, 0xF3, 0xFB, 0x8F, 0xC7, 0xE3, 0x80, 0xFE, 0xFF, 0xE7, 0xE7, 0xE7, 0xE7, 0xEF,
+  0xFE, 0xFE, 0xEF, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0xFE, 0x7E, 0xFF, 0xE7, 0xE7, 0xE7, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE7, 0xE7, 0xE7, 0xFF, 0x7E, 0xFC, 0xFE, 0xE7, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFE, 0xFC, 0xFF, 0xFE, 0x38, 0xE3,
+  0x8E, 0x38, 0xFF, 0xFE, 0x38, 0xE3, 0x8E, 0x3F, 0xFC, 0xFF, 0xFE, 0x38, 0xE3, 0x8E, 0x3F, 0xFF,
+  0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE0, 0x7E, 0xFF, 0xE7, 0xE7, 0xE7, 0xE7, 0xE0, 0xE0, 0xEF, 0xEF,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0x7E, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0xFF,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xE7, 0xE7, 0xE7, 0xFF, 0x7E,
+  0xE7, 0xE6, 0xEE, 0xEE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xEC, 0xEE, 0xE6,
+  0xE7, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x3F, 0xFC, 0xE1, 0xF8,
+  0x7F, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xED, 0xFB, 0x7E,
+  0xDF, 0x87, 0xE1, 0xC0, 0xE7, 0xE7, 0xE7, 0xF7, 0xF7, 0xF7, 0xE7, 0xFF, 0xFF, 0xFF, 0xEF, 0xEF,
+  0xEF, 0xEF, 0xE7, 0xE7, 0xE7, 0x7E, 0xFF, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0x7E, 0xFE, 0xFF, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0xFE,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x7E, 0x7F, 0xB9, 0xDC, 0xEE, 0x77, 0x3B, 0x9D, 0xCE,
+  0xE7, 0x73, 0xB9, 0xDC, 0xEE, 0xF7, 0x7B, 0x9F, 0xFF, 0x7F, 0x80, 0xFE, 0xFF, 0xE7, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xFF, 0xFE, 0xFC, 0xFC, 0xEC, 0xEE, 0xEE, 0xEE, 0xE7, 0xE7, 0x7E, 0xFF, 0xE7, 0xE7,
+  0xE7, 0xF0, 0x78, 0x38, 0x1C, 0x1E, 0x0F, 0x07, 0xE7, 0xE7, 0xE7, 0xFF, 0x7E, 0xFF, 0xFF, 0xC7,
+  0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
+  0x00, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+  0xFF, 0x7E, 0xE3, 0xF1, 0xF8, 0xEC, 0x67, 0x73, 0xB9, 0xDC, 0xEE, 0x76, 0x1B, 0x0D, 0x87, 0xC3,
+  0xE1, 0xF0, 0x70, 0x38, 0x1C, 0x00, 0xEE, 0xFD, 0xDF, 0xBB, 0xF7, 0x76, 0xEC, 0xDD, 0x9B, 0xB3,
+  0x7E, 0x7F, 0xCF, 0xF9, 0xFF, 0x3D, 0xE3, 0xB8, 0x77, 0x0E, 0xE1, 0xDC, 0x3B, 0x80, 0xE7, 0xE7,
+  0x7E, 0x7E, 0x7E, 0x3C, 0x3C, 0x3C, 0x18, 0x3C, 0x3C, 0x3C, 0x7E, 0x7E, 0x7E, 0xE7, 0xE7, 0xE0,
+  0xEE, 0x39, 0xC7, 0x38, 0xE3, 0xB8, 0x77, 0x0E, 0xE0, 0xF8, 0x1F, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x7F, 0x7F, 0x07, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C, 0x18,
+  0x38, 0x38, 0x70, 0x70, 0x70, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E,
+  0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8F, 0xFF, 0xE0, 0x18, 0x07, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80,
+  0x70, 0x0C, 0x03, 0x80, 0x60, 0x1C, 0x03, 0x00, 0xC0, 0x38, 0x06, 0x01, 0xC0, 0xFF, 0xF1, 0xC7,
+  0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x7F, 0xFF, 0x18, 0x3C, 0x3C, 0x7E,
+  0x66, 0xC7, 0xFF, 0xFF, 0xC0, 0xE7, 0x30, 0x7D, 0xFC, 0x38, 0x77, 0xFF, 0xFB, 0xFF, 0xFE, 0xFC,
+  0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x76, 0xFF, 0xFF, 0xBF, 0x7E, 0xFD, 0xFB, 0xFF, 0xFC, 0x7D,
+  0xFF, 0xBF, 0x7E, 0x1C, 0x3B, 0xF7, 0xFE, 0xF8, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0xBF, 0xFF,
+  0xDF, 0xBF, 0x7E, 0xFD, 0xFB, 0xFF, 0x7E, 0x7D, 0xFF, 0xBF, 0xFF, 0xFC, 0x3B, 0xF7, 0xFE, 0xF8,
+  0x3D, 0xF7, 0x1C, 0x71, 0xC7, 0x3F, 0xFD, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x70, 0x7F, 0xFF, 0xBF,
+  0x7E, 0xFD, 0xFB, 0xF7, 0xFE, 0xFC, 0x38, 0x7F, 0xEF, 0x80, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
+  0x7F, 0xFF, 0xFF, 0xBF, 0x7E, 0xFD, 0xFB, 0xF7, 0xEE, 0x73, 0x80, 0x00, 0x39, 0xCE, 0x73, 0x9C,
+  0xE7, 0x39, 0xC0, 0x38, 0xE0, 0x00, 0x00, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x3B,
+  0xEF, 0x00, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x77, 0xFD, 0xFB, 0xE7, 0xCF, 0x9F, 0x3F, 0x7E,
+  0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0x7E, 0xEF, 0xDD,
+  0xFB, 0xBF, 0x77, 0xEE, 0xFD, 0xDC, 0xEF, 0xFF, 0xFF, 0x7E, 0xFD, 0xFB, 0xF7, 0xEF, 0xDC, 0x7D,
+  0xFF, 0xBF, 0x7E, 0xFD, 0xFB, 0xF7, 0xFE, 0xF8, 0xEF, 0xFF, 0xFF, 0x7E, 0xFD, 0xFB, 0xF7, 0xFD,
+  0xF3, 0x87, 0x0E, 0x1C, 0x00, 0x7F, 0xFF, 0xBF, 0x7E, 0xFD, 0xFB, 0xF7, 0xFE, 0xFC, 0x38, 0x70,
+  0xE1, 0xC0, 0xFD, 0xFF, 0xFF, 0x7E, 0x1C, 0x38, 0x70, 0xE1, 0xC0, 0x7D, 0xFF, 0xBF, 0xF7, 0x87,
+  0xBF, 0xF7, 0xFE, 0xF8, 0x71, 0xC7, 0x1C, 0xFF, 0xF7, 0x1C, 0x71, 0xC7, 0x1C, 0x7C, 0xF0, 0xEF,
+  0xDF, 0xBF, 0x7E, 0xFD, 0xFB, 0xF7, 0xFE, 0xFC, 0xEF, 0xDF, 0xB3, 0x67, 0xCF, 0x9F, 0x3C, 0x38,
+  0x70, 0xEE, 0xFD, 0xDF, 0xBB, 0x37, 0x67, 0xFC, 0xFF, 0x9F, 0xF3, 0xDC, 0x3B, 0x87, 0x70, 0xEE,
+  0xD9, 0xF1, 0xC3, 0x87, 0x0E, 0x3E, 0x6D, 0xDC, 0xEF, 0xDF, 0xB3, 0x67, 0xCF, 0x9F, 0x3C, 0x38,
+  0x70, 0xE1, 0xC7, 0x0E, 0x00, 0xFF, 0xFC, 0x30, 0xE1, 0x86, 0x1C, 0x30, 0xFF, 0xFC, 0x1F, 0x3F,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0xE0, 0x70, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x3F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C,
+  0x1C, 0x1C, 0x1E, 0x0F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xF8, 0xE7, 0xFF,
+  0xE7,
+};
+
+const GFXglyph kFreeSansBold12pt7bGlyphs[] = {
+  {0, 0, 0, 6, 0, 0},  // ' '
+  {0, 4, 17, 5, 0, -17},  // '!'
+  {9, 7, 5, 8, 1, -17},  // '"'
+  {14, 16, 17, 12, -2, -17},  // '#'
+  {48, 9, 19, 10, 1, -18},  // '$'
+  {70, 14, 17, 16, 1, -17},  // '%'
+  {100, 10, 17, 11, 1, -17},  // '&'
+  {122, 3, 5, 5, 1, -17},  // "'"
+  {124, 5, 19, 7, 1, -17},  // '('
+  {136, 5, 19, 7, 1, -17},  // ')'
+  {148, 6, 7, 10, 2, -17},  // '*'
+  {154, 9, 7, 10, 1, -11},  // '+'
+  {162, 3, 3, 5, 1, -2},  // ','
+  {164, 5, 1, 7, 1, -7},  // '-'
+  {165, 3, 2, 5, 1, -2},  // '.'
+  {166, 10, 17, 11, 0, -17},  // '/'
+  {188, 8, 17, 10, 1, -17},  // '0'
+  {205, 4, 17, 6, 1, -17},  // '1'
+  {214, 8, 17, 10, 1, -17},  // '2'
+  {231, 8, 17, 10, 1, -17},  // '3'
+  {248, 9, 17, 9, 0, -17},  // '4'
+  {268, 8, 17, 10, 1, -17},  // '5'
+  {285, 8, 17, 10, 1, -17},  // '6'
+  {302, 8, 17, 8, 0, -17},  // '7'
+  {319, 8, 17, 10, 1, -17},  // '8'
+  {336, 8, 17, 10, 1, -17},  // '9'
+  {353, 3, 9, 5, 1, -9},  // ':'
+  {357, 3, 10, 5, 1, -9},  // ';'
+  {361, 7, 9, 9, 1, -12},  // '<'
+  {369, 9, 6, 11, 1, -9},  // '='
+  {376, 7, 9, 9, 1, -12},  // '>'
+  {384, 7, 17, 9, 1, -17},  // '?'
+  {399, 10, 17, 12, 1, -17},  // '@'
+  {421, 9, 17, 9, 0, -17},  // 'A'
+  {441, 8, 17, 10, 1, -17},  // 'B'
+  {458, 8, 17, 10, 1, -17},  // 'C'
+  {475, 8, 17, 10, 1, -17},  // 'D'
+  {492, 6, 17, 8, 1, -17},  // 'E'
+  {505, 6, 17, 7, 1, -17},  // 'F'
+  {518, 8, 17, 10, 1, -17},  // 'G'
+  {535, 8, 17, 10, 1, -17},  // 'H'
+  {552, 3, 17, 5, 1, -17},  // 'I'
+  {559, 8, 17, 9, 0, -17},  // 'J'
+  {576, 8, 17, 9, 1, -17},  // 'K'
+  {593, 6, 17, 7, 1, -17},  // 'L'
+  {606, 10, 17, 12, 1, -17},  // 'M'
+  {628, 8, 17, 10, 1, -17},  // 'N'
+  {645, 8, 17, 10, 1, -17},  // 'O'
+  {662, 8, 17, 10, 1, -17},  // 'P'
+  {679, 9, 17, 10, 1, -17},  // 'Q'
+  {699, 8, 17, 10, 1, -17},  // 'R'
+  {716, 8, 17, 10, 1, -17},  // 'S'
+  {733, 9, 17, 9, 0, -17},  // 'T'
+  {753, 8, 17, 10, 1, -17},  // 'U'
+  {770, 9, 17, 9, 0, -17},  // 'V'
+  {790, 11, 17, 11, 0, -17},  // 'W'
+  {814, 8, 17, 8, 0, -17},  // 'X'
+  {831, 11, 17, 11, 0, -17},  // 'Y'
+  {855, 8, 17, 8, 0, -17},  // 'Z'
+  {872, 6, 20, 7, 1, -17},  // '['
+  {887, 10, 17, 11, 0, -17},  // '\\'
+  {909, 6, 20, 7, 0, -17},  // ']'
+  {924, 8, 6, 10, 1, -17},  // '^'
+  {930, 9, 2, 9, 0, 2},  // '_'
+  {933, 4, 3, 10, 3, -14},  // '`'
+  {935, 7, 10, 9, 1, -10},  // 'a'
+  {944, 7, 17, 9, 1, -17},  // 'b'
+  {959, 7, 10, 9, 1, -10},  // 'c'
+  {968, 7, 17, 9, 1, -17},  // 'd'
+  {983, 7, 10, 9, 1, -10},  // 'e'
+  {992, 6, 17, 5, 0, -17},  // 'f'
+  {1005, 7, 14, 9, 1, -10},  // 'g'
+  {1018, 7, 17, 9, 1, -17},  // 'h'
+  {1033, 5, 15, 5, 0, -15},  // 'i'
+  {1043, 6, 19, 5, -1, -15},  // 'j'
+  {1058, 7, 17, 8, 1, -17},  // 'k'
+  {1073, 3, 17, 5, 1, -17},  // 'l'
+  {1080, 11, 10, 13, 1, -10},  // 'm'
+  {1094, 7, 10, 9, 1, -10},  // 'n'
+  {1103, 7, 10, 9, 1, -10},  // 'o'
+  {1112, 7, 14, 9, 1, -10},  // 'p'
+  {1125, 7, 14, 9, 1, -10},  // 'q'
+  {1138, 7, 10, 8, 1, -10},  // 'r'
+  {1147, 7, 10, 9, 1, -10},  // 's'
+  {1156, 6, 14, 6, 0, -14},  // 't'
+  {1167, 7, 10, 9, 1, -10},  // 'u'
+  {1176, 7, 10, 7, 0, -10},  // 'v'
+  {1185, 11, 10, 11, 0, -10},  // 'w'
+  {1199, 7, 10, 7, 0, -10},  // 'x'
+  {1208, 7, 14, 7, 0, -10},  // 'y'
+  {1221, 7, 10, 9, 1, -10},  // 'z'
+  {1230, 8, 20, 9, 0, -17},  // '{'
+  {1250, 3, 21, 5, 2, -17},  // '|'
+  {1258, 8, 20, 9, 0, -17},  // '}'
+  {1278, 8, 3, 12, 2, -8},  // '~'
+};
+
+const GFXfont FreeSansBold12pt7b = {kFreeSansBold12pt7bBitmaps, kFreeSansBold12pt7bGlyphs, 0x20, 0x7E, 29};
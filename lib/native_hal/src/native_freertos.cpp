@@ -0,0 +1,210 @@
+#include <Arduino.h>
+#include <pthread.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct NativeTask {
+  std::string name;
+  BaseType_t core = ARDUINO_RUNNING_CORE;
+  std::mutex lock;
+  std::condition_variable notified;
+  uint32_t notifyCount = 0;
+};
+
+struct NativeQueue {
+  std::mutex lock;
+  std::condition_variable changed;
+  std::vector<uint8_t> storage;
+  size_t itemSize = 0;
+  size_t length = 0;
+  size_t head = 0;
+  size_t count = 0;
+};
+
+namespace {
+
+// The thread that runs setup()/loop() is the Arduino loop task.
+thread_local NativeTask *currentTask = nullptr;
+
+NativeTask *selfTask() {
+  if (!currentTask) {
+    currentTask = new NativeTask();
+    currentTask->name = "loopTask";
+  }
+  return currentTask;
+}
+
+// Wait on `cv` until `ready()` or `ticks` (ms) run out.
+template <typename Ready>
+bool waitFor(std::unique_lock<std::mutex> &held, std::condition_variable &cv, TickType_t ticks,
+             Ready ready) {
+  if (ticks == portMAX_DELAY) {
+    cv.wait(held, ready);
+    return true;
+  }
+  return cv.wait_for(held, std::chrono::milliseconds(ticks), ready);
+}
+
+}  // namespace
+
+// ------------------- Tasks -------------------
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *created,
+                                   BaseType_t core) {
+  (void)stackDepth;
+  (void)priority;
+  NativeTask *task = new NativeTask();
+  task->name = name ? name : "";
+  task->core = core;
+  if (created) *created = task;
+  std::thread([task, fn, arg]() {
+    currentTask = task;
+    pthread_setname_np(pthread_self(), task->name.substr(0, 15).c_str());
+    fn(arg);
+  }).detach();
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  // Only a task ending itself is supported (the usual FreeRTOS idiom).
+  if (!task || task == currentTask) pthread_exit(nullptr);
+}
+
+void vTaskDelay(TickType_t ticks) { delay(ticks); }
+
+TickType_t xTaskGetTickCount() { return millis(); }
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return selfTask(); }
+
+const char *pcTaskGetName(TaskHandle_t task) { return (task ? task : selfTask())->name.c_str(); }
+
+BaseType_t xPortGetCoreID() { return selfTask()->core; }
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+  (void)task;
+  return 0;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+  NativeTask *self = selfTask();
+  std::unique_lock<std::mutex> held(self->lock);
+  waitFor(held, self->notified, ticks, [self] { return self->notifyCount > 0; });
+  uint32_t value = self->notifyCount;
+  if (value) self->notifyCount = clearOnExit ? 0 : value - 1;
+  return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  if (!task) return pdFAIL;
+  {
+    std::lock_guard<std::mutex> held(task->lock);
+    task->notifyCount++;
+  }
+  task->notified.notify_all();
+  return pdPASS;
+}
+
+// ------------------- Queues -------------------
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  if (!length) return nullptr;
+  NativeQueue *queue = new NativeQueue();
+  queue->itemSize = itemSize;
+  queue->length = length;
+  queue->storage.resize((size_t)length * itemSize);
+  return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue) { delete queue; }
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks) {
+  if (!queue) return errQUEUE_FULL;
+  std::unique_lock<std::mutex> held(queue->lock);
+  if (!waitFor(held, queue->changed, ticks, [queue] { return queue->count < queue->length; })) {
+    return errQUEUE_FULL;
+  }
+  size_t tail = (queue->head + queue->count) % queue->length;
+  if (queue->itemSize) memcpy(&queue->storage[tail * queue->itemSize], item, queue->itemSize);
+  queue->count++;
+  held.unlock();
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void *item) {
+  if (!queue) return pdFAIL;
+  {
+    std::lock_guard<std::mutex> held(queue->lock);
+    // FreeRTOS only allows this on one-item queues; the newest item wins.
+    queue->head = 0;
+    queue->count = 1;
+    if (queue->itemSize) memcpy(&queue->storage[0], item, queue->itemSize);
+  }
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+namespace {
+
+BaseType_t take(QueueHandle_t queue, void *item, TickType_t ticks, bool remove) {
+  if (!queue) return pdFALSE;
+  std::unique_lock<std::mutex> held(queue->lock);
+  if (!waitFor(held, queue->changed, ticks, [queue] { return queue->count > 0; })) return pdFALSE;
+  if (queue->itemSize && item) {
+    memcpy(item, &queue->storage[queue->head * queue->itemSize], queue->itemSize);
+  }
+  if (remove) {
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+  }
+  held.unlock();
+  if (remove) queue->changed.notify_all();
+  return pdTRUE;
+}
+
+}  // namespace
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks) {
+  return take(queue, item, ticks, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks) {
+  return take(queue, item, ticks, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+  if (!queue) return 0;
+  std::lock_guard<std::mutex> held(queue->lock);
+  return (UBaseType_t)queue->count;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue) {
+  if (!queue) return pdFAIL;
+  {
+    std::lock_guard<std::mutex> held(queue->lock);
+    queue->head = 0;
+    queue->count = 0;
+  }
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+// ------------------- Mutexes -------------------
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  SemaphoreHandle_t sem = xQueueCreate(1, 0);
+  xSemaphoreGive(sem);
+  return sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+  return xQueueReceive(sem, nullptr, ticks);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) { return xQueueSend(sem, nullptr, 0); }
@@ -0,0 +1,58 @@
+#pragma once
+
+// Host-side controls for the native build (pio run -e native). The
+// firmware never includes this; harnesses and native_main.cpp do.
+//
+//   .pio/build/native/program [options]
+//     --serial PATH|pty|-   serial input: a file, FIFO or tty; "pty" opens a
+//                           pseudo-terminal and prints its name (point
+//                           feeder.py at it) and echoes output to it too;
+//                           "-" is stdin (the default); logs always go to
+//                           stdout
+//     --http-port N         where WebServer(80) listens (default 8080)
+//     --fs DIR              LittleFS root (default data)
+//     --nvs FILE            keep Preferences across runs in FILE
+//     --run-ms N            exit after N ms (default: run until killed)
+//     --dump FILE.ppm       write the panel to FILE on exit
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct NativeOptions {
+  const char *serialPath = "-";
+  uint16_t httpPort = 8080;
+  const char *fsRoot = "data";
+  const char *nvsPath = nullptr;
+  uint32_t runMs = 0;
+  const char *dumpPath = nullptr;
+};
+
+// Parsed command line; harnesses may adjust it before setup() runs.
+NativeOptions &nativeOptions();
+bool nativeParseArgs(int argc, char **argv);
+
+// Open the serial input named in the options. Called by main().
+bool nativeSerialOpen();
+
+constexpr int NATIVE_PANEL_WIDTH = 320;
+constexpr int NATIVE_PANEL_HEIGHT = 240;
+
+// The panel as the last pushSprite() left it, RGB565, row major.
+const uint16_t *nativePanel();
+uint32_t nativePanelFrames();
+// Binary PPM (P6) of an RGB565 image; the panel when `pixels` is null.
+bool nativeWritePpm(const char *path, const uint16_t *pixels = nullptr,
+                    int width = NATIVE_PANEL_WIDTH, int height = NATIVE_PANEL_HEIGHT);
+
+// Pixels written since start: `touched` by drawing into sprites (overdraw
+// counts every time), `pushed` by sprite pushes onto the panel. Only the
+// render task draws, so read them from there.
+struct NativePixelCounts {
+  uint64_t touched = 0;
+  uint64_t pushed = 0;
+};
+NativePixelCounts nativePixelCounts();
+
+// Queue a touch state; each M5.update() takes one. A swipe is a press at
+// the start point followed by a release at the end point.
+void nativeTouch(int x, int y, bool pressed);
@@ -0,0 +1,89 @@
+// main() for the native build: parse the options in native_hal.h, then run
+// the firmware's setup() and loop() on this thread (the "loop task").
+// Harnesses with their own main() build with NATIVE_HAL_NO_MAIN.
+
+#include <Arduino.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include <atomic>
+
+#include "native_hal.h"
+
+namespace {
+
+void usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [--serial PATH|pty|-] [--http-port N] [--fs DIR] [--nvs FILE]\n"
+          "          [--run-ms N] [--dump FILE.ppm]\n",
+          argv0);
+}
+
+}  // namespace
+
+NativeOptions &nativeOptions() {
+  static NativeOptions options;
+  return options;
+}
+
+bool nativeParseArgs(int argc, char **argv) {
+  NativeOptions &o = nativeOptions();
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+      usage(argv[0]);
+      return false;
+    }
+    if (!value) {
+      usage(argv[0]);
+      return false;
+    }
+    if (strcmp(arg, "--serial") == 0) {
+      o.serialPath = value;
+    } else if (strcmp(arg, "--http-port") == 0) {
+      o.httpPort = (uint16_t)atoi(value);
+    } else if (strcmp(arg, "--fs") == 0) {
+      o.fsRoot = value;
+    } else if (strcmp(arg, "--nvs") == 0) {
+      o.nvsPath = value;
+    } else if (strcmp(arg, "--run-ms") == 0) {
+      o.runMs = (uint32_t)strtoul(value, nullptr, 10);
+    } else if (strcmp(arg, "--dump") == 0) {
+      o.dumpPath = value;
+    } else {
+      usage(argv[0]);
+      return false;
+    }
+    ++i;
+  }
+  return true;
+}
+
+#ifndef NATIVE_HAL_NO_MAIN
+namespace {
+
+std::atomic<bool> stopRequested{false};
+
+void onSignal(int) { stopRequested = true; }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (!nativeParseArgs(argc, argv)) return 2;
+  signal(SIGPIPE, SIG_IGN);
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  if (!nativeSerialOpen()) return 1;
+
+  const NativeOptions &o = nativeOptions();
+  setup();
+  while (!stopRequested && (!o.runMs || millis() < o.runMs)) loop();
+
+  if (o.dumpPath && !nativeWritePpm(o.dumpPath)) perror(o.dumpPath);
+  fflush(stdout);
+  // The I/O and fetch tasks never return; leave without running static
+  // destructors under them.
+  _exit(0);
+}
+#endif
@@ -0,0 +1,607 @@
+#include <HTTPClient.h>
+#include <StreamString.h>
+#include <WebServer.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "native_hal.h"
+
+WiFiClass WiFi;
+
+struct NativeSocket {
+  int fd = -1;
+  bool eof = false;
+  uint8_t buf[1460];
+  size_t head = 0;
+  size_t len = 0;
+
+  explicit NativeSocket(int s) : fd(s) {}
+  ~NativeSocket() { close(); }
+
+  void close() {
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+    head = len = 0;
+  }
+
+  size_t buffered() const { return len - head; }
+
+  // Non-blocking refill; false when nothing is buffered afterwards.
+  bool fill() {
+    if (buffered()) return true;
+    if (fd < 0 || eof) return false;
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n > 0) {
+      head = 0;
+      len = (size_t)n;
+      return true;
+    }
+    if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) eof = true;
+    return false;
+  }
+
+  bool waitReadable(int timeoutMs) {
+    if (buffered()) return true;
+    if (fd < 0 || eof) return false;
+    pollfd p = {fd, POLLIN, 0};
+    return poll(&p, 1, timeoutMs) > 0;
+  }
+};
+
+namespace {
+
+void setNonBlocking(int fd) { fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK); }
+
+int connectTcp(const char *host, uint16_t port, int32_t timeoutMs) {
+  addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  char service[8];
+  snprintf(service, sizeof(service), "%u", port);
+  addrinfo *found = nullptr;
+  if (getaddrinfo(host, service, &hints, &found) != 0 || !found) return -1;
+
+  int fd = socket(found->ai_family, found->ai_socktype, found->ai_protocol);
+  if (fd >= 0) {
+    setNonBlocking(fd);
+    int rc = ::connect(fd, found->ai_addr, found->ai_addrlen);
+    if (rc != 0 && errno == EINPROGRESS) {
+      pollfd p = {fd, POLLOUT, 0};
+      int err = 0;
+      socklen_t errLen = sizeof(err);
+      if (poll(&p, 1, timeoutMs) == 1 && getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &errLen) == 0 &&
+          err == 0) {
+        rc = 0;
+      }
+    }
+    if (rc != 0) {
+      ::close(fd);
+      fd = -1;
+    }
+  }
+  freeaddrinfo(found);
+  if (fd >= 0) {
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  }
+  return fd;
+}
+
+const char *reasonPhrase(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 206: return "Partial Content";
+    case 301: return "Moved Permanently";
+    case 302: return "Found";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 403: return "Forbidden";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 416: return "Range Not Satisfiable";
+    case 429: return "Too Many Requests";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    default: return "";
+  }
+}
+
+String urlDecode(const String &in) {
+  String out;
+  out.reserve(in.length());
+  for (unsigned i = 0; i < in.length(); ++i) {
+    char c = in[i];
+    if (c == '+') {
+      out += ' ';
+    } else if (c == '%' && i + 2 < in.length() && isxdigit((unsigned char)in[i + 1]) &&
+               isxdigit((unsigned char)in[i + 2])) {
+      char hex[3] = {in[i + 1], in[i + 2], 0};
+      out += (char)strtol(hex, nullptr, 16);
+      i += 2;
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+String readLine(Stream &in) {
+  String line = in.readStringUntil('\n');
+  if (line.length() && line[line.length() - 1] == '\r') line.remove(line.length() - 1);
+  return line;
+}
+
+}  // namespace
+
+// ------------------- IPAddress / WiFiClient -------------------
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+  return String(buf);
+}
+
+WiFiClient::WiFiClient(int fd) {
+  if (fd < 0) return;
+  setNonBlocking(fd);
+  socket_ = std::make_shared<NativeSocket>(fd);
+}
+
+int WiFiClient::connect(const char *host, uint16_t port) { return connect(host, port, 3000); }
+
+int WiFiClient::connect(const char *host, uint16_t port, int32_t timeoutMs) {
+  stop();
+  int fd = connectTcp(host, port, timeoutMs);
+  if (fd < 0) return 0;
+  socket_ = std::make_shared<NativeSocket>(fd);
+  return 1;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) { return connect(ip.toString().c_str(), port); }
+
+uint8_t WiFiClient::connected() {
+  if (!socket_ || socket_->fd < 0) return 0;
+  if (socket_->buffered()) return 1;
+  socket_->fill();
+  return socket_->buffered() || !socket_->eof;
+}
+
+void WiFiClient::stop() {
+  // Closes the connection for every copy, as on the ESP32.
+  if (socket_) socket_->close();
+  socket_.reset();
+}
+
+int WiFiClient::available() {
+  if (!socket_) return 0;
+  socket_->fill();
+  return (int)socket_->buffered();
+}
+
+int WiFiClient::read() {
+  if (!socket_ || !socket_->fill()) return -1;
+  return socket_->buf[socket_->head++];
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size) {
+  if (!socket_ || !socket_->fill()) return -1;
+  size_t n = socket_->buffered() < size ? socket_->buffered() : size;
+  memcpy(buffer, socket_->buf + socket_->head, n);
+  socket_->head += n;
+  return (int)n;
+}
+
+int WiFiClient::peek() {
+  if (!socket_ || !socket_->fill()) return -1;
+  return socket_->buf[socket_->head];
+}
+
+size_t WiFiClient::readBytes(char *buffer, size_t length) {
+  size_t got = 0;
+  uint32_t start = millis();
+  while (got < length && socket_) {
+    int n = read((uint8_t *)buffer + got, length - got);
+    if (n > 0) {
+      got += n;
+      continue;
+    }
+    int32_t left = (int32_t)(timeout_ - (millis() - start));
+    if (left <= 0 || !socket_->waitReadable(left)) break;
+  }
+  return got;
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size) {
+  size_t sent = 0;
+  while (socket_ && socket_->fd >= 0 && sent < size) {
+    ssize_t n = send(socket_->fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+    if (n > 0) {
+      sent += n;
+    } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+      pollfd p = {socket_->fd, POLLOUT, 0};
+      if (poll(&p, 1, 5000) <= 0) break;
+    } else {
+      break;
+    }
+  }
+  return sent;
+}
+
+IPAddress WiFiClient::remoteIP() const {
+  sockaddr_in addr = {};
+  socklen_t len = sizeof(addr);
+  if (!socket_ || getpeername(socket_->fd, (sockaddr *)&addr, &len) != 0) return IPAddress();
+  return IPAddress((uint32_t)addr.sin_addr.s_addr);
+}
+
+uint16_t WiFiClient::remotePort() const {
+  sockaddr_in addr = {};
+  socklen_t len = sizeof(addr);
+  if (!socket_ || getpeername(socket_->fd, (sockaddr *)&addr, &len) != 0) return 0;
+  return ntohs(addr.sin_port);
+}
+
+int WiFiClient::fd() const { return socket_ ? socket_->fd : -1; }
+
+int WiFiClientSecure::connect(const char *host, uint16_t port) { return connect(host, port, 0); }
+
+int WiFiClientSecure::connect(const char *host, uint16_t port, int32_t timeoutMs) {
+  (void)timeoutMs;
+  static bool warned = false;
+  if (!warned) {
+    warned = true;
+    Serial.printf("Native: no TLS, refusing https://%s:%u (use plain http:// URLs)\n", host, port);
+  }
+  return 0;
+}
+
+// ------------------- WebServer -------------------
+
+WebServer::~WebServer() { close(); }
+
+void WebServer::begin() {
+  uint16_t port = port_ == 80 ? nativeOptions().httpPort : (uint16_t)port_;
+  listenFd_ = socket(AF_INET, SOCK_STREAM, 0);
+  int one = 1;
+  setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(port);
+  if (bind(listenFd_, (sockaddr *)&addr, sizeof(addr)) != 0 || listen(listenFd_, 8) != 0) {
+    Serial.printf("HTTP: cannot listen on 127.0.0.1:%u (%s)\n", port, strerror(errno));
+    close();
+    return;
+  }
+  setNonBlocking(listenFd_);
+  Serial.printf("HTTP: listening on http://127.0.0.1:%u/\n", port);
+}
+
+void WebServer::close() {
+  if (listenFd_ >= 0) ::close(listenFd_);
+  listenFd_ = -1;
+}
+
+void WebServer::on(const String &uri, HTTPMethod method, THandlerFunction handler) {
+  routes_.push_back(Route{uri, method, handler});
+}
+
+void WebServer::collectHeaders(const char *const headerKeys[], size_t count) {
+  collected_.clear();
+  for (size_t i = 0; i < count; ++i) collected_.push_back(headerKeys[i]);
+}
+
+String WebServer::header(const String &name) const {
+  for (const auto &h : headers_) {
+    if (h.first.equalsIgnoreCase(name)) return h.second;
+  }
+  return String();
+}
+
+bool WebServer::hasHeader(const String &name) const {
+  for (const auto &h : headers_) {
+    if (h.first.equalsIgnoreCase(name)) return true;
+  }
+  return false;
+}
+
+String WebServer::arg(const String &name) const {
+  for (const auto &a : args_) {
+    if (a.first == name) return a.second;
+  }
+  return String();
+}
+
+bool WebServer::hasArg(const String &name) const {
+  for (const auto &a : args_) {
+    if (a.first == name) return true;
+  }
+  return false;
+}
+
+void WebServer::parseArgs(const String &encoded) {
+  unsigned start = 0;
+  while (start < encoded.length()) {
+    int amp = encoded.indexOf('&', start);
+    unsigned end = amp < 0 ? encoded.length() : (unsigned)amp;
+    String pair = encoded.substring(start, end);
+    if (pair.length()) {
+      int eq = pair.indexOf('=');
+      if (eq < 0) {
+        args_.push_back(std::make_pair(urlDecode(pair), String()));
+      } else {
+        args_.push_back(std::make_pair(urlDecode(pair.substring(0, eq)), urlDecode(pair.substring(eq + 1))));
+      }
+    }
+    start = end + 1;
+  }
+}
+
+bool WebServer::readRequest() {
+  client_.setTimeout(1000);
+  String line = readLine(client_);
+  int sp1 = line.indexOf(' ');
+  int sp2 = sp1 < 0 ? -1 : line.indexOf(' ', sp1 + 1);
+  if (sp1 < 0 || sp2 < 0) return false;
+
+  String method = line.substring(0, sp1);
+  String url = line.substring(sp1 + 1, sp2);
+  method_ = method == "GET"      ? HTTP_GET
+            : method == "HEAD"   ? HTTP_HEAD
+            : method == "POST"   ? HTTP_POST
+            : method == "PUT"    ? HTTP_PUT
+            : method == "PATCH"  ? HTTP_PATCH
+            : method == "DELETE" ? HTTP_DELETE
+            : method == "OPTIONS" ? HTTP_OPTIONS
+                                 : HTTP_ANY;
+  int query = url.indexOf('?');
+  uri_ = query < 0 ? url : url.substring(0, query);
+  if (query >= 0) parseArgs(url.substring(query + 1));
+
+  size_t bodyLength = 0;
+  String contentType;
+  for (;;) {
+    line = readLine(client_);
+    if (!line.length()) break;
+    int colon = line.indexOf(':');
+    if (colon <= 0) continue;
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+    if (name.equalsIgnoreCase("Content-Length")) bodyLength = (size_t)value.toInt();
+    if (name.equalsIgnoreCase("Content-Type")) contentType = value;
+    // Like the ESP32 server, only the headers asked for are kept.
+    for (const String &key : collected_) {
+      if (key.equalsIgnoreCase(name)) headers_.push_back(std::make_pair(key, value));
+    }
+  }
+
+  if (bodyLength) {
+    std::string body(bodyLength, '\0');
+    body.resize(client_.readBytes(&body[0], bodyLength));
+    if (contentType.startsWith("application/x-www-form-urlencoded")) {
+      parseArgs(String(body));
+    } else {
+      args_.push_back(std::make_pair(String("plain"), String(body)));
+    }
+  }
+  return true;
+}
+
+void WebServer::handleClient() {
+  if (listenFd_ < 0) return;
+  int fd = accept(listenFd_, nullptr, nullptr);
+  if (fd < 0) return;
+
+  client_ = WiFiClient(fd);
+  if (readRequest()) {
+    const Route *route = nullptr;
+    for (const Route &r : routes_) {
+      if (r.uri == uri_ && (r.method == HTTP_ANY || r.method == method_)) {
+        route = &r;
+        break;
+      }
+    }
+    if (route) {
+      route->handler();
+    } else if (notFound_) {
+      notFound_();
+    } else {
+      send(404, "text/plain", String("Not found: ") + uri_);
+    }
+  }
+
+  client_.stop();
+  client_ = WiFiClient();
+  args_.clear();
+  headers_.clear();
+  responseHeaders_ = String();
+  contentLength_ = CONTENT_LENGTH_NOT_SET;
+  responded_ = false;
+}
+
+void WebServer::sendHeader(const String &name, const String &value, bool first) {
+  String line = name + ": " + value + "\r\n";
+  responseHeaders_ = first ? line + responseHeaders_ : responseHeaders_ + line;
+}
+
+void WebServer::send(int code, const char *contentType, const String &content) {
+  if (responded_) return;
+  responded_ = true;
+  char status[64];
+  snprintf(status, sizeof(status), "HTTP/1.1 %d %s\r\n", code, reasonPhrase(code));
+  String head(status);
+  if (contentType && *contentType) head += String("Content-Type: ") + contentType + "\r\n";
+  size_t length = contentLength_ == CONTENT_LENGTH_NOT_SET ? content.length() : contentLength_;
+  if (length != CONTENT_LENGTH_UNKNOWN) head += String("Content-Length: ") + (unsigned long)length + "\r\n";
+  head += responseHeaders_;
+  head += "Connection: close\r\n\r\n";
+  client_.write(head.c_str(), head.length());
+  if (method_ != HTTP_HEAD && content.length()) client_.write(content.c_str(), content.length());
+  responseHeaders_ = String();
+}
+
+void WebServer::sendContent(const char *content, size_t size) { client_.write(content, size); }
+
+// ------------------- HTTPClient -------------------
+
+bool HTTPClient::begin(WiFiClient &client, const String &url) {
+  int scheme = url.indexOf("://");
+  bool secure = url.startsWith("https:");
+  String rest = scheme < 0 ? url : url.substring(scheme + 3);
+  int slash = rest.indexOf('/');
+  String hostPort = slash < 0 ? rest : rest.substring(0, slash);
+  path_ = slash < 0 ? String("/") : rest.substring(slash);
+  int colon = hostPort.indexOf(':');
+  host_ = colon < 0 ? hostPort : hostPort.substring(0, colon);
+  port_ = colon < 0 ? (secure ? 443 : 80) : (uint16_t)hostPort.substring(colon + 1).toInt();
+  if (!host_.length()) return false;
+
+  client_ = &client;
+  size_ = -1;
+  chunked_ = false;
+  for (auto &h : headers_) h.second = String();
+  return true;
+}
+
+void HTTPClient::collectHeaders(const char *const headerKeys[], size_t count) {
+  headers_.clear();
+  for (size_t i = 0; i < count; ++i) headers_.push_back(std::make_pair(String(headerKeys[i]), String()));
+}
+
+String HTTPClient::header(const char *name) const {
+  for (const auto &h : headers_) {
+    if (h.first.equalsIgnoreCase(name)) return h.second;
+  }
+  return String();
+}
+
+bool HTTPClient::hasHeader(const char *name) const { return header(name).length() > 0; }
+
+int HTTPClient::GET() {
+  if (!client_) return HTTPC_ERROR_NOT_CONNECTED;
+  if (!client_->connected() && !client_->connect(host_.c_str(), port_, connectTimeoutMs_)) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+
+  String request = String("GET ") + path_ + (http10_ ? " HTTP/1.0\r\n" : " HTTP/1.1\r\n");
+  request += "Host: " + host_;
+  if (port_ != 80 && port_ != 443) request += String(":") + port_;
+  request += "\r\nUser-Agent: ESP32HTTPClient\r\n";
+  request += (reuse_ && !http10_) ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+  request += "Accept-Encoding: identity;q=1,chunked;q=0.1,*;q=0\r\n\r\n";
+  if (client_->write(request.c_str(), request.length()) != request.length()) {
+    return HTTPC_ERROR_SEND_HEADER_FAILED;
+  }
+  return readHeaders();
+}
+
+int HTTPClient::readHeaders() {
+  client_->setTimeout(timeoutMs_);
+  String status = readLine(*client_);
+  if (!status.startsWith("HTTP/")) {
+    return status.length() ? HTTPC_ERROR_NO_HTTP_SERVER : HTTPC_ERROR_READ_TIMEOUT;
+  }
+  int sp = status.indexOf(' ');
+  int code = sp < 0 ? 0 : (int)status.substring(sp + 1).toInt();
+  canReuse_ = reuse_ && !http10_ && !status.startsWith("HTTP/1.0");
+
+  for (;;) {
+    String line = readLine(*client_);
+    if (!line.length()) break;
+    int colon = line.indexOf(':');
+    if (colon <= 0) continue;
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+    if (name.equalsIgnoreCase("Content-Length")) size_ = (int)value.toInt();
+    if (name.equalsIgnoreCase("Transfer-Encoding") && value.equalsIgnoreCase("chunked")) chunked_ = true;
+    if (name.equalsIgnoreCase("Connection") && value.equalsIgnoreCase("close")) canReuse_ = false;
+    for (auto &h : headers_) {
+      if (h.first.equalsIgnoreCase(name)) h.second = value;
+    }
+  }
+  if (chunked_) size_ = -1;
+  return code ? code : HTTPC_ERROR_NO_HTTP_SERVER;
+}
+
+int HTTPClient::writeToStream(Stream *out) {
+  if (!client_ || !out) return HTTPC_ERROR_NO_STREAM;
+  uint8_t buf[512];
+  int total = 0;
+  auto copy = [&](int32_t length) -> bool {
+    // length < 0: until the server closes
+    while (length != 0) {
+      size_t want = length < 0 || length > (int32_t)sizeof(buf) ? sizeof(buf) : (size_t)length;
+      size_t got = client_->readBytes(buf, want);
+      if (got == 0) return length < 0;
+      if (out->write(buf, got) != got) return false;
+      total += got;
+      if (length > 0) length -= got;
+    }
+    return true;
+  };
+
+  if (!chunked_) {
+    if (!copy(size_)) return HTTPC_ERROR_CONNECTION_LOST;
+    return total;
+  }
+  for (;;) {
+    String line = readLine(*client_);
+    if (!line.length()) return HTTPC_ERROR_READ_TIMEOUT;
+    int32_t chunk = (int32_t)strtol(line.c_str(), nullptr, 16);
+    if (chunk == 0) break;
+    if (!copy(chunk)) return HTTPC_ERROR_CONNECTION_LOST;
+    readLine(*client_);  // CRLF after the chunk
+  }
+  while (readLine(*client_).length()) {
+    // trailers
+  }
+  return total;
+}
+
+String HTTPClient::getString() {
+  StreamString out;
+  writeToStream(&out);
+  return out;
+}
+
+void HTTPClient::end() {
+  if (!client_) return;
+  if (reuse_ && canReuse_ && client_->connected()) {
+    // Drop whatever the caller left unread so the next response starts clean.
+    uint8_t scratch[256];
+    while (client_->available() > 0 && client_->read(scratch, sizeof(scratch)) > 0) {
+    }
+  } else {
+    client_->stop();
+  }
+}
+
+String HTTPClient::errorToString(int error) {
+  switch (error) {
+    case HTTPC_ERROR_CONNECTION_REFUSED: return "connection refused";
+    case HTTPC_ERROR_SEND_HEADER_FAILED: return "send header failed";
+    case HTTPC_ERROR_SEND_PAYLOAD_FAILED: return "send payload failed";
+    case HTTPC_ERROR_NOT_CONNECTED: return "not connected";
+    case HTTPC_ERROR_CONNECTION_LOST: return "connection lost";
+    case HTTPC_ERROR_NO_STREAM: return "no stream";
+    case HTTPC_ERROR_NO_HTTP_SERVER: return "no HTTP server";
+    case HTTPC_ERROR_TOO_LESS_RAM: return "too less ram";
+    case HTTPC_ERROR_ENCODING: return "Transfer-Encoding not supported";
+    case HTTPC_ERROR_STREAM_WRITE: return "Stream write error";
+    case HTTPC_ERROR_READ_TIMEOUT: return "read Timeout";
+    default: return String();
+  }
+}
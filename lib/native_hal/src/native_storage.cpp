@@ -0,0 +1,254 @@
+#include <FS.h>
+#include <LittleFS.h>
+#include <Preferences.h>
+
+#include <sys/stat.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "native_hal.h"
+
+LittleFSFS LittleFS;
+
+// ------------------- Files -------------------
+
+struct NativeFile {
+  FILE *fp = nullptr;
+  bool directory = false;
+  String path;  // as the firmware named it
+  String name;
+  struct stat info = {};
+
+  ~NativeFile() {
+    if (fp) fclose(fp);
+  }
+};
+
+File::operator bool() const { return file_ != nullptr; }
+
+size_t File::size() const {
+  if (!file_ || !file_->fp) return 0;
+  struct stat info;
+  return fstat(fileno(file_->fp), &info) == 0 ? (size_t)info.st_size : 0;
+}
+
+size_t File::position() const { return file_ && file_->fp ? (size_t)ftell(file_->fp) : 0; }
+
+bool File::seek(size_t pos) { return file_ && file_->fp && fseek(file_->fp, (long)pos, SEEK_SET) == 0; }
+
+time_t File::getLastWrite() const { return file_ ? file_->info.st_mtime : 0; }
+
+bool File::isDirectory() const { return file_ && file_->directory; }
+
+const char *File::name() const { return file_ ? file_->name.c_str() : ""; }
+
+const char *File::path() const { return file_ ? file_->path.c_str() : ""; }
+
+int File::available() {
+  if (!file_ || !file_->fp) return 0;
+  size_t total = size(), pos = position();
+  return pos < total ? (int)(total - pos) : 0;
+}
+
+int File::read() {
+  if (!file_ || !file_->fp) return -1;
+  int c = fgetc(file_->fp);
+  return c == EOF ? -1 : c;
+}
+
+size_t File::read(uint8_t *buffer, size_t size) {
+  if (!file_ || !file_->fp) return 0;
+  return fread(buffer, 1, size, file_->fp);
+}
+
+int File::peek() {
+  if (!file_ || !file_->fp) return -1;
+  int c = fgetc(file_->fp);
+  if (c == EOF) return -1;
+  ungetc(c, file_->fp);
+  return c;
+}
+
+size_t File::write(const uint8_t *buffer, size_t size) {
+  if (!file_ || !file_->fp) return 0;
+  return fwrite(buffer, 1, size, file_->fp);
+}
+
+void File::flush() {
+  if (file_ && file_->fp) fflush(file_->fp);
+}
+
+String fs::FS::hostPath(const char *path) const {
+  String host(nativeOptions().fsRoot);
+  if (path[0] != '/') host += '/';
+  host += path;
+  return host;
+}
+
+bool fs::FS::exists(const char *path) const {
+  struct stat info;
+  return stat(hostPath(path).c_str(), &info) == 0;
+}
+
+File fs::FS::open(const char *path, const char *mode, bool create) {
+  (void)create;
+  String host = hostPath(path);
+  std::shared_ptr<NativeFile> file = std::make_shared<NativeFile>();
+  bool reading = mode[0] == 'r';
+  if (stat(host.c_str(), &file->info) != 0 && reading) return File();
+  file->path = path;
+  const char *slash = strrchr(path, '/');
+  file->name = slash ? slash + 1 : path;
+  file->directory = S_ISDIR(file->info.st_mode);
+  if (!file->directory) {
+    file->fp = fopen(host.c_str(), reading ? "rb" : mode[0] == 'a' ? "ab" : "wb");
+    if (!file->fp) return File();
+  }
+  return File(file);
+}
+
+bool fs::FS::remove(const char *path) { return ::remove(hostPath(path).c_str()) == 0; }
+
+bool fs::FS::mkdir(const char *path) { return ::mkdir(hostPath(path).c_str(), 0755) == 0; }
+
+bool LittleFSFS::begin(bool formatOnFail, const char *basePath, uint8_t maxOpenFiles,
+                       const char *partitionLabel) {
+  (void)formatOnFail;
+  (void)basePath;
+  (void)maxOpenFiles;
+  (void)partitionLabel;
+  struct stat info;
+  return stat(nativeOptions().fsRoot, &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+// ------------------- Preferences -------------------
+// --nvs file: repeated { u8 namespace length, namespace, u8 key length,
+// key, u32 value length, value }.
+
+namespace {
+
+constexpr size_t kNvsKeyMax = 15;  // NVS rejects longer keys
+
+typedef std::map<std::string, std::vector<uint8_t>> Namespace;
+
+std::mutex nvsLock;
+std::map<std::string, Namespace> nvs;
+bool nvsLoaded = false;
+
+void loadNvs() {
+  nvsLoaded = true;
+  const char *path = nativeOptions().nvsPath;
+  FILE *f = path ? fopen(path, "rb") : nullptr;
+  if (!f) return;
+  for (;;) {
+    uint8_t nsLen, keyLen;
+    uint32_t valueLen;
+    char ns[256], key[256];
+    if (fread(&nsLen, 1, 1, f) != 1 || fread(ns, 1, nsLen, f) != nsLen) break;
+    if (fread(&keyLen, 1, 1, f) != 1 || fread(key, 1, keyLen, f) != keyLen) break;
+    if (fread(&valueLen, 4, 1, f) != 1) break;
+    std::vector<uint8_t> value(valueLen);
+    if (valueLen && fread(value.data(), 1, valueLen, f) != valueLen) break;
+    nvs[std::string(ns, nsLen)][std::string(key, keyLen)] = value;
+  }
+  fclose(f);
+}
+
+void saveNvs() {
+  const char *path = nativeOptions().nvsPath;
+  if (!path) return;
+  std::string tmp = std::string(path) + ".tmp";
+  FILE *f = fopen(tmp.c_str(), "wb");
+  if (!f) return;
+  for (const auto &ns : nvs) {
+    for (const auto &entry : ns.second) {
+      uint8_t nsLen = (uint8_t)ns.first.size(), keyLen = (uint8_t)entry.first.size();
+      uint32_t valueLen = (uint32_t)entry.second.size();
+      fwrite(&nsLen, 1, 1, f);
+      fwrite(ns.first.data(), 1, nsLen, f);
+      fwrite(&keyLen, 1, 1, f);
+      fwrite(entry.first.data(), 1, keyLen, f);
+      fwrite(&valueLen, 4, 1, f);
+      fwrite(entry.second.data(), 1, valueLen, f);
+    }
+  }
+  if (fclose(f) == 0) rename(tmp.c_str(), path);
+}
+
+}  // namespace
+
+bool Preferences::begin(const char *name, bool readOnly, const char *partitionLabel) {
+  (void)partitionLabel;
+  if (!name || strlen(name) > kNvsKeyMax) return false;
+  std::lock_guard<std::mutex> held(nvsLock);
+  if (!nvsLoaded) loadNvs();
+  ns_ = name;
+  readOnly_ = readOnly;
+  return true;
+}
+
+bool Preferences::clear() {
+  if (!ns_.length() || readOnly_) return false;
+  std::lock_guard<std::mutex> held(nvsLock);
+  nvs[ns_.c_str()].clear();
+  saveNvs();
+  return true;
+}
+
+bool Preferences::remove(const char *key) {
+  if (!ns_.length() || readOnly_ || !key) return false;
+  std::lock_guard<std::mutex> held(nvsLock);
+  bool removed = nvs[ns_.c_str()].erase(key) > 0;
+  if (removed) saveNvs();
+  return removed;
+}
+
+bool Preferences::isKey(const char *key) const {
+  if (!ns_.length() || !key) return false;
+  std::lock_guard<std::mutex> held(nvsLock);
+  const Namespace &ns = nvs[ns_.c_str()];
+  return ns.find(key) != ns.end();
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  if (!ns_.length() || readOnly_ || !key || strlen(key) > kNvsKeyMax) return 0;
+  std::lock_guard<std::mutex> held(nvsLock);
+  const uint8_t *bytes = static_cast<const uint8_t *>(value);
+  nvs[ns_.c_str()][key].assign(bytes, bytes + len);
+  saveNvs();
+  return len;
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) const {
+  if (!ns_.length() || !key) return 0;
+  std::lock_guard<std::mutex> held(nvsLock);
+  const Namespace &ns = nvs[ns_.c_str()];
+  auto it = ns.find(key);
+  if (it == ns.end() || it->second.size() > maxLen) return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char *key) const {
+  if (!ns_.length() || !key) return 0;
+  std::lock_guard<std::mutex> held(nvsLock);
+  const Namespace &ns = nvs[ns_.c_str()];
+  auto it = ns.find(key);
+  return it == ns.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::putString(const char *key, const char *value) {
+  size_t len = value ? strlen(value) : 0;
+  return putBytes(key, value, len + 1) ? len : 0;
+}
+
+String Preferences::getString(const char *key, const String &defaultValue) const {
+  size_t len = getBytesLength(key);
+  if (!len) return defaultValue;
+  std::vector<char> buf(len);
+  if (getBytes(key, buf.data(), len) != len) return defaultValue;
+  return String(buf.data(), len - 1);
+}
@@ -0,0 +1,75 @@
+#include <Arduino.h>
+#include <ESP32Time.h>
+#include <esp_sntp.h>
+#include <sys/time.h>
+
+namespace {
+
+sntp_sync_time_cb_t syncCallback = nullptr;
+
+void reportSync() {
+  if (!syncCallback) return;
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  syncCallback(&now);
+}
+
+}  // namespace
+
+void sntp_set_sync_mode(sntp_sync_mode_t mode) { (void)mode; }
+void sntp_set_sync_interval(uint32_t intervalMs) { (void)intervalMs; }
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) { syncCallback = callback; }
+
+bool sntp_restart() {
+  reportSync();
+  return true;
+}
+
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char *server1, const char *server2,
+                const char *server3) {
+  (void)gmtOffsetSec;
+  (void)daylightOffsetSec;
+  (void)server1;
+  (void)server2;
+  (void)server3;
+  reportSync();
+}
+
+bool getLocalTime(struct tm *info, uint32_t ms) {
+  (void)ms;
+  time_t now = time(nullptr);
+  return localtime_r(&now, info) != nullptr;
+}
+
+// ------------------- ESP32Time -------------------
+
+std::atomic<int64_t> ESP32Time::correctionUs_{0};
+
+namespace {
+
+int64_t hostUs() {
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  return (int64_t)now.tv_sec * 1000000 + now.tv_usec;
+}
+
+}  // namespace
+
+void ESP32Time::setTime(unsigned long epoch, int ms) {
+  correctionUs_ = ((int64_t)epoch * 1000000 + (int64_t)ms * 1000) - hostUs();
+}
+
+unsigned long ESP32Time::getEpoch() const {
+  return (unsigned long)((hostUs() + correctionUs_) / 1000000);
+}
+
+unsigned long ESP32Time::getMillis() const {
+  return (unsigned long)(((hostUs() + correctionUs_) / 1000) % 1000);
+}
+
+tm ESP32Time::getTimeStruct() const {
+  time_t t = (time_t)getLocalEpoch();
+  tm out;
+  gmtime_r(&t, &out);
+  return out;
+}
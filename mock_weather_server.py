@@ -0,0 +1,267 @@
+"""Offline stand-in for the OpenWeather current/forecast API.
+
+Serves /data/2.5/weather and /data/2.5/forecast from recorded payloads
+(or synthetic ones when nothing has been recorded) so the firmware's
+WeatherAPI can be exercised without an API key or internet access.
+
+    # record real responses once (needs a key + network)
+    python mock_weather_server.py record --key KEY --city Toronto
+
+    # serve them on the LAN
+    python mock_weather_server.py serve --port 8080
+
+    # point the device at it (runtime setting, kept in NVS; needs
+    # CONFIG_TOKEN from secrets.h, and a key for the new host - any value)
+    curl -X POST http://<device>/weather/config -H "X-Config-Token: <token>" \
+         -d currentUrl=http://<pc>:8080/data/2.5/weather \
+         -d forecastUrl=http://<pc>:8080/data/2.5/forecast -d apiKey=mock
+
+    # run every scenario against the device and report fetch time,
+    # peak JSON heap and whether the parsed values match the payload
+    python mock_weather_server.py bench --device <device-ip> --port 8080 --token <token>
+
+Scenarios (switch with GET /_scenario?name=... or --scenario):
+    ok         recorded payloads, Content-Length, keep-alive
+    chunked    same bodies with Transfer-Encoding: chunked
+    slow       body trickled out over ~3 s
+    truncated  Content-Length promises more than is sent, then close
+    429        Too Many Requests with Retry-After: 60
+    malformed  200 with a body that is not JSON
+    error500   Internal Server Error
+"""
+
+import argparse
+import json
+import os
+import threading
+import time
+import urllib.parse
+import urllib.request
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+FIXTURE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "mock_weather")
+SCENARIOS = ["ok", "chunked", "slow", "truncated", "429", "malformed", "error500"]
+API_BASE = "https://api.openweathermap.org/data/2.5"
+
+
+# ------- Payloads -------
+def synthetic_weather(now):
+    return {
+        "coord": {"lon": -79.42, "lat": 43.7},
+        "weather": [{"id": 803, "main": "Clouds", "description": "broken clouds", "icon": "04d"}],
+        "main": {"temp": 68.5, "feels_like": 67.9, "temp_min": 64.2, "temp_max": 71.1,
+                 "pressure": 1015, "humidity": 58},
+        "wind": {"speed": 9.2, "deg": 240},
+        "dt": now,
+        "timezone": -14400,
+        "name": "Mockville",
+        "cod": 200,
+    }
+
+
+def synthetic_forecast(now):
+    start = now - now % 10800 + 10800
+    entries = []
+    for i in range(40):
+        ts = start + i * 10800
+        temp = 60 + 10 * ((i % 8) / 4.0 - 1) ** 2
+        entries.append({
+            "dt": ts,
+            "main": {"temp": round(temp, 2), "feels_like": round(temp - 1, 2),
+                     "temp_min": round(temp - 1.5, 2), "temp_max": round(temp + 1.5, 2),
+                     "pressure": 1012, "humidity": 60 + i % 20},
+            "weather": [{"id": 500, "main": "Rain", "description": "light rain",
+                         "icon": "10d" if i % 8 < 4 else "10n"}],
+            "clouds": {"all": 75},
+            "wind": {"speed": 5.0 + i % 5, "deg": 200},
+            "pop": round((i % 10) / 10.0, 1),
+            "dt_txt": time.strftime("%Y-%m-%d %H:%M:%S", time.gmtime(ts)),
+        })
+    return {"cod": "200", "message": 0, "cnt": len(entries), "list": entries,
+            "city": {"name": "Mockville", "timezone": -14400}}
+
+
+def load_payload(kind):
+    path = os.path.join(FIXTURE_DIR, kind + ".json")
+    if os.path.exists(path):
+        with open(path, "rb") as f:
+            return f.read()
+    now = int(time.time())
+    body = synthetic_weather(now) if kind == "weather" else synthetic_forecast(now)
+    return json.dumps(body).encode()
+
+
+# ------- Server -------
+class MockState:
+    def __init__(self, scenario):
+        self.lock = threading.Lock()
+        self.scenario = scenario
+        self.requests = 0
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    state = None
+
+    def log_message(self, fmt, *args):
+        print("[mock] %s %s" % (self.address_string(), fmt % args))
+
+    def do_GET(self):
+        url = urllib.parse.urlparse(self.path)
+        if url.path == "/_scenario":
+            name = urllib.parse.parse_qs(url.query).get("name", [""])[0]
+            if name in SCENARIOS:
+                with self.state.lock:
+                    self.state.scenario = name
+            self.send_body(200, json.dumps({"scenario": self.state.scenario}).encode())
+            return
+
+        kind = url.path.rstrip("/").rsplit("/", 1)[-1]
+        if kind not in ("weather", "forecast"):
+            self.send_body(404, b'{"cod":"404","message":"not found"}')
+            return
+
+        with self.state.lock:
+            scenario = self.state.scenario
+            self.state.requests += 1
+        body = load_payload(kind)
+
+        if scenario == "429":
+            self.send_body(429, b'{"cod":429,"message":"rate limited"}', {"Retry-After": "60"})
+        elif scenario == "error500":
+            self.send_body(500, b'{"cod":500}')
+        elif scenario == "malformed":
+            self.send_body(200, body[: len(body) // 3] + b"<html>oops</html>")
+        elif scenario == "truncated":
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body[: len(body) // 2])
+            self.wfile.flush()
+            self.close_connection = True
+        elif scenario == "chunked":
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Transfer-Encoding", "chunked")
+            self.end_headers()
+            for i in range(0, len(body), 1000):
+                part = body[i:i + 1000]
+                self.wfile.write(b"%x\r\n%s\r\n" % (len(part), part))
+            self.wfile.write(b"0\r\n\r\n")
+        elif scenario == "slow":
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            step = max(1, len(body) // 30)
+            for i in range(0, len(body), step):
+                self.wfile.write(body[i:i + step])
+                self.wfile.flush()
+                time.sleep(0.1)
+        else:
+            self.send_body(200, body)
+
+    def send_body(self, code, body, headers=None):
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        for key, value in (headers or {}).items():
+            self.send_header(key, value)
+        self.end_headers()
+        self.wfile.write(body)
+
+
+def serve(args):
+    Handler.state = MockState(args.scenario)
+    server = ThreadingHTTPServer(("0.0.0.0", args.port), Handler)
+    source = "recorded" if os.path.isdir(FIXTURE_DIR) else "synthetic"
+    print("[mock] serving %s payloads on :%d, scenario=%s" % (source, args.port, args.scenario))
+    return server
+
+
+# ------- Record -------
+def record(args):
+    os.makedirs(FIXTURE_DIR, exist_ok=True)
+    query = urllib.parse.urlencode({"q": args.city, "appid": args.key, "units": args.units})
+    for kind in ("weather", "forecast"):
+        with urllib.request.urlopen("%s/%s?%s" % (API_BASE, kind, query), timeout=15) as resp:
+            body = resp.read()
+        with open(os.path.join(FIXTURE_DIR, kind + ".json"), "wb") as f:
+            f.write(body)
+        print("recorded %s: %d bytes" % (kind, len(body)))
+
+
+# ------- Bench -------
+def get_json(url, data=None, headers=None):
+    req = urllib.request.Request(url, data=data, headers=headers or {})
+    with urllib.request.urlopen(req, timeout=10) as resp:
+        return json.loads(resp.read())
+
+
+def bench(args):
+    server = serve(args)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    device = "http://%s" % args.device
+    expected = json.loads(load_payload("weather"))
+
+    print("%-10s %5s %8s %8s %6s %8s  %s" % ("scenario", "ok", "fetchMs", "jsonPk", "hs", "status", "values"))
+    for scenario in SCENARIOS:
+        Handler.state.scenario = scenario
+        before = get_json(device + "/metrics")["telemetry"]["weather"]["fetches"]
+        # Re-posting the current settings triggers an immediate refetch.
+        get_json(device + "/weather/config", data=b"", headers={"X-Config-Token": args.token})
+        deadline = time.time() + args.timeout
+        metrics = None
+        while time.time() < deadline:
+            time.sleep(0.5)
+            metrics = get_json(device + "/metrics")
+            if metrics["telemetry"]["weather"]["fetches"] > before:
+                break
+        else:
+            print("%-10s timed out" % scenario)
+            continue
+
+        wt = metrics["telemetry"]["weather"]
+        weather = metrics["weather"]
+        match = "-"
+        if scenario in ("ok", "chunked", "slow"):
+            temp = weather.get("temperature")
+            match = "match" if temp is not None and abs(temp - expected["main"]["temp"]) < 0.01 else "MISMATCH"
+        print("%-10s %5s %8d %8d %6d %8d  %s" % (
+            scenario, weather["ok"], wt["lastFetchMs"], wt.get("forecastPeakJsonBytes", 0),
+            wt.get("lastHandshakeMs", 0), wt.get("lastHttpStatus", 0), match))
+    server.shutdown()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Mock OpenWeather server for WeatherAPI testing")
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("serve", help="serve recorded/synthetic payloads")
+    p.add_argument("--port", type=int, default=8080)
+    p.add_argument("--scenario", choices=SCENARIOS, default="ok")
+
+    p = sub.add_parser("record", help="record real API responses into mock_weather/")
+    p.add_argument("--key", required=True)
+    p.add_argument("--city", required=True)
+    p.add_argument("--units", default="imperial")
+
+    p = sub.add_parser("bench", help="run all scenarios against a device")
+    p.add_argument("--device", required=True, help="device IP or host")
+    p.add_argument("--port", type=int, default=8080)
+    p.add_argument("--scenario", choices=SCENARIOS, default="ok")
+    p.add_argument("--timeout", type=float, default=40.0)
+    p.add_argument("--token", default="", help="the device's CONFIG_TOKEN")
+
+    args = parser.parse_args()
+    if args.cmd == "serve":
+        serve(args).serve_forever()
+    elif args.cmd == "record":
+        record(args)
+    else:
+        bench(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,455 @@
+"""Pack the firmware's icons and smooth fonts into one compressed bundle.
+
+Sources live in assets/:
+    assets/icons/*.png   24x24 RGBA weather icons, named by OpenWeather
+                         code ("10d.png"); alpha < 128 becomes black
+    assets/fonts/*.vlw   smooth (anti-aliased) fonts in Processing VLW format;
+                         only those in FONTS (the ones the firmware draws)
+                         are bundled unless --fonts says otherwise
+
+and are written to generated headers:
+    include/asset_ids.h          enum AssetId, one entry per asset
+    include/asset_bundle_data.h  ASSET_BUNDLE[], the bundle itself
+    lib/native_hal/src/native_fonts.h
+                                 1-bit stand-ins for the Adafruit GFX fonts
+                                 the firmware draws with, for the native
+                                 build (which has no LovyanGFX font data)
+
+    python pack_assets.py            # regenerate the headers
+    python pack_assets.py --check    # fail if the headers are out of date
+    python pack_assets.py --fonts all              # bundle every font
+    python pack_assets.py --fonts tinyFont,font18  # or a chosen set
+
+Bundle layout (little endian, payloads 4-byte aligned):
+    "ASB1"  magic
+    u16     asset count, u16 reserved
+    count x { u8 kind, u8 codec, u16 width, u16 height, u16 reserved,
+              u32 decoded size, u32 offset, u32 stored size }
+    payloads
+
+Codecs:
+    1  QOI-style RGB565 (images)
+         00iiiiii            pixel from the 64-entry colour index
+         01rrrrrr            previous pixel repeated r+1 times
+         10000000 lo hi      literal pixel, also stored in the index
+       index slot = (r*3 + g*5 + b*7) & 63 over the 5/6/5-bit fields
+    2  glyph table + per-glyph alpha RLE (fonts)
+         u16 glyph count, u16 size, u16 ascent, u16 descent
+         count x { u16 code, u8 width, u8 height, u8 advance, i8 dY, i8 dX,
+                   u8 flags, u32 offset into the bitmap data }
+         bitmaps, each encoded on its own so a glyph decodes alone:
+           00nnnnnn          n+1 x 0x00
+           01nnnnnn          n+1 x 0xFF
+           1nnnnnnn ...      n+1 literal bytes
+         or, with flags bit 0 set, stored raw: glyphs that are mostly grey
+         edge pixels (small fonts) come out larger encoded.
+       Glyphs are sorted by code. The VLW header fields and names not used
+       for drawing are dropped.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+ICON_DIR = os.path.join(ROOT, "assets", "icons")
+FONT_DIR = os.path.join(ROOT, "assets", "fonts")
+IDS_HEADER = os.path.join(ROOT, "include", "asset_ids.h")
+DATA_HEADER = os.path.join(ROOT, "include", "asset_bundle_data.h")
+NATIVE_FONTS_HEADER = os.path.join(ROOT, "lib", "native_hal", "src", "native_fonts.h")
+
+KIND_IMAGE, KIND_FONT = 0, 1
+CODEC_QOI565, CODEC_GLYPHS = 1, 2
+GLYPH_RAW = 0x01
+FONT_HEADER_BYTES, GLYPH_BYTES = 8, 12
+ICON_SIZE = 24
+
+# Fonts drawn through SmoothText (ASSET_FONT_MIDLE in main.cpp,
+# ASSET_FONT_TINY in weather_display.cpp). Add a font here when code starts
+# drawing it; the rest of assets/fonts stays out of flash.
+FONTS = ["midleFont.vlw", "tinyFont.vlw"]
+
+# GFX font name -> (VLW source, embolden). Sizes picked to match the
+# originals' line height; only printable ASCII, like the 7b fonts.
+NATIVE_FONTS = [
+    ("FreeSans9pt7b", "font18.vlw", False),
+    ("FreeSans12pt7b", "smallFont.vlw", False),
+    ("FreeSansBold12pt7b", "smallFont.vlw", True),
+]
+
+
+# ------------------- Sources -------------------
+
+def read_png_rgba(path):
+    """Decode an 8-bit RGBA, non-interlaced PNG (all our icons are)."""
+    blob = open(path, "rb").read()
+    if blob[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: not a PNG" % path)
+    pos, idat, header = 8, b"", None
+    while pos < len(blob):
+        length, tag = struct.unpack(">I4s", blob[pos:pos + 8])
+        chunk = blob[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if tag == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif tag == b"IDAT":
+            idat += chunk
+    width, height, depth, colour, _, _, interlace = header
+    if depth != 8 or colour != 6 or interlace:
+        sys.exit("%s: expected 8-bit RGBA, non-interlaced" % path)
+
+    raw = zlib.decompress(idat)
+    stride = width * 4
+    rows, prev, i = [], bytearray(stride), 0
+    for _ in range(height):
+        kind = raw[i]
+        line = bytearray(raw[i + 1:i + 1 + stride])
+        i += 1 + stride
+        for x in range(stride):
+            left = line[x - 4] if x >= 4 else 0
+            up = prev[x]
+            corner = prev[x - 4] if x >= 4 else 0
+            if kind == 1:
+                pred = left
+            elif kind == 2:
+                pred = up
+            elif kind == 3:
+                pred = (left + up) // 2
+            elif kind == 4:
+                p = left + up - corner
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - corner)
+                pred = left if pa <= pb and pa <= pc else (up if pb <= pc else corner)
+            else:
+                pred = 0
+            line[x] = (line[x] + pred) & 0xFF
+        rows.append(bytes(line))
+        prev = line
+    return width, height, rows
+
+
+def icon_pixels(path):
+    width, height, rows = read_png_rgba(path)
+    pixels = []
+    for row in rows:
+        for x in range(width):
+            r, g, b, a = row[4 * x:4 * x + 4]
+            pixels.append(0 if a < 128 else ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return width, height, pixels
+
+
+# ------------------- Codecs -------------------
+
+def qoi_slot(px):
+    return ((px >> 11) * 3 + ((px >> 5) & 63) * 5 + (px & 31) * 7) & 63
+
+
+def encode_qoi565(pixels):
+    out, index, prev, run = bytearray(), [0] * 64, 0, 0
+    for px in pixels:
+        if px == prev:
+            run += 1
+            if run == 64:
+                out.append(0x40 | 63)
+                run = 0
+            continue
+        if run:
+            out.append(0x40 | (run - 1))
+            run = 0
+        slot = qoi_slot(px)
+        if index[slot] == px:
+            out.append(slot)
+        else:
+            index[slot] = px
+            out += bytes((0x80, px & 0xFF, px >> 8))
+        prev = px
+    if run:
+        out.append(0x40 | (run - 1))
+    return bytes(out)
+
+
+def decode_qoi565(data, count):
+    pixels, index, prev, i = [], [0] * 64, 0, 0
+    while len(pixels) < count:
+        op = data[i]
+        i += 1
+        if op < 0x40:
+            prev = index[op]
+            pixels.append(prev)
+        elif op < 0x80:
+            pixels.extend([prev] * ((op & 63) + 1))
+        else:
+            prev = data[i] | data[i + 1] << 8
+            i += 2
+            index[qoi_slot(prev)] = prev
+            pixels.append(prev)
+    return pixels
+
+
+def encode_alpha(data):
+    out, literal, i = bytearray(), bytearray(), 0
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            out.append(0x80 | (len(chunk) - 1))
+            out.extend(chunk)
+            del literal[:128]
+
+    while i < len(data):
+        value = data[i]
+        if value in (0x00, 0xFF):
+            run = 1
+            while i + run < len(data) and data[i + run] == value and run < 64:
+                run += 1
+            # A lone 0/FF inside literals is cheaper kept as a literal.
+            if run >= 2 or not literal:
+                flush()
+                out.append((0x00 if value == 0 else 0x40) | (run - 1))
+                i += run
+                continue
+        literal.append(value)
+        i += 1
+    flush()
+    return bytes(out)
+
+
+def decode_alpha(data, count):
+    out, i = bytearray(), 0
+    while len(out) < count:
+        op = data[i]
+        n = (op & (0x7F if op & 0x80 else 0x3F)) + 1
+        if op & 0x80:
+            out += data[i + 1:i + 1 + n]
+            i += 1 + n
+        else:
+            out += (b"\xff" if op & 0x40 else b"\x00") * n
+            i += 1
+    return bytes(out)
+
+
+def read_vlw(path):
+    """VLW -> (size, ascent, descent, [(code, width, height, advance, dy, dx, alpha)])."""
+    vlw = open(path, "rb").read()
+    count, _, size, _, ascent, descent = struct.unpack(">6I", vlw[:24])
+    pos = 24 + 28 * count
+    glyphs = []
+    for g in range(count):
+        code, height, width, advance, dy, dx, _ = struct.unpack(
+            ">7i", vlw[24 + 28 * g:52 + 28 * g])
+        alpha = vlw[pos:pos + width * height]
+        pos += width * height
+        glyphs.append((code, width, height, advance, dy, dx, alpha))
+    return size, ascent, descent, sorted(glyphs)
+
+
+def encode_vlw(path):
+    """VLW -> (size, decoded bitmap bytes, stored payload)."""
+    size, ascent, descent, glyphs = read_vlw(path)
+    count = len(glyphs)
+    table, bitmaps, decoded = bytearray(), bytearray(), 0
+    for code, width, height, advance, dy, dx, alpha in glyphs:
+        if not any(alpha):
+            dy = dx = 0  # blank glyphs (e.g. U+00A0) carry junk offsets
+        if code > 0xFFFF or width > 255 or height > 255 or advance > 255 \
+                or not -128 <= dy <= 127 or not -128 <= dx <= 127:
+            sys.exit("%s: glyph %d does not fit the compact table" % (path, code))
+        encoded, flags = encode_alpha(alpha), 0
+        assert decode_alpha(encoded, len(alpha)) == alpha
+        if len(encoded) >= len(alpha):
+            encoded, flags = alpha, GLYPH_RAW
+        table += struct.pack("<HBBBbbBI", code, width, height, advance, dy, dx, flags,
+                             len(bitmaps))
+        bitmaps += encoded
+        decoded += len(alpha)
+    payload = struct.pack("<HHHH", count, size, ascent, descent) + bytes(table) + bytes(bitmaps)
+    return size, decoded, payload
+
+
+def gfx_font(name, path, bold):
+    """VLW -> C source of an Adafruit GFXfont (1 bit per pixel, alpha >= 50%)."""
+    size, ascent, descent, glyphs = read_vlw(path)
+    by_code = {g[0]: g for g in glyphs}
+    # VLW files usually leave out the space; TFT_eSPI's width for it.
+    by_code.setdefault(0x20, (0x20, 0, 0, (ascent + descent) * 2 // 7, 0, 0, b""))
+    bitmap, table = bytearray(), []
+    for code in range(0x20, 0x7F):
+        if code not in by_code:
+            sys.exit("%s: no glyph for %r" % (path, chr(code)))
+        _, width, height, advance, dy, dx, alpha = by_code[code]
+        if not any(alpha):
+            width = height = dy = dx = 0
+        rows = [[alpha[y * width + x] >= 128 for x in range(width)] for y in range(height)]
+        if bold and width:
+            # Smear one pixel right, as a synthetic bold.
+            rows = [[row[x] if x < width else False for x in range(width + 1)] for row in rows]
+            rows = [[row[x] or (x > 0 and row[x - 1]) for x in range(width + 1)] for row in rows]
+            width += 1
+            advance += 1
+        bits = [bit for row in rows for bit in row]
+        offset = len(bitmap)
+        for i in range(0, len(bits), 8):
+            byte = 0
+            for j, bit in enumerate(bits[i:i + 8]):
+                byte |= bit << (7 - j)
+            bitmap.append(byte)
+        table.append((offset, width, height, advance, dx, -dy, code))
+    if len(bitmap) > 0xFFFF:
+        sys.exit("%s: too much bitmap data for a GFXfont" % name)
+
+    lines = ["const uint8_t k%sBitmaps[%d] = {" % (name, len(bitmap))]
+    for i in range(0, len(bitmap), 16):
+        lines.append("  " + ", ".join("0x%02X" % b for b in bitmap[i:i + 16]) + ",")
+    lines += ["};", "", "const GFXglyph k%sGlyphs[] = {" % name]
+    for offset, width, height, advance, dx, dy, code in table:
+        lines.append("  {%d, %d, %d, %d, %d, %d},  // %r"
+                     % (offset, width, height, advance, dx, dy, chr(code)))
+    lines += ["};", "",
+              "const GFXfont %s = {k%sBitmaps, k%sGlyphs, 0x20, 0x7E, %d};"
+              % (name, name, name, round(size * 1.3)), ""]
+    return "\n".join(lines)
+
+
+def render_native_fonts():
+    lines = [
+        "// Generated by pack_assets.py - do not edit.",
+        "// Stand-ins for the LovyanGFX free fonts, cut from assets/fonts.",
+        "#pragma once",
+        "",
+        "#include <M5Unified.h>",
+        "",
+    ]
+    for name, source, bold in NATIVE_FONTS:
+        lines.append(gfx_font(name, os.path.join(FONT_DIR, source), bold))
+    return "\n".join(lines)
+
+
+# ------------------- Bundle -------------------
+
+def font_files(fonts):
+    """VLW file names to bundle: FONTS, "all", or a comma-separated list."""
+    available = sorted((n for n in os.listdir(FONT_DIR) if n.endswith(".vlw")), key=str.lower)
+    if fonts == "all":
+        return available
+    wanted = FONTS if fonts is None else [f.strip() for f in fonts.split(",") if f.strip()]
+    chosen = []
+    for want in wanted:
+        match = [n for n in available if want.lower() in (n.lower(), n[:-4].lower())]
+        if not match:
+            sys.exit("no font %r in %s" % (want, os.path.relpath(FONT_DIR, ROOT)))
+        chosen.append(match[0])
+    return sorted(set(chosen), key=str.lower)
+
+
+def collect(fonts=None):
+    """[(enum name, kind, codec, width, height, decoded size, stored bytes)]"""
+    assets = []
+    for name in sorted(os.listdir(ICON_DIR)):
+        if not name.endswith(".png"):
+            continue
+        width, height, pixels = icon_pixels(os.path.join(ICON_DIR, name))
+        if (width, height) != (ICON_SIZE, ICON_SIZE):
+            sys.exit("%s: icons must be %dx%d" % (name, ICON_SIZE, ICON_SIZE))
+        stored = encode_qoi565(pixels)
+        assert decode_qoi565(stored, len(pixels)) == pixels
+        assets.append(("ASSET_ICON_" + name[:-4].upper(), KIND_IMAGE, CODEC_QOI565,
+                       width, height, 2 * len(pixels), stored))
+    for name in font_files(fonts):
+        stem = name[:-4]
+        if stem.lower().endswith("font") and len(stem) > 4:
+            stem = stem[:-4]
+        size, decoded, stored = encode_vlw(os.path.join(FONT_DIR, name))
+        assets.append(("ASSET_FONT_" + stem.upper(), KIND_FONT, CODEC_GLYPHS,
+                       size, size, decoded, stored))
+    return assets
+
+
+def build_bundle(assets):
+    header_size = 8 + 20 * len(assets)
+    table, payload = bytearray(), bytearray()
+    for _, kind, codec, width, height, decoded, stored in assets:
+        table += struct.pack("<BBHHHIII", kind, codec, width, height, 0, decoded,
+                             header_size + len(payload), len(stored))
+        payload += stored
+        payload += b"\0" * (-len(payload) % 4)
+    return b"ASB1" + struct.pack("<HH", len(assets), 0) + bytes(table) + bytes(payload)
+
+
+def table_note(kind, stored):
+    """Fonts: the glyph table, which is stored on top of the bitmaps."""
+    if kind != KIND_FONT:
+        return ""
+    count = struct.unpack("<H", stored[:2])[0]
+    return " (%d of them glyph table)" % (FONT_HEADER_BYTES + GLYPH_BYTES * count)
+
+
+def render_ids(assets):
+    lines = [
+        "// Generated by pack_assets.py - do not edit.",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        "enum AssetId : uint8_t {",
+    ]
+    for name, kind, _, width, height, decoded, stored in assets:
+        what = "%dx%d icon" % (width, height) if kind == KIND_IMAGE else "%d px font" % height
+        lines.append("  %s,  // %s, %d -> %d bytes%s"
+                     % (name, what, decoded, len(stored), table_note(kind, stored)))
+    lines += ["  ASSET_COUNT", "};", ""]
+    return "\n".join(lines)
+
+
+def render_data(bundle, assets):
+    raw_total = sum(a[5] for a in assets)
+    lines = [
+        "// Generated by pack_assets.py - do not edit.",
+        "// %d assets, %d bytes decoded, %d bytes packed." % (len(assets), raw_total, len(bundle)),
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "alignas(4) const uint8_t ASSET_BUNDLE[%d] PROGMEM = {" % len(bundle),
+    ]
+    for i in range(0, len(bundle), 16):
+        lines.append("  " + ", ".join("0x%02X" % b for b in bundle[i:i + 16]) + ",")
+    lines += ["};", ""]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true",
+                        help="exit non-zero if the generated headers are stale")
+    parser.add_argument("--fonts", metavar="LIST",
+                        help="fonts to bundle, comma separated (file name with or without "
+                             ".vlw), or 'all'; default: the ones the firmware draws")
+    args = parser.parse_args()
+
+    assets = collect(args.fonts)
+    bundle = build_bundle(assets)
+    outputs = {IDS_HEADER: render_ids(assets), DATA_HEADER: render_data(bundle, assets),
+               NATIVE_FONTS_HEADER: render_native_fonts()}
+
+    if args.check:
+        stale = [p for p, text in outputs.items()
+                 if not os.path.exists(p) or open(p).read() != text]
+        for path in stale:
+            print("stale: %s" % os.path.relpath(path, ROOT))
+        sys.exit(1 if stale else 0)
+
+    for path, text in outputs.items():
+        with open(path, "w", newline="\n") as f:
+            f.write(text)
+
+    for name, kind, _, _, _, decoded, stored in assets:
+        print("%-26s %7d -> %6d bytes (%4.1f%%)%s"
+              % (name, decoded, len(stored), 100.0 * len(stored) / decoded,
+                 table_note(kind, stored)))
+    raw_total = sum(a[5] for a in assets)
+    print("bundle: %d assets, %d -> %d bytes" % (len(assets), raw_total, len(bundle)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,173 @@
+#include "asset_bundle.h"
+
+#include "asset_bundle_data.h"
+
+AssetBundle assets(ASSET_BUNDLE);
+
+namespace {
+
+const char kMagic[4] = {'A', 'S', 'B', '1'};
+constexpr uint8_t kKindImage = 0;
+constexpr uint8_t kKindFont = 1;
+constexpr uint8_t kCodecQoi565 = 1;
+constexpr uint8_t kCodecGlyphs = 2;
+constexpr size_t kHeaderBytes = 8;
+constexpr size_t kFontHeaderBytes = 8;
+
+uint8_t qoiSlot(uint16_t px) {
+  return ((px >> 11) * 3 + ((px >> 5) & 63) * 5 + (px & 31) * 7) & 63;
+}
+
+// QOI-style RGB565: index / run / literal ops, see pack_assets.py.
+bool decodeQoi565(const uint8_t *src, size_t len, uint16_t *out, size_t count) {
+  uint16_t index[64] = {0};
+  uint16_t prev = 0;
+  size_t i = 0, n = 0;
+  while (n < count) {
+    if (i >= len) return false;
+    uint8_t op = src[i++];
+    if (op < 0x40) {
+      prev = index[op];
+      out[n++] = prev;
+    } else if (op < 0x80) {
+      size_t run = (op & 63) + 1;
+      if (n + run > count) return false;
+      while (run--) out[n++] = prev;
+    } else {
+      if (i + 2 > len) return false;
+      prev = src[i] | (src[i + 1] << 8);
+      i += 2;
+      index[qoiSlot(prev)] = prev;
+      out[n++] = prev;
+    }
+  }
+  return true;
+}
+
+// Glyph alpha: runs of 0x00 / 0xFF and literal spans.
+bool decodeAlpha(const uint8_t *src, size_t len, uint8_t *out, size_t count) {
+  size_t i = 0, n = 0;
+  while (n < count) {
+    if (i >= len) return false;
+    uint8_t op = src[i++];
+    if (op & 0x80) {
+      size_t span = (op & 0x7F) + 1;
+      if (n + span > count || i + span > len) return false;
+      memcpy(out + n, src + i, span);
+      i += span;
+      n += span;
+    } else {
+      size_t run = (op & 0x3F) + 1;
+      if (n + run > count) return false;
+      memset(out + n, (op & 0x40) ? 0xFF : 0x00, run);
+      n += run;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+AssetBundle::AssetBundle(const uint8_t *bundle) : bundle_(bundle) {
+  if (!bundle_ || memcmp(bundle_, kMagic, sizeof(kMagic)) != 0) return;
+  memcpy(&count_, bundle_ + 4, sizeof(count_));
+  if (count_ > ASSET_COUNT) count_ = ASSET_COUNT;
+  bundleBytes_ = kHeaderBytes + count_ * sizeof(Entry);
+  for (uint16_t i = 0; i < count_; ++i) {
+    const Entry *e = entry((AssetId)i);
+    decodedBytes_ += e->decodedSize;
+    if (e->offset + e->storedSize > bundleBytes_) bundleBytes_ = e->offset + e->storedSize;
+  }
+}
+
+const AssetBundle::Entry *AssetBundle::entry(AssetId id) const {
+  if (id >= count_) return nullptr;
+  return reinterpret_cast<const Entry *>(bundle_ + kHeaderBytes) + id;
+}
+
+uint16_t AssetBundle::width(AssetId id) const {
+  const Entry *e = entry(id);
+  return e ? e->width : 0;
+}
+
+uint16_t AssetBundle::height(AssetId id) const {
+  const Entry *e = entry(id);
+  return e ? e->height : 0;
+}
+
+const uint16_t *AssetBundle::image(AssetId id) {
+  const Entry *e = entry(id);
+  if (!e || e->kind != kKindImage || e->codec != kCodecQoi565) return nullptr;
+  size_t pixels = (size_t)e->width * e->height;
+  if (pixels > ASSET_IMAGE_MAX_PIXELS) return nullptr;
+
+  useClock_++;
+  Slot *victim = &slots_[0];
+  for (Slot &slot : slots_) {
+    if (slot.id == id) {
+      slot.lastUse = useClock_;
+      stats_.hits++;
+      return slot.pixels;
+    }
+    if (slot.lastUse < victim->lastUse) victim = &slot;
+  }
+
+  stats_.misses++;
+  if (victim->id != ASSET_COUNT) stats_.evictions++;
+  uint32_t start = micros();
+  bool ok = decodeQoi565(bundle_ + e->offset, e->storedSize, victim->pixels, pixels);
+  stats_.lastDecodeUs = micros() - start;
+  stats_.decodeUs += stats_.lastDecodeUs;
+  if (!ok) {
+    stats_.decodeErrors++;
+    victim->id = ASSET_COUNT;
+    victim->lastUse = 0;
+    return nullptr;
+  }
+  victim->id = id;
+  victim->lastUse = useClock_;
+  return victim->pixels;
+}
+
+bool AssetBundle::fontInfo(AssetId id, AssetFontInfo &info) const {
+  const Entry *e = entry(id);
+  if (!e || e->kind != kKindFont || e->codec != kCodecGlyphs) return false;
+  memcpy(&info, bundle_ + e->offset, kFontHeaderBytes);
+  return true;
+}
+
+const AssetGlyph *AssetBundle::findGlyph(AssetId id, uint16_t code) const {
+  AssetFontInfo info;
+  if (!fontInfo(id, info)) return nullptr;
+  const AssetGlyph *glyphs =
+      reinterpret_cast<const AssetGlyph *>(bundle_ + entry(id)->offset + kFontHeaderBytes);
+  // The packer sorts glyphs by code point.
+  int lo = 0, hi = (int)info.glyphCount - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (glyphs[mid].code == code) return &glyphs[mid];
+    if (glyphs[mid].code < code) {
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return nullptr;
+}
+
+bool AssetBundle::decodeGlyph(AssetId id, const AssetGlyph &glyph, uint8_t *alpha) const {
+  AssetFontInfo info;
+  if (!fontInfo(id, info)) return false;
+  const Entry *e = entry(id);
+  size_t tableBytes = kFontHeaderBytes + info.glyphCount * sizeof(AssetGlyph);
+  if (tableBytes + glyph.offset >= e->storedSize) return false;
+  const uint8_t *src = bundle_ + e->offset + tableBytes + glyph.offset;
+  size_t avail = e->storedSize - tableBytes - glyph.offset;
+  size_t count = (size_t)glyph.width * glyph.height;
+  if (glyph.flags & ASSET_GLYPH_RAW) {
+    if (count > avail) return false;
+    memcpy(alpha, src, count);
+    return true;
+  }
+  return decodeAlpha(src, avail, alpha, count);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "asset_ids.h"
+
+// Icons and smooth fonts packed by pack_assets.py into one compressed blob
+// in flash (include/asset_bundle_data.h; format described in the script).
+//
+// Images decode on demand into a small LRU cache of RGB565 buffers. Fonts
+// stay compressed: the glyph table is read straight from flash and each
+// glyph's alpha bitmap is decoded on its own when a renderer asks for it.
+
+constexpr uint8_t ASSET_IMAGE_CACHE_SLOTS = 8;     // one hourly view's worth
+constexpr size_t ASSET_IMAGE_MAX_PIXELS = 24 * 24;
+
+struct AssetCacheStats {
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  uint32_t evictions = 0;
+  uint32_t decodeErrors = 0;
+  uint32_t decodeUs = 0;      // total time spent decoding images
+  uint32_t lastDecodeUs = 0;
+};
+
+constexpr uint8_t ASSET_GLYPH_RAW = 0x01;  // bitmap stored as is, not RLE coded
+
+// One glyph of a bundled font, read in place from flash.
+struct AssetGlyph {
+  uint16_t code;
+  uint8_t width;
+  uint8_t height;
+  uint8_t advance;
+  int8_t dY;      // top of the bitmap above the baseline
+  int8_t dX;      // left bearing
+  uint8_t flags;  // ASSET_GLYPH_RAW
+  uint32_t offset;
+};
+static_assert(sizeof(AssetGlyph) == 12, "AssetGlyph must match the bundle layout");
+
+struct AssetFontInfo {
+  uint16_t glyphCount = 0;
+  uint16_t size = 0;
+  uint16_t ascent = 0;
+  uint16_t descent = 0;
+};
+
+class AssetBundle {
+ public:
+  explicit AssetBundle(const uint8_t *bundle);
+
+  // False if the blob is missing or from an incompatible packer.
+  bool valid() const { return count_ > 0; }
+
+  // Decoded RGB565 pixels (width(id) x height(id)), or nullptr if `id` is not
+  // an image. Valid until ASSET_IMAGE_CACHE_SLOTS other images are requested.
+  const uint16_t *image(AssetId id);
+  uint16_t width(AssetId id) const;
+  uint16_t height(AssetId id) const;
+
+  bool fontInfo(AssetId id, AssetFontInfo &info) const;
+  // Glyph for a code point, or nullptr.
+  const AssetGlyph *findGlyph(AssetId id, uint16_t code) const;
+  // Decode a glyph's width*height alpha bytes into `alpha`.
+  bool decodeGlyph(AssetId id, const AssetGlyph &glyph, uint8_t *alpha) const;
+
+  size_t bundleBytes() const { return bundleBytes_; }
+  size_t decodedBytes() const { return decodedBytes_; }
+  static constexpr size_t cacheBytes() {
+    return ASSET_IMAGE_CACHE_SLOTS * ASSET_IMAGE_MAX_PIXELS * sizeof(uint16_t);
+  }
+  const AssetCacheStats &stats() const { return stats_; }
+
+ private:
+  struct Entry {
+    uint8_t kind;
+    uint8_t codec;
+    uint16_t width;
+    uint16_t height;
+    uint16_t reserved;
+    uint32_t decodedSize;
+    uint32_t offset;
+    uint32_t storedSize;
+  };
+  struct Slot {
+    uint8_t id = ASSET_COUNT;
+    uint32_t lastUse = 0;
+    uint16_t pixels[ASSET_IMAGE_MAX_PIXELS];
+  };
+
+  const Entry *entry(AssetId id) const;
+
+  const uint8_t *bundle_;
+  uint16_t count_ = 0;
+  size_t bundleBytes_ = 0;
+  size_t decodedBytes_ = 0;
+  Slot slots_[ASSET_IMAGE_CACHE_SLOTS];
+  uint32_t useClock_ = 0;
+  AssetCacheStats stats_;
+};
+
+extern AssetBundle assets;
@@ -0,0 +1,181 @@
+#include "forecast_parser.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+namespace {
+
+constexpr uint32_t kSecondsPerDay = 86400;
+constexpr uint32_t kMiddaySeconds = 12 * 3600;
+
+// CountingAllocator prefixes each block with its size so deallocate() can
+// keep the live count exact.
+constexpr size_t kHeader = sizeof(max_align_t);
+
+void formatDayLabel(uint32_t epoch, int32_t tzOffset, bool isToday, char *out, size_t len) {
+  if (isToday) {
+    strlcpy(out, "Today", len);
+    return;
+  }
+  time_t localTs = static_cast<time_t>(epoch) + tzOffset;
+  struct tm info;
+  gmtime_r(&localTs, &info);
+  strftime(out, len, "%a", &info);
+}
+
+}  // namespace
+
+// ------------------- CountingAllocator -------------------
+void *CountingAllocator::allocate(size_t size) {
+  uint8_t *raw = static_cast<uint8_t *>(malloc(size + kHeader));
+  if (!raw) return nullptr;
+  *reinterpret_cast<size_t *>(raw) = size;
+  live_ += size;
+  if (live_ > peak_) peak_ = live_;
+  return raw + kHeader;
+}
+
+void CountingAllocator::deallocate(void *ptr) {
+  if (!ptr) return;
+  uint8_t *raw = static_cast<uint8_t *>(ptr) - kHeader;
+  live_ -= *reinterpret_cast<size_t *>(raw);
+  free(raw);
+}
+
+void *CountingAllocator::reallocate(void *ptr, size_t newSize) {
+  if (!ptr) return allocate(newSize);
+  uint8_t *raw = static_cast<uint8_t *>(ptr) - kHeader;
+  size_t oldSize = *reinterpret_cast<size_t *>(raw);
+  uint8_t *grown = static_cast<uint8_t *>(realloc(raw, newSize + kHeader));
+  if (!grown) return nullptr;
+  *reinterpret_cast<size_t *>(grown) = newSize;
+  live_ = live_ - oldSize + newSize;
+  if (live_ > peak_) peak_ = live_;
+  return grown + kHeader;
+}
+
+// ------------------- ForecastParser -------------------
+ForecastParser::ForecastParser(WeatherData &data) : data_(data) {}
+
+bool ForecastParser::parse(Stream &body) {
+  if (!body.find("\"list\":[")) return false;
+
+  JsonDocument filter(&alloc_);
+  filter["dt"] = true;
+  filter["main"]["temp"] = true;
+  filter["main"]["temp_min"] = true;
+  filter["main"]["temp_max"] = true;
+  filter["weather"][0]["description"] = true;
+  filter["weather"][0]["icon"] = true;
+  filter["wind"]["speed"] = true;
+  filter["pop"] = true;
+
+  JsonDocument entry(&alloc_);
+  do {
+    DeserializationError err =
+        deserializeJson(entry, body, DeserializationOption::Filter(filter));
+    if (err) {
+      // A truncated body still leaves the buckets filled so far usable.
+      break;
+    }
+    addEntry(entry.as<JsonObjectConst>());
+  } while (body.findUntil(",", "]"));
+
+  bool any = finish();
+
+  // Reuse both documents so the peak stays one entry's worth
+  filter.clear();
+  filter["timezone"] = true;
+  if (body.find("\"city\":") &&
+      !deserializeJson(entry, body, DeserializationOption::Filter(filter)) &&
+      entry["timezone"].is<int32_t>()) {
+    data_.timezoneOffset = entry["timezone"];
+  }
+  return any;
+}
+
+void ForecastParser::addEntry(JsonObjectConst entry) {
+  uint32_t ts = entry["dt"] | 0;
+  if (!ts) return;
+
+  if (entries_++ == 0) {
+    baseDay_ = (data_.lastUpdateEpoch + data_.timezoneOffset) / kSecondsPerDay;
+    if (baseDay_ <= 0) {
+      baseDay_ = (ts + data_.timezoneOffset) / kSecondsPerDay;
+    }
+    data_.hourly.firstEpoch = ts;
+    data_.hourly.count = 0;
+  }
+
+  JsonObjectConst w = entry["weather"][0];
+  uint8_t icon = weatherIconIndex(w["icon"] | "01d");
+  float pop = entry["pop"] | 0.0f;
+  uint8_t popPct = (uint8_t)constrain(lroundf(pop * 100.0f), 0L, 100L);
+
+  HourlyForecast &hourly = data_.hourly;
+  if (hourly.count < WEATHER_FORECAST_POINTS && ts >= hourly.firstEpoch) {
+    uint32_t slot = (ts - hourly.firstEpoch) / WEATHER_FORECAST_STEP_S;
+    if (slot <= UINT8_MAX) {
+      ForecastPoint &p = hourly.points[hourly.count++];
+      float temp = entry["main"]["temp"] | NAN;
+      float wind = entry["wind"]["speed"] | 0.0f;
+      p.tempTenths = isnan(temp) ? INT16_MIN : (int16_t)constrain(lroundf(temp * 10.0f), -32767L, 32767L);
+      p.slot = (uint8_t)slot;
+      p.pop = popPct;
+      p.windHalves = (uint8_t)constrain(lroundf(wind * 2.0f), 0L, 255L);
+      p.icon = icon;
+    }
+  }
+
+  int32_t localDay = static_cast<int32_t>((ts + data_.timezoneOffset) / kSecondsPerDay);
+  int idx = localDay - baseDay_;
+  if (idx < 0 || idx >= WEATHER_FORECAST_DAYS) return;
+
+  Bucket &bucket = buckets_[idx];
+  bucket.used = true;
+  if (popPct > bucket.pop) bucket.pop = popPct;
+
+  float tempMin = entry["main"]["temp_min"] | NAN;
+  float tempMax = entry["main"]["temp_max"] | NAN;
+  if (!isnan(tempMin)) bucket.tempMin = (bucket.tempMin == 1e6f) ? tempMin : min(bucket.tempMin, tempMin);
+  if (!isnan(tempMax)) bucket.tempMax = (bucket.tempMax == -1e6f) ? tempMax : max(bucket.tempMax, tempMax);
+
+  uint32_t localSeconds = static_cast<uint32_t>((ts + data_.timezoneOffset) % kSecondsPerDay);
+  uint32_t delta = (localSeconds > kMiddaySeconds)
+                       ? (localSeconds - kMiddaySeconds)
+                       : (kMiddaySeconds - localSeconds);
+  if (delta < bucket.bestDelta) {
+    bucket.bestDelta = delta;
+    bucket.representativeTs = ts;
+    strlcpy(bucket.description, w["description"] | "n/a", sizeof(bucket.description));
+    bucket.icon = icon;
+  }
+}
+
+bool ForecastParser::finish() {
+  bool any = false;
+  for (int i = 0; i < WEATHER_FORECAST_DAYS; ++i) {
+    WeatherForecast &out = data_.forecast[i];
+    const Bucket &bucket = buckets_[i];
+    if (!bucket.used) {
+      out.valid = false;
+      continue;
+    }
+    any = true;
+    out.valid = true;
+    out.timestamp = bucket.representativeTs;
+    out.tempMin = (bucket.tempMin == 1e6f) ? NAN : bucket.tempMin;
+    out.tempMax = (bucket.tempMax == -1e6f) ? NAN : bucket.tempMax;
+    strlcpy(out.description, bucket.description, sizeof(out.description));
+    out.icon = bucket.icon;
+    out.pop = bucket.pop;
+
+    uint32_t labelTs = bucket.representativeTs;
+    if (!labelTs) {
+      labelTs = (baseDay_ + i) * kSecondsPerDay;
+    }
+    formatDayLabel(labelTs, data_.timezoneOffset, i == 0, out.label, sizeof(out.label));
+  }
+  return any;
+}
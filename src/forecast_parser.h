@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "weather_display.h"
+
+// ArduinoJson allocator that tracks live and peak bytes, so fetches can
+// report how much heap JSON parsing actually needed.
+class CountingAllocator : public ArduinoJson::Allocator {
+ public:
+  void *allocate(size_t size) override;
+  void deallocate(void *ptr) override;
+  void *reallocate(void *ptr, size_t newSize) override;
+
+  size_t liveBytes() const { return live_; }
+  size_t peakBytes() const { return peak_; }
+  void resetPeak() { peak_ = live_; }
+
+ private:
+  size_t live_ = 0;
+  size_t peak_ = 0;
+};
+
+// Incremental parser for the OpenWeather 5 day / 3 hour forecast.
+//
+// Instead of buffering the 15-20 KB response and building a document for
+// all 40 entries, the body is scanned up to "list":[ and each entry is
+// deserialized on its own through a filter (dt, temps, pop, wind,
+// weather[0] description/icon), packed into data.hourly, folded into the
+// per-day buckets and discarded. Peak JSON heap is the filter plus one
+// filtered entry, whatever the length of the list.
+//
+// Expects data.timezoneOffset / lastUpdateEpoch from the current-conditions
+// call, which is made first for the same city: days are bucketed with that
+// offset, because the forecast's own city.timezone only follows the list.
+// city.timezone then replaces data.timezoneOffset (it is the same value
+// unless the current-conditions response left it out).
+class ForecastParser {
+ public:
+  explicit ForecastParser(WeatherData &data);
+
+  // Consume a response body. Returns true if at least one day was filled.
+  bool parse(Stream &body);
+
+  uint16_t entries() const { return entries_; }
+  size_t peakJsonBytes() const { return alloc_.peakBytes(); }
+
+ private:
+  struct Bucket {
+    bool used = false;
+    float tempMin = 1e6f;
+    float tempMax = -1e6f;
+    uint32_t representativeTs = 0;
+    uint32_t bestDelta = UINT32_MAX;
+    char description[48] = "";
+    uint8_t icon = WEATHER_ICON_DEFAULT;
+    uint8_t pop = 0;
+  };
+
+  void addEntry(JsonObjectConst entry);
+  bool finish();
+
+  WeatherData &data_;
+  CountingAllocator alloc_;
+  Bucket buckets_[WEATHER_FORECAST_DAYS];
+  int32_t baseDay_ = 0;
+  uint16_t entries_ = 0;
+};
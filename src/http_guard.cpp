@@ -0,0 +1,86 @@
+#include "http_guard.h"
+
+bool HttpGuard::shouldPoll(uint32_t nowUs) {
+  refillBudget(nowUs);
+  if (budgetUs_ <= 0) {
+    stats_.skippedPolls++;
+    return false;
+  }
+  return true;
+}
+
+void HttpGuard::charge(uint32_t elapsedUs) {
+  stats_.lastPollUs = elapsedUs;
+  if (elapsedUs > stats_.maxPollUs) stats_.maxPollUs = elapsedUs;
+  // Debt is bounded so one pathological request cannot mute HTTP for long.
+  int32_t next = budgetUs_ - static_cast<int32_t>(elapsedUs);
+  const int32_t floor = -static_cast<int32_t>(HTTP_BUDGET_BURST_US);
+  budgetUs_ = next < floor ? floor : next;
+}
+
+void HttpGuard::refillBudget(uint32_t nowUs) {
+  if (!budgetStarted_) {
+    budgetStarted_ = true;
+    lastBudgetUs_ = nowUs;
+    return;
+  }
+  uint32_t elapsed = nowUs - lastBudgetUs_;
+  uint64_t earned = static_cast<uint64_t>(elapsed) * HTTP_BUDGET_PER_FRAME_US /
+                    HTTP_FRAME_INTERVAL_US;
+  if (earned == 0) return;
+  lastBudgetUs_ = nowUs;
+  int64_t next = static_cast<int64_t>(budgetUs_) + static_cast<int64_t>(earned);
+  budgetUs_ = next > HTTP_BUDGET_BURST_US ? HTTP_BUDGET_BURST_US
+                                          : static_cast<int32_t>(next);
+}
+
+HttpGuard::ClientBucket &HttpGuard::bucketFor(uint32_t ip, uint32_t nowMs) {
+  ClientBucket *oldest = &clients_[0];
+  for (auto &slot : clients_) {
+    if (slot.ip == ip && slot.lastRefillMs != 0) return slot;
+    if (slot.lastRefillMs == 0 ||
+        (oldest->lastRefillMs != 0 &&
+         static_cast<int32_t>(slot.lastRefillMs - oldest->lastRefillMs) < 0)) {
+      oldest = &slot;
+    }
+  }
+  // Unknown client: recycle the least recently seen slot with a full bucket.
+  oldest->ip = ip;
+  oldest->lastRefillMs = nowMs ? nowMs : 1;
+  oldest->milliTokens = HTTP_CLIENT_BURST * 1000U;
+  return *oldest;
+}
+
+bool HttpGuard::admit(uint32_t clientIp, uint32_t nowMs) {
+  ClientBucket &bucket = bucketFor(clientIp, nowMs);
+
+  uint32_t elapsed = nowMs - bucket.lastRefillMs;
+  if (elapsed) {
+    uint32_t cap = HTTP_CLIENT_BURST * 1000U;
+    uint64_t refill = static_cast<uint64_t>(elapsed) * HTTP_CLIENT_RATE_PER_SEC;
+    uint64_t tokens = bucket.milliTokens + refill;
+    bucket.milliTokens = tokens > cap ? cap : static_cast<uint32_t>(tokens);
+    bucket.lastRefillMs = nowMs ? nowMs : 1;
+  }
+
+  if (bucket.milliTokens < 1000U) {
+    stats_.throttledClient++;
+    return false;
+  }
+  bucket.milliTokens -= 1000U;
+
+  if (budgetUs_ < static_cast<int32_t>(HTTP_MIN_REQUEST_BUDGET_US)) {
+    stats_.throttledBudget++;
+    return false;
+  }
+
+  stats_.served++;
+  return true;
+}
+
+uint8_t HttpGuard::retryAfterSec() const {
+  // A client token comes back every 1/HTTP_CLIENT_RATE_PER_SEC seconds and
+  // the frame budget refills far faster, so one second covers both cases.
+  static_assert(HTTP_CLIENT_RATE_PER_SEC >= 1, "Retry-After assumes >= 1 req/s");
+  return 1;
+}
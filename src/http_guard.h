@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Admission control for the embedded web server.
+//
+// WebServer::handleClient() shares the I/O task with serial ingest and the
+// WebSocket feed, so a client polling /metrics in a tight loop could starve
+// them. Two limits protect the I/O loop:
+//   - a per-client token bucket (requests/second, keyed by remote IPv4)
+//   - a global CPU-time bucket for HTTP work, refilled at a fixed share of
+//     each frame; when it runs dry handleClient() is skipped entirely and
+//     requests wait in the TCP backlog until the next refill.
+// Requests rejected by either limit get a cheap 429 with Retry-After.
+
+// Per-client request bucket.
+constexpr uint8_t HTTP_CLIENT_SLOTS = 8;
+constexpr uint16_t HTTP_CLIENT_BURST = 8;       // requests
+constexpr uint16_t HTTP_CLIENT_RATE_PER_SEC = 4;
+
+// Global HTTP time budget, expressed per render frame.
+constexpr uint32_t HTTP_FRAME_INTERVAL_US = 33333;
+constexpr uint32_t HTTP_BUDGET_PER_FRAME_US = 6000;
+constexpr uint32_t HTTP_BUDGET_BURST_US = 2 * HTTP_BUDGET_PER_FRAME_US;
+// Below this many microseconds of remaining budget we answer 429 instead of
+// running a full handler.
+constexpr uint32_t HTTP_MIN_REQUEST_BUDGET_US = 1500;
+
+struct HttpGuardStats {
+  uint32_t served = 0;
+  uint32_t throttledClient = 0;   // 429 because the client's bucket was empty
+  uint32_t throttledBudget = 0;   // 429 because the frame budget was exhausted
+  uint32_t skippedPolls = 0;      // loop iterations that skipped handleClient()
+  uint32_t lastPollUs = 0;
+  uint32_t maxPollUs = 0;
+};
+
+class HttpGuard {
+ public:
+  // Called once per loop iteration before handleClient(). Returns false when
+  // the HTTP budget is in debt and polling should be skipped this time.
+  bool shouldPoll(uint32_t nowUs);
+
+  // Charge the wall time spent inside handleClient().
+  void charge(uint32_t elapsedUs);
+
+  // Called at the top of each request handler. Returns false if the request
+  // must be rejected with 429.
+  bool admit(uint32_t clientIp, uint32_t nowMs);
+
+  // Seconds a rejected client should wait before retrying.
+  uint8_t retryAfterSec() const;
+
+  const HttpGuardStats &stats() const { return stats_; }
+
+ private:
+  struct ClientBucket {
+    uint32_t ip = 0;
+    uint32_t lastRefillMs = 0;
+    uint32_t milliTokens = 0;
+  };
+
+  void refillBudget(uint32_t nowUs);
+  ClientBucket &bucketFor(uint32_t ip, uint32_t nowMs);
+
+  ClientBucket clients_[HTTP_CLIENT_SLOTS];
+  int32_t budgetUs_ = HTTP_BUDGET_BURST_US;
+  uint32_t lastBudgetUs_ = 0;
+  bool budgetStarted_ = false;
+  HttpGuardStats stats_{};
+};
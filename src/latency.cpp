@@ -0,0 +1,143 @@
+#include "latency.h"
+
+#include <algorithm>
+#include <stdlib.h>
+
+FeederClock feederClock;
+LatencyTracker latency;
+
+namespace {
+
+uint32_t clampUs(int64_t us) {
+  if (us < 0) return 0;
+  return us > (int64_t)UINT32_MAX ? UINT32_MAX : (uint32_t)us;
+}
+
+// Nearest-rank percentile of sorted values
+uint32_t percentile(const uint32_t *sorted, uint16_t count, uint8_t p) {
+  return sorted[((uint32_t)count * p + 99) / 100 - 1];
+}
+
+}  // namespace
+
+bool parseFeederStamp(const char *text, FeederStamp &out) {
+  char *end;
+  out.seq = strtoul(text, &end, 10);
+  if (end == text || *end != ';') return false;
+  text = end + 1;
+  out.sendUs = strtoll(text, &end, 10);
+  if (end == text) return false;
+
+  out.hasEcho = false;
+  if (*end != ';') return *end == '\0';
+  text = end + 1;
+  out.echoSeq = strtoul(text, &end, 10);
+  if (end == text || *end != ';') return true;  // keep the stamp, drop the echo
+  text = end + 1;
+  out.echoUs = strtoll(text, &end, 10);
+  out.hasEcho = end != text;
+  return true;
+}
+
+// ------------------- Clock offset -------------------
+
+void FeederClock::echoSent(uint32_t seq, int64_t sendUs, int64_t recvUs, int64_t echoUs) {
+  // Numbering restarted: a new feeder session, with its own clock
+  if (seq <= seq_) count_ = next_ = 0;
+  seq_ = seq;
+  sendUs_ = sendUs;
+  recvUs_ = recvUs;
+  echoUs_ = echoUs;
+  pending_ = true;
+}
+
+void FeederClock::echoReturned(uint32_t seq, int64_t hostUs) {
+  if (!pending_ || seq != seq_) return;
+  pending_ = false;
+  int64_t rtt = (hostUs - sendUs_) - (echoUs_ - recvUs_);
+  if (rtt < 0) return;
+
+  RoundTrip &trip = trips_[next_];
+  trip.offsetUs = ((recvUs_ - sendUs_) + (echoUs_ - hostUs)) / 2;
+  trip.rttUs = clampUs(rtt);
+  next_ = (next_ + 1) % LATENCY_OFFSET_WINDOW;
+  if (count_ < LATENCY_OFFSET_WINDOW) count_++;
+  echoes_++;
+
+  const RoundTrip *best = &trips_[0];
+  for (uint8_t i = 1; i < count_; ++i) {
+    if (trips_[i].rttUs < best->rttUs) best = &trips_[i];
+  }
+  offsetUs_ = best->offsetUs;
+  rttUs_ = best->rttUs;
+}
+
+FeederClockStats FeederClock::stats() const {
+  FeederClockStats s;
+  s.synced = synced();
+  s.echoes = echoes_;
+  s.offsetUs = offsetUs_;
+  s.rttUs = rttUs_;
+  return s;
+}
+
+// ------------------- Sample latency -------------------
+
+void LatencyTracker::begin() {
+  if (!mailbox_) mailbox_ = xQueueCreate(1, sizeof(LatencySummary));
+}
+
+void LatencyTracker::arrived(const SampleTiming &timing, bool shown) {
+  if (!shown) {
+    summary_.unseen++;
+    return;
+  }
+  if (hasPending_) summary_.superseded++;
+  pending_ = timing;
+  hasPending_ = true;
+}
+
+void LatencyTracker::discard() {
+  if (!hasPending_) return;
+  hasPending_ = false;
+  summary_.unseen++;
+}
+
+void LatencyTracker::framePushed(int64_t startUs, int64_t doneUs) {
+  if (!hasPending_) return;
+  hasPending_ = false;
+
+  const SampleTiming &t = pending_;
+  const int64_t spans[LATENCY_STAGES] = {t.recvUs - t.sentUs,   t.parsedUs - t.recvUs,
+                                         startUs - t.parsedUs,  doneUs - startUs,
+                                         doneUs - t.recvUs,     doneUs - t.sentUs};
+  for (uint8_t s = 0; s < LATENCY_STAGES; ++s) {
+    // No host send time before the clock offset is known
+    if (!t.sentUs && (s == LATENCY_WIRE || s == LATENCY_TOTAL)) continue;
+    ring_[s][next_[s]] = clampUs(spans[s]);
+    next_[s] = (next_[s] + 1) % LATENCY_WINDOW;
+    if (count_[s] < LATENCY_WINDOW) count_[s]++;
+  }
+  summary_.drawn++;
+  publish();
+}
+
+void LatencyTracker::publish() {
+  uint32_t sorted[LATENCY_WINDOW];
+  for (uint8_t s = 0; s < LATENCY_STAGES; ++s) {
+    LatencyPercentiles &out = summary_.stages[s];
+    out.count = count_[s];
+    if (!out.count) continue;
+    std::copy(ring_[s], ring_[s] + out.count, sorted);
+    std::sort(sorted, sorted + out.count);
+    out.p50Us = percentile(sorted, out.count, 50);
+    out.p90Us = percentile(sorted, out.count, 90);
+    out.p99Us = percentile(sorted, out.count, 99);
+    out.maxUs = sorted[out.count - 1];
+  }
+  if (mailbox_) xQueueOverwrite(mailbox_, &summary_);
+}
+
+bool LatencyTracker::latest(LatencySummary &out) const {
+  return mailbox_ && xQueuePeek(mailbox_, &out, 0) == pdTRUE;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Feeder-sample-to-pixel latency.
+//
+// A feeder may end a CSV line with a timing trailer (feeder_gui.py does):
+//   <csv>;<seq>;<sendUs>[;<echoSeq>;<echoUs>]
+// seq numbers the lines and sendUs is the host's clock when the line was
+// written. The device answers every timed line with "ECHO <seq>" and the
+// host reports, on a later line, when it read that echo (echoSeq/echoUs).
+// Firmware that predates the trailer ignores it (toFloat stops at ';').
+//
+// FeederClock (I/O core) turns those exchanges into a host-to-device clock
+// offset, NTP style: each round trip gives an offset and a round-trip time,
+// and the offset of the quickest round trip in the last
+// LATENCY_OFFSET_WINDOW is used (a slow one was held up on one leg).
+// SampleTiming then travels with each sample through the sample queue, and
+// LatencyTracker (render core) stamps the first frame that shows it and
+// when that frame's push completed. Percentiles over the last
+// LATENCY_WINDOW samples are published for the I/O core through a one-slot
+// mailbox queue. All times are esp_timer_get_time() microseconds.
+
+constexpr uint8_t LATENCY_OFFSET_WINDOW = 16;  // echo round trips kept
+constexpr uint16_t LATENCY_WINDOW = 128;       // drawn samples kept
+
+struct FeederStamp {
+  uint32_t seq = 0;
+  int64_t sendUs = 0;    // host clock
+  bool hasEcho = false;
+  uint32_t echoSeq = 0;
+  int64_t echoUs = 0;    // host clock when ECHO <echoSeq> was read
+};
+
+// Parse the text after ';'. False if it isn't a timing trailer.
+bool parseFeederStamp(const char *text, FeederStamp &out);
+
+struct FeederClockStats {
+  bool synced = false;
+  uint32_t echoes = 0;    // round trips completed
+  int64_t offsetUs = 0;   // device minus host clock
+  uint32_t rttUs = 0;     // round trip behind offsetUs
+};
+
+class FeederClock {
+ public:
+  // The timed line `seq`, sent at host `sendUs`, arrived at `recvUs` and is
+  // being echoed now (`echoUs`, taken right before the write).
+  void echoSent(uint32_t seq, int64_t sendUs, int64_t recvUs, int64_t echoUs);
+  // The host read the echo of `seq` at its `hostUs`.
+  void echoReturned(uint32_t seq, int64_t hostUs);
+
+  bool synced() const { return count_ > 0; }
+  int64_t toDevice(int64_t hostUs) const { return hostUs + offsetUs_; }
+  FeederClockStats stats() const;
+
+ private:
+  struct RoundTrip {
+    int64_t offsetUs;
+    uint32_t rttUs;
+  };
+
+  // The echo awaiting its return
+  uint32_t seq_ = 0;
+  int64_t sendUs_ = 0, recvUs_ = 0, echoUs_ = 0;
+  bool pending_ = false;
+
+  RoundTrip trips_[LATENCY_OFFSET_WINDOW];
+  uint8_t next_ = 0, count_ = 0;
+  uint32_t echoes_ = 0;
+  int64_t offsetUs_ = 0;
+  uint32_t rttUs_ = 0;
+};
+
+extern FeederClock feederClock;
+
+// Per-sample stamps, filled in by the I/O core.
+struct SampleTiming {
+  uint32_t seq = 0;
+  int64_t sentUs = 0;    // host send, on the device clock; 0 until synced
+  int64_t recvUs = 0;    // chunk holding the line's end handed to ingest
+  int64_t parsedUs = 0;
+};
+
+// Intervals between the stamps, and the two end-to-end spans.
+enum LatencyStage : uint8_t {
+  LATENCY_WIRE,     // host send -> receive (needs the clock offset)
+  LATENCY_PARSE,    // receive -> parsed
+  LATENCY_QUEUE,    // parsed -> first frame showing it starts
+  LATENCY_DRAW,     // frame start -> push complete
+  LATENCY_DEVICE,   // receive -> push complete
+  LATENCY_TOTAL,    // host send -> push complete (needs the clock offset)
+  LATENCY_STAGES
+};
+
+constexpr const char *LATENCY_STAGE_NAMES[LATENCY_STAGES] = {"wire",   "parse",  "queue",
+                                                             "draw",   "device", "total"};
+
+struct LatencyPercentiles {
+  uint16_t count = 0;  // samples behind these
+  uint32_t p50Us = 0, p90Us = 0, p99Us = 0, maxUs = 0;
+};
+
+struct LatencySummary {
+  uint32_t drawn = 0;       // samples that reached the panel
+  uint32_t superseded = 0;  // replaced by a newer one before a frame showed them
+  uint32_t unseen = 0;      // arrived while no screen showed samples
+  LatencyPercentiles stages[LATENCY_STAGES];
+};
+
+class LatencyTracker {
+ public:
+  void begin();
+
+  // Render core: a sample was taken off the queue, and is shown (or not)
+  // by the next frame.
+  void arrived(const SampleTiming &timing, bool shown);
+  // Render core: a frame showing samples started at `startUs` and its push
+  // completed at `doneUs`.
+  void framePushed(int64_t startUs, int64_t doneUs);
+  // Render core: the current screen doesn't show samples.
+  void discard();
+  const LatencySummary &summary() const { return summary_; }
+
+  // Any core: the summary as of the last drawn sample.
+  bool latest(LatencySummary &out) const;
+
+ private:
+  void publish();
+
+  SampleTiming pending_;
+  bool hasPending_ = false;
+  uint32_t ring_[LATENCY_STAGES][LATENCY_WINDOW];
+  uint16_t count_[LATENCY_STAGES] = {0};
+  uint16_t next_[LATENCY_STAGES] = {0};
+  LatencySummary summary_;
+  QueueHandle_t mailbox_ = nullptr;
+};
+
+extern LatencyTracker latency;
@@ -3,8 +3,23 @@
 #include <WiFi.h>
 #include <WebServer.h>
 #include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <esp_timer.h>
 #include <math.h>
+#include <algorithm>
 #include "Free_Fonts.h"   // Bodmer free fonts
+#include "asset_bundle.h"
+#include "smooth_text.h"
+#include "http_guard.h"
+#include "latency.h"
+#include "pc_stats.h"
+#include "screens.h"
+#include "serial_recorder.h"
+#include "stats_feed.h"
+#include "static_files.h"
+#include "task_scheduler.h"
+#include "time_sync.h"
+#include "trace.h"
 #include "weather_integration.h"
 
 // M5Stack Core3 PC Monitor Dashboard + WiFi Web Server + Weather Mode
@@ -12,10 +27,46 @@
 // - Smooth bar animations + 60-sample sparkline
 // - Parses CSV from feeder GUI (USB serial) at 115200:
 //   cpu,mem,gpu,diskPct,diskMBps,cpuTempF,gpuTempF,freeC_GB,freeD_GB
+//   optionally followed by a timing trailer, answered with "ECHO <seq>"
+//   (see latency.h)
 // - WiFi server:
 //   GET /       -> live HTML dashboard (auto-refresh via JS)
 //   GET /metrics -> JSON {cpu, mem, gpu, diskPct, diskMBps, cpuTempF, gpuTempF, freeC, freeD}
 //   GET /ip     -> plain text IP
+//   GET /history -> binary float32 history of every field (chart seed)
+//   GET/POST /debug/serial -> raw feeder stream recording and its replay
+//                  (see serial_recorder.h)
+//   GET/POST /debug/trace -> Chrome trace JSON of both cores (see trace.h);
+//                  also written to Serial when the line TRACE arrives
+//   GET/POST /debug/latency -> feeder-to-pixel latency; overlay=0|1 shows
+//                  it on the bar screens
+//   GET /<file> -> static files from LittleFS (data/, see static_files.h);
+//                  data/index.html, if present, replaces the built-in page
+//   ws://<ip>:81/ws -> binary snapshot + per-sample deltas (see stats_feed.h)
+//   Requests are rate limited per client and by a per-frame time budget
+//   (see http_guard.h); rejected requests get 429 + Retry-After.
+//   POST /weather/config needs the CONFIG_TOKEN from secrets.h in an
+//   X-Config-Token header and is refused cross-origin.
+// - Two cores, each running its periodic work on a timer-wheel scheduler
+//   (task_scheduler.h) and sleeping until the next deadline:
+//     render (loop task, core 1): touch, screen composition, sprite push
+//     I/O (io task, core 0, next to WiFi): serial ingest, HTTP, WebSocket,
+//       weather, time and telemetry
+//   Samples, location swipes, weather snapshots and latency summaries
+//   cross through FreeRTOS queues. Apart from those, the cores share only
+//   these, read lock-free from the other core:
+//     latencyOverlay: written by HTTP (I/O), read by drawBar (render)
+//     render-side stats the I/O core reports in /metrics, the telemetry
+//       log and replay totals: renderScheduler task stats and idle share
+//       (ingestCounts() reads the render task's runs), the weather view's
+//       compose counters, assets.stats() and smoothText.stats()
+//     the trace ring, written by both cores (see trace.h)
+//   The rule that keeps this safe: each is a bool or an aligned 16/32-bit
+//   word with a single writer, so a read is one load, never torn, at worst
+//   one update stale. No reader may assume two such words agree (an
+//   average from decodeUs / misses can mix two updates); anything that
+//   must be consistent goes through a queue. gScreen is not shared:
+//   touch and renderFrame on the render core are its only users.
 
 // ---------------------- WiFi CONFIG ----------------------
 // Secrets can optionally define WIFI_SSID/WIFI_PASSWORD macros.
@@ -42,6 +93,13 @@ static const char kSecretWifiPass[] = WIFI_PASSWORD;
 
 const char *WIFI_SSID = PIO_WIFI_SSID;
 const char *WIFI_PASS = PIO_WIFI_PASS;
+
+// Token for changing settings over HTTP; empty (or a secrets.h without it)
+// turns remote changes off.
+#ifndef CONFIG_TOKEN
+#define CONFIG_TOKEN ""
+#endif
+const char CONFIG_TOKEN_HEADER[] = "X-Config-Token";
 // ---------------------------------------------------------
 
 // Full-screen sprite for flicker-free rendering (M5Unified)
@@ -49,31 +107,72 @@ LGFX_Sprite gfx(&M5.Display); // off-screen framebuffer (RGB565)
 
 // Touch swipe tracking
 int touchStartX = -1;
+int touchStartY = -1;
 bool touchActive = false;
 static const int SWIPE_THRESHOLD = 50;
 
 // Serial
 static const unsigned long BAUD = 115200;
-
-// Screen modes
-enum Mode { MODE_CPU = 0, MODE_GPU = 1, MODE_DISK = 2, MODE_WEATHER = 3 };
-volatile Mode gMode = MODE_CPU;
-
-// Latest stats from feeder
-struct Stats {
-  float cpu = 0, mem = 0, gpu = 0;
-  float diskPct = 0, diskMBps = 0;
-  float cpuTempF = -999, gpuTempF = -999;
-  float freeC = -1, freeD = -1;
-  float indoorTempF = -999;
-} cur;
-
-// History buffers for sparkline (60 samples)
-static const int HIST_N = 60;
-float histCPU[HIST_N] = {0};
-float histGPU[HIST_N] = {0};
-float histDISK[HIST_N] = {0};
-int histIdx = 0;
+static const char *const SERIAL_TRACE_COMMAND = "TRACE";  // line that dumps the trace
+
+// Periodic work (render pacing comes from SCREENS)
+static const uint32_t UI_POLL_MS = 5;          // render core: touch, new samples
+static const uint32_t IO_POLL_MS = 5;          // I/O core: serial, HTTP, WebSocket
+static const uint32_t REPLAY_POLL_MS = 1;      // serial replay running
+static const uint32_t REPLAY_IDLE_MS = 1000;   // nothing to replay
+static const uint32_t REPLAY_SLICE_US = 4000;  // max-speed replay, per run
+static const uint32_t TRACE_DUMP_POLL_MS = 2;  // serial trace dump running
+static const uint32_t TRACE_DUMP_IDLE_MS = 1000;
+static const uint32_t TRACE_DUMP_LINES = 16;   // serial trace dump, per run
+static const int TRACE_LINE_BYTES = 128;       // longest trace JSON line
+static const uint32_t WEATHER_POLL_MS = 100;   // land / start background fetches
+static const uint32_t TIME_CHECK_MS = 60000;   // SNTP health
+static const uint32_t TELEMETRY_LOG_MS = 30000;
+
+// I/O task; the render side is the Arduino loop task on the other core.
+// Above the weather fetch task so a TLS handshake never delays ingest.
+static const BaseType_t IO_CORE = 0;
+static const uint32_t IO_TASK_STACK = 8 * 1024;
+static const UBaseType_t IO_TASK_PRIORITY = 2;
+static const UBaseType_t SAMPLE_QUEUE_DEPTH = 4;
+
+// Current screen (ScreenId, rows in SCREENS below); render core only
+volatile uint8_t gScreen = SCREEN_CPU;
+volatile bool latencyOverlay = false;  // set from HTTP, drawn by drawBar
+int8_t renderTask = SCHED_NO_TASK;
+
+// I/O core: latest sample from the feeder and the dashboard history
+Stats cur;
+StatsHistory hist;
+uint32_t samplesIn = 0;       // CSV lines parsed
+uint32_t samplesDropped = 0;  // replaced in sampleQueue before the render core took them
+int8_t replayTask = SCHED_NO_TASK;
+int8_t traceDumpTask = SCHED_NO_TASK;
+TraceDump serialTraceDump(trace);  // started by the TRACE line
+
+// Ingest totals when the current serial replay started, and what the last
+// one added to them
+struct ReplayCounts {
+  uint32_t samples = 0;
+  uint32_t dropped = 0;
+  uint32_t frames = 0;
+};
+ReplayCounts replayStart;
+ReplayCounts replayTotals;
+
+// What crosses sampleQueue: the sample and its latency stamps so far
+struct QueuedSample {
+  Stats stats;
+  SampleTiming timing;
+};
+
+// Render core: its own copy, fed through sampleQueue
+Stats shown;
+StatsHistory shownHist;
+QueueHandle_t sampleQueue = nullptr;
+TaskHandle_t loopTask = nullptr;
+TaskHandle_t ioTask = nullptr;
+int renderCore = 1;
 
 // Bar animation
 float barTarget = 0.0f; // 0..100
@@ -92,19 +191,24 @@ uint16_t accent = TFT_CYAN;
 
 // Web server
 WebServer server(80);
+HttpGuard httpGuard;
+StaticFiles staticFiles(server);
 String ipText = "WiFi...";
 
 // Forward decl
-void setBarTargetFromMode();
-void render();
-
-// ------------------- Mode navigation -------------------
-void nextMode() {
-  gMode = (Mode)((gMode + 1) % 4);  // 4 modes now
+void setBarTargetFromScreen();
+bool startReplay(ReplaySpeed speed);
+void startTraceDump();
+
+// ------------------- Screen navigation -------------------
+void nextScreen() {
+  gScreen = (gScreen + 1) % SCREEN_COUNT;
+  renderScheduler.wake(renderTask);
 }
 
-void prevMode() {
-  gMode = (Mode)((gMode + 3) % 4);  // (mode - 1 + 4) % 4
+void prevScreen() {
+  gScreen = (gScreen + SCREEN_COUNT - 1) % SCREEN_COUNT;
+  renderScheduler.wake(renderTask);
 }
 
 // ------------------- Touch swipe handling -------------------
@@ -114,20 +218,27 @@ void handleTouch() {
 
   if (touch.wasPressed()) {
     touchStartX = touch.x;
+    touchStartY = touch.y;
     touchActive = true;
   }
 
   if (touch.wasReleased() && touchActive) {
     int deltaX = touch.x - touchStartX;
-    if (deltaX > SWIPE_THRESHOLD) {
-      prevMode();  // Swipe right = previous mode
-      setBarTargetFromMode();
+    int deltaY = touch.y - touchStartY;
+    if (gScreen == SCREEN_WEATHER && abs(deltaY) > SWIPE_THRESHOLD && abs(deltaY) > abs(deltaX)) {
+      weatherSelectLocation(deltaY < 0 ? 1 : -1);  // Swipe up/down = next/prev location
+    } else if (deltaX > SWIPE_THRESHOLD) {
+      prevScreen();  // Swipe right = previous screen
+      setBarTargetFromScreen();
     } else if (deltaX < -SWIPE_THRESHOLD) {
-      nextMode();  // Swipe left = next mode
-      setBarTargetFromMode();
+      nextScreen();  // Swipe left = next screen
+      setBarTargetFromScreen();
+    } else if (gScreen == SCREEN_WEATHER) {
+      display.nextView();  // Tap = now / hourly / 5-day
     }
     touchActive = false;
     touchStartX = -1;
+    touchStartY = -1;
   }
 }
 
@@ -144,12 +255,13 @@ void animateBar() {
 }
 
 // ------------------- Sparkline -------------------
-void drawSparkline(int x, int y, int w, int h, const float *hist) {
+void drawSparkline(int x, int y, int w, int h, const StatsHistory &history, StatsField field) {
+  const float *series = history.values[field];
   gfx.fillRect(x, y, w, h, bg);
 
   float mn = 1e9, mx = -1e9;
   for (int i = 0; i < HIST_N; ++i) {
-    float v = hist[i];
+    float v = series[i];
     if (v < mn) mn = v;
     if (v > mx) mx = v;
   }
@@ -157,8 +269,8 @@ void drawSparkline(int x, int y, int w, int h, const float *hist) {
 
   int px = x, py = y + h - 1;
   for (int i = 0; i < HIST_N; ++i) {
-    int idx = (histIdx + i) % HIST_N;
-    float v = hist[idx];
+    int idx = (history.idx + i) % HIST_N;
+    float v = series[idx];
     float norm = (v - mn) / (mx - mn);  // 0..1
     int yy = y + h - 1 - int(norm * (h - 1));
     int xx = x + (i * (w - 1)) / (HIST_N - 1);
@@ -197,15 +309,80 @@ String fmtGB(float v) {
   return String(b);
 }
 
+// ------------------- Screen registry -------------------
+// Everything a screen needs, one row per screen in swipe order: adding a
+// screen is an enum value plus a row here. Bar screens take their bar value
+// and sparkline from `value`; `draw` renders one frame into the sprite.
+struct Screen;
+typedef void (*ScreenDrawFn)(const Screen &screen);
+
+struct Screen {
+  ScreenId id;
+  StatsField value;         // bar target + history buffer; STAT_COUNT for none
+  String (*title)();        // title line
+  String (*format)(float);  // large value text
+  uint8_t activeHz;         // frame rate while animating / new data
+  uint8_t idleHz;           // frame rate once nothing on screen moves
+  ScreenDrawFn draw;
+};
+
+String cpuTitle() {
+  return "CPU " + fmtPct(shown.cpu) + " | MEM " + fmtPct(shown.mem) + " " +
+         fmtTempF(shown.cpuTempF);
+}
+
+String gpuTitle() { return "GPU " + fmtPct(shown.gpu) + " | " + fmtTempF(shown.gpuTempF); }
+
+String diskTitle() {
+  return "DISK " + fmtPct(shown.diskPct) + " | " + fmtMBps(shown.diskMBps) + " | C:" +
+         fmtGB(shown.freeC) + " D:" + fmtGB(shown.freeD);
+}
+
+void drawBar(const Screen &screen);
+void drawWeather(const Screen &) { weatherStep(); }
+
+constexpr Screen SCREENS[SCREEN_COUNT] = {
+    {SCREEN_CPU, STAT_CPU, cpuTitle, fmtPct, 30, 1, drawBar},
+    {SCREEN_GPU, STAT_GPU, gpuTitle, fmtPct, 30, 1, drawBar},
+    {SCREEN_DISK, STAT_DISK_PCT, diskTitle, fmtPct, 30, 1, drawBar},
+    {SCREEN_WEATHER, STAT_COUNT, nullptr, nullptr, 40, 40, drawWeather},
+};
+
+constexpr bool screensInOrder(uint8_t i) {
+  return i == SCREEN_COUNT || (SCREENS[i].id == i && screensInOrder(i + 1));
+}
+static_assert(screensInOrder(0), "SCREENS rows must follow ScreenId order");
+
 // ------------------- Draw a frame into the sprite -------------------
-void drawBar(const char *title, float valuePct, const char *valueText) {
+// Feeder-to-pixel latency over the last LATENCY_WINDOW samples: from the
+// host's send time once the clock offset is known, from receipt until then.
+void drawLatencyOverlay(int x, int y) {
+  const LatencySummary &s = latency.summary();
+  const bool endToEnd = s.stages[LATENCY_TOTAL].count > 0;
+  const LatencyPercentiles &p = s.stages[endToEnd ? LATENCY_TOTAL : LATENCY_DEVICE];
+  char text[64];
+  if (p.count) {
+    snprintf(text, sizeof(text), "%s p50 %.1f  p99 %.1f  max %.1f ms",
+             endToEnd ? "latency" : "on device", p.p50Us / 1000.0f, p.p99Us / 1000.0f,
+             p.maxUs / 1000.0f);
+  } else {
+    strlcpy(text, "latency: no samples yet", sizeof(text));
+  }
+  gfx.setFreeFont(&FreeSans9pt7b);
+  gfx.setTextDatum(TL_DATUM);
+  gfx.setTextColor(fg, bg);
+  gfx.drawString(text, x, y);
+}
+
+void drawBar(const Screen &screen) {
+  animateBar();
   gfx.fillSprite(bg);
 
   // Title
   gfx.setTextColor(fg, bg);
   gfx.setTextDatum(TL_DATUM);
   gfx.setFreeFont(&FreeSansBold12pt7b);
-  gfx.drawString(title, 10, 8);
+  gfx.drawString(screen.title(), 10, 8);
 
   // IP status (bottom-left)
   gfx.setFreeFont(&FreeSans12pt7b);
@@ -219,14 +396,14 @@ void drawBar(const char *title, float valuePct, const char *valueText) {
   int barH = 36;
 
   gfx.drawRect(barX, barY, barW, barH, fg);
-  int fillW = int((valuePct / 100.0f) * (barW - 2));
+  int fillW = int((barValue / 100.0f) * (barW - 2));
   if (fillW < 0) fillW = 0;
   gfx.fillRect(barX + 1, barY + 1, fillW, barH - 2, accent);
 
-  // Large value
-  gfx.setFreeFont(&FreeSansBold18pt7b);
-  gfx.setTextDatum(TR_DATUM);
-  gfx.drawString(valueText, W - 10, 8);
+  // Large value (anti-aliased)
+  String valueText = screen.format(shown.*(STATS_FIELDS[screen.value].member));
+  int16_t valueW = smoothText.textWidth(ASSET_FONT_MIDLE, valueText.c_str());
+  smoothText.draw(gfx, ASSET_FONT_MIDLE, valueText.c_str(), W - 10 - valueW, 8, fg, bg);
 
   // Sparkline
   int spX = 10;
@@ -234,37 +411,24 @@ void drawBar(const char *title, float valuePct, const char *valueText) {
   int spY = barY + barH + 10;
   int spH = 40;
 
-  const float *hist =
-      (gMode == MODE_CPU) ? histCPU :
-      (gMode == MODE_GPU) ? histGPU :
-      histDISK;
+  drawSparkline(spX, spY, spW, spH, shownHist, screen.value);
 
-  drawSparkline(spX, spY, spW, spH, hist);
+  if (latencyOverlay) drawLatencyOverlay(spX, spY + spH + 8);
 
   // Push the entire sprite once (flicker-free)
+  TraceScope span("push");
   gfx.pushSprite(0, 0);
 }
 
-void render() {
-  if (gMode == MODE_CPU) {
-    String title = "CPU " + fmtPct(cur.cpu) + " | MEM " + fmtPct(cur.mem) +
-                   " " + fmtTempF(cur.cpuTempF);
-    drawBar(title.c_str(), barValue, fmtPct(cur.cpu).c_str());
-  } else if (gMode == MODE_GPU) {
-    String title = "GPU " + fmtPct(cur.gpu) + " | " + fmtTempF(cur.gpuTempF);
-    drawBar(title.c_str(), barValue, fmtPct(cur.gpu).c_str());
-  } else { // MODE_DISK
-    String title = "DISK " + fmtPct(cur.diskPct) + " | " + fmtMBps(cur.diskMBps) +
-                   " | C:" + fmtGB(cur.freeC) + " D:" + fmtGB(cur.freeD);
-    drawBar(title.c_str(), barValue, fmtPct(cur.diskPct).c_str());
-  }
+// Bar screens drop to idleHz once the bar has settled; a new sample or a
+// screen change wakes the render task.
+bool screenIdle(const Screen &screen) {
+  return screen.value == STAT_COUNT || fabsf(barTarget - barValue) < 0.05f;
 }
 
-void setBarTargetFromMode() {
-  if (gMode == MODE_CPU)      barTarget = cur.cpu;
-  else if (gMode == MODE_GPU) barTarget = cur.gpu;
-  else if (gMode == MODE_DISK) barTarget = cur.diskPct;
-  else barTarget = 0; // MODE_WEATHER does not use bar graph
+void setBarTargetFromScreen() {
+  const Screen &screen = SCREENS[gScreen];
+  barTarget = screen.value < STAT_COUNT ? shown.*(STATS_FIELDS[screen.value].member) : 0;
 
   if (barTarget < 0)   barTarget = 0;
   if (barTarget > 100) barTarget = 100;
@@ -273,11 +437,14 @@ void setBarTargetFromMode() {
 // ------------------- CSV parser -------------------
 String serialBuf;
 
+// The CSV fields, up to a timing trailer (';') if there is one.
 bool parseCSVLine(const String &line) {
   float vals[16] = {0};
   int idx = 0, start = 0;
-  for (int i = 0; i <= line.length(); ++i) {
-    if (i == line.length() || line[i] == ',') {
+  int end = line.indexOf(';');
+  if (end < 0) end = line.length();
+  for (int i = 0; i <= end; ++i) {
+    if (i == end || line[i] == ',') {
       if (idx < 16) {
         vals[idx] = line.substring(start, i).toFloat();
       }
@@ -337,6 +504,9 @@ const char *PAGE_INDEX = R"HTML(
     .forecast-day { font-weight:600; margin-bottom:0.2rem; }
     .forecast-temp { font-size:1.2rem; }
     .forecast-desc { font-size:0.85rem; color:#bbb; margin-top:0.2rem; }
+    .charts { display:grid; grid-template-columns:repeat(auto-fill, minmax(280px, 1fr)); gap:1rem; margin-top:1.5rem; }
+    .chart { background:#1c1c1c; border-radius:0.8rem; padding:0.6rem 0.8rem; }
+    .chart canvas { display:block; width:100%; height:70px; margin-top:0.3rem; }
     @media (max-width:640px) {
       .weather-current { flex-direction:column; align-items:flex-start; }
       .card { min-width:125px; }
@@ -394,38 +564,185 @@ const char *PAGE_INDEX = R"HTML(
         const dt = new Date((weather.updated + offset) * 1000);
         updatedText = dt.toLocaleTimeString([], { hour: 'numeric', minute: '2-digit' });
       }
-      const status = weather.ok ? 'Updated' : 'Offline';
+      const status = weather.cached ? 'Cached' : (weather.ok ? 'Updated' : 'Offline');
       setText('weatherExtra', `${status} @ ${updatedText}`);
-      const slots = [null, null, null];
+      const slots = [null, null, null, null, null];
       if (Array.isArray(forecast)) {
         forecast.forEach(item => {
           if (!item) return;
           const slot = (typeof item.slot === 'number') ? item.slot : forecast.indexOf(item);
-          if (slot >= 0 && slot < 3) {
+          if (slot >= 0 && slot < slots.length) {
             slots[slot] = item.valid ? item : null;
           }
         });
       }
-      for (let i = 0; i < 3; i++) {
+      for (let i = 0; i < slots.length; i++) {
         const data = slots[i];
         setText(`forecast${i}Day`, data?.label || '--');
         setText(`forecast${i}Hi`, formatTemp(data?.high));
         setText(`forecast${i}Lo`, formatTemp(data?.low));
-        setText(`forecast${i}Desc`, data?.description || '--');
+        const rain = data && data.pop ? ` (${data.pop}% rain)` : '';
+        setText(`forecast${i}Desc`, data ? `${data.description || '--'}${rain}` : '--');
+      }
+    }
+    // Field order and precision must match STATS_FIELDS in pc_stats.h.
+    const FIELDS = [
+      ['cpu', 1, 'CPU %'], ['mem', 1, 'MEM %'], ['gpu', 1, 'GPU %'],
+      ['diskPct', 1, 'Disk %'], ['diskMBps', 2, 'Disk MB/s'],
+      ['cpuTempF', 1, 'CPU &deg;F'], ['gpuTempF', 1, 'GPU &deg;F'],
+      ['freeC', 0, 'Free C (GB)'], ['freeD', 0, 'Free D (GB)'],
+      ['indoorTempF', 1, 'Indoor &deg;F']
+    ];
+    const latest = {};
+    let socket = null;
+
+    // Chart history: one fixed ring of float samples per field, drawn at
+    // most once per animation frame.
+    const CHART_POINTS = 600;
+    const series = FIELDS.map(() => ({ buf: new Float32Array(CHART_POINTS), len: 0, head: 0 }));
+    const charts = [];
+    let chartsDirty = false;
+    function pushSample(i, v) {
+      const s = series[i];
+      s.buf[s.head] = (v === null || v === undefined) ? NaN : v;
+      s.head = (s.head + 1) % CHART_POINTS;
+      if (s.len < CHART_POINTS) s.len++;
+      chartsDirty = true;
+    }
+    function pushLatest() {
+      FIELDS.forEach(([key], i) => pushSample(i, latest[key]));
+    }
+    function buildCharts() {
+      const host = document.getElementById('charts');
+      FIELDS.forEach(([, , label]) => {
+        const card = document.createElement('div');
+        card.className = 'chart';
+        card.innerHTML = `<div class="label">${label}</div>`;
+        const canvas = document.createElement('canvas');
+        card.appendChild(canvas);
+        host.appendChild(card);
+        charts.push({ canvas, ctx: canvas.getContext('2d') });
+      });
+    }
+    function drawChart(chart, s) {
+      const { canvas, ctx } = chart;
+      const dpr = window.devicePixelRatio || 1;
+      const w = Math.round(canvas.clientWidth * dpr);
+      const h = Math.round(canvas.clientHeight * dpr);
+      if (canvas.width !== w || canvas.height !== h) { canvas.width = w; canvas.height = h; }
+      ctx.clearRect(0, 0, w, h);
+      if (s.len < 2) return;
+      const start = (s.head - s.len + CHART_POINTS) % CHART_POINTS;
+      let mn = Infinity, mx = -Infinity;
+      for (let i = 0; i < s.len; i++) {
+        const v = s.buf[(start + i) % CHART_POINTS];
+        if (v < mn) mn = v;
+        if (v > mx) mx = v;
+      }
+      if (mn === Infinity) return;
+      if (mx - mn < 1) mx = mn + 1;
+      const sx = (w - 1) / (CHART_POINTS - 1);
+      const sy = (h - 2) / (mx - mn);
+      const x0 = (CHART_POINTS - s.len) * sx;
+      ctx.strokeStyle = '#0ff';
+      ctx.lineWidth = dpr;
+      ctx.beginPath();
+      let pen = false;
+      for (let i = 0; i < s.len; i++) {
+        const v = s.buf[(start + i) % CHART_POINTS];
+        if (v !== v) { pen = false; continue; }
+        const x = x0 + i * sx;
+        const y = h - 1 - (v - mn) * sy;
+        if (pen) ctx.lineTo(x, y); else ctx.moveTo(x, y);
+        pen = true;
+      }
+      ctx.stroke();
+    }
+    function animate() {
+      if (chartsDirty) {
+        chartsDirty = false;
+        charts.forEach((chart, i) => drawChart(chart, series[i]));
       }
+      requestAnimationFrame(animate);
     }
-    async function refresh() {
+    // Seed the charts from the device ring (see handleHistory in main.cpp).
+    async function loadHistory() {
+      try {
+        const buf = await (await fetch('/history')).arrayBuffer();
+        const dv = new DataView(buf);
+        if (dv.byteLength < 4 || dv.getUint8(0) !== 1) return;
+        const fields = Math.min(dv.getUint8(1), FIELDS.length);
+        const count = dv.getUint16(2, true);
+        const stride = count * 4;
+        for (let f = 0; f < fields; f++) {
+          for (let i = 0; i < count; i++) {
+            pushSample(f, dv.getFloat32(4 + f * stride + i * 4, true));
+          }
+        }
+      } catch (err) {
+        console.error(err);
+      }
+    }
+
+    function decodeFrame(buffer) {
+      const b = new Uint8Array(buffer);
+      if (b.length < 3) return;
+      const mask = b[1] | (b[2] << 8);
+      let p = 3;
+      for (let i = 0; i < FIELDS.length; i++) {
+        if (!(mask & (1 << i))) continue;
+        let v = 0, scale = 1, byte;
+        do {
+          byte = b[p++];
+          v += (byte & 0x7f) * scale;
+          scale *= 128;
+        } while (byte & 0x80);
+        const [key, decimals] = FIELDS[i];
+        if (v === 0) { latest[key] = null; continue; }
+        const z = v - 1;
+        const fixed = (z % 2) ? -(z + 1) / 2 : z / 2;
+        latest[key] = fixed / Math.pow(10, decimals);
+      }
+      applyStats(latest);
+      if (b[0] === 2) pushLatest();   // snapshots repeat the last sample
+    }
+    function connectFeed() {
+      socket = new WebSocket(`ws://${location.hostname}:81/ws`);
+      socket.binaryType = 'arraybuffer';
+      socket.onmessage = ev => decodeFrame(ev.data);
+      socket.onclose = () => { socket = null; setTimeout(connectFeed, 2000); };
+    }
+    function feedLive() {
+      return socket && socket.readyState === WebSocket.OPEN;
+    }
+    async function refresh(includeStats) {
       try {
         const response = await fetch('/metrics');
         const json = await response.json();
-        applyStats(json);
+        if (includeStats) {
+          applyStats(json);
+          FIELDS.forEach(([key]) => { latest[key] = json[key]; });
+          pushLatest();
+        }
         applyWeather(json.weather, json.forecast);
       } catch (err) {
         console.error(err);
       }
     }
-    setInterval(refresh, 2000);
-    window.onload = refresh;
+    // Stats arrive over the WebSocket; /metrics is polled only for weather,
+    // or for everything while the socket is down.
+    let ticks = 0;
+    setInterval(() => {
+      ticks++;
+      if (!feedLive()) refresh(true);
+      else if (ticks % 15 === 0) refresh(false);
+    }, 2000);
+    window.onload = () => {
+      buildCharts();
+      requestAnimationFrame(animate);
+      refresh(false);
+      loadHistory().then(connectFeed);
+    };
   </script>
 </head>
 <body>
@@ -442,6 +759,7 @@ const char *PAGE_INDEX = R"HTML(
       <div class="card"><div class="label">Free C (GB)</div><div id="freeC" class="value">-</div></div>
       <div class="card"><div class="label">Free D (GB)</div><div id="freeD" class="value">-</div></div>
     </div>
+    <section class="charts" id="charts"></section>
     <section class="weather-section">
       <div class="weather-header">
         <h2>Weather</h2>
@@ -471,6 +789,16 @@ const char *PAGE_INDEX = R"HTML(
           <div class="forecast-temp"><span id="forecast2Hi">--</span> / <span id="forecast2Lo">--</span></div>
           <div class="forecast-desc" id="forecast2Desc">--</div>
         </div>
+        <div class="forecast-card">
+          <div class="forecast-day" id="forecast3Day">--</div>
+          <div class="forecast-temp"><span id="forecast3Hi">--</span> / <span id="forecast3Lo">--</span></div>
+          <div class="forecast-desc" id="forecast3Desc">--</div>
+        </div>
+        <div class="forecast-card">
+          <div class="forecast-day" id="forecast4Day">--</div>
+          <div class="forecast-temp"><span id="forecast4Hi">--</span> / <span id="forecast4Lo">--</span></div>
+          <div class="forecast-desc" id="forecast4Desc">--</div>
+        </div>
       </div>
     </section>
   </main>
@@ -478,15 +806,310 @@ const char *PAGE_INDEX = R"HTML(
 </html>
 )HTML";
 
+// Returns true if the request may proceed; otherwise a 429 has been sent.
+bool admitRequest() {
+  uint32_t ip = server.client().remoteIP();
+  if (httpGuard.admit(ip, millis())) return true;
+  server.sendHeader("Retry-After", String(httpGuard.retryAfterSec()));
+  server.send(429, "text/plain", "Too Many Requests\n");
+  return false;
+}
+
 void handleIndex() {
+  if (!admitRequest()) return;
+  if (staticFiles.handle()) return;
   server.send(200, "text/html", PAGE_INDEX);
 }
 
+void handleNotFound() {
+  if (!admitRequest()) return;
+  if (staticFiles.handle()) return;
+  server.send(404, "text/plain", "Not found\n");
+}
+
 void handleIP() {
+  if (!admitRequest()) return;
   server.send(200, "text/plain", ipText);
 }
 
+// Binary history for seeding the dashboard charts, oldest sample first:
+//   u8 version (1), u8 fieldCount, u16 sampleCount (LE)
+//   then fieldCount runs of sampleCount float32 (LE), StatsField order;
+//   invalid readings (see STATS_FIELDS) are sent as NaN.
+void handleHistory() {
+  if (!admitRequest()) return;
+  const uint16_t count = hist.count;
+  const int first = (hist.count < HIST_N) ? 0 : hist.idx;
+  uint8_t header[4] = {1, STAT_COUNT, (uint8_t)(count & 0xFF), (uint8_t)(count >> 8)};
+
+  server.setContentLength(sizeof(header) + (size_t)STAT_COUNT * count * sizeof(float));
+  server.sendHeader("Cache-Control", "no-store");
+  server.send(200, "application/octet-stream", "");
+  server.sendContent((const char *)header, sizeof(header));
+
+  float run[HIST_N];
+  for (int f = 0; f < STAT_COUNT; ++f) {
+    for (int i = 0; i < count; ++i) {
+      float v = hist.values[f][(first + i) % HIST_N];
+      run[i] = (isnan(v) || v < STATS_FIELDS[f].invalidBelow) ? NAN : v;
+    }
+    server.sendContent((const char *)run, count * sizeof(float));
+  }
+}
+
+void addSerialTelemetry(JsonObject out) {
+  const SerialRecorderStats &st = serialRecorder.stats();
+  out["samples"] = samplesIn;
+  out["samplesDropped"] = samplesDropped;
+  out["recording"] = !serialRecorder.paused() && !serialRecorder.replaying();
+  out["records"] = st.records;
+  out["bytes"] = st.bytes;
+  out["spanMs"] = st.spanMs;
+  out["droppedRecords"] = st.dropped;
+  JsonObject replay = out["replay"].to<JsonObject>();
+  replay["active"] = serialRecorder.replaying();
+  replay["speed"] = serialRecorder.replaySpeed() == REPLAY_MAX ? "max" : "1x";
+  replay["runs"] = st.replays;
+  replay["records"] = st.replayRecords;
+  replay["bytes"] = st.replayBytes;
+  replay["ms"] = st.replayUs / 1000;
+  replay["samples"] = replayTotals.samples;
+  replay["samplesPerSec"] = st.replayUs ? replayTotals.samples * 1000000ULL / st.replayUs : 0;
+  replay["frames"] = replayTotals.frames;
+  replay["samplesDropped"] = replayTotals.dropped;
+  replay["lagUs"] = st.replayLagUs;
+}
+
+// Serial recorder (serial_recorder.h). GET downloads the recording. POST
+// with any of record=0|1, stop, clear, load / save (SERIAL_RECORDING_PATH
+// on LittleFS) and replay=1x|max, applied in that order, answers with the
+// recorder state (409 if a load, save or replay failed).
+void handleSerialRecorder() {
+  if (!admitRequest()) return;
+  if (server.method() != HTTP_POST) {
+    const size_t total = serialRecorder.dumpSize();
+    server.setContentLength(total);
+    server.sendHeader("Cache-Control", "no-store");
+    server.sendHeader("Content-Disposition", "attachment; filename=serial.rec");
+    server.send(200, "application/octet-stream", "");
+    uint8_t buf[1024];
+    for (size_t offset = 0; offset < total;) {
+      size_t n = serialRecorder.readDump(offset, buf, sizeof(buf));
+      server.sendContent((const char *)buf, n);
+      offset += n;
+    }
+    return;
+  }
+
+  bool ok = true;
+  if (server.hasArg("record")) serialRecorder.setPaused(server.arg("record") == "0");
+  if (server.hasArg("stop")) serialRecorder.stopReplay();
+  if (server.hasArg("clear")) serialRecorder.clear();
+  if (server.hasArg("load")) ok = serialRecorder.load(LittleFS, SERIAL_RECORDING_PATH) && ok;
+  if (server.hasArg("save")) ok = serialRecorder.save(LittleFS, SERIAL_RECORDING_PATH) && ok;
+  if (server.hasArg("replay")) {
+    ok = startReplay(server.arg("replay") == "max" ? REPLAY_MAX : REPLAY_RECORDED) && ok;
+  }
+
+  JsonDocument doc;
+  addSerialTelemetry(doc.to<JsonObject>());
+  String out;
+  serializeJson(doc, out);
+  server.send(ok ? 200 : 409, "application/json", out);
+}
+
+void addLatencyTelemetry(JsonObject out) {
+  LatencySummary ls;
+  latency.latest(ls);
+  out["overlay"] = latencyOverlay;
+  out["drawn"] = ls.drawn;
+  out["superseded"] = ls.superseded;
+  out["unseen"] = ls.unseen;
+  for (uint8_t s = 0; s < LATENCY_STAGES; ++s) {
+    const LatencyPercentiles &p = ls.stages[s];
+    JsonObject stage = out[LATENCY_STAGE_NAMES[s]].to<JsonObject>();
+    stage["samples"] = p.count;
+    stage["p50Us"] = p.p50Us;
+    stage["p90Us"] = p.p90Us;
+    stage["p99Us"] = p.p99Us;
+    stage["maxUs"] = p.maxUs;
+  }
+  const FeederClockStats cs = feederClock.stats();
+  JsonObject clock = out["clock"].to<JsonObject>();
+  clock["synced"] = cs.synced;
+  clock["echoes"] = cs.echoes;
+  clock["offsetUs"] = cs.offsetUs;
+  clock["rttUs"] = cs.rttUs;
+}
+
+// Feeder-to-pixel latency (latency.h). GET shows it; POST overlay=0|1
+// toggles the on-screen line on the bar screens.
+void handleLatency() {
+  if (!admitRequest()) return;
+  // The render core picks the flag up on its next frame (1 Hz when idle)
+  if (server.method() == HTTP_POST && server.hasArg("overlay")) {
+    latencyOverlay = server.arg("overlay") != "0";
+  }
+  JsonDocument doc;
+  addLatencyTelemetry(doc.to<JsonObject>());
+  String out;
+  serializeJson(doc, out);
+  server.send(200, "application/json", out);
+}
+
+void addTraceTelemetry(JsonObject out) {
+  const TraceStats ts = trace.stats();
+  out["enabled"] = trace.enabled();
+  out["recorded"] = ts.recorded;
+  out["capacity"] = ts.capacity;
+  out["spanNs"] = ts.spanNs;
+}
+
+// Buffers a streamed (chunked) response into sendContent() calls.
+class ResponseWriter : public Print {
+ public:
+  size_t write(uint8_t c) override {
+    if (len_ == sizeof(buf_)) drain();
+    buf_[len_++] = c;
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t len) override {
+    for (size_t i = 0; i < len; ++i) write(data[i]);
+    return len;
+  }
+  void drain() {
+    if (len_) server.sendContent((const char *)buf_, len_);
+    len_ = 0;
+  }
+
+ private:
+  uint8_t buf_[1024];
+  size_t len_ = 0;
+};
+
+// Event trace (trace.h). GET downloads it as Chrome trace JSON. POST with
+// enable=0|1 and/or clear answers with the trace state.
+void handleTrace() {
+  if (!admitRequest()) return;
+  if (server.method() != HTTP_POST) {
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.sendHeader("Cache-Control", "no-store");
+    server.sendHeader("Content-Disposition", "attachment; filename=trace.json");
+    server.send(200, "application/json", "");
+    // All in this request: pollIo() charges the time to httpGuard, which
+    // then holds off other requests until the budget is paid back
+    ResponseWriter out;
+    trace.writeJson(out);
+    out.drain();
+    server.sendContent("");
+    return;
+  }
+
+  if (server.hasArg("enable")) trace.setEnabled(server.arg("enable") != "0");
+  if (server.hasArg("clear")) trace.clear();
+
+  JsonDocument doc;
+  addTraceTelemetry(doc.to<JsonObject>());
+  String out;
+  serializeJson(doc, out);
+  server.send(200, "application/json", out);
+}
+
+// Requests that change settings: only with the token, and only from the
+// device's own origin. Browsers send Origin with every cross-site POST, and
+// a plain form can't set the token header at all.
+bool authorizeChange() {
+  const String origin = server.header("Origin");
+  if (origin.length() && origin != "http://" + server.header("Host")) {
+    server.send(403, "text/plain", "Cross-origin request refused\n");
+    return false;
+  }
+  static const char kToken[] = CONFIG_TOKEN;
+  if (!kToken[0]) {
+    server.send(403, "text/plain", "Remote changes are off: set CONFIG_TOKEN in secrets.h\n");
+    return false;
+  }
+  // Compare every byte, so the time taken doesn't reveal a matching prefix
+  const String given = server.header(CONFIG_TOKEN_HEADER);
+  uint8_t diff = given.length() != sizeof(kToken) - 1;
+  for (size_t i = 0; i < sizeof(kToken) - 1; ++i) {
+    diff |= (uint8_t)kToken[i] ^ (uint8_t)(i < given.length() ? given[i] : 0);
+  }
+  if (diff) {
+    server.send(401, "text/plain", "Missing or wrong X-Config-Token\n");
+    return false;
+  }
+  return true;
+}
+
+// Weather API settings. GET shows them (the key only as set/unset); POST
+// with any of currentUrl, forecastUrl, apiKey, city, units updates those
+// fields (an empty value restores the secrets.h default) and refetches.
+// See authorizeChange() and weatherApiConfigError() for what a POST needs.
+void handleWeatherConfig() {
+  if (!admitRequest()) return;
+  if (server.method() == HTTP_POST) {
+    if (!authorizeChange()) return;
+    const WeatherApiConfig defaults;
+    WeatherApiConfig config = weatherApiConfig();
+    struct { const char *arg; String WeatherApiConfig::*field; } const fields[] = {
+        {"currentUrl", &WeatherApiConfig::currentUrl},
+        {"forecastUrl", &WeatherApiConfig::forecastUrl},
+        {"apiKey", &WeatherApiConfig::apiKey},
+        {"city", &WeatherApiConfig::city},
+        {"units", &WeatherApiConfig::units},
+    };
+    for (const auto &f : fields) {
+      if (!server.hasArg(f.arg)) continue;
+      String value = server.arg(f.arg);
+      value.trim();
+      config.*f.field = value.length() ? value : defaults.*f.field;
+    }
+    const char *error = weatherApiConfigError(weatherApiConfig(), config, server.hasArg("apiKey"));
+    if (error) {
+      server.send(400, "text/plain", String(error) + "\n");
+      return;
+    }
+    weatherSetApiConfig(config);
+  }
+
+  const WeatherApiConfig &config = weatherApiConfig();
+  JsonDocument doc;
+  doc["currentUrl"] = config.currentUrl;
+  doc["forecastUrl"] = config.forecastUrl;
+  doc["city"] = config.city;
+  doc["units"] = config.units;
+  doc["apiKeySet"] = config.apiKey.length() > 0 && config.apiKey != "YOUR_API_KEY_HERE";
+  String out;
+  serializeJson(doc, out);
+  server.send(200, "application/json", out);
+}
+
+void addCoreMetrics(JsonArray cores, const char *name, int core, const TaskScheduler &sched,
+                    TaskHandle_t task) {
+  JsonObject entry = cores.add<JsonObject>();
+  entry["name"] = name;
+  entry["core"] = core;
+  entry["idlePct"] = sched.idlePermille() / 10.0f;
+  entry["stackFree"] = task ? uxTaskGetStackHighWaterMark(task) : 0;
+  JsonArray jobs = entry["tasks"].to<JsonArray>();
+  for (uint8_t i = 0; i < sched.taskCount(); ++i) {
+    const SchedTaskStats &t = sched.stats(i);
+    JsonObject job = jobs.add<JsonObject>();
+    job["name"] = t.name;
+    job["priority"] = (uint8_t)t.priority;
+    job["periodMs"] = t.periodMs;
+    job["runs"] = t.runs;
+    job["avgUs"] = t.avgUs;
+    job["maxUs"] = t.maxUs;
+    job["loadPct"] = t.loadPermille / 10.0f;
+    job["overruns"] = t.overruns;
+    job["maxLateMs"] = t.maxLateMs;
+  }
+}
+
 void handleMetrics() {
+  if (!admitRequest()) return;
   JsonDocument doc;
   doc["cpu"] = cur.cpu;
   doc["mem"] = cur.mem;
@@ -498,12 +1121,14 @@ void handleMetrics() {
   if (isnan(cur.freeC) || cur.freeC < 0) doc["freeC"] = nullptr; else doc["freeC"] = cur.freeC;
   if (isnan(cur.freeD) || cur.freeD < 0) doc["freeD"] = nullptr; else doc["freeD"] = cur.freeD;
 
-  const WeatherData &w = display.getWeatherData();
-  const WeatherDisplayState &ws = display.getDisplayState();
+  // The active location as the I/O task has it (the display holds a copy)
+  const WeatherLocation &active = weatherLocation(weatherActiveLocation());
+  const WeatherData &w = active.data;
+  const WeatherFetchStats &wf = weatherFetchStats();
   JsonObject weather = doc["weather"].to<JsonObject>();
-  weather["location"] = w.location;
+  weather["location"] = w.location[0] ? w.location : active.query;
   weather["description"] = w.description;
-  weather["icon"] = w.icon;
+  weather["icon"] = weatherIconCode(w.icon);
   if (isnan(w.temperature)) weather["temperature"] = nullptr; else weather["temperature"] = w.temperature;
   if (isnan(w.feelsLike)) weather["feelsLike"] = nullptr; else weather["feelsLike"] = w.feelsLike;
   if (isnan(w.tempMin)) weather["tempMin"] = nullptr; else weather["tempMin"] = w.tempMin;
@@ -512,11 +1137,12 @@ void handleMetrics() {
   if (isnan(w.windSpeed) || w.windSpeed < 0) weather["windSpeed"] = nullptr; else weather["windSpeed"] = w.windSpeed;
   weather["updated"] = w.lastUpdateEpoch;
   weather["timezoneOffset"] = w.timezoneOffset;
-  weather["ok"] = ws.lastFetchOk;
-  weather["connected"] = ws.isConnected;
+  weather["ok"] = active.lastFetchOk;
+  weather["cached"] = active.fromCache;
+  weather["connected"] = wf.isConnected;
 
   JsonArray forecast = doc["forecast"].to<JsonArray>();
-  for (int i = 0; i < 3; ++i) {
+  for (int i = 0; i < WEATHER_FORECAST_DAYS; ++i) {
     JsonObject day = forecast.add<JsonObject>();
     day["slot"] = i;
     const WeatherForecast &f = w.forecast[i];
@@ -524,22 +1150,150 @@ void handleMetrics() {
     if (!f.valid) continue;
     day["label"] = f.label;
     day["description"] = f.description;
-    day["icon"] = f.icon;
+    day["icon"] = weatherIconCode(f.icon);
     day["timestamp"] = f.timestamp;
     if (isnan(f.tempMax)) day["high"] = nullptr; else day["high"] = f.tempMax;
     if (isnan(f.tempMin)) day["low"] = nullptr; else day["low"] = f.tempMin;
+    day["pop"] = f.pop;
+  }
+
+  // 3-hour points as [offsetHours, temp, pop %, wind, icon] from `start`
+  const HourlyForecast &hf = w.hourly;
+  JsonObject hourly = doc["hourly"].to<JsonObject>();
+  hourly["start"] = hf.firstEpoch;
+  JsonArray points = hourly["points"].to<JsonArray>();
+  for (uint8_t i = 0; i < hf.count; ++i) {
+    const ForecastPoint &p = hf.points[i];
+    JsonArray row = points.add<JsonArray>();
+    row.add(p.slot * 3);
+    if (p.tempTenths == INT16_MIN) row.add(nullptr); else row.add(p.temp());
+    row.add(p.pop);
+    row.add(p.wind());
+    const char *code = weatherIconCode(p.icon);
+    if (code) row.add(code); else row.add(nullptr);
+  }
+
+  JsonObject wt = doc["telemetry"]["weather"].to<JsonObject>();
+  wt["fetching"] = wf.fetchInProgress;
+  wt["lastFetchMs"] = wf.lastFetchMs;
+  wt["maxFetchMs"] = wf.maxFetchMs;
+  wt["fetches"] = wf.fetchCount;
+  wt["forecastEntries"] = wf.forecastEntries;
+  wt["forecastPeakJsonBytes"] = wf.forecastPeakJsonBytes;
+  wt["lastHandshakeMs"] = wf.lastHandshakeMs;
+  wt["handshakes"] = wf.handshakes;
+  wt["reusedRequests"] = wf.reusedRequests;
+  wt["lastHttpStatus"] = wf.lastHttpStatus;
+  // Render-side counters (single writer, 32-bit words)
+  const WeatherDisplayState &ws = display.getDisplayState();
+  wt["lastComposeUs"] = ws.lastComposeUs;
+  wt["maxComposeUs"] = ws.maxComposeUs;
+  wt["viewBuilds"] = ws.viewBuilds;
+  wt["lastViewBuildUs"] = ws.lastViewBuildUs;
+  wt["nextFetchInMs"] = active.scheduler.msUntilNext(millis());
+  wt["intervalMs"] = active.scheduler.intervalMs();
+  wt["failureStreak"] = active.scheduler.failureStreak();
+  wt["unchangedStreak"] = active.scheduler.unchangedStreak();
+  const WeatherCacheStats &wc = active.cache.stats();
+  JsonObject cache = wt["cache"].to<JsonObject>();
+  cache["restored"] = wc.restored;
+  cache["bytes"] = wc.bytes;
+  cache["writes"] = wc.writes;
+  cache["skippedUnchanged"] = wc.skippedUnchanged;
+  cache["skippedRateLimit"] = wc.skippedRateLimit;
+
+  // Every configured location; memory is the fixed per-location footprint.
+  wt["activeLocation"] = weatherActiveLocation();
+  wt["locationBytes"] = sizeof(WeatherLocation);
+  JsonArray places = wt["locations"].to<JsonArray>();
+  for (uint8_t i = 0; i < weatherLocationCount(); ++i) {
+    const WeatherLocation &loc = weatherLocation(i);
+    JsonObject place = places.add<JsonObject>();
+    place["query"] = loc.query;
+    place["name"] = loc.data.location;
+    place["ok"] = loc.lastFetchOk;
+    place["cached"] = loc.fromCache;
+    place["fetches"] = loc.fetches;
+    place["failures"] = loc.failures;
+    place["nextFetchInMs"] = loc.scheduler.msUntilNext(millis());
+    place["failureStreak"] = loc.scheduler.failureStreak();
+    place["cacheBytes"] = loc.cache.stats().bytes;
   }
 
+  const AssetCacheStats &as = assets.stats();
+  JsonObject bundle = doc["telemetry"]["assets"].to<JsonObject>();
+  bundle["bundleBytes"] = assets.bundleBytes();
+  bundle["decodedBytes"] = assets.decodedBytes();
+  bundle["cacheBytes"] = AssetBundle::cacheBytes();
+  bundle["hits"] = as.hits;
+  bundle["misses"] = as.misses;
+  bundle["evictions"] = as.evictions;
+  bundle["decodeErrors"] = as.decodeErrors;
+  bundle["lastDecodeUs"] = as.lastDecodeUs;
+  bundle["avgDecodeUs"] = as.misses ? as.decodeUs / as.misses : 0;
+
+  const SmoothTextStats &st = smoothText.stats();
+  JsonObject text = doc["telemetry"]["text"].to<JsonObject>();
+  text["hits"] = st.hits;
+  text["misses"] = st.misses;
+  text["hitRate"] = (st.hits + st.misses) ? (float)st.hits / (st.hits + st.misses) : 0.0f;
+  text["flushes"] = st.flushes;
+  text["missingGlyphs"] = st.missingGlyphs;
+  text["glyphs"] = st.entries;
+  text["pixelBytesUsed"] = st.pixelsUsed * sizeof(uint16_t);
+  text["cacheBytes"] = SmoothText::cacheBytes();
+
+  const TimeSyncStats ts = timeSync.stats();
+  JsonObject clock = doc["telemetry"]["time"].to<JsonObject>();
+  clock["synced"] = ts.synced;
+  clock["syncs"] = ts.syncs;
+  clock["lastSyncEpoch"] = ts.lastSyncEpoch;
+  clock["lastOffsetMs"] = ts.lastOffsetMs;
+  clock["driftPpm"] = ts.driftPpm;
+  clock["restarts"] = ts.restarts;
+
+  // Per-core and per-task CPU use over the last load window
+  JsonArray cores = doc["telemetry"]["cores"].to<JsonArray>();
+  addCoreMetrics(cores, "render", renderCore, renderScheduler, loopTask);
+  addCoreMetrics(cores, "io", IO_CORE, ioScheduler, ioTask);
+
+  const HttpGuardStats &hs = httpGuard.stats();
+  JsonObject http = doc["telemetry"]["http"].to<JsonObject>();
+  http["served"] = hs.served;
+  http["throttledClient"] = hs.throttledClient;
+  http["throttledBudget"] = hs.throttledBudget;
+  http["skippedPolls"] = hs.skippedPolls;
+  http["lastPollUs"] = hs.lastPollUs;
+  http["maxPollUs"] = hs.maxPollUs;
+
+  const StaticFileStats &fs = staticFiles.stats();
+  JsonObject files = doc["telemetry"]["files"].to<JsonObject>();
+  files["mounted"] = staticFiles.mounted();
+  files["served"] = fs.served;
+  files["notModified"] = fs.notModified;
+  files["partial"] = fs.partial;
+  files["gzip"] = fs.gzip;
+  files["handleHits"] = fs.handleHits;
+  files["handleMisses"] = fs.handleMisses;
+  files["missingHits"] = fs.missingHits;
+
+  JsonObject feed = doc["telemetry"]["ws"].to<JsonObject>();
+  feed["clients"] = statsFeed.clientCount();
+  feed["frames"] = statsFeed.framesSent();
+  feed["bytes"] = statsFeed.bytesSent();
+
+  addSerialTelemetry(doc["telemetry"]["serial"].to<JsonObject>());
+  addTraceTelemetry(doc["telemetry"]["trace"].to<JsonObject>());
+  addLatencyTelemetry(doc["telemetry"]["latency"].to<JsonObject>());
+
   String payload;
   serializeJson(doc, payload);
   server.send(200, "application/json", payload);
 }
 
 // ------------------- WiFi connect -------------------
+// Wait for the connection started in setup(), then start the web server.
 void wifiConnect() {
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(WIFI_SSID, WIFI_PASS);
-
   // Show a small connecting screen via sprite (no flicker)
   gfx.setTextColor(fg, bg);
   gfx.setTextDatum(MC_DATUM);
@@ -563,12 +1317,247 @@ void wifiConnect() {
     server.on("/", handleIndex);
     server.on("/metrics", handleMetrics);
     server.on("/ip", handleIP);
+    server.on("/history", handleHistory);
+    server.on("/weather/config", handleWeatherConfig);
+    server.on("/debug/serial", handleSerialRecorder);
+    server.on("/debug/trace", handleTrace);
+    server.on("/debug/latency", handleLatency);
+    server.onNotFound(handleNotFound);
+    const char *const configHeaders[] = {"Host", "Origin", CONFIG_TOKEN_HEADER};
+    staticFiles.begin(configHeaders, sizeof(configHeaders) / sizeof(configHeaders[0]));
     server.begin();
+    statsFeed.begin();
   } else {
     ipText = "WiFi: not connected";
   }
 }
 
+// ------------------- Render core tasks -------------------
+// Touch, and samples handed over by the I/O core.
+void pollUi() {
+  handleTouch();
+
+  QueuedSample sample;
+  bool fresh = false;
+  while (xQueueReceive(sampleQueue, &sample, 0) == pdTRUE) {
+    shown = sample.stats;
+    shownHist.push(sample.stats);
+    latency.arrived(sample.timing, SCREENS[gScreen].value < STAT_COUNT);
+    fresh = true;
+  }
+  if (fresh) {
+    setBarTargetFromScreen();
+    renderScheduler.wake(renderTask);
+  }
+}
+
+// Draw the current screen, then pick the frame rate it wants next.
+void renderFrame() {
+  const Screen &screen = SCREENS[gScreen];
+  if (screen.value < STAT_COUNT) {
+    int64_t startUs = esp_timer_get_time();
+    screen.draw(screen);  // ends with the sprite push
+    latency.framePushed(startUs, esp_timer_get_time());
+  } else {
+    screen.draw(screen);
+    latency.discard();
+  }
+  renderScheduler.setPeriod(renderTask,
+                            1000 / (screenIdle(screen) ? screen.idleHz : screen.activeHz));
+}
+
+// Harness entry points (screens.h)
+void showStats(ScreenId id, const Stats &sample, const StatsHistory &history) {
+  gScreen = id;
+  shown = sample;
+  shownHist = history;
+  setBarTargetFromScreen();
+  barValue = barTarget;
+}
+
+void drawStatsScreen(ScreenId id) {
+  const Screen &screen = SCREENS[id];
+  if (screen.value < STAT_COUNT) screen.draw(screen);
+}
+
+// ------------------- I/O core tasks -------------------
+// One complete line from the feeder: parse it, answer its timing trailer,
+// hand the sample over.
+void ingestLine(const String &line, int64_t recvUs) {
+  if (!parseCSVLine(line)) return;
+  QueuedSample sample;
+  sample.stats = cur;
+  sample.timing.recvUs = recvUs;
+  sample.timing.parsedUs = esp_timer_get_time();
+
+  // A replayed trailer belongs to another session's clock: no echo
+  int stampAt = line.indexOf(';');
+  FeederStamp stamp;
+  if (stampAt >= 0 && !serialRecorder.replaying() &&
+      parseFeederStamp(line.c_str() + stampAt + 1, stamp)) {
+    if (stamp.hasEcho) feederClock.echoReturned(stamp.echoSeq, stamp.echoUs);
+    sample.timing.seq = stamp.seq;
+    if (feederClock.synced()) sample.timing.sentUs = feederClock.toDevice(stamp.sendUs);
+    feederClock.echoSent(stamp.seq, stamp.sendUs, recvUs, esp_timer_get_time());
+    Serial.printf("ECHO %u\n", (unsigned)stamp.seq);
+  }
+
+  samplesIn++;
+  hist.push(cur);
+  statsFeed.publish(cur);
+  // Render core is behind: drop its oldest sample, keep the newest
+  if (xQueueSend(sampleQueue, &sample, 0) != pdTRUE) {
+    QueuedSample stale;
+    xQueueReceive(sampleQueue, &stale, 0);
+    xQueueSend(sampleQueue, &sample, 0);
+    samplesDropped++;
+  }
+}
+
+// Feeder bytes, live or replayed: split lines and ingest them.
+void ingestSerial(const uint8_t *data, size_t len) {
+  const int64_t recvUs = esp_timer_get_time();  // for lines this chunk completes
+  for (size_t i = 0; i < len; ++i) {
+    char c = (char)data[i];
+    if (c == '\n') {
+      if (serialBuf == SERIAL_TRACE_COMMAND) {
+        startTraceDump();
+      } else {
+        ingestLine(serialBuf, recvUs);
+      }
+      serialBuf = "";
+    } else if (c != '\r') {
+      serialBuf += c;
+      if (serialBuf.length() > 200)
+        serialBuf.remove(0, serialBuf.length() - 200);
+    }
+  }
+}
+
+ReplayCounts ingestCounts() {
+  ReplayCounts c;
+  c.samples = samplesIn;
+  c.dropped = samplesDropped;
+  c.frames = renderScheduler.stats(renderTask).runs;  // render core's word, read only
+  return c;
+}
+
+void updateReplayTotals() {
+  ReplayCounts now = ingestCounts();
+  replayTotals.samples = now.samples - replayStart.samples;
+  replayTotals.dropped = now.dropped - replayStart.dropped;
+  replayTotals.frames = now.frames - replayStart.frames;
+}
+
+bool startReplay(ReplaySpeed speed) {
+  serialBuf = "";  // don't glue a live partial line onto the first record
+  if (!serialRecorder.startReplay(speed, ingestSerial)) return false;
+  replayStart = ingestCounts();
+  replayTotals = ReplayCounts();
+  ioScheduler.setPeriod(replayTask, REPLAY_POLL_MS);
+  ioScheduler.wake(replayTask);
+  return true;
+}
+
+void pollReplay() {
+  bool finished = serialRecorder.pollReplay(micros(), REPLAY_SLICE_US);
+  if (serialRecorder.replaying() || finished) updateReplayTotals();
+  if (finished) {
+    const SerialRecorderStats &st = serialRecorder.stats();
+    uint32_t ms = st.replayUs / 1000;
+    Serial.printf("Replay: %u records, %u bytes, %u samples in %u ms (%u samples/s), "
+                  "%u frames, %u samples dropped, lag %u us\n",
+                  (unsigned)st.replayRecords, (unsigned)st.replayBytes,
+                  (unsigned)replayTotals.samples, (unsigned)ms,
+                  (unsigned)(ms ? replayTotals.samples * 1000ULL / ms : 0),
+                  (unsigned)replayTotals.frames, (unsigned)replayTotals.dropped,
+                  (unsigned)st.replayLagUs);
+    serialBuf = "";
+  }
+  if (!serialRecorder.replaying()) ioScheduler.setPeriod(replayTask, REPLAY_IDLE_MS);
+}
+
+// A TRACE line restarts the dump from whatever the ring holds now.
+void startTraceDump() {
+  serialTraceDump.begin();
+  ioScheduler.setPeriod(traceDumpTask, TRACE_DUMP_POLL_MS);
+  ioScheduler.wake(traceDumpTask);
+}
+
+// Only as many lines as the serial TX buffer takes without blocking, so a
+// slow or absent reader holds up the dump and nothing else.
+void pollTraceDump() {
+  if (!serialTraceDump.active()) return;
+  uint32_t lines =
+      std::min<uint32_t>(TRACE_DUMP_LINES, Serial.availableForWrite() / TRACE_LINE_BYTES);
+  if (lines && !serialTraceDump.write(Serial, lines)) {
+    ioScheduler.setPeriod(traceDumpTask, TRACE_DUMP_IDLE_MS);
+  }
+}
+
+// Requests answered (or turned away) by the web server so far
+uint32_t httpRequests() {
+  const HttpGuardStats &hs = httpGuard.stats();
+  return hs.served + hs.throttledClient + hs.throttledBudget;
+}
+
+void pollIo() {
+  // Serve HTTP if connected, within the HTTP time budget
+  if (WiFi.status() == WL_CONNECTED && httpGuard.shouldPoll(micros())) {
+    uint32_t before = httpRequests();
+    uint32_t t0 = micros();
+    server.handleClient();
+    uint32_t elapsed = micros() - t0;
+    httpGuard.charge(elapsed);
+    // Only polls that answered a request are worth a span
+    if (httpRequests() != before) trace.complete("http", t0, elapsed);
+  }
+  statsFeed.loop();
+
+  // Serial CSV input (PC stats), recorded as it arrives. Live input is
+  // dropped while a recording is replayed through the same path.
+  if (!Serial.available()) return;
+  TraceScope span("serial");
+  while (Serial.available()) {
+    uint8_t chunk[64];
+    size_t n = 0;
+    while (n < sizeof(chunk) && Serial.available()) chunk[n++] = (uint8_t)Serial.read();
+    serialRecorder.record(chunk, n, micros());
+    if (!serialRecorder.replaying()) ingestSerial(chunk, n);
+  }
+}
+
+void checkTime() { timeSync.check(millis()); }
+
+void logCoreLoad(const char *name, const TaskScheduler &sched) {
+  Serial.printf(" | %s idle=%u.%u%%", name, sched.idlePermille() / 10, sched.idlePermille() % 10);
+  for (uint8_t i = 0; i < sched.taskCount(); ++i) {
+    const SchedTaskStats &t = sched.stats(i);
+    Serial.printf(" %s=%u.%u%%", t.name, t.loadPermille / 10, t.loadPermille % 10);
+  }
+}
+
+void logTelemetry() {
+  Serial.printf("Telemetry: free heap=%u bytes", (unsigned)ESP.getFreeHeap());
+  logCoreLoad("render", renderScheduler);
+  logCoreLoad("io", ioScheduler);
+  Serial.println();
+}
+
+void ioTaskMain(void *) {
+  ioScheduler.begin(millis());
+  ioScheduler.add("io", pollIo, IO_POLL_MS, SCHED_PRIO_HIGH);
+  replayTask = ioScheduler.add("replay", pollReplay, REPLAY_IDLE_MS, SCHED_PRIO_NORMAL);
+  traceDumpTask = ioScheduler.add("trace dump", pollTraceDump, TRACE_DUMP_IDLE_MS, SCHED_PRIO_LOW);
+  ioScheduler.add("weather", weatherUpdateOnly, WEATHER_POLL_MS, SCHED_PRIO_NORMAL);
+  ioScheduler.add("time", checkTime, TIME_CHECK_MS, SCHED_PRIO_LOW, TIME_CHECK_MS);
+  ioScheduler.add("telemetry", logTelemetry, TELEMETRY_LOG_MS, SCHED_PRIO_LOW, TELEMETRY_LOG_MS);
+  for (;;) {
+    uint32_t sleepMs = ioScheduler.runDue(millis());
+    if (sleepMs) delay(sleepMs);
+  }
+}
+
 // ------------------- Setup / Loop -------------------
 void setup() {
   // Initialize M5Stack Core3
@@ -593,59 +1582,45 @@ void setup() {
   gfx.pushSprite(0, 0);
   delay(400);
 
-  // WiFi connect & start web server
-  wifiConnect();
+  // Radio first: with it on, esp_random() behind the fetch jitter is truly
+  // random
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(WIFI_SSID, WIFI_PASS);
 
-  // Init weather subsystem AFTER WiFi is up
+  // Weather warm start from NVS before the connect wait, which can block 12 s
   weatherInit();
 
-  // Start in CPU mode
-  setBarTargetFromMode();
-}
-
-void loop() {
-  // Serve HTTP if connected
-  if (WiFi.status() == WL_CONNECTED) {
-    server.handleClient();
-  }
-
-  // Touch swipe for mode navigation
-  handleTouch();
-
-  // Serial CSV input (PC stats)
-  while (Serial.available()) {
-    char c = (char)Serial.read();
-    if (c == '\n') {
-      if (parseCSVLine(serialBuf)) {
-        histCPU[histIdx]  = cur.cpu;
-        histGPU[histIdx]  = cur.gpu;
-        histDISK[histIdx] = cur.diskPct;
-        histIdx = (histIdx + 1) % HIST_N;
-        setBarTargetFromMode();
-      }
-      serialBuf = "";
-    } else if (c != '\r') {
-      serialBuf += c;
-      if (serialBuf.length() > 200)
-        serialBuf.remove(0, serialBuf.length() - 200);
-    }
-  }
-
-  // Mode-specific drawing
-  if (gMode == MODE_WEATHER) {
-    // Hand off the display to the weather engine (includes weather update)
-    weatherStep();
+  // WiFi connect & start web server
+  wifiConnect();
+  weatherNetworkReady();
+
+  // Start on the CPU screen
+  setBarTargetFromScreen();
+
+  // Render core: this (loop) task. UI first so a new sample and the frame
+  // showing it share a pass.
+  loopTask = xTaskGetCurrentTaskHandle();
+  renderCore = xPortGetCoreID();
+  sampleQueue = xQueueCreate(SAMPLE_QUEUE_DEPTH, sizeof(QueuedSample));
+  latency.begin();
+  if (!serialRecorder.begin()) Serial.println("Serial recorder: no memory, not recording");
+  if (trace.begin()) {
+    Serial.printf("Trace: %u events, %u ns per span\n", (unsigned)trace.stats().capacity,
+                  trace.stats().spanNs);
   } else {
-    // ~30 FPS pacing for PC stats modes
-    static uint32_t nextFrame = 0;
-    uint32_t now = millis();
-    if (now >= nextFrame) {
-      nextFrame = now + 33; // ~30 FPS
-      animateBar();
-      render();
-    }
-    // Still update weather data in background for web portal
-    weatherUpdateOnly();
+    Serial.println("Trace: no memory, not tracing");
   }
+  renderScheduler.begin(millis());
+  renderScheduler.add("ui", pollUi, UI_POLL_MS, SCHED_PRIO_HIGH);
+  renderTask = renderScheduler.add("render", renderFrame, 1000 / SCREENS[gScreen].activeHz,
+                                   SCHED_PRIO_HIGH);
+
+  // I/O core: everything that talks to the PC or the network
+  xTaskCreatePinnedToCore(ioTaskMain, "io", IO_TASK_STACK, nullptr, IO_TASK_PRIORITY, &ioTask,
+                          IO_CORE);
 }
 
+void loop() {
+  uint32_t sleepMs = renderScheduler.runDue(millis());
+  if (sleepMs) delay(sleepMs);
+}
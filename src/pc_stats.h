@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Latest sample from the PC feeder (see parseCSVLine in main.cpp).
+struct Stats {
+  float cpu = 0, mem = 0, gpu = 0;
+  float diskPct = 0, diskMBps = 0;
+  float cpuTempF = -999, gpuTempF = -999;
+  float freeC = -1, freeD = -1;
+  float indoorTempF = -999;
+};
+
+// Stable field numbering shared by the binary feeds (WebSocket deltas,
+// history download) and the dashboard JavaScript. Append only.
+enum StatsField : uint8_t {
+  STAT_CPU = 0,
+  STAT_MEM,
+  STAT_GPU,
+  STAT_DISK_PCT,
+  STAT_DISK_MBPS,
+  STAT_CPU_TEMP_F,
+  STAT_GPU_TEMP_F,
+  STAT_FREE_C,
+  STAT_FREE_D,
+  STAT_INDOOR_TEMP_F,
+  STAT_COUNT
+};
+
+struct StatsFieldInfo {
+  const char *key;       // JSON / dashboard key
+  float Stats::*member;
+  uint8_t decimals;      // fixed-point precision on the wire
+  float invalidBelow;    // values below this are reported as null
+};
+
+constexpr StatsFieldInfo STATS_FIELDS[STAT_COUNT] = {
+    {"cpu", &Stats::cpu, 1, -1e30f},
+    {"mem", &Stats::mem, 1, -1e30f},
+    {"gpu", &Stats::gpu, 1, -1e30f},
+    {"diskPct", &Stats::diskPct, 1, -1e30f},
+    {"diskMBps", &Stats::diskMBps, 2, -1e30f},
+    {"cpuTempF", &Stats::cpuTempF, 1, -100.0f},
+    {"gpuTempF", &Stats::gpuTempF, 1, -100.0f},
+    {"freeC", &Stats::freeC, 0, 0.0f},
+    {"freeD", &Stats::freeD, 0, 0.0f},
+    {"indoorTempF", &Stats::indoorTempF, 1, -100.0f},
+};
+
+// Last HIST_N samples of every field, ring ordered: idx is the oldest slot
+// once full
+constexpr int HIST_N = 60;
+struct StatsHistory {
+  float values[STAT_COUNT][HIST_N] = {{0}};
+  int idx = 0;
+  int count = 0;
+
+  void push(const Stats &s) {
+    for (int f = 0; f < STAT_COUNT; ++f) values[f][idx] = s.*(STATS_FIELDS[f].member);
+    idx = (idx + 1) % HIST_N;
+    if (count < HIST_N) count++;
+  }
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "pc_stats.h"
+
+// Screens, in swipe order. Each has a row in SCREENS (main.cpp).
+enum ScreenId : uint8_t { SCREEN_CPU, SCREEN_GPU, SCREEN_DISK, SCREEN_WEATHER, SCREEN_COUNT };
+
+// For harnesses that draw screens without the feeder, the I/O task or the
+// render scheduler (bench/render_bench.cpp). Render task only.
+
+// Show `sample` over `history` on the PC stats screens, with the bar
+// already settled on the value screen `id` displays.
+void showStats(ScreenId id, const Stats &sample, const StatsHistory &history);
+
+// Draw and push one frame of PC stats screen `id` (not SCREEN_WEATHER,
+// whose frames come from WeatherDisplay::draw()).
+void drawStatsScreen(ScreenId id);
@@ -0,0 +1,205 @@
+#include "serial_recorder.h"
+
+SerialRecorder serialRecorder;
+
+namespace {
+
+uint32_t readU32(const uint8_t *p) {
+  return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+void writeHeader(uint8_t *p, uint32_t gapUs, uint16_t len) {
+  p[0] = gapUs & 0xFF;
+  p[1] = (gapUs >> 8) & 0xFF;
+  p[2] = (gapUs >> 16) & 0xFF;
+  p[3] = gapUs >> 24;
+  p[4] = len & 0xFF;
+  p[5] = len >> 8;
+}
+
+}  // namespace
+
+bool SerialRecorder::begin() {
+  if (ring_) return true;
+  ring_ = static_cast<uint8_t *>(ps_malloc(SERIAL_RECORDER_BYTES));
+  capacity_ = SERIAL_RECORDER_BYTES;
+  if (!ring_) {
+    ring_ = static_cast<uint8_t *>(malloc(SERIAL_RECORDER_FALLBACK_BYTES));
+    capacity_ = SERIAL_RECORDER_FALLBACK_BYTES;
+  }
+  if (!ring_) capacity_ = 0;
+  return ring_ != nullptr;
+}
+
+// ------------------- Ring -------------------
+
+void SerialRecorder::put(const uint8_t *data, size_t len) {
+  size_t at = (tail_ + used_) % capacity_;
+  size_t first = min(len, capacity_ - at);
+  memcpy(ring_ + at, data, first);
+  memcpy(ring_, data + first, len - first);
+  used_ += len;
+}
+
+void SerialRecorder::peek(size_t offset, uint8_t *out, size_t len) const {
+  size_t at = (tail_ + offset) % capacity_;
+  size_t first = min(len, capacity_ - at);
+  memcpy(out, ring_ + at, first);
+  memcpy(out + first, ring_, len - first);
+}
+
+void SerialRecorder::dropOldest() {
+  uint8_t header[SERIAL_RECORD_HEADER];
+  peek(0, header, sizeof(header));
+  size_t size = SERIAL_RECORD_HEADER + (header[4] | header[5] << 8);
+  tail_ = (tail_ + size) % capacity_;
+  used_ -= size;
+  stats_.records--;
+  stats_.bytes -= size - SERIAL_RECORD_HEADER;
+  stats_.dropped++;
+  // The new oldest record's gap now points before the recording
+  if (used_) {
+    peek(0, header, sizeof(header));
+    stats_.spanMs -= min(stats_.spanMs, readU32(header) / 1000);
+  } else {
+    stats_.spanMs = 0;
+  }
+}
+
+bool SerialRecorder::append(uint32_t gapUs, const uint8_t *data, uint16_t len) {
+  size_t size = SERIAL_RECORD_HEADER + len;
+  if (size > capacity_) return false;
+  while (used_ + size > capacity_) dropOldest();
+  uint8_t header[SERIAL_RECORD_HEADER];
+  writeHeader(header, gapUs, len);
+  if (stats_.records) stats_.spanMs += gapUs / 1000;
+  put(header, sizeof(header));
+  put(data, len);
+  stats_.records++;
+  stats_.bytes += len;
+  return true;
+}
+
+void SerialRecorder::record(const uint8_t *data, size_t len, uint32_t nowUs) {
+  if (!ring_ || paused_ || replaying_ || !len) return;
+  uint32_t gapUs = stats_.records ? nowUs - lastUs_ : 0;
+  lastUs_ = nowUs;
+  while (len) {
+    uint16_t n = (uint16_t)min(len, (size_t)SERIAL_RECORD_MAX);
+    append(gapUs, data, n);
+    data += n;
+    len -= n;
+    gapUs = 0;  // the rest of the chunk arrived with it
+  }
+}
+
+void SerialRecorder::clear() {
+  stopReplay();
+  tail_ = used_ = 0;
+  stats_.records = stats_.bytes = stats_.spanMs = 0;
+}
+
+// ------------------- Replay -------------------
+
+bool SerialRecorder::startReplay(ReplaySpeed speed, SerialSink sink) {
+  if (!used_ || !sink) return false;
+  replaying_ = true;
+  speed_ = speed;
+  sink_ = sink;
+  cursor_ = 0;
+  started_ = false;
+  stats_.replays++;
+  stats_.replayRecords = stats_.replayBytes = stats_.replayUs = stats_.replayLagUs = 0;
+  return true;
+}
+
+void SerialRecorder::stopReplay() {
+  replaying_ = false;
+  // Live recording resumes; its first gap would span the replay
+  lastUs_ = micros();
+}
+
+bool SerialRecorder::pollReplay(uint32_t nowUs, uint32_t budgetUs) {
+  if (!replaying_) return false;
+  if (!started_) {
+    started_ = true;
+    startUs_ = dueUs_ = nowUs;
+  }
+
+  uint8_t buf[SERIAL_RECORD_MAX];
+  while (cursor_ < used_) {
+    uint8_t header[SERIAL_RECORD_HEADER];
+    peek(cursor_, header, sizeof(header));
+    uint32_t gapUs = cursor_ ? readU32(header) : 0;
+    uint16_t len = header[4] | header[5] << 8;
+
+    uint32_t now = micros();
+    if (speed_ == REPLAY_RECORDED) {
+      if ((int32_t)(now - (dueUs_ + gapUs)) < 0) break;
+      dueUs_ += gapUs;
+      stats_.replayLagUs = max(stats_.replayLagUs, now - dueUs_);
+    } else if (now - nowUs >= budgetUs) {
+      break;
+    }
+
+    peek(cursor_ + SERIAL_RECORD_HEADER, buf, len);
+    sink_(buf, len);
+    cursor_ += SERIAL_RECORD_HEADER + len;
+    stats_.replayRecords++;
+    stats_.replayBytes += len;
+  }
+
+  stats_.replayUs = micros() - startUs_;
+  if (cursor_ < used_) return false;
+  stopReplay();
+  return true;
+}
+
+// ------------------- Dump / flash -------------------
+
+size_t SerialRecorder::readDump(size_t offset, uint8_t *out, size_t len) const {
+  size_t total = dumpSize();
+  if (offset >= total) return 0;
+  len = min(len, total - offset);
+  size_t n = 0;
+  for (; offset < SERIAL_DUMP_HEADER && n < len; ++offset, ++n) {
+    out[n] = offset < sizeof(SERIAL_DUMP_MAGIC) ? SERIAL_DUMP_MAGIC[offset] : SERIAL_DUMP_VERSION;
+  }
+  if (n < len) peek(offset - SERIAL_DUMP_HEADER, out + n, len - n);
+  return len;
+}
+
+bool SerialRecorder::save(fs::FS &fs, const char *path) const {
+  File f = fs.open(path, "w");
+  if (!f) return false;
+  uint8_t buf[512];
+  size_t total = dumpSize();
+  for (size_t offset = 0; offset < total;) {
+    size_t n = readDump(offset, buf, sizeof(buf));
+    if (f.write(buf, n) != n) return false;
+    offset += n;
+  }
+  return true;
+}
+
+bool SerialRecorder::load(fs::FS &fs, const char *path) {
+  if (!ring_) return false;
+  File f = fs.open(path, "r");
+  if (!f) return false;
+  uint8_t header[SERIAL_DUMP_HEADER];
+  if (f.read(header, sizeof(header)) != sizeof(header) ||
+      memcmp(header, SERIAL_DUMP_MAGIC, sizeof(SERIAL_DUMP_MAGIC)) != 0 ||
+      header[sizeof(SERIAL_DUMP_MAGIC)] != SERIAL_DUMP_VERSION) {
+    return false;
+  }
+
+  clear();
+  uint8_t buf[SERIAL_RECORD_MAX];
+  uint8_t rec[SERIAL_RECORD_HEADER];
+  while (f.read(rec, sizeof(rec)) == sizeof(rec)) {
+    uint16_t len = rec[4] | rec[5] << 8;
+    if (len > SERIAL_RECORD_MAX || f.read(buf, len) != len) break;
+    append(stats_.records ? readU32(rec) : 0, buf, len);
+  }
+  return true;
+}
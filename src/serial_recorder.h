@@ -0,0 +1,106 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+// Recorder for the raw feeder stream, and replay of what it recorded.
+//
+// Every chunk read from Serial is kept with its arrival time in a byte ring
+// (PSRAM when there is some), so the exact sequence behind a stutter report
+// can be downloaded, kept in flash and played back through the normal
+// ingest path: at the recorded pace, or as fast as the I/O core allows to
+// measure ingest-to-pixel throughput. Records, oldest first:
+//   u32 gapUs   time since the previous record (LE)
+//   u16 len     (LE, at most SERIAL_RECORD_MAX)
+//   u8  bytes[len]
+// When the ring is full the oldest records are dropped whole. A dump (GET
+// /debug/serial, or the file written by save()) is SERIAL_DUMP_MAGIC, a
+// version byte, then the records.
+//
+// Recording pauses during a replay, so the ring being played stays put.
+// Everything here belongs to the I/O task.
+
+constexpr size_t SERIAL_RECORDER_BYTES = 128 * 1024;        // PSRAM
+constexpr size_t SERIAL_RECORDER_FALLBACK_BYTES = 16 * 1024;  // no PSRAM
+constexpr uint16_t SERIAL_RECORD_MAX = 256;
+constexpr size_t SERIAL_RECORD_HEADER = 6;
+constexpr char SERIAL_DUMP_MAGIC[4] = {'P', 'C', 'S', 'R'};
+constexpr uint8_t SERIAL_DUMP_VERSION = 1;
+constexpr size_t SERIAL_DUMP_HEADER = sizeof(SERIAL_DUMP_MAGIC) + 1;
+constexpr const char *SERIAL_RECORDING_PATH = "/serial.rec";  // LittleFS
+
+enum ReplaySpeed : uint8_t { REPLAY_RECORDED, REPLAY_MAX };
+
+struct SerialRecorderStats {
+  uint32_t records = 0;   // held in the ring
+  uint32_t bytes = 0;     // payload bytes held
+  uint32_t dropped = 0;   // records overwritten since boot
+  uint32_t spanMs = 0;    // arrival time covered by the held records
+  uint32_t replays = 0;
+  // Last (or current) replay
+  uint32_t replayRecords = 0;
+  uint32_t replayBytes = 0;
+  uint32_t replayUs = 0;   // start to last record fed
+  uint32_t replayLagUs = 0;  // REPLAY_RECORDED: worst delay behind the recorded pace
+};
+
+// Where replayed bytes go (the live serial ingest).
+typedef void (*SerialSink)(const uint8_t *data, size_t len);
+
+class SerialRecorder {
+ public:
+  // Allocate the ring. Returns false without any memory for it.
+  bool begin();
+
+  // Keep `len` bytes that arrived at `nowUs`. Ignored while paused or
+  // replaying.
+  void record(const uint8_t *data, size_t len, uint32_t nowUs);
+  void setPaused(bool paused) { paused_ = paused; }
+  bool paused() const { return paused_; }
+  void clear();
+
+  // Play the ring into `sink`, starting on the next poll.
+  bool startReplay(ReplaySpeed speed, SerialSink sink);
+  void stopReplay();
+  bool replaying() const { return replaying_; }
+  ReplaySpeed replaySpeed() const { return speed_; }
+
+  // Feed the records that are due. REPLAY_MAX feeds records until
+  // `budgetUs` has passed. Returns true when the replay ended in this call.
+  bool pollReplay(uint32_t nowUs, uint32_t budgetUs);
+
+  // The dump format, in pieces of up to `len` bytes starting at `offset`.
+  size_t dumpSize() const { return used_ ? SERIAL_DUMP_HEADER + used_ : 0; }
+  size_t readDump(size_t offset, uint8_t *out, size_t len) const;
+
+  bool save(fs::FS &fs, const char *path) const;
+  // Replace the ring with a dump written by save() (or downloaded).
+  bool load(fs::FS &fs, const char *path);
+
+  const SerialRecorderStats &stats() const { return stats_; }
+
+ private:
+  void put(const uint8_t *data, size_t len);
+  void peek(size_t offset, uint8_t *out, size_t len) const;
+  bool append(uint32_t gapUs, const uint8_t *data, uint16_t len);
+  void dropOldest();
+
+  uint8_t *ring_ = nullptr;
+  size_t capacity_ = 0;
+  size_t tail_ = 0;  // oldest record
+  size_t used_ = 0;
+  uint32_t lastUs_ = 0;
+  bool paused_ = false;
+
+  bool replaying_ = false;
+  ReplaySpeed speed_ = REPLAY_MAX;
+  SerialSink sink_ = nullptr;
+  size_t cursor_ = 0;       // offset from tail_ of the next record to feed
+  bool started_ = false;    // first record fed
+  uint32_t startUs_ = 0;
+  uint32_t dueUs_ = 0;      // REPLAY_RECORDED: when the next record is due
+
+  SerialRecorderStats stats_;
+};
+
+extern SerialRecorder serialRecorder;
@@ -0,0 +1,136 @@
+#include "smooth_text.h"
+
+SmoothText smoothText(assets);
+
+namespace {
+
+// Next code point of a UTF-8 string (1-3 byte sequences; anything else is
+// returned byte by byte).
+uint16_t nextCodePoint(const char *&p) {
+  uint8_t c = *p++;
+  if (c < 0x80) return c;
+  if ((c & 0xE0) == 0xC0 && (p[0] & 0xC0) == 0x80) {
+    return ((c & 0x1F) << 6) | (*p++ & 0x3F);
+  }
+  if ((c & 0xF0) == 0xE0 && (p[0] & 0xC0) == 0x80 && (p[1] & 0xC0) == 0x80) {
+    uint16_t cp = ((c & 0x0F) << 12) | ((p[0] & 0x3F) << 6) | (p[1] & 0x3F);
+    p += 2;
+    return cp;
+  }
+  return c;
+}
+
+uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  if (alpha == 0xFF) return fg;
+  if (alpha == 0) return bg;
+  uint16_t inv = 255 - alpha;
+  uint16_t r = (((fg >> 11) & 0x1F) * alpha + ((bg >> 11) & 0x1F) * inv) / 255;
+  uint16_t g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * inv) / 255;
+  uint16_t b = ((fg & 0x1F) * alpha + (bg & 0x1F) * inv) / 255;
+  return (r << 11) | (g << 5) | b;
+}
+
+uint32_t glyphKey(AssetId font, uint16_t code) { return ((uint32_t)font + 1) << 16 | code; }
+
+}  // namespace
+
+SmoothText::SmoothText(AssetBundle &bundle) : bundle_(bundle) {}
+
+void SmoothText::flush() {
+  for (Entry &e : entries_) e = Entry();
+  stats_.pixelsUsed = 0;
+  stats_.entries = 0;
+}
+
+// Cached RGB565 copy of a glyph for one colour pair, blending it on a miss.
+const uint16_t *SmoothText::blended(AssetId font, const AssetGlyph &glyph, uint16_t fg,
+                                    uint16_t bg) {
+  if (!arena_) {
+    arena_ = static_cast<uint16_t *>(ps_malloc(SMOOTH_TEXT_CACHE_PIXELS * sizeof(uint16_t)));
+    if (!arena_) arena_ = static_cast<uint16_t *>(malloc(SMOOTH_TEXT_CACHE_PIXELS * sizeof(uint16_t)));
+    if (!arena_) return nullptr;
+  }
+
+  const uint32_t key = glyphKey(font, glyph.code);
+  const uint32_t colors = (uint32_t)fg << 16 | bg;
+  uint32_t slot = (key * 2654435761u ^ colors * 40503u) % SMOOTH_TEXT_CACHE_ENTRIES;
+  for (uint16_t probe = 0; probe < SMOOTH_TEXT_CACHE_ENTRIES; ++probe) {
+    const Entry &e = entries_[slot];
+    if (e.glyph == 0) break;
+    if (e.glyph == key && e.colors == colors) {
+      stats_.hits++;
+      return arena_ + e.offset;
+    }
+    slot = (slot + 1) % SMOOTH_TEXT_CACHE_ENTRIES;
+  }
+
+  stats_.misses++;
+  const uint32_t pixels = (uint32_t)glyph.width * glyph.height;
+  if (pixels > SMOOTH_TEXT_CACHE_PIXELS) return nullptr;
+  // Keep the index at most 3/4 full so probes stay short.
+  if (stats_.pixelsUsed + pixels > SMOOTH_TEXT_CACHE_PIXELS ||
+      stats_.entries >= SMOOTH_TEXT_CACHE_ENTRIES * 3 / 4) {
+    flush();
+    stats_.flushes++;
+    slot = (key * 2654435761u ^ colors * 40503u) % SMOOTH_TEXT_CACHE_ENTRIES;
+  }
+  while (entries_[slot].glyph != 0) slot = (slot + 1) % SMOOTH_TEXT_CACHE_ENTRIES;
+
+  // Decode the alpha bytes into the upper half of the glyph's own slot,
+  // then expand front to back: pixel i overwrites bytes 2i..2i+1, which
+  // is always below alpha byte i + 1 still to be read.
+  uint16_t *out = arena_ + stats_.pixelsUsed;
+  uint8_t *alpha = reinterpret_cast<uint8_t *>(out) + pixels;
+  if (!bundle_.decodeGlyph(font, glyph, alpha)) return nullptr;
+  for (uint32_t i = 0; i < pixels; ++i) out[i] = blend565(fg, bg, alpha[i]);
+
+  Entry &e = entries_[slot];
+  e.glyph = key;
+  e.colors = colors;
+  e.offset = stats_.pixelsUsed;
+  stats_.pixelsUsed += pixels;
+  stats_.entries++;
+  return out;
+}
+
+int16_t SmoothText::draw(LGFX_Sprite &dst, AssetId font, const char *text, int32_t x,
+                         int32_t y, uint16_t fg, uint16_t bg) {
+  AssetFontInfo info;
+  if (!text || !bundle_.fontInfo(font, info)) return 0;
+
+  const int32_t baseline = y + info.ascent;
+  int32_t cursor = x;
+  for (const char *p = text; *p;) {
+    uint16_t code = nextCodePoint(p);
+    const AssetGlyph *glyph = bundle_.findGlyph(font, code);
+    if (!glyph) {
+      stats_.missingGlyphs++;
+      cursor += info.size / 3;
+      continue;
+    }
+    if (glyph->width && glyph->height) {
+      if (const uint16_t *px = blended(font, *glyph, fg, bg)) {
+        dst.pushImage(cursor + glyph->dX, baseline - glyph->dY, glyph->width, glyph->height,
+                      const_cast<uint16_t *>(px));
+      }
+    }
+    cursor += glyph->advance;
+  }
+  return cursor - x;
+}
+
+int16_t SmoothText::textWidth(AssetId font, const char *text) const {
+  AssetFontInfo info;
+  if (!text || !bundle_.fontInfo(font, info)) return 0;
+  int32_t width = 0;
+  for (const char *p = text; *p;) {
+    const AssetGlyph *glyph = bundle_.findGlyph(font, nextCodePoint(p));
+    width += glyph ? glyph->advance : info.size / 3;
+  }
+  return width;
+}
+
+int16_t SmoothText::lineHeight(AssetId font) const {
+  AssetFontInfo info;
+  return bundle_.fontInfo(font, info) ? info.ascent + info.descent : 0;
+}
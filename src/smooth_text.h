@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+#include <M5Unified.h>
+
+#include "asset_bundle.h"
+
+// Anti-aliased text from the bundled VLW fonts.
+//
+// A glyph is decoded from the bundle and alpha-blended into RGB565 once per
+// (font, glyph, foreground, background) and kept in a pixel arena, so drawing
+// a string is one pushImage per glyph. The arena and its index are fixed
+// size; when either fills up everything is dropped and rebuilt on demand
+// (screens reuse a handful of glyphs, so this is rare).
+
+constexpr size_t SMOOTH_TEXT_CACHE_PIXELS = 24 * 1024;  // 48 KB, PSRAM if present
+constexpr uint16_t SMOOTH_TEXT_CACHE_ENTRIES = 256;
+
+struct SmoothTextStats {
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  uint32_t flushes = 0;        // cache dropped because it was full
+  uint32_t missingGlyphs = 0;  // code points the font doesn't have
+  uint32_t pixelsUsed = 0;
+  uint16_t entries = 0;
+};
+
+class SmoothText {
+ public:
+  explicit SmoothText(AssetBundle &bundle);
+
+  // Draw UTF-8 `text` with its top-left corner at (x, y), blended onto the
+  // solid `bg`. Returns the advance width in pixels.
+  int16_t draw(LGFX_Sprite &dst, AssetId font, const char *text, int32_t x, int32_t y,
+               uint16_t fg, uint16_t bg);
+
+  int16_t textWidth(AssetId font, const char *text) const;
+  int16_t lineHeight(AssetId font) const;
+
+  const SmoothTextStats &stats() const { return stats_; }
+  static constexpr size_t cacheBytes() {
+    return SMOOTH_TEXT_CACHE_PIXELS * sizeof(uint16_t) + SMOOTH_TEXT_CACHE_ENTRIES * sizeof(Entry);
+  }
+
+ private:
+  struct Entry {
+    uint32_t glyph = 0;   // font << 16 | code point; 0 = empty
+    uint32_t colors = 0;  // fg << 16 | bg
+    uint32_t offset = 0;  // into arena_
+  };
+
+  const uint16_t *blended(AssetId font, const AssetGlyph &glyph, uint16_t fg, uint16_t bg);
+  void flush();
+
+  AssetBundle &bundle_;
+  uint16_t *arena_ = nullptr;
+  Entry entries_[SMOOTH_TEXT_CACHE_ENTRIES];
+  SmoothTextStats stats_;
+};
+
+extern SmoothText smoothText;
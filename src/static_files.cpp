@@ -0,0 +1,203 @@
+#include "static_files.h"
+
+#include <LittleFS.h>
+#include <stdlib.h>
+
+namespace {
+
+const char *const kCollectedHeaders[] = {"Accept-Encoding", "If-None-Match", "Range"};
+
+const char *contentTypeFor(const String &path) {
+  if (path.endsWith(".html") || path.endsWith(".htm")) return "text/html";
+  if (path.endsWith(".css")) return "text/css";
+  if (path.endsWith(".js")) return "application/javascript";
+  if (path.endsWith(".json")) return "application/json";
+  if (path.endsWith(".svg")) return "image/svg+xml";
+  if (path.endsWith(".png")) return "image/png";
+  if (path.endsWith(".ico")) return "image/x-icon";
+  if (path.endsWith(".woff2")) return "font/woff2";
+  if (path.endsWith(".txt")) return "text/plain";
+  return "application/octet-stream";
+}
+
+// Parses a single "bytes=a-b", "bytes=a-" or "bytes=-n" range. Returns
+// false when the range is malformed or unsatisfiable for a file of `size`.
+bool parseRange(const String &header, size_t size, size_t &start, size_t &length) {
+  if (!header.startsWith("bytes=") || header.indexOf(',') >= 0 || size == 0) return false;
+  const char *spec = header.c_str() + 6;
+  const char *dash = strchr(spec, '-');
+  if (!dash) return false;
+
+  char *end = nullptr;
+  if (dash == spec) {
+    unsigned long suffix = strtoul(dash + 1, &end, 10);
+    if (end == dash + 1 || suffix == 0) return false;
+    if (suffix > size) suffix = size;
+    start = size - suffix;
+    length = suffix;
+    return true;
+  }
+
+  unsigned long first = strtoul(spec, &end, 10);
+  if (end != dash || first >= size) return false;
+  unsigned long last = size - 1;
+  if (dash[1] != '\0') {
+    last = strtoul(dash + 1, &end, 10);
+    if (*end != '\0' || last < first) return false;
+    if (last >= size) last = size - 1;
+  }
+  start = first;
+  length = last - first + 1;
+  return true;
+}
+
+// FNV-1a over the whole file, leaving it at offset 0
+uint32_t hashContent(File &file) {
+  uint32_t hash = 2166136261u;
+  uint8_t buf[STATIC_FILE_CHUNK];
+  size_t got;
+  while ((got = file.read(buf, sizeof(buf))) > 0) {
+    for (size_t i = 0; i < got; ++i) hash = (hash ^ buf[i]) * 16777619u;
+  }
+  file.seek(0);
+  return hash;
+}
+
+}  // namespace
+
+StaticFiles::StaticFiles(WebServer &server) : server_(server) {}
+
+bool StaticFiles::begin(const char *const extraHeaders[], size_t extraCount) {
+  constexpr size_t kOwn = sizeof(kCollectedHeaders) / sizeof(kCollectedHeaders[0]);
+  const char *headers[kOwn + STATIC_FILE_EXTRA_HEADERS];
+  size_t count = 0;
+  for (size_t i = 0; i < kOwn; ++i) headers[count++] = kCollectedHeaders[i];
+  for (size_t i = 0; i < extraCount && i < STATIC_FILE_EXTRA_HEADERS; ++i) {
+    headers[count++] = extraHeaders[i];
+  }
+  server_.collectHeaders(headers, count);
+  mounted_ = LittleFS.begin(false);
+  if (!mounted_) {
+    Serial.println("Static files: LittleFS mount failed (run 'pio run -t uploadfs').");
+  }
+  return mounted_;
+}
+
+bool StaticFiles::knownMissing(const String &path) {
+  for (const String &m : missing_) {
+    if (m.length() && m == path) {
+      stats_.missingHits++;
+      return true;
+    }
+  }
+  return false;
+}
+
+StaticFiles::Handle *StaticFiles::open(const String &path) {
+  Handle *victim = &handles_[0];
+  for (auto &h : handles_) {
+    if (h.file && h.path == path) {
+      h.lastUse = ++useClock_;
+      stats_.handleHits++;
+      return &h;
+    }
+    if (!h.file) {
+      victim = &h;
+    } else if (victim->file && h.lastUse < victim->lastUse) {
+      victim = &h;
+    }
+  }
+
+  if (knownMissing(path)) return nullptr;
+  File f = LittleFS.exists(path) ? LittleFS.open(path, "r") : File();
+  if (!f || f.isDirectory()) {
+    missing_[nextMissing_] = path;
+    nextMissing_ = (nextMissing_ + 1) % STATIC_FILE_MISSING;
+    return nullptr;
+  }
+
+  stats_.handleMisses++;
+  if (victim->file) victim->file.close();
+  victim->path = path;
+  victim->file = f;
+  victim->hash = hashContent(victim->file);
+  victim->lastUse = ++useClock_;
+  return victim;
+}
+
+bool StaticFiles::stream(File &file, size_t start, size_t length) {
+  if (!file.seek(start)) return false;
+  uint8_t buf[STATIC_FILE_CHUNK];
+  while (length) {
+    size_t want = length < sizeof(buf) ? length : sizeof(buf);
+    size_t got = file.read(buf, want);
+    if (got == 0) return false;
+    server_.sendContent(reinterpret_cast<const char *>(buf), got);
+    length -= got;
+  }
+  return true;
+}
+
+bool StaticFiles::handle() {
+  if (!mounted_) return false;
+  if (server_.method() != HTTP_GET && server_.method() != HTTP_HEAD) return false;
+
+  String path = server_.uri();
+  if (path.indexOf("..") >= 0) return false;
+  if (path.endsWith("/")) path += "index.html";
+
+  bool gz = false;
+  Handle *handle = nullptr;
+  if (server_.header("Accept-Encoding").indexOf("gzip") >= 0) {
+    handle = open(path + ".gz");
+    gz = (handle != nullptr);
+  }
+  if (!handle) handle = open(path);
+  if (!handle) return false;
+  File *file = &handle->file;
+
+  const size_t size = file->size();
+  char etag[40];
+  snprintf(etag, sizeof(etag), "\"%x-%08x%s\"", (unsigned)size, (unsigned)handle->hash,
+           gz ? "-gz" : "");
+  server_.sendHeader("Vary", "Accept-Encoding");
+
+  if (server_.header("If-None-Match") == etag) {
+    stats_.notModified++;
+    server_.sendHeader("ETag", etag);
+    server_.sendHeader("Cache-Control", "no-cache");
+    server_.send(304);
+    return true;
+  }
+
+  size_t start = 0;
+  size_t length = size;
+  int code = 200;
+  const String range = server_.header("Range");
+  if (range.length()) {
+    if (!parseRange(range, size, start, length)) {
+      server_.sendHeader("Content-Range", String("bytes */") + size);
+      server_.send(416, "text/plain", "");
+      return true;
+    }
+    char contentRange[48];
+    snprintf(contentRange, sizeof(contentRange), "bytes %u-%u/%u", (unsigned)start,
+             (unsigned)(start + length - 1), (unsigned)size);
+    server_.sendHeader("Content-Range", contentRange);
+    code = 206;
+    stats_.partial++;
+  }
+
+  server_.sendHeader("ETag", etag);
+  server_.sendHeader("Cache-Control", "no-cache");
+  server_.sendHeader("Accept-Ranges", "bytes");
+  if (gz) {
+    server_.sendHeader("Content-Encoding", "gzip");
+    stats_.gzip++;
+  }
+  server_.setContentLength(length);
+  server_.send(code, contentTypeFor(path), "");
+  if (server_.method() != HTTP_HEAD) stream(*file, start, length);
+  stats_.served++;
+  return true;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <WebServer.h>
+
+// Read-only static file server backed by the LittleFS partition.
+//
+// Files uploaded from data/ (pio run -t uploadfs) are streamed to the
+// client in small chunks; nothing is copied whole into the heap. Supports
+//   - precompressed variants: foo.js.gz is sent for foo.js when the client
+//     accepts gzip
+//   - strong ETags (size + FNV-1a of the content) with If-None-Match -> 304;
+//     uploadfs images usually carry no mtimes, so the content is hashed
+//   - single byte ranges (Range: bytes=a-b) -> 206 / 416
+// A few file handles are kept open in an LRU, each with its content hash,
+// so hot assets skip the open()/stat() path and the hashing on every
+// request. The partition only changes through uploadfs (which reboots), so
+// paths found missing (foo.js.gz for a plain foo.js, say) are remembered
+// too.
+
+constexpr uint8_t STATIC_FILE_HANDLES = 4;
+constexpr uint8_t STATIC_FILE_MISSING = 8;
+constexpr size_t STATIC_FILE_CHUNK = 1024;
+constexpr size_t STATIC_FILE_EXTRA_HEADERS = 8;  // other handlers' headers begin() takes
+
+struct StaticFileStats {
+  uint32_t served = 0;
+  uint32_t notModified = 0;
+  uint32_t partial = 0;
+  uint32_t gzip = 0;
+  uint32_t handleHits = 0;
+  uint32_t handleMisses = 0;
+  uint32_t missingHits = 0;   // lookups answered by the missing-path cache
+};
+
+class StaticFiles {
+ public:
+  explicit StaticFiles(WebServer &server);
+
+  // Mount the filesystem and register the request headers we need, plus
+  // `extraHeaders` for other handlers (the server keeps a single list).
+  // Call before server.begin().
+  bool begin(const char *const extraHeaders[] = nullptr, size_t extraCount = 0);
+
+  // Serve server.uri() if a matching file exists. Returns false (nothing
+  // sent) when there is no such file so the caller can fall back.
+  bool handle();
+
+  bool mounted() const { return mounted_; }
+  const StaticFileStats &stats() const { return stats_; }
+
+ private:
+  struct Handle {
+    String path;
+    File file;
+    uint32_t hash = 0;  // of the content, for the ETag
+    uint32_t lastUse = 0;
+  };
+
+  Handle *open(const String &path);
+  bool knownMissing(const String &path);
+  bool stream(File &file, size_t start, size_t length);
+
+  WebServer &server_;
+  Handle handles_[STATIC_FILE_HANDLES];
+  String missing_[STATIC_FILE_MISSING];
+  uint8_t nextMissing_ = 0;
+  uint32_t useClock_ = 0;
+  bool mounted_ = false;
+  StaticFileStats stats_{};
+};
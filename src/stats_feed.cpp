@@ -0,0 +1,97 @@
+#include "stats_feed.h"
+
+#include <math.h>
+#include <limits.h>
+
+StatsFeed statsFeed;
+
+namespace {
+
+constexpr int32_t kNullFixed = INT32_MIN;
+constexpr float kPow10[] = {1.0f, 10.0f, 100.0f, 1000.0f};
+
+int32_t toFixed(const Stats &stats, uint8_t field) {
+  const StatsFieldInfo &info = STATS_FIELDS[field];
+  float v = stats.*(info.member);
+  if (isnan(v) || v < info.invalidBelow) return kNullFixed;
+  float scaled = v * kPow10[info.decimals];
+  if (scaled > 1e9f) scaled = 1e9f;
+  if (scaled < -1e9f) scaled = -1e9f;
+  return static_cast<int32_t>(lroundf(scaled));
+}
+
+size_t putVarint(uint8_t *out, uint32_t v) {
+  size_t n = 0;
+  while (v >= 0x80) {
+    out[n++] = static_cast<uint8_t>(v | 0x80);
+    v >>= 7;
+  }
+  out[n++] = static_cast<uint8_t>(v);
+  return n;
+}
+
+uint32_t wireValue(int32_t fixed) {
+  if (fixed == kNullFixed) return 0;
+  uint32_t zigzag = (static_cast<uint32_t>(fixed) << 1) ^ static_cast<uint32_t>(fixed >> 31);
+  return zigzag + 1;
+}
+
+}  // namespace
+
+StatsFeed::StatsFeed() : ws_(STATS_FEED_PORT) {
+  Stats defaults;
+  for (uint8_t i = 0; i < STAT_COUNT; ++i) sent_[i] = toFixed(defaults, i);
+}
+
+void StatsFeed::begin() {
+  ws_.onEvent([this](uint8_t num, WStype_t type, uint8_t *payload, size_t length) {
+    onEvent(num, type, payload, length);
+  });
+  ws_.begin();
+  started_ = true;
+}
+
+void StatsFeed::loop() {
+  if (started_) ws_.loop();
+}
+
+void StatsFeed::onEvent(uint8_t num, WStype_t type, uint8_t *payload, size_t length) {
+  (void)payload;
+  (void)length;
+  if (type != WStype_CONNECTED) return;
+  // New viewers start from the state every other client already holds.
+  uint8_t frame[STATS_FRAME_MAX];
+  size_t len = encode(STATS_FRAME_SNAPSHOT, (1u << STAT_COUNT) - 1, frame);
+  ws_.sendBIN(num, frame, len);
+  framesSent_++;
+  bytesSent_ += len;
+}
+
+size_t StatsFeed::encode(uint8_t type, uint16_t mask, uint8_t *out) const {
+  size_t n = 0;
+  out[n++] = type;
+  out[n++] = static_cast<uint8_t>(mask & 0xFF);
+  out[n++] = static_cast<uint8_t>(mask >> 8);
+  for (uint8_t i = 0; i < STAT_COUNT; ++i) {
+    if (mask & (1u << i)) n += putVarint(out + n, wireValue(sent_[i]));
+  }
+  return n;
+}
+
+void StatsFeed::publish(const Stats &stats) {
+  uint16_t mask = 0;
+  for (uint8_t i = 0; i < STAT_COUNT; ++i) {
+    int32_t fixed = toFixed(stats, i);
+    if (fixed != sent_[i]) {
+      sent_[i] = fixed;
+      mask |= (1u << i);
+    }
+  }
+  if (!started_ || ws_.connectedClients() == 0) return;
+
+  uint8_t frame[STATS_FRAME_MAX];
+  size_t len = encode(STATS_FRAME_DELTA, mask, frame);
+  ws_.broadcastBIN(frame, len);
+  framesSent_++;
+  bytesSent_ += len;
+}
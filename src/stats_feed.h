@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WebSocketsServer.h>
+
+#include "pc_stats.h"
+
+// Live PC stats over WebSocket (ws://<ip>:81/ws).
+//
+// Each client gets one snapshot frame on connect, then exactly one delta
+// frame per sample containing only the fields whose fixed-point value
+// changed (an empty mask still marks a sample, so charts keep cadence).
+// Frame layout (all little-endian):
+//   u8  type      STATS_FRAME_SNAPSHOT or STATS_FRAME_DELTA
+//   u16 mask      bit i set => StatsField i follows
+//   varint[]      one per set bit, ascending field order:
+//                 0 = null, otherwise zigzag(fixed) + 1 where
+//                 fixed = round(value * 10^STATS_FIELDS[i].decimals)
+// A full snapshot is ~25 bytes; a typical delta is 3-12 bytes.
+// Snapshots describe the latest sample and do not count as a new one.
+
+constexpr uint16_t STATS_FEED_PORT = 81;
+constexpr uint8_t STATS_FRAME_SNAPSHOT = 0x01;
+constexpr uint8_t STATS_FRAME_DELTA = 0x02;
+constexpr size_t STATS_FRAME_MAX = 3 + STAT_COUNT * 5;
+
+class StatsFeed {
+ public:
+  StatsFeed();
+
+  void begin();
+  void loop();
+
+  // Diff against the last broadcast state and push a delta to all clients.
+  void publish(const Stats &stats);
+
+  uint8_t clientCount() { return ws_.connectedClients(); }
+  uint32_t framesSent() const { return framesSent_; }
+  uint32_t bytesSent() const { return bytesSent_; }
+
+ private:
+  void onEvent(uint8_t num, WStype_t type, uint8_t *payload, size_t length);
+  size_t encode(uint8_t type, uint16_t mask, uint8_t *out) const;
+
+  WebSocketsServer ws_;
+  int32_t sent_[STAT_COUNT];
+  bool started_ = false;
+  uint32_t framesSent_ = 0;
+  uint32_t bytesSent_ = 0;
+};
+
+extern StatsFeed statsFeed;
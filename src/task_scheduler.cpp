@@ -0,0 +1,220 @@
+#include "task_scheduler.h"
+
+#include "trace.h"
+
+TaskScheduler renderScheduler;
+TaskScheduler ioScheduler;
+
+namespace {
+
+constexpr uint8_t kSlotMask = (1 << SCHED_WHEEL_BITS) - 1;
+
+uint32_t levelSpan(uint8_t level) { return 1UL << (SCHED_WHEEL_BITS * level); }
+
+}  // namespace
+
+void TaskScheduler::begin(uint32_t nowMs) {
+  for (auto &level : wheel_) {
+    for (int8_t &head : level) head = SCHED_NO_TASK;
+  }
+  for (uint64_t &bits : occupied_) bits = 0;
+  now_ = nowMs;
+  ready_ = 0;
+  count_ = 0;
+  windowStartUs_ = micros();
+}
+
+int8_t TaskScheduler::add(const char *name, SchedFn fn, uint32_t periodMs,
+                          SchedPriority priority, uint32_t delayMs) {
+  static_assert(SCHED_MAX_TASKS <= 16, "ready_ holds one bit per task");
+  if (count_ >= SCHED_MAX_TASKS || !fn) return SCHED_NO_TASK;
+  int8_t id = count_++;
+  Task &t = tasks_[id];
+  t = Task();
+  t.fn = fn;
+  t.lastRunMs = now_;
+  t.stats.name = name;
+  t.stats.periodMs = periodMs < SCHED_MAX_PERIOD_MS ? periodMs : SCHED_MAX_PERIOD_MS;
+  t.stats.priority = priority;
+  arm(id, now_ + delayMs);
+  return id;
+}
+
+void TaskScheduler::setPeriod(int8_t id, uint32_t periodMs) {
+  if (id < 0 || id >= count_) return;
+  Task &t = tasks_[id];
+  if (periodMs > SCHED_MAX_PERIOD_MS) periodMs = SCHED_MAX_PERIOD_MS;
+  if (t.stats.periodMs == periodMs) return;
+  t.stats.periodMs = periodMs;
+  // A running task is re-armed with the new period when it returns.
+  if (t.state == ARMED || t.state == READY) {
+    disarm(id);
+    arm(id, t.lastRunMs + periodMs);
+  }
+}
+
+void TaskScheduler::wake(int8_t id) {
+  if (id < 0 || id >= count_) return;
+  Task &t = tasks_[id];
+  if (t.state == READY) return;
+  if (t.state == ARMED) disarm(id);
+  // Woken while running: it goes again on the next runDue().
+  t.deadline = now_;
+  t.state = READY;
+  ready_ |= 1u << id;
+}
+
+void TaskScheduler::arm(int8_t id, uint32_t deadline) {
+  Task &t = tasks_[id];
+  t.deadline = deadline;
+  int32_t delta = (int32_t)(deadline - now_);
+  if (delta <= 0) {
+    t.state = READY;
+    ready_ |= 1u << id;
+    return;
+  }
+  uint8_t level = 0;
+  while (level + 1 < SCHED_WHEEL_LEVELS && (uint32_t)delta >= levelSpan(level + 1)) ++level;
+  uint8_t slot = (deadline >> (SCHED_WHEEL_BITS * level)) & kSlotMask;
+  t.level = level;
+  t.slot = slot;
+  t.next = wheel_[level][slot];
+  t.state = ARMED;
+  wheel_[level][slot] = id;
+  occupied_[level] |= 1ULL << slot;
+}
+
+void TaskScheduler::disarm(int8_t id) {
+  Task &t = tasks_[id];
+  if (t.state == READY) {
+    ready_ &= ~(1u << id);
+  } else if (t.state == ARMED) {
+    int8_t *link = &wheel_[t.level][t.slot];
+    while (*link != id) link = &tasks_[*link].next;
+    *link = t.next;
+    if (wheel_[t.level][t.slot] == SCHED_NO_TASK) occupied_[t.level] &= ~(1ULL << t.slot);
+  }
+  t.next = SCHED_NO_TASK;
+  t.state = IDLE;
+}
+
+// Re-file every task in a coarse slot against the current wheel time; each
+// lands in a finer level (or straight in the ready set).
+void TaskScheduler::cascade(uint8_t level, uint8_t slot) {
+  int8_t id = wheel_[level][slot];
+  wheel_[level][slot] = SCHED_NO_TASK;
+  occupied_[level] &= ~(1ULL << slot);
+  while (id != SCHED_NO_TASK) {
+    int8_t next = tasks_[id].next;
+    arm(id, tasks_[id].deadline);
+    id = next;
+  }
+}
+
+void TaskScheduler::advance(uint32_t nowMs) {
+  while ((int32_t)(nowMs - now_) > 0) {
+    ++now_;
+    for (uint8_t level = 1; level < SCHED_WHEEL_LEVELS; ++level) {
+      if (now_ & (levelSpan(level) - 1)) break;
+      cascade(level, (now_ >> (SCHED_WHEEL_BITS * level)) & kSlotMask);
+    }
+
+    uint8_t slot = now_ & kSlotMask;
+    if (occupied_[0] & (1ULL << slot)) {
+      int8_t id = wheel_[0][slot];
+      wheel_[0][slot] = SCHED_NO_TASK;
+      occupied_[0] &= ~(1ULL << slot);
+      while (id != SCHED_NO_TASK) {
+        int8_t next = tasks_[id].next;
+        tasks_[id].next = SCHED_NO_TASK;
+        tasks_[id].state = READY;
+        ready_ |= 1u << id;
+        id = next;
+      }
+    }
+
+    // Nothing left in this 64 ms block: skip to its last tick (the next
+    // boundary may cascade).
+    uint64_t later = slot == kSlotMask ? 0 : occupied_[0] >> (slot + 1);
+    if (!later) {
+      uint32_t blockEnd = now_ | kSlotMask;
+      now_ = (int32_t)(nowMs - blockEnd) < 0 ? nowMs : blockEnd;
+    }
+  }
+}
+
+uint32_t TaskScheduler::runDue(uint32_t nowMs) {
+  advance(nowMs);
+
+  // Tasks woken from here on wait for the next call.
+  uint16_t due = ready_;
+  while (due) {
+    int8_t id = SCHED_NO_TASK;
+    for (uint8_t i = 0; i < count_; ++i) {
+      if (!(due & (1u << i))) continue;
+      if (id == SCHED_NO_TASK || tasks_[i].stats.priority < tasks_[id].stats.priority) id = i;
+    }
+    due &= ~(1u << id);
+    Task &t = tasks_[id];
+    if (t.state != READY) continue;  // re-armed by an earlier task
+
+    ready_ &= ~(1u << id);
+    t.state = RUNNING;
+    SchedTaskStats &s = t.stats;
+    uint32_t lateMs = nowMs - t.deadline;
+    if (lateMs > s.maxLateMs) s.maxLateMs = lateMs;
+
+    uint32_t start = micros();
+    t.fn();
+    uint32_t elapsed = micros() - start;
+    trace.complete(s.name, start, elapsed);
+
+    s.runs++;
+    s.lastUs = elapsed;
+    if (elapsed > s.maxUs) s.maxUs = elapsed;
+    t.windowUs += elapsed;
+    t.windowRuns++;
+    t.lastRunMs = nowMs;
+
+    if (t.state == RUNNING) {
+      // Keep the cadence; if a whole period was lost, restart it from now.
+      uint32_t next = t.deadline + s.periodMs;
+      if ((int32_t)(next - nowMs) <= 0) {
+        next = nowMs + s.periodMs;
+        s.overruns++;
+      }
+      arm(id, next);
+    }
+  }
+
+  updateLoad(micros());
+  return msUntilNext(millis());
+}
+
+uint32_t TaskScheduler::msUntilNext(uint32_t nowMs) const {
+  if (ready_) return 0;
+  uint32_t best = SCHED_LOAD_WINDOW_MS;
+  for (uint8_t i = 0; i < count_; ++i) {
+    if (tasks_[i].state != ARMED) continue;
+    int32_t wait = (int32_t)(tasks_[i].deadline - nowMs);
+    if (wait <= 0) return 0;
+    if ((uint32_t)wait < best) best = wait;
+  }
+  return best;
+}
+
+void TaskScheduler::updateLoad(uint32_t nowUs) {
+  uint32_t elapsed = nowUs - windowStartUs_;
+  if (elapsed < SCHED_LOAD_WINDOW_MS * 1000UL) return;
+  uint32_t busy = 0;
+  for (uint8_t i = 0; i < count_; ++i) {
+    Task &t = tasks_[i];
+    t.stats.loadPermille = (uint64_t)t.windowUs * 1000 / elapsed;
+    t.stats.avgUs = t.windowRuns ? t.windowUs / t.windowRuns : 0;
+    busy += t.stats.loadPermille;
+    t.windowUs = 0;
+    t.windowRuns = 0;
+  }
+  idlePermille_ = busy < 1000 ? 1000 - busy : 0;
+  windowStartUs_ = nowUs;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Cooperative scheduler for the periodic work of one FreeRTOS task.
+//
+// There is one instance per core (see main.cpp): jobs register once, and
+// the owning task runs whatever is due and then sleeps until the next
+// deadline instead of spinning. Deadlines live in a hierarchical timer wheel
+// on the millis() clock: SCHED_WHEEL_LEVELS levels of 64 slots at 1 ms,
+// 64 ms, 4.1 s and 262 s per slot. A job sits in the coarsest slot that
+// fits its deadline and cascades down as the wheel turns, so arming and
+// expiring are O(1) and advancing skips empty stretches a block at a time.
+//
+// Every comparison is on the difference of two uint32_t stamps, so the
+// 49-day millis() wrap is harmless. Jobs that fall due together run highest
+// priority first (registration order breaks ties), and each run is timed
+// with micros() for per-job CPU accounting.
+//
+// Only the owning task may call the non-const members. The stats are plain
+// 32-bit words, so another core can read them for reporting.
+
+constexpr uint8_t SCHED_MAX_TASKS = 8;
+constexpr uint8_t SCHED_WHEEL_LEVELS = 4;
+constexpr uint8_t SCHED_WHEEL_BITS = 6;  // 64 slots per level
+constexpr uint32_t SCHED_MAX_PERIOD_MS = (1UL << (SCHED_WHEEL_LEVELS * SCHED_WHEEL_BITS)) - 1;
+constexpr uint32_t SCHED_LOAD_WINDOW_MS = 5000;  // utilisation averaging window
+constexpr int8_t SCHED_NO_TASK = -1;
+
+enum SchedPriority : uint8_t { SCHED_PRIO_HIGH, SCHED_PRIO_NORMAL, SCHED_PRIO_LOW };
+
+typedef void (*SchedFn)();
+
+struct SchedTaskStats {
+  const char *name = nullptr;
+  uint32_t periodMs = 0;
+  SchedPriority priority = SCHED_PRIO_NORMAL;
+  uint32_t runs = 0;
+  uint32_t lastUs = 0;
+  uint32_t maxUs = 0;
+  uint32_t avgUs = 0;         // per run, over the last load window
+  uint16_t loadPermille = 0;  // share of the last load window
+  uint32_t overruns = 0;      // runs that started a whole period late
+  uint32_t maxLateMs = 0;
+};
+
+class TaskScheduler {
+ public:
+  // Start the wheel at `nowMs`. Call before add().
+  void begin(uint32_t nowMs);
+
+  // Register `fn` to run `delayMs` from now and then every `periodMs`
+  // (clamped to SCHED_MAX_PERIOD_MS). Returns the task id, or SCHED_NO_TASK
+  // when the table is full.
+  int8_t add(const char *name, SchedFn fn, uint32_t periodMs, SchedPriority priority,
+             uint32_t delayMs = 0);
+
+  // New period, counted from the task's last run. Safe to call from inside
+  // the task itself.
+  void setPeriod(int8_t id, uint32_t periodMs);
+
+  // Run the task on the next runDue() (e.g. new data to show).
+  void wake(int8_t id);
+
+  // Run every task due at `nowMs`. Returns the milliseconds until the next
+  // deadline, i.e. how long the caller may sleep.
+  uint32_t runDue(uint32_t nowMs);
+
+  uint32_t msUntilNext(uint32_t nowMs) const;
+
+  uint8_t taskCount() const { return count_; }
+  const SchedTaskStats &stats(uint8_t id) const { return tasks_[id].stats; }
+  // Share of the last load window not spent in any task.
+  uint16_t idlePermille() const { return idlePermille_; }
+
+ private:
+  enum State : uint8_t { IDLE, ARMED, READY, RUNNING };
+
+  struct Task {
+    SchedFn fn = nullptr;
+    uint32_t deadline = 0;
+    uint32_t lastRunMs = 0;
+    uint32_t windowUs = 0;
+    uint32_t windowRuns = 0;
+    State state = IDLE;
+    uint8_t level = 0;
+    uint8_t slot = 0;
+    int8_t next = SCHED_NO_TASK;  // next task in the same wheel slot
+    SchedTaskStats stats;
+  };
+
+  void arm(int8_t id, uint32_t deadline);
+  void disarm(int8_t id);
+  void advance(uint32_t nowMs);
+  void cascade(uint8_t level, uint8_t slot);
+  void updateLoad(uint32_t nowUs);
+
+  Task tasks_[SCHED_MAX_TASKS];
+  uint8_t count_ = 0;
+  int8_t wheel_[SCHED_WHEEL_LEVELS][1 << SCHED_WHEEL_BITS];
+  uint64_t occupied_[SCHED_WHEEL_LEVELS] = {0};
+  uint32_t now_ = 0;      // wheel time: everything at or before it has expired
+  uint16_t ready_ = 0;    // bit per task due on this or the next runDue()
+  uint32_t windowStartUs_ = 0;
+  uint16_t idlePermille_ = 1000;
+};
+
+extern TaskScheduler renderScheduler;  // loop task: touch, samples in, frames out
+extern TaskScheduler ioScheduler;      // io task: serial, HTTP, weather, telemetry
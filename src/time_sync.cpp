@@ -0,0 +1,73 @@
+#include "time_sync.h"
+
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+
+TimeSync timeSync;
+
+void TimeSync::begin() {
+  sntp_set_sync_mode(SNTP_SYNC_MODE_IMMED);  // smooth after the first sync
+  sntp_set_sync_interval(TIME_SYNC_INTERVAL_MS);
+  sntp_set_time_sync_notification_cb(&TimeSync::onSync);
+  // Only configures and starts the SNTP client; returns immediately.
+  configTime(0, 0, NTP_SERVER_1, NTP_SERVER_2, NTP_SERVER_3);
+  lastProgressMs_ = millis();
+}
+
+void TimeSync::check(uint32_t nowMs) {
+  uint32_t syncs = syncs_.load();
+  if (syncs != seenSyncs_) {
+    seenSyncs_ = syncs;
+    lastProgressMs_ = nowMs;
+    Serial.printf("Time: sync #%lu, offset %ld ms, drift %.2f ppm\n", (unsigned long)syncs,
+                  (long)lastOffsetMs_.load(), driftPpb_.load() / 1000.0f);
+    return;
+  }
+  if (nowMs - lastProgressMs_ >= TIME_SYNC_STALE_MS) {
+    lastProgressMs_ = nowMs;
+    restarts_++;
+    Serial.println("Time: no SNTP sync lately, restarting client");
+    sntp_restart();
+  }
+}
+
+TimeSyncStats TimeSync::stats() const {
+  TimeSyncStats s;
+  s.syncs = syncs_.load();
+  s.synced = s.syncs > 0;
+  s.lastSyncEpoch = lastSyncEpoch_.load();
+  s.lastOffsetMs = lastOffsetMs_.load();
+  s.driftPpm = driftPpb_.load() / 1000.0f;
+  s.restarts = restarts_;
+  return s;
+}
+
+// Runs in the lwIP task after IDF has applied the new time: a slew still
+// in progress shows up as adjtime()'s outstanding delta, a step as the
+// difference between the server time and the (already stepped) clock.
+void TimeSync::onSync(struct timeval *tv) {
+  TimeSync &self = timeSync;
+
+  struct timeval pending = {0, 0};
+  adjtime(nullptr, &pending);
+  int64_t offsetUs = (int64_t)pending.tv_sec * 1000000 + pending.tv_usec;
+  if (offsetUs == 0) {
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    offsetUs = ((int64_t)tv->tv_sec - now.tv_sec) * 1000000 + (tv->tv_usec - now.tv_usec);
+  }
+
+  int64_t nowUs = esp_timer_get_time();
+  if (self.lastSyncUs_ > 0 && nowUs > self.lastSyncUs_) {
+    // Offset accumulated over the interval, in parts per billion.
+    int64_t ppb = offsetUs * 1000000000LL / (nowUs - self.lastSyncUs_);
+    self.driftPpb_.store((int32_t)ppb);
+  }
+  self.lastSyncUs_ = nowUs;
+
+  self.lastOffsetMs_.store((int32_t)(offsetUs / 1000));
+  self.lastSyncEpoch_.store((uint32_t)tv->tv_sec);
+  // First sync stepped the clock; slew from now on
+  if (self.syncs_.fetch_add(1) == 0) sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#include "weather_config.h"
+
+// Background SNTP for the system clock (which is what ESP32Time reads).
+//
+// The lwIP SNTP client runs in the TCP/IP task, so nothing on the loop ever
+// waits for a time server. The first sync always steps the clock into place
+// (immediate mode), even if the weather fetch already set it roughly from
+// an observation time; smooth mode would slew that error out over hours.
+// Re-syncs every TIME_SYNC_INTERVAL_MS after that are in smooth mode,
+// slewed with adjtime() instead of jumping (IDF falls back to a step only
+// for offsets beyond its adjtime limit). The sync callback records each
+// correction and estimates the crystal drift from it.
+//
+// check() runs from the loop scheduler: it logs new corrections and
+// restarts the client if no sync has landed for TIME_SYNC_STALE_MS.
+
+constexpr uint32_t TIME_SYNC_STALE_MS = 3 * TIME_SYNC_INTERVAL_MS;
+
+struct TimeSyncStats {
+  bool synced = false;
+  uint32_t syncs = 0;
+  uint32_t lastSyncEpoch = 0;
+  int32_t lastOffsetMs = 0;  // server minus local clock at the last sync
+  float driftPpm = 0;        // lastOffset / time since the previous sync
+  uint32_t restarts = 0;     // SNTP restarted after going stale
+};
+
+class TimeSync {
+ public:
+  // Start SNTP. Non-blocking; call once WiFi is up.
+  void begin();
+
+  // Periodic health check from the loop task.
+  void check(uint32_t nowMs);
+
+  bool synced() const { return syncs_.load() > 0; }
+  TimeSyncStats stats() const;
+
+ private:
+  static void onSync(struct timeval *tv);
+
+  std::atomic<uint32_t> syncs_{0};
+  std::atomic<uint32_t> lastSyncEpoch_{0};
+  std::atomic<int32_t> lastOffsetMs_{0};
+  std::atomic<int32_t> driftPpb_{0};
+  int64_t lastSyncUs_ = 0;  // callback-only
+  uint32_t seenSyncs_ = 0;  // check()-only from here on
+  uint32_t lastProgressMs_ = 0;
+  uint32_t restarts_ = 0;
+};
+
+extern TimeSync timeSync;
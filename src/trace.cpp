@@ -0,0 +1,162 @@
+#include "trace.h"
+
+TraceBuffer trace;
+
+namespace {
+
+constexpr uint8_t kUnknownTask = TRACE_MAX_TASKS;  // task table full
+constexpr uint32_t kCalibrationSpans = 1000;
+
+}  // namespace
+
+bool TraceBuffer::begin() {
+  if (!events_) {
+    size_t count = TRACE_EVENTS;
+    events_ = static_cast<TraceEvent *>(ps_malloc(count * sizeof(TraceEvent)));
+    if (!events_) {
+      count = TRACE_FALLBACK_EVENTS;
+      events_ = static_cast<TraceEvent *>(malloc(count * sizeof(TraceEvent)));
+    }
+    if (!events_) return false;
+    mask_ = count - 1;
+  }
+
+  // What instrumentation costs here: timestamps included
+  enabled_.store(true);
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < kCalibrationSpans; ++i) TraceScope span("calibrate");
+  uint32_t elapsed = micros() - start;
+  spanNs_ = (uint16_t)min(elapsed * 1000UL / kCalibrationSpans, 65535UL);
+  clear();
+  return true;
+}
+
+void TraceBuffer::clear() {
+  bool was = enabled();
+  setEnabled(false);
+  for (uint32_t i = 0; events_ && i <= mask_; ++i) {
+    events_[i].name.store(nullptr, std::memory_order_relaxed);
+  }
+  head_.store(0);
+  setEnabled(was);
+}
+
+// Index of the calling task, registering it on first use.
+uint8_t TraceBuffer::taskId() {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  uint8_t count = taskCount_.load(std::memory_order_acquire);
+  for (uint8_t i = 0; i < count; ++i) {
+    if (tasks_[i].handle.load(std::memory_order_relaxed) == self) return i;
+  }
+  uint8_t slot = taskCount_.load(std::memory_order_relaxed);
+  do {
+    if (slot >= TRACE_MAX_TASKS) return kUnknownTask;
+  } while (!taskCount_.compare_exchange_weak(slot, slot + 1, std::memory_order_acq_rel));
+  strlcpy(tasks_[slot].name, pcTaskGetName(self), sizeof(tasks_[slot].name));
+  tasks_[slot].handle.store(self, std::memory_order_release);
+  return slot;
+}
+
+void TraceBuffer::record(const char *name, uint32_t startUs, uint32_t durUs, char phase) {
+  if (!events_ || !enabled_.load(std::memory_order_relaxed)) return;
+  uint8_t task = taskId();
+  TraceEvent &e = events_[head_.fetch_add(1, std::memory_order_relaxed) & mask_];
+  e.name.store(nullptr, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  e.startUs = startUs;
+  e.durUs = durUs;
+  e.task = task;
+  e.phase = phase;
+  e.name.store(name, std::memory_order_release);
+}
+
+// Copy of a slot, or false if it is empty or a writer is still in it.
+bool TraceBuffer::snapshot(uint32_t index, TraceEvent &out) const {
+  const TraceEvent &e = events_[index & mask_];
+  const char *name = e.name.load(std::memory_order_acquire);
+  if (!name) return false;
+  out.startUs = e.startUs;
+  out.durUs = e.durUs;
+  out.task = e.task;
+  out.phase = e.phase;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (e.name.load(std::memory_order_relaxed) != name) return false;
+  // Still event `index`, not a newer one that lapped it
+  if (head_.load(std::memory_order_relaxed) - index > mask_ + 1) return false;
+  out.name.store(name, std::memory_order_relaxed);
+  return true;
+}
+
+TraceStats TraceBuffer::stats() const {
+  TraceStats s;
+  s.recorded = head_.load(std::memory_order_relaxed);
+  s.capacity = events_ ? mask_ + 1 : 0;
+  s.spanNs = spanNs_;
+  return s;
+}
+
+void TraceBuffer::writeJson(Print &out) const {
+  TraceDump dump(*this);
+  dump.begin();
+  while (dump.write(out, UINT32_MAX)) {
+  }
+}
+
+void TraceDump::begin() {
+  end_ = trace_.head_.load();
+  next_ = end_ - (trace_.events_ ? min(end_, trace_.mask_ + 1) : 0);
+
+  // Timestamps relative to the earliest start held, so the 71-minute
+  // micros() wrap doesn't matter
+  baseUs_ = 0;
+  bool haveBase = false;
+  TraceEvent e;
+  for (uint32_t i = next_; i != end_; ++i) {
+    if (!trace_.snapshot(i, e)) continue;
+    if (!haveBase || (int32_t)(e.startUs - baseUs_) < 0) baseUs_ = e.startUs;
+    haveBase = true;
+  }
+  skipped_ = 0;
+  started_ = false;
+  active_ = true;
+}
+
+bool TraceDump::write(Print &out, uint32_t maxEvents) {
+  if (!active_) return false;
+  if (!started_) {
+    started_ = true;
+    out.print("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    out.print("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+              "\"args\":{\"name\":\"PC Monitor\"}}\n");
+    uint8_t tasks = trace_.taskCount_.load(std::memory_order_acquire);
+    for (uint8_t i = 0; i < tasks; ++i) {
+      if (!trace_.tasks_[i].handle.load(std::memory_order_acquire)) continue;
+      out.printf(",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                 "\"args\":{\"name\":\"%s\"}}\n",
+                 i, trace_.tasks_[i].name);
+    }
+  }
+
+  TraceEvent e;
+  for (uint32_t written = 0; written < maxEvents && next_ != end_; ++next_) {
+    if (!trace_.snapshot(next_, e)) {
+      skipped_++;
+      continue;
+    }
+    const char *name = e.name.load(std::memory_order_relaxed);
+    uint32_t ts = e.startUs - baseUs_;
+    if (e.phase == 'X') {
+      out.printf(",{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%u,\"dur\":%u,\"pid\":1,\"tid\":%u}\n",
+                 name, (unsigned)ts, (unsigned)e.durUs, e.task);
+    } else {
+      out.printf(",{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%u,\"pid\":1,\"tid\":%u}\n",
+                 name, (unsigned)ts, e.task);
+    }
+    written++;
+  }
+  if (next_ != end_) return true;
+
+  out.printf("],\"otherData\":{\"skipped\":%u}}\n", (unsigned)skipped_);
+  active_ = false;
+  return false;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <atomic>
+
+// Event trace of both cores, exportable as Chrome trace JSON (open it in
+// ui.perfetto.dev or chrome://tracing).
+//
+// A span is one record written when it ends: start and duration on the
+// micros() clock (shared by both cores), a name and the FreeRTOS task it
+// ran on. Records go into a fixed ring claimed with one atomic add, so any
+// task can write without a lock and the newest TRACE_EVENTS are kept. Names
+// must be string literals (or otherwise outlive the trace) and need no JSON
+// escaping.
+//
+// Every scheduler job is traced (task_scheduler.cpp), plus the work inside
+// them worth telling apart: HTTP requests, serial bursts, sprite pushes,
+// weather fetches.
+//
+// A dump (TraceDump) covers the events held when it began and leaves
+// recording running, so a slow dump leaves no gap in the trace. A writer
+// publishes the name last (release) after clearing it, and the dump takes
+// an event only if it reads the same name before and after copying it and
+// the ring hasn't reclaimed the slot since; an event rewritten or lapped
+// before the dump reaches it is skipped rather than torn. One case
+// remains: a writer stalled between claiming its slot and filling it
+// while the whole ring wraps shares the slot with a newer writer, and the
+// event can come out with one writer's name and the other's times.
+//
+// The serial TRACE command dumps from an I/O core job a few lines per tick,
+// so ingest, HTTP and weather keep running. /debug/trace writes the whole
+// dump from its HTTP handler; that time is charged to the HTTP budget
+// (http_guard.h) like any other request.
+
+constexpr size_t TRACE_EVENTS = 8192;  // power of two; 16 B each (PSRAM)
+constexpr size_t TRACE_FALLBACK_EVENTS = 512;  // no PSRAM
+constexpr uint8_t TRACE_MAX_TASKS = 8;
+
+struct TraceEvent {
+  uint32_t startUs;
+  uint32_t durUs;
+  std::atomic<const char *> name;  // nullptr while the slot is being written
+  uint8_t task;   // index into the task table
+  char phase;     // 'X' span, 'i' instant
+};
+
+struct TraceStats {
+  uint32_t recorded = 0;  // since boot or clear(), including overwritten ones
+  uint32_t capacity = 0;
+  uint16_t spanNs = 0;    // measured cost of one TraceScope at begin()
+};
+
+class TraceBuffer {
+ public:
+  // Allocate the ring and measure the per-span cost.
+  bool begin();
+
+  void complete(const char *name, uint32_t startUs, uint32_t durUs) {
+    record(name, startUs, durUs, 'X');
+  }
+  void instant(const char *name) { record(name, micros(), 0, 'i'); }
+
+  void setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+  void clear();
+
+  // Chrome trace JSON of everything held, oldest first, written in one go.
+  void writeJson(Print &out) const;
+
+  TraceStats stats() const;
+
+ private:
+  friend class TraceDump;
+
+  struct Task {
+    std::atomic<TaskHandle_t> handle{nullptr};
+    char name[16] = "";
+  };
+
+  void record(const char *name, uint32_t startUs, uint32_t durUs, char phase);
+  bool snapshot(uint32_t index, TraceEvent &out) const;
+  uint8_t taskId();
+
+  TraceEvent *events_ = nullptr;
+  uint32_t mask_ = 0;
+  std::atomic<uint32_t> head_{0};
+  std::atomic<bool> enabled_{false};
+  Task tasks_[TRACE_MAX_TASKS];
+  std::atomic<uint8_t> taskCount_{0};
+  uint16_t spanNs_ = 0;
+};
+
+extern TraceBuffer trace;
+
+// Chrome trace JSON of what a TraceBuffer held at begin(), written a slice
+// at a time. Every write() ends on a line break (one event per line), so
+// lines printed between slices don't split an event. Events overwritten
+// before the dump reached them are counted in otherData.skipped.
+class TraceDump {
+ public:
+  explicit TraceDump(const TraceBuffer &trace) : trace_(trace) {}
+
+  void begin();
+  bool active() const { return active_; }
+
+  // The header on the first call, then up to maxEvents events, then the
+  // footer after the last one. False once the dump is complete.
+  bool write(Print &out, uint32_t maxEvents);
+
+ private:
+  const TraceBuffer &trace_;
+  bool active_ = false;
+  bool started_ = false;
+  uint32_t next_ = 0;
+  uint32_t end_ = 0;
+  uint32_t baseUs_ = 0;
+  uint32_t skipped_ = 0;
+};
+
+// Times its own lifetime as one span.
+class TraceScope {
+ public:
+  explicit TraceScope(const char *name) : name_(name), startUs_(micros()) {}
+  ~TraceScope() { trace.complete(name_, startUs_, micros() - startUs_); }
+
+ private:
+  const char *name_;
+  uint32_t startUs_;
+};
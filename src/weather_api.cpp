@@ -1,92 +1,272 @@
 #include "weather_api.h"
 
 #include <HTTPClient.h>
+#include <StreamString.h>
 #include <WiFi.h>
 #include <algorithm>
+#include <ctype.h>
 #include <math.h>
+#include <stdio.h>
+#include <strings.h>
 #include <time.h>
 #include <limits.h>
 
 #include <ArduinoJson.h>
 
-#include "secrets.h"
+#include "forecast_parser.h"
+#include "time_sync.h"
+#include "weather_scheduler.h"
 
 namespace {
 
-constexpr uint32_t kSecondsPerDay = 86400;
-constexpr uint32_t kMiddaySeconds = 12 * 3600;
-
-struct ForecastBucket {
-  bool used = false;
-  float tempMin = 1e6f;
-  float tempMax = -1e6f;
-  uint32_t representativeTs = 0;
-  uint32_t bestDelta = UINT32_MAX;
-  char description[48] = "";
-  char icon[4] = "01d";
-};
-
 void resetForecast(WeatherData &data) {
   for (auto &entry : data.forecast) {
     entry.timestamp = 0;
     entry.tempMin = NAN;
     entry.tempMax = NAN;
     entry.description[0] = '\0';
-    strlcpy(entry.icon, "01d", sizeof(entry.icon));
+    entry.icon = WEATHER_ICON_DEFAULT;
     entry.label[0] = '\0';
+    entry.pop = 0;
     entry.valid = false;
   }
+  data.hourly = HourlyForecast();
+}
+
+const char *const kCollectedHeaders[] = {"Retry-After", "Date"};
+
+// Split an http(s) URL into host and port. `secure` is false only for an
+// explicit http:// scheme.
+bool parseUrl(const char *url, char *host, size_t len, uint16_t &port, bool &secure) {
+  const char *start = strstr(url, "://");
+  secure = !(start && strncmp(url, "http://", 7) == 0);
+  start = start ? start + 3 : url;
+  size_t n = strcspn(start, ":/?");
+  if (n == 0 || n >= len) return false;
+  memcpy(host, start, n);
+  host[n] = '\0';
+  port = secure ? 443 : 80;
+  if (start[n] == ':') port = (uint16_t)atoi(start + n + 1);
+  return port != 0;
+}
+
+bool isLocalHost(const char *host) {
+  size_t n = strlen(host);
+  if (strcasecmp(host, "localhost") == 0) return true;
+  if (n > 6 && strcasecmp(host + n - 6, ".local") == 0) return true;
+
+  unsigned a, b, c, d;
+  char tail;
+  if (sscanf(host, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4) return false;
+  if (a > 255 || b > 255 || c > 255 || d > 255) return false;
+  return a == 127 || a == 10 || (a == 192 && b == 168) || (a == 172 && b >= 16 && b <= 31) ||
+         (a == 169 && b == 254);
+}
+
+// The endpoint's host, or an error for one that may not be used.
+const char *checkEndpoint(const String &url, char *host, size_t len) {
+  uint16_t port;
+  bool secure;
+  if (!parseUrl(url.c_str(), host, len, port, secure)) return "Invalid URL";
+  if (!secure && !isLocalHost(host)) return "Plain http:// is only allowed for LAN hosts";
+  return nullptr;
 }
 
-void formatDayLabel(uint32_t epoch, int32_t tzOffset, bool isToday, char *out, size_t len) {
-  if (isToday) {
-    strlcpy(out, "Today", len);
-    return;
+String urlEncode(const String &in) {
+  static const char kHex[] = "0123456789ABCDEF";
+  String out;
+  out.reserve(in.length() + 8);
+  for (size_t i = 0; i < in.length(); ++i) {
+    char c = in[i];
+    if (isalnum((unsigned char)c) || c == '-' || c == '_' || c == '.' || c == '~' || c == ',') {
+      out += c;
+    } else {
+      out += '%';
+      out += kHex[(uint8_t)c >> 4];
+      out += kHex[(uint8_t)c & 0x0F];
+    }
   }
-  time_t localTs = static_cast<time_t>(epoch) + tzOffset;
-  struct tm info;
-  gmtime_r(&localTs, &info);
-  strftime(out, len, "%a", &info);
+  return out;
+}
+
+String buildEndpoint(const String &base, const char *location, const WeatherApiConfig &config) {
+  String url = base;
+  url += (base.indexOf('?') >= 0) ? '&' : '?';
+  url += "q=";
+  url += urlEncode(location);
+  url += "&appid=";
+  url += urlEncode(config.apiKey);
+  url += "&units=";
+  url += urlEncode(config.units);
+  return url;
+}
+
+// Stream view over a response body of known length. The parser stops at
+// the end of the body instead of waiting on the socket, and whatever it
+// leaves unread can be drained so the connection can carry the next
+// request.
+class BodyStream : public Stream {
+ public:
+  BodyStream(Stream &in, int32_t length) : in_(in), left_(length) {
+    setTimeout(in.getTimeout());
+  }
+
+  int available() override {
+    if (left_ <= 0) return 0;
+    int n = in_.available();
+    return n < left_ ? n : left_;
+  }
+  int read() override {
+    if (left_ <= 0) return -1;
+    int c = in_.read();
+    if (c >= 0) left_--;
+    return c;
+  }
+  int peek() override { return left_ > 0 ? in_.peek() : -1; }
+  size_t write(uint8_t) override { return 0; }
+
+  bool drain() {
+    uint8_t buf[128];
+    while (left_ > 0) {
+      size_t want = left_ < (int32_t)sizeof(buf) ? left_ : sizeof(buf);
+      size_t got = in_.readBytes(buf, want);
+      if (got == 0) return false;
+      left_ -= got;
+    }
+    return true;
+  }
+
+ private:
+  Stream &in_;
+  int32_t left_;
+};
+
+// Hand the response body to `parse`, then leave the connection clean for
+// the next request. Bodies with a Content-Length are parsed straight off
+// the socket; chunked ones are decoded into a buffer first.
+template <typename Parse>
+bool readBody(HTTPClient &http, Parse parse) {
+  int32_t length = http.getSize();
+  if (length < 0) {
+    StreamString buffered;
+    if (http.writeToStream(&buffered) < 0) return false;
+    return parse(buffered);
+  }
+
+  BodyStream body(http.getStream(), length);
+  bool ok = parse(body);
+  if (!body.drain()) {
+    http.getStream().stop();
+  }
+  return ok;
 }
 
 }  // namespace
 
+const char *weatherApiConfigError(const WeatherApiConfig &current, const WeatherApiConfig &next,
+                                  bool keySupplied) {
+  const String WeatherApiConfig::*const urls[] = {&WeatherApiConfig::currentUrl,
+                                                   &WeatherApiConfig::forecastUrl};
+  for (const auto url : urls) {
+    char host[64], was[64];
+    const char *error = checkEndpoint(next.*url, host, sizeof(host));
+    if (error) return error;
+    uint16_t port;
+    bool secure;
+    bool moved = !parseUrl((current.*url).c_str(), was, sizeof(was), port, secure) ||
+                 strcasecmp(host, was) != 0;
+    if (moved && !keySupplied) return "A new API host needs apiKey in the same request";
+  }
+  return nullptr;
+}
+
 WeatherAPI::WeatherAPI(ESP32Time &rtc) : rtc_(rtc) {
-  client_.setInsecure();
+  tlsClient_.setInsecure();
+  configure(WeatherApiConfig());
+  // HTTP/1.1 with keep-alive so both calls of a cycle share one handshake.
+  http_.useHTTP10(false);
+  http_.setReuse(true);
+  http_.collectHeaders(kCollectedHeaders,
+                       sizeof(kCollectedHeaders) / sizeof(kCollectedHeaders[0]));
 }
 
-void WeatherAPI::setTime() {
-  configTime(0, 0, NTP_SERVER_1, NTP_SERVER_2, NTP_SERVER_3);
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo, 5000)) {
-    rtc_.setTimeStruct(timeinfo);
+void WeatherAPI::configure(const WeatherApiConfig &config) {
+  if (client_) closeConnection();
+  config_ = config;
+}
+
+int WeatherAPI::get(const String &url, WeatherFetchStats &stats) {
+  char host[64];
+  uint16_t port = 0;
+  bool secure = true;
+  if (!parseUrl(url.c_str(), host, sizeof(host), port, secure)) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+
+  WiFiClient *wanted = secure ? static_cast<WiFiClient *>(&tlsClient_) : &plainClient_;
+  bool reusable = client_ == wanted && client_->connected() && port == connectedPort_ &&
+                  strcmp(host, connectedHost_) == 0;
+  if (reusable) {
+    stats.reusedRequests++;
+  } else {
+    closeConnection();
+    uint32_t start = millis();
+    if (!wanted->connect(host, port)) return HTTPC_ERROR_CONNECTION_REFUSED;
+    stats.lastHandshakeMs = millis() - start;
+    stats.handshakes++;
+    client_ = wanted;
+    strlcpy(connectedHost_, host, sizeof(connectedHost_));
+    connectedPort_ = port;
+  }
+
+  // HTTPClient sees the open socket and sends on it without reconnecting.
+  if (!http_.begin(*client_, url)) return HTTPC_ERROR_CONNECTION_REFUSED;
+  int code = http_.GET();
+  stats.lastHttpStatus = code;
+  stats.retryAfterSec = 0;
+  if (code > 0 && http_.hasHeader("Retry-After")) {
+    uint32_t nowEpoch = timeSync.synced() ? (uint32_t)time(nullptr) : 0;
+    stats.retryAfterSec = parseRetryAfter(http_.header("Retry-After").c_str(),
+                                          http_.header("Date").c_str(), nowEpoch);
   }
+  return code;
+}
+
+void WeatherAPI::closeConnection() {
+  http_.end();
+  if (client_) client_->stop();
+  client_ = nullptr;
+  connectedHost_[0] = '\0';
+  connectedPort_ = 0;
 }
 
-bool WeatherAPI::getData(WeatherData &data, WeatherDisplayState &state) {
-  HTTPClient http;
-  if (!http.begin(client_, OPENWEATHERMAP_API_ENDPOINT)) {
-    state.lastFetchOk = false;
+bool WeatherAPI::getData(WeatherData &data, WeatherFetchStats &stats, const char *location) {
+  // Don't spend a TLS handshake timeout on a link that is known to be down.
+  if (WiFi.status() != WL_CONNECTED) {
+    stats.isConnected = false;
+    stats.lastHttpStatus = 0;
+    stats.retryAfterSec = 0;
     return false;
   }
 
-  int httpCode = http.GET();
+  int httpCode = get(buildEndpoint(config_.currentUrl, location, config_), stats);
   if (httpCode != HTTP_CODE_OK) {
-    http.end();
-    state.lastFetchOk = false;
+    closeConnection();
     return false;
   }
 
-  String payload = http.getString();
-  http.end();
-
   JsonDocument doc;
-  auto err = deserializeJson(doc, payload);
-  if (err) {
-    state.lastFetchOk = false;
+  DeserializationError err;
+  bool ok = readBody(http_, [&](Stream &body) {
+    err = deserializeJson(doc, body);
+    return !err;
+  });
+  http_.end();
+  // A broken chunked body fails before the parser runs, leaving err Ok
+  if (!ok || err) {
+    closeConnection();
     return false;
   }
-
   JsonObject main = doc["main"];
   data.temperature = main["temp"] | NAN;
   data.feelsLike = main["feels_like"] | NAN;
@@ -99,27 +279,27 @@ bool WeatherAPI::getData(WeatherData &data, WeatherDisplayState &state) {
   data.windSpeed = wind["speed"] | NAN;
 
   strlcpy(data.location,
-          doc["name"] | OPENWEATHERMAP_CITY,
+          doc["name"] | location,
           sizeof(data.location));
   JsonObject weather0 = doc["weather"][0];
   strlcpy(data.description,
           weather0["description"] | "n/a",
           sizeof(data.description));
-  strlcpy(data.icon,
-          weather0["icon"] | "01d",
-          sizeof(data.icon));
+  data.icon = weatherIconIndex(weather0["icon"] | "01d");
 
   data.lastUpdateEpoch = doc["dt"] | 0;
   data.timezoneOffset = doc["timezone"] | data.timezoneOffset;
-  if (data.lastUpdateEpoch) {
+  // Until SNTP has answered, the observation time is the best clock we have.
+  // Never after: the first SNTP sync steps over this, later ones only slew.
+  if (data.lastUpdateEpoch && !timeSync.synced()) {
     rtc_.setTime(data.lastUpdateEpoch);
   }
 
   resetForecast(data);
-  bool forecastOk = fetchForecast(data);
+  bool forecastOk = fetchForecast(data, stats, location);
+  closeConnection();
 
-  state.lastFetchOk = true;
-  state.isConnected = (WiFi.status() == WL_CONNECTED);
+  stats.isConnected = (WiFi.status() == WL_CONNECTED);
 
   if (!forecastOk) {
     Serial.println("Weather: forecast fetch failed, continuing with current data.");
@@ -127,93 +307,18 @@ bool WeatherAPI::getData(WeatherData &data, WeatherDisplayState &state) {
   return true;
 }
 
-bool WeatherAPI::fetchForecast(WeatherData &data) {
-  HTTPClient http;
-  if (!http.begin(client_, OPENWEATHERMAP_FORECAST_ENDPOINT)) {
-    return false;
-  }
-
-  int httpCode = http.GET();
+bool WeatherAPI::fetchForecast(WeatherData &data, WeatherFetchStats &stats,
+                               const char *location) {
+  int httpCode = get(buildEndpoint(config_.forecastUrl, location, config_), stats);
   if (httpCode != HTTP_CODE_OK) {
-    http.end();
-    return false;
-  }
-
-  String payload = http.getString();
-  http.end();
-
-  JsonDocument doc;
-  auto err = deserializeJson(doc, payload);
-  if (err) {
     return false;
   }
 
-  JsonArray entries = doc["list"].as<JsonArray>();
-  if (entries.isNull() || entries.size() == 0) {
-    return false;
-  }
-
-  int32_t tzOffset = doc["city"]["timezone"] | data.timezoneOffset;
-  data.timezoneOffset = tzOffset;
-  int32_t baseDay = (data.lastUpdateEpoch + data.timezoneOffset) / kSecondsPerDay;
-  if (baseDay <= 0) {
-    uint32_t firstTs = entries[0]["dt"] | 0;
-    baseDay = (firstTs + data.timezoneOffset) / kSecondsPerDay;
-  }
-
-  ForecastBucket buckets[3];
-
-  for (JsonObject entry : entries) {
-    uint32_t ts = entry["dt"] | 0;
-    if (!ts) continue;
-
-    int32_t localDay = static_cast<int32_t>((ts + data.timezoneOffset) / kSecondsPerDay);
-    int idx = localDay - baseDay;
-    if (idx < 0 || idx >= 3) continue;
-
-    ForecastBucket &bucket = buckets[idx];
-    bucket.used = true;
-
-    float tempMin = entry["main"]["temp_min"] | NAN;
-    float tempMax = entry["main"]["temp_max"] | NAN;
-    if (!isnan(tempMin)) bucket.tempMin = (bucket.tempMin == 1e6f) ? tempMin : min(bucket.tempMin, tempMin);
-    if (!isnan(tempMax)) bucket.tempMax = (bucket.tempMax == -1e6f) ? tempMax : max(bucket.tempMax, tempMax);
-
-    uint32_t localSeconds = static_cast<uint32_t>((ts + data.timezoneOffset) % kSecondsPerDay);
-    uint32_t delta = (localSeconds > kMiddaySeconds)
-                         ? (localSeconds - kMiddaySeconds)
-                         : (kMiddaySeconds - localSeconds);
-    if (delta < bucket.bestDelta) {
-      bucket.bestDelta = delta;
-      bucket.representativeTs = ts;
-      JsonObject w = entry["weather"][0];
-      strlcpy(bucket.description, w["description"] | "n/a", sizeof(bucket.description));
-      strlcpy(bucket.icon, w["icon"] | "01d", sizeof(bucket.icon));
-    }
-  }
-
-  bool any = false;
-  for (int i = 0; i < 3; ++i) {
-    WeatherForecast &out = data.forecast[i];
-    const ForecastBucket &bucket = buckets[i];
-    if (!bucket.used) {
-      out.valid = false;
-      continue;
-    }
-    any = true;
-    out.valid = true;
-    out.timestamp = bucket.representativeTs;
-    out.tempMin = (bucket.tempMin == 1e6f) ? NAN : bucket.tempMin;
-    out.tempMax = (bucket.tempMax == -1e6f) ? NAN : bucket.tempMax;
-    strlcpy(out.description, bucket.description, sizeof(out.description));
-    strlcpy(out.icon, bucket.icon, sizeof(out.icon));
-
-    uint32_t labelTs = bucket.representativeTs;
-    if (!labelTs) {
-      labelTs = (baseDay + i) * kSecondsPerDay;
-    }
-    formatDayLabel(labelTs, data.timezoneOffset, i == 0, out.label, sizeof(out.label));
-  }
+  ForecastParser parser(data);
+  bool ok = readBody(http_, [&](Stream &body) { return parser.parse(body); });
+  http_.end();
 
-  return any;
+  stats.forecastEntries = parser.entries();
+  stats.forecastPeakJsonBytes = parser.peakJsonBytes();
+  return ok;
 }
@@ -2,23 +2,81 @@
 
 #include <Arduino.h>
 #include <ESP32Time.h>
+#include <HTTPClient.h>
+#include <WiFiClient.h>
 #include <WiFiClientSecure.h>
 
+#include "secrets.h"
 #include "weather_config.h"
 #include "weather_display.h"
 
+// Where and what to fetch. Defaults come from secrets.h; every field can be
+// overridden at runtime (see weatherSetApiConfig), e.g. to point the device
+// at mock_weather_server.py on the LAN. http:// URLs skip TLS.
+struct WeatherApiConfig {
+  String currentUrl = OPENWEATHERMAP_BASE_URL;
+  String forecastUrl = OPENWEATHERMAP_FORECAST_URL;
+  String apiKey = OPENWEATHERMAP_API_KEY;
+  // One or more OpenWeather "q" queries separated by ';', e.g.
+  // "Toronto,CA;London,GB" (see WEATHER_MAX_LOCATIONS).
+  String city = OPENWEATHERMAP_CITY;
+  String units = OPENWEATHERMAP_UNITS;
+};
+
+// Why `next` may not replace `current`, or nullptr if it may. Endpoints
+// must be https:// unless their host is on the LAN (private or loopback
+// IPv4, localhost, *.local), and a changed host only gets the API key if
+// the same change supplies it (`keySupplied`), so a stored key can't be
+// redirected to someone else's server.
+const char *weatherApiConfigError(const WeatherApiConfig &current, const WeatherApiConfig &next,
+                                  bool keySupplied);
+
+// Fetch and HTTP telemetry. Belongs to the I/O task; the fetch task fills a
+// copy of it (see weather_integration.cpp).
+struct WeatherFetchStats {
+  bool isConnected = false;
+  bool fetchInProgress = false;
+  uint32_t lastFetchMs = 0;    // wall time of the last background fetch
+  uint32_t maxFetchMs = 0;
+  uint32_t fetchCount = 0;
+  uint16_t forecastEntries = 0;        // entries consumed by the last parse
+  uint32_t forecastPeakJsonBytes = 0;  // peak ArduinoJson heap for that parse
+  uint32_t lastHandshakeMs = 0;        // TLS connect time of the last new session
+  uint32_t handshakes = 0;             // TLS sessions opened
+  uint32_t reusedRequests = 0;         // requests sent on an already-open session
+  int16_t lastHttpStatus = 0;          // last HTTP status (<0: HTTPClient error)
+  uint32_t retryAfterSec = 0;          // Retry-After of the last response
+};
+
 class WeatherAPI {
  public:
   explicit WeatherAPI(ESP32Time &rtc);
 
-  // Sync RTC with NTP
-  void setTime();
+  // Replace the endpoints. Not thread-safe: call only while no fetch runs.
+  void configure(const WeatherApiConfig &config);
+  const WeatherApiConfig &config() const { return config_; }
 
-  // Populate WeatherData/State by calling OpenWeather.
-  bool getData(WeatherData &data, WeatherDisplayState &state);
+  // Populate WeatherData/stats for one location query by calling
+  // OpenWeather. Current conditions and the forecast share one kept-alive
+  // TLS connection, which is closed again at the end of the cycle so its
+  // buffers don't sit on the heap between refreshes.
+  bool getData(WeatherData &data, WeatherFetchStats &stats, const char *location);
 
  private:
+  // GET `url` on the shared connection, opening (and timing) the TLS
+  // session first if needed. Returns the HTTP status or a negative
+  // HTTPClient error.
+  int get(const String &url, WeatherFetchStats &stats);
+  void closeConnection();
+  bool fetchForecast(WeatherData &data, WeatherFetchStats &stats, const char *location);
+
   ESP32Time &rtc_;
-  WiFiClientSecure client_;
-  bool fetchForecast(WeatherData &data);
+  WeatherApiConfig config_;
+  WiFiClientSecure tlsClient_;
+  WiFiClient plainClient_;
+  WiFiClient *client_ = nullptr;  // whichever of the two is open
+  char connectedHost_[64] = "";
+  uint16_t connectedPort_ = 0;
+  // Kept as a member: a local HTTPClient stops the socket in its destructor.
+  HTTPClient http_;
 };
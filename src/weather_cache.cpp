@@ -0,0 +1,249 @@
+#include "weather_cache.h"
+
+#include <math.h>
+
+namespace {
+
+constexpr uint8_t kCacheVersion = 4;
+constexpr uint8_t kCacheVersionUntimed = 3;  // same, without the write time
+constexpr size_t kHeaderBytes = 5;           // version, write time
+constexpr size_t kMaxRecord = 768;
+constexpr int16_t kMissing = INT16_MIN;
+
+struct Writer {
+  uint8_t *buf;
+  size_t cap;
+  size_t len = 0;
+  bool ok = true;
+
+  Writer(uint8_t *b, size_t c) : buf(b), cap(c) {}
+
+  void bytes(const void *src, size_t n) {
+    if (!ok || len + n > cap) {
+      ok = false;
+      return;
+    }
+    memcpy(buf + len, src, n);
+    len += n;
+  }
+  void u8(uint8_t v) { bytes(&v, 1); }
+  void u32(uint32_t v) { bytes(&v, 4); }
+  void tenths(float v) {
+    int16_t q = kMissing;
+    if (!isnan(v)) q = (int16_t)constrain(lroundf(v * 10.0f), -32767L, 32767L);
+    bytes(&q, 2);
+  }
+  void str(const char *s) {
+    size_t n = strlen(s);
+    if (n > 255) n = 255;
+    u8((uint8_t)n);
+    bytes(s, n);
+  }
+};
+
+struct Reader {
+  const uint8_t *buf;
+  size_t len;
+  size_t pos = 0;
+  bool ok = true;
+
+  Reader(const uint8_t *b, size_t l) : buf(b), len(l) {}
+
+  void bytes(void *dst, size_t n) {
+    if (!ok || pos + n > len) {
+      ok = false;
+      return;
+    }
+    memcpy(dst, buf + pos, n);
+    pos += n;
+  }
+  uint8_t u8() { uint8_t v = 0; bytes(&v, 1); return v; }
+  uint32_t u32() { uint32_t v = 0; bytes(&v, 4); return v; }
+  float tenths() {
+    int16_t q = kMissing;
+    bytes(&q, 2);
+    return q == kMissing ? NAN : q / 10.0f;
+  }
+  void str(char *out, size_t cap) {
+    size_t n = u8();
+    char tmp[256];
+    bytes(tmp, n);
+    if (!ok) return;
+    if (n >= cap) n = cap - 1;
+    memcpy(out, tmp, n);
+    out[n] = '\0';
+  }
+};
+
+size_t encode(const WeatherData &data, uint32_t writtenEpoch, uint8_t *buf, size_t cap) {
+  Writer w(buf, cap);
+  w.u8(kCacheVersion);
+  w.u32(writtenEpoch);
+  w.u32(data.lastUpdateEpoch);
+  w.u32((uint32_t)data.timezoneOffset);
+  w.tenths(data.temperature);
+  w.tenths(data.feelsLike);
+  w.tenths(data.tempMin);
+  w.tenths(data.tempMax);
+  w.tenths(data.humidity);
+  w.tenths(data.windSpeed);
+  w.tenths(data.pressure);
+  w.str(data.location);
+  w.str(data.description);
+  w.u8(data.icon);
+  for (const auto &f : data.forecast) {
+    w.u8(f.valid ? 1 : 0);
+    if (!f.valid) continue;
+    w.u32(f.timestamp);
+    w.tenths(f.tempMin);
+    w.tenths(f.tempMax);
+    w.str(f.description);
+    w.u8(f.icon);
+    w.str(f.label);
+    w.u8(f.pop);
+  }
+  const HourlyForecast &h = data.hourly;
+  w.u32(h.firstEpoch);
+  w.u8(h.count);
+  w.bytes(h.points, h.count * sizeof(ForecastPoint));
+  return w.ok ? w.len : 0;
+}
+
+// Returns the offset of the data after the header, 0 if it doesn't decode.
+size_t decode(const uint8_t *buf, size_t len, WeatherData &out, uint32_t &writtenEpoch) {
+  Reader r(buf, len);
+  uint8_t version = r.u8();
+  if (version == kCacheVersion) {
+    writtenEpoch = r.u32();
+  } else if (version == kCacheVersionUntimed) {
+    writtenEpoch = 0;
+  } else {
+    return 0;
+  }
+  const size_t start = r.pos;
+
+  WeatherData data;
+  data.lastUpdateEpoch = r.u32();
+  data.timezoneOffset = (int32_t)r.u32();
+  data.temperature = r.tenths();
+  data.feelsLike = r.tenths();
+  data.tempMin = r.tenths();
+  data.tempMax = r.tenths();
+  data.humidity = r.tenths();
+  data.windSpeed = r.tenths();
+  data.pressure = r.tenths();
+  r.str(data.location, sizeof(data.location));
+  r.str(data.description, sizeof(data.description));
+  data.icon = r.u8();
+  for (auto &f : data.forecast) {
+    f.valid = r.u8() != 0;
+    if (!f.valid) continue;
+    f.timestamp = r.u32();
+    f.tempMin = r.tenths();
+    f.tempMax = r.tenths();
+    r.str(f.description, sizeof(f.description));
+    f.icon = r.u8();
+    r.str(f.label, sizeof(f.label));
+    f.pop = r.u8();
+  }
+  HourlyForecast &h = data.hourly;
+  h.firstEpoch = r.u32();
+  h.count = r.u8();
+  if (h.count > WEATHER_FORECAST_POINTS) return 0;
+  r.bytes(h.points, h.count * sizeof(ForecastPoint));
+  if (!r.ok || r.pos != len) return 0;
+
+  out = data;
+  return start;
+}
+
+// FNV-1a, only used to skip rewriting an identical record.
+uint32_t hashBytes(const uint8_t *buf, size_t len) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= buf[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+}  // namespace
+
+WeatherCache::WeatherCache(Preferences &prefs) : prefs_(prefs) {}
+
+void WeatherCache::setKey(const char *key) {
+  strlcpy(key_, key, sizeof(key_));
+  storedHash_ = 0;
+  hasWritten_ = false;
+  storedEpoch_ = 0;
+  stats_ = WeatherCacheStats();
+}
+
+void WeatherCache::clear() {
+  prefs_.remove(key_);
+  storedHash_ = 0;
+  stats_.bytes = 0;
+}
+
+bool WeatherCache::migrate(const char *oldKey) {
+  size_t len = prefs_.getBytesLength(oldKey);
+  if (len == 0) return false;
+
+  bool moved = false;
+  uint8_t buf[kMaxRecord];
+  if (len <= kMaxRecord && prefs_.getBytesLength(key_) == 0 &&
+      prefs_.getBytes(oldKey, buf, len) == len) {
+    moved = prefs_.putBytes(key_, buf, len) == len;
+  }
+  prefs_.remove(oldKey);
+  return moved;
+}
+
+bool WeatherCache::restore(WeatherData &data) {
+  size_t len = prefs_.getBytesLength(key_);
+  if (len == 0 || len > kMaxRecord) return false;
+
+  uint8_t buf[kMaxRecord];
+  if (prefs_.getBytes(key_, buf, len) != len) return false;
+  size_t start = decode(buf, len, data, storedEpoch_);
+  if (!start) return false;
+
+  // The data alone, so a rewrite of the same data is still spotted
+  storedHash_ = hashBytes(buf + start, len - start);
+  stats_.restored = true;
+  stats_.bytes = len;
+  return true;
+}
+
+bool WeatherCache::store(const WeatherData &data, uint32_t nowMs, uint32_t nowEpoch) {
+  uint8_t buf[kMaxRecord];
+  size_t len = encode(data, nowEpoch, buf, sizeof(buf));
+  if (len == 0) return false;
+
+  uint32_t hash = hashBytes(buf + kHeaderBytes, len - kHeaderBytes);
+  if (hash == storedHash_) {
+    stats_.skippedUnchanged++;
+    return false;
+  }
+  bool tooSoon;
+  if (hasWritten_) {
+    tooSoon = nowMs - lastWriteMs_ < WEATHER_CACHE_MIN_WRITE_INTERVAL_MS;
+  } else {
+    // Written before this boot: only the wall clock can tell
+    tooSoon = storedEpoch_ && nowEpoch >= storedEpoch_ &&
+              nowEpoch - storedEpoch_ < WEATHER_CACHE_MIN_WRITE_INTERVAL_MS / 1000;
+  }
+  if (tooSoon) {
+    stats_.skippedRateLimit++;
+    return false;
+  }
+
+  if (prefs_.putBytes(key_, buf, len) != len) return false;
+  storedHash_ = hash;
+  storedEpoch_ = nowEpoch;
+  lastWriteMs_ = nowMs;
+  hasWritten_ = true;
+  stats_.writes++;
+  stats_.bytes = len;
+  return true;
+}
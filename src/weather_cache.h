@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+#include "weather_display.h"
+
+// Last good WeatherData (current + forecast) kept in NVS so the weather
+// screen has something to show the moment the device boots.
+//
+// The record is a small versioned binary blob: temperatures and the like
+// as tenths in int16, strings length-prefixed, invalid forecast days as a
+// single byte, the 3-hour points as their packed 6-byte form. Typical size
+// is ~550 bytes. The derived scrolling message is not stored; it is rebuilt
+// after restore.
+
+// Minimum spacing between NVS writes. A refresh every five minutes would
+// otherwise rewrite the same flash page ~300 times a day. The time of the
+// last write is kept in the record, so the limit also holds across reboots.
+constexpr uint32_t WEATHER_CACHE_MIN_WRITE_INTERVAL_MS = 30UL * 60UL * 1000UL;
+
+struct WeatherCacheStats {
+  bool restored = false;
+  uint16_t bytes = 0;             // size of the stored record
+  uint32_t writes = 0;
+  uint32_t skippedUnchanged = 0;  // identical to what is already in NVS
+  uint32_t skippedRateLimit = 0;  // too soon after the previous write
+};
+
+class WeatherCache {
+ public:
+  explicit WeatherCache(Preferences &prefs);
+
+  // NVS key of the record (max 15 chars). Resets the write bookkeeping.
+  void setKey(const char *key);
+  // Drop the stored record, e.g. when its location is removed.
+  void clear();
+  // Move the record stored under `oldKey` to this key, unless this key
+  // already holds one; `oldKey` is removed either way. Returns true if a
+  // record was moved.
+  bool migrate(const char *oldKey);
+
+  // Load the stored record into `data`. Returns false (data untouched) if
+  // there is none or it doesn't decode. `prefs` must already be open.
+  bool restore(WeatherData &data);
+
+  // Persist `data` after a good fetch, subject to the write rate limit.
+  // `nowEpoch` is the wall clock (0 if unknown); it is what the limit is
+  // checked against for a record written before this boot. Returns true if
+  // NVS was written.
+  bool store(const WeatherData &data, uint32_t nowMs, uint32_t nowEpoch);
+
+  const WeatherCacheStats &stats() const { return stats_; }
+
+ private:
+  Preferences &prefs_;
+  char key_[16] = "cache";
+  uint32_t storedHash_ = 0;
+  uint32_t lastWriteMs_ = 0;
+  bool hasWritten_ = false;
+  uint32_t storedEpoch_ = 0;  // wall clock when the stored record was written
+  WeatherCacheStats stats_{};
+};
@@ -6,7 +6,9 @@
 #include <M5Unified.h>
 
 #include "Free_Fonts.h"
-#include "weather_icons.h"
+#include "asset_bundle.h"
+#include "smooth_text.h"
+#include "trace.h"
 
 extern LGFX_Sprite gfx;
 
@@ -28,6 +30,57 @@ String titleCase(const char *src) {
   return work;
 }
 
+// "Cached 12m ago"; just "Cached" while the clock is not yet set.
+void formatCachedBadge(uint32_t nowEpoch, uint32_t updatedEpoch, char *out, size_t len) {
+  if (nowEpoch < 1600000000UL || !updatedEpoch || nowEpoch < updatedEpoch) {
+    strlcpy(out, "Cached", len);
+    return;
+  }
+  uint32_t age = nowEpoch - updatedEpoch;
+  if (age < 3600) {
+    snprintf(out, len, "Cached %lum ago", (unsigned long)(age / 60));
+  } else if (age < 86400) {
+    snprintf(out, len, "Cached %luh ago", (unsigned long)(age / 3600));
+  } else {
+    snprintf(out, len, "Cached %lud ago", (unsigned long)(age / 86400));
+  }
+}
+
+// Bitmaps come from the asset bundle, which packs icons in code order
+// (weather_icons.cpp).
+static_assert(ASSET_ICON_50N - ASSET_ICON_01D + 1 == WEATHER_ICON_COUNT,
+              "asset bundle icons out of step with the icon table");
+
+// Decoded through the bundle's LRU cache; only valid for the current frame.
+const uint16_t *iconBitmap(uint8_t index) {
+  return index < WEATHER_ICON_COUNT ? assets.image((AssetId)(ASSET_ICON_01D + index)) : nullptr;
+}
+
+// Current temperature on the "now" view (42 px smooth font).
+constexpr AssetId kTempFont = ASSET_FONT_TINY;
+
+// Hourly view temperature curve box.
+constexpr int kCurveX = 40;
+constexpr int kCurveY = 122;
+constexpr int kCurveW = WEATHER_SCREEN_WIDTH - kCurveX - 8;
+constexpr int kCurveH = 68;
+
+const char *formatTemp(float value, char *buf, size_t len) {
+  if (isnan(value)) {
+    strlcpy(buf, "--", len);
+  } else {
+    snprintf(buf, len, "%.0fF", value);
+  }
+  return buf;
+}
+
+// Copy and measure in the current gfx font.
+template <size_t N>
+void setLabel(WeatherLabel<N> &label, const char *text) {
+  strlcpy(label.text, text, N);
+  label.width = gfx.textWidth(label.text);
+}
+
 }  // namespace
 
 WeatherDisplay::WeatherDisplay(ESP32Time &rtc) : rtc_(rtc) {}
@@ -105,12 +158,13 @@ void WeatherDisplay::updateScrollingMessage() {
   msg += (strlen(data_.location) ? data_.location : "Weather");
   msg += " | ";
   msg += desc;
+  char temp[8];
   msg += " | Temp ";
-  msg += formatTemp(data_.temperature);
+  msg += formatTemp(data_.temperature, temp, sizeof(temp));
   msg += " (";
-  msg += formatTemp(data_.tempMin);
+  msg += formatTemp(data_.tempMin, temp, sizeof(temp));
   msg += "/";
-  msg += formatTemp(data_.tempMax);
+  msg += formatTemp(data_.tempMax, temp, sizeof(temp));
   msg += ") | Hum ";
   if (isnan(data_.humidity)) {
     msg += "--%";
@@ -137,6 +191,7 @@ void WeatherDisplay::updateScrollingBuffer() {
   }
   scrollBuffer_ = data_.scrollingMessage;
   ensureScrollMetrics();
+  invalidate();
 }
 
 void WeatherDisplay::ensureScrollMetrics() {
@@ -160,36 +215,151 @@ void WeatherDisplay::updateData() {
   }
 }
 
-String WeatherDisplay::formatTemp(float value) const {
-  if (isnan(value)) return "--";
+// ------------------- View-model -------------------
+
+void WeatherDisplay::refreshViewModel() {
+  uint32_t nowEpoch = rtc_.getEpoch();
+  uint32_t minute = nowEpoch / 60;
+  bool badgeChanged = model_.badgeOk != state_.lastFetchOk || model_.badgeCached != state_.fromCache;
+  if (model_.dirty || badgeChanged || minute != model_.minute) {
+    uint32_t startUs = micros();
+    if (model_.dirty) buildDataLabels();
+    model_.minute = minute;
+    buildClockLabels(nowEpoch);
+    state_.viewBuilds++;
+    state_.lastViewBuildUs = micros() - startUs;
+  }
+  model_.dirty = false;
+}
+
+// Parts that only change with the data.
+void WeatherDisplay::buildDataLabels() {
+  WeatherViewModel &m = model_;
   char buf[16];
-  snprintf(buf, sizeof(buf), "%.0fF", value);
-  return String(buf);
+
+  gfx.setFreeFont(&FreeSansBold12pt7b);
+  setLabel(m.location, strlen(data_.location) ? data_.location : "Weather");
+
+  strlcpy(m.temp.text, formatTemp(data_.temperature, buf, sizeof(buf)), sizeof(m.temp.text));
+  m.temp.width = smoothText.textWidth(kTempFont, m.temp.text);
+
+  gfx.setFreeFont(&FreeSans12pt7b);
+  char line[64];
+  snprintf(line, sizeof(line), "Feels %s", formatTemp(data_.feelsLike, buf, sizeof(buf)));
+  setLabel(m.feels, line);
+  setLabel(m.description, titleCase(data_.description).c_str());
+  m.icon = data_.icon;
+
+  m.detailCount = 0;
+  if (!isnan(data_.humidity)) {
+    snprintf(line, sizeof(line), "Humidity %d%%", (int)lroundf(data_.humidity));
+    setLabel(m.details[m.detailCount++], line);
+  }
+  if (!isnan(data_.windSpeed)) {
+    snprintf(line, sizeof(line), "Wind %.1f mph", data_.windSpeed);
+    setLabel(m.details[m.detailCount++], line);
+  }
+  if (!isnan(data_.pressure)) {
+    snprintf(line, sizeof(line), "Pressure %.0f hPa", data_.pressure);
+    setLabel(m.details[m.detailCount++], line);
+  }
+
+  // Hourly temperature curve over every point
+  const HourlyForecast &h = data_.hourly;
+  gfx.setFreeFont(&FreeSans9pt7b);
+  m.curveCount = 0;
+  float lo = 1e6f, hi = -1e6f;
+  for (uint8_t i = 0; i < h.count; ++i) {
+    float t = h.points[i].temp();
+    if (isnan(t)) continue;
+    lo = min(lo, t);
+    hi = max(hi, t);
+  }
+  if (hi >= lo) {
+    if (hi - lo < 1.0f) hi = lo + 1.0f;
+    const uint32_t span = h.points[h.count - 1].slot ? h.points[h.count - 1].slot : 1;
+    for (uint8_t i = 0; i < h.count; ++i) {
+      float t = h.points[i].temp();
+      if (isnan(t)) continue;
+      m.curveX[m.curveCount] = kCurveX + (int)((int32_t)h.points[i].slot * (kCurveW - 1) / (int32_t)span);
+      m.curveY[m.curveCount] = kCurveY + kCurveH - 1 - (int)((t - lo) / (hi - lo) * (kCurveH - 1));
+      m.curveCount++;
+    }
+    setLabel(m.curveHi, formatTemp(hi, buf, sizeof(buf)));
+    setLabel(m.curveLo, formatTemp(lo, buf, sizeof(buf)));
+  }
+
+  // Daily rows
+  m.rowCount = 0;
+  for (const WeatherForecast &f : data_.forecast) {
+    if (!f.valid) continue;
+    WeatherViewModel::Row &row = m.rows[m.rowCount++];
+    char low[8];
+    setLabel(row.label, f.label);
+    snprintf(line, sizeof(line), "%s / %s", formatTemp(f.tempMax, buf, sizeof(buf)),
+             formatTemp(f.tempMin, low, sizeof(low)));
+    setLabel(row.temps, line);
+    snprintf(buf, sizeof(buf), "%u%%", f.pop);
+    setLabel(row.pop, buf);
+    row.popColor = f.pop >= 30 ? TFT_CYAN : TFT_DARKGREY;
+    row.icon = f.icon;
+  }
 }
 
-const uint16_t *WeatherDisplay::iconForCode(const char *code) const {
-  if (!code) return nullptr;
-  if (strcmp(code, "01d") == 0) return icon_01d;
-  if (strcmp(code, "01n") == 0) return icon_01n;
-  if (strcmp(code, "02d") == 0) return icon_02d;
-  if (strcmp(code, "02n") == 0) return icon_02n;
-  if (strcmp(code, "03d") == 0) return icon_03d;
-  if (strcmp(code, "03n") == 0) return icon_03n;
-  if (strcmp(code, "04d") == 0) return icon_04d;
-  if (strcmp(code, "04n") == 0) return icon_04n;
-  if (strcmp(code, "09d") == 0) return icon_09d;
-  if (strcmp(code, "09n") == 0) return icon_09n;
-  if (strcmp(code, "10d") == 0) return icon_10d;
-  if (strcmp(code, "10n") == 0) return icon_10n;
-  if (strcmp(code, "11d") == 0) return icon_11d;
-  if (strcmp(code, "11n") == 0) return icon_11n;
-  if (strcmp(code, "13d") == 0) return icon_13d;
-  if (strcmp(code, "13n") == 0) return icon_13n;
-  if (strcmp(code, "50d") == 0) return icon_50d;
-  if (strcmp(code, "50n") == 0) return icon_50n;
-  return nullptr;
+// Parts that move with the clock: time, badge age, which 3-hour points are
+// still ahead.
+void WeatherDisplay::buildClockLabels(uint32_t nowEpoch) {
+  WeatherViewModel &m = model_;
+  char buf[24];
+
+  gfx.setFreeFont(&FreeSansBold12pt7b);
+  struct tm timeinfo = rtc_.getTimeStruct();
+  strlcpy(buf, "--:--", sizeof(buf));
+  strftime(buf, sizeof(buf), "%H:%M", &timeinfo);
+  setLabel(m.clock, buf);
+
+  m.badgeOk = state_.lastFetchOk;
+  m.badgeCached = state_.fromCache;
+  gfx.setFreeFont(&FreeSans12pt7b);
+  if (state_.fromCache) {
+    formatCachedBadge(nowEpoch, data_.lastUpdateEpoch, buf, sizeof(buf));
+    setLabel(m.badge, buf);
+    m.badgeColor = TFT_YELLOW;
+  } else {
+    setLabel(m.badge, state_.lastFetchOk ? "Updated" : "Offline");
+    m.badgeColor = state_.lastFetchOk ? TFT_GREEN : TFT_RED;
+  }
+
+  // Skip points already in the past once the clock is set.
+  const HourlyForecast &h = data_.hourly;
+  uint8_t first = 0;
+  while (nowEpoch > 1600000000UL && first + 1 < h.count &&
+         h.points[first + 1].epoch(h.firstEpoch) <= nowEpoch) {
+    first++;
+  }
+  gfx.setFreeFont(&FreeSans9pt7b);
+  m.columnCount = 0;
+  for (int c = 0; c < WeatherViewModel::kColumns && first + c < h.count; ++c) {
+    const ForecastPoint &p = h.points[first + c];
+    WeatherViewModel::Column &col = m.columns[m.columnCount++];
+
+    time_t local = (time_t)p.epoch(h.firstEpoch) + data_.timezoneOffset;
+    struct tm info;
+    gmtime_r(&local, &info);
+    snprintf(buf, sizeof(buf), "%02dh", info.tm_hour);
+    setLabel(col.hour, buf);
+    setLabel(col.temp, formatTemp(p.temp(), buf, sizeof(buf)));
+    snprintf(buf, sizeof(buf), "%u%%", p.pop);
+    setLabel(col.pop, buf);
+    col.popColor = p.pop >= 30 ? TFT_CYAN : TFT_DARKGREY;
+    col.icon = p.icon;
+  }
 }
 
+// ------------------- Drawing -------------------
+// Everything below only reads model_; labels are drawn top-left aligned at
+// positions derived from their measured widths.
+
 void WeatherDisplay::drawTicker() {
   if (scrollBuffer_.isEmpty()) return;
   gfx.fillRect(0, WEATHER_SCREEN_HEIGHT - 28, WEATHER_SCREEN_WIDTH, 28, TFT_DARKGREY);
@@ -204,35 +374,55 @@ void WeatherDisplay::drawTicker() {
 }
 
 void WeatherDisplay::draw() {
+  uint32_t startUs = micros();
+  refreshViewModel();
+  const WeatherViewModel &m = model_;
+
   gfx.fillSprite(TFT_BLACK);
+  gfx.setTextDatum(TL_DATUM);
 
   // Header row (location + time)
-  gfx.setTextDatum(TL_DATUM);
   gfx.setTextColor(TFT_CYAN, TFT_BLACK);
   gfx.setFreeFont(&FreeSansBold12pt7b);
-  const char *loc = strlen(data_.location) ? data_.location : "Weather";
-  gfx.drawString(loc, 8, 6);
+  gfx.drawString(m.location.text, 8, 6);
+  gfx.drawString(m.clock.text, WEATHER_SCREEN_WIDTH - 8 - m.clock.width, 6);
 
-  struct tm timeinfo = rtc_.getTimeStruct();
-  char timeBuf[16] = "--:--";
-  strftime(timeBuf, sizeof(timeBuf), "%H:%M", &timeinfo);
-  gfx.setTextDatum(TR_DATUM);
-  gfx.drawString(timeBuf, WEATHER_SCREEN_WIDTH - 8, 6);
-
-  // Temperature block
-  gfx.setTextDatum(TL_DATUM);
-  gfx.setTextColor(TFT_WHITE, TFT_BLACK);
-  gfx.setFreeFont(&FreeSansBold18pt7b);
-  gfx.drawString(formatTemp(data_.temperature), 8, 34);
+  switch (view_) {
+    case WEATHER_VIEW_HOURLY: drawHourly(); break;
+    case WEATHER_VIEW_DAILY: drawDaily(); break;
+    default: drawNow(); break;
+  }
 
+  // Connection badge
   gfx.setFreeFont(&FreeSans12pt7b);
-  gfx.drawString(String("Feels ") + formatTemp(data_.feelsLike), 8, 74);
+  gfx.setTextColor(m.badgeColor, TFT_BLACK);
+  gfx.drawString(m.badge.text, WEATHER_SCREEN_WIDTH - 8 - m.badge.width, WEATHER_SCREEN_HEIGHT - 40);
 
-  String desc = titleCase(data_.description);
-  gfx.drawString(desc, 8, 98);
+  drawTicker();
+
+  state_.lastComposeUs = micros() - startUs;
+  if (state_.lastComposeUs > state_.maxComposeUs) state_.maxComposeUs = state_.lastComposeUs;
+  TraceScope span("push");
+  gfx.pushSprite(0, 0);
+}
+
+void WeatherDisplay::nextView() {
+  view_ = (WeatherView)((view_ + 1) % WEATHER_VIEW_COUNT);
+}
+
+void WeatherDisplay::drawNow() {
+  const WeatherViewModel &m = model_;
+
+  // Temperature block; large anti-aliased numerals
+  smoothText.draw(gfx, kTempFont, m.temp.text, 8, 32, TFT_WHITE, TFT_BLACK);
+
+  gfx.setTextColor(TFT_WHITE, TFT_BLACK);
+  gfx.setFreeFont(&FreeSans12pt7b);
+  gfx.drawString(m.feels.text, 8, 74);
+  gfx.drawString(m.description.text, 8, 98);
 
   // Icon on the right
-  if (const uint16_t *icon = iconForCode(data_.icon)) {
+  if (const uint16_t *icon = iconBitmap(m.icon)) {
     gfx.pushImage(WEATHER_SCREEN_WIDTH - WEATHER_ICON_WIDTH - 10,
                   32,
                   WEATHER_ICON_WIDTH,
@@ -241,32 +431,70 @@ void WeatherDisplay::draw() {
   }
 
   // Detail rows
-  int detailY = 118;
-  char buf[48];
+  for (uint8_t i = 0; i < m.detailCount; ++i) {
+    gfx.drawString(m.details[i].text, 8, 118 + i * 20);
+  }
+}
 
-  if (!isnan(data_.humidity)) {
-    snprintf(buf, sizeof(buf), "Humidity %d%%", (int)lroundf(data_.humidity));
-    gfx.drawString(buf, 8, detailY);
-    detailY += 20;
+// Next 24 h as eight 3-hour columns, then the whole 5-day temperature curve.
+void WeatherDisplay::drawHourly() {
+  const WeatherViewModel &m = model_;
+  gfx.setFreeFont(&FreeSans9pt7b);
+  if (m.columnCount == 0) {
+    gfx.setTextColor(TFT_WHITE, TFT_BLACK);
+    gfx.drawString("No forecast yet", 8, 40);
+    return;
   }
 
-  if (!isnan(data_.windSpeed)) {
-    snprintf(buf, sizeof(buf), "Wind %.1f mph", data_.windSpeed);
-    gfx.drawString(buf, 8, detailY);
-    detailY += 20;
+  constexpr int kColumnW = WEATHER_SCREEN_WIDTH / WeatherViewModel::kColumns;
+  for (uint8_t c = 0; c < m.columnCount; ++c) {
+    const WeatherViewModel::Column &col = m.columns[c];
+    int cx = c * kColumnW + kColumnW / 2;
+
+    gfx.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
+    gfx.drawString(col.hour.text, cx - col.hour.width / 2, 34);
+
+    if (const uint16_t *icon = iconBitmap(col.icon)) {
+      gfx.pushImage(cx - WEATHER_ICON_WIDTH / 2, 52, WEATHER_ICON_WIDTH, WEATHER_ICON_HEIGHT,
+                    const_cast<uint16_t *>(icon));
+    }
+
+    gfx.setTextColor(TFT_WHITE, TFT_BLACK);
+    gfx.drawString(col.temp.text, cx - col.temp.width / 2, 80);
+
+    gfx.setTextColor(col.popColor, TFT_BLACK);
+    gfx.drawString(col.pop.text, cx - col.pop.width / 2, 98);
   }
 
-  if (!isnan(data_.pressure)) {
-    snprintf(buf, sizeof(buf), "Pressure %.0f hPa", data_.pressure);
-    gfx.drawString(buf, 8, detailY);
+  if (m.curveCount == 0) return;
+  gfx.drawRect(kCurveX - 1, kCurveY - 1, kCurveW + 2, kCurveH + 2, TFT_DARKGREY);
+  for (uint8_t i = 1; i < m.curveCount; ++i) {
+    gfx.drawLine(m.curveX[i - 1], m.curveY[i - 1], m.curveX[i], m.curveY[i], TFT_ORANGE);
   }
+  gfx.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
+  gfx.drawString(m.curveHi.text, kCurveX - 4 - m.curveHi.width, kCurveY);
+  gfx.drawString(m.curveLo.text, kCurveX - 4 - m.curveLo.width, kCurveY + kCurveH - gfx.fontHeight());
+}
 
-  // Connection badge
-  gfx.setTextDatum(TR_DATUM);
-  gfx.setTextColor(state_.lastFetchOk ? TFT_GREEN : TFT_RED, TFT_BLACK);
-  gfx.drawString(state_.lastFetchOk ? "Updated" : "Offline", WEATHER_SCREEN_WIDTH - 8,
-                 WEATHER_SCREEN_HEIGHT - 40);
+// One row per forecast day: label, icon, high / low, rain chance.
+void WeatherDisplay::drawDaily() {
+  const WeatherViewModel &m = model_;
+  gfx.setFreeFont(&FreeSans9pt7b);
+  for (uint8_t i = 0; i < m.rowCount; ++i) {
+    const WeatherViewModel::Row &row = m.rows[i];
+    int y = 34 + i * 32;
+    gfx.setTextColor(TFT_CYAN, TFT_BLACK);
+    gfx.drawString(row.label.text, 8, y + 5);
+
+    if (const uint16_t *icon = iconBitmap(row.icon)) {
+      gfx.pushImage(76, y, WEATHER_ICON_WIDTH, WEATHER_ICON_HEIGHT,
+                    const_cast<uint16_t *>(icon));
+    }
 
-  drawTicker();
-  gfx.pushSprite(0, 0);
+    gfx.setTextColor(TFT_WHITE, TFT_BLACK);
+    gfx.drawString(row.temps.text, 116, y + 5);
+
+    gfx.setTextColor(row.popColor, TFT_BLACK);
+    gfx.drawString(row.pop.text, WEATHER_SCREEN_WIDTH - 8 - row.pop.width, y + 5);
+  }
 }
@@ -6,28 +6,74 @@
 
 #include "weather_config.h"
 
+// Written by the render task only: the badge fields come from the snapshot
+// weatherStep() adopts, the counters from draw(). /metrics reads the 32-bit
+// counters from the I/O core, as it does the asset and text stats. Fetch
+// telemetry lives on the I/O side (WeatherFetchStats).
 struct WeatherDisplayState {
-  bool isConnected = false;
   uint8_t brightness = WEATHER_DEFAULT_BRIGHTNESS;
-  uint32_t updateCounter = 0;
   bool lastFetchOk = false;
+  bool fromCache = false;      // showing data restored from NVS at boot
+  uint32_t lastComposeUs = 0;          // draw() up to the sprite push
+  uint32_t maxComposeUs = 0;
+  uint32_t viewBuilds = 0;             // view-model rebuilds (data or minute)
+  uint32_t lastViewBuildUs = 0;        // time the last rebuild took
 };
 
+constexpr uint8_t WEATHER_FORECAST_DAYS = 5;
+constexpr uint8_t WEATHER_FORECAST_POINTS = 40;   // 5 days of 3-hour steps
+constexpr uint32_t WEATHER_FORECAST_STEP_S = 3 * 3600;
+
+// OpenWeather icons ("01d" .. "50n") are stored as a dense index:
+// condition group (01 02 03 04 09 10 11 13 50) * 2, +1 for night. The order
+// is persisted in the NVS cache, so only ever append.
+constexpr uint8_t WEATHER_ICON_COUNT = 18;
+constexpr uint8_t WEATHER_ICON_DEFAULT = 0;  // "01d"
+constexpr uint8_t WEATHER_ICON_NONE = 0xFF;
+
+// Index of an icon code, or WEATHER_ICON_NONE; and back (nullptr for none).
+uint8_t weatherIconIndex(const char *code);
+const char *weatherIconCode(uint8_t index);
+
 struct WeatherForecast {
   uint32_t timestamp = 0;
   float tempMin = NAN;
   float tempMax = NAN;
   char description[48] = "";
-  char icon[4] = "01d";
   char label[12] = "";
+  uint8_t icon = WEATHER_ICON_DEFAULT;
+  uint8_t pop = 0;  // highest precipitation probability of the day, %
   bool valid = false;
 };
 
+// One 3-hour forecast point in 6 bytes of fixed point.
+struct ForecastPoint {
+  int16_t tempTenths = INT16_MIN;  // INT16_MIN: missing
+  uint8_t slot = 0;                // 3-hour steps after HourlyForecast::firstEpoch
+  uint8_t pop = 0;                 // precipitation probability, %
+  uint8_t windHalves = 0;          // wind speed in half units, saturating
+  uint8_t icon = WEATHER_ICON_NONE;
+
+  float temp() const { return tempTenths == INT16_MIN ? NAN : tempTenths / 10.0f; }
+  float wind() const { return windHalves / 2.0f; }
+  uint32_t epoch(uint32_t firstEpoch) const { return firstEpoch + slot * WEATHER_FORECAST_STEP_S; }
+};
+
+// The full 5 day / 3 hour forecast as received, oldest point first.
+struct HourlyForecast {
+  uint32_t firstEpoch = 0;
+  uint8_t count = 0;
+  ForecastPoint points[WEATHER_FORECAST_POINTS];
+};
+
+static_assert(sizeof(ForecastPoint) == 6, "ForecastPoint must stay packed");
+static_assert(sizeof(HourlyForecast) < 1024, "full forecast must stay under 1 KB");
+
 struct WeatherData {
   char location[32] = "";
   char description[64] = "";
   char scrollingMessage[256] = "";
-  char icon[4] = "01d";
+  uint8_t icon = WEATHER_ICON_DEFAULT;
   float temperature = NAN;
   float feelsLike = NAN;
   float humidity = NAN;
@@ -37,9 +83,74 @@ struct WeatherData {
   float tempMax = NAN;
   uint32_t lastUpdateEpoch = 0;
   int32_t timezoneOffset = 0;
-  WeatherForecast forecast[3];
+  WeatherForecast forecast[WEATHER_FORECAST_DAYS];
+  HourlyForecast hourly;
+};
+
+// A pre-formatted string and its pixel width in the font it is drawn with.
+template <size_t N>
+struct WeatherLabel {
+  char text[N] = "";
+  int16_t width = 0;
 };
 
+// Everything draw() prints, formatted and measured once per data change
+// (and once a minute for the clock-dependent parts), so a frame is only
+// fills, blits and glyph runs.
+struct WeatherViewModel {
+  static constexpr uint8_t kColumns = 8;  // hourly view: next 24 h
+
+  struct Column {
+    WeatherLabel<4> hour;
+    WeatherLabel<8> temp;
+    WeatherLabel<6> pop;
+    uint16_t popColor = 0;
+    uint8_t icon = WEATHER_ICON_NONE;
+  };
+  struct Row {
+    WeatherLabel<12> label;
+    WeatherLabel<24> temps;
+    WeatherLabel<6> pop;
+    uint16_t popColor = 0;
+    uint8_t icon = WEATHER_ICON_NONE;
+  };
+
+  bool dirty = true;
+  uint32_t minute = 0;  // epoch minute the clock-dependent parts are for
+  bool badgeOk = false;
+  bool badgeCached = false;
+
+  // Header and badge
+  WeatherLabel<32> location;
+  WeatherLabel<8> clock;
+  WeatherLabel<24> badge;
+  uint16_t badgeColor = 0;
+
+  // Now
+  WeatherLabel<8> temp;
+  WeatherLabel<16> feels;
+  WeatherLabel<64> description;
+  WeatherLabel<24> details[3];
+  uint8_t detailCount = 0;
+  uint8_t icon = WEATHER_ICON_NONE;
+
+  // Hourly
+  Column columns[kColumns];
+  uint8_t columnCount = 0;
+  int16_t curveX[WEATHER_FORECAST_POINTS];
+  int16_t curveY[WEATHER_FORECAST_POINTS];
+  uint8_t curveCount = 0;
+  WeatherLabel<8> curveHi;
+  WeatherLabel<8> curveLo;
+
+  // Daily
+  Row rows[WEATHER_FORECAST_DAYS];
+  uint8_t rowCount = 0;
+};
+
+// Sub-views of the weather screen, cycled by tapping it.
+enum WeatherView : uint8_t { WEATHER_VIEW_NOW, WEATHER_VIEW_HOURLY, WEATHER_VIEW_DAILY, WEATHER_VIEW_COUNT };
+
 class WeatherDisplay {
  public:
   explicit WeatherDisplay(ESP32Time &rtc);
@@ -49,6 +160,8 @@ class WeatherDisplay {
   void handleBrightnessButtons();
   void updateData();
   void draw();
+  void nextView();
+  WeatherView view() const { return view_; }
 
   WeatherData &getWeatherData();
   WeatherDisplayState &getDisplayState();
@@ -58,17 +171,27 @@ class WeatherDisplay {
   void updateScrollingMessage();
   void updateScrollingBuffer();
 
+  // Rebuild the view-model on the next frame. updateScrollingBuffer() calls
+  // this; use it after changing WeatherData without touching the ticker.
+  void invalidate() { model_.dirty = true; }
+
  private:
   void applyBrightness(uint8_t level);
   void ensureScrollMetrics();
-  const uint16_t *iconForCode(const char *code) const;
-  String formatTemp(float value) const;
+  void refreshViewModel();
+  void buildDataLabels();
+  void buildClockLabels(uint32_t nowEpoch);
   void drawTicker();
+  void drawNow();
+  void drawHourly();
+  void drawDaily();
 
   ESP32Time &rtc_;
   WeatherData data_{};
   WeatherDisplayState state_{};
   int16_t scrollX_ = ANIMATION_START_POSITION;
+  WeatherView view_ = WEATHER_VIEW_NOW;
+  WeatherViewModel model_;
   uint16_t scrollPixelWidth_ = 0;
   String scrollBuffer_;
   bool brightnessReady_ = false;
@@ -0,0 +1,49 @@
+#include "weather_display.h"
+
+#include <ctype.h>
+
+// OpenWeather icon codes <-> WEATHER_ICON_* indices. Kept apart from the
+// drawing code so the parser and its host tests don't pull that in.
+
+namespace {
+
+// The nine condition groups hash perfectly into 14 slots by number % 14,
+// so a code resolves with one table read and one compare.
+constexpr uint8_t kIconGroups = WEATHER_ICON_COUNT / 2;
+constexpr uint8_t kIconSlots = 14;
+constexpr uint8_t kGroupNumber[kIconGroups] = {1, 2, 3, 4, 9, 10, 11, 13, 50};
+constexpr uint8_t kGroupBySlot[kIconSlots] = {
+    WEATHER_ICON_NONE, 0, 1, 2, 3, WEATHER_ICON_NONE, WEATHER_ICON_NONE,
+    WEATHER_ICON_NONE, 8, 4, 5, 6, WEATHER_ICON_NONE, 7};
+
+constexpr char kIconCodes[WEATHER_ICON_COUNT][4] = {
+    "01d", "01n", "02d", "02n", "03d", "03n", "04d", "04n", "09d",
+    "09n", "10d", "10n", "11d", "11n", "13d", "13n", "50d", "50n"};
+
+// Every group lands in its own slot, and the code table agrees with it.
+constexpr bool iconTableConsistent(uint8_t g) {
+  return g == kIconGroups ||
+         (kGroupBySlot[kGroupNumber[g] % kIconSlots] == g &&
+          kIconCodes[g * 2][0] - '0' == kGroupNumber[g] / 10 &&
+          kIconCodes[g * 2][1] - '0' == kGroupNumber[g] % 10 &&
+          kIconCodes[g * 2][2] == 'd' && kIconCodes[g * 2 + 1][2] == 'n' &&
+          iconTableConsistent(g + 1));
+}
+static_assert(iconTableConsistent(0), "icon hash is not perfect for the code table");
+
+}  // namespace
+
+uint8_t weatherIconIndex(const char *code) {
+  if (!code || !isdigit((unsigned char)code[0]) || !isdigit((unsigned char)code[1])) {
+    return WEATHER_ICON_NONE;
+  }
+  uint8_t number = (code[0] - '0') * 10 + (code[1] - '0');
+  uint8_t group = kGroupBySlot[number % kIconSlots];
+  if (group == WEATHER_ICON_NONE || kGroupNumber[group] != number) return WEATHER_ICON_NONE;
+  if ((code[2] != 'd' && code[2] != 'n') || code[3] != '\0') return WEATHER_ICON_NONE;
+  return group * 2 + (code[2] == 'n');
+}
+
+const char *weatherIconCode(uint8_t index) {
+  return index < WEATHER_ICON_COUNT ? kIconCodes[index] : nullptr;
+}
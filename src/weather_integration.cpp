@@ -1,5 +1,7 @@
 #include <Arduino.h>
+#include <atomic>
 #include "weather_integration.h"
+#include "trace.h"
 
 // Global objects (mirroring original weather-micro-station sketch)
 ESP32Time rtc(0);
@@ -7,137 +9,446 @@ Preferences preferences;
 WeatherDisplay display(rtc);   // Pass rtc to display
 WeatherAPI apiClient(rtc);     // Pass rtc to API client
 
-// Animation and timing variables
-static unsigned long timePased = 0;
+WeatherLocation::WeatherLocation() : cache(preferences) {}
 
-void weatherInit() {
-  Serial.println("Weather subsystem starting...");
+// ------------------- Background fetch -------------------
+// HTTPS calls run on a low-priority task pinned to the network core so the
+// display, touch and serial ingest never wait on TLS. The two sides hand a
+// back buffer over through a tiny state machine:
+//   IDLE -> (loop: seed back buffer, notify) REQUESTED -> (task) RUNNING
+//        -> (task: result written) READY -> (loop: swap into display) IDLE
+// Each side only touches the back buffer in the states it owns, so no lock
+// is needed and the display only ever sees completed results.
+//
+// With several locations configured the loop only ever queues the most
+// overdue one, so the task (and the TLS stack) handles one place at a time.
+//
+// ------------------- Render core handoff -------------------
+// Locations and fetch bookkeeping belong to the I/O task; the display
+// belongs to the render task (see main.cpp). The I/O side posts a full
+// snapshot of what should be on screen to a one-slot queue, newer snapshots
+// overwriting unread ones, and location swipes travel the other way as
+// small events. Neither side touches the other's data: the snapshot carries
+// the status badge, and fetch telemetry stays with the I/O task
+// (WeatherFetchStats).
+namespace {
 
-  // We assume WiFi is already connected by the main sketch.
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("Weather: WiFi not connected, weather mode will not update.");
+// NVS keys for runtime API settings; missing keys fall back to secrets.h.
+const char kPrefCurrentUrl[] = "cur_url";
+const char kPrefForecastUrl[] = "fc_url";
+const char kPrefApiKey[] = "api_key";
+const char kPrefCity[] = "city";
+const char kPrefUnits[] = "units";
+// Single-location record from before locations had their own keys.
+const char kLegacyCacheKey[] = "cache";
+
+enum FetchState : uint8_t { FETCH_IDLE, FETCH_REQUESTED, FETCH_RUNNING, FETCH_READY };
+
+constexpr uint32_t kFetchTaskStack = 12 * 1024;
+constexpr UBaseType_t kFetchTaskPriority = 1;
+constexpr BaseType_t kFetchTaskCore = 0;
+
+std::atomic<uint8_t> fetchState{FETCH_IDLE};
+TaskHandle_t fetchTask = nullptr;
+
+WeatherData backData;
+WeatherFetchStats fetchStats;  // I/O side
+WeatherFetchStats backStats;   // the fetch task's copy while it runs
+char backQuery[WEATHER_LOCATION_QUERY_LEN];
+uint8_t backIndex = 0;
+bool backOk = false;
+uint32_t backDurationMs = 0;
+
+WeatherLocation locations[WEATHER_MAX_LOCATIONS];
+uint8_t locationCount = 0;
+uint8_t activeLocation = 0;
+
+struct WeatherShow {
+  uint32_t serial;  // bumped whenever `data` itself changes
+  bool hasData;
+  bool fromCache;
+  bool lastFetchOk;
+  WeatherData data;
+};
+
+constexpr UBaseType_t kSelectQueueDepth = 4;
+
+QueueHandle_t showQueue = nullptr;    // I/O -> render, WeatherShow
+QueueHandle_t selectQueue = nullptr;  // render -> I/O, int8_t location delta
+WeatherShow outbox;                   // I/O side
+WeatherShow inbox;                    // render side
+uint32_t shownSerial = 0;             // render side
+
+// Settings change requested from the web handler; handed to apiClient only
+// while the fetch task is idle.
+WeatherApiConfig pendingConfig;
+bool configPending = false;
+
+WeatherApiConfig loadApiConfig() {
+  WeatherApiConfig config;
+  config.currentUrl = preferences.getString(kPrefCurrentUrl, config.currentUrl);
+  config.forecastUrl = preferences.getString(kPrefForecastUrl, config.forecastUrl);
+  config.apiKey = preferences.getString(kPrefApiKey, config.apiKey);
+  config.city = preferences.getString(kPrefCity, config.city);
+  config.units = preferences.getString(kPrefUnits, config.units);
+  return config;
+}
+
+// Store only values that differ from the build defaults, so a firmware
+// with new secrets.h still takes effect for untouched fields.
+void saveApiSetting(const char *key, const String &value, const String &fallback) {
+  if (value == fallback) {
+    preferences.remove(key);
   } else {
-    Serial.printf("Weather: WiFi OK, IP=%s RSSI=%d dBm\n",
-                  WiFi.localIP().toString().c_str(),
-                  WiFi.RSSI());
-    display.getDisplayState().isConnected = true;
+    preferences.putString(key, value);
+  }
+}
+
+bool sameValue(float a, float b) { return a == b || (isnan(a) && isnan(b)); }
+
+// True if a fetch brought nothing new worth showing. The observation
+// timestamp is ignored; OpenWeather bumps it even when nothing else moved.
+bool sameConditions(const WeatherData &a, const WeatherData &b) {
+  if (!sameValue(a.temperature, b.temperature) || !sameValue(a.feelsLike, b.feelsLike) ||
+      !sameValue(a.humidity, b.humidity) || !sameValue(a.windSpeed, b.windSpeed) ||
+      !sameValue(a.pressure, b.pressure) || strcmp(a.description, b.description) != 0 ||
+      a.icon != b.icon) {
+    return false;
+  }
+  for (int i = 0; i < WEATHER_FORECAST_DAYS; ++i) {
+    const WeatherForecast &fa = a.forecast[i];
+    const WeatherForecast &fb = b.forecast[i];
+    if (fa.valid != fb.valid || !sameValue(fa.tempMin, fb.tempMin) ||
+        !sameValue(fa.tempMax, fb.tempMax) || fa.icon != fb.icon ||
+        fa.pop != fb.pop) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// NVS key for a location's cached record: "c" + FNV-1a of the query, so a
+// reordered list keeps its caches.
+void locationCacheKey(const char *query, char *key, size_t cap) {
+  uint32_t h = 2166136261u;
+  for (const char *c = query; *c; ++c) {
+    h ^= (uint8_t)*c;
+    h *= 16777619u;
+  }
+  snprintf(key, cap, "c%08lx", (unsigned long)h);
+}
+
+// Split the ';'-separated city setting into trimmed queries.
+uint8_t parseLocations(const String &list, char out[][WEATHER_LOCATION_QUERY_LEN]) {
+  uint8_t n = 0;
+  int start = 0;
+  while (start <= (int)list.length() && n < WEATHER_MAX_LOCATIONS) {
+    int end = list.indexOf(';', start);
+    if (end < 0) end = list.length();
+    String query = list.substring(start, end);
+    query.trim();
+    if (query.length()) strlcpy(out[n++], query.c_str(), WEATHER_LOCATION_QUERY_LEN);
+    start = end + 1;
+  }
+  if (n == 0) strlcpy(out[n++], OPENWEATHERMAP_CITY, WEATHER_LOCATION_QUERY_LEN);
+  return n;
+}
+
+// Make `index` the active location and post it to the render task, or a
+// placeholder if it has no data yet.
+void showLocation(uint8_t index) {
+  WeatherLocation &loc = locations[index];
+  activeLocation = index;
+  outbox.serial++;
+  outbox.hasData = loc.hasData;
+  outbox.fromCache = loc.fromCache;
+  outbox.lastFetchOk = loc.lastFetchOk;
+  if (loc.hasData) {
+    outbox.data = loc.data;
+  } else {
+    outbox.data = WeatherData();
+    strlcpy(outbox.data.location, loc.query, sizeof(outbox.data.location));
+    strcpy(outbox.data.scrollingMessage, "Fetching data ...");
+  }
+  xQueueOverwrite(showQueue, &outbox);
+}
+
+// Same data, new status badge.
+void showFetchFailed() {
+  outbox.lastFetchOk = false;
+  xQueueOverwrite(showQueue, &outbox);
+}
+
+// Render side: adopt the latest snapshot, if any. The ticker restarts only
+// when the data changed.
+void adoptShown() {
+  if (xQueueReceive(showQueue, &inbox, 0) != pdTRUE) return;
+  WeatherDisplayState &state = display.getDisplayState();
+  state.fromCache = inbox.fromCache;
+  state.lastFetchOk = inbox.lastFetchOk;
+  if (inbox.serial == shownSerial) return;
+  shownSerial = inbox.serial;
+
+  display.getWeatherData() = inbox.data;
+  if (inbox.hasData) {
+    display.updateLegacyData();
+    display.updateScrollingMessage();
+  }
+  display.getAni() = ANIMATION_START_POSITION;
+  display.updateScrollingBuffer();
+}
+
+// (Re)build the location table from the city setting. Each entry starts
+// from its NVS record, and first fetches are spread WEATHER_LOCATION_STAGGER_MS
+// apart. Records of locations no longer in the list are dropped; the record
+// from before there were locations goes to the first one.
+void loadLocations(const String &list) {
+  char queries[WEATHER_MAX_LOCATIONS][WEATHER_LOCATION_QUERY_LEN];
+  uint8_t n = parseLocations(list, queries);
+
+  for (uint8_t i = 0; i < locationCount; ++i) {
+    bool kept = false;
+    for (uint8_t j = 0; j < n && !kept; ++j) kept = strcmp(locations[i].query, queries[j]) == 0;
+    if (!kept) locations[i].cache.clear();
+  }
+
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < n; ++i) {
+    WeatherLocation &loc = locations[i];
+    strlcpy(loc.query, queries[i], sizeof(loc.query));
+    char key[16];
+    locationCacheKey(loc.query, key, sizeof(key));
+    loc.cache.setKey(key);
+    // The single-location record becomes the first location's
+    if (i == 0 && loc.cache.migrate(kLegacyCacheKey)) {
+      Serial.printf("Weather: [%s] took over the single-location record\n", loc.query);
+    }
+    loc.data = WeatherData();
+    loc.hasData = loc.fromCache = loc.cache.restore(loc.data);
+    loc.lastFetchOk = false;
+    loc.fetches = loc.failures = 0;
+    loc.scheduler.begin(now, esp_random(), i * WEATHER_LOCATION_STAGGER_MS);
+    if (loc.hasData) {
+      Serial.printf("Weather: [%s] restored %u bytes from NVS (updated %lu)\n", loc.query,
+                    loc.cache.stats().bytes, (unsigned long)loc.data.lastUpdateEpoch);
+    }
+  }
+  locationCount = n;
+  showLocation(activeLocation < n ? activeLocation : 0);
+}
+
+// Most overdue location whose fetch is due, or -1.
+int dueLocation(uint32_t nowMs) {
+  int best = -1;
+  int32_t bestLate = 0;
+  for (uint8_t i = 0; i < locationCount; ++i) {
+    const WeatherScheduler &sched = locations[i].scheduler;
+    if (!sched.due(nowMs)) continue;
+    int32_t late = -sched.msUntilNext(nowMs);
+    if (best < 0 || late > bestLate) {
+      best = i;
+      bestLate = late;
+    }
+  }
+  return best;
+}
+
+void weatherFetchTask(void *) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    if (fetchState.load() != FETCH_REQUESTED) continue;
+    fetchState.store(FETCH_RUNNING);
+
+    uint32_t start = millis();
+    {
+      TraceScope span("weather fetch");
+      backOk = apiClient.getData(backData, backStats, backQuery);
+    }
+    backDurationMs = millis() - start;
+
+    fetchState.store(FETCH_READY);
+  }
+}
+
+// Queue a fetch of one location on the background task. Only called while
+// the task is idle.
+void requestWeatherFetch(uint8_t index) {
+  WeatherLocation &loc = locations[index];
+  backIndex = index;
+  strlcpy(backQuery, loc.query, sizeof(backQuery));
+  backData = loc.data;
+  backStats = fetchStats;
+  fetchStats.fetchInProgress = true;
+  Serial.printf("Weather: fetch of %s requested at %lu ms\n", loc.query, millis());
+
+  fetchState.store(FETCH_REQUESTED);
+  xTaskNotifyGive(fetchTask);
+}
+
+// Land a completed fetch in its location (and the display if that location
+// is on screen). Returns true if new data landed.
+bool collectWeatherFetch() {
+  if (fetchState.load() != FETCH_READY) return false;
+
+  fetchStats = backStats;
+  fetchStats.fetchInProgress = false;
+  fetchStats.lastFetchMs = backDurationMs;
+  if (backDurationMs > fetchStats.maxFetchMs) fetchStats.maxFetchMs = backDurationMs;
+  fetchStats.fetchCount++;
+
+  WeatherLocation &loc = locations[backIndex];
+  loc.fetches++;
+  loc.lastFetchOk = backOk;
+  if (backOk) {
+    bool changed = !loc.hasData || loc.fromCache || !sameConditions(loc.data, backData);
+    loc.scheduler.onSuccess(millis(), changed);
+    loc.data = backData;
+    loc.hasData = true;
+    loc.fromCache = false;
+    // Until SNTP has answered, the observation time stands in for the clock
+    uint32_t nowEpoch = timeSync.synced() ? (uint32_t)time(nullptr) : loc.data.lastUpdateEpoch;
+    if (loc.cache.store(loc.data, millis(), nowEpoch)) {
+      Serial.printf("Weather: [%s] cached %u bytes to NVS\n", loc.query,
+                    loc.cache.stats().bytes);
+    }
+    Serial.printf("Weather: [%s] API call OK (%lu ms)\n", loc.query,
+                  (unsigned long)backDurationMs);
+  } else {
+    loc.failures++;
+    loc.scheduler.onFailure(millis(), fetchStats.retryAfterSec);
+    Serial.printf("Weather: [%s] API call failed (HTTP %d, %lu ms), retry in %ld s\n",
+                  loc.query, fetchStats.lastHttpStatus, (unsigned long)backDurationMs,
+                  (long)(loc.scheduler.msUntilNext(millis()) / 1000));
   }
 
+  if (backIndex == activeLocation) {
+    if (backOk) {
+      showLocation(backIndex);
+    } else {
+      showFetchFailed();
+    }
+  }
+
+  fetchState.store(FETCH_IDLE);
+  return backOk;
+}
+
+// Behind weatherUpdateOnly: follow location swipes, land finished fetches,
+// apply new settings while nothing is in flight, and start the most overdue
+// location's fetch.
+void weatherTick() {
+  int8_t delta;
+  while (xQueueReceive(selectQueue, &delta, 0) == pdTRUE) {
+    if (locationCount < 2) continue;
+    int next = ((int)activeLocation + delta) % locationCount;
+    if (next < 0) next += locationCount;
+    showLocation((uint8_t)next);
+  }
+
+  collectWeatherFetch();
+  if (!fetchTask || fetchState.load() != FETCH_IDLE) return;
+
+  if (configPending) {
+    apiClient.configure(pendingConfig);
+    loadLocations(pendingConfig.city);
+    configPending = false;
+  }
+
+  int due = dueLocation(millis());
+  if (due >= 0) requestWeatherFetch(due);
+}
+
+}  // namespace
+
+const WeatherApiConfig &weatherApiConfig() {
+  return configPending ? pendingConfig : apiClient.config();
+}
+
+void weatherSetApiConfig(const WeatherApiConfig &config) {
+  const WeatherApiConfig defaults;
+  saveApiSetting(kPrefCurrentUrl, config.currentUrl, defaults.currentUrl);
+  saveApiSetting(kPrefForecastUrl, config.forecastUrl, defaults.forecastUrl);
+  saveApiSetting(kPrefApiKey, config.apiKey, defaults.apiKey);
+  saveApiSetting(kPrefCity, config.city, defaults.city);
+  saveApiSetting(kPrefUnits, config.units, defaults.units);
+
+  // Picked up by weatherTick once the fetch task is idle; loadLocations
+  // then reschedules every location.
+  pendingConfig = config;
+  configPending = true;
+  Serial.printf("Weather: API config updated (%s, city=%s)\n",
+                config.currentUrl.c_str(), config.city.c_str());
+}
+
+void weatherInit() {
+  Serial.println("Weather subsystem starting...");
+
   // Initialize display
   display.begin();
+  showQueue = xQueueCreate(1, sizeof(WeatherShow));
+  selectQueue = xQueueCreate(kSelectQueueDepth, sizeof(int8_t));
 
   // Initialize preferences for secure storage
   preferences.begin("weather", false);
+  apiClient.configure(loadApiConfig());
 
   // Set up brightness control using on-board buttons
   display.initializeBrightnessControl();
 
-  // Initial time synchronization and data fetch
-  apiClient.setTime();
-  Serial.println("Weather: initial API call...");
+  // Warm start every location from its last good fetch (placeholder until
+  // the first background fetch lands otherwise) and schedule the first
+  // fetches. Each one waits a random few seconds on top of its stagger so
+  // devices powered up together spread out; with a warm cache nothing is
+  // lost by that.
+  loadLocations(apiClient.config().city);
+  Serial.printf("Weather: %u location(s), %u bytes each, first API call in %ld ms\n",
+                locationCount, (unsigned)sizeof(WeatherLocation),
+                (long)locations[0].scheduler.msUntilNext(millis()));
 
-  // Clear existing scrolling message and reset animation for startup
-  display.getAni() = ANIMATION_START_POSITION;
-  strcpy(display.getWeatherData().scrollingMessage, "Fetching data ...");
-  display.updateScrollingBuffer();
-  delay(2000);
+  xTaskCreatePinnedToCore(weatherFetchTask, "weatherFetch", kFetchTaskStack, nullptr,
+                          kFetchTaskPriority, &fetchTask, kFetchTaskCore);
+}
 
-  if (apiClient.getData(display.getWeatherData(), display.getDisplayState())) {
-    display.updateLegacyData();
-    display.updateScrollingMessage();
-    display.getAni() = ANIMATION_START_POSITION;
-    display.updateScrollingBuffer();
-    Serial.println("Weather: initial API call OK");
+void weatherNetworkReady() {
+  if (WiFi.status() != WL_CONNECTED) {
+    Serial.println("Weather: WiFi not connected, weather mode will not update.");
   } else {
-    Serial.println("Weather: initial API call FAILED");
+    Serial.printf("Weather: WiFi OK, IP=%s RSSI=%d dBm\n",
+                  WiFi.localIP().toString().c_str(),
+                  WiFi.RSSI());
+    fetchStats.isConnected = true;
   }
 
-  // Start periodic timer (UPDATE_INTERVAL_MS is defined in config.h)
-  timePased = millis();
+  // Time sync runs in the background from here on (SNTP, smooth slewing)
+  timeSync.begin();
 }
 
-// Internal helper to fetch weather data (shared by weatherStep and weatherUpdateOnly)
-static bool doWeatherFetch() {
-  display.getDisplayState().updateCounter++;
-  Serial.printf("Weather: timer fired, fetching API at %lu ms\n", millis());
+const WeatherFetchStats &weatherFetchStats() { return fetchStats; }
 
-  bool apiSuccess = apiClient.getData(display.getWeatherData(),
-                                      display.getDisplayState());
-  if (apiSuccess) {
-    display.updateLegacyData();
-    display.updateScrollingMessage();
-    Serial.println("Weather: API call OK");
-  } else {
-    Serial.println("Weather: API call failed");
-  }
+uint8_t weatherLocationCount() { return locationCount; }
 
-  // Periodic time synchronization
-  if (display.getDisplayState().updateCounter >= SYNC_INTERVAL_UPDATES) {
-    apiClient.setTime();  // Sync time every few updates
-    display.getDisplayState().updateCounter = 0;
-  }
+const WeatherLocation &weatherLocation(uint8_t index) { return locations[index]; }
 
-  return apiSuccess;
+uint8_t weatherActiveLocation() { return activeLocation; }
+
+void weatherSelectLocation(int delta) {
+  int8_t d = delta;
+  xQueueSend(selectQueue, &d, 0);
 }
 
 void weatherStep() {
-  // This is a lightly refactored version of the original loop()
-  // from weather-micro-station/src/main.cpp.
-
-  static unsigned long lastDisplayUpdate = 0;
-  static unsigned long lastMemoryCheck   = 0;
-  static int           loopCounter       = 0;
-
-  unsigned long currentMillis = millis();
-
-  // Update display at 40Hz (25ms interval) for smooth animation
-  if (currentMillis - lastDisplayUpdate >= 25) {
-    // Update animation and scrolling
-    display.updateData();
-
-    // Check if it's time for a data update (every UPDATE_INTERVAL_MS)
-    if (millis() > timePased + UPDATE_INTERVAL_MS) {
-      timePased = millis();
-
-      // Clear existing scrolling message and reset animation
-      display.getAni() = ANIMATION_START_POSITION;
-      strcpy(display.getWeatherData().scrollingMessage, "Fetching data ...");
-      display.updateScrollingBuffer();
-      delay(2000);
-
-      // Fetch new weather data
-      if (doWeatherFetch()) {
-        display.getAni() = ANIMATION_START_POSITION;
-        display.updateScrollingBuffer();
-      }
-    }
+  // Latest location / fetch result from the I/O task
+  adoptShown();
 
-    // Draw the display
-    display.draw();
-    lastDisplayUpdate = currentMillis;
-  }
+  // Update animation and scrolling, then draw
+  display.updateData();
+  display.draw();
 
   // Handle brightness control buttons (non-blocking)
   display.handleBrightnessButtons();
-
-  // Memory monitoring (every 30 seconds)
-  loopCounter++;
-  if (currentMillis - lastMemoryCheck >= 30000) {
-    lastMemoryCheck = currentMillis;
-    Serial.printf("Weather: free heap=%d bytes, loops=%d\n",
-                  ESP.getFreeHeap(), loopCounter);
-    loopCounter = 0;
-  }
-
-  // Small yield to prevent watchdog triggers and allow other tasks
-  yield();
 }
 
 void weatherUpdateOnly() {
-  // Lightweight weather update for when NOT in weather display mode.
-  // Only fetches API data on interval - no display updates.
-  if (millis() > timePased + UPDATE_INTERVAL_MS) {
-    timePased = millis();
-    doWeatherFetch();
-  }
+  // Only lands/starts background fetches - no display updates.
+  weatherTick();
 }
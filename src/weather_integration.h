@@ -7,7 +7,10 @@
 #include "weather_config.h"
 #include "weather_display.h"
 #include "weather_api.h"
+#include "weather_cache.h"
+#include "weather_scheduler.h"
 #include "secrets.h"
+#include "time_sync.h"
 
 // These globals are separated into a tiny "engine" that can be
 // driven from another sketch (PC stats + weather combo).
@@ -17,12 +20,68 @@ extern Preferences preferences;
 extern WeatherDisplay display;
 extern WeatherAPI apiClient;
 
-// Call once from setup(), *after* WiFi is connected.
+// Several places can be configured as a ';'-separated list in the city
+// setting ("Toronto,CA;London,GB"). Each keeps its own data, NVS record and
+// refresh schedule; fetches are staggered so only one HTTPS transaction is
+// ever in flight.
+constexpr uint8_t WEATHER_MAX_LOCATIONS = 4;
+constexpr size_t WEATHER_LOCATION_QUERY_LEN = 48;
+// Spacing of the first fetch of each location after boot/reconfiguration.
+constexpr uint32_t WEATHER_LOCATION_STAGGER_MS = 15UL * 1000UL;
+
+struct WeatherLocation {
+  char query[WEATHER_LOCATION_QUERY_LEN] = "";
+  WeatherData data;
+  WeatherScheduler scheduler;
+  WeatherCache cache;
+  bool hasData = false;
+  bool fromCache = false;
+  bool lastFetchOk = false;
+  uint32_t fetches = 0;
+  uint32_t failures = 0;
+
+  WeatherLocation();
+};
+
+// Call once from setup(), *before* the WiFi connect blocks. Restores the
+// last good data from NVS for an instant warm start and posts it to the
+// display, then starts the background fetch task; fetches made while the
+// link is down fail fast and back off.
 void weatherInit();
 
-// Call repeatedly from loop() while you are in weather mode.
+// Call once from setup() after the WiFi connect attempt. Starts SNTP, which
+// needs the network stack.
+void weatherNetworkReady();
+
+// Current API endpoints/city/units (secrets.h defaults plus overrides).
+const WeatherApiConfig &weatherApiConfig();
+
+// Persist new API settings to NVS and refetch with them as soon as the
+// background task is idle.
+void weatherSetApiConfig(const WeatherApiConfig &config);
+
+// I/O task: fetch and HTTP telemetry.
+const WeatherFetchStats &weatherFetchStats();
+
+// Configured locations; index 0 is the first entry of the city list.
+uint8_t weatherLocationCount();
+const WeatherLocation &weatherLocation(uint8_t index);
+
+// Locations, settings and fetches belong to the I/O task (see main.cpp);
+// the render task only sees the snapshots weatherStep() adopts.
+
+// Location currently shown on the weather screen.
+uint8_t weatherActiveLocation();
+
+// Render task: ask for the next (+1) / previous (-1) location; it shows up
+// once the I/O task has switched.
+void weatherSelectLocation(int delta);
+
+// Render task: draw one weather frame. The screen registry in main.cpp
+// paces the calls.
 void weatherStep();
 
-// Call from loop() when NOT in weather mode to still update weather data
-// for the web portal (no display updates, just API fetch on interval).
+// I/O task, periodically whatever screen is showing: follows location
+// swipes, starts background fetches when the weather scheduler says they
+// are due and lands completed results (no display updates).
 void weatherUpdateOnly();
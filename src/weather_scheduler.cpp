@@ -0,0 +1,106 @@
+#include "weather_scheduler.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+// Days since 1970-01-01 of a proleptic Gregorian date (Hinnant's
+// days_from_civil); timegm() isn't in newlib.
+int32_t daysFromCivil(int32_t y, uint32_t m, uint32_t d) {
+  y -= m <= 2;
+  const int32_t era = (y >= 0 ? y : y - 399) / 400;
+  const uint32_t yoe = (uint32_t)(y - era * 400);
+  const uint32_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int32_t)doe - 719468;
+}
+
+// IMF-fixdate to Unix time, 0 if it isn't one.
+uint32_t parseHttpDate(const char *text) {
+  static const char kMonths[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  char month[4];
+  int day, year, hour, minute, second;
+  if (!text || sscanf(text, "%*3s, %2d %3s %4d %2d:%2d:%2d GMT", &day, month, &year, &hour,
+                      &minute, &second) != 6) {
+    return 0;
+  }
+  const char *found = strstr(kMonths, month);
+  if (!found || (found - kMonths) % 3 || year < 1970 || day < 1 || day > 31) return 0;
+  uint32_t m = (found - kMonths) / 3 + 1;
+  return (uint32_t)daysFromCivil(year, m, day) * 86400UL + hour * 3600UL + minute * 60UL + second;
+}
+
+}  // namespace
+
+uint32_t parseRetryAfter(const char *value, const char *date, uint32_t nowEpoch) {
+  if (!value) return 0;
+  while (*value == ' ') value++;
+  if (isdigit((unsigned char)*value)) return strtoul(value, nullptr, 10);
+
+  uint32_t until = parseHttpDate(value);
+  uint32_t now = parseHttpDate(date);
+  if (!now) now = nowEpoch;
+  return until && now && until > now ? until - now : 0;
+}
+
+WeatherScheduler::WeatherScheduler(uint32_t seed) : rng_(seed ? seed : 1) {}
+
+void WeatherScheduler::begin(uint32_t nowMs, uint32_t seed, uint32_t delayMs) {
+  rng_ = seed ? seed : 1;
+  failureStreak_ = 0;
+  unchangedStreak_ = 0;
+  intervalMs_ = UPDATE_INTERVAL_MS;
+  nextFetchMs_ = nowMs + delayMs + nextRandom() % (WEATHER_BOOT_JITTER_MS + 1);
+}
+
+void WeatherScheduler::onSuccess(uint32_t nowMs, bool changed) {
+  failureStreak_ = 0;
+  if (changed) {
+    unchangedStreak_ = 0;
+    intervalMs_ = UPDATE_INTERVAL_MS;
+  } else {
+    unchangedStreak_++;
+    uint32_t stretched = intervalMs_ + intervalMs_ / 2;
+    intervalMs_ = stretched < WEATHER_MAX_INTERVAL_MS ? stretched : WEATHER_MAX_INTERVAL_MS;
+  }
+  nextFetchMs_ = nowMs + jitter(intervalMs_);
+}
+
+void WeatherScheduler::onFailure(uint32_t nowMs, uint32_t retryAfterSec) {
+  if (failureStreak_ < UINT16_MAX) failureStreak_++;
+
+  uint32_t backoff = WEATHER_BACKOFF_MIN_MS;
+  for (uint16_t i = 1; i < failureStreak_ && backoff < WEATHER_BACKOFF_MAX_MS; ++i) {
+    backoff *= 2;
+  }
+  if (backoff > WEATHER_BACKOFF_MAX_MS) backoff = WEATHER_BACKOFF_MAX_MS;
+  backoff = jitter(backoff);
+
+  // Retry-After is a floor; jitter only ever pushes past it.
+  uint32_t floorMs = retryAfterSec > WEATHER_BACKOFF_MAX_MS / 1000
+                         ? WEATHER_BACKOFF_MAX_MS
+                         : retryAfterSec * 1000;
+  if (backoff < floorMs) backoff = floorMs + nextRandom() % (floorMs / 10 + 1);
+
+  intervalMs_ = backoff;
+  nextFetchMs_ = nowMs + backoff;
+}
+
+uint32_t WeatherScheduler::jitter(uint32_t delayMs) {
+  uint32_t span = delayMs / 100 * WEATHER_JITTER_PCT;
+  if (span == 0) return delayMs;
+  return delayMs - span + nextRandom() % (2 * span + 1);
+}
+
+// xorshift32: cheap, and deterministic for a given seed.
+uint32_t WeatherScheduler::nextRandom() {
+  uint32_t x = rng_;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  rng_ = x;
+  return x;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "weather_config.h"
+
+// Decides when the next weather fetch should start.
+//
+//   - success, data changed:   UPDATE_INTERVAL_MS
+//   - success, data unchanged: interval stretched x1.5 per repeat, up to
+//                              WEATHER_MAX_INTERVAL_MS
+//   - failure:                 exponential backoff from WEATHER_BACKOFF_MIN_MS
+//                              to WEATHER_BACKOFF_MAX_MS, never earlier than
+//                              a server Retry-After
+// Every delay gets +-WEATHER_JITTER_PCT jitter, and the first fetch after
+// boot is spread over WEATHER_BOOT_JITTER_MS, so devices that power up
+// together don't hit the API in lockstep.
+//
+// Time is passed in by the caller and compared wrap-safely, so the class
+// has no hardware dependencies and can be driven from a fake clock.
+
+constexpr uint32_t WEATHER_MAX_INTERVAL_MS = 20UL * 60UL * 1000UL;
+constexpr uint32_t WEATHER_BACKOFF_MIN_MS = 15UL * 1000UL;
+constexpr uint32_t WEATHER_BACKOFF_MAX_MS = 30UL * 60UL * 1000UL;
+constexpr uint32_t WEATHER_BOOT_JITTER_MS = 5UL * 1000UL;
+constexpr uint8_t WEATHER_JITTER_PCT = 10;
+
+// Seconds to wait from a Retry-After header: delay-seconds, or an HTTP-date
+// (IMF-fixdate, "Sun, 06 Nov 1994 08:49:37 GMT") measured from the
+// response's Date header, or from `nowEpoch` if that is missing (0: clock
+// unknown). The obsolete RFC 850 and asctime() date forms give 0, as does
+// anything unparseable or already past.
+uint32_t parseRetryAfter(const char *value, const char *date, uint32_t nowEpoch);
+
+class WeatherScheduler {
+ public:
+  explicit WeatherScheduler(uint32_t seed = 1);
+
+  // Schedule the first fetch shortly after `nowMs` + `delayMs`.
+  void begin(uint32_t nowMs, uint32_t seed, uint32_t delayMs = 0);
+
+  // Make the next fetch due immediately (e.g. after reconfiguration).
+  void fetchNow(uint32_t nowMs) { nextFetchMs_ = nowMs; }
+
+  bool due(uint32_t nowMs) const { return (int32_t)(nowMs - nextFetchMs_) >= 0; }
+
+  void onSuccess(uint32_t nowMs, bool changed);
+  // `retryAfterSec` is the server's Retry-After (0 if absent).
+  void onFailure(uint32_t nowMs, uint32_t retryAfterSec);
+
+  uint32_t nextFetchMs() const { return nextFetchMs_; }
+  int32_t msUntilNext(uint32_t nowMs) const { return (int32_t)(nextFetchMs_ - nowMs); }
+  uint32_t intervalMs() const { return intervalMs_; }
+  uint16_t failureStreak() const { return failureStreak_; }
+  uint16_t unchangedStreak() const { return unchangedStreak_; }
+
+ private:
+  uint32_t jitter(uint32_t delayMs);
+  uint32_t nextRandom();
+
+  uint32_t rng_;
+  uint32_t nextFetchMs_ = 0;
+  uint32_t intervalMs_ = UPDATE_INTERVAL_MS;
+  uint16_t failureStreak_ = 0;
+  uint16_t unchangedStreak_ = 0;
+};
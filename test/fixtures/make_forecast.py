@@ -0,0 +1,105 @@
+"""Generate test/fixtures/forecast.json, a synthetic 5 day / 3 hour body.
+
+The body has the shape of an OpenWeather /data/2.5/forecast response for
+Toronto (UTC-4), as of 2024-06-15 12:00 UTC. Its values are made up, not
+recorded:
+    temp        a daily sine (min near 04:00 local, max near 16:00) rising
+                0.75 degrees a day
+    temp_min    temp - 1.25
+    temp_max    temp + 0.75
+    weather     cycled by entry index through seven conditions, d/n icon
+                from local 06:00-21:00
+    pop, wind   simple patterns of the index; pop is 0 for clear sky
+
+Every field the parser reads is present, and so are the ones it skips
+(sys, clouds, visibility, rain, ...). test_forecast_parser.cpp's expected
+buckets were checked by hand against --list, not computed from this
+script.
+
+    python test/fixtures/make_forecast.py          # rewrite forecast.json
+    python test/fixtures/make_forecast.py --list   # entries by local day
+"""
+
+import argparse
+import json
+import math
+import os
+import time
+
+FIXTURE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "forecast.json")
+
+NOW = 1718452800  # the current-conditions call's "dt"
+TZ = -4 * 3600
+ENTRIES = 40
+STEP = 3 * 3600
+
+# (description, icon group, id, main)
+CONDITIONS = [
+    ("clear sky", "01", 800, "Clear"),
+    ("few clouds", "02", 801, "Clouds"),
+    ("scattered clouds", "03", 802, "Clouds"),
+    ("overcast clouds", "04", 804, "Clouds"),
+    ("light rain", "10", 500, "Rain"),
+    ("moderate rain", "10", 501, "Rain"),
+    ("thunderstorm", "11", 211, "Thunderstorm"),
+]
+
+
+def entry(i, ts):
+    local_hour = ((ts + TZ) % 86400) // 3600
+    temp = round(18 + 7 * math.sin((local_hour - 9) / 24 * 2 * math.pi) + (i // 8) * 0.75, 2)
+    description, group, code, main = CONDITIONS[(i * 3 + i // 5) % len(CONDITIONS)]
+    pod = "d" if 6 <= local_hour < 21 else "n"
+    pop = round(((i * 37) % 100) / 100, 2) if main != "Clear" else 0
+    e = {
+        "dt": ts,
+        "main": {"temp": temp, "feels_like": round(temp - 0.8, 2),
+                 "temp_min": round(temp - 1.25, 2), "temp_max": round(temp + 0.75, 2),
+                 "pressure": 1012 + i % 6, "sea_level": 1012, "grnd_level": 995,
+                 "humidity": 55 + i % 30, "temp_kf": 0},
+        "weather": [{"id": code, "main": main, "description": description,
+                     "icon": group + pod}],
+        "clouds": {"all": (i * 13) % 100},
+        "wind": {"speed": round(2.1 + (i % 9) * 0.7, 2), "deg": (i * 40) % 360,
+                 "gust": round(4 + (i % 5), 2)},
+        "visibility": 10000,
+        "pop": pop,
+        "sys": {"pod": pod},
+        "dt_txt": time.strftime("%Y-%m-%d %H:%M:%S", time.gmtime(ts)),
+    }
+    if main == "Rain":
+        e["rain"] = {"3h": round(0.2 + (i % 4) * 0.4, 2)}
+    return e
+
+
+def forecast():
+    start = NOW - NOW % STEP + STEP
+    return {
+        "cod": "200", "message": 0, "cnt": ENTRIES,
+        "list": [entry(i, start + i * STEP) for i in range(ENTRIES)],
+        "city": {"id": 6167865, "name": "Toronto", "coord": {"lat": 43.7001, "lon": -79.4163},
+                 "country": "CA", "population": 4612191, "timezone": TZ,
+                 "sunrise": 1718444212, "sunset": 1718499424},
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--list", action="store_true",
+                        help="print the entries by local time instead of writing the file")
+    args = parser.parse_args()
+
+    doc = forecast()
+    if args.list:
+        for e in doc["list"]:
+            print("%s  dt=%d  min %6.2f  max %6.2f  pop %.2f  %s (%s)"
+                  % (time.strftime("%a %d %H:%M", time.gmtime(e["dt"] + TZ)), e["dt"],
+                     e["main"]["temp_min"], e["main"]["temp_max"], e["pop"],
+                     e["weather"][0]["description"], e["weather"][0]["icon"]))
+        return
+    with open(FIXTURE, "w", newline="\n") as f:
+        f.write(json.dumps(doc, separators=(",", ":")))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,166 @@
+// ForecastParser against a 5 day / 3 hour body:
+//   pio test -e native_test -f test_forecast_parser
+//
+// fixtures/forecast.json is synthetic, not recorded: make_forecast.py
+// writes an OpenWeather-shaped body for Toronto (UTC-4) as of 2024-06-15
+// 12:00 UTC, the time the current-conditions call reports. The expected
+// buckets below were read off `make_forecast.py --list` by hand, e.g.
+// Today: min 13.25 (23:00), max 25.51 (14:00), pop 74 % (17:00), and the
+// 11:00 entry as the one nearest local noon.
+
+#include <Arduino.h>
+#include <StreamString.h>
+#include <unity.h>
+
+#include <stdio.h>
+#include <string>
+
+#include "forecast_parser.h"
+
+namespace {
+
+constexpr uint32_t kUpdateEpoch = 1718452800;
+constexpr int32_t kToronto = -4 * 3600;
+
+std::string fixturePath() {
+  std::string path = __FILE__;
+  path.erase(path.find_last_of('/') + 1);
+  return path + "../fixtures/forecast.json";
+}
+
+bool loadFixture(StreamString &body) {
+  FILE *f = fopen(fixturePath().c_str(), "rb");
+  if (!f) return false;
+  char buf[1024];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) body.write((const uint8_t *)buf, n);
+  fclose(f);
+  return true;
+}
+
+WeatherData currentConditions() {
+  WeatherData data;
+  data.lastUpdateEpoch = kUpdateEpoch;
+  data.timezoneOffset = kToronto;
+  return data;
+}
+
+void assertDay(const WeatherForecast &day, uint32_t ts, const char *label, float tempMin,
+               float tempMax, uint8_t pop, const char *description, const char *icon) {
+  TEST_ASSERT_TRUE(day.valid);
+  TEST_ASSERT_EQUAL_UINT32(ts, day.timestamp);
+  TEST_ASSERT_EQUAL_STRING(label, day.label);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, tempMin, day.tempMin);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, tempMax, day.tempMax);
+  TEST_ASSERT_EQUAL_UINT8(pop, day.pop);
+  TEST_ASSERT_EQUAL_STRING(description, day.description);
+  TEST_ASSERT_EQUAL_UINT8(weatherIconIndex(icon), day.icon);
+}
+
+}  // namespace
+
+void test_buckets_days() {
+  StreamString body;
+  TEST_ASSERT_TRUE(loadFixture(body));
+  WeatherData data = currentConditions();
+  ForecastParser parser(data);
+
+  TEST_ASSERT_TRUE(parser.parse(body));
+  TEST_ASSERT_EQUAL_UINT16(40, parser.entries());
+
+  // Each day is represented by the entry nearest local noon
+  assertDay(data.forecast[0], 1718463600, "Today", 13.25f, 25.51f, 74, "clear sky", "01d");
+  assertDay(data.forecast[1], 1718550000, "Sun", 9.99f, 26.26f, 96, "light rain", "10d");
+  assertDay(data.forecast[2], 1718636400, "Mon", 10.74f, 27.01f, 92, "scattered clouds", "03d");
+  assertDay(data.forecast[3], 1718722800, "Tue", 11.49f, 27.76f, 99, "thunderstorm", "11d");
+  assertDay(data.forecast[4], 1718809200, "Wed", 12.24f, 28.51f, 84, "light rain", "10d");
+}
+
+void test_packs_hourly_points() {
+  StreamString body;
+  TEST_ASSERT_TRUE(loadFixture(body));
+  WeatherData data = currentConditions();
+  ForecastParser parser(data);
+  TEST_ASSERT_TRUE(parser.parse(body));
+
+  const HourlyForecast &hourly = data.hourly;
+  TEST_ASSERT_EQUAL_UINT32(1718463600, hourly.firstEpoch);
+  TEST_ASSERT_EQUAL_UINT8(WEATHER_FORECAST_POINTS, hourly.count);
+  for (uint8_t i = 0; i < hourly.count; ++i) TEST_ASSERT_EQUAL_UINT8(i, hourly.points[i].slot);
+
+  const ForecastPoint &first = hourly.points[0];
+  TEST_ASSERT_EQUAL_INT16(215, first.tempTenths);
+  TEST_ASSERT_EQUAL_UINT8(0, first.pop);
+  TEST_ASSERT_EQUAL_UINT8(4, first.windHalves);
+  TEST_ASSERT_EQUAL_UINT8(weatherIconIndex("01d"), first.icon);
+
+  const ForecastPoint &second = hourly.points[1];
+  TEST_ASSERT_EQUAL_INT16(248, second.tempTenths);
+  TEST_ASSERT_EQUAL_UINT8(37, second.pop);
+  TEST_ASSERT_EQUAL_UINT8(6, second.windHalves);
+  TEST_ASSERT_EQUAL_UINT8(weatherIconIndex("04d"), second.icon);
+
+  const ForecastPoint &last = hourly.points[39];
+  TEST_ASSERT_EQUAL_INT16(192, last.tempTenths);
+  TEST_ASSERT_EQUAL_UINT8(43, last.pop);
+  TEST_ASSERT_EQUAL_UINT8(8, last.windHalves);
+  TEST_ASSERT_EQUAL_UINT8(weatherIconIndex("10d"), last.icon);
+}
+
+void test_peak_json_heap_is_one_entry() {
+  StreamString body;
+  TEST_ASSERT_TRUE(loadFixture(body));
+  TEST_ASSERT_GREATER_THAN(15000, body.length());
+  WeatherData data = currentConditions();
+  ForecastParser parser(data);
+  TEST_ASSERT_TRUE(parser.parse(body));
+
+  // What a document of the whole body costs, for scale
+  StreamString again;
+  TEST_ASSERT_TRUE(loadFixture(again));
+  CountingAllocator wholeAlloc;
+  {
+    JsonDocument whole(&wholeAlloc);
+    TEST_ASSERT_FALSE(deserializeJson(whole, again));
+  }
+
+  // The filter plus one filtered entry: memory pools are sized per pointer
+  // width, so compare against the whole document rather than a byte count
+  TEST_ASSERT_GREATER_THAN(0, parser.peakJsonBytes());
+  TEST_ASSERT_LESS_THAN(wholeAlloc.peakBytes() / 2, parser.peakJsonBytes());
+}
+
+void test_applies_city_timezone() {
+  StreamString body;
+  TEST_ASSERT_TRUE(loadFixture(body));
+  WeatherData data = currentConditions();
+  data.timezoneOffset = 0;  // current-conditions response without one
+  ForecastParser parser(data);
+  TEST_ASSERT_TRUE(parser.parse(body));
+  TEST_ASSERT_EQUAL_INT32(kToronto, data.timezoneOffset);
+}
+
+void test_truncated_body_keeps_parsed_days() {
+  StreamString full;
+  TEST_ASSERT_TRUE(loadFixture(full));
+  StreamString body;
+  body.concat(full.c_str(), full.length() / 2);
+  WeatherData data = currentConditions();
+  ForecastParser parser(data);
+
+  TEST_ASSERT_TRUE(parser.parse(body));
+  TEST_ASSERT_TRUE(parser.entries() > 10 && parser.entries() < 30);
+  TEST_ASSERT_TRUE(data.forecast[0].valid);
+  TEST_ASSERT_FALSE(data.forecast[WEATHER_FORECAST_DAYS - 1].valid);
+  TEST_ASSERT_EQUAL_INT32(kToronto, data.timezoneOffset);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_buckets_days);
+  RUN_TEST(test_packs_hourly_points);
+  RUN_TEST(test_peak_json_heap_is_one_entry);
+  RUN_TEST(test_applies_city_timezone);
+  RUN_TEST(test_truncated_body_keeps_parsed_days);
+  return UNITY_END();
+}
@@ -0,0 +1,289 @@
+// TaskScheduler's timer wheel against a brute-force deadline model, plus
+// the cases worth pinning down on their own:
+//   pio test -e native_test -f test_task_scheduler
+//
+// Time is whatever runDue() is passed; the wheel never reads the clock for
+// deadlines, so none of this depends on how fast the host is.
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "task_scheduler.h"
+
+namespace {
+
+constexpr uint32_t kSeeds = 200;
+constexpr uint32_t kStepsPerSeed = 3000;
+
+TaskScheduler sched;
+std::vector<int8_t> runLog;
+void (*onRun)(int8_t id) = nullptr;  // called from inside the running task
+
+template <int8_t N>
+void job() {
+  runLog.push_back(N);
+  if (onRun) onRun(N);
+}
+
+const SchedFn kJobs[SCHED_MAX_TASKS] = {job<0>, job<1>, job<2>, job<3>,
+                                        job<4>, job<5>, job<6>, job<7>};
+
+// runDue() at `nowMs`; the ids that ran, in order.
+std::vector<int8_t> runAt(uint32_t nowMs) {
+  runLog.clear();
+  sched.runDue(nowMs);
+  return runLog;
+}
+
+void assertRan(const std::vector<int8_t> &expected, const std::vector<int8_t> &actual) {
+  TEST_ASSERT_EQUAL_UINT32(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) TEST_ASSERT_EQUAL_INT8(expected[i], actual[i]);
+}
+
+uint32_t lcg(uint32_t &state) {
+  state = state * 1664525u + 1013904223u;
+  return state >> 8;
+}
+
+// What the scheduler promises, one task at a time and no wheel: a task runs
+// on the first runDue() at or after its deadline, tasks due together run by
+// priority then id, and a run re-arms at deadline + period, or now + period
+// if a whole period was lost.
+struct ModelTask {
+  uint32_t deadline;
+  uint32_t periodMs;
+  uint32_t lastRunMs;
+  SchedPriority priority;
+  bool woken;
+  uint32_t runs;
+  uint32_t overruns;
+};
+
+struct Model {
+  std::vector<ModelTask> tasks;
+  uint32_t now;
+
+  void add(uint32_t periodMs, SchedPriority priority, uint32_t delayMs) {
+    tasks.push_back({now + delayMs, periodMs, now, priority, false, 0, 0});
+  }
+
+  void wake(int8_t id) {
+    tasks[id].deadline = now;
+    tasks[id].woken = true;
+  }
+
+  void setPeriod(int8_t id, uint32_t periodMs) {
+    ModelTask &t = tasks[id];
+    if (t.periodMs == periodMs) return;
+    t.periodMs = periodMs;
+    t.deadline = t.lastRunMs + periodMs;
+    t.woken = false;
+  }
+
+  std::vector<int8_t> runDue(uint32_t nowMs) {
+    now = nowMs;
+    std::vector<int8_t> due;
+    for (uint8_t p = SCHED_PRIO_HIGH; p <= SCHED_PRIO_LOW; ++p) {
+      for (size_t i = 0; i < tasks.size(); ++i) {
+        const ModelTask &t = tasks[i];
+        if (t.priority == p && (t.woken || (int32_t)(t.deadline - nowMs) <= 0)) {
+          due.push_back((int8_t)i);
+        }
+      }
+    }
+    for (int8_t id : due) {
+      ModelTask &t = tasks[id];
+      t.runs++;
+      t.lastRunMs = nowMs;
+      t.woken = false;
+      uint32_t next = t.deadline + t.periodMs;
+      if ((int32_t)(next - nowMs) <= 0) {
+        next = nowMs + t.periodMs;
+        t.overruns++;
+      }
+      t.deadline = next;
+    }
+    return due;
+  }
+};
+
+// Periods and delays that straddle the 64 ms / 4.1 s / 262 s slot sizes.
+uint32_t randomSpan(uint32_t &rng) {
+  static const uint32_t kEdges[] = {1, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, 262145};
+  switch (lcg(rng) % 4) {
+    case 0:
+      return kEdges[lcg(rng) % (sizeof(kEdges) / sizeof(kEdges[0]))];
+    case 1:
+      return 1 + lcg(rng) % 100;
+    case 2:
+      return 1 + lcg(rng) % 10000;
+    default:
+      return 1 + lcg(rng) % 600000;
+  }
+}
+
+}  // namespace
+
+void test_matches_deadline_model_across_wrap() {
+  for (uint32_t seed = 1; seed <= kSeeds; ++seed) {
+    uint32_t rng = seed;
+    // Start within ~70 minutes of the millis() wrap so every run crosses it
+    uint32_t now = UINT32_MAX - lcg(rng) % (1UL << 22);
+    sched.begin(now);
+    Model model;
+    model.now = now;
+
+    uint8_t count = 1 + lcg(rng) % SCHED_MAX_TASKS;
+    for (uint8_t i = 0; i < count; ++i) {
+      uint32_t period = randomSpan(rng);
+      uint32_t delay = lcg(rng) % 3 ? randomSpan(rng) : 0;
+      SchedPriority prio = (SchedPriority)(lcg(rng) % 3);
+      TEST_ASSERT_EQUAL_INT8(i, sched.add("job", kJobs[i], period, prio, delay));
+      model.add(period, prio, delay);
+    }
+
+    for (uint32_t step = 0; step < kStepsPerSeed; ++step) {
+      uint32_t r = lcg(rng) % 100;
+      if (r < 3) {
+        int8_t id = lcg(rng) % count;
+        sched.wake(id);
+        model.wake(id);
+      } else if (r < 6) {
+        int8_t id = lcg(rng) % count;
+        uint32_t period = randomSpan(rng);
+        sched.setPeriod(id, period);
+        model.setPeriod(id, period);
+      }
+
+      // Mostly small steps, now and then a long sleep
+      uint32_t advance = r < 80 ? lcg(rng) % 70 : (r < 97 ? lcg(rng) % 5000 : randomSpan(rng));
+      now += advance;
+      std::vector<int8_t> expected = model.runDue(now);
+      assertRan(expected, runAt(now));
+    }
+
+    for (uint8_t i = 0; i < count; ++i) {
+      TEST_ASSERT_EQUAL_UINT32(model.tasks[i].runs, sched.stats(i).runs);
+      TEST_ASSERT_EQUAL_UINT32(model.tasks[i].overruns, sched.stats(i).overruns);
+    }
+  }
+}
+
+void test_cascades_at_level_boundaries() {
+  static const uint32_t kStarts[] = {0, 1, 63, 4095, 262143, UINT32_MAX - 70, UINT32_MAX};
+  static const uint32_t kDelays[] = {1,    63,    64,     65,     4095,    4096,
+                                     4097, 262143, 262144, 262145, 5000000, SCHED_MAX_PERIOD_MS};
+  for (uint32_t start : kStarts) {
+    for (uint32_t delay : kDelays) {
+      // Stepping one tick at a time up to the deadline...
+      sched.begin(start);
+      sched.add("job", kJobs[0], SCHED_MAX_PERIOD_MS, SCHED_PRIO_NORMAL, delay);
+      uint32_t deadline = start + delay;
+      if (delay > 1) assertRan({}, runAt(deadline - 2));
+      assertRan({}, runAt(deadline - 1));
+      assertRan({0}, runAt(deadline));
+      assertRan({}, runAt(deadline + 1));
+
+      // ...and jumping straight past it
+      sched.begin(start);
+      sched.add("job", kJobs[0], SCHED_MAX_PERIOD_MS, SCHED_PRIO_NORMAL, delay);
+      assertRan({0}, runAt(deadline + 5));
+    }
+  }
+}
+
+void test_priority_order_when_due_together() {
+  sched.begin(1000);
+  sched.add("low", kJobs[0], 100, SCHED_PRIO_LOW);
+  sched.add("normal-a", kJobs[1], 100, SCHED_PRIO_NORMAL);
+  sched.add("high", kJobs[2], 100, SCHED_PRIO_HIGH);
+  sched.add("normal-b", kJobs[3], 100, SCHED_PRIO_NORMAL, 100);
+  sched.add("high-late", kJobs[4], 100, SCHED_PRIO_HIGH, 100);
+
+  assertRan({2, 1, 0}, runAt(1000));
+  assertRan({}, runAt(1050));
+  // Every one due at 1100: highest priority first, registration order within
+  assertRan({2, 4, 1, 3, 0}, runAt(1100));
+}
+
+void test_overrun_restarts_period_from_now() {
+  sched.begin(0);
+  sched.add("job", kJobs[0], 10, SCHED_PRIO_NORMAL, 10);
+
+  // Late, but within a period: the cadence holds
+  assertRan({0}, runAt(15));
+  TEST_ASSERT_EQUAL_UINT32(0, sched.stats(0).overruns);
+  TEST_ASSERT_EQUAL_UINT32(5, sched.stats(0).maxLateMs);
+  assertRan({}, runAt(19));
+  assertRan({0}, runAt(20));
+
+  // A whole period lost: one run, then a fresh period from now
+  assertRan({0}, runAt(47));
+  TEST_ASSERT_EQUAL_UINT32(1, sched.stats(0).overruns);
+  TEST_ASSERT_EQUAL_UINT32(17, sched.stats(0).maxLateMs);
+  assertRan({}, runAt(56));
+  assertRan({0}, runAt(57));
+  TEST_ASSERT_EQUAL_UINT32(4, sched.stats(0).runs);
+}
+
+void test_wake_while_running_runs_again_next_call() {
+  sched.begin(0);
+  sched.add("job", kJobs[0], 100, SCHED_PRIO_NORMAL, 100);
+  onRun = [](int8_t id) {
+    if (sched.stats(id).runs == 0) sched.wake(id);  // first run only
+  };
+
+  // Woken from inside: not again in the same call, but on the next one
+  assertRan({0}, runAt(100));
+  assertRan({0}, runAt(100));
+  // The woken run keeps the cadence from the wake time
+  assertRan({}, runAt(199));
+  assertRan({0}, runAt(200));
+  onRun = nullptr;
+}
+
+void test_set_period_while_running() {
+  sched.begin(0);
+  sched.add("job", kJobs[0], 100, SCHED_PRIO_NORMAL, 100);
+  onRun = [](int8_t id) { sched.setPeriod(id, 30); };
+
+  // The new period applies to the re-arm when the run returns
+  assertRan({0}, runAt(100));
+  TEST_ASSERT_EQUAL_UINT32(30, sched.stats(0).periodMs);
+  assertRan({}, runAt(129));
+  assertRan({0}, runAt(130));
+  onRun = nullptr;
+
+  // Outside a run it counts from the last run: 130 + 500
+  sched.setPeriod(0, 500);
+  assertRan({}, runAt(629));
+  assertRan({0}, runAt(630));
+}
+
+void test_wake_and_idle_wait() {
+  sched.begin(0);
+  sched.add("job", kJobs[0], 1000, SCHED_PRIO_NORMAL, 1000);
+  TEST_ASSERT_EQUAL_UINT32(1000, sched.msUntilNext(0));
+  assertRan({}, runAt(600));
+  TEST_ASSERT_EQUAL_UINT32(400, sched.msUntilNext(600));
+
+  // A wake counts as due at the wheel time of the last runDue()
+  sched.wake(0);
+  TEST_ASSERT_EQUAL_UINT32(0, sched.msUntilNext(600));
+  assertRan({0}, runAt(600));
+  TEST_ASSERT_EQUAL_UINT32(1000, sched.msUntilNext(600));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_deadline_model_across_wrap);
+  RUN_TEST(test_cascades_at_level_boundaries);
+  RUN_TEST(test_priority_order_when_due_together);
+  RUN_TEST(test_overrun_restarts_period_from_now);
+  RUN_TEST(test_wake_while_running_runs_again_next_call);
+  RUN_TEST(test_set_period_while_running);
+  RUN_TEST(test_wake_and_idle_wait);
+  return UNITY_END();
+}
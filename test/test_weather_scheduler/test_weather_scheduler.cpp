@@ -0,0 +1,169 @@
+// WeatherScheduler on a fake clock:
+//   pio test -e native_test -f test_weather_scheduler
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "weather_scheduler.h"
+
+namespace {
+
+constexpr uint32_t kSeeds = 200;
+
+// Lower and upper bound of a delay after +-WEATHER_JITTER_PCT jitter
+uint32_t jitterLow(uint32_t delayMs) { return delayMs - delayMs / 100 * WEATHER_JITTER_PCT; }
+uint32_t jitterHigh(uint32_t delayMs) { return delayMs + delayMs / 100 * WEATHER_JITTER_PCT; }
+
+void assertWithinJitter(uint32_t delayMs, int32_t actualMs) {
+  TEST_ASSERT_GREATER_OR_EQUAL(jitterLow(delayMs), actualMs);
+  TEST_ASSERT_LESS_OR_EQUAL(jitterHigh(delayMs), actualMs);
+}
+
+}  // namespace
+
+void test_boot_fetch_spread_over_boot_jitter() {
+  uint32_t earliest = UINT32_MAX, latest = 0;
+  for (uint32_t seed = 1; seed <= kSeeds; ++seed) {
+    WeatherScheduler sched;
+    sched.begin(1000, seed, 15000);
+    int32_t wait = sched.msUntilNext(1000);
+    TEST_ASSERT_GREATER_OR_EQUAL(15000, wait);
+    TEST_ASSERT_LESS_OR_EQUAL(15000 + WEATHER_BOOT_JITTER_MS, wait);
+    earliest = min(earliest, (uint32_t)wait);
+    latest = max(latest, (uint32_t)wait);
+  }
+  // Devices with different seeds don't start in lockstep
+  TEST_ASSERT_GREATER_THAN(WEATHER_BOOT_JITTER_MS / 2, latest - earliest);
+}
+
+void test_success_interval_jitter_bounds() {
+  for (uint32_t seed = 1; seed <= kSeeds; ++seed) {
+    WeatherScheduler sched;
+    sched.begin(0, seed);
+    sched.onSuccess(50000, true);
+    TEST_ASSERT_EQUAL_UINT32(UPDATE_INTERVAL_MS, sched.intervalMs());
+    assertWithinJitter(UPDATE_INTERVAL_MS, sched.msUntilNext(50000));
+  }
+}
+
+void test_backoff_doubles_then_caps() {
+  WeatherScheduler sched;
+  sched.begin(0, 7);
+  uint32_t now = 0;
+  uint32_t expected = WEATHER_BACKOFF_MIN_MS;
+  for (uint16_t failures = 1; failures <= 20; ++failures) {
+    sched.onFailure(now, 0);
+    TEST_ASSERT_EQUAL_UINT16(failures, sched.failureStreak());
+    assertWithinJitter(expected, sched.msUntilNext(now));
+    TEST_ASSERT_EQUAL_UINT32(sched.intervalMs(), (uint32_t)sched.msUntilNext(now));
+    now = sched.nextFetchMs();
+    expected = min(expected * 2, WEATHER_BACKOFF_MAX_MS);
+  }
+  TEST_ASSERT_EQUAL_UINT32(WEATHER_BACKOFF_MAX_MS, expected);
+
+  // One success resets the streak
+  sched.onSuccess(now, true);
+  TEST_ASSERT_EQUAL_UINT16(0, sched.failureStreak());
+  sched.onFailure(sched.nextFetchMs(), 0);
+  assertWithinJitter(WEATHER_BACKOFF_MIN_MS, sched.intervalMs());
+}
+
+void test_retry_after_is_a_floor() {
+  for (uint32_t seed = 1; seed <= kSeeds; ++seed) {
+    WeatherScheduler sched;
+    sched.begin(0, seed);
+    // Well above the first backoff step: the server's wait wins, and jitter
+    // only ever adds to it
+    sched.onFailure(1000, 120);
+    TEST_ASSERT_GREATER_OR_EQUAL(120000, sched.msUntilNext(1000));
+    TEST_ASSERT_LESS_OR_EQUAL(120000 + 12000, sched.msUntilNext(1000));
+  }
+
+  // Below the backoff: the backoff stands
+  WeatherScheduler sched;
+  sched.begin(0, 3);
+  sched.onFailure(0, 1);
+  assertWithinJitter(WEATHER_BACKOFF_MIN_MS, sched.msUntilNext(0));
+
+  // Absurd values are capped at the longest backoff
+  sched.onFailure(0, 7 * 24 * 3600);
+  TEST_ASSERT_GREATER_OR_EQUAL(WEATHER_BACKOFF_MAX_MS, sched.msUntilNext(0));
+  TEST_ASSERT_LESS_OR_EQUAL(WEATHER_BACKOFF_MAX_MS + WEATHER_BACKOFF_MAX_MS / 10,
+                            sched.msUntilNext(0));
+}
+
+void test_unchanged_data_stretches_interval() {
+  WeatherScheduler sched;
+  sched.begin(0, 11);
+  uint32_t now = 0;
+  uint32_t expected = UPDATE_INTERVAL_MS;
+  for (uint16_t repeats = 1; repeats <= 6; ++repeats) {
+    sched.onSuccess(now, false);
+    expected = min(expected + expected / 2, WEATHER_MAX_INTERVAL_MS);
+    TEST_ASSERT_EQUAL_UINT16(repeats, sched.unchangedStreak());
+    TEST_ASSERT_EQUAL_UINT32(expected, sched.intervalMs());
+    assertWithinJitter(expected, sched.msUntilNext(now));
+    now = sched.nextFetchMs();
+  }
+  TEST_ASSERT_EQUAL_UINT32(WEATHER_MAX_INTERVAL_MS, sched.intervalMs());
+
+  sched.onSuccess(now, true);
+  TEST_ASSERT_EQUAL_UINT16(0, sched.unchangedStreak());
+  TEST_ASSERT_EQUAL_UINT32(UPDATE_INTERVAL_MS, sched.intervalMs());
+}
+
+void test_due_across_millis_wrap() {
+  const uint32_t beforeWrap = UINT32_MAX - 60000;  // a minute before millis() wraps
+  WeatherScheduler sched;
+  sched.begin(beforeWrap, 5);
+  sched.onSuccess(beforeWrap, true);
+
+  const uint32_t next = sched.nextFetchMs();
+  TEST_ASSERT_TRUE(next < beforeWrap);  // lands after the wrap
+  TEST_ASSERT_FALSE(sched.due(beforeWrap));
+  TEST_ASSERT_FALSE(sched.due(UINT32_MAX));
+  TEST_ASSERT_FALSE(sched.due(0));
+  TEST_ASSERT_FALSE(sched.due(next - 1));
+  TEST_ASSERT_TRUE(sched.due(next));
+  TEST_ASSERT_TRUE(sched.due(next + 1000));
+  TEST_ASSERT_GREATER_THAN(0, sched.msUntilNext(UINT32_MAX));
+  TEST_ASSERT_EQUAL_INT32(-1000, sched.msUntilNext(next + 1000));
+
+  sched.fetchNow(UINT32_MAX - 5);
+  TEST_ASSERT_TRUE(sched.due(3));
+}
+
+void test_parse_retry_after() {
+  const char *date = "Sat, 15 Jun 2024 12:00:00 GMT";  // 1718452800
+  TEST_ASSERT_EQUAL_UINT32(120, parseRetryAfter("120", date, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, parseRetryAfter("0", nullptr, 0));
+  TEST_ASSERT_EQUAL_UINT32(90, parseRetryAfter("Sat, 15 Jun 2024 12:01:30 GMT", date, 0));
+  TEST_ASSERT_EQUAL_UINT32(86400 + 3600,
+                           parseRetryAfter("Sun, 16 Jun 2024 13:00:00 GMT", date, 0));
+  // Across a month and a leap day
+  TEST_ASSERT_EQUAL_UINT32(2 * 86400,
+                           parseRetryAfter("Fri, 01 Mar 2024 00:00:00 GMT",
+                                           "Wed, 28 Feb 2024 00:00:00 GMT", 0));
+  // No Date header: the device clock, if known
+  TEST_ASSERT_EQUAL_UINT32(60, parseRetryAfter("Sat, 15 Jun 2024 12:01:00 GMT", "",
+                                               1718452800));
+  TEST_ASSERT_EQUAL_UINT32(0, parseRetryAfter("Sat, 15 Jun 2024 12:01:00 GMT", "", 0));
+  // Past, obsolete forms and junk
+  TEST_ASSERT_EQUAL_UINT32(0, parseRetryAfter("Sat, 15 Jun 2024 11:00:00 GMT", date, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, parseRetryAfter("Saturday, 15-Jun-24 12:01:00 GMT", date, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, parseRetryAfter("Sat Jun 15 12:01:00 2024", date, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, parseRetryAfter("soon", date, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, parseRetryAfter(nullptr, date, 0));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_fetch_spread_over_boot_jitter);
+  RUN_TEST(test_success_interval_jitter_bounds);
+  RUN_TEST(test_backoff_doubles_then_caps);
+  RUN_TEST(test_retry_after_is_a_floor);
+  RUN_TEST(test_unchanged_data_stretches_interval);
+  RUN_TEST(test_due_across_millis_wrap);
+  RUN_TEST(test_parse_retry_after);
+  return UNITY_END();
+}